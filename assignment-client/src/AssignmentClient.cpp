@@ -25,9 +25,11 @@
 #include <AddressManager.h>
 #include <Assignment.h>
 #include <CrashAnnotations.h>
+#include <HTTPConnection.h>
 #include <LogHandler.h>
 #include <LogUtils.h>
 #include <LimitedNodeList.h>
+#include <MetricsRegistry.h>
 #include <NodeList.h>
 #include <udt/PacketHeaders.h>
 #include <SharedUtil.h>
@@ -46,7 +48,7 @@ const long long ASSIGNMENT_REQUEST_INTERVAL_MSECS = 1 * 1000;
 
 AssignmentClient::AssignmentClient(Assignment::Type requestAssignmentType, QString assignmentPool,
                                    quint16 listenPort, QUuid walletUUID, QString assignmentServerHostname,
-                                   quint16 assignmentServerPort, quint16 assignmentMonitorPort,
+                                   quint16 assignmentServerPort, quint16 assignmentMonitorPort, quint16 metricsPort,
                                    bool disableDomainPortAutoDiscovery) :
     _assignmentServerHostname(DEFAULT_ASSIGNMENT_SERVER_HOSTNAME)
 {
@@ -129,6 +131,11 @@ AssignmentClient::AssignmentClient(Assignment::Type requestAssignmentType, QStri
         // Hook up a timer to send this child's status to the Monitor once per second
         setUpStatusToMonitor();
     }
+
+    if (metricsPort > 0) {
+        qCDebug(assignment_client) << "Serving metrics on port" << metricsPort;
+        _metricsHTTPManager.reset(new HTTPManager(QHostAddress::AnyIPv4, metricsPort, "", this));
+    }
     auto& packetReceiver = DependencyManager::get<NodeList>()->getPacketReceiver();
     packetReceiver.registerListener(PacketType::CreateAssignment,
         PacketReceiver::makeUnsourcedListenerReference<AssignmentClient>(this, &AssignmentClient::handleCreateAssignmentPacket));
@@ -178,6 +185,19 @@ void AssignmentClient::aboutToQuit() {
     stopAssignmentClient();
 }
 
+bool AssignmentClient::handleHTTPRequest(HTTPConnection* connection, const QUrl& url, bool skipSubHandler) {
+    const QString URI_METRICS = "/metrics";
+    const QString METRICS_MIME_TYPE = "text/plain; version=0.0.4";
+
+    if (url.path() == URI_METRICS) {
+        connection->respond(HTTPConnection::StatusCode200, MetricsRegistry::getInstance().toPrometheusText(),
+                            qPrintable(METRICS_MIME_TYPE));
+    } else {
+        connection->respond(HTTPConnection::StatusCode404);
+    }
+    return true;
+}
+
 void AssignmentClient::setUpStatusToMonitor() {
     // send a stats packet every 1 seconds
     connect(&_statsTimerACM, &QTimer::timeout, this, &AssignmentClient::sendStatusPacketToACM);
@@ -189,15 +209,19 @@ void AssignmentClient::sendStatusPacketToACM() {
     auto nodeList = DependencyManager::get<NodeList>();
 
     quint8 assignmentType = Assignment::Type::AllTypes;
+    float load = 0.0f;
 
     if (_currentAssignment) {
         assignmentType = _currentAssignment->getType();
+        load = _currentAssignment->getLoad();
     }
 
-    auto statusPacket = NLPacket::create(PacketType::AssignmentClientStatus, sizeof(assignmentType) + NUM_BYTES_RFC4122_UUID);
+    auto statusPacket = NLPacket::create(PacketType::AssignmentClientStatus,
+                                         NUM_BYTES_RFC4122_UUID + sizeof(assignmentType) + sizeof(load));
 
     statusPacket->write(_childAssignmentUUID.toRfc4122());
     statusPacket->writePrimitive(assignmentType);
+    statusPacket->writePrimitive(load);
 
     nodeList->sendPacket(std::move(statusPacket), _assignmentClientMonitorSocket);
 }
@@ -17,21 +17,25 @@
 #include <QtCore/QPointer>
 #include <QtCore/QSharedPointer>
 
+#include <HTTPManager.h>
 #include <shared/WebRTC.h>
 
 #include "ThreadedAssignment.h"
 
 class QSharedMemory;
 
-class AssignmentClient : public QObject {
+class AssignmentClient : public QObject, public HTTPRequestHandler {
     Q_OBJECT
 public:
     AssignmentClient(Assignment::Type requestAssignmentType, QString assignmentPool,
                      quint16 listenPort, QUuid walletUUID, QString assignmentServerHostname,
-                     quint16 assignmentServerPort, quint16 assignmentMonitorPort,
+                     quint16 assignmentServerPort, quint16 assignmentMonitorPort, quint16 metricsPort,
                      bool disableDomainPortAutoDiscovery);
     ~AssignmentClient();
 
+    // serves the MetricsRegistry's metrics on /metrics
+    bool handleHTTPRequest(HTTPConnection* connection, const QUrl& url, bool skipSubHandler = false) override;
+
 public slots:
     void aboutToQuit();
 
@@ -65,6 +69,7 @@ private:
     QTimer _statsTimerACM; // timer for sending stats to assignment client monitor
     QUuid _childAssignmentUUID = QUuid::createUuid();
     bool _disableDomainPortAutoDiscovery { false };
+    std::unique_ptr<HTTPManager> _metricsHTTPManager;
 
  protected:
     SockAddr _assignmentClientMonitorSocket;
@@ -22,8 +22,12 @@ public:
     Assignment::Type getChildType() { return _childType; }
     void setChildType(Assignment::Type childType) { _childType = childType; }
 
+    float getLoad() const { return _load; }
+    void setLoad(float load) { _load = load; }
+
 private:
     Assignment::Type _childType;
+    float _load { 0.0f }; // how much of its time the child's assignment spends working, from 0 to 1
 };
 
 #endif // hifi_AssignmentClientChildData_h
@@ -33,6 +33,10 @@
 const QString ASSIGNMENT_CLIENT_MONITOR_TARGET_NAME = "assignment-client-monitor";
 const int WAIT_FOR_CHILD_MSECS = 1000;
 
+// a spare is kept ready for each child whose load is over the first, and retired once its load has fallen under the second
+const float LOADED_CHILD_LOAD = 0.8f;
+const float UNLOADED_CHILD_LOAD = 0.6f;
+
 #ifdef Q_OS_WIN
 void* PROCESS_GROUP = createProcessGroup();
 #endif
@@ -42,7 +46,8 @@ AssignmentClientMonitor::AssignmentClientMonitor(const unsigned int numAssignmen
                                                  const unsigned int maxAssignmentClientForks,
                                                  Assignment::Type requestAssignmentType, QString assignmentPool,
                                                  quint16 listenPort, quint16 childMinListenPort, QUuid walletUUID, QString assignmentServerHostname,
-                                                 quint16 assignmentServerPort, quint16 httpStatusServerPort, QString logDirectory,
+                                                 quint16 assignmentServerPort, quint16 httpStatusServerPort,
+                                                 quint16 childMinMetricsPort, QString logDirectory,
                                                  bool disableDomainPortAutoDiscovery) :
     _httpManager(QHostAddress::LocalHost, httpStatusServerPort, "", this),
     _numAssignmentClientForks(numAssignmentClientForks),
@@ -54,10 +59,15 @@ AssignmentClientMonitor::AssignmentClientMonitor(const unsigned int numAssignmen
     _assignmentServerHostname(assignmentServerHostname),
     _assignmentServerPort(assignmentServerPort),
     _childMinListenPort(childMinListenPort),
+    _childMinMetricsPort(childMinMetricsPort),
     _disableDomainPortAutoDiscovery(disableDomainPortAutoDiscovery)
 {
     qDebug() << "_requestAssignmentType =" << _requestAssignmentType;
 
+    if (_childMinMetricsPort && !_childMinListenPort) {
+        qWarning() << "The children's metrics ports follow their listen ports, set a minimum listen port to serve metrics";
+    }
+
     if (!logDirectory.isEmpty()) {
         _wantsChildFileLogging = true;
         _logDirectory = QDir(logDirectory);
@@ -208,6 +218,11 @@ void AssignmentClientMonitor::spawnChildClient() {
     if (listenPort) {
         _childArguments.append("-" + ASSIGNMENT_CLIENT_LISTEN_PORT_OPTION);
         _childArguments.append(QString::number(listenPort));
+
+        if (_childMinMetricsPort) {
+            _childArguments.append("--" + ASSIGNMENT_METRICS_PORT_OPTION);
+            _childArguments.append(QString::number(_childMinMetricsPort + (listenPort - _childMinListenPort)));
+        }
     }
 
     // tell children which assignment monitor port to use
@@ -296,6 +311,8 @@ void AssignmentClientMonitor::checkSpares() {
     QUuid aSpareId = "";
     unsigned int spareCount = 0;
     unsigned int totalCount = 0;
+    unsigned int loadedCount = 0;
+    unsigned int busyCount = 0;
 
     nodeList->removeSilentNodes();
 
@@ -305,19 +322,28 @@ void AssignmentClientMonitor::checkSpares() {
         if (childData->getChildType() == Assignment::Type::AllTypes) {
             ++spareCount;
             aSpareId = node->getUUID();
+        } else {
+            if (childData->getLoad() > LOADED_CHILD_LOAD) {
+                ++loadedCount;
+            }
+            if (childData->getLoad() > UNLOADED_CHILD_LOAD) {
+                ++busyCount;
+            }
         }
     });
 
     // Spawn or kill children, as needed.  If --min or --max weren't specified, allow the child count
     // to drift up or down as far as needed.
+    // Besides the spare for the next assignment, keep one ready to take over from each child that's running out of
+    // headroom, so that the domain-server's next assignment doesn't wait for a child to start.
 
-    if (spareCount < 1 || totalCount < _minAssignmentClientForks) {
+    if (spareCount < 1 + loadedCount || totalCount < _minAssignmentClientForks) {
         if (!_maxAssignmentClientForks || totalCount < _maxAssignmentClientForks) {
             spawnChildClient();
         }
     }
 
-    if (spareCount > 1) {
+    if (spareCount > 1 + busyCount) {
         if (!_minAssignmentClientForks || totalCount > _minAssignmentClientForks) {
             // kill aSpareId
             qDebug() << "asking child" << aSpareId << "to exit.";
@@ -377,6 +403,10 @@ void AssignmentClientMonitor::handleChildStatusPacket(QSharedPointer<ReceivedMes
 
         childData->setChildType(Assignment::Type(assignmentType));
 
+        float load;
+        message->readPrimitive(&load);
+        childData->setLoad(load);
+
         // note when this child talked
         matchingNode->setLastHeardMicrostamp(usecTimestampNow());
     }
@@ -41,7 +41,7 @@ public:
                             const unsigned int maxAssignmentClientForks, Assignment::Type requestAssignmentType,
                             QString assignmentPool, quint16 listenPort, quint16 childMinListenPort, QUuid walletUUID,
                             QString assignmentServerHostname, quint16 assignmentServerPort, quint16 httpStatusServerPort,
-                            QString logDirectory, bool disableDomainPortAutoDiscovery);
+                            quint16 childMinMetricsPort, QString logDirectory, bool disableDomainPortAutoDiscovery);
     ~AssignmentClientMonitor();
 
     void stopChildProcesses();
@@ -79,6 +79,7 @@ private:
     QMap<qint64, ACProcess> _childProcesses;
 
     quint16 _childMinListenPort;
+    quint16 _childMinMetricsPort; // each child's is offset by as much as its listen port is
     QSet<quint16> _childListenPorts;
 
     bool _wantsChildFileLogging { false };
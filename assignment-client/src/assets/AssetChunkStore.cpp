@@ -0,0 +1,268 @@
+//
+//  AssetChunkStore.cpp
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AssetChunkStore.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <set>
+
+#include <QtCore/QDataStream>
+#include <QtCore/QFile>
+#include <QtCore/QSaveFile>
+
+#include "AssetServerLogging.h"
+
+const QString AssetChunkStore::INDEX_EXTENSION = ".chunks";
+
+static const QString CHUNKS_SUBDIR = "chunks";
+
+static const char INDEX_MAGIC[4] = { 'A', 'C', 'H', 'K' };
+static const quint32 INDEX_FORMAT_VERSION = 1;
+
+using GearTable = std::array<uint64_t, 256>;
+
+// the boundaries have to be the same every time the server runs for chunks to be shared, so the table is generated
+// from a fixed seed (with splitmix64) rather than randomly
+static GearTable makeGearTable() {
+    GearTable table;
+    uint64_t state = 0x5641535345544344ULL;
+    for (auto& entry : table) {
+        state += 0x9E3779B97F4A7C15ULL;
+        uint64_t z = state;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        entry = z ^ (z >> 31);
+    }
+    return table;
+}
+
+static const GearTable GEAR = makeGearTable();
+
+// the high bits of the gear hash depend on the most bytes, chunks are cut where the masked bits are all zero.
+// Normalized chunking: boundaries are harder to find before the average size and easier after it, which keeps the
+// chunk sizes close to the average.
+static const int AVERAGE_CHUNK_BITS = 16;
+static const uint64_t SMALL_CHUNK_MASK = ~0ULL << (64 - (AVERAGE_CHUNK_BITS + 2));
+static const uint64_t LARGE_CHUNK_MASK = ~0ULL << (64 - (AVERAGE_CHUNK_BITS - 2));
+
+AssetChunkStore::AssetChunkStore(const QDir& filesDirectory) :
+    _filesDirectory(filesDirectory),
+    _chunksDirectory(filesDirectory)
+{
+    if (!_filesDirectory.mkpath(CHUNKS_SUBDIR) || !_chunksDirectory.cd(CHUNKS_SUBDIR)) {
+        qCWarning(asset_server) << "Unable to create the chunks directory in" << _filesDirectory.path();
+    }
+}
+
+std::vector<int> AssetChunkStore::findChunkEnds(const QByteArray& data) {
+    std::vector<int> ends;
+    const uchar* bytes = reinterpret_cast<const uchar*>(data.constData());
+    const int size = data.size();
+
+    int start = 0;
+    while (start < size) {
+        int remaining = size - start;
+        int end = size;
+        if (remaining > MIN_CHUNK_SIZE) {
+            int normalEnd = start + std::min(remaining, AVERAGE_CHUNK_SIZE);
+            int maxEnd = start + std::min(remaining, MAX_CHUNK_SIZE);
+            uint64_t hash = 0;
+
+            int i = start + MIN_CHUNK_SIZE;
+            end = maxEnd;
+            for (; i < normalEnd; ++i) {
+                hash = (hash << 1) + GEAR[bytes[i]];
+                if (!(hash & SMALL_CHUNK_MASK)) {
+                    end = i + 1;
+                    break;
+                }
+            }
+            if (i == normalEnd) {
+                for (; i < maxEnd; ++i) {
+                    hash = (hash << 1) + GEAR[bytes[i]];
+                    if (!(hash & LARGE_CHUNK_MASK)) {
+                        end = i + 1;
+                        break;
+                    }
+                }
+            }
+        }
+
+        ends.push_back(end);
+        start = end;
+    }
+    return ends;
+}
+
+QString AssetChunkStore::getIndexPath(const AssetUtils::AssetHash& hash) const {
+    return _filesDirectory.absoluteFilePath(hash + INDEX_EXTENSION);
+}
+
+QString AssetChunkStore::getChunkPath(const QByteArray& chunkHash) const {
+    return _chunksDirectory.absoluteFilePath(QString(chunkHash.toHex()));
+}
+
+bool AssetChunkStore::has(const AssetUtils::AssetHash& hash) const {
+    return QFile::exists(getIndexPath(hash));
+}
+
+qint64 AssetChunkStore::getSize(const AssetUtils::AssetHash& hash) const {
+    Index index;
+    return readIndex(hash, index) ? index.size : -1;
+}
+
+bool AssetChunkStore::write(const AssetUtils::AssetHash& hash, const QByteArray& data) {
+    Index index;
+    index.size = data.size();
+
+    int start = 0;
+    for (int end : findChunkEnds(data)) {
+        QByteArray chunkData = QByteArray::fromRawData(data.constData() + start, end - start);
+        Chunk chunk { AssetUtils::hashData(chunkData), (quint32)chunkData.size() };
+
+        // chunks are named by their hash, one that's already there is what would be written
+        QString chunkPath = getChunkPath(chunk.hash);
+        if (!QFile::exists(chunkPath)) {
+            QSaveFile chunkFile(chunkPath);
+            if (!chunkFile.open(QIODevice::WriteOnly) || chunkFile.write(chunkData) != chunkData.size() ||
+                !chunkFile.commit()) {
+                qCWarning(asset_server) << "Failed to write chunk" << chunk.hash.toHex() << "of" << hash;
+                return false;
+            }
+        }
+
+        index.chunks.push_back(chunk);
+        start = end;
+    }
+
+    // the index goes last, so that the asset only exists once all of its chunks do
+    QSaveFile indexFile(getIndexPath(hash));
+    if (!indexFile.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+
+    QDataStream stream(&indexFile);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    stream.writeRawData(INDEX_MAGIC, sizeof(INDEX_MAGIC));
+    stream << INDEX_FORMAT_VERSION << index.size << (quint32)index.chunks.size();
+    for (const auto& chunk : index.chunks) {
+        stream.writeRawData(chunk.hash.constData(), chunk.hash.size());
+        stream << chunk.size;
+    }
+
+    return stream.status() == QDataStream::Ok && indexFile.commit();
+}
+
+bool AssetChunkStore::readIndex(const AssetUtils::AssetHash& hash, Index& index) const {
+    QFile indexFile(getIndexPath(hash));
+    if (!indexFile.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QDataStream stream(&indexFile);
+    stream.setByteOrder(QDataStream::LittleEndian);
+
+    char magic[sizeof(INDEX_MAGIC)];
+    quint32 formatVersion = 0;
+    quint32 numChunks = 0;
+    if (stream.readRawData(magic, sizeof(magic)) != sizeof(magic) || memcmp(magic, INDEX_MAGIC, sizeof(magic)) != 0) {
+        return false;
+    }
+    stream >> formatVersion >> index.size >> numChunks;
+    if (formatVersion != INDEX_FORMAT_VERSION) {
+        qCWarning(asset_server) << "Unsupported chunk index version" << formatVersion << "for" << hash;
+        return false;
+    }
+
+    qint64 chunksSize = 0;
+    index.chunks.clear();
+    for (quint32 i = 0; i < numChunks && stream.status() == QDataStream::Ok; ++i) {
+        Chunk chunk { QByteArray(AssetUtils::SHA256_HASH_LENGTH, 0), 0 };
+        stream.readRawData(chunk.hash.data(), chunk.hash.size());
+        stream >> chunk.size;
+        chunksSize += chunk.size;
+        index.chunks.push_back(chunk);
+    }
+
+    return stream.status() == QDataStream::Ok && chunksSize == index.size;
+}
+
+bool AssetChunkStore::read(const AssetUtils::AssetHash& hash, qint64 offset, qint64 size, QByteArray& data) const {
+    Index index;
+    if (!readIndex(hash, index) || offset < 0 || size < 0 || offset + size > index.size) {
+        return false;
+    }
+
+    data.clear();
+    data.reserve(size);
+
+    qint64 chunkStart = 0;
+    for (const auto& chunk : index.chunks) {
+        qint64 chunkEnd = chunkStart + chunk.size;
+        if (chunkEnd > offset && chunkStart < offset + size) {
+            QFile chunkFile(getChunkPath(chunk.hash));
+            qint64 from = std::max(offset, chunkStart) - chunkStart;
+            qint64 to = std::min(offset + size, chunkEnd) - chunkStart;
+            if (!chunkFile.open(QIODevice::ReadOnly) || chunkFile.size() != chunk.size || !chunkFile.seek(from)) {
+                qCWarning(asset_server) << "Missing or bad chunk" << chunk.hash.toHex() << "of" << hash;
+                return false;
+            }
+            data.append(chunkFile.read(to - from));
+        }
+        chunkStart = chunkEnd;
+    }
+
+    return data.size() == size;
+}
+
+bool AssetChunkStore::readAll(const AssetUtils::AssetHash& hash, QByteArray& data) const {
+    qint64 size = getSize(hash);
+    return size >= 0 && read(hash, 0, size, data);
+}
+
+bool AssetChunkStore::remove(const AssetUtils::AssetHash& hash) {
+    return QFile::remove(getIndexPath(hash));
+}
+
+QStringList AssetChunkStore::getHashes() const {
+    QStringList hashes;
+    for (const auto& fileName : _filesDirectory.entryList({ "*" + INDEX_EXTENSION }, QDir::Files)) {
+        hashes << fileName.left(fileName.length() - INDEX_EXTENSION.length());
+    }
+    return hashes;
+}
+
+void AssetChunkStore::removeUnusedChunks() {
+    std::set<QString> usedChunks;
+    for (const auto& hash : getHashes()) {
+        Index index;
+        if (!readIndex(hash, index)) {
+            // leave everything alone rather than remove chunks that an unreadable index might still need
+            qCWarning(asset_server) << "Unable to read the chunk index of" << hash << "- not removing unused chunks";
+            return;
+        }
+        for (const auto& chunk : index.chunks) {
+            usedChunks.insert(QString(chunk.hash.toHex()));
+        }
+    }
+
+    int numRemoved = 0;
+    for (const auto& fileName : _chunksDirectory.entryList(QDir::Files)) {
+        if (usedChunks.find(fileName) == usedChunks.end() && _chunksDirectory.remove(fileName)) {
+            ++numRemoved;
+        }
+    }
+
+    if (numRemoved > 0) {
+        qCInfo(asset_server) << "Removed" << numRemoved << "unused asset chunks";
+    }
+}
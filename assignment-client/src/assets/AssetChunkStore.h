@@ -0,0 +1,79 @@
+//
+//  AssetChunkStore.h
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_AssetChunkStore_h
+#define vircadia_AssetChunkStore_h
+
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QDir>
+
+#include <AssetUtils.h>
+
+// Content-addressed storage of assets as chunks, so that assets that share most of their data share most of their
+// storage.
+//
+// Assets are split with content-defined chunking (FastCDC), so an edit to part of a file only changes the chunks
+// around it. Each chunk is stored once in the chunks subdirectory of the files directory, named by its hash, and each
+// asset has an index, <hash>.chunks, alongside the whole files that lists its chunks in order.
+//
+// Reads and writes are thread-safe. Chunks that are no longer used are only removed by removeUnusedChunks, which
+// mustn't run while assets are being written.
+class AssetChunkStore {
+public:
+    static const int MIN_CHUNK_SIZE = 16 * 1024;
+    static const int AVERAGE_CHUNK_SIZE = 64 * 1024;
+    static const int MAX_CHUNK_SIZE = 256 * 1024;
+
+    static const QString INDEX_EXTENSION;
+
+    AssetChunkStore(const QDir& filesDirectory);
+
+    bool has(const AssetUtils::AssetHash& hash) const;
+    qint64 getSize(const AssetUtils::AssetHash& hash) const;
+
+    bool write(const AssetUtils::AssetHash& hash, const QByteArray& data);
+
+    // reads size bytes of the asset from offset, which have to be within it
+    bool read(const AssetUtils::AssetHash& hash, qint64 offset, qint64 size, QByteArray& data) const;
+    bool readAll(const AssetUtils::AssetHash& hash, QByteArray& data) const;
+
+    // removes the asset's index, its chunks are left for removeUnusedChunks
+    bool remove(const AssetUtils::AssetHash& hash);
+
+    // the hashes of the assets that have an index
+    QStringList getHashes() const;
+
+    void removeUnusedChunks();
+
+    // the end of each chunk that data is split into
+    static std::vector<int> findChunkEnds(const QByteArray& data);
+
+private:
+    struct Chunk {
+        QByteArray hash;
+        quint32 size;
+    };
+
+    struct Index {
+        qint64 size { 0 };
+        std::vector<Chunk> chunks;
+    };
+
+    QString getIndexPath(const AssetUtils::AssetHash& hash) const;
+    QString getChunkPath(const QByteArray& chunkHash) const;
+    bool readIndex(const AssetUtils::AssetHash& hash, Index& index) const;
+
+    QDir _filesDirectory;
+    QDir _chunksDirectory;
+};
+
+#endif // vircadia_AssetChunkStore_h
@@ -12,8 +12,10 @@
 
 #include "AssetServer.h"
 
-#include <thread>
+#include <algorithm>
 #include <memory>
+#include <numeric>
+#include <thread>
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QCryptographicHash>
@@ -22,7 +24,9 @@
 #include <QtCore/QDirIterator>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
 #include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
 #include <QtCore/QSaveFile>
 #include <QtCore/QString>
 #include <QtGui/QImageReader>
@@ -35,8 +39,10 @@
 #include <PathUtils.h>
 #include <image/TextureProcessing.h>
 
+#include "AssetChunkStore.h"
 #include "AssetServerLogging.h"
 #include "BakeAssetTask.h"
+#include "MappedAssetFiles.h"
 #include "SendAssetTask.h"
 #include "UploadAssetTask.h"
 
@@ -113,11 +119,15 @@ QString getBakeMapping(const AssetUtils::AssetHash& hash, const QString& relativ
 
 const QString ASSET_SERVER_LOGGING_TARGET_NAME = "asset-server";
 
+// model and texture bakes take a lot of memory, so only one of each runs at a time whatever the overall limit is
+static const std::array<int, (int)BakedAssetType::NUM_ASSET_TYPES> MAX_CONCURRENT_BAKES_BY_TYPE {{ 1, 1, 2 }};
+static const int DEFAULT_MAX_CONCURRENT_BAKES = 2;
+
 void AssetServer::bakeAsset(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath) {
-    qDebug() << "Starting bake for: " << assetPath << assetHash;
+    qDebug() << "Queuing bake for: " << assetPath << assetHash;
     auto it = _pendingBakes.find(assetHash);
     if (it == _pendingBakes.end()) {
-        auto task = std::make_shared<BakeAssetTask>(assetHash, assetPath, filePath);
+        auto task = std::make_shared<BakeAssetTask>(assetHash, assetPath, filePath, _chunkStore);
         task->setAutoDelete(false);
         _pendingBakes[assetHash] = task;
 
@@ -125,12 +135,54 @@ void AssetServer::bakeAsset(const AssetUtils::AssetHash& assetHash, const AssetU
         connect(task.get(), &BakeAssetTask::bakeFailed, this, &AssetServer::handleFailedBake);
         connect(task.get(), &BakeAssetTask::bakeAborted, this, &AssetServer::handleAbortedBake);
 
-        _bakingTaskPool.start(task.get());
+        _queuedBakes.push_back(assetHash);
+        startQueuedBakes();
     } else {
         qDebug() << "Already in queue";
     }
 }
 
+void AssetServer::prioritizeBake(const AssetUtils::AssetHash& assetHash) {
+    auto it = std::find(_queuedBakes.begin(), _queuedBakes.end(), assetHash);
+    if (it != _queuedBakes.end() && it != _queuedBakes.begin()) {
+        qDebug() << "Prioritizing bake of requested asset" << assetHash;
+        _queuedBakes.splice(_queuedBakes.begin(), _queuedBakes, it);
+    }
+}
+
+void AssetServer::startQueuedBakes() {
+    int numRunning = std::accumulate(_runningBakes.begin(), _runningBakes.end(), 0);
+
+    auto it = _queuedBakes.begin();
+    while (it != _queuedBakes.end() && numRunning < _maxConcurrentBakes) {
+        auto task = _pendingBakes.value(*it);
+        if (!task) {
+            it = _queuedBakes.erase(it);
+            continue;
+        }
+
+        // assets that aren't bakeable types never get queued, but don't index out of the limits if one does
+        int type = std::min((int)assetTypeForFilename(task->getAssetPath()), (int)BakedAssetType::Script);
+        if (_runningBakes[type] < MAX_CONCURRENT_BAKES_BY_TYPE[type]) {
+            ++_runningBakes[type];
+            ++numRunning;
+            _bakingTaskPool.start(task.get());
+            it = _queuedBakes.erase(it);
+        } else {
+            // this type is at its limit, a bake of another type further back in the queue can go first
+            ++it;
+        }
+    }
+}
+
+void AssetServer::finishBake(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath) {
+    if (_pendingBakes.remove(assetHash) > 0) {
+        int type = std::min((int)assetTypeForFilename(assetPath), (int)BakedAssetType::Script);
+        _runningBakes[type] = std::max(_runningBakes[type] - 1, 0);
+    }
+    startQueuedBakes();
+}
+
 QString AssetServer::getPathToAssetHash(const AssetUtils::AssetHash& assetHash) {
     return _filesDirectory.absoluteFilePath(assetHash);
 }
@@ -331,6 +383,12 @@ void AssetServer::aboutToFinish() {
     // remove pending transfer tasks
     _transferTaskPool.clear();
 
+    // bakes that are still queued never get started
+    for (const auto& hash : _queuedBakes) {
+        _pendingBakes.remove(hash);
+    }
+    _queuedBakes.clear();
+
     // abort each of our still running bake tasks, remove pending bakes that were never put on the thread pool
     auto it = _pendingBakes.begin();
     while (it != _pendingBakes.end()) {
@@ -425,6 +483,23 @@ void AssetServer::completeSetup() {
         return;
     }
 
+    _chunkStore = std::make_shared<AssetChunkStore>(_filesDirectory);
+    _mappedFiles = std::make_shared<MappedAssetFiles>(_filesDirectory);
+
+    static const QString MAX_CONCURRENT_BAKES_OPTION = "max_concurrent_bakes";
+    _maxConcurrentBakes = std::max(assetServerObject[MAX_CONCURRENT_BAKES_OPTION].toInt(DEFAULT_MAX_CONCURRENT_BAKES), 1);
+    _bakingTaskPool.setMaxThreadCount(_maxConcurrentBakes);
+
+    // each texture bake compresses on all of the cores unless this is set, several bakes at once can share them instead
+    static const QString TEXTURE_BAKE_THREADS_OPTION = "texture_bake_threads";
+    BakeAssetTask::setTextureThreads(std::max(assetServerObject[TEXTURE_BAKE_THREADS_OPTION].toInt(0), 0));
+
+    static const QString CHUNKED_STORAGE_OPTION = "chunked_storage";
+    _wantChunkedStorage = assetServerObject[CHUNKED_STORAGE_OPTION].toBool(false);
+    if (_wantChunkedStorage) {
+        qCInfo(asset_server) << "Storing uploaded assets as shared chunks";
+    }
+
     // load whatever mappings we currently have from the local file
     if (loadMappingsFromFile()) {
         qCInfo(asset_server) << "Serving files from: " << _filesDirectory.path();
@@ -436,6 +511,7 @@ void AssetServer::completeSetup() {
         auto hashedFiles = files.filter(hashFileRegex);
 
         qCInfo(asset_server) << "There are" << hashedFiles.size() << "asset files in the asset directory.";
+        qCInfo(asset_server) << "There are" << _chunkStore->getHashes().size() << "chunked assets in the asset directory.";
 
         if (_fileMappings.size() > 0) {
             cleanupUnmappedFiles();
@@ -553,6 +629,24 @@ void AssetServer::cleanupUnmappedFiles() {
             }
         }
     }
+
+    for (const auto& hash : _chunkStore->getHashes()) {
+        bool matched { false };
+        for (auto& pair : _fileMappings) {
+            if (pair.second == hash) {
+                matched = true;
+                break;
+            }
+        }
+        if (!matched && _chunkStore->remove(hash)) {
+            qCDebug(asset_server) << "\tDeleted chunked asset" << hash << "since it is unmapped.";
+
+            removeBakedPathsForDeletedAsset(hash);
+        }
+    }
+
+    // nothing is being uploaded yet, so this can't remove chunks that are about to be used
+    _chunkStore->removeUnusedChunks();
 }
 
 void AssetServer::cleanupBakedFilesForDeletedAssets() {
@@ -609,7 +703,7 @@ void AssetServer::handleAssetMappingOperation(QSharedPointer<ReceivedMessage> me
             handleGetMappingOperation(*message, *replyPacket);
             break;
         case AssetMappingOperationType::GetAll:
-            handleGetAllMappingOperation(*replyPacket);
+            handleGetAllMappingOperation(*message, *replyPacket);
             break;
         case AssetMappingOperationType::Set:
             handleSetMappingOperation(*message, canWriteToAssetServer, *replyPacket);
@@ -644,6 +738,9 @@ void AssetServer::handleGetMappingOperation(ReceivedMessage& message, NLPacketLi
 
         // check if we should re-direct to a baked asset
         auto originalAssetHash = it->second;
+
+        // a client wants this asset now, so if it's waiting to be baked it goes next
+        prioritizeBake(originalAssetHash);
         QString redirectedAssetHash;
         quint8 wasRedirected = false;
         bool bakingDisabled = false;
@@ -706,14 +803,25 @@ void AssetServer::handleGetMappingOperation(ReceivedMessage& message, NLPacketLi
     }
 }
 
-void AssetServer::handleGetAllMappingOperation(NLPacketList& replyPacket) {
+void AssetServer::handleGetAllMappingOperation(ReceivedMessage& message, NLPacketList& replyPacket) {
+    // a page of the mappings, in path order, starting after the last one the caller has
+    auto startAfter = message.readString();
+    uint32_t maxMappings { 0 };
+    message.readPrimitive(&maxMappings);
+
     replyPacket.writePrimitive(AssetUtils::AssetServerError::NoError);
 
-    uint32_t count = (uint32_t)_fileMappings.size();
+    auto begin = startAfter.isEmpty() ? _fileMappings.cbegin() : _fileMappings.upper_bound(startAfter);
+    auto end = begin;
+    uint32_t count = 0;
+    while (end != _fileMappings.cend() && (maxMappings == 0 || count < maxMappings)) {
+        ++end;
+        ++count;
+    }
 
     replyPacket.writePrimitive(count);
 
-    for (auto it = _fileMappings.cbegin(); it != _fileMappings.cend(); ++ it) {
+    for (auto it = begin; it != end; ++it) {
         auto mapping = it->first;
         auto hash = it->second;
         replyPacket.writeString(mapping);
@@ -727,6 +835,9 @@ void AssetServer::handleGetAllMappingOperation(NLPacketList& replyPacket) {
             replyPacket.writeString(lastBakeErrors);
         }
     }
+
+    uint8_t hasMoreMappings = end != _fileMappings.cend();
+    replyPacket.writePrimitive(hasMoreMappings);
 }
 
 void AssetServer::handleSetMappingOperation(ReceivedMessage& message, bool hasWriteAccess, NLPacketList& replyPacket) {
@@ -849,10 +960,14 @@ void AssetServer::handleAssetGetInfo(QSharedPointer<ReceivedMessage> message, Sh
     QString fileName = QString(hexHash);
     QFileInfo fileInfo { _filesDirectory.filePath(fileName) };
 
+    qint64 chunkedSize = -1;
     if (fileInfo.exists() && fileInfo.isReadable()) {
         qCDebug(asset_server) << "Opening file: " << fileInfo.filePath();
         replyPacket->writePrimitive(AssetUtils::AssetServerError::NoError);
         replyPacket->writePrimitive(fileInfo.size());
+    } else if ((chunkedSize = _chunkStore->getSize(fileName)) >= 0) {
+        replyPacket->writePrimitive(AssetUtils::AssetServerError::NoError);
+        replyPacket->writePrimitive(chunkedSize);
     } else {
         qCDebug(asset_server) << "Asset not found: " << QString(hexHash);
         replyPacket->writePrimitive(AssetUtils::AssetServerError::AssetNotFound);
@@ -872,7 +987,7 @@ void AssetServer::handleAssetGet(QSharedPointer<ReceivedMessage> message, Shared
     }
 
     // Queue task
-    auto task = new SendAssetTask(message, senderNode, _filesDirectory);
+    auto task = new SendAssetTask(message, senderNode, _filesDirectory, _mappedFiles, _chunkStore);
     _transferTaskPool.start(task);
 }
 
@@ -886,7 +1001,8 @@ void AssetServer::handleAssetUpload(QSharedPointer<ReceivedMessage> message, Sha
     if (canWriteToAssetServer) {
         qCDebug(asset_server) << "Starting an UploadAssetTask for upload from" << message->getSourceID();
 
-        auto task = new UploadAssetTask(message, senderNode, _filesDirectory, _filesizeLimit);
+        auto task = new UploadAssetTask(message, senderNode, _filesDirectory, _filesizeLimit,
+                                        _wantChunkedStorage ? _chunkStore : std::shared_ptr<AssetChunkStore>());
         _transferTaskPool.start(task);
     } else {
         // this is a node the domain told us is not allowed to rez entities
@@ -931,11 +1047,17 @@ void AssetServer::sendStatsPacket() {
         QJsonObject connectionStats;
         connectionStats["1. Last Heard"] = date.toString();
         connectionStats["2. Est. Max (P/s)"] = stats.estimatedBandwith;
-        connectionStats["3. RTT (ms)"] = stats.rtt;
+        connectionStats["3. RTT (ms)"] = (float)stats.rtt / USECS_PER_MSEC;
         connectionStats["4. CW (P)"] = stats.congestionWindowSize;
         connectionStats["5. Period (us)"] = stats.packetSendPeriod;
         connectionStats["6. Up (Mb/s)"] = stats.sentBytes * megabitsPerSecPerByte;
         connectionStats["7. Down (Mb/s)"] = stats.receivedBytes * megabitsPerSecPerByte;
+        connectionStats["8. Pacing (Mb/s)"] = stats.pacingRate / 1000000.0;
+        auto activeSocket = node->getActiveSocket();
+        if (activeSocket && activeSocket->getType() == SocketType::WebRTC) {
+            connectionStats["9. WebRTC Buffered (B)"] = stats.webrtcBufferedBytes;
+            connectionStats["10. WebRTC Recv Queue (P)"] = stats.webrtcReceiveQueueDepth;
+        }
         connectionStats["last_heard_time_msecs"] = date.toUTC().toMSecsSinceEpoch();
         connectionStats["last_heard_ago_msecs"] = date.msecsTo(QDateTime::currentDateTime());
 
@@ -965,12 +1087,38 @@ void AssetServer::sendStatsPacket() {
         serverStats[uuid] = nodeStats;
     });
 
+    auto sendStats = SendAssetTask::getAndResetStats();
+    QJsonObject transferStats;
+    transferStats["bytes_sent"] = (qint64)sendStats.bytesSent;
+    transferStats["send_cpu_usecs"] = (qint64)sendStats.cpuUsecs;
+    if (sendStats.cpuUsecs > 0) {
+        transferStats["bytes_sent_per_cpu_sec"] = (double)sendStats.bytesSent * USECS_PER_SECOND / sendStats.cpuUsecs;
+    }
+    serverStats["transfers"] = transferStats;
+
+    QJsonObject bakeStats;
+    bakeStats["queued"] = (int)_queuedBakes.size();
+    bakeStats["running_models"] = _runningBakes[(int)BakedAssetType::Model];
+    bakeStats["running_textures"] = _runningBakes[(int)BakedAssetType::Texture];
+    bakeStats["running_scripts"] = _runningBakes[(int)BakedAssetType::Script];
+    bakeStats["completed"] = _numCompletedBakes;
+    bakeStats["failed"] = _numFailedBakes;
+    serverStats["baking"] = bakeStats;
+
     // send off the stats packets
     ThreadedAssignment::addPacketStatsAndSendStatsPacket(serverStats);
 }
 
 static const QString MAP_FILE_NAME = "map.json";
 
+// each change to the mappings is appended to the journal as a line of JSON, {"set":{path:hash},"delete":[path]}, and
+// the whole map file is only rewritten once the journal has this many mappings in it, or a quarter of the map if
+// that's more
+static const QString MAP_JOURNAL_FILE_NAME = "map.journal";
+static const int MIN_MAPPINGS_BEFORE_COMPACTING = 1024;
+static const QString JOURNAL_SET_KEY = "set";
+static const QString JOURNAL_DELETE_KEY = "delete";
+
 bool AssetServer::loadMappingsFromFile() {
 
     auto mapFilePath = _resourcesDirectory.absoluteFilePath(MAP_FILE_NAME);
@@ -1015,7 +1163,7 @@ bool AssetServer::loadMappingsFromFile() {
                 }
 
                 qCInfo(asset_server) << "Loaded" << _fileMappings.size() << "mappings from map file at" << mapFilePath;
-                return true;
+                return replayMappingsJournal();
             }
         }
 
@@ -1025,6 +1173,77 @@ bool AssetServer::loadMappingsFromFile() {
         qCInfo(asset_server) << "No existing mappings loaded from file since no file was found at" << mapFilePath;
     }
 
+    return replayMappingsJournal();
+}
+
+bool AssetServer::replayMappingsJournal() {
+    QFile journalFile { _resourcesDirectory.absoluteFilePath(MAP_JOURNAL_FILE_NAME) };
+    if (!journalFile.exists()) {
+        return true;
+    }
+
+    if (!journalFile.open(QIODevice::ReadOnly)) {
+        qCCritical(asset_server) << "Failed to read mappings journal at" << journalFile.fileName();
+        return false;
+    }
+
+    int numChanges = 0;
+    while (!journalFile.atEnd()) {
+        QJsonParseError error;
+        auto change = QJsonDocument::fromJson(journalFile.readLine(), &error).object();
+        if (error.error != QJsonParseError::NoError) {
+            // only the last change can be cut short, by the server stopping while it was being written
+            qCWarning(asset_server) << "Ignoring incomplete change at the end of the mappings journal";
+            break;
+        }
+
+        for (const auto& path : change[JOURNAL_DELETE_KEY].toArray()) {
+            _fileMappings.erase(path.toString());
+        }
+        auto setMappings = change[JOURNAL_SET_KEY].toObject();
+        for (auto it = setMappings.begin(); it != setMappings.end(); ++it) {
+            _fileMappings[it.key()] = it.value().toString();
+        }
+        ++numChanges;
+    }
+    journalFile.close();
+
+    qCInfo(asset_server) << "Replayed" << numChanges << "changes from the mappings journal";
+
+    // start from a clean map file, without the journal
+    return writeMappingsToFile();
+}
+
+bool AssetServer::persistMappingChanges(const AssetUtils::Mappings& setMappings, const AssetUtils::AssetPathList& deletedPaths) {
+    int numChanged = (int)setMappings.size() + deletedPaths.size();
+    if (_numJournaledMappings + numChanged > std::max(MIN_MAPPINGS_BEFORE_COMPACTING, (int)_fileMappings.size() / 4)) {
+        return writeMappingsToFile();
+    }
+
+    QJsonObject change;
+    if (!setMappings.empty()) {
+        QJsonObject setObject;
+        for (const auto& mapping : setMappings) {
+            setObject[mapping.first] = mapping.second;
+        }
+        change[JOURNAL_SET_KEY] = setObject;
+    }
+    if (!deletedPaths.isEmpty()) {
+        change[JOURNAL_DELETE_KEY] = QJsonArray::fromStringList(deletedPaths);
+    }
+
+    QFile journalFile { _resourcesDirectory.absoluteFilePath(MAP_JOURNAL_FILE_NAME) };
+    QByteArray line = QJsonDocument(change).toJson(QJsonDocument::Compact) + '\n';
+    if (!journalFile.open(QIODevice::WriteOnly | QIODevice::Append) || journalFile.write(line) != line.size() ||
+        !journalFile.flush()) {
+        qCWarning(asset_server) << "Failed to append to the mappings journal at" << journalFile.fileName();
+
+        // the journal may now end with part of this change, which would be replayed as the last change
+        journalFile.close();
+        return writeMappingsToFile();
+    }
+
+    _numJournaledMappings += numChanged;
     return true;
 }
 
@@ -1044,6 +1263,10 @@ bool AssetServer::writeMappingsToFile() {
         if (mapFile.write(jsonDocument.toJson()) != -1) {
             if (mapFile.commit()) {
                 qCDebug(asset_server) << "Wrote JSON mappings to file at" << mapFilePath;
+
+                // everything in the journal is in the map file now
+                QFile::remove(_resourcesDirectory.absoluteFilePath(MAP_JOURNAL_FILE_NAME));
+                _numJournaledMappings = 0;
                 return true;
             } else {
                 qCWarning(asset_server) << "Failed to commit JSON mappings to file at" << mapFilePath;
@@ -1079,7 +1302,7 @@ bool AssetServer::setMapping(AssetUtils::AssetPath path, AssetUtils::AssetHash h
     _fileMappings[path] = hash;
 
     // attempt to write to file
-    if (writeMappingsToFile()) {
+    if (persistMappingChanges({ { path, hash } }, {})) {
         // persistence succeeded, we are good to go
         qCDebug(asset_server) << "Set mapping:" << path << "=>" << hash;
         maybeBake(path, hash);
@@ -1115,8 +1338,9 @@ void AssetServer::removeBakedPathsForDeletedAsset(AssetUtils::AssetHash hash) {
 }
 
 bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
-    // take a copy of the current mappings in case persistence of these deletes fails
-    auto oldMappings = _fileMappings;
+    // keep the deleted mappings in case persistence of these deletes fails
+    AssetUtils::Mappings deletedMappings;
+    AssetUtils::AssetPathList deletedPaths;
 
     QSet<QString> hashesToCheckForDeletion;
 
@@ -1126,19 +1350,17 @@ bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
 
         // figure out if this path will delete a file or folder
         if (pathIsFolder(path)) {
-            // enumerate the in memory file mappings and remove anything that matches
-            auto it = _fileMappings.begin();
+            // the mappings are sorted by path, so the ones in the folder are all together
+            auto it = _fileMappings.lower_bound(path);
             auto sizeBefore = _fileMappings.size();
 
-            while (it != _fileMappings.end()) {
-                if (it->first.startsWith(path)) {
-                    // add this hash to the list we need to check for asset removal from the server
-                    hashesToCheckForDeletion << it->second;
+            while (it != _fileMappings.end() && it->first.startsWith(path)) {
+                // add this hash to the list we need to check for asset removal from the server
+                hashesToCheckForDeletion << it->second;
 
-                    it = _fileMappings.erase(it);
-                } else {
-                    ++it;
-                }
+                deletedMappings.insert(*it);
+                deletedPaths << it->first;
+                it = _fileMappings.erase(it);
             }
 
             auto sizeNow = _fileMappings.size();
@@ -1156,6 +1378,8 @@ bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
 
                 qCDebug(asset_server) << "Deleted a mapping:" << path << "=>" << it->second;
 
+                deletedMappings.insert(*it);
+                deletedPaths << it->first;
                 _fileMappings.erase(it);
             } else {
                 qCDebug(asset_server) << "Unable to delete a mapping that was not found:" << path;
@@ -1163,12 +1387,19 @@ bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
         }
     }
 
+    if (deletedPaths.isEmpty()) {
+        return true;
+    }
+
     // deleted the old mappings, attempt to persist to file
-    if (writeMappingsToFile()) {
+    if (persistMappingChanges({}, deletedPaths)) {
         // persistence succeeded we are good to go
 
         // TODO iterate through hashesToCheckForDeletion instead
         for (auto& pair : _fileMappings) {
+            if (hashesToCheckForDeletion.isEmpty()) {
+                break;
+            }
             auto it = hashesToCheckForDeletion.find(pair.second);
             if (it != hashesToCheckForDeletion.end()) {
                 hashesToCheckForDeletion.erase(it);
@@ -1178,9 +1409,15 @@ bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
         // we now have a set of hashes that are unmapped - we will delete those asset files
         for (auto& hash : hashesToCheckForDeletion) {
             // remove the unmapped file
+            _mappedFiles->evict(hash);
             QFile removeableFile { _filesDirectory.absoluteFilePath(hash) };
 
-            if (removeableFile.remove()) {
+            // the chunks are shared with other assets, the unused ones are removed when the server next starts
+            if (_chunkStore->remove(hash)) {
+                qCDebug(asset_server) << "\tDeleted chunked asset" << hash << "since it is now unmapped.";
+
+                removeBakedPathsForDeletedAsset(hash);
+            } else if (removeableFile.remove()) {
                 qCDebug(asset_server) << "\tDeleted" << hash << "from asset files directory since it is now unmapped.";
 
                 removeBakedPathsForDeletedAsset(hash);
@@ -1194,7 +1431,7 @@ bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
         qCWarning(asset_server) << "Failed to persist deleted mappings, rolling back";
 
         // we didn't delete the previous mapping, put it back in our in-memory representation
-        _fileMappings = oldMappings;
+        _fileMappings.insert(deletedMappings.begin(), deletedMappings.end());
 
         return false;
     }
@@ -1220,34 +1457,50 @@ bool AssetServer::renameMapping(AssetUtils::AssetPath oldPath, AssetUtils::Asset
             return false;
         }
 
-        // take a copy of the old mappings
-        auto oldMappings = _fileMappings;
-
-        // iterate the current mappings and adjust any that matches the renamed folder
-        auto it = oldMappings.begin();
+        // the mappings are sorted by path, so the ones in the folder are all together
+        AssetUtils::Mappings oldMappings;
+        auto it = _fileMappings.lower_bound(oldPath);
+        while (it != _fileMappings.end() && it->first.startsWith(oldPath)) {
+            oldMappings.insert(*it);
+            it = _fileMappings.erase(it);
+        }
 
-        while (it != oldMappings.end()) {
-            auto& oldKey = it->first;
-            if (oldKey.startsWith(oldPath)) {
-                auto newKey = oldKey;
-                newKey.replace(0, oldPath.size(), newPath);
+        // keep any mappings that the renamed ones replace, for a rollback
+        AssetUtils::Mappings newMappings;
+        AssetUtils::Mappings replacedMappings;
+        for (const auto& mapping : oldMappings) {
+            auto newKey = mapping.first;
+            newKey.replace(0, oldPath.size(), newPath);
 
-                // remove the old version from the in memory file mappings
-                _fileMappings.erase(_fileMappings.find(oldKey));
-                _fileMappings[newKey] = it->second;
+            auto replacedIt = _fileMappings.find(newKey);
+            if (replacedIt != _fileMappings.end()) {
+                replacedMappings.insert(*replacedIt);
             }
+            _fileMappings[newKey] = mapping.second;
+            newMappings[newKey] = mapping.second;
+        }
 
-            ++it;
+        AssetUtils::AssetPathList deletedPaths;
+        for (const auto& mapping : oldMappings) {
+            if (newMappings.find(mapping.first) == newMappings.end()) {
+                deletedPaths << mapping.first;
+            }
         }
 
-        if (writeMappingsToFile()) {
+        if (persistMappingChanges(newMappings, deletedPaths)) {
             // persisted the changed mappings, return success
             qCDebug(asset_server) << "Renamed folder mapping:" << oldPath << "=>" << newPath;
 
             return true;
         } else {
             // couldn't persist the renamed paths, rollback and return failure
-            _fileMappings = oldMappings;
+            for (const auto& mapping : newMappings) {
+                _fileMappings.erase(mapping.first);
+            }
+            _fileMappings.insert(oldMappings.begin(), oldMappings.end());
+            for (const auto& mapping : replacedMappings) {
+                _fileMappings[mapping.first] = mapping.second;
+            }
 
             qCWarning(asset_server) << "Failed to persist renamed folder mapping:" << oldPath << "=>" << newPath;
 
@@ -1272,7 +1525,7 @@ bool AssetServer::renameMapping(AssetUtils::AssetPath oldPath, AssetUtils::Asset
         if (!oldSourceMapping.isEmpty()) {
             _fileMappings[newPath] = oldSourceMapping;
 
-            if (writeMappingsToFile()) {
+            if (persistMappingChanges({ { newPath, oldSourceMapping } }, { oldPath })) {
                 // persisted the renamed mapping, return success
                 qCDebug(asset_server) << "Renamed mapping:" << oldPath << "=>" << newPath;
 
@@ -1317,7 +1570,8 @@ void AssetServer::handleFailedBake(QString originalAssetHash, QString assetPath,
 
     writeMetaFile(originalAssetHash, meta);
 
-    _pendingBakes.remove(originalAssetHash);
+    ++_numFailedBakes;
+    finishBake(originalAssetHash, assetPath);
 }
 
 void AssetServer::handleCompletedBake(QString originalAssetHash, QString originalAssetPath,
@@ -1340,7 +1594,12 @@ void AssetServer::handleCompletedBake(QString originalAssetHash, QString origina
 
         writeMetaFile(originalAssetHash, meta);
 
-        _pendingBakes.remove(originalAssetHash);
+        if (errorCompletingBake) {
+            ++_numFailedBakes;
+        } else {
+            ++_numCompletedBakes;
+        }
+        finishBake(originalAssetHash, originalAssetPath);
     };
 
     bool errorCompletingBake { false };
@@ -1473,7 +1732,7 @@ void AssetServer::handleAbortedBake(QString originalAssetHash, QString assetPath
     qDebug() << "Aborted bake:" << originalAssetHash;
 
     // for an aborted bake we don't do anything but remove the BakeAssetTask from our pending bakes
-    _pendingBakes.remove(originalAssetHash);
+    finishBake(originalAssetHash, assetPath);
 }
 
 static const QString BAKE_VERSION_KEY = "bake_version";
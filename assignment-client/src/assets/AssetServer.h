@@ -12,6 +12,9 @@
 #ifndef hifi_AssetServer_h
 #define hifi_AssetServer_h
 
+#include <array>
+#include <list>
+
 #include <QtCore/QDir>
 #include <QtCore/QSharedPointer>
 #include <QtCore/QThreadPool>
@@ -69,7 +72,9 @@ struct AssetMeta {
     QString redirectTarget;
 };
 
+class AssetChunkStore;
 class BakeAssetTask;
+class MappedAssetFiles;
 
 class AssetServer : public ThreadedAssignment {
     Q_OBJECT
@@ -96,7 +101,7 @@ private:
     void replayRequests();
 
     void handleGetMappingOperation(ReceivedMessage& message, NLPacketList& replyPacket);
-    void handleGetAllMappingOperation(NLPacketList& replyPacket);
+    void handleGetAllMappingOperation(ReceivedMessage& message, NLPacketList& replyPacket);
     void handleSetMappingOperation(ReceivedMessage& message, bool hasWriteAccess, NLPacketList& replyPacket);
     void handleDeleteMappingsOperation(ReceivedMessage& message, bool hasWriteAccess, NLPacketList& replyPacket);
     void handleRenameMappingOperation(ReceivedMessage& message, bool hasWriteAccess, NLPacketList& replyPacket);
@@ -107,8 +112,12 @@ private:
 
     // Mapping file operations must be called from main assignment thread only
     bool loadMappingsFromFile();
+    bool replayMappingsJournal();
     bool writeMappingsToFile();
 
+    /// Persist a change that's been made to the mappings, by appending it to the journal or rewriting the map file
+    bool persistMappingChanges(const AssetUtils::Mappings& setMappings, const AssetUtils::AssetPathList& deletedPaths);
+
     /// Set the mapping for path to hash
     bool setMapping(AssetUtils::AssetPath path, AssetUtils::AssetHash hash);
 
@@ -137,6 +146,15 @@ private:
     bool needsToBeBaked(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& assetHash);
     void bakeAsset(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath);
 
+    /// Move a queued bake to the front of the queue, for assets that clients are asking for
+    void prioritizeBake(const AssetUtils::AssetHash& assetHash);
+
+    /// Start as many queued bakes as the concurrency limits allow
+    void startQueuedBakes();
+
+    /// Forget a bake that has finished, one way or another, and start the next
+    void finishBake(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath);
+
     /// Move baked content for asset to baked directory and update baked status
     void handleCompletedBake(QString originalAssetHash, QString assetPath, QString bakedTempOutputDir);
     void handleFailedBake(QString originalAssetHash, QString assetPath, QString errors);
@@ -150,16 +168,30 @@ private:
     void removeBakedPathsForDeletedAsset(AssetUtils::AssetHash originalAssetHash);
 
     AssetUtils::Mappings _fileMappings;
+    int _numJournaledMappings { 0 };
 
     QDir _resourcesDirectory;
     QDir _filesDirectory;
 
+    /// Chunked assets are always served, they're only stored when _wantChunkedStorage is set
+    std::shared_ptr<AssetChunkStore> _chunkStore;
+    bool _wantChunkedStorage { false };
+
+    std::shared_ptr<MappedAssetFiles> _mappedFiles;
+
     /// Task pool for handling uploads and downloads of assets
     QThreadPool _transferTaskPool;
 
     QHash<AssetUtils::AssetHash, std::shared_ptr<BakeAssetTask>> _pendingBakes;
     QThreadPool _bakingTaskPool;
 
+    /// Bakes that haven't been started yet, in the order they'll start in
+    std::list<AssetUtils::AssetHash> _queuedBakes;
+    std::array<int, (int)BakedAssetType::NUM_ASSET_TYPES> _runningBakes {};
+    int _maxConcurrentBakes { 1 };
+    int _numCompletedBakes { 0 };
+    int _numFailedBakes { 0 };
+
     QMutex _queuedRequestsMutex;
     bool _isQueueingRequests { true };
     using RequestQueue = QVector<QPair<QSharedPointer<ReceivedMessage>, SharedNodePointer>>;
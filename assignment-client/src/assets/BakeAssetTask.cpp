@@ -18,16 +18,22 @@
 
 #include <PathUtils.h>
 
+#include "AssetChunkStore.h"
+
 static const int OVEN_STATUS_CODE_SUCCESS { 0 };
 static const int OVEN_STATUS_CODE_FAIL { 1 };
 static const int OVEN_STATUS_CODE_ABORT { 2 };
 
 std::once_flag registerMetaTypesFlag;
 
-BakeAssetTask::BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath) :
+std::atomic<int> BakeAssetTask::_textureThreads { 0 };
+
+BakeAssetTask::BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath,
+                             std::shared_ptr<AssetChunkStore> chunkStore) :
     _assetHash(assetHash),
     _assetPath(assetPath),
-    _filePath(filePath)
+    _filePath(filePath),
+    _chunkStore(chunkStore)
 {
 
     std::call_once(registerMetaTypesFlag, []() {
@@ -55,7 +61,16 @@ void BakeAssetTask::run() {
     // Copy file to bake the temporary dir and give a name the oven can work with
     auto assetName = _assetPath.split("/").last();
     auto tempAssetPath = tempOutputDir + "/" + assetName;
-    auto success = QFile::copy(_filePath, tempAssetPath);
+    bool success;
+    if (!QFile::exists(_filePath) && _chunkStore && _chunkStore->has(_assetHash)) {
+        // chunked assets are put back together for the oven
+        QByteArray data;
+        QFile tempAssetFile(tempAssetPath);
+        success = _chunkStore->readAll(_assetHash, data) && tempAssetFile.open(QIODevice::WriteOnly) &&
+            tempAssetFile.write(data) == data.size();
+    } else {
+        success = QFile::copy(_filePath, tempAssetPath);
+    }
     if (!success) {
         QString errors = "Couldn't copy file to bake to temporary directory";
         emit bakeFailed(_assetHash, _assetPath, errors);
@@ -71,6 +86,9 @@ void BakeAssetTask::run() {
         "-o", tempOutputDir,
         "-t", extension,
     };
+    if (_textureThreads > 0) {
+        args << "--texture-threads" << QString::number(_textureThreads);
+    }
 
     _ovenProcess.reset(new QProcess());
 
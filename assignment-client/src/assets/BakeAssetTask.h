@@ -22,17 +22,24 @@
 
 #include <AssetUtils.h>
 
+class AssetChunkStore;
+
 class BakeAssetTask : public QObject, public QRunnable {
     Q_OBJECT
 public:
-    BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath);
+    BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath,
+                  std::shared_ptr<AssetChunkStore> chunkStore = std::shared_ptr<AssetChunkStore>());
 
     // Thread-safe inspection methods
     bool isBaking() { return _isBaking.load(); }
+    const AssetUtils::AssetPath& getAssetPath() const { return _assetPath; }
     bool wasAborted() const { return _wasAborted.load(); }
 
     void run() override;
 
+    // The number of threads the oven compresses textures on, 0 to leave it to the oven
+    static void setTextureThreads(int textureThreads) { _textureThreads = textureThreads; }
+
 public slots:
     void abort();
 
@@ -46,8 +53,11 @@ private:
     AssetUtils::AssetHash _assetHash;
     AssetUtils::AssetPath _assetPath;
     QString _filePath;
+    std::shared_ptr<AssetChunkStore> _chunkStore;
     std::unique_ptr<QProcess> _ovenProcess { nullptr };
     std::atomic<bool> _wasAborted { false };
+
+    static std::atomic<int> _textureThreads;
 };
 
 #endif // hifi_BakeAssetTask_h
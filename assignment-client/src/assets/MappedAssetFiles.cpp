@@ -0,0 +1,88 @@
+//
+//  MappedAssetFiles.cpp
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "MappedAssetFiles.h"
+
+#include <QtCore/QMutexLocker>
+
+MappedAssetFiles::File::File(const QString& path) :
+    _file(path)
+{
+    if (_file.open(QIODevice::ReadOnly)) {
+        _size = _file.size();
+        // empty files can't be mapped, and don't need to be
+        if (_size > 0) {
+            _data = _file.map(0, _size);
+        }
+    }
+}
+
+MappedAssetFiles::File::~File() {
+    if (_data) {
+        _file.unmap(_data);
+    }
+}
+
+MappedAssetFiles::MappedAssetFiles(const QDir& filesDirectory, int maxFiles, qint64 maxMappedBytes) :
+    _filesDirectory(filesDirectory),
+    _maxFiles(maxFiles),
+    _maxMappedBytes(maxMappedBytes)
+{
+}
+
+MappedAssetFiles::FilePointer MappedAssetFiles::get(const AssetUtils::AssetHash& hash) {
+    {
+        QMutexLocker locker(&_mutex);
+        auto it = _filesByHash.find(hash);
+        if (it != _filesByHash.end()) {
+            _files.splice(_files.begin(), _files, it.value());
+            return _files.front().second;
+        }
+    }
+
+    // map the file without holding the lock, requests for other files needn't wait on it
+    auto file = std::make_shared<const File>(_filesDirectory.absoluteFilePath(hash));
+    if (!file->isMapped()) {
+        return FilePointer();
+    }
+
+    QMutexLocker locker(&_mutex);
+    auto it = _filesByHash.find(hash);
+    if (it != _filesByHash.end()) {
+        // someone else mapped it in the meantime
+        _files.splice(_files.begin(), _files, it.value());
+        return _files.front().second;
+    }
+
+    _files.emplace_front(hash, file);
+    _filesByHash.insert(hash, _files.begin());
+    _mappedBytes += file->getSize();
+    evictUntilWithinLimits();
+    return file;
+}
+
+void MappedAssetFiles::evict(const AssetUtils::AssetHash& hash) {
+    QMutexLocker locker(&_mutex);
+    auto it = _filesByHash.find(hash);
+    if (it != _filesByHash.end()) {
+        _mappedBytes -= it.value()->second->getSize();
+        _files.erase(it.value());
+        _filesByHash.erase(it);
+    }
+}
+
+void MappedAssetFiles::evictUntilWithinLimits() {
+    // the file that was just added is always kept
+    while (_files.size() > 1 && ((int)_files.size() > _maxFiles || _mappedBytes > _maxMappedBytes)) {
+        _mappedBytes -= _files.back().second->getSize();
+        _filesByHash.remove(_files.back().first);
+        _files.pop_back();
+    }
+}
@@ -0,0 +1,73 @@
+//
+//  MappedAssetFiles.h
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_MappedAssetFiles_h
+#define vircadia_MappedAssetFiles_h
+
+#include <list>
+#include <memory>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+
+#include <AssetUtils.h>
+
+// The asset files that were most recently sent, kept memory mapped so that the popular ones are sent straight out of
+// the page cache rather than being read into a buffer for every request.
+//
+// Thread-safe. A file stays mapped while anything holds on to it, even once it's been evicted.
+class MappedAssetFiles {
+public:
+    class File {
+    public:
+        File(const QString& path);
+        ~File();
+
+        bool isMapped() const { return _data != nullptr; }
+        const char* getData() const { return reinterpret_cast<const char*>(_data); }
+        qint64 getSize() const { return _size; }
+
+    private:
+        QFile _file;
+        uchar* _data { nullptr };
+        qint64 _size { 0 };
+    };
+    using FilePointer = std::shared_ptr<const File>;
+
+    static const int DEFAULT_MAX_FILES = 256;
+    static const qint64 DEFAULT_MAX_MAPPED_BYTES = 2048LL * 1024 * 1024;
+
+    MappedAssetFiles(const QDir& filesDirectory, int maxFiles = DEFAULT_MAX_FILES,
+                     qint64 maxMappedBytes = DEFAULT_MAX_MAPPED_BYTES);
+
+    // null if there's no such file or it couldn't be mapped
+    FilePointer get(const AssetUtils::AssetHash& hash);
+
+    // has to be called before a file is removed, it can't be removed while it's mapped on some platforms
+    void evict(const AssetUtils::AssetHash& hash);
+
+private:
+    using LRUList = std::list<std::pair<AssetUtils::AssetHash, FilePointer>>;
+
+    void evictUntilWithinLimits();
+
+    QDir _filesDirectory;
+    const int _maxFiles;
+    const qint64 _maxMappedBytes;
+
+    QMutex _mutex;
+    LRUList _files; // most recently used first
+    QHash<AssetUtils::AssetHash, LRUList::iterator> _filesByHash;
+    qint64 _mappedBytes { 0 };
+};
+
+#endif // vircadia_MappedAssetFiles_h
@@ -20,22 +20,60 @@
 #include <NLPacket.h>
 #include <NLPacketList.h>
 #include <NodeList.h>
+#include <NumericalConstants.h>
 #include <udt/Packet.h>
 
+#include "AssetChunkStore.h"
 #include "AssetUtils.h"
 #include "ByteRange.h"
 #include "ClientServerUtils.h"
 
-SendAssetTask::SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir) :
+#ifdef Q_OS_WIN
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+std::atomic<quint64> SendAssetTask::_bytesSent { 0 };
+std::atomic<quint64> SendAssetTask::_cpuUsecs { 0 };
+
+// the CPU time used by the calling thread
+static quint64 threadCPUTimeUsecs() {
+#ifdef Q_OS_WIN
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime)) {
+        return 0;
+    }
+    // in 100ns intervals
+    auto toUsecs = [](const FILETIME& time) {
+        return ((quint64)time.dwHighDateTime << 32 | time.dwLowDateTime) / 10;
+    };
+    return toUsecs(kernelTime) + toUsecs(userTime);
+#else
+    timespec time;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) != 0) {
+        return 0;
+    }
+    return (quint64)time.tv_sec * USECS_PER_SECOND + time.tv_nsec / NSECS_PER_USEC;
+#endif
+}
+
+SendAssetTask::SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir,
+                             std::shared_ptr<MappedAssetFiles> mappedFiles, std::shared_ptr<AssetChunkStore> chunkStore) :
     QRunnable(),
     _message(message),
     _senderNode(sendToNode),
-    _resourcesDir(resourcesDir)
+    _resourcesDir(resourcesDir),
+    _mappedFiles(mappedFiles),
+    _chunkStore(chunkStore)
 {
     
 }
 
 void SendAssetTask::run() {
+    quint64 cpuStart = threadCPUTimeUsecs();
+    qint64 bytesSent = 0;
+
     MessageID messageID;
     ByteRange byteRange;
 
@@ -65,16 +103,22 @@ void SendAssetTask::run() {
     } else {
         QString filePath = _resourcesDir.filePath(QString(hexHash));
         
+        // popular assets are sent straight from a mapping of the file
+        MappedAssetFiles::FilePointer mappedFile;
+        if (_mappedFiles) {
+            mappedFile = _mappedFiles->get(hexHash);
+        }
         QFile file { filePath };
 
-        if (file.open(QIODevice::ReadOnly)) {
+        if (mappedFile || file.open(QIODevice::ReadOnly)) {
+            qint64 fileSize = mappedFile ? mappedFile->getSize() : file.size();
 
             // first fixup the range based on the now known file size
-            byteRange.fixupRange(file.size());
+            byteRange.fixupRange(fileSize);
 
             // check if we're being asked to read data that we just don't have
             // because of the file size
-            if (file.size() < byteRange.fromInclusive || file.size() < byteRange.toExclusive) {
+            if (fileSize < byteRange.fromInclusive || fileSize < byteRange.toExclusive) {
                 replyPacketList->writePrimitive(AssetUtils::AssetServerError::InvalidByteRange);
                 qCDebug(networking) << "Bad byte range: " << hexHash << " "
                     << byteRange.fromInclusive << ":" << byteRange.toExclusive;
@@ -82,29 +126,46 @@ void SendAssetTask::run() {
                 // we have a valid byte range, handle it and send the asset
                 auto size = byteRange.size();
 
-                if (byteRange.fromInclusive >= 0) {
+                // a positive range is read from its start, a negative one goes back from the end of the file
+                qint64 offset = byteRange.fromInclusive >= 0 ? byteRange.fromInclusive : fileSize + byteRange.fromInclusive;
 
-                    // this range is positive, meaning we just need to seek into the file and then read from there
-                    file.seek(byteRange.fromInclusive);
-                    replyPacketList->writePrimitive(AssetUtils::AssetServerError::NoError);
-                    replyPacketList->writePrimitive(size);
-                    replyPacketList->write(file.read(size));
+                replyPacketList->writePrimitive(AssetUtils::AssetServerError::NoError);
+                replyPacketList->writePrimitive(size);
+                if (mappedFile) {
+                    replyPacketList->write(mappedFile->getData() + offset, size);
                 } else {
-                    // this range is negative, at least the first part of the read will be back into the end of the file
+                    file.seek(offset);
+                    replyPacketList->write(file.read(size));
+                }
+                bytesSent = size;
 
-                    // seek to the part of the file where the negative range begins
-                    file.seek(file.size() + byteRange.fromInclusive);
+                qCDebug(networking) << "Sending asset: " << hexHash;
+            }
+            file.close();
+        } else if (_chunkStore && _chunkStore->has(hexHash)) {
+            qint64 assetSize = _chunkStore->getSize(hexHash);
+            byteRange.fixupRange(assetSize);
 
+            QByteArray data;
+            if (assetSize < byteRange.fromInclusive || assetSize < byteRange.toExclusive) {
+                replyPacketList->writePrimitive(AssetUtils::AssetServerError::InvalidByteRange);
+                qCDebug(networking) << "Bad byte range: " << hexHash << " "
+                    << byteRange.fromInclusive << ":" << byteRange.toExclusive;
+            } else {
+                // a negative range is read back from the end of the asset
+                auto size = byteRange.size();
+                qint64 offset = byteRange.fromInclusive >= 0 ? byteRange.fromInclusive : assetSize + byteRange.fromInclusive;
+                if (_chunkStore->read(hexHash, offset, size, data)) {
                     replyPacketList->writePrimitive(AssetUtils::AssetServerError::NoError);
                     replyPacketList->writePrimitive(size);
+                    replyPacketList->write(data);
+                    bytesSent = size;
 
-                    // first write everything from the negative range to the end of the file
-                    replyPacketList->write(file.read(size));
+                    qCDebug(networking) << "Sending chunked asset: " << hexHash;
+                } else {
+                    replyPacketList->writePrimitive(AssetUtils::AssetServerError::FileOperationFailed);
                 }
-
-                qCDebug(networking) << "Sending asset: " << hexHash;
             }
-            file.close();
         } else {
             qCDebug(networking) << "Asset not found: " << filePath << "(" << hexHash << ")";
             replyPacketList->writePrimitive(AssetUtils::AssetServerError::AssetNotFound);
@@ -117,4 +178,11 @@ void SendAssetTask::run() {
     } else {
         nodeList->sendPacketList(std::move(replyPacketList), _message->getSenderSockAddr());
     }
+
+    _bytesSent += bytesSent;
+    _cpuUsecs += threadCPUTimeUsecs() - cpuStart;
+}
+
+SendAssetTask::Stats SendAssetTask::getAndResetStats() {
+    return { _bytesSent.exchange(0), _cpuUsecs.exchange(0) };
 }
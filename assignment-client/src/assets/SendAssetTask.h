@@ -12,6 +12,9 @@
 #ifndef hifi_SendAssetTask_h
 #define hifi_SendAssetTask_h
 
+#include <atomic>
+#include <memory>
+
 #include <QtCore/QByteArray>
 #include <QtCore/QSharedPointer>
 #include <QtCore/QString>
@@ -19,20 +22,36 @@
 
 #include "AssetUtils.h"
 #include "AssetServer.h"
+#include "MappedAssetFiles.h"
 #include "Node.h"
 
+class AssetChunkStore;
 class NLPacket;
 
 class SendAssetTask : public QRunnable {
 public:
-    SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir);
+    SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir,
+                  std::shared_ptr<MappedAssetFiles> mappedFiles = std::shared_ptr<MappedAssetFiles>(),
+                  std::shared_ptr<AssetChunkStore> chunkStore = std::shared_ptr<AssetChunkStore>());
 
     void run() override;
 
+    struct Stats {
+        quint64 bytesSent;
+        quint64 cpuUsecs;
+    };
+    // what all of the tasks have sent, and the CPU time they took to do it, since this was last called
+    static Stats getAndResetStats();
+
 private:
+    static std::atomic<quint64> _bytesSent;
+    static std::atomic<quint64> _cpuUsecs;
+
     QSharedPointer<ReceivedMessage> _message;
     SharedNodePointer _senderNode;
     QDir _resourcesDir;
+    std::shared_ptr<MappedAssetFiles> _mappedFiles;
+    std::shared_ptr<AssetChunkStore> _chunkStore;
 };
 
 #endif
@@ -18,14 +18,17 @@
 #include <NodeList.h>
 #include <NLPacketList.h>
 
+#include "AssetChunkStore.h"
 #include "ClientServerUtils.h"
 
 UploadAssetTask::UploadAssetTask(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode,
-                                 const QDir& resourcesDir, uint64_t filesizeLimit) :
+                                 const QDir& resourcesDir, uint64_t filesizeLimit,
+                                 std::shared_ptr<AssetChunkStore> chunkStore) :
     _receivedMessage(receivedMessage),
     _senderNode(senderNode),
     _resourcesDir(resourcesDir),
-    _filesizeLimit(filesizeLimit)
+    _filesizeLimit(filesizeLimit),
+    _chunkStore(chunkStore)
 {
     
 }
@@ -69,7 +72,20 @@ void UploadAssetTask::run() {
 
         bool existingCorrectFile = false;
         
-        if (file.exists()) {
+        // files that were stored whole before chunked storage was turned on stay that way
+        bool storeAsChunks = _chunkStore && !file.exists();
+
+        if (storeAsChunks) {
+            // the chunks are named by their hashes, so an existing index already has the right contents
+            if (_chunkStore->has(QString(hexHash)) || _chunkStore->write(QString(hexHash), fileData)) {
+                qDebug() << "Stored file" << hexHash << "as chunks. Upload complete";
+                replyPacket->writePrimitive(AssetUtils::AssetServerError::NoError);
+                replyPacket->write(hash);
+            } else {
+                qWarning() << "Failed to store file" << hexHash << "as chunks - upload failed.";
+                replyPacket->writePrimitive(AssetUtils::AssetServerError::FileOperationFailed);
+            }
+        } else if (file.exists()) {
             // check if the local file has the correct contents, otherwise we overwrite
             if (file.open(QIODevice::ReadOnly) && AssetUtils::hashData(file.readAll()) == hash) {
                 qDebug() << "Not overwriting existing verified file: " << hexHash;
@@ -84,7 +100,7 @@ void UploadAssetTask::run() {
             }
         }
 
-        if (!existingCorrectFile) {
+        if (!storeAsChunks && !existingCorrectFile) {
             if (file.open(QIODevice::WriteOnly) && file.write(fileData) == qint64(fileSize)) {
                 qDebug() << "Wrote file" << hexHash << "to disk. Upload complete";
                 file.close();
@@ -14,6 +14,8 @@
 #ifndef hifi_UploadAssetTask_h
 #define hifi_UploadAssetTask_h
 
+#include <memory>
+
 #include <QtCore/QDir>
 #include <QtCore/QObject>
 #include <QtCore/QRunnable>
@@ -21,13 +23,15 @@
 
 #include "ReceivedMessage.h"
 
+class AssetChunkStore;
 class NLPacketList;
 class Node;
 
 class UploadAssetTask : public QRunnable {
 public:
     UploadAssetTask(QSharedPointer<ReceivedMessage> message, QSharedPointer<Node> senderNode, 
-                    const QDir& resourcesDir, uint64_t filesizeLimit);
+                    const QDir& resourcesDir, uint64_t filesizeLimit,
+                    std::shared_ptr<AssetChunkStore> chunkStore = std::shared_ptr<AssetChunkStore>());
 
     void run() override;
 
@@ -36,6 +40,7 @@ private:
     QSharedPointer<Node> _senderNode;
     QDir _resourcesDir;
     uint64_t _filesizeLimit;
+    std::shared_ptr<AssetChunkStore> _chunkStore;
 };
 
 #endif // hifi_UploadAssetTask_h
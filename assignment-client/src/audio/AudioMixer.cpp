@@ -17,6 +17,8 @@
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
 #include <QtCore/QJsonValue>
+#include <QtCore/QRunnable>
+#include <QtCore/QThreadPool>
 #include <shared/QtHelpers.h>
 
 #include <LogHandler.h>
@@ -31,6 +33,8 @@
 #include <StDev.h>
 #include <UUID.h>
 #include <CPUDetect.h>
+#include <FrameTrace.h>
+#include <MetricsRegistry.h>
 
 #include "AudioLogging.h"
 #include "AudioHelpers.h"
@@ -50,6 +54,10 @@ static const QString AUDIO_BUFFER_GROUP_KEY = "audio_buffer";
 static const QString AUDIO_THREADING_GROUP_KEY = "audio_threading";
 
 int AudioMixer::_numStaticJitterFrames{ DISABLE_STATIC_JITTER_FRAMES };
+int AudioMixer::_maxFECGroupSize{ AudioFEC::MAX_GROUP_SIZE };
+int AudioMixer::_maxOffloadedSources{ AudioConstants::MAX_OFFLOADED_SOURCES };
+bool AudioMixer::_isSharingHRTFRenders{ false };
+bool AudioMixer::_isReplicatingSubMixes{ false };
 float AudioMixer::_noiseMutingThreshold{ DEFAULT_NOISE_MUTING_THRESHOLD };
 float AudioMixer::_attenuationPerDoublingInDistance{ DEFAULT_ATTENUATION_PER_DOUBLING_IN_DISTANCE };
 map<QString, shared_ptr<CodecPlugin>> AudioMixer::_availableCodecs{ };
@@ -57,6 +65,8 @@ QStringList AudioMixer::_codecPreferenceOrder{};
 vector<AudioMixer::ZoneDescription> AudioMixer::_audioZones;
 vector<AudioMixer::ZoneSettings> AudioMixer::_zoneSettings;
 vector<AudioMixer::ReverbSettings> AudioMixer::_zoneReverbSettings;
+vector<int> AudioMixer::_zoneSettingsTable;
+vector<int> AudioMixer::_zoneReverbTable;
 
 AudioMixer::AudioMixer(ReceivedMessage& message) :
     ThreadedAssignment(message)
@@ -90,6 +100,7 @@ AudioMixer::AudioMixer(ReceivedMessage& message) :
             PacketType::MicrophoneAudioWithEcho,
             PacketType::InjectAudio,
             PacketType::AudioStreamStats,
+            PacketType::AudioForwardErrorCorrection,
             PacketType::SilentAudioFrame,
             PacketType::NegotiateAudioFormat,
             PacketType::MuteEnvironment,
@@ -311,6 +322,11 @@ void AudioMixer::sendStatsPacket() {
     addTiming(_mixTiming, "mix");
     addTiming(_eventsTiming, "events");
 
+    // per slave, for both processing packets and mixing
+    int numSlaveFrames = std::max(_numStatFrames * _slavePool.numThreads(), 1);
+    timingStats["us_per_slave_dispatch"] = (qint64)(_stats.dispatchTime / numSlaveFrames);
+    timingStats["us_per_slave_work"] = (qint64)(_stats.workTime / numSlaveFrames);
+
 #ifdef HIFI_AUDIO_MIXER_DEBUG
     timingStats["ns_per_mix"] = (_stats.totalMixes > 0) ?  (float)(_stats.mixTime / _stats.totalMixes) : 0;
 #endif
@@ -328,6 +344,11 @@ void AudioMixer::sendStatsPacket() {
     mixStats["1_hrtf_renders"] = (int)(_stats.hrtfRenders / (float)_numStatFrames);
     mixStats["1_hrtf_resets"] = (int)(_stats.hrtfResets / (float)_numStatFrames);
     mixStats["1_hrtf_updates"] = (int)(_stats.hrtfUpdates / (float)_numStatFrames);
+    mixStats["1_hrtf_shared_renders"] = (int)(_stats.hrtfSharedRenders / (float)_numStatFrames);
+    mixStats["1_offloaded_sources"] = (int)(_stats.offloadedSources / (float)_numStatFrames);
+    mixStats["1_offload_encodes"] = (int)(_stats.offloadEncodes / (float)_numStatFrames);
+
+    mixStats["1_sub_mixes_sent"] = (int)(_stats.subMixesSent / (float)_numStatFrames);
 
     mixStats["2_skipped_streams"] = (int)(_stats.skipped / (float)_numStatFrames);
     mixStats["2_inactive_streams"] = (int)(_stats.inactive / (float)_numStatFrames);
@@ -430,10 +451,12 @@ void AudioMixer::start() {
         }
 
         auto frameTimer = _frameTiming.timer();
+        auto frameStart = p_high_resolution_clock::now();
 
         // process (node-isolated) audio packets across slave threads
         {
             auto packetsTimer = _packetsTiming.timer();
+            FRAME_TRACE_RANGE("AudioMixer::processPackets");
 
             // first clear the concurrent vector of added streams that the slaves will add to when they process packets
             _workerSharedData.addedStreams.clear();
@@ -446,6 +469,7 @@ void AudioMixer::start() {
         // process queued events (networking, global audio packets, &c.)
         {
             auto eventsTimer = _eventsTiming.timer();
+            FRAME_TRACE_RANGE("AudioMixer::processEvents");
 
             // clear removed nodes and removed streams before we process events that will setup the new set
             _workerSharedData.removedNodes.clear();
@@ -455,6 +479,16 @@ void AudioMixer::start() {
             QCoreApplication::processEvents();
         }
 
+        // replace the streams we would replicate one by one with a sub-mix per cell, now that this frame has been popped
+        if (_isReplicatingSubMixes) {
+            FRAME_TRACE_RANGE("AudioMixer::mixAndSendSubMixes");
+            _stats.subMixesSent += _subMixer.mixAndSend(*nodeList);
+        }
+
+        // drop shared HRTF renders and encodings that went unused last frame, before the slaves render this one
+        _workerSharedData.hrtfCache.prune(frame);
+        _workerSharedData.offloadCache.prune(frame);
+
         int numToRetain = -1;
         assert(_throttlingRatio >= 0.0f && _throttlingRatio <= 1.0f);
         if (_throttlingRatio > EPSILON) {
@@ -463,6 +497,7 @@ void AudioMixer::start() {
         nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
             // mix across slave threads
             auto mixTimer = _mixTiming.timer();
+            FRAME_TRACE_RANGE("AudioMixer::mix");
             _slavePool.mix(cbegin, cend, frame, numToRetain);
         });
 
@@ -472,6 +507,15 @@ void AudioMixer::start() {
             slave.stats.reset();
         });
 
+        // frames are due every 10ms
+        static auto& frameUsecs = MetricsRegistry::getInstance().histogram("audio_mixer_frame_usecs",
+            "Time taken to process the packets and events of a frame and mix it.", { 1000, 2000, 5000, 10000, 20000 });
+        auto frameDuration = std::chrono::duration_cast<std::chrono::microseconds>(p_high_resolution_clock::now() - frameStart);
+        frameUsecs.observe((double)frameDuration.count());
+        if (frameDuration.count() > AudioConstants::NETWORK_FRAME_USECS) {
+            writeOverrunTrace();
+        }
+
         ++frame;
         ++_numStatFrames;
 
@@ -484,6 +528,35 @@ void AudioMixer::start() {
     }
 }
 
+// writes a frame trace away from the mixer's thread, so that writing it doesn't make the next frames late too
+class OverrunTraceWriter : public QRunnable {
+public:
+    OverrunTraceWriter(std::vector<tracing::FrameTrace::Record>&& records) : _records(std::move(records)) {}
+    void run() override { tracing::FrameTrace::serialize(OVERRUN_TRACE_FILE, _records); }
+
+private:
+    static const QString OVERRUN_TRACE_FILE;
+    std::vector<tracing::FrameTrace::Record> _records;
+};
+
+const QString OverrunTraceWriter::OVERRUN_TRACE_FILE = "traces/audio-mixer-overrun-{DATE}_{TIME}.json.gz";
+
+void AudioMixer::writeOverrunTrace() {
+    // at most one a minute, which is also as often as the file name changes
+    static const auto OVERRUN_TRACE_INTERVAL = chrono::minutes(1);
+    // the frames leading up to the overrun, the rings of busy threads may hold less
+    static const uint64_t OVERRUN_TRACE_USECS = USECS_PER_SECOND;
+
+    auto now = p_high_resolution_clock::now();
+    if (_lastOverrunTraceTime.time_since_epoch().count() != 0 && now - _lastOverrunTraceTime < OVERRUN_TRACE_INTERVAL) {
+        return;
+    }
+    _lastOverrunTraceTime = now;
+
+    auto records = tracing::FrameTrace::getRecords(tracing::FrameTrace::now() - OVERRUN_TRACE_USECS);
+    QThreadPool::globalInstance()->start(new OverrunTraceWriter(std::move(records)));
+}
+
 chrono::microseconds AudioMixer::timeFrame() {
     // advance the next frame
     auto now = p_high_resolution_clock::now();
@@ -529,6 +602,7 @@ void AudioMixer::throttle(chrono::microseconds duration, int frame) {
     const float CURRENT_FRAME_RATIO = 1.0f / TRAILING_FRAMES;
     const float PREVIOUS_FRAMES_RATIO = 1.0f - CURRENT_FRAME_RATIO;
     _trailingMixRatio = PREVIOUS_FRAMES_RATIO * _trailingMixRatio + CURRENT_FRAME_RATIO * mixRatio;
+    setLoad(min(_trailingMixRatio, 1.0f));
 
     if (frame % TRAILING_FRAMES == 0) {
         if (_trailingMixRatio > TARGET) {
@@ -549,12 +623,18 @@ void AudioMixer::throttle(chrono::microseconds duration, int frame) {
 
 void AudioMixer::clearDomainSettings() {
     _numStaticJitterFrames = DISABLE_STATIC_JITTER_FRAMES;
+    _maxFECGroupSize = AudioFEC::MAX_GROUP_SIZE;
+    _maxOffloadedSources = AudioConstants::MAX_OFFLOADED_SOURCES;
+    _isSharingHRTFRenders = false;
+    _isReplicatingSubMixes = false;
+    _subMixer.setCellSize(0.0f);
     _attenuationPerDoublingInDistance = DEFAULT_ATTENUATION_PER_DOUBLING_IN_DISTANCE;
     _noiseMutingThreshold = DEFAULT_NOISE_MUTING_THRESHOLD;
     _codecPreferenceOrder.clear();
     _audioZones.clear();
     _zoneSettings.clear();
     _zoneReverbSettings.clear();
+    buildZoneSettingsTables();
 }
 
 void AudioMixer::parseSettingsObject(const QJsonObject& settingsObject) {
@@ -590,6 +670,11 @@ void AudioMixer::parseSettingsObject(const QJsonObject& settingsObject) {
         }
 
         qCDebug(audio) << "Throttle Start:" << _throttleStartTarget << "Throttle Backoff:" << _throttleBackoffTarget;
+
+        // listeners hearing a source from about the same direction and distance share its HRTF render
+        const QString SHARE_HRTF_RENDERS_KEY = "share_hrtf_renders";
+        _isSharingHRTFRenders = audioThreadingGroupObject[SHARE_HRTF_RENDERS_KEY].toBool();
+        qCDebug(audio) << "Sharing HRTF renders:" << _isSharingHRTFRenders;
     }
 
     if (settingsObject.contains(AUDIO_BUFFER_GROUP_KEY)) {
@@ -613,6 +698,28 @@ void AudioMixer::parseSettingsObject(const QJsonObject& settingsObject) {
             _numStaticJitterFrames = DISABLE_STATIC_JITTER_FRAMES;
         }
 
+        // clients may ask for FEC on their audio streams, this caps the group size (0 turns FEC off)
+        const QString MAX_FEC_GROUP_SIZE_JSON_KEY = "max_fec_group_size";
+        if (audioBufferGroupObject.contains(MAX_FEC_GROUP_SIZE_JSON_KEY)) {
+            bool ok;
+            int maxFECGroupSize = audioBufferGroupObject[MAX_FEC_GROUP_SIZE_JSON_KEY].toString().toInt(&ok);
+            if (ok) {
+                _maxFECGroupSize = std::max(0, std::min(maxFECGroupSize, AudioFEC::MAX_GROUP_SIZE));
+            }
+            qCDebug(audio) << "Max FEC group size:" << _maxFECGroupSize;
+        }
+
+        // clients may ask to spatialize their loudest sources themselves, this caps how many (0 turns it off)
+        const QString MAX_OFFLOADED_SOURCES_JSON_KEY = "max_offloaded_sources";
+        if (audioBufferGroupObject.contains(MAX_OFFLOADED_SOURCES_JSON_KEY)) {
+            bool ok;
+            int maxOffloadedSources = audioBufferGroupObject[MAX_OFFLOADED_SOURCES_JSON_KEY].toString().toInt(&ok);
+            if (ok) {
+                _maxOffloadedSources = std::max(0, std::min(maxOffloadedSources, AudioConstants::MAX_OFFLOADED_SOURCES));
+            }
+            qCDebug(audio) << "Max offloaded sources:" << _maxOffloadedSources;
+        }
+
         // check for deprecated audio settings
         auto deprecationNotice = [](const QString& setting, const QString& value) {
             qInfo().nospace() << "[DEPRECATION NOTICE] " << setting << "(" << value << ") has been deprecated, and has no effect";
@@ -686,6 +793,18 @@ void AudioMixer::parseSettingsObject(const QJsonObject& settingsObject) {
             }
         }
 
+        // downstream mixers get a sub-mix per cell of this size (in meters) instead of every replicated stream
+        const QString REPLICATION_SUB_MIX_CELL_SIZE = "replication_sub_mix_cell_size";
+        if (audioEnvGroupObject[REPLICATION_SUB_MIX_CELL_SIZE].isString()) {
+            bool ok = false;
+            float cellSize = audioEnvGroupObject[REPLICATION_SUB_MIX_CELL_SIZE].toString().toFloat(&ok);
+            if (ok) {
+                _subMixer.setCellSize(cellSize);
+                _isReplicatingSubMixes = _subMixer.isEnabled();
+                qCDebug(audio) << "Replication sub-mix cell size changed to" << _subMixer.getCellSize();
+            }
+        }
+
         const QString AUDIO_ZONES = "zones";
         if (audioEnvGroupObject[AUDIO_ZONES].isObject()) {
             const QJsonObject& zones = audioEnvGroupObject[AUDIO_ZONES].toObject();
@@ -806,7 +925,74 @@ void AudioMixer::parseSettingsObject(const QJsonObject& settingsObject) {
                 }
             }
         }
+
+        buildZoneSettingsTables();
+    }
+}
+
+void AudioMixer::buildZoneSettingsTables() {
+    const int NO_SETTINGS = -1;
+    size_t numZones = _audioZones.size();
+
+    // the first settings to match win, as they did when the settings were searched in order
+    _zoneSettingsTable.assign(numZones * numZones, NO_SETTINGS);
+    for (size_t i = 0; i < _zoneSettings.size(); ++i) {
+        int& entry = _zoneSettingsTable[_zoneSettings[i].source * numZones + _zoneSettings[i].listener];
+        if (entry == NO_SETTINGS) {
+            entry = (int)i;
+        }
+    }
+
+    _zoneReverbTable.assign(numZones, NO_SETTINGS);
+    for (size_t i = 0; i < _zoneReverbSettings.size(); ++i) {
+        int& entry = _zoneReverbTable[_zoneReverbSettings[i].zone];
+        if (entry == NO_SETTINGS) {
+            entry = (int)i;
+        }
+    }
+}
+
+void AudioMixer::findAudioZones(const glm::vec3& position, std::vector<int>& zones) {
+    zones.clear();
+    for (size_t i = 0; i < _audioZones.size(); ++i) {
+        if (_audioZones[i].area.contains(position)) {
+            zones.push_back((int)i);
+        }
+    }
+}
+
+const AudioMixer::ZoneSettings* AudioMixer::findZoneSettings(const std::vector<int>& sourceZones,
+                                                             const std::vector<int>& listenerZones) {
+    // streams are rarely in more than one zone, so this is usually a single lookup
+    size_t numZones = _audioZones.size();
+    int first = -1;
+    for (int source : sourceZones) {
+        for (int listener : listenerZones) {
+            // the zones may have changed since the streams' zones were found
+            if ((size_t)source >= numZones || (size_t)listener >= numZones) {
+                continue;
+            }
+            int entry = _zoneSettingsTable[source * numZones + listener];
+            if (entry != -1 && (first == -1 || entry < first)) {
+                first = entry;
+            }
+        }
+    }
+    return first != -1 ? &_zoneSettings[first] : nullptr;
+}
+
+const AudioMixer::ReverbSettings* AudioMixer::findReverbSettings(const std::vector<int>& zones) {
+    int first = -1;
+    for (int zone : zones) {
+        if ((size_t)zone >= _zoneReverbTable.size()) {
+            continue;
+        }
+        int entry = _zoneReverbTable[zone];
+        if (entry != -1 && (first == -1 || entry < first)) {
+            first = entry;
+        }
     }
+    return first != -1 ? &_zoneReverbSettings[first] : nullptr;
 }
 
 AudioMixer::Timer::Timing::Timing(uint64_t& sum) : _sum(sum) {
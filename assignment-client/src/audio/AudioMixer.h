@@ -24,6 +24,7 @@
 
 #include "AudioMixerStats.h"
 #include "AudioMixerSlavePool.h"
+#include "AudioMixerSubMixer.h"
 
 class PositionalAudioStream;
 class AvatarAudioStream;
@@ -53,11 +54,22 @@ public:
     };
 
     static int getStaticJitterFrames() { return _numStaticJitterFrames; }
+    static int getMaxFECGroupSize() { return _maxFECGroupSize; }
+    static int getMaxOffloadedSources() { return _maxOffloadedSources; }
+    static bool isSharingHRTFRenders() { return _isSharingHRTFRenders; }
+    static bool isReplicatingSubMixes() { return _isReplicatingSubMixes; }
     static bool shouldMute(float quietestFrame) { return quietestFrame > _noiseMutingThreshold; }
     static float getAttenuationPerDoublingInDistance() { return _attenuationPerDoublingInDistance; }
     static const std::vector<ZoneDescription>& getAudioZones() { return _audioZones; }
     static const std::vector<ZoneSettings>& getZoneSettings() { return _zoneSettings; }
     static const std::vector<ReverbSettings>& getReverbSettings() { return _zoneReverbSettings; }
+
+    // the indices of the zones that contain position
+    static void findAudioZones(const glm::vec3& position, std::vector<int>& zones);
+    // the first of the zone settings for a source in one of sourceZones and a listener in one of listenerZones, or nullptr
+    static const ZoneSettings* findZoneSettings(const std::vector<int>& sourceZones, const std::vector<int>& listenerZones);
+    // the first of the reverb settings for one of zones, or nullptr
+    static const ReverbSettings* findReverbSettings(const std::vector<int>& zones);
     static const std::pair<QString, CodecPluginPointer> negotiateCodec(std::vector<QString> codecs);
 
     static bool shouldReplicateTo(const Node& from, const Node& to) {
@@ -88,6 +100,7 @@ private:
     // mixing helpers
     std::chrono::microseconds timeFrame();
     void throttle(std::chrono::microseconds frameDuration, int frame);
+    void writeOverrunTrace();
 
     AudioMixerClientData* getOrCreateClientData(Node* node);
 
@@ -98,6 +111,7 @@ private:
 
     p_high_resolution_clock::time_point _idealFrameTimestamp;
     p_high_resolution_clock::time_point _startFrameTimestamp;
+    p_high_resolution_clock::time_point _lastOverrunTraceTime;
 
     float _trailingMixRatio { 0.0f };
     float _throttlingRatio { 0.0f };
@@ -141,6 +155,10 @@ private:
     Timer _packetsTiming;
 
     static int _numStaticJitterFrames; // -1 denotes dynamic jitter buffering
+    static int _maxFECGroupSize;
+    static int _maxOffloadedSources;
+    static bool _isSharingHRTFRenders;
+    static bool _isReplicatingSubMixes;
     static float _noiseMutingThreshold;
     static float _attenuationPerDoublingInDistance;
     static std::map<QString, CodecPluginPointer> _availableCodecs;
@@ -150,10 +168,17 @@ private:
     static std::vector<ZoneSettings> _zoneSettings;
     static std::vector<ReverbSettings> _zoneReverbSettings;
 
+    // indices into the settings by (source zone, listener zone), and by zone, so that the mixer doesn't have to search them
+    static void buildZoneSettingsTables();
+    static std::vector<int> _zoneSettingsTable;
+    static std::vector<int> _zoneReverbTable;
+
     float _throttleStartTarget = 0.9f;
     float _throttleBackoffTarget = 0.44f;
 
     AudioMixerSlave::SharedData _workerSharedData;
+
+    AudioMixerSubMixer _subMixer;
 };
 
 #endif // hifi_AudioMixer_h
@@ -83,6 +83,13 @@ int AudioMixerClientData::processPackets(ConcurrentAddedStreams& addedStreams) {
                 parseData(*packet);
                 break;
             }
+            case PacketType::AudioForwardErrorCorrection: {
+                auto avatarAudioStream = getAvatarAudioStream();
+                if (avatarAudioStream) {
+                    avatarAudioStream->parseData(*packet);
+                }
+                break;
+            }
             case PacketType::NegotiateAudioFormat:
                 negotiateAudioFormat(*packet, node);
                 break;
@@ -147,6 +154,11 @@ void AudioMixerClientData::optionallyReplicatePacket(ReceivedMessage& message, c
             }
         }
 
+        // our own sources go downstream in the sub-mixes instead
+        if (AudioMixer::isReplicatingSubMixes() && !isReplicatedPacket(message.getType())) {
+            return;
+        }
+
         std::unique_ptr<NLPacket> packet;
         auto nodeList = DependencyManager::get<NodeList>();
 
@@ -182,6 +194,27 @@ void AudioMixerClientData::negotiateAudioFormat(ReceivedMessage& message, const
     }
     const std::pair<QString, CodecPluginPointer> codec = AudioMixer::negotiateCodec(codecs);
 
+    // clients that support FEC follow the codecs with the group size they'd like
+    quint8 requestedFECGroupSize = 0;
+    if (message.getBytesLeftToRead() >= (qint64)sizeof(requestedFECGroupSize)) {
+        message.readPrimitive(&requestedFECGroupSize);
+    }
+    _fecGroupSize = std::min((int)requestedFECGroupSize, AudioMixer::getMaxFECGroupSize());
+    _fecEncoder.setGroupSize(_fecGroupSize);
+
+    auto avatarAudioStream = getAvatarAudioStream();
+    if (avatarAudioStream) {
+        avatarAudioStream->setupFEC(_fecGroupSize);
+    }
+
+    // then with the number of sources they'd like to spatialize themselves
+    quint8 requestedOffloadedSources = 0;
+    if (message.getBytesLeftToRead() >= (qint64)sizeof(requestedOffloadedSources)) {
+        message.readPrimitive(&requestedOffloadedSources);
+    }
+    _offloadedSourceCount = std::min((int)requestedOffloadedSources, AudioMixer::getMaxOffloadedSources());
+    _maxEncodedMixSize = AudioConstants::NETWORK_FRAME_BYTES_STEREO;
+
     setupCodec(codec.second, codec.first);
     sendSelectAudioFormat(node, codec.first);
 }
@@ -476,6 +509,7 @@ void AudioMixerClientData::processStreamPacket(ReceivedMessage& message, Concurr
 
             auto avatarAudioStream = new AvatarAudioStream(isStereo, AudioMixer::getStaticJitterFrames());
             avatarAudioStream->setupCodec(_codec, _selectedCodecName, isStereo ? AudioConstants::STEREO : AudioConstants::MONO);
+            avatarAudioStream->setupFEC(_fecGroupSize);
 
             if (_isIgnoreRadiusEnabled) {
                 avatarAudioStream->enableIgnoreBox();
@@ -553,6 +587,7 @@ int AudioMixerClientData::checkBuffersBeforeFrameSend() {
         SharedStreamPointer stream = *it;
 
         if (stream->popFrames(1, true) > 0) {
+            stream->copyLastPopOutput();
             stream->updateLastPopOutputLoudnessAndTrailingLoudness();
         }
 
@@ -694,6 +729,7 @@ QJsonObject AudioMixerClientData::getAudioStreamStats() {
         upstreamStats["silents_dropped"] = (double) streamStats._framesDropped;
         upstreamStats["lost%"] = streamStats._packetStreamStats.getLostRate() * 100.0f;
         upstreamStats["lost%_30s"] = streamStats._packetStreamWindowStats.getLostRate() * 100.0f;
+        upstreamStats["fec_recovered"] = avatarAudioStream->getFECRecoveredCount();
         upstreamStats["min_gap"] = formatUsecTime(streamStats._timeGapMin);
         upstreamStats["max_gap"] = formatUsecTime(streamStats._timeGapMax);
         upstreamStats["avg_gap"] = formatUsecTime(streamStats._timeGapAverage);
@@ -760,6 +796,9 @@ void AudioMixerClientData::handleMismatchAudioFormat(SharedNodePointer node, con
 void AudioMixerClientData::sendSelectAudioFormat(SharedNodePointer node, const QString& selectedCodecName) {
     auto replyPacket = NLPacket::create(PacketType::SelectedAudioFormat);
     replyPacket->writeString(selectedCodecName);
+    // the FEC group size for both streams and the number of offloaded sources, clients that don't support them ignore them
+    replyPacket->writePrimitive((quint8)_fecGroupSize);
+    replyPacket->writePrimitive((quint8)_offloadedSourceCount);
     auto nodeList = DependencyManager::get<NodeList>();
     nodeList->sendPacket(std::move(replyPacket), *node);
 }
@@ -12,6 +12,7 @@
 #ifndef hifi_AudioMixerClientData_h
 #define hifi_AudioMixerClientData_h
 
+#include <array>
 #include <queue>
 
 #if !defined(Q_MOC_RUN)
@@ -23,6 +24,7 @@
 #include <QtCore/QSharedPointer>
 
 #include <AABox.h>
+#include <AudioFEC.h>
 #include <AudioHRTF.h>
 #include <AudioLimiter.h>
 #include <UUIDHasher.h>
@@ -32,6 +34,8 @@
 
 #include "PositionalAudioStream.h"
 #include "AvatarAudioStream.h"
+#include "AudioMixerHRTFCache.h"
+#include "AudioMixerOffloadCache.h"
 
 class AudioMixerClientData : public NodeData {
     Q_OBJECT
@@ -108,6 +112,17 @@ public:
     bool shouldFlushEncoder() { return _shouldFlushEncoder; }
 
     QString getCodecName() { return _selectedCodecName; }
+    const CodecPluginPointer& getCodec() const { return _codec; }
+
+    // the number of its loudest sources the client spatializes itself, negotiated with the codec
+    int getOffloadedSourceCount() const { return _offloadedSourceCount; }
+
+    // the largest recent mix, decaying a byte a frame, which bounds the room left for offloaded sources in a packet
+    int getMaxEncodedMixSize() const { return _maxEncodedMixSize; }
+    void updateMaxEncodedMixSize(int size) { _maxEncodedMixSize = std::max(size, _maxEncodedMixSize - 1); }
+
+    // parity for the outbound mixed stream, disabled unless the client asked for it
+    AudioFECEncoder& getFECEncoder() { return _fecEncoder; }
 
     bool shouldMuteClient() { return _shouldMuteClient; }
     void setShouldMuteClient(bool shouldMuteClient) { _shouldMuteClient = shouldMuteClient; }
@@ -125,6 +140,17 @@ public:
         bool ignoredByListener { false };
         bool ignoringListener { false };
 
+        // when HRTF renders are shared between listeners, this listener's bucket and gain in the last frame
+        std::shared_ptr<AudioMixerHRTFCache::Source> sharedHRTF;
+        int sharedHRTFBucket { AudioMixerHRTFCache::NO_BUCKET };
+        float sharedHRTFGain { 0.0f };
+
+        // when the listener spatializes this source itself, the shared encoding and the listener's slot for it
+        std::shared_ptr<AudioMixerOffloadCache::Source> offloadSource;
+        int offloadSlot { -1 };
+        bool isOffloaded { false };
+        unsigned int offloadedFrame { 0 };
+
         MixableStream(NodeIDStreamID nodeIDStreamID, PositionalAudioStream* positionalStream) :
             nodeStreamID(nodeIDStreamID), hrtf(new AudioHRTF), positionalStream(positionalStream) {};
         MixableStream(QUuid nodeID, Node::LocalID localNodeID, StreamID streamID, PositionalAudioStream* positionalStream) :
@@ -140,6 +166,10 @@ public:
 
     Streams& getStreams() { return _streams; }
 
+    // the source holding each offload slot, only used to know a slot still belongs to the same source
+    using OffloadSlots = std::array<const AudioMixerOffloadCache::Source*, AudioConstants::MAX_OFFLOADED_SOURCES>;
+    OffloadSlots& getOffloadSlots() { return _offloadSlots; }
+
     // thread-safe, called from AudioMixerSlave(s) while processing ignore packets for other nodes
     void ignoredByNode(QUuid nodeID);
     void unignoredByNode(QUuid nodeID);
@@ -201,6 +231,11 @@ private:
     QString _selectedCodecName;
     Encoder* _encoder{ nullptr }; // for outbound mixed stream
     Decoder* _decoder{ nullptr }; // for mic stream
+    int _fecGroupSize { 0 }; // FEC group size negotiated with the client, for both streams
+    AudioFECEncoder _fecEncoder; // for outbound mixed stream
+    int _offloadedSourceCount { 0 }; // sources sent alongside the mix, negotiated with the client
+    int _maxEncodedMixSize { AudioConstants::NETWORK_FRAME_BYTES_STEREO };
+    OffloadSlots _offloadSlots {};
 
     bool _shouldFlushEncoder { false };
 
@@ -0,0 +1,111 @@
+//
+//  AudioMixerHRTFCache.cpp
+//  assignment-client/src/audio
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioMixerHRTFCache.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <NumericalConstants.h>
+
+static const int HRTF_DATASET_INDEX = 1;
+
+static const float AZIMUTH_STEP = TWO_PI / AudioMixerHRTFCache::AZIMUTH_BUCKETS;
+static const float DISTANCE_STEPS_PER_OCTAVE = 4.0f;
+
+int AudioMixerHRTFCache::getBucket(float azimuth, float distance) {
+    int azimuthBucket = (int)std::lround(azimuth / AZIMUTH_STEP) % AZIMUTH_BUCKETS;
+    if (azimuthBucket < 0) {
+        azimuthBucket += AZIMUTH_BUCKETS;
+    }
+
+    float octaves = std::log2(std::max(distance, HRTF_NEARFIELD_MIN) / HRTF_NEARFIELD_MIN);
+    int distanceBucket = std::min((int)std::lround(octaves * DISTANCE_STEPS_PER_OCTAVE), DISTANCE_BUCKETS - 1);
+
+    return azimuthBucket * DISTANCE_BUCKETS + distanceBucket;
+}
+
+const float* AudioMixerHRTFCache::Source::getBlock(unsigned int frame, int bucket, const int16_t* input, bool& rendered) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto& entry = _buckets[bucket];
+    if (!entry) {
+        entry.reset(new Bucket());
+    } else if (entry->frame == frame) {
+        rendered = false;
+        return entry->block;
+    } else if (entry->frame != frame - 1) {
+        // it missed a frame, so its history isn't this source's recent audio
+        entry->hrtf.reset();
+    }
+
+    // render at the centre of the bucket
+    float azimuth = (bucket / DISTANCE_BUCKETS) * AZIMUTH_STEP;
+    if (azimuth > PI) {
+        azimuth -= TWO_PI;
+    }
+    float distance = HRTF_NEARFIELD_MIN * std::exp2((bucket % DISTANCE_BUCKETS) / DISTANCE_STEPS_PER_OCTAVE);
+
+    memset(entry->block, 0, sizeof(entry->block));
+    entry->hrtf.render(input, entry->block, HRTF_DATASET_INDEX, azimuth, distance, 1.0f,
+                       AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+    entry->frame = frame;
+
+    rendered = true;
+    return entry->block;
+}
+
+std::shared_ptr<AudioMixerHRTFCache::Source> AudioMixerHRTFCache::getSource(const PositionalAudioStream* stream,
+                                                                            const NodeIDStreamID& nodeStreamID) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto& source = _sources[stream];
+    if (!source || !(source->_nodeStreamID == nodeStreamID)) {
+        // new, or a removed stream's memory has been reused for this one
+        source.reset(new Source(nodeStreamID));
+    }
+    return source;
+}
+
+void AudioMixerHRTFCache::prune(unsigned int frame) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    for (auto it = _sources.begin(); it != _sources.end();) {
+        if (it->second.use_count() == 1) {
+            it = _sources.erase(it);
+            continue;
+        }
+
+        auto& buckets = it->second->_buckets;
+        for (auto bucketIt = buckets.begin(); bucketIt != buckets.end();) {
+            if (bucketIt->second->frame + 1 < frame) {
+                bucketIt = buckets.erase(bucketIt);
+            } else {
+                ++bucketIt;
+            }
+        }
+        ++it;
+    }
+}
+
+void crossfadeHRTFBlocks(const float* block0, const float* block1, float gain0, float gain1, float* output) {
+    const int numFrames = AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL;
+    const float step = 1.0f / numFrames;
+
+    for (int i = 0; i < numFrames; ++i) {
+        float frac = (i + 1) * step;
+        float g0 = gain0 * (1.0f - frac);
+        float g1 = gain1 * frac;
+
+        output[2*i+0] += block0[2*i+0] * g0 + block1[2*i+0] * g1;
+        output[2*i+1] += block0[2*i+1] * g0 + block1[2*i+1] * g1;
+    }
+}
@@ -0,0 +1,76 @@
+//
+//  AudioMixerHRTFCache.h
+//  assignment-client/src/audio
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_AudioMixerHRTFCache_h
+#define vircadia_AudioMixerHRTFCache_h
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <AudioConstants.h>
+#include <AudioHRTF.h>
+#include <PositionalAudioStream.h>
+
+// Shares HRTF renders of a source between the listeners that hear it from about the same place.
+//
+// Listeners are put in a bucket by the source's azimuth and distance relative to them. The first listener in a bucket
+// renders the source's frame at the bucket's centre and at unit gain, and everyone else in the bucket reuses that
+// block with their own gain. A source heard by many listeners costs one render per occupied bucket instead of one per
+// listener.
+//
+// Blocks are rendered while mixing, from the slave threads; prune must be called between mixes.
+class AudioMixerHRTFCache {
+public:
+    static const int AZIMUTH_BUCKETS = HRTF_AZIMUTHS;   // the 5 degree steps of the HRTF tables
+    static const int DISTANCE_BUCKETS = 45;             // quarter octaves from HRTF_NEARFIELD_MIN to LPF_DISTANCE_REF
+    static const int NO_BUCKET = -1;
+
+    static int getBucket(float azimuth, float distance);
+
+    class Source {
+    public:
+        // returns the bucket's unit gain stereo block for this frame, rendering it from input (mono) if nobody has yet
+        // rendered is set when this call did the render
+        const float* getBlock(unsigned int frame, int bucket, const int16_t* input, bool& rendered);
+
+    private:
+        friend class AudioMixerHRTFCache;
+
+        struct Bucket {
+            AudioHRTF hrtf;
+            unsigned int frame { 0 };
+            float block[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
+        };
+
+        std::mutex _mutex;
+        std::unordered_map<int, std::unique_ptr<Bucket>> _buckets;
+
+        NodeIDStreamID _nodeStreamID;
+
+        Source(const NodeIDStreamID& nodeStreamID) : _nodeStreamID(nodeStreamID) {}
+    };
+
+    // the shared renders for a stream, held by each listener's MixableStream so that this is only looked up once
+    std::shared_ptr<Source> getSource(const PositionalAudioStream* stream, const NodeIDStreamID& nodeStreamID);
+
+    // drops buckets that weren't rendered in the last frame (their filter state is stale)
+    // and sources that no listener holds on to
+    void prune(unsigned int frame);
+
+private:
+    std::mutex _mutex;
+    std::unordered_map<const PositionalAudioStream*, std::shared_ptr<Source>> _sources;
+};
+
+// accumulates the crossfade from block0 at gain0 to block1 at gain1 into the interleaved stereo output
+void crossfadeHRTFBlocks(const float* block0, const float* block1, float gain0, float gain1, float* output);
+
+#endif // vircadia_AudioMixerHRTFCache_h
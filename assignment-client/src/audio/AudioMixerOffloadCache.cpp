@@ -0,0 +1,90 @@
+//
+//  AudioMixerOffloadCache.cpp
+//  assignment-client/src/audio
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioMixerOffloadCache.h"
+
+#include <AudioConstants.h>
+
+AudioMixerOffloadCache::Source::~Source() {
+    for (auto& entry : _encodings) {
+        if (entry.second->codec && entry.second->encoder) {
+            entry.second->codec->releaseEncoder(entry.second->encoder);
+        }
+    }
+}
+
+const QByteArray& AudioMixerOffloadCache::Source::getFrame(unsigned int frame, const CodecPluginPointer& codec,
+                                                           const QString& codecName, const int16_t* input,
+                                                           bool& encoded) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto& entry = _encodings[codecName];
+    if (!entry) {
+        entry.reset(new Encoding());
+        entry->codec = codec;
+        if (codec) {
+            entry->encoder = codec->createEncoder(AudioConstants::SAMPLE_RATE, AudioConstants::MONO);
+        }
+    } else if (entry->frame == frame) {
+        encoded = false;
+        return entry->encoded;
+    }
+
+    QByteArray decoded = QByteArray::fromRawData(reinterpret_cast<const char*>(input),
+                                                 AudioConstants::NETWORK_FRAME_BYTES_PER_CHANNEL);
+    if (entry->encoder) {
+        entry->encoder->encode(decoded, entry->encoded);
+    } else {
+        // pcm, deep copy since input is only valid for this frame
+        entry->encoded = QByteArray(decoded.constData(), decoded.size());
+    }
+    entry->frame = frame;
+
+    encoded = true;
+    return entry->encoded;
+}
+
+std::shared_ptr<AudioMixerOffloadCache::Source> AudioMixerOffloadCache::getSource(const PositionalAudioStream* stream,
+                                                                                  const NodeIDStreamID& nodeStreamID) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto& source = _sources[stream];
+    if (!source || !(source->_nodeStreamID == nodeStreamID)) {
+        // new, or a removed stream's memory has been reused for this one
+        source.reset(new Source(nodeStreamID));
+    }
+    return source;
+}
+
+void AudioMixerOffloadCache::prune(unsigned int frame) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    for (auto it = _sources.begin(); it != _sources.end();) {
+        if (it->second.use_count() == 1) {
+            it = _sources.erase(it);
+            continue;
+        }
+
+        // nobody took the frame before last, so nobody's decoder follows this encoder any more
+        auto& encodings = it->second->_encodings;
+        for (auto encodingIt = encodings.begin(); encodingIt != encodings.end();) {
+            auto& encoding = *encodingIt->second;
+            if (encoding.frame + 1 < frame) {
+                if (encoding.codec && encoding.encoder) {
+                    encoding.codec->releaseEncoder(encoding.encoder);
+                }
+                encodingIt = encodings.erase(encodingIt);
+            } else {
+                ++encodingIt;
+            }
+        }
+        ++it;
+    }
+}
@@ -0,0 +1,74 @@
+//
+//  AudioMixerOffloadCache.h
+//  assignment-client/src/audio
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_AudioMixerOffloadCache_h
+#define vircadia_AudioMixerOffloadCache_h
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+
+#include <plugins/Forward.h>
+#include <plugins/CodecPlugin.h>
+#include <PositionalAudioStream.h>
+
+// Shares the encoding of a source's frame between the listeners it is offloaded to.
+//
+// A listener that spatializes its loudest sources itself is sent their mono frames instead of having them in its mix.
+// Each source keeps one encoder per codec, and the first listener with that codec to want this frame encodes it.
+// The encoder runs across whatever listeners are taking the source, so a listener that starts taking it part way
+// through must start from a fresh decoder.
+//
+// Frames are encoded while mixing, from the slave threads; prune must be called between mixes.
+class AudioMixerOffloadCache {
+public:
+    class Source {
+    public:
+        ~Source();
+
+        // returns the frame encoded with codec, encoding input (mono) if nobody has yet
+        // encoded is set when this call did the encode
+        const QByteArray& getFrame(unsigned int frame, const CodecPluginPointer& codec, const QString& codecName,
+                                   const int16_t* input, bool& encoded);
+
+    private:
+        friend class AudioMixerOffloadCache;
+
+        struct Encoding {
+            CodecPluginPointer codec;
+            Encoder* encoder { nullptr };
+            unsigned int frame { 0 };
+            QByteArray encoded;
+        };
+
+        std::mutex _mutex;
+        std::map<QString, std::unique_ptr<Encoding>> _encodings;
+
+        NodeIDStreamID _nodeStreamID;
+
+        Source(const NodeIDStreamID& nodeStreamID) : _nodeStreamID(nodeStreamID) {}
+    };
+
+    // the shared encodings for a stream, held by each listener's MixableStream so that this is only looked up once
+    std::shared_ptr<Source> getSource(const PositionalAudioStream* stream, const NodeIDStreamID& nodeStreamID);
+
+    // drops sources that no listener holds on to, and the encoders of those that weren't offloaded last frame
+    void prune(unsigned int frame);
+
+private:
+    std::mutex _mutex;
+    std::unordered_map<const PositionalAudioStream*, std::shared_ptr<Source>> _sources;
+};
+
+#endif // vircadia_AudioMixerOffloadCache_h
@@ -17,6 +17,8 @@
 #include <glm/gtx/norm.hpp>
 #include <glm/gtx/vector_angle.hpp>
 
+#include <AudioFEC.h>
+#include <AudioMixKernels.h>
 #include <LogHandler.h>
 #include <NetworkAccessManager.h>
 #include <NodeList.h>
@@ -43,7 +45,8 @@ using MixableStreamsVector = AudioMixerClientData::MixableStreamsVector;
 
 // packet helpers
 std::unique_ptr<NLPacket> createAudioPacket(PacketType type, int size, quint16 sequence, QString codec);
-void sendMixPacket(const SharedNodePointer& node, AudioMixerClientData& data, QByteArray& buffer);
+void sendMixPacket(const SharedNodePointer& node, AudioMixerClientData& data, QByteArray& buffer,
+                   const QByteArray& offloadedSources, int numOffloadedSources);
 void sendSilentPacket(const SharedNodePointer& node, AudioMixerClientData& data);
 void sendMutePacket(const SharedNodePointer& node, AudioMixerClientData&);
 void sendEnvironmentPacket(const SharedNodePointer& node, AudioMixerClientData& data);
@@ -60,6 +63,11 @@ void AudioMixerSlave::processPackets(const SharedNodePointer& node) {
     if (data) {
         // process packets and collect the number of streams available for this frame
         stats.sumStreams += data->processPackets(_sharedData.addedStreams);
+
+        // find the zones of each stream once, rather than once for every listener that hears it
+        for (auto& stream : data->getAudioStreams()) {
+            AudioMixer::findAudioZones(stream->getPosition(), stream->editAudioZones());
+        }
     }
 }
 
@@ -100,9 +108,10 @@ void AudioMixerSlave::mix(const SharedNodePointer& node) {
         bool mixHasAudio = prepareMix(node);
 
         // send audio packet
-        if (mixHasAudio || data->shouldFlushEncoder()) {
+        bool hasOffloadedSources = _numOffloadedSources > 0;
+        if (mixHasAudio || hasOffloadedSources || data->shouldFlushEncoder()) {
             QByteArray encodedBuffer;
-            if (mixHasAudio) {
+            if (mixHasAudio || hasOffloadedSources) {
                 // encode the audio
                 QByteArray decodedBuffer(reinterpret_cast<char*>(_bufferSamples), AudioConstants::NETWORK_FRAME_BYTES_STEREO);
                 data->encode(decodedBuffer, encodedBuffer);
@@ -111,7 +120,7 @@ void AudioMixerSlave::mix(const SharedNodePointer& node) {
                 data->encodeFrameOfZeros(encodedBuffer);
             }
 
-            sendMixPacket(node, *data, encodedBuffer);
+            sendMixPacket(node, *data, encodedBuffer, _offloadedSources, _numOffloadedSources);
         } else {
             ++stats.sumListenersSilent;
             sendSilentPacket(node, *data);
@@ -369,6 +378,13 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
         return false;
     });
 
+    // the loudest sources of a listener that spatializes them itself stay out of its mix
+    _offloadedSources.clear();
+    _numOffloadedSources = 0;
+    if (listenerData->getOffloadedSourceCount() > 0) {
+        selectOffloadedStreams(*listenerData, *listenerAudioStream);
+    }
+
     // Process active streams
     erase_if(streams.active, [&](MixableStream& stream) {
         if (shouldBeRemoved(stream, _sharedData)) {
@@ -475,13 +491,7 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
 
     // check for silent audio before limiting
     // limiting uses a dither and can only guarantee abs(sample) <= 1
-    bool hasAudio = false;
-    for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_STEREO; ++i) {
-        if (_mixSamples[i] != 0.0f) {
-            hasAudio = true;
-            break;
-        }
-    }
+    bool hasAudio = !isSilent(_mixSamples, AudioConstants::NETWORK_FRAME_SAMPLES_STEREO);
 
     // use the per listener AudioLimiter to render the mixed data
     listenerData->audioLimiter.render(_mixSamples, _bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
@@ -510,8 +520,6 @@ void AudioMixerSlave::addStream(AudioMixerClientData::MixableStream& mixableStre
                                                    relativePosition, distance));
     float azimuth = isEcho ? 0.0f : computeAzimuth(listeningNodeStream, listeningNodeStream, relativePosition);
 
-    const int HRTF_DATASET_INDEX = 1;
-
     if (!streamToAdd->lastPopSucceeded()) {
         bool forceSilentBlock = true;
 
@@ -536,8 +544,7 @@ void AudioMixerSlave::addStream(AudioMixerClientData::MixableStream& mixableStre
             // (this is not done for stereo streams since they do not go through the HRTF)
             if (!streamToAdd->isStereo() && !isEcho) {
                 static int16_t silentMonoBlock[AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL] = {};
-                mixableStream.hrtf->render(silentMonoBlock, _mixSamples, HRTF_DATASET_INDEX, azimuth, distance, gain,
-                                           AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+                renderHRTF(mixableStream, silentMonoBlock, azimuth, distance, gain);
 
                 ++stats.hrtfRenders;
             }
@@ -546,35 +553,144 @@ void AudioMixerSlave::addStream(AudioMixerClientData::MixableStream& mixableStre
         }
     }
 
-    // grab the stream from the ring buffer
-    AudioRingBuffer::ConstIterator streamPopOutput = streamToAdd->getLastPopOutput();
+    if (mixableStream.isOffloaded && offloadStream(mixableStream, relativePosition,
+                                                   gain * mixableStream.hrtf->getGainAdjustment())) {
+        return;
+    }
 
-    if (streamToAdd->isStereo()) {
+    if (mixableStream.offloadedFrame + 1 == _frame) {
+        // back in the mix after the listener spatialized it, the HRTF history is stale
+        resetHRTFState(mixableStream);
+    }
+
+    // the frame was copied out of the ring buffer once when it was popped, every listener reads it in place
+    const int16_t* streamPopOutput = streamToAdd->getLastPopFrame();
 
-        streamPopOutput.readSamples(_bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_STEREO);
+    if (streamToAdd->isStereo()) {
 
         // stereo sources are not passed through HRTF
-        mixableStream.hrtf->mixStereo(_bufferSamples, _mixSamples, gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        mixableStream.hrtf->mixStereo(streamPopOutput, _mixSamples, gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
 
         ++stats.manualStereoMixes;
     } else if (isEcho) {
 
-        streamPopOutput.readSamples(_bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
-
         // echo sources are not passed through HRTF
-        mixableStream.hrtf->mixMono(_bufferSamples, _mixSamples, gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        mixableStream.hrtf->mixMono(streamPopOutput, _mixSamples, gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
 
         ++stats.manualEchoMixes;
     } else {
 
-        streamPopOutput.readSamples(_bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
-
-        mixableStream.hrtf->render(_bufferSamples, _mixSamples, HRTF_DATASET_INDEX, azimuth, distance, gain,
-                                   AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        renderHRTF(mixableStream, streamPopOutput, azimuth, distance, gain);
         ++stats.hrtfRenders;
     }
 }
 
+void AudioMixerSlave::selectOffloadedStreams(AudioMixerClientData& listenerData,
+                                             const AvatarAudioStream& listenerAudioStream) {
+    _offloadCodec = listenerData.getCodec();
+    _offloadCodecName = listenerData.getCodecName();
+
+    // the room left in the packet once the sequence number, codec, mix and this listener's FEC are in
+    const int MIX_WITH_SOURCES_HEADER_SIZE = sizeof(quint16) + AudioConstants::MAX_CODEC_NAME_LENGTH_ON_WIRE +
+        sizeof(quint16) + sizeof(quint8);
+    _offloadBudget = NLPacket::maxPayloadSize(PacketType::MixedAudioWithSources) - MIX_WITH_SOURCES_HEADER_SIZE -
+        AudioFEC::HEADER_BYTES - listenerData.getMaxEncodedMixSize();
+
+    auto& streams = listenerData.getStreams();
+
+    _offloadCandidates.clear();
+    for (auto& stream : streams.active) {
+        stream.isOffloaded = false;
+
+        if (shouldBeRemoved(stream, _sharedData)) {
+            continue;
+        }
+
+        // stereo sources and echoes don't go through the HRTF, so there's nothing to offload
+        if (stream.positionalStream->isStereo() || stream.positionalStream == &listenerAudioStream ||
+            !stream.positionalStream->lastPopSucceeded()) {
+            continue;
+        }
+
+        stream.approximateVolume = approximateVolume(stream, &listenerAudioStream);
+        if (stream.approximateVolume > 0.0f) {
+            _offloadCandidates.push_back(&stream);
+        }
+    }
+
+    int numToOffload = min(listenerData.getOffloadedSourceCount(), (int)_offloadCandidates.size());
+    auto offloadPoint = begin(_offloadCandidates) + numToOffload;
+    std::nth_element(begin(_offloadCandidates), offloadPoint, end(_offloadCandidates),
+                     [](const MixableStream* a, const MixableStream* b) {
+                         return a->approximateVolume > b->approximateVolume;
+                     });
+
+    // sources keep their slot while it is still theirs, so the listener's decoder and HRTF for it carry on
+    auto& slots = listenerData.getOffloadSlots();
+    AudioMixerClientData::OffloadSlots keptSlots {};
+    for (auto it = begin(_offloadCandidates); it != offloadPoint; ++it) {
+        MixableStream& stream = **it;
+        stream.isOffloaded = true;
+        if (!stream.offloadSource) {
+            stream.offloadSource = _sharedData.offloadCache.getSource(stream.positionalStream, stream.nodeStreamID);
+        }
+
+        int slot = stream.offloadSlot;
+        if (slot >= 0 && slots[slot] == stream.offloadSource.get() && !keptSlots[slot]) {
+            keptSlots[slot] = stream.offloadSource.get();
+        } else {
+            stream.offloadSlot = -1;
+        }
+    }
+
+    int freeSlot = 0;
+    for (auto it = begin(_offloadCandidates); it != offloadPoint; ++it) {
+        MixableStream& stream = **it;
+        if (stream.offloadSlot == -1) {
+            while (keptSlots[freeSlot]) {
+                ++freeSlot;
+            }
+            stream.offloadSlot = freeSlot;
+            keptSlots[freeSlot] = stream.offloadSource.get();
+        }
+    }
+
+    slots = keptSlots;
+}
+
+bool AudioMixerSlave::offloadStream(AudioMixerClientData::MixableStream& mixableStream,
+                                    const glm::vec3& relativePosition, float gain) {
+    bool encoded;
+    const QByteArray& frame = mixableStream.offloadSource->getFrame(_frame, _offloadCodec, _offloadCodecName,
+                                                                    mixableStream.positionalStream->getLastPopFrame(),
+                                                                    encoded);
+    stats.offloadEncodes += encoded;
+
+    const int OFFLOADED_SOURCE_HEADER_SIZE = sizeof(quint8) + sizeof(glm::vec3) + sizeof(float) + sizeof(quint16);
+    if (_offloadedSources.size() + OFFLOADED_SOURCE_HEADER_SIZE + frame.size() > _offloadBudget) {
+        return false;
+    }
+
+    // the listener starts over on this slot if it didn't get this source's last frame in it
+    quint8 slot = (quint8)mixableStream.offloadSlot;
+    if (mixableStream.offloadedFrame + 1 != _frame) {
+        slot |= AudioConstants::OFFLOADED_SOURCE_RESET;
+    }
+    quint16 frameSize = (quint16)frame.size();
+
+    // the position is left in world space, relative to the listener, so that it is turned by their latest orientation
+    _offloadedSources.append(reinterpret_cast<const char*>(&slot), sizeof(slot));
+    _offloadedSources.append(reinterpret_cast<const char*>(&relativePosition), sizeof(glm::vec3));
+    _offloadedSources.append(reinterpret_cast<const char*>(&gain), sizeof(gain));
+    _offloadedSources.append(reinterpret_cast<const char*>(&frameSize), sizeof(frameSize));
+    _offloadedSources.append(frame);
+
+    mixableStream.offloadedFrame = _frame;
+    ++_numOffloadedSources;
+    ++stats.offloadedSources;
+    return true;
+}
+
 void AudioMixerSlave::updateHRTFParameters(AudioMixerClientData::MixableStream& mixableStream,
                                            AvatarAudioStream& listeningNodeStream,
                                            float masterAvatarGain,
@@ -593,14 +709,68 @@ void AudioMixerSlave::updateHRTFParameters(AudioMixerClientData::MixableStream&
 
     mixableStream.hrtf->setParameterHistory(azimuth, distance, gain);
 
+    if (mixableStream.sharedHRTF) {
+        mixableStream.sharedHRTFBucket = AudioMixerHRTFCache::getBucket(azimuth, distance);
+        mixableStream.sharedHRTFGain = gain * mixableStream.hrtf->getGainAdjustment();
+    }
+
     ++stats.hrtfUpdates;
 }
 
 void AudioMixerSlave::resetHRTFState(AudioMixerClientData::MixableStream& mixableStream) {
      mixableStream.hrtf->reset();
+    mixableStream.sharedHRTFBucket = AudioMixerHRTFCache::NO_BUCKET;
     ++stats.hrtfResets;
 }
 
+void AudioMixerSlave::renderHRTF(AudioMixerClientData::MixableStream& mixableStream, const int16_t* input,
+                                 float azimuth, float distance, float gain) {
+    const int HRTF_DATASET_INDEX = 1;
+
+    if (!AudioMixer::isSharingHRTFRenders()) {
+        if (mixableStream.sharedHRTF) {
+            // sharing was just turned off, the listener's own HRTF has no recent history
+            mixableStream.sharedHRTF.reset();
+            mixableStream.hrtf->reset();
+        }
+
+        mixableStream.hrtf->render(input, _mixSamples, HRTF_DATASET_INDEX, azimuth, distance, gain,
+                                   AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        return;
+    }
+
+    if (!mixableStream.sharedHRTF) {
+        mixableStream.sharedHRTF = _sharedData.hrtfCache.getSource(mixableStream.positionalStream,
+                                                                   mixableStream.nodeStreamID);
+        mixableStream.sharedHRTFBucket = AudioMixerHRTFCache::NO_BUCKET;
+    }
+
+    // the shared blocks are at unit gain, so the listener's adjustment is applied here
+    gain *= mixableStream.hrtf->getGainAdjustment();
+    int bucket = AudioMixerHRTFCache::getBucket(azimuth, distance);
+
+    bool rendered;
+    const float* block = mixableStream.sharedHRTF->getBlock(_frame, bucket, input, rendered);
+    stats.hrtfSharedRenders += rendered;
+
+    const float* previousBlock = block;
+    float previousGain = gain;
+    if (mixableStream.sharedHRTFBucket != AudioMixerHRTFCache::NO_BUCKET) {
+        previousGain = mixableStream.sharedHRTFGain;
+
+        if (mixableStream.sharedHRTFBucket != bucket) {
+            // crossfade from the bucket the listener was in
+            previousBlock = mixableStream.sharedHRTF->getBlock(_frame, mixableStream.sharedHRTFBucket, input, rendered);
+            stats.hrtfSharedRenders += rendered;
+        }
+    }
+
+    crossfadeHRTFBlocks(previousBlock, block, previousGain, gain, _mixSamples);
+
+    mixableStream.sharedHRTFBucket = bucket;
+    mixableStream.sharedHRTFGain = gain;
+}
+
 std::unique_ptr<NLPacket> createAudioPacket(PacketType type, int size, quint16 sequence, QString codec) {
     auto audioPacket = NLPacket::create(type, size);
     audioPacket->writePrimitive(sequence);
@@ -608,18 +778,48 @@ std::unique_ptr<NLPacket> createAudioPacket(PacketType type, int size, quint16 s
     return audioPacket;
 }
 
-void sendMixPacket(const SharedNodePointer& node, AudioMixerClientData& data, QByteArray& buffer) {
+void sendMixPacket(const SharedNodePointer& node, AudioMixerClientData& data, QByteArray& buffer,
+                   const QByteArray& offloadedSources, int numOffloadedSources) {
     const int MIX_PACKET_SIZE =
         sizeof(quint16) + AudioConstants::MAX_CODEC_NAME_LENGTH_ON_WIRE + AudioConstants::NETWORK_FRAME_BYTES_STEREO;
+    const int MIX_WITH_SOURCES_HEADER_SIZE =
+        sizeof(quint16) + AudioConstants::MAX_CODEC_NAME_LENGTH_ON_WIRE + sizeof(quint16) + sizeof(quint8);
     quint16 sequence = data.getOutgoingSequenceNumber();
     QString codec = data.getCodecName();
-    auto mixPacket = createAudioPacket(PacketType::MixedAudio, MIX_PACKET_SIZE, sequence, codec);
 
-    // pack samples
-    mixPacket->write(buffer.constData(), buffer.size());
+    data.updateMaxEncodedMixSize(buffer.size());
+
+    // the sources were budgeted against recent mixes, if this one is bigger they are dropped for this frame
+    int mixWithSourcesSize = MIX_WITH_SOURCES_HEADER_SIZE + buffer.size() + offloadedSources.size();
+    if (numOffloadedSources > 0 &&
+        mixWithSourcesSize + AudioFEC::HEADER_BYTES > NLPacket::maxPayloadSize(PacketType::MixedAudioWithSources)) {
+        numOffloadedSources = 0;
+    }
+
+    std::unique_ptr<NLPacket> mixPacket;
+    if (numOffloadedSources > 0) {
+        mixPacket = createAudioPacket(PacketType::MixedAudioWithSources, mixWithSourcesSize, sequence, codec);
+
+        // pack samples, then the sources spatialized by the listener
+        mixPacket->writePrimitive((quint16)buffer.size());
+        mixPacket->write(buffer.constData(), buffer.size());
+        mixPacket->writePrimitive((quint8)numOffloadedSources);
+        mixPacket->write(offloadedSources.constData(), offloadedSources.size());
+    } else {
+        mixPacket = createAudioPacket(PacketType::MixedAudio, MIX_PACKET_SIZE, sequence, codec);
+
+        // pack samples
+        mixPacket->write(buffer.constData(), buffer.size());
+    }
+
+    auto parityPacket = data.getFECEncoder().addPacket(*mixPacket);
 
     // send packet
-    DependencyManager::get<NodeList>()->sendPacket(std::move(mixPacket), *node);
+    auto nodeList = DependencyManager::get<NodeList>();
+    nodeList->sendPacket(std::move(mixPacket), *node);
+    if (parityPacket) {
+        nodeList->sendPacket(std::move(parityPacket), *node);
+    }
     data.incrementOutgoingMixedAudioSequenceNumber();
 }
 
@@ -633,8 +833,14 @@ void sendSilentPacket(const SharedNodePointer& node, AudioMixerClientData& data)
     // pack number of samples
     mixPacket->writePrimitive(AudioConstants::NETWORK_FRAME_SAMPLES_STEREO);
 
+    auto parityPacket = data.getFECEncoder().addPacket(*mixPacket);
+
     // send packet
-    DependencyManager::get<NodeList>()->sendPacket(std::move(mixPacket), *node);
+    auto nodeList = DependencyManager::get<NodeList>();
+    nodeList->sendPacket(std::move(mixPacket), *node);
+    if (parityPacket) {
+        nodeList->sendPacket(std::move(parityPacket), *node);
+    }
     data.incrementOutgoingMixedAudioSequenceNumber();
 }
 
@@ -650,21 +856,14 @@ void sendEnvironmentPacket(const SharedNodePointer& node, AudioMixerClientData&
     bool hasReverb = false;
     float reverbTime, wetLevel;
 
-    auto& reverbSettings = AudioMixer::getReverbSettings();
-    auto& audioZones = AudioMixer::getAudioZones();
-
     AvatarAudioStream* stream = data.getAvatarAudioStream();
-    glm::vec3 streamPosition = stream->getPosition();
 
     // find reverb properties
-    for (const auto& settings : reverbSettings) {
-        AABox box = audioZones[settings.zone].area;
-        if (box.contains(streamPosition)) {
-            hasReverb = true;
-            reverbTime = settings.reverbTime;
-            wetLevel = settings.wetLevel;
-            break;
-        }
+    auto settings = AudioMixer::findReverbSettings(stream->getAudioZones());
+    if (settings) {
+        hasReverb = true;
+        reverbTime = settings->reverbTime;
+        wetLevel = settings->wetLevel;
     }
 
     // check if data changed
@@ -758,17 +957,11 @@ float computeGain(float masterAvatarGain,
         gain *= masterAvatarGain;
     }
 
-    auto& audioZones = AudioMixer::getAudioZones();
-    auto& zoneSettings = AudioMixer::getZoneSettings();
-
     // find distance attenuation coefficient
     float attenuationPerDoublingInDistance = AudioMixer::getAttenuationPerDoublingInDistance();
-    for (const auto& settings : zoneSettings) {
-        if (audioZones[settings.source].area.contains(streamToAdd.getPosition()) &&
-            audioZones[settings.listener].area.contains(listeningNodeStream.getPosition())) {
-            attenuationPerDoublingInDistance = settings.coefficient;
-            break;
-        }
+    auto settings = AudioMixer::findZoneSettings(streamToAdd.getAudioZones(), listeningNodeStream.getAudioZones());
+    if (settings) {
+        attenuationPerDoublingInDistance = settings->coefficient;
     }
 
     if (attenuationPerDoublingInDistance < 0.0f) {
@@ -26,6 +26,8 @@
 #include <PositionalAudioStream.h>
 
 #include "AudioMixerClientData.h"
+#include "AudioMixerHRTFCache.h"
+#include "AudioMixerOffloadCache.h"
 #include "AudioMixerStats.h"
 
 class AvatarAudioStream;
@@ -39,6 +41,8 @@ public:
         AudioMixerClientData::ConcurrentAddedStreams addedStreams;
         std::vector<Node::LocalID> removedNodes;
         std::vector<NodeIDStreamID> removedStreams;
+        AudioMixerHRTFCache hrtfCache;
+        AudioMixerOffloadCache offloadCache;
     };
 
     AudioMixerSlave(SharedData& sharedData) : _sharedData(sharedData) {};
@@ -69,12 +73,30 @@ private:
                               float masterInjectorGain);
     void resetHRTFState(AudioMixerClientData::MixableStream& mixableStream);
 
+    // renders a mono source through the listener's own HRTF, or the shared one for its bucket when enabled
+    void renderHRTF(AudioMixerClientData::MixableStream& mixableStream, const int16_t* input,
+                    float azimuth, float distance, float gain);
+
+    // picks the listener's loudest mono sources to send alongside its mix instead of in it, and gives them their slots
+    void selectOffloadedStreams(AudioMixerClientData& listenerData, const AvatarAudioStream& listenerAudioStream);
+
+    // adds the source's frame to the listener's offloaded sources, returns false if the packet has no room left for it
+    bool offloadStream(AudioMixerClientData::MixableStream& mixableStream, const glm::vec3& relativePosition, float gain);
+
     void addStreams(Node& listener, AudioMixerClientData& listenerData);
 
     // mixing buffers
     float _mixSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
     int16_t _bufferSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
 
+    // offloaded sources for the listener being mixed
+    std::vector<AudioMixerClientData::MixableStream*> _offloadCandidates;
+    CodecPluginPointer _offloadCodec;
+    QString _offloadCodecName;
+    QByteArray _offloadedSources;
+    int _numOffloadedSources { 0 };
+    int _offloadBudget { 0 };
+
     // frame state
     ConstIter _begin;
     ConstIter _end;
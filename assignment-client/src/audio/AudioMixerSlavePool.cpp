@@ -15,21 +15,69 @@
 
 #include <assert.h>
 #include <algorithm>
+#include <chrono>
+#include <thread>
 
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#include <emmintrin.h>
+#endif
+
+#include <FrameTrace.h>
+#include <NodeList.h>
+#include <SharedUtil.h>
 #include <ThreadHelpers.h>
 
+// how long slaves (and the pool) spin waiting for the next job (or for the slaves) before they park
+static const std::chrono::microseconds SPIN_DURATION { 200 };
+static const int SPINS_PER_CLOCK_CHECK = 64;
+
+static inline void spinPause() {
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+    _mm_pause();
+#else
+    std::this_thread::yield();
+#endif
+}
+
+// spins until done() or SPIN_DURATION has passed, returns done()
+template <typename Predicate>
+static bool spinUntil(Predicate done) {
+    auto spinEnd = std::chrono::steady_clock::now() + SPIN_DURATION;
+    while (!done()) {
+        for (int i = 0; i < SPINS_PER_CLOCK_CHECK; ++i) {
+            spinPause();
+        }
+        if (std::chrono::steady_clock::now() > spinEnd) {
+            return done();
+        }
+    }
+    return true;
+}
+
 void AudioMixerSlaveThread::run() {
     while (true) {
         wait();
 
-        // iterate over all available nodes
-        SharedNodePointer node;
-        while (try_pop(node)) {
-            (this->*_function)(node);
+        auto start = usecTimestampNow();
+        stats.dispatchTime += start - _pool._dispatchTime;
+
+        {
+            FRAME_TRACE_RANGE("AudioMixerSlaveThread::run");
+
+            // gather the packets sent to every node we handle into batched writes
+            auto batchedWrites = DependencyManager::get<NodeList>()->batchWrites();
+
+            // iterate over all available nodes
+            int nodeIndex;
+            while (try_pop(nodeIndex)) {
+                (this->*_function)(_pool._begin[nodeIndex]);
+            }
         }
 
+        stats.workTime += usecTimestampNow() - start;
+
         bool stopping = _stop;
-        notify(stopping);
+        notify();
         if (stopping) {
             return;
         }
@@ -37,14 +85,18 @@ void AudioMixerSlaveThread::run() {
 }
 
 void AudioMixerSlaveThread::wait() {
-    {
+    uint32_t nextJob = _job + 1;
+    auto isJobReady = [&] {
+        return _pool._job.load(std::memory_order_acquire) == nextJob;
+    };
+
+    if (!spinUntil(isJobReady)) {
         Lock lock(_pool._mutex);
-        _pool._slaveCondition.wait(lock, [&] {
-            assert(_pool._numStarted <= _pool._numThreads);
-            return _pool._numStarted != _pool._numThreads;
-        });
-        ++_pool._numStarted;
+        ++_pool._numParked;
+        _pool._slaveCondition.wait(lock, isJobReady);
+        --_pool._numParked;
     }
+    _job = nextJob;
 
     if (_pool._configure) {
         _pool._configure(*this);
@@ -52,20 +104,29 @@ void AudioMixerSlaveThread::wait() {
     _function = _pool._function;
 }
 
-void AudioMixerSlaveThread::notify(bool stopping) {
-    {
+void AudioMixerSlaveThread::notify() {
+    int numFinished = _pool._numFinished.fetch_add(1) + 1;
+    assert(numFinished <= _pool._numThreads);
+
+    if (numFinished == _pool._numThreads && _pool._isPoolParked.load()) {
         Lock lock(_pool._mutex);
-        assert(_pool._numFinished < _pool._numThreads);
-        ++_pool._numFinished;
-        if (stopping) {
-            ++_pool._numStopped;
-        }
+        _pool._poolCondition.notify_one();
     }
-    _pool._poolCondition.notify_one();
 }
 
-bool AudioMixerSlaveThread::try_pop(SharedNodePointer& node) {
-    return _pool._queue.try_pop(node);
+bool AudioMixerSlaveThread::try_pop(int& nodeIndex) {
+    // our own range first, then steal from the others
+    int numThreads = _pool._numThreads;
+    for (int i = 0; i < numThreads; ++i) {
+        auto& range = _pool._ranges[(_index + i) % numThreads];
+        if (range.next.load(std::memory_order_relaxed) < range.end) {
+            nodeIndex = range.next.fetch_add(1, std::memory_order_relaxed);
+            if (nodeIndex < range.end) {
+                return true;
+            }
+        }
+    }
+    return false;
 }
 
 void AudioMixerSlavePool::processPackets(ConstIter begin, ConstIter end) {
@@ -87,28 +148,38 @@ void AudioMixerSlavePool::run(ConstIter begin, ConstIter end) {
     _begin = begin;
     _end = end;
 
-    // fill the queue
-    std::for_each(_begin, _end, [&](const SharedNodePointer& node) {
-        _queue.push(node);
-    });
+    // give each slave an even share of the nodes
+    int numNodes = (int)std::distance(_begin, _end);
+    for (int i = 0; i < _numThreads; ++i) {
+        _ranges[i].next.store(numNodes * i / _numThreads, std::memory_order_relaxed);
+        _ranges[i].end = numNodes * (i + 1) / _numThreads;
+    }
 
-    {
-        Lock lock(_mutex);
+    dispatch();
+}
+
+void AudioMixerSlavePool::dispatch() {
+    _numFinished.store(0, std::memory_order_relaxed);
+    _dispatchTime = usecTimestampNow();
 
-        // run
-        _numStarted = _numFinished = 0;
+    // publish the job, then wake whoever has parked
+    // (a slave counts itself as parked before it checks for a job, so it can't miss this)
+    _job.fetch_add(1);
+    if (_numParked.load() > 0) {
+        Lock lock(_mutex);
         _slaveCondition.notify_all();
+    }
 
-        // wait
-        _poolCondition.wait(lock, [&] {
-            assert(_numFinished <= _numThreads);
-            return _numFinished == _numThreads;
-        });
+    auto isJobFinished = [&] {
+        return _numFinished.load(std::memory_order_acquire) == _numThreads;
+    };
 
-        assert(_numStarted == _numThreads);
+    if (!spinUntil(isJobFinished)) {
+        Lock lock(_mutex);
+        _isPoolParked = true;
+        _poolCondition.wait(lock, isJobFinished);
+        _isPoolParked = false;
     }
-
-    assert(_queue.empty());
 }
 
 void AudioMixerSlavePool::each(std::function<void(AudioMixerSlave& slave)> functor) {
@@ -155,12 +226,10 @@ void AudioMixerSlavePool::resize(int numThreads) {
 
     qDebug("%s: set %d threads (was %d)", __FUNCTION__, numThreads, _numThreads);
 
-    Lock lock(_mutex);
-
     if (numThreads > _numThreads) {
-        // start new slaves
-        for (int i = 0; i < numThreads - _numThreads; ++i) {
-            auto slave = new AudioMixerSlaveThread(*this, _workerSharedData);
+        // start new slaves, they pick up from the current job
+        for (int i = _numThreads; i < numThreads; ++i) {
+            auto slave = new AudioMixerSlaveThread(*this, _workerSharedData, i, _job.load());
             QObject::connect(slave, &QThread::started, [] { setThreadName("AudioMixerSlaveThread"); });
             slave->start();
             _slaves.emplace_back(slave);
@@ -175,16 +244,13 @@ void AudioMixerSlavePool::resize(int numThreads) {
             ++slave;
         }
 
-        // ...cycle them until they do stop...
-        _numStopped = 0;
-        while (_numStopped != (_numThreads - numThreads)) {
-            _numStarted = _numFinished = _numStopped;
-            _slaveCondition.notify_all();
-            _poolCondition.wait(lock, [&] {
-                assert(_numFinished <= _numThreads);
-                return _numFinished == _numThreads;
-            });
+        // ...cycle them through an empty job so that they do stop...
+        _configure = nullptr;
+        for (int i = 0; i < _numThreads; ++i) {
+            _ranges[i].next.store(0, std::memory_order_relaxed);
+            _ranges[i].end = 0;
         }
+        dispatch();
 
         // ...wait for threads to finish...
         slave = extraBegin;
@@ -199,6 +265,7 @@ void AudioMixerSlavePool::resize(int numThreads) {
         _slaves.erase(extraBegin, _slaves.end());
     }
 
-    _numThreads = _numStarted = _numFinished = numThreads;
+    _numThreads = numThreads;
+    _ranges.reset(new Range[numThreads]);
     assert(_numThreads == (int)_slaves.size());
 }
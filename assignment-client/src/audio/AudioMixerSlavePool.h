@@ -12,13 +12,14 @@
 #ifndef hifi_AudioMixerSlavePool_h
 #define hifi_AudioMixerSlavePool_h
 
+#include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <vector>
 
 #include <QThread>
 #include <shared/QtHelpers.h>
-#include <TBBHelpers.h>
 
 #include "AudioMixerSlave.h"
 
@@ -31,8 +32,8 @@ class AudioMixerSlaveThread : public QThread, public AudioMixerSlave {
     using Lock = std::unique_lock<Mutex>;
 
 public:
-    AudioMixerSlaveThread(AudioMixerSlavePool& pool, AudioMixerSlave::SharedData& sharedData)
-        : AudioMixerSlave(sharedData), _pool(pool) {}
+    AudioMixerSlaveThread(AudioMixerSlavePool& pool, AudioMixerSlave::SharedData& sharedData, int index, uint32_t job)
+        : AudioMixerSlave(sharedData), _pool(pool), _index(index), _job(job) {}
 
     void run() override final;
 
@@ -40,18 +41,22 @@ private:
     friend class AudioMixerSlavePool;
 
     void wait();
-    void notify(bool stopping);
-    bool try_pop(SharedNodePointer& node);
+    void notify();
+    bool try_pop(int& nodeIndex);
 
     AudioMixerSlavePool& _pool;
     void (AudioMixerSlave::*_function)(const SharedNodePointer& node) { nullptr };
+    int _index; // the range of nodes this slave starts on
+    uint32_t _job; // the last job this slave ran
     bool _stop { false };
 };
 
 // Slave pool for audio mixers
 //   AudioMixerSlavePool is not thread-safe! It should be instantiated and used from a single thread.
+//
+// Each job splits the nodes into one contiguous range per slave; a slave that finishes its range steals from the others.
+// Between jobs slaves spin for a moment before they park, since processing packets and mixing follow each other closely.
 class AudioMixerSlavePool {
-    using Queue = tbb::concurrent_queue<SharedNodePointer>;
     using Mutex = std::mutex;
     using Lock = std::unique_lock<Mutex>;
     using ConditionVariable = std::condition_variable;
@@ -83,27 +88,39 @@ private:
     void run(ConstIter begin, ConstIter end);
     void resize(int numThreads);
 
+    // hands the current job to the slaves and waits until they have all finished it
+    void dispatch();
+
     std::vector<std::unique_ptr<AudioMixerSlaveThread>> _slaves;
 
     friend void AudioMixerSlaveThread::wait();
-    friend void AudioMixerSlaveThread::notify(bool stopping);
-    friend bool AudioMixerSlaveThread::try_pop(SharedNodePointer& node);
+    friend void AudioMixerSlaveThread::notify();
+    friend bool AudioMixerSlaveThread::try_pop(int& nodeIndex);
+
+    // the nodes of a slave's range that are still to be taken, padded so that slaves don't share cache lines
+    struct Range {
+        std::atomic<int> next { 0 };
+        int end { 0 };
+        char padding[64 - sizeof(std::atomic<int>) - sizeof(int)];
+    };
 
     // synchronization state
     Mutex _mutex;
     ConditionVariable _slaveCondition;
     ConditionVariable _poolCondition;
-    void (AudioMixerSlave::*_function)(const SharedNodePointer& node);
+    std::atomic<uint32_t> _job { 0 };
+    std::atomic<int> _numParked { 0 };
+    std::atomic<int> _numFinished { 0 };
+    std::atomic<bool> _isPoolParked { false };
+    void (AudioMixerSlave::*_function)(const SharedNodePointer& node) { nullptr };
     std::function<void(AudioMixerSlave&)> _configure;
     int _numThreads { 0 };
-    int _numStarted { 0 }; // guarded by _mutex
-    int _numFinished { 0 }; // guarded by _mutex
-    int _numStopped { 0 }; // guarded by _mutex
 
     // frame state
-    Queue _queue;
+    std::unique_ptr<Range[]> _ranges;
     ConstIter _begin;
     ConstIter _end;
+    quint64 _dispatchTime { 0 };
 
     AudioMixerSlave::SharedData& _workerSharedData;
 };
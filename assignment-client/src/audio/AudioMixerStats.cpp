@@ -21,6 +21,10 @@ void AudioMixerStats::reset() {
     hrtfRenders = 0;
     hrtfResets = 0;
     hrtfUpdates = 0;
+    hrtfSharedRenders = 0;
+    offloadedSources = 0;
+    offloadEncodes = 0;
+    subMixesSent = 0;
 
     manualStereoMixes = 0;
     manualEchoMixes = 0;
@@ -36,6 +40,9 @@ void AudioMixerStats::reset() {
     inactive = 0;
     active = 0;
 
+    dispatchTime = 0;
+    workTime = 0;
+
 #ifdef HIFI_AUDIO_MIXER_DEBUG
     mixTime = 0;
 #endif
@@ -51,6 +58,10 @@ void AudioMixerStats::accumulate(const AudioMixerStats& otherStats) {
     hrtfRenders += otherStats.hrtfRenders;
     hrtfResets += otherStats.hrtfResets;
     hrtfUpdates += otherStats.hrtfUpdates;
+    hrtfSharedRenders += otherStats.hrtfSharedRenders;
+    offloadedSources += otherStats.offloadedSources;
+    offloadEncodes += otherStats.offloadEncodes;
+    subMixesSent += otherStats.subMixesSent;
 
     manualStereoMixes += otherStats.manualStereoMixes;
     manualEchoMixes += otherStats.manualEchoMixes;
@@ -66,6 +77,9 @@ void AudioMixerStats::accumulate(const AudioMixerStats& otherStats) {
     inactive += otherStats.inactive;
     active += otherStats.active;
 
+    dispatchTime += otherStats.dispatchTime;
+    workTime += otherStats.workTime;
+
 #ifdef HIFI_AUDIO_MIXER_DEBUG
     mixTime += otherStats.mixTime;
 #endif
@@ -12,9 +12,7 @@
 #ifndef hifi_AudioMixerStats_h
 #define hifi_AudioMixerStats_h
 
-#ifdef HIFI_AUDIO_MIXER_DEBUG
 #include <cstdint>
-#endif
 
 struct AudioMixerStats {
     int sumStreams { 0 };
@@ -26,6 +24,12 @@ struct AudioMixerStats {
     int hrtfRenders { 0 };
     int hrtfResets { 0 };
     int hrtfUpdates { 0 };
+    int hrtfSharedRenders { 0 };
+
+    int offloadedSources { 0 };
+    int offloadEncodes { 0 };
+
+    int subMixesSent { 0 };
 
     int manualStereoMixes { 0 };
     int manualEchoMixes { 0 };
@@ -41,6 +45,10 @@ struct AudioMixerStats {
     int inactive { 0 };
     int active { 0 };
 
+    // usecs slaves spent waking up for jobs, and working on them
+    uint64_t dispatchTime { 0 };
+    uint64_t workTime { 0 };
+
 #ifdef HIFI_AUDIO_MIXER_DEBUG
     uint64_t mixTime { 0 };
 #endif
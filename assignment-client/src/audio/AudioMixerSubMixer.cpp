@@ -0,0 +1,171 @@
+//
+//  AudioMixerSubMixer.cpp
+//  assignment-client/src/audio
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioMixerSubMixer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <QtCore/QDataStream>
+
+#include <glm/gtc/quaternion.hpp>
+
+#include <AudioHelpers.h>
+#include <udt/PacketHeaders.h>
+
+#include "AudioMixerClientData.h"
+
+// cell coordinates are packed into 21 bits each
+static const int CELL_COORDINATE_BITS = 21;
+static const int CELL_COORDINATE_MAX = (1 << (CELL_COORDINATE_BITS - 1)) - 1;
+
+void AudioMixerSubMixer::setCellSize(float cellSize) {
+    _cellSize = std::max(cellSize, 0.0f);
+    _cells.clear();
+}
+
+AudioMixerSubMixer::CellKey AudioMixerSubMixer::getCellKey(const glm::vec3& position) const {
+    CellKey key = 0;
+    for (int i = 0; i < 3; i++) {
+        float coordinate = std::floor(position[i] / _cellSize);
+        int cell = (int)std::max(std::min(coordinate, (float)CELL_COORDINATE_MAX), (float)-CELL_COORDINATE_MAX);
+        key = (key << CELL_COORDINATE_BITS) | ((CellKey)cell & ((1 << CELL_COORDINATE_BITS) - 1));
+    }
+    return key;
+}
+
+int AudioMixerSubMixer::mixAndSend(NodeList& nodeList) {
+    if (!isEnabled()) {
+        return 0;
+    }
+
+    // every cell is a stream that is sent at most once a frame, so a single sequence number is shared by all of them
+    // and the frames a cell was empty for look like losses downstream
+    quint16 sequence = _sequence++;
+
+    for (auto& cell : _cells) {
+        cell.second.numSources = 0;
+    }
+
+    std::vector<SharedNodePointer> downstreamNodes;
+    nodeList.eachNode([&](const SharedNodePointer& node) {
+        if (node->getType() == NodeType::DownstreamAudioMixer) {
+            downstreamNodes.push_back(node);
+        }
+
+        // only our own replicated agents, what we got from upstream mixers is already replicated as is
+        auto clientData = static_cast<AudioMixerClientData*>(node->getLinkedData());
+        if (!clientData || node->getType() != NodeType::Agent || !node->isReplicated() || node->isUpstream()) {
+            return;
+        }
+
+        for (auto& stream : clientData->getAudioStreams()) {
+            if (!stream->lastPopSucceeded()) {
+                continue;
+            }
+
+            CellKey key = getCellKey(stream->getPosition());
+            auto cellIt = _cells.find(key);
+            if (cellIt == _cells.end()) {
+                cellIt = _cells.emplace(key, Cell()).first;
+            }
+
+            Cell& cell = cellIt->second;
+            if (cell.numSources == 0) {
+                cell.positionSum = glm::vec3(0.0f);
+                cell.weightedPositionSum = glm::vec3(0.0f);
+                cell.weightSum = 0.0f;
+                std::fill(std::begin(cell.mix), std::end(cell.mix), 0.0f);
+            }
+
+            float loudness = stream->getLastPopOutputTrailingLoudness();
+            cell.positionSum += stream->getPosition();
+            cell.weightedPositionSum += loudness * stream->getPosition();
+            cell.weightSum += loudness;
+            ++cell.numSources;
+
+            const int16_t* frame = stream->getLastPopFrame();
+            if (stream->isStereo()) {
+                for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL; i++) {
+                    cell.mix[i] += 0.5f * ((float)frame[2*i+0] + (float)frame[2*i+1]);
+                }
+            } else {
+                for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL; i++) {
+                    cell.mix[i] += (float)frame[i];
+                }
+            }
+        }
+    });
+
+    // downstream, our sub-mixes are the injectors of a replicated agent with an ID derived from ours
+    // (our own ID is already taken there by the node for this mixer)
+    QUuid sessionID = nodeList.getSessionUUID();
+    QUuid subMixNodeID = QUuid::createUuidV5(sessionID, QByteArray("sub-mix"));
+    int numSent = 0;
+
+    for (auto cellIt = _cells.begin(); cellIt != _cells.end();) {
+        Cell& cell = cellIt->second;
+        if (cell.numSources == 0) {
+            cellIt = _cells.erase(cellIt);
+            continue;
+        }
+
+        CellKey key = cellIt->first;
+        ++cellIt;
+
+        if (downstreamNodes.empty() || sessionID.isNull()) {
+            continue;
+        }
+
+        if (cell.streamID.isNull()) {
+            // the same cell is always the same injector downstream
+            cell.streamID = QUuid::createUuidV5(subMixNodeID, QByteArray((const char*)&key, sizeof(key)));
+        }
+
+        glm::vec3 position = (cell.weightSum > 0.0f) ? cell.weightedPositionSum / cell.weightSum
+                                                     : cell.positionSum / (float)cell.numSources;
+        glm::quat orientation(1.0f, 0.0f, 0.0f, 0.0f);
+        glm::vec3 zero(0.0f);
+
+        // laid out like an AudioInjector's InjectAudio packet, prefixed with the node ID like any replicated packet
+        auto packet = NLPacket::create(PacketType::ReplicatedInjectAudio);
+        packet->write(subMixNodeID.toRfc4122());
+        packet->writePrimitive(sequence);
+
+        QDataStream packetStream(packet.get());
+        packetStream << (quint32)0;                     // no codec
+        packetStream.writeRawData(cell.streamID.toRfc4122().constData(), NUM_BYTES_RFC4122_UUID);
+        packetStream << false;                          // mono
+        packetStream << (uchar)0;                       // no loopback
+        packetStream.writeRawData(reinterpret_cast<const char*>(&position), sizeof(position));
+        packetStream.writeRawData(reinterpret_cast<const char*>(&orientation), sizeof(orientation));
+        packetStream.writeRawData(reinterpret_cast<const char*>(&position), sizeof(position));
+        packetStream.writeRawData(reinterpret_cast<const char*>(&zero), sizeof(zero));
+        packetStream << 0.0f;                           // point source
+        packetStream << packFloatGainToByte(1.0f);
+        packetStream << false;                          // don't ignore penumbra
+
+        int16_t samples[AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL];
+        for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL; i++) {
+            samples[i] = (int16_t)std::max(std::min(std::lround(cell.mix[i]), (long)INT16_MAX), (long)INT16_MIN);
+        }
+        packet->write(reinterpret_cast<const char*>(samples), AudioConstants::NETWORK_FRAME_BYTES_PER_CHANNEL);
+
+        for (auto& downstreamNode : downstreamNodes) {
+            nodeList.sendUnreliablePacket(*packet, *downstreamNode);
+        }
+
+        ++numSent;
+    }
+
+    return numSent;
+}
@@ -0,0 +1,63 @@
+//
+//  AudioMixerSubMixer.h
+//  assignment-client/src/audio
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_AudioMixerSubMixer_h
+#define vircadia_AudioMixerSubMixer_h
+
+#include <cstdint>
+#include <unordered_map>
+
+#include <glm/glm.hpp>
+
+#include <QtCore/QUuid>
+
+#include <AudioConstants.h>
+#include <NodeList.h>
+
+// Replicates the sources of this mixer to its downstream mixers as spatially bucketed sub-mixes.
+//
+// Instead of forwarding every replicated microphone and injector stream, the sources are put in cubic cells and
+// each occupied cell is mixed to a single mono stream, placed at the loudness weighted centroid of its sources.
+// The sub-mixes go out as replicated injectors from this mixer's session, so the downstream mixers spatialize,
+// attenuate and zone them like any other injector, and a downstream mixer costs one stream per occupied cell
+// instead of one per source.
+//
+// Only runs on the mixer thread, after the frame's packets have been processed and before the mix.
+class AudioMixerSubMixer {
+public:
+    void setCellSize(float cellSize);
+    float getCellSize() const { return _cellSize; }
+    bool isEnabled() const { return _cellSize > 0.0f; }
+
+    // returns the number of sub-mixes sent
+    int mixAndSend(NodeList& nodeList);
+
+private:
+    using CellKey = uint64_t;
+
+    struct Cell {
+        QUuid streamID;
+        quint16 sequence { 0 };
+
+        glm::vec3 positionSum;
+        glm::vec3 weightedPositionSum;
+        float weightSum;
+        int numSources;
+        float mix[AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL];
+    };
+
+    CellKey getCellKey(const glm::vec3& position) const;
+
+    float _cellSize { 0.0f };
+    quint16 _sequence { 0 };
+    std::unordered_map<CellKey, Cell> _cells;
+};
+
+#endif // vircadia_AudioMixerSubMixer_h
@@ -20,6 +20,7 @@
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDateTime>
+#include <QtCore/QJsonArray>
 #include <QtCore/QJsonObject>
 #include <QtCore/QRegularExpression>
 #include <QtCore/QTimer>
@@ -335,6 +336,8 @@ void AvatarMixer::start() {
             auto start = usecTimestampNow();
             nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
                 auto start = usecTimestampNow();
+                _slaveSharedData.grid.rebuild(cbegin, cend);
+                ++_slaveSharedData.broadcastFrame;
                 _slavePool.broadcastAvatarData(cbegin, cend, _lastFrameTimestamp, _maxKbpsPerNode, _throttlingRatio);
                 auto end = usecTimestampNow();
                 _broadcastAvatarDataInner += (end - start);
@@ -470,6 +473,7 @@ void AvatarMixer::throttle(std::chrono::microseconds duration, int frame) {
     const float CURRENT_FRAME_RATIO = 1.0f / TRAILING_FRAMES;
     const float PREVIOUS_FRAMES_RATIO = 1.0f - CURRENT_FRAME_RATIO;
     _trailingMixRatio = PREVIOUS_FRAMES_RATIO * _trailingMixRatio + CURRENT_FRAME_RATIO * mixRatio;
+    setLoad(std::min(_trailingMixRatio, 1.0f));
 
     if (frame % TRAILING_FRAMES == 0) {
         if (_trailingMixRatio > TARGET) {
@@ -852,12 +856,19 @@ void AvatarMixer::sendStatsPacket() {
     slavesAggregatObject["sent_6_averageIdentityBytes"] = TIGHT_LOOP_STAT(aggregateStats.numIdentityBytesSent);
     slavesAggregatObject["sent_7_averageHeroAvatars"] = TIGHT_LOOP_STAT(aggregateStats.numHeroesIncluded);
 
+    float averageCandidates = averageNodes ? aggregateStats.numCandidates / averageNodes : 0.0f;
+    slavesAggregatObject["sent_8_averageCandidates"] = TIGHT_LOOP_STAT(averageCandidates);
+    slavesAggregatObject["sent_9_averageSharedEncodes"] = TIGHT_LOOP_STAT(aggregateStats.numSharedEncodes);
+    slavesAggregatObject["sent_10_averageLODTierHeldBack"] = TIGHT_LOOP_STAT(aggregateStats.numLODTierHeldBack);
+    slavesAggregatObject["sent_11_averageTraitsHeldBack"] = TIGHT_LOOP_STAT(aggregateStats.numTraitsHeldBack);
+
     slavesAggregatObject["timing_1_processIncomingPackets"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.processIncomingPacketsElapsedTime);
     slavesAggregatObject["timing_2_ignoreCalculation"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.ignoreCalculationElapsedTime);
     slavesAggregatObject["timing_3_toByteArray"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.toByteArrayElapsedTime);
     slavesAggregatObject["timing_4_avatarDataPacking"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.avatarDataPackingElapsedTime);
     slavesAggregatObject["timing_5_packetSending"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.packetSendingElapsedTime);
     slavesAggregatObject["timing_6_jobElapsedTime"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.jobElapsedTime);
+    slavesAggregatObject["timing_7_prioritization"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.prioritizationElapsedTime);
 
     statsObject["slaves_aggregate (per frame)"] = slavesAggregatObject;
 
@@ -1042,6 +1053,38 @@ void AvatarMixer::parseDomainServerSettings(const QJsonObject& domainSettings) {
         }
     }
 
+    {   // Size of the grid cells used to pick which avatars each node considers (0 considers them all):
+        static const QString GRID_CELL_SIZE_KEY = "grid_cell_size";
+        float gridCellSize = float(avatarMixerGroupObject[GRID_CELL_SIZE_KEY].toDouble(0.0));
+        _slaveSharedData.grid.setCellSize(gridCellSize);
+        if (_slaveSharedData.grid.isEnabled()) {
+            qCDebug(avatars) << "Avatar mixer considering nearby avatars in cells of" << gridCellSize << "m";
+        }
+    }
+
+    {   // Distances (in meters) beyond which avatars are sent at the reduced mid-range and far rates:
+        static const QString LOD_NEAR_DISTANCE_KEY = "lod_near_distance";
+        static const QString LOD_FAR_DISTANCE_KEY = "lod_far_distance";
+        float nearDistance = float(avatarMixerGroupObject[LOD_NEAR_DISTANCE_KEY].toDouble(0.0));
+        float farDistance = float(avatarMixerGroupObject[LOD_FAR_DISTANCE_KEY].toDouble(0.0));
+        _slaveSharedData.lodNearDistance = std::max(nearDistance, 0.0f);
+        _slaveSharedData.lodFarDistance = std::max(farDistance, _slaveSharedData.lodNearDistance);
+        if (_slaveSharedData.lodNearDistance > 0.0f) {
+            qCDebug(avatars) << "Avatar mixer reducing update rates beyond" << _slaveSharedData.lodNearDistance
+                << "m and" << _slaveSharedData.lodFarDistance << "m";
+        }
+    }
+
+    {   // Bandwidth (in kbps) for the traits sent to each node, so that a burst of joins doesn't stall the mixer (0 is unlimited):
+        static const QString NODE_TRAITS_BANDWIDTH_KEY = "max_node_traits_bandwidth";
+        float traitsKbps = float(avatarMixerGroupObject[NODE_TRAITS_BANDWIDTH_KEY].toDouble(0.0));
+        _slaveSharedData.maxTraitBytesPerFrame =
+            std::max(int(traitsKbps * BYTES_PER_KILOBIT / AVATAR_MIXER_BROADCAST_FRAMES_PER_SECOND), 0);
+        if (_slaveSharedData.maxTraitBytesPerFrame > 0) {
+            qCDebug(avatars) << "Avatar mixer sending at most" << traitsKbps << "kbps of traits per node";
+        }
+    }
+
     const QString AVATARS_SETTINGS_KEY = "avatars";
 
     static const QString MIN_HEIGHT_OPTION = "min_avatar_height";
@@ -1100,6 +1143,11 @@ void AvatarMixer::setupEntityQuery() {
     priorityZoneQuery["flags"] = queryFlags;
     priorityZoneQuery["name"] = true; // Handy for debugging.
 
+    // only the zones' shapes and priorities are used, so skip the scripting data of them and their relatives
+    QJsonObject excludedProperties;
+    excludedProperties["*"] = QJsonArray({ "userData", "privateUserData", "script", "serverScripts", "actionData" });
+    priorityZoneQuery["excludedProperties"] = excludedProperties;
+
     _entityViewer.getOctreeQuery().setJSONParameters(priorityZoneQuery);
     _slaveSharedData.entityTree = entityTree;
 }
@@ -1114,7 +1162,7 @@ void AvatarMixer::handleOctreePacket(QSharedPointer<ReceivedMessage> message, Sh
         const auto piggyBackedSizeWithHeader = message->getBytesLeftToRead();
         if (piggyBackedSizeWithHeader > 0) {
             // pull out the piggybacked packet and create a new QSharedPointer<NLPacket> for it
-            auto buffer = std::unique_ptr<char[]>(new char[piggyBackedSizeWithHeader]);
+            auto buffer = udt::PacketBufferPool::allocate(piggyBackedSizeWithHeader);
             memcpy(buffer.get(), message->getRawMessage() + message->getPosition(), piggyBackedSizeWithHeader);
 
             auto newPacket = NLPacket::fromReceivedPacket(std::move(buffer), piggyBackedSizeWithHeader, message->getSenderSockAddr());
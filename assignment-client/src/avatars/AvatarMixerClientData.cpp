@@ -264,6 +264,7 @@ void AvatarMixerClientData::processSetTraitsMessage(ReceivedMessage& message,
                         _avatar->processDeletedTraitInstance(traitType, instanceID);
                         // Mixer doesn't need deleted IDs.
                         _avatar->getAndClearRecentlyRemovedIDs();
+                        erasePackedTraitInstance(instanceID);
 
                         // to track a deleted instance but keep version information
                         // the avatar mixer uses the negative value of the sent version
@@ -307,6 +308,7 @@ void AvatarMixerClientData::emulateDeleteEntitiesTraitsMessage(const QList<QUuid
         _avatar->processDeletedTraitInstance(traitType, entityID);
         // Mixer doesn't need deleted IDs.
         _avatar->getAndClearRecentlyRemovedIDs();
+        erasePackedTraitInstance(entityID);
 
         // to track a deleted instance but keep version information
         // the avatar mixer uses the negative value of the sent version
@@ -428,6 +430,74 @@ uint64_t AvatarMixerClientData::getLastBroadcastTime(NLPacket::LocalID nodeUUID)
     return 0;
 }
 
+AvatarMixerClientData::SharedAvatarData AvatarMixerClientData::getSharedAvatarData(unsigned int frame,
+        AvatarData::AvatarDataDetail detail, AvatarDataPacket::HasFlags wantedFlags) const {
+    assert(isShareableDetail(detail));
+    std::lock_guard<std::mutex> lock(_sharedAvatarDataMutex);
+
+    if (frame != _sharedAvatarDataFrame) {
+        _sharedAvatarData.clear();
+        _sharedAvatarDataFrame = frame;
+    }
+
+    uint32_t key = ((uint32_t)detail << (8 * sizeof(AvatarDataPacket::HasFlags))) | wantedFlags;
+    auto it = _sharedAvatarData.find(key);
+    if (it == _sharedAvatarData.end()) {
+        SharedAvatarData sharedData;
+
+        // the SendAllData joints don't depend on what was sent before, but toByteArray still reads it
+        sharedData.sentJoints = _avatar->getRawJointData();
+
+        // force the wanted sections through sendStatus, toByteArray then ignores lastSentTime
+        AvatarDataPacket::SendStatus sendStatus;
+        sendStatus.sendUUID = true;
+        sendStatus.itemFlags = wantedFlags;
+        sendStatus.sendJointRotationDeltas = true;
+        sendStatus.jointSequence = getJointSequence(frame);
+        sharedData.bytes = _avatar->toByteArray(detail, 0, sharedData.sentJoints, sendStatus, false, false, glm::vec3(0.0f),
+                                                &sharedData.sentJoints);
+
+        it = _sharedAvatarData.emplace(key, std::move(sharedData)).first;
+    }
+    return it->second;
+}
+
+QByteArray AvatarMixerClientData::getIdentityData(unsigned int frame) const {
+    std::lock_guard<std::mutex> lock(_packedTraitsMutex);
+    if (frame != _identityDataFrame || _identityData.isNull()) {
+        _identityData = _avatar->identityByteArray();
+        _identityData.replace(0, NUM_BYTES_RFC4122_UUID, getNodeID().toRfc4122()); // FIXME, this looks suspicious
+        _identityDataFrame = frame;
+    }
+    return _identityData;
+}
+
+QByteArray AvatarMixerClientData::getPackedTrait(AvatarTraits::TraitType traitType,
+                                                 AvatarTraits::TraitVersion traitVersion) const {
+    std::lock_guard<std::mutex> lock(_packedTraitsMutex);
+    auto& packedTrait = _packedTraits[traitType];
+    if (packedTrait.data.isNull() || packedTrait.version != traitVersion) {
+        packedTrait = { traitType, traitVersion, _avatar->packTrait(traitType) };
+    }
+    return packedTrait.data;
+}
+
+QByteArray AvatarMixerClientData::getPackedTraitInstance(AvatarTraits::TraitType traitType,
+                                                         AvatarTraits::TraitInstanceID instanceID,
+                                                         AvatarTraits::TraitVersion traitVersion) const {
+    std::lock_guard<std::mutex> lock(_packedTraitsMutex);
+    auto& packedTrait = _packedTraitInstances[instanceID];
+    if (packedTrait.data.isNull() || packedTrait.traitType != traitType || packedTrait.version != traitVersion) {
+        packedTrait = { traitType, traitVersion, _avatar->packTraitInstance(traitType, instanceID) };
+    }
+    return packedTrait.data;
+}
+
+void AvatarMixerClientData::erasePackedTraitInstance(AvatarTraits::TraitInstanceID instanceID) {
+    std::lock_guard<std::mutex> lock(_packedTraitsMutex);
+    _packedTraitInstances.erase(instanceID);
+}
+
 uint16_t AvatarMixerClientData::getLastBroadcastSequenceNumber(NLPacket::LocalID nodeID) const {
     // return the matching PacketSequenceNumber, or the default if we don't have it
     auto nodeMatch = _lastBroadcastSequenceNumbers.find(nodeID);
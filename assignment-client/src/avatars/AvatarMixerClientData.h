@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <cfloat>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 #include <queue>
@@ -53,6 +54,28 @@ public:
     const MixerAvatar* getConstAvatarData() const { return _avatar.get(); }
     MixerAvatarSharedPointer getAvatarSharedPointer() const { return _avatar; }
 
+    // An encoding of our avatar that doesn't depend on who receives it, along with the joints it sent.
+    // PALMinimum, MinimumData and SendAllData only depend on the receiver through which sections they want,
+    // so the first slave to need one in a broadcast frame encodes it and the others copy it.
+    struct SharedAvatarData {
+        QByteArray bytes;
+        QVector<JointData> sentJoints;
+    };
+    static bool isShareableDetail(AvatarData::AvatarDataDetail detail) {
+        return detail == AvatarData::PALMinimum || detail == AvatarData::MinimumData || detail == AvatarData::SendAllData;
+    }
+    // thread-safe, called from the slaves while broadcasting
+    SharedAvatarData getSharedAvatarData(unsigned int frame, AvatarData::AvatarDataDetail detail,
+                                         AvatarDataPacket::HasFlags wantedFlags) const;
+
+    // Our identity and trait data, packed once and shared by every destination: the identity once per broadcast frame
+    // and the traits once per version.
+    // thread-safe, called from the slaves while broadcasting
+    QByteArray getIdentityData(unsigned int frame) const;
+    QByteArray getPackedTrait(AvatarTraits::TraitType traitType, AvatarTraits::TraitVersion traitVersion) const;
+    QByteArray getPackedTraitInstance(AvatarTraits::TraitType traitType, AvatarTraits::TraitInstanceID instanceID,
+                                      AvatarTraits::TraitVersion traitVersion) const;
+
     uint16_t getLastBroadcastSequenceNumber(NLPacket::LocalID nodeID) const;
     void setLastBroadcastSequenceNumber(NLPacket::LocalID nodeID, uint16_t sequenceNumber)
         { _lastBroadcastSequenceNumbers[nodeID] = sequenceNumber; }
@@ -129,6 +152,10 @@ public:
 
     QVector<JointData>& getLastOtherAvatarSentJoints(NLPacket::LocalID otherAvatar) { return _lastOtherAvatarSentJoints[otherAvatar]; }
 
+    // the joint sequence of the broadcast frame, the same for every destination so that shared encodings can carry it
+    static uint16_t getJointSequence(unsigned int frame) { return (uint16_t)(frame % AvatarDataPacket::JOINT_KEY_SEQUENCE); }
+    uint16_t& getLastOtherAvatarJointSequence(NLPacket::LocalID otherAvatar) { return _lastOtherAvatarJointSequences[otherAvatar]; }
+
     void queuePacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer node);
     int processPackets(const SlaveSharedData& slaveSharedData); // returns number of packets processed
 
@@ -168,6 +195,23 @@ private:
 
     MixerAvatarSharedPointer _avatar { new MixerAvatar() };
 
+    mutable std::mutex _sharedAvatarDataMutex;
+    mutable unsigned int _sharedAvatarDataFrame { 0 };
+    mutable std::unordered_map<uint32_t, SharedAvatarData> _sharedAvatarData;
+
+    struct PackedTrait {
+        AvatarTraits::TraitType traitType;
+        AvatarTraits::TraitVersion version;
+        QByteArray data;
+    };
+    void erasePackedTraitInstance(AvatarTraits::TraitInstanceID instanceID);
+
+    mutable std::mutex _packedTraitsMutex;
+    mutable unsigned int _identityDataFrame { 0 };
+    mutable QByteArray _identityData;
+    mutable std::unordered_map<int, PackedTrait> _packedTraits;
+    mutable std::unordered_map<AvatarTraits::TraitInstanceID, PackedTrait, UUIDHasher> _packedTraitInstances;
+
     uint16_t _lastReceivedSequenceNumber { 0 };
     std::unordered_map<NLPacket::LocalID, uint16_t> _lastBroadcastSequenceNumbers;
     std::unordered_map<NLPacket::LocalID, uint64_t> _lastBroadcastTimes;
@@ -176,6 +220,7 @@ private:
     // sending to "this" node
     std::unordered_map<NLPacket::LocalID, uint64_t> _lastOtherAvatarEncodeTime;
     std::unordered_map<NLPacket::LocalID, QVector<JointData>> _lastOtherAvatarSentJoints;
+    std::unordered_map<NLPacket::LocalID, uint16_t> _lastOtherAvatarJointSequences;
 
     uint64_t _identityChangeTimestamp;
     bool _avatarSessionDisplayNameMustChange{ true };
@@ -0,0 +1,92 @@
+//
+//  AvatarMixerGrid.cpp
+//  assignment-client/src/avatars
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AvatarMixerGrid.h"
+
+#include <cmath>
+
+#include "AvatarMixerClientData.h"
+
+// cell coordinates are packed into 21 bits each
+static const int CELL_COORDINATE_BITS = 21;
+static const int CELL_COORDINATE_MAX = (1 << (CELL_COORDINATE_BITS - 1)) - 1;
+
+glm::ivec3 AvatarMixerGrid::getCoordinates(const glm::vec3& position) const {
+    glm::vec3 coordinates = glm::floor(position / _cellSize);
+    coordinates = glm::clamp(coordinates, glm::vec3((float)-CELL_COORDINATE_MAX), glm::vec3((float)CELL_COORDINATE_MAX));
+    return glm::ivec3(coordinates);
+}
+
+AvatarMixerGrid::CellKey AvatarMixerGrid::getKey(const glm::ivec3& coordinates) {
+    const CellKey MASK = (1 << CELL_COORDINATE_BITS) - 1;
+    return (((CellKey)coordinates.x & MASK) << (2 * CELL_COORDINATE_BITS)) |
+           (((CellKey)coordinates.y & MASK) << CELL_COORDINATE_BITS) |
+           ((CellKey)coordinates.z & MASK);
+}
+
+void AvatarMixerGrid::rebuild(ConstIter begin, ConstIter end) {
+    _cells.clear();
+    _cellIndices.clear();
+    ++_frame;
+
+    if (!isEnabled()) {
+        return;
+    }
+
+    for (auto it = begin; it != end; ++it) {
+        const Node* node = it->data();
+        if (node->getType() != NodeType::Agent || !node->getLinkedData()) {
+            continue;
+        }
+
+        auto nodeData = reinterpret_cast<const AvatarMixerClientData*>(node->getLinkedData());
+        glm::ivec3 coordinates = getCoordinates(nodeData->getConstAvatarData()->getClientGlobalPosition());
+
+        auto cellIndex = _cellIndices.emplace(getKey(coordinates), (int)_cells.size());
+        if (cellIndex.second) {
+            _cells.push_back({ coordinates, {} });
+        }
+        _cells[cellIndex.first->second].nodeIndices.push_back((int)(it - begin));
+    }
+}
+
+void AvatarMixerGrid::getCandidates(const glm::vec3& position, unsigned int sampleSeed,
+                                    std::vector<int>& candidates) const {
+    glm::ivec3 center = getCoordinates(position);
+
+    // everyone nearby
+    for (int x = -NEAR_CELLS; x <= NEAR_CELLS; x++) {
+        for (int y = -NEAR_CELLS; y <= NEAR_CELLS; y++) {
+            for (int z = -NEAR_CELLS; z <= NEAR_CELLS; z++) {
+                auto cellIndex = _cellIndices.find(getKey(center + glm::ivec3(x, y, z)));
+                if (cellIndex != _cellIndices.end()) {
+                    const auto& nodeIndices = _cells[cellIndex->second].nodeIndices;
+                    candidates.insert(candidates.end(), nodeIndices.begin(), nodeIndices.end());
+                }
+            }
+        }
+    }
+
+    // and every FAR_SAMPLE_PERIOD-th of the rest, starting somewhere else each frame
+    unsigned int offset = (_frame + sampleSeed) % FAR_SAMPLE_PERIOD;
+    for (const auto& cell : _cells) {
+        glm::ivec3 distance = glm::abs(cell.coordinates - center);
+        if (distance.x <= NEAR_CELLS && distance.y <= NEAR_CELLS && distance.z <= NEAR_CELLS) {
+            continue;
+        }
+
+        for (size_t i = offset; i < cell.nodeIndices.size(); i += FAR_SAMPLE_PERIOD) {
+            candidates.push_back(cell.nodeIndices[i]);
+        }
+
+        // carry the phase over so that small cells don't all start at their first agent
+        offset = (unsigned int)((offset + FAR_SAMPLE_PERIOD - cell.nodeIndices.size() % FAR_SAMPLE_PERIOD) % FAR_SAMPLE_PERIOD);
+    }
+}
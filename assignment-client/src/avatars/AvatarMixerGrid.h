@@ -0,0 +1,67 @@
+//
+//  AvatarMixerGrid.h
+//  assignment-client/src/avatars
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_AvatarMixerGrid_h
+#define vircadia_AvatarMixerGrid_h
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <NodeList.h>
+
+// Uniform grid of the agents' positions, rebuilt once per broadcast frame.
+//
+// Each destination only considers the agents in the cells around it, plus a rotating sample of everyone further away
+// so that the far avatars still get through, at a lower rate. The candidates are indices into the node range the grid
+// was built from.
+class AvatarMixerGrid {
+public:
+    using ConstIter = NodeList::const_iterator;
+
+    // agents in cells within this many cells of the destination's are always candidates
+    static const int NEAR_CELLS = 1;
+
+    // one in this many of the far agents are candidates each frame
+    static const int FAR_SAMPLE_PERIOD = 9;
+
+    void setCellSize(float cellSize) { _cellSize = std::max(cellSize, 0.0f); }
+    float getCellSize() const { return _cellSize; }
+    bool isEnabled() const { return _cellSize > 0.0f; }
+
+    // called from the mixer thread, before the broadcast
+    void rebuild(ConstIter begin, ConstIter end);
+
+    // thread-safe, called from the slaves while broadcasting
+    // sampleSeed varies which of the far agents are sampled between destinations
+    void getCandidates(const glm::vec3& position, unsigned int sampleSeed, std::vector<int>& candidates) const;
+
+private:
+    using CellKey = uint64_t;
+
+    struct Cell {
+        glm::ivec3 coordinates;
+        std::vector<int> nodeIndices;
+    };
+
+    glm::ivec3 getCoordinates(const glm::vec3& position) const;
+    static CellKey getKey(const glm::ivec3& coordinates);
+
+    float _cellSize { 0.0f };
+    unsigned int _frame { 0 };
+
+    std::vector<Cell> _cells;
+    std::unordered_map<CellKey, int> _cellIndices;
+};
+
+#endif // vircadia_AvatarMixerGrid_h
@@ -72,8 +72,7 @@ void AvatarMixerSlave::processIncomingPackets(const SharedNodePointer& node) {
 
 int AvatarMixerSlave::sendIdentityPacket(NLPacketList& packetList, const AvatarMixerClientData* nodeData, const Node& destinationNode) {
     if (destinationNode.getType() == NodeType::Agent && !destinationNode.isUpstream()) {
-        QByteArray individualData = nodeData->getConstAvatarData()->identityByteArray();
-        individualData.replace(0, NUM_BYTES_RFC4122_UUID, nodeData->getNodeID().toRfc4122()); // FIXME, this looks suspicious
+        QByteArray individualData = nodeData->getIdentityData(_sharedData->broadcastFrame);
         packetList.write(individualData);
         _stats.numIdentityPacketsSent++;
         _stats.numIdentityBytesSent += individualData.size();
@@ -100,7 +99,8 @@ qint64 AvatarMixerSlave::addTraitsNodeHeader(AvatarMixerClientData* listeningNod
 
 qint64 AvatarMixerSlave::addChangedTraitsToBulkPacket(AvatarMixerClientData* listeningNodeData,
                                                       const AvatarMixerClientData* sendingNodeData,
-                                                      NLPacketList& traitsPacketList) {
+                                                      NLPacketList& traitsPacketList,
+                                                      qint64 traitBytesSent) {
 
     // Avatar Traits flow control marks each outgoing avatar traits packet with a
     // sequence number. The mixer caches the traits sent in the traits packet.
@@ -118,11 +118,21 @@ qint64 AvatarMixerSlave::addChangedTraitsToBulkPacket(AvatarMixerClientData* lis
 
     qint64 bytesWritten = 0;
 
+    // past the destination's trait budget for the frame, the rest waits for the next frames
+    // (the first trait of the frame always goes, however large)
+    auto isOverBudget = [&](qint64 traitBytes) {
+        qint64 frameBytes = traitBytesSent + bytesWritten;
+        if (_sharedData->maxTraitBytesPerFrame > 0 && frameBytes > 0
+            && frameBytes + traitBytes > _sharedData->maxTraitBytesPerFrame) {
+            ++_stats.numTraitsHeldBack;
+            return true;
+        }
+        return false;
+    };
+
     if (timeOfLastTraitsChange > timeOfLastTraitsSent) {
         // there is definitely new traits data to send
 
-        auto sendingAvatar = sendingNodeData->getAvatarSharedPointer();
-
         // compare trait versions so we can see what exactly needs to go out
         auto& lastSentVersions = listeningNodeData->getLastSentTraitVersions(sendingNodeLocalID);
         auto& lastAckedVersions = listeningNodeData->getLastAckedTraitVersions(sendingNodeLocalID);
@@ -139,10 +149,18 @@ qint64 AvatarMixerSlave::addChangedTraitsToBulkPacket(AvatarMixerClientData* lis
             // hold sending more traits until we've been acked that the last one we sent was received
             if (lastSentVersionRef == lastAckedVersionRef) {
                 if (lastReceivedVersion > lastSentVersionRef) {
+                    // packed once for all the destinations
+                    auto traitBinaryData = sendingNodeData->getPackedTrait(traitType, lastReceivedVersion);
+                    if (isOverBudget(traitBinaryData.size())) {
+                        allTraitsUpdated = false;
+                        ++simpleReceivedIt;
+                        continue;
+                    }
+
                     bytesWritten += addTraitsNodeHeader(listeningNodeData, sendingNodeData, traitsPacketList, bytesWritten);
                     // there is an update to this trait, add it to the traits packet
                     bytesWritten += AvatarTraits::packVersionedTrait(traitType, traitsPacketList,
-                                                                     lastReceivedVersion, *sendingAvatar);
+                                                                     lastReceivedVersion, traitBinaryData);
                     // update the last sent version
                     lastSentVersionRef = lastReceivedVersion;
                     // Remember which versions we sent in this particular packet
@@ -194,11 +212,17 @@ qint64 AvatarMixerSlave::addChangedTraitsToBulkPacket(AvatarMixerClientData* lis
                     continue;
                 }
                 if (!isDeleted && (sentInstanceIt == sentIDValuePairs.end() || receivedVersion > sentInstanceIt->value)) {
+                    auto traitBinaryData = sendingNodeData->getPackedTraitInstance(traitType, instanceID, receivedVersion);
+                    if (isOverBudget(traitBinaryData.size())) {
+                        allTraitsUpdated = false;
+                        continue;
+                    }
+
                     bytesWritten += addTraitsNodeHeader(listeningNodeData, sendingNodeData, traitsPacketList, bytesWritten);
 
                     // this instance version exists and has never been sent or is newer so we need to send it
                     bytesWritten += AvatarTraits::packVersionedTraitInstance(traitType, instanceID, traitsPacketList,
-                                                                             receivedVersion, *sendingAvatar);
+                                                                             receivedVersion, traitBinaryData);
 
                     if (sentInstanceIt != sentIDValuePairs.end()) {
                         sentInstanceIt->value = receivedVersion;
@@ -289,8 +313,8 @@ namespace {
     class SortableAvatar : public PrioritySortUtil::Sortable {
     public:
         SortableAvatar() = delete;
-        SortableAvatar(const MixerAvatar* avatar, const Node* avatarNode, uint64_t lastEncodeTime)
-            : _avatar(avatar), _node(avatarNode), _lastEncodeTime(lastEncodeTime) {
+        SortableAvatar(const MixerAvatar* avatar, const Node* avatarNode, uint64_t lastEncodeTime, int lodTier)
+            : _avatar(avatar), _node(avatarNode), _lastEncodeTime(lastEncodeTime), _lodTier(lodTier) {
         }
         glm::vec3 getPosition() const override { return _avatar->getClientGlobalPosition(); }
         float getRadius() const override {
@@ -302,13 +326,30 @@ namespace {
         }
         const Node* getNode() const { return _node; }
         const MixerAvatar* getAvatar() const { return _avatar; }
+        int getLODTier() const { return _lodTier; }
 
     private:
         const MixerAvatar* _avatar;
         const Node* _node;
         uint64_t _lastEncodeTime;
+        int _lodTier;
     };
 
+    // Update rate tiers: near avatars are sent every frame as before, mid-range ones in view at most
+    // 15 times a second without full updates, and everything further (or out of view) twice a second, position only.
+    enum LODTier { kNearTier, kMidTier, kFarTier };
+    const uint64_t LOD_TIER_INTERVALS_USECS[] = { 0, USECS_PER_SECOND / 15, USECS_PER_SECOND / 2 };
+
+    LODTier computeLODTier(float distance, bool isInView, float nearDistance, float farDistance) {
+        if (nearDistance <= 0.0f || distance < nearDistance) {
+            return kNearTier;
+        } else if (distance < farDistance && isInView) {
+            return kMidTier;
+        } else {
+            return kFarTier;
+        }
+    }
+
 }  // Close anonymous namespace.
 
 void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node) {
@@ -386,8 +427,21 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
 
     avatarPriorityQueues[kNonhero].reserve(_end - _begin);
 
-    for (auto listedNode = _begin; listedNode != _end; ++listedNode) {
-        Node* otherNodeRaw = (*listedNode).data();
+    // with the grid, only the nearby avatars and a rotating sample of the far ones are considered
+    // the PAL lists everyone though, so while it is (or just was) open we walk them all
+    _candidates.clear();
+    if (_sharedData->grid.isEnabled() && !PALIsOpen && !PALWasOpen) {
+        _sharedData->grid.getCandidates(destinationPosition, destinationNode->getLocalID(), _candidates);
+    } else {
+        for (int i = 0; i < (int)(_end - _begin); i++) {
+            _candidates.push_back(i);
+        }
+    }
+    _stats.numCandidates += (int)_candidates.size();
+
+    quint64 startPrioritization = usecTimestampNow();
+    for (int candidate : _candidates) {
+        Node* otherNodeRaw = _begin[candidate].data();
         if (otherNodeRaw->getType() != NodeType::Agent
             || !otherNodeRaw->getLinkedData()
             || otherNodeRaw == destinationNode) {
@@ -475,12 +529,26 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
         _stats.ignoreCalculationElapsedTime += (endIgnoreCalculation - startIgnoreCalculation);
 
         if (sendAvatar) {
-            // sort this one for later
             const MixerAvatar* avatarNodeData = sourceAvatarNodeData->getConstAvatarData();
             auto lastEncodeTime = destinationNodeData->getLastOtherAvatarEncodeTime(sourceAvatarNode->getLocalID());
 
-            avatarPriorityQueues[avatarNodeData->getHasPriority() ? kHero : kNonhero].push(
-                SortableAvatar(avatarNodeData, sourceAvatarNode, lastEncodeTime));
+            // heroes are always near, and the PAL wants everyone at full rate
+            LODTier lodTier = kNearTier;
+            if (!avatarNodeData->getHasPriority() && !PALIsOpen) {
+                float distance = glm::distance(destinationPosition, avatarNodeData->getClientGlobalPosition());
+                bool isInView = distance < _sharedData->lodFarDistance &&
+                    destinationNodeData->otherAvatarInView(avatarNodeData->getGlobalBoundingBox());
+                lodTier = computeLODTier(distance, isInView, _sharedData->lodNearDistance, _sharedData->lodFarDistance);
+            }
+
+            if (usecTimestampNow() - lastEncodeTime < LOD_TIER_INTERVALS_USECS[lodTier]) {
+                // not due yet at this tier's rate
+                ++_stats.numLODTierHeldBack;
+            } else {
+                // sort this one for later
+                avatarPriorityQueues[avatarNodeData->getHasPriority() ? kHero : kNonhero].push(
+                    SortableAvatar(avatarNodeData, sourceAvatarNode, lastEncodeTime, lodTier));
+            }
         }
         
         // If Node A's PAL WAS open but is no longer open, AND
@@ -503,6 +571,8 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
 
         destinationNodeData->setPrevRequestsDomainListData(PALIsOpen);
     }
+    quint64 endPrioritization = usecTimestampNow();
+    _stats.prioritizationElapsedTime += (endPrioritization - startPrioritization);
 
     // loop through our sorted avatars and allocate our bandwidth to them accordingly
 
@@ -518,7 +588,9 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
 
     // Loop over two priorities - hero avatars then everyone else:
     for (PriorityVariants currentVariant = kHero; currentVariant <= kNonhero; ++((int&)currentVariant)) {
+        quint64 startSort = usecTimestampNow();
         const auto& sortedAvatarVector = avatarPriorityQueues[currentVariant].getSortedVector(numToSendEst);
+        _stats.prioritizationElapsedTime += (usecTimestampNow() - startSort);
         for (const auto& sortedAvatar : sortedAvatarVector) {
             const Node* sourceNode = sortedAvatar.getNode();
             auto lastEncodeForOther = sortedAvatar.getTimestamp();
@@ -559,7 +631,12 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
                 detail = PALIsOpen ? AvatarData::PALMinimum : AvatarData::MinimumData;
                 destinationNodeData->incrementAvatarOutOfView();
             } else if (!overBudget) {
-                detail = distribution(generator) < AVATAR_SEND_FULL_UPDATE_RATIO ? AvatarData::SendAllData : AvatarData::CullSmallData;
+                if (sortedAvatar.getLODTier() == kFarTier) {
+                    detail = AvatarData::MinimumData;
+                } else {
+                    // the occasional full update is also the key that joint rotation deltas resync from
+                    detail = distribution(generator) < AVATAR_SEND_FULL_UPDATE_RATIO ? AvatarData::SendAllData : AvatarData::CullSmallData;
+                }
                 destinationNodeData->incrementAvatarInView();
 
                 // If the time that the mixer sent AVATAR DATA about Avatar B to Node A is BEFORE OR EQUAL TO
@@ -574,13 +651,50 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
             }
 
             QVector<JointData>& lastSentJointsForOther = destinationNodeData->getLastOtherAvatarSentJoints(sourceNode->getLocalID());
+            uint16_t& lastJointSequenceForOther =
+                destinationNodeData->getLastOtherAvatarJointSequence(sourceNode->getLocalID());
 
             const bool distanceAdjust = true;
             const bool dropFaceTracking = false;
             AvatarDataPacket::SendStatus sendStatus;
             sendStatus.sendUUID = true;
+            sendStatus.sendJointRotationDeltas = true;
+            sendStatus.jointSequence = AvatarMixerClientData::getJointSequence(_sharedData->broadcastFrame);
+            sendStatus.jointReferenceSequence = lastJointSequenceForOther;
+
+            // the encodings that don't depend on the receiver are shared with the other destinations this frame,
+            // as long as they fit in what's left of the packet
+            bool isShared = false;
+            if (AvatarMixerClientData::isShareableDetail(detail)) {
+                auto startSerialize = chrono::high_resolution_clock::now();
+                auto wantedFlags = sourceAvatar->getWantedDataFlags(detail, lastEncodeForOther, dropFaceTracking);
+                auto sharedData = sourceNodeData->getSharedAvatarData(_sharedData->broadcastFrame, detail, wantedFlags);
+                auto endSerialize = chrono::high_resolution_clock::now();
+                _stats.toByteArrayElapsedTime +=
+                    (quint64)chrono::duration_cast<chrono::microseconds>(endSerialize - startSerialize).count();
+
+                if (sharedData.bytes.size() <= avatarSpaceAvailable) {
+                    if (detail == AvatarData::SendAllData) {
+                        lastSentJointsForOther = sharedData.sentJoints;
+                        sendStatus.jointReferenceSequence = sendStatus.jointSequence;
+                    }
 
-            do {
+                    avatarPacket->write(sharedData.bytes);
+                    avatarSpaceAvailable -= sharedData.bytes.size();
+                    numAvatarDataBytes += sharedData.bytes.size();
+                    if (avatarSpaceAvailable < (int)AvatarDataPacket::MIN_BULK_PACKET_SIZE) {
+                        nodeList->sendPacket(std::move(avatarPacket), *destinationNode);
+                        ++numPacketsSent;
+                        avatarPacket = NLPacket::create(PacketType::BulkAvatarData);
+                        avatarSpaceAvailable = avatarPacketCapacity;
+                    }
+
+                    ++_stats.numSharedEncodes;
+                    isShared = true;
+                }
+            }
+
+            while (!isShared) {
                 auto startSerialize = chrono::high_resolution_clock::now();
                 QByteArray bytes = sourceAvatar->toByteArray(detail, lastEncodeForOther, lastSentJointsForOther,
                     sendStatus, dropFaceTracking, distanceAdjust, destinationPosition,
@@ -599,7 +713,12 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
                     avatarPacket = NLPacket::create(PacketType::BulkAvatarData);
                     avatarSpaceAvailable = avatarPacketCapacity;
                 }
-            } while (!sendStatus);
+
+                if (sendStatus) {
+                    break;
+                }
+            }
+            lastJointSequenceForOther = sendStatus.jointReferenceSequence;
 
             if (detail != AvatarData::NoData) {
                 _stats.numOthersIncluded++;
@@ -622,7 +741,8 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
 
             if (!overBudget) {
                 // use helper to add any changed traits to our packet list
-                traitBytesSent += addChangedTraitsToBulkPacket(destinationNodeData, sourceNodeData, *traitsPacketList);
+                traitBytesSent += addChangedTraitsToBulkPacket(destinationNodeData, sourceNodeData, *traitsPacketList,
+                                                               traitBytesSent);
             }
             numAvatarsSent++;
             remainingAvatars--;
@@ -14,6 +14,8 @@
 
 #include <NodeList.h>
 
+#include "AvatarMixerGrid.h"
+
 class AvatarMixerClientData;
 
 class AvatarMixerSlaveStats {
@@ -33,12 +35,17 @@ public:
     int numOthersIncluded { 0 };
     int overBudgetAvatars { 0 };
     int numHeroesIncluded { 0 };
+    int numCandidates { 0 };
+    int numSharedEncodes { 0 };
+    int numLODTierHeldBack { 0 };
+    int numTraitsHeldBack { 0 };
 
     quint64 ignoreCalculationElapsedTime { 0 };
     quint64 avatarDataPackingElapsedTime { 0 };
     quint64 packetSendingElapsedTime { 0 };
     quint64 toByteArrayElapsedTime { 0 };
     quint64 jobElapsedTime { 0 };
+    quint64 prioritizationElapsedTime { 0 }; // choosing and sorting the avatars to send, includes the ignore calculation
 
     void reset() {
         // receiving job stats
@@ -59,12 +66,17 @@ public:
         numOthersIncluded = 0;
         overBudgetAvatars = 0;
         numHeroesIncluded = 0;
+        numCandidates = 0;
+        numSharedEncodes = 0;
+        numLODTierHeldBack = 0;
+        numTraitsHeldBack = 0;
 
         ignoreCalculationElapsedTime = 0;
         avatarDataPackingElapsedTime = 0;
         packetSendingElapsedTime = 0;
         toByteArrayElapsedTime = 0;
         jobElapsedTime = 0;
+        prioritizationElapsedTime = 0;
     }
 
     AvatarMixerSlaveStats& operator+=(const AvatarMixerSlaveStats& rhs) {
@@ -83,12 +95,17 @@ public:
         numOthersIncluded += rhs.numOthersIncluded;
         overBudgetAvatars += rhs.overBudgetAvatars;
         numHeroesIncluded += rhs.numHeroesIncluded;
+        numCandidates += rhs.numCandidates;
+        numSharedEncodes += rhs.numSharedEncodes;
+        numLODTierHeldBack += rhs.numLODTierHeldBack;
+        numTraitsHeldBack += rhs.numTraitsHeldBack;
 
         ignoreCalculationElapsedTime += rhs.ignoreCalculationElapsedTime;
         avatarDataPackingElapsedTime += rhs.avatarDataPackingElapsedTime;
         packetSendingElapsedTime += rhs.packetSendingElapsedTime;
         toByteArrayElapsedTime += rhs.toByteArrayElapsedTime;
         jobElapsedTime += rhs.jobElapsedTime;
+        prioritizationElapsedTime += rhs.prioritizationElapsedTime;
         return *this;
     }
 };
@@ -100,6 +117,15 @@ struct SlaveSharedData {
     QStringList skeletonURLWhitelist;
     QUrl skeletonReplacementURL;
     EntityTreePointer entityTree;
+    AvatarMixerGrid grid;
+    unsigned int broadcastFrame { 0 };
+
+    // update rate tiers by distance, off when lodNearDistance is 0
+    float lodNearDistance { 0.0f };
+    float lodFarDistance { 0.0f };
+
+    // trait bytes sent to each destination per frame, the rest wait for the next frames, 0 is unlimited
+    int maxTraitBytesPerFrame { 0 };
 };
 
 class AvatarMixerSlave {
@@ -129,7 +155,8 @@ private:
 
     qint64 addChangedTraitsToBulkPacket(AvatarMixerClientData* listeningNodeData,
                                         const AvatarMixerClientData* sendingNodeData,
-                                        NLPacketList& traitsPacketList);
+                                        NLPacketList& traitsPacketList,
+                                        qint64 traitBytesSent);
 
     void broadcastAvatarDataToAgent(const SharedNodePointer& node);
     void broadcastAvatarDataToDownstreamMixer(const SharedNodePointer& node);
@@ -138,6 +165,8 @@ private:
     ConstIter _begin;
     ConstIter _end;
 
+    std::vector<int> _candidates;
+
     p_high_resolution_clock::time_point _lastFrameTimestamp;
     float _maxKbpsPerNode { 0.0f };
     float _throttlingRatio { 0.0f };
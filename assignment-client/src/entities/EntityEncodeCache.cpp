@@ -0,0 +1,68 @@
+//
+//  EntityEncodeCache.cpp
+//  assignment-client/src/entities
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityEncodeCache.h"
+
+#include <EntityItem.h>
+#include <SharedUtil.h>
+
+EntityEncodeCache::Key EntityEncodeCache::getKey(const EntityItem& entity, bool withPrivateUserData) {
+    Key key;
+    key.lastEdited = entity.getLastEdited();
+    key.lastUpdated = entity.getLastUpdated();
+    key.lastSimulated = entity.getLastSimulated();
+    key.lastChangedOnServer = entity.getLastChangedOnServer();
+    key.withPrivateUserData = withPrivateUserData;
+    return key;
+}
+
+bool EntityEncodeCache::find(const QUuid& entityID, const Key& key, QByteArray& encoded) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _entries.find(entityID);
+    if (it == _entries.end()) {
+        return false;
+    }
+
+    const Entry& entry = it->second.entries[key.withPrivateUserData ? 1 : 0];
+    if (entry.encoded.isEmpty() || !(entry.key == key) || entry.encodedAt + MAX_AGE_USECS < usecTimestampNow()) {
+        return false;
+    }
+
+    encoded = entry.encoded;
+    return true;
+}
+
+void EntityEncodeCache::insert(const QUuid& entityID, const Key& key, const QByteArray& encoded) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    Entry& entry = _entries[entityID].entries[key.withPrivateUserData ? 1 : 0];
+    entry.key = key;
+    entry.encoded = encoded;
+    entry.encodedAt = usecTimestampNow();
+}
+
+void EntityEncodeCache::prune(quint64 now) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto it = _entries.begin(); it != _entries.end();) {
+        bool isStale = true;
+        for (auto& entry : it->second.entries) {
+            if (entry.encodedAt + MAX_AGE_USECS < now) {
+                entry.encoded.clear();
+            } else {
+                isStale = false;
+            }
+        }
+
+        if (isStale) {
+            it = _entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
@@ -0,0 +1,75 @@
+//
+//  EntityEncodeCache.h
+//  assignment-client/src/entities
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_EntityEncodeCache_h
+#define vircadia_EntityEncodeCache_h
+
+#include <mutex>
+#include <unordered_map>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QUuid>
+
+#include <NumericalConstants.h>
+#include <UUIDHasher.h>
+
+class EntityItem;
+
+// Complete entity encodings shared by the send threads, so that an entity is encoded once per change instead of once
+// per viewer.
+//
+// An encoding is reused for as long as the entity's edit, update, simulation and server change times are the same as
+// when it was made. Whether the viewer may see the private user data is part of the key, which is otherwise the only
+// thing that changes an entity's encoding from one viewer to the next.
+class EntityEncodeCache {
+public:
+    // encodings are also dropped after this long, in case something changed an entity without bumping its times
+    static const quint64 MAX_AGE_USECS = USECS_PER_SECOND;
+
+    struct Key {
+        quint64 lastEdited { 0 };
+        quint64 lastUpdated { 0 };
+        quint64 lastSimulated { 0 };
+        quint64 lastChangedOnServer { 0 };
+        bool withPrivateUserData { false };
+
+        bool operator==(const Key& other) const {
+            return lastEdited == other.lastEdited && lastUpdated == other.lastUpdated &&
+                lastSimulated == other.lastSimulated && lastChangedOnServer == other.lastChangedOnServer &&
+                withPrivateUserData == other.withPrivateUserData;
+        }
+    };
+
+    // read before encoding, so that a change made while encoding doesn't get cached under the new times
+    static Key getKey(const EntityItem& entity, bool withPrivateUserData);
+
+    // thread-safe
+    bool find(const QUuid& entityID, const Key& key, QByteArray& encoded);
+    void insert(const QUuid& entityID, const Key& key, const QByteArray& encoded);
+
+    void prune(quint64 now);
+
+private:
+    struct Entry {
+        Key key;
+        QByteArray encoded;
+        quint64 encodedAt { 0 };
+    };
+
+    // one for viewers that get the private user data and one for those that don't
+    struct Entries {
+        Entry entries[2];
+    };
+
+    std::mutex _mutex;
+    std::unordered_map<QUuid, Entries> _entries;
+};
+
+#endif // vircadia_EntityEncodeCache_h
@@ -21,9 +21,11 @@
 #include <ScriptCache.h>
 #include <plugins/PluginManager.h>
 #include <EntityEditFilters.h>
+#include <EntityStringTable.h>
 #include <NetworkingConstants.h>
 #include <MetaverseAPI.h>
 #include <hfm/ModelFormatRegistry.h>
+#include <SimulationOwner.h>
 
 #include "../AssignmentDynamicFactory.h"
 #include "AssignmentParentFinder.h"
@@ -304,6 +306,8 @@ void EntityServer::pruneDeletedEntities() {
         });
         tree->forgetEntitiesDeletedBefore(earliestLastDeletedEntitiesSent);
     }
+
+    _encodeCache.prune(usecTimestampNow());
 }
 
 void EntityServer::readAdditionalConfiguration(const QJsonObject& settingsSectionObject) {
@@ -324,6 +328,15 @@ void EntityServer::readAdditionalConfiguration(const QJsonObject& settingsSectio
         tree->setEntityMaxTmpLifetime(EntityTree::DEFAULT_MAX_TMP_ENTITY_LIFETIME);
     }
 
+    // a longer lockout keeps participants bidding at equal priority from trading ownership back and forth
+    int simulationOwnershipLockout;
+    if (readOptionInt("simulationOwnershipLockout", settingsSectionObject, simulationOwnershipLockout) &&
+            simulationOwnershipLockout >= 0) {
+        SimulationOwner::setOwnershipLockoutPeriod((uint64_t)simulationOwnershipLockout * USECS_PER_MSEC);
+    } else {
+        SimulationOwner::setOwnershipLockoutPeriod(SimulationOwner::DEFAULT_OWNERSHIP_LOCKOUT_PERIOD);
+    }
+
     int minTime;
     if (readOptionInt("dynamicDomainVerificationTimeMin", settingsSectionObject, minTime)) {
         _MINIMUM_DYNAMIC_DOMAIN_VERIFICATION_TIMER_MS = minTime * 1000;
@@ -339,6 +352,13 @@ void EntityServer::readAdditionalConfiguration(const QJsonObject& settingsSectio
     tree->setWantEditLogging(wantEditLogging);
     tree->setWantTerseEditLogging(wantTerseEditLogging);
 
+    bool looseElementFit = false;
+    readOptionBool(QString("looseElementFit"), settingsSectionObject, looseElementFit);
+    tree->setLooseElementFit(looseElementFit);
+
+    _wantMemoryAudit = false;
+    readOptionBool(QString("wantMemoryAudit"), settingsSectionObject, _wantMemoryAudit);
+
     QString entityScriptSourceWhitelist;
     if (readOptionString("entityScriptSourceWhitelist", settingsSectionObject, entityScriptSourceWhitelist)) {
         tree->setEntityScriptSourceWhitelist(entityScriptSourceWhitelist);
@@ -416,6 +436,30 @@ QString EntityServer::serverSubclassStats() {
     statsString += QString().sprintf("       EntityItem size... %ld bytes\r\n", sizeof(EntityItem));
     statsString += "\r\n\r\n";
 
+    if (_wantMemoryAudit) {
+        EntityTreePointer tree = std::static_pointer_cast<EntityTree>(_tree);
+        auto usage = tree->getMemoryUsageByType();
+
+        statsString += "<b>Entity Server Memory Audit</b>\r\n";
+        statsString += "----- Type -------    ----- Entities ---    ------ Total Bytes ---    ---- Bytes per Entity ---\r\n";
+        const int MEMORY_AUDIT_COLUMN_WIDTH = 21;
+        for (int type = 0; type < (int)usage.size(); ++type) {
+            if (usage[type].count == 0) {
+                continue;
+            }
+            statsString += EntityTypes::getEntityTypeName((EntityTypes::EntityType)type).leftJustified(MEMORY_AUDIT_COLUMN_WIDTH, ' ');
+            statsString += locale.toString(usage[type].count).rightJustified(MEMORY_AUDIT_COLUMN_WIDTH, ' ');
+            statsString += locale.toString((qulonglong)usage[type].bytes).rightJustified(MEMORY_AUDIT_COLUMN_WIDTH + 4, ' ');
+            statsString += locale.toString((qulonglong)(usage[type].bytes / usage[type].count))
+                .rightJustified(MEMORY_AUDIT_COLUMN_WIDTH + 4, ' ');
+            statsString += "\r\n";
+        }
+        statsString += QString("Shared strings... %1 strings, %2 bytes\r\n")
+            .arg(locale.toString(EntityStringTable::size()))
+            .arg(locale.toString((qulonglong)EntityStringTable::getMemoryUsage()));
+        statsString += "\r\n\r\n";
+    }
+
     statsString += "<b>Entity Server Sending to Viewer Statistics</b>\r\n";
     statsString += "----- Viewer Node ID -----------------    ----- Entity ID ----------------------    "
                    "---------- Last Sent To ----------    ---------- Last Edited -----------\r\n";
@@ -18,10 +18,12 @@
 
 #include <memory>
 
+#include <EntityCompressionDictionary.h>
 #include <EntityItem.h>
 #include <EntityTree.h>
 #include <SimpleEntitySimulation.h>
 
+#include "EntityEncodeCache.h"
 #include "EntityServerConsts.h"
 
 /// Handles assignments of type EntityServer - sending entities to various clients.
@@ -46,6 +48,7 @@ public:
     virtual const char* getMyDefaultPersistFilename() const override { return LOCAL_MODELS_PERSIST_FILE; }
     virtual PacketType getMyEditNackType() const override { return PacketType::EntityEditNack; }
     virtual QString getMyDomainSettingsKey() const override { return QString("entity_server_settings"); }
+    virtual const QByteArray& getCompressionDictionary() const override { return getEntityCompressionDictionary(); }
 
     // subclass may implement these method
     virtual void beforeRun() override;
@@ -61,6 +64,8 @@ public:
 
     virtual void aboutToFinish() override;
 
+    EntityEncodeCache& getEncodeCache() { return _encodeCache; }
+
 public slots:
     virtual void nodeAdded(SharedNodePointer node) override;
     virtual void nodeKilled(SharedNodePointer node) override;
@@ -79,6 +84,10 @@ private:
     SimpleEntitySimulationPointer _entitySimulation;
     QTimer* _pruneDeletedEntitiesTimer = nullptr;
 
+    EntityEncodeCache _encodeCache;
+
+    bool _wantMemoryAudit { false }; // list the memory used by each type of entity on the stats page
+
     QReadWriteLock _viewerSendingStatsLock;
     QMap<QUuid, QMap<QUuid, ViewerSendingStats>> _viewerSendingStats;
 
@@ -12,8 +12,12 @@
 #include "EntityTreeHeadlessViewer.h"
 #include "SimpleEntitySimulation.h"
 
+#include <EntityCompressionDictionary.h>
+
 EntityTreeHeadlessViewer::EntityTreeHeadlessViewer()
     :   OctreeHeadlessViewer(), _simulation(NULL) {
+    setCompressionDictionary(getEntityCompressionDictionary());
+    getOctreeQuery().setCompressionDictionaryID(getEntityCompressionDictionaryID());
 }
 
 EntityTreeHeadlessViewer::~EntityTreeHeadlessViewer() {
@@ -33,6 +33,8 @@ void EntityTreeSendThread::resetState() {
 
     _knownState.clear();
     _traversal.reset();
+    EntityPriorityQueue().swap(_refinementQueue);
+    _coarsePass = false;
 }
 
 void EntityTreeSendThread::preDistributionProcessing() {
@@ -42,6 +44,12 @@ void EntityTreeSendThread::preDistributionProcessing() {
     if (nodeData) {
         auto jsonQuery = nodeData->getJSONParameters();
 
+        // the viewer may now want properties it was never sent, so send it everything in view again
+        auto excludedProperties = jsonQuery[EntityJSONQueryProperties::EXCLUDED_PROPERTIES_PROPERTY].toObject();
+        if (nodeData->updateExcludedProperties(excludedProperties)) {
+            resetState();
+        }
+
         // check if we have a JSON query with flags
         auto flags = jsonQuery[EntityJSONQueryProperties::FLAGS_PROPERTY].toObject();
         if (!flags.isEmpty()) {
@@ -101,59 +109,69 @@ void EntityTreeSendThread::preDistributionProcessing() {
 
 bool EntityTreeSendThread::traverseTreeAndSendContents(SharedNodePointer node, OctreeQueryNode* nodeData,
             bool viewFrustumChanged, bool isFullScene) {
-    if (viewFrustumChanged || _traversal.finished()) {
-        EntityTreeElementPointer root = std::dynamic_pointer_cast<EntityTreeElement>(_myServer->getOctree()->getRoot());
-
-
-        DiffTraversal::View newView;
-        newView.viewFrustums = nodeData->getCurrentViews();
-
-        int32_t lodLevelOffset = nodeData->getBoundaryLevelAdjust() + (viewFrustumChanged ? LOW_RES_MOVING_ADJUST : NO_BOUNDARY_ADJUST);
-        newView.lodScaleFactor = powf(2.0f, lodLevelOffset);
-        
-        startNewTraversal(newView, root, isFullScene);
-
-        // When the viewFrustum changed the sort order may be incorrect, so we re-sort
-        // and also use the opportunity to cull anything no longer in view
-        if (viewFrustumChanged && !_sendQueue.empty()) {
-            EntityPriorityQueue prevSendQueue;
-            std::swap(_sendQueue, prevSendQueue);
-            assert(_sendQueue.empty());
-
-            // Re-add elements from previous traversal if they still need to be sent
-            while (!prevSendQueue.empty()) {
-                EntityItemPointer entity = prevSendQueue.top().getEntity();
-                bool forceRemove = prevSendQueue.top().shouldForceRemove();
-                prevSendQueue.pop();
-                if (entity) {
-                    float priority = PrioritizedEntity::DO_NOT_SEND;
+    // the traversal only needs the tree while it walks it, sending what it found takes the lock again piece by piece
+    withTreeReadLock([&] {
+        if (viewFrustumChanged || _traversal.finished()) {
+            EntityTreeElementPointer root = std::dynamic_pointer_cast<EntityTreeElement>(_myServer->getOctree()->getRoot());
 
-                    if (forceRemove) {
-                        priority = PrioritizedEntity::FORCE_REMOVE;
-                    } else {
-                        const auto& view = _traversal.getCurrentView();
-                        priority = view.computePriority(entity);
-                    }
 
-                    if (priority != PrioritizedEntity::DO_NOT_SEND) {
-                        _sendQueue.emplace(entity, priority, forceRemove);
+            DiffTraversal::View newView;
+            newView.viewFrustums = nodeData->getCurrentViews();
+
+            int32_t lodLevelOffset = nodeData->getBoundaryLevelAdjust() + (viewFrustumChanged ? LOW_RES_MOVING_ADJUST : NO_BOUNDARY_ADJUST);
+            newView.lodScaleFactor = powf(2.0f, lodLevelOffset);
+            
+            startNewTraversal(newView, root, isFullScene);
+
+            // When the viewFrustum changed the sort order may be incorrect, so we re-sort
+            // and also use the opportunity to cull anything no longer in view
+            if (viewFrustumChanged && !_sendQueue.empty()) {
+                EntityPriorityQueue prevSendQueue;
+                std::swap(_sendQueue, prevSendQueue);
+                assert(_sendQueue.empty());
+
+                // Re-add elements from previous traversal if they still need to be sent
+                while (!prevSendQueue.empty()) {
+                    EntityItemPointer entity = prevSendQueue.top().getEntity();
+                    bool forceRemove = prevSendQueue.top().shouldForceRemove();
+                    prevSendQueue.pop();
+                    if (entity) {
+                        float priority = PrioritizedEntity::DO_NOT_SEND;
+
+                        if (forceRemove) {
+                            priority = PrioritizedEntity::FORCE_REMOVE;
+                        } else {
+                            const auto& view = _traversal.getCurrentView();
+                            priority = view.computePriority(entity);
+                        }
+
+                        if (priority != PrioritizedEntity::DO_NOT_SEND) {
+                            _sendQueue.emplace(entity, priority, forceRemove);
+                        }
                     }
                 }
             }
         }
-    }
 
-    if (!_traversal.finished()) {
-        quint64 startTime = usecTimestampNow();
+        if (!_traversal.finished()) {
+            quint64 startTime = usecTimestampNow();
+
+            #ifdef DEBUG
+            const uint64_t TIME_BUDGET = 400; // usec
+            #else
+            const uint64_t TIME_BUDGET = 200; // usec
+            #endif
+            // while the coarse pass has nothing queued there's nothing to send either, so get it over with sooner
+            const uint64_t COARSE_PASS_TIME_BUDGET_SCALE = 4;
+            bool idleCoarsePass = _coarsePass && _sendQueue.empty();
+            _traversal.traverse(idleCoarsePass ? COARSE_PASS_TIME_BUDGET_SCALE * TIME_BUDGET : TIME_BUDGET);
+            OctreeServer::trackTreeTraverseTime((float)(usecTimestampNow() - startTime));
+        }
 
-        #ifdef DEBUG
-        const uint64_t TIME_BUDGET = 400; // usec
-        #else
-        const uint64_t TIME_BUDGET = 200; // usec
-        #endif
-        _traversal.traverse(TIME_BUDGET);
-        OctreeServer::trackTreeTraverseTime((float)(usecTimestampNow() - startTime));
-    }
+        if (_coarsePass && _traversal.finished()) {
+            endCoarsePass();
+        }
+    });
 
     bool sendComplete = OctreeSendThread::traverseTreeAndSendContents(node, nodeData, viewFrustumChanged, isFullScene);
 
@@ -229,6 +247,11 @@ void EntityTreeSendThread::startNewTraversal(const DiffTraversal::View& view, En
                                              bool forceFirstPass) {
 
     DiffTraversal::Type type = _traversal.prepareNewTraversal(view, root, forceFirstPass);
+
+    // a First traversal that was cut short by a change of view leaves what it held back to the usual re-sort
+    if (_coarsePass) {
+        endCoarsePass();
+    }
     // there are three types of traversal:
     //
     //      (1) FirstTime = at login --> find everything in view
@@ -241,16 +264,24 @@ void EntityTreeSendThread::startNewTraversal(const DiffTraversal::View& view, En
         case DiffTraversal::First:
             // When we get to a First traversal, clear the _knownState
             _knownState.clear();
+            _coarsePass = true;
             _traversal.setScanCallback([this](DiffTraversal::VisibleElement& next) {
                 next.element->forEachEntity([&](EntityItemPointer entity) {
                     // Bail early if we've already checked this entity this frame
-                    if (_sendQueue.contains(entity.get())) {
+                    if (_sendQueue.contains(entity.get()) || _refinementQueue.contains(entity.get())) {
                         return;
                     }
                     const auto& view = _traversal.getCurrentView();
                     float priority = view.computePriority(entity);
 
-                    if (priority != PrioritizedEntity::DO_NOT_SEND) {
+                    if (priority == PrioritizedEntity::DO_NOT_SEND) {
+                        return;
+                    }
+                    // the coarse threshold scales with the LOD like the visibility one does
+                    const float COARSE_PASS_MIN_ANGULAR_DIAMETER = 8.0f * MIN_ENTITY_ANGULAR_DIAMETER;
+                    if (_coarsePass && priority < view.lodScaleFactor * COARSE_PASS_MIN_ANGULAR_DIAMETER) {
+                        _refinementQueue.emplace(entity, priority);
+                    } else {
                         _sendQueue.emplace(entity, priority);
                     }
                 });
@@ -317,6 +348,18 @@ void EntityTreeSendThread::startNewTraversal(const DiffTraversal::View& view, En
     }
 }
 
+void EntityTreeSendThread::endCoarsePass() {
+    _coarsePass = false;
+    while (!_refinementQueue.empty()) {
+        const PrioritizedEntity& queuedItem = _refinementQueue.top();
+        EntityItemPointer entity = queuedItem.getEntity();
+        if (entity && !_sendQueue.contains(entity.get())) {
+            _sendQueue.emplace(entity, queuedItem.getPriority());
+        }
+        _refinementQueue.pop();
+    }
+}
+
 bool EntityTreeSendThread::traverseTreeAndBuildNextPacketPayload(EncodeBitstreamParams& params, const QJsonObject& jsonFilters) {
     if (_sendQueue.empty()) {
         params.stopReason = EncodeBitstreamParams::FINISHED;
@@ -377,7 +420,12 @@ bool EntityTreeSendThread::traverseTreeAndBuildNextPacketPayload(EncodeBitstream
                     // Record explicitly filtered-in entity so that extra entities can be flagged.
                     entityNodeData->insertSentFilteredEntity(entityID);
                 }
-                OctreeElement::AppendState appendEntityState = entity->appendEntityData(&_packetData, params, _extraEncodeData, entityNode->getCanGetAndSetPrivateUserData());
+                EntityPropertyFlags excludedProperties;
+                if (entityNodeData->hasExcludedProperties()) {
+                    excludedProperties = entityNodeData->getExcludedProperties(entity->getType());
+                }
+                OctreeElement::AppendState appendEntityState = appendEntityData(*entity, params,
+                    entityNode->getCanGetAndSetPrivateUserData(), excludedProperties);
 
                 if (appendEntityState != OctreeElement::COMPLETED) {
                     if (appendEntityState == OctreeElement::PARTIAL) {
@@ -418,6 +466,41 @@ bool EntityTreeSendThread::traverseTreeAndBuildNextPacketPayload(EncodeBitstream
     return true;
 }
 
+OctreeElement::AppendState EntityTreeSendThread::appendEntityData(const EntityItem& entity, EncodeBitstreamParams& params,
+                                                                 bool canGetAndSetPrivateUserData,
+                                                                 const EntityPropertyFlags& excludedProperties) {
+    // an entity that only partly fit the last packet has the rest of its properties to go, which isn't what is cached
+    if (_extraEncodeData->entities.contains(entity.getEntityItemID()) || !excludedProperties.isEmpty()) {
+        return entity.appendEntityData(&_packetData, params, _extraEncodeData, canGetAndSetPrivateUserData,
+                                       excludedProperties);
+    }
+
+    auto& encodeCache = static_cast<EntityServer*>(_myServer)->getEncodeCache();
+    auto key = EntityEncodeCache::getKey(entity, canGetAndSetPrivateUserData);
+
+    QByteArray encoded;
+    if (encodeCache.find(entity.getID(), key, encoded)) {
+        OctreeServer::trackEncodeCacheLookup(true);
+        if (_packetData.appendRawData(encoded)) {
+            params.trackSend(entity.getID(), key.lastEdited);
+            return OctreeElement::COMPLETED;
+        }
+
+        // it doesn't fit as a whole, encode it again so that as much as fits goes in this packet
+        return entity.appendEntityData(&_packetData, params, _extraEncodeData, canGetAndSetPrivateUserData);
+    }
+    OctreeServer::trackEncodeCacheLookup(false);
+
+    int encodedOffset = _packetData.getUncompressedByteOffset();
+    auto appendState = entity.appendEntityData(&_packetData, params, _extraEncodeData, canGetAndSetPrivateUserData);
+    if (appendState == OctreeElement::COMPLETED) {
+        int encodedSize = _packetData.getUncompressedByteOffset() - encodedOffset;
+        encoded = QByteArray(reinterpret_cast<const char*>(_packetData.getUncompressedData(encodedOffset)), encodedSize);
+        encodeCache.insert(entity.getID(), key, encoded);
+    }
+    return appendState;
+}
+
 void EntityTreeSendThread::editingEntityPointer(const EntityItemPointer& entity) {
     if (entity) {
         if (!_sendQueue.contains(entity.get()) && _knownState.find(entity.get()) != _knownState.end()) {
@@ -43,8 +43,16 @@ private:
     bool addDescendantsToExtraFlaggedEntities(const QUuid& filteredEntityID, EntityItem& entityItem, EntityNodeData& nodeData);
 
     void startNewTraversal(const DiffTraversal::View& viewFrustum, EntityTreeElementPointer root, bool forceFirstPass = false);
+    // queues the entities held back by the coarse pass of a First traversal
+    void endCoarsePass();
     bool traverseTreeAndBuildNextPacketPayload(EncodeBitstreamParams& params, const QJsonObject& jsonFilters) override;
 
+    // appends the entity to _packetData, from the server's encode cache when it's there
+    // the cache only holds complete encodings, so it isn't used when the viewer has excluded some of the properties
+    OctreeElement::AppendState appendEntityData(const EntityItem& entity, EncodeBitstreamParams& params,
+                                                bool canGetAndSetPrivateUserData,
+                                                const EntityPropertyFlags& excludedProperties);
+
     void preDistributionProcessing() override;
     bool hasSomethingToSend(OctreeQueryNode* nodeData) override { return !_sendQueue.empty(); }
     bool shouldStartNewTraversal(OctreeQueryNode* nodeData, bool viewFrustumChanged) override { return viewFrustumChanged || _traversal.finished(); }
@@ -53,6 +61,12 @@ private:
     EntityPriorityQueue _sendQueue;
     std::unordered_map<EntityItem*, uint64_t> _knownState;
 
+    // A First traversal walks the tree a bit at a time, and what it had found so far was sent as it went, so distant
+    // small entities went out ahead of near ones it hadn't reached yet. Until it has covered the whole view it only
+    // queues the entities that look big to the viewer, and keeps the rest here for when it's done.
+    EntityPriorityQueue _refinementQueue;
+    bool _coarsePass { false };
+
     // packet construction stuff
     EntityTreeElementExtraEncodeDataPointer _extraEncodeData { new EntityTreeElementExtraEncodeData() };
     int32_t _numEntitiesOffset { 0 };
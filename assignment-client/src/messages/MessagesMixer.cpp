@@ -11,6 +11,8 @@
 
 #include "MessagesMixer.h"
 
+#include <algorithm>
+
 #include <QtCore/QCoreApplication>
 #include <QtCore/QJsonObject>
 #include <QBuffer>
@@ -35,8 +37,17 @@ MessagesMixer::MessagesMixer(ReceivedMessage& message) : ThreadedAssignment(mess
 }
 
 void MessagesMixer::nodeKilled(SharedNodePointer killedNode) {
-    for (auto& channel : _channelSubscribers) {
-        channel.remove(killedNode->getUUID());
+    auto localID = killedNode->getLocalID();
+    for (const auto& channel : _subscribedChannels.take(localID)) {
+        removeChannelSubscriber(channel, localID);
+    }
+}
+
+void MessagesMixer::removeChannelSubscriber(const QString& channel, Node::LocalID localID) {
+    auto& subscribers = _channelSubscribers[channel];
+    subscribers.erase(std::remove(subscribers.begin(), subscribers.end(), localID), subscribers.end());
+    if (subscribers.empty()) {
+        _channelSubscribers.remove(channel);
     }
 }
 
@@ -59,30 +70,39 @@ void MessagesMixer::handleMessages(QSharedPointer<ReceivedMessage> receivedMessa
         *itr += 1;
     }
 
-    nodeList->eachMatchingNode(
-        [&](const SharedNodePointer& node)->bool {
-        return node->getActiveSocket() && _channelSubscribers[channel].contains(node->getUUID());
-    },
-        [&](const SharedNodePointer& node) {
-        auto packetList = isText ? MessagesClient::encodeMessagesPacket(channel, message, senderID) :
-                                   MessagesClient::encodeMessagesDataPacket(channel, data, senderID);
-        nodeList->sendPacketList(std::move(packetList), *node);
-    });
+    auto subscribers = _channelSubscribers.constFind(channel);
+    if (subscribers == _channelSubscribers.constEnd()) {
+        return;
+    }
+
+    // every subscriber gets the same payload, in a packet list of its own since they're reliable
+    QByteArray payload = MessagesClient::encodeMessagesPayload(channel, isText, isText ? message.toUtf8() : data, senderID);
+    for (auto localID : *subscribers) {
+        SharedNodePointer node = nodeList->nodeWithLocalID(localID);
+        if (node && node->getActiveSocket()) {
+            nodeList->sendPacketList(MessagesClient::createMessagesPacketList(payload), *node);
+        }
+    }
 }
 
 void MessagesMixer::handleMessagesSubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
-    auto senderUUID = senderNode->getUUID();
+    auto senderLocalID = senderNode->getLocalID();
     QString channel = QString::fromUtf8(message->getMessage());
 
-    _channelSubscribers[channel] << senderUUID;
+    auto& channels = _subscribedChannels[senderLocalID];
+    if (!channels.contains(channel)) {
+        channels.insert(channel);
+        _channelSubscribers[channel].push_back(senderLocalID);
+    }
 }
 
 void MessagesMixer::handleMessagesUnsubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
-    auto senderUUID = senderNode->getUUID();
+    auto senderLocalID = senderNode->getLocalID();
     QString channel = QString::fromUtf8(message->getMessage());
 
-    if (_channelSubscribers.contains(channel)) {
-        _channelSubscribers[channel].remove(senderUUID);
+    auto channels = _subscribedChannels.find(senderLocalID);
+    if (channels != _subscribedChannels.end() && channels->remove(channel)) {
+        removeChannelSubscriber(channel, senderLocalID);
     }
 }
 
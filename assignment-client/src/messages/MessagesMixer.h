@@ -15,8 +15,11 @@
 #ifndef hifi_MessagesMixer_h
 #define hifi_MessagesMixer_h
 
+#include <vector>
+
 #include <QtCore/QSharedPointer>
 
+#include <Node.h>
 #include <ThreadedAssignment.h>
 
 /// Handles assignments of type MessagesMixer - distribution of avatar data to various clients
@@ -42,7 +45,10 @@ private slots:
     void processMaxMessagesContainer();
 
 private:
-    QHash<QString, QSet<QUuid>> _channelSubscribers;
+    void removeChannelSubscriber(const QString& channel, Node::LocalID localID);
+
+    QHash<QString, std::vector<Node::LocalID>> _channelSubscribers;
+    QHash<Node::LocalID, QSet<QString>> _subscribedChannels; // by subscriber, to remove nodes from their channels
     QHash<QUuid, int> _allSubscribers;
 
     const int DEFAULT_NODE_MESSAGES_PER_SECOND = 1000;
@@ -13,6 +13,8 @@
 
 #include <limits>
 
+#include <QtCore/QRunnable>
+
 #include <NumericalConstants.h>
 #include <udt/PacketHeaders.h>
 #include <PerfStat.h>
@@ -23,6 +25,9 @@
 static QUuid DEFAULT_NODE_ID_REF;
 const quint64 TOO_LONG_SINCE_LAST_NACK = 1 * USECS_PER_SECOND;
 
+// decoded edit packets are applied back to back under one write lock, for up to this long before letting readers in
+const quint64 MAX_EDIT_BATCH_LOCK_USECS = 5 * USECS_PER_MSEC;
+
 OctreeInboundPacketProcessor::OctreeInboundPacketProcessor(OctreeServer* myServer) :
     _myServer(myServer),
     _receivedPacketCount(0),
@@ -225,6 +230,112 @@ void OctreeInboundPacketProcessor::processPacket(QSharedPointer<ReceivedMessage>
     }
 }
 
+void OctreeInboundPacketProcessor::decodeEditPacket(const Octree& tree, DecodedEditPacket& decodedPacket) {
+    ReceivedMessage& message = *decodedPacket.packet.second;
+
+    message.readPrimitive(&decodedPacket.sequence);
+
+    quint64 sentAt;
+    message.readPrimitive(&sentAt);
+
+    quint64 arrivedAt = usecTimestampNow();
+    decodedPacket.transitTime = (sentAt < arrivedAt) ? arrivedAt - sentAt : 0;
+
+    while (message.getBytesLeftToRead() > 0) {
+        auto editData = reinterpret_cast<const unsigned char*>(message.getRawMessage() + message.getPosition());
+        auto edit = tree.decodeEditPacketData(message.getType(), editData, message.getBytesLeftToRead());
+        if (!edit || edit->processedBytes <= 0) {
+            break;
+        }
+
+        // skip to next edit record in the packet
+        message.seek(message.getPosition() + edit->processedBytes);
+        decodedPacket.edits.push_back(std::move(edit));
+    }
+}
+
+void OctreeInboundPacketProcessor::processPackets(std::vector<NodeSharedReceivedMessagePair>& packets) {
+    auto tree = _myServer->getOctree();
+    if (_shuttingDown || !tree) {
+        ReceivedPacketProcessor::processPackets(packets);
+        return;
+    }
+
+    class DecodeTask : public QRunnable {
+    public:
+        DecodeTask(const Octree& tree, DecodedEditPacket& decodedPacket) : _tree(tree), _decodedPacket(decodedPacket) {}
+        void run() override { decodeEditPacket(_tree, _decodedPacket); }
+    private:
+        const Octree& _tree;
+        DecodedEditPacket& _decodedPacket;
+    };
+
+    // decoding doesn't need the tree, so the edits are all decoded in parallel before taking its lock
+    std::vector<DecodedEditPacket> decodedPackets(packets.size());
+    int numDecodable = 0;
+    auto packetIt = packets.begin();
+    for (auto& decodedPacket : decodedPackets) {
+        decodedPacket.packet = *packetIt++;
+        decodedPacket.isDecodable = tree->canDecodeEditPacketType(decodedPacket.packet.second->getType());
+        if (decodedPacket.isDecodable) {
+            ++numDecodable;
+        }
+    }
+
+    for (auto& decodedPacket : decodedPackets) {
+        if (decodedPacket.isDecodable) {
+            if (numDecodable > 1) {
+                _decodePool.start(new DecodeTask(*tree, decodedPacket));
+            } else {
+                decodeEditPacket(*tree, decodedPacket);
+            }
+        }
+    }
+    _decodePool.waitForDone();
+
+    // then applied in the order they came in, as many packets to a write lock as fit in MAX_EDIT_BATCH_LOCK_USECS
+    size_t next = 0;
+    while (next < decodedPackets.size()) {
+        if (!decodedPackets[next].isDecodable) {
+            auto& packetPair = decodedPackets[next].packet;
+            processPacket(packetPair.second, packetPair.first);
+            _lastWindowProcessedPackets++;
+            midProcess();
+            ++next;
+            continue;
+        }
+
+        quint64 startLock = usecTimestampNow();
+        tree->withWriteLock([&] {
+            quint64 startBatch = usecTimestampNow();
+            quint64 lockWaitTime = startBatch - startLock;
+
+            do {
+                auto& decodedPacket = decodedPackets[next];
+                auto& sendingNode = decodedPacket.packet.first;
+                _receivedPacketCount++;
+
+                quint64 startProcess = usecTimestampNow();
+                for (auto& edit : decodedPacket.edits) {
+                    tree->processDecodedEdit(*decodedPacket.packet.second, *edit, sendingNode);
+                }
+                quint64 processTime = usecTimestampNow() - startProcess;
+
+                trackInboundPacket(sendingNode ? sendingNode->getUUID() : QUuid(), decodedPacket.sequence,
+                                   decodedPacket.transitTime, (int)decodedPacket.edits.size(), processTime, lockWaitTime);
+                _lastWindowProcessedPackets++;
+
+                // only the first packet of the batch waited on the lock
+                lockWaitTime = 0;
+                ++next;
+            } while (next < decodedPackets.size() && decodedPackets[next].isDecodable &&
+                     usecTimestampNow() - startBatch < MAX_EDIT_BATCH_LOCK_USECS);
+        });
+
+        midProcess();
+    }
+}
+
 void OctreeInboundPacketProcessor::trackInboundPacket(const QUuid& nodeUUID, unsigned short int sequence, quint64 transitTime,
             int editsInPacket, quint64 processTime, quint64 lockWaitTime) {
 
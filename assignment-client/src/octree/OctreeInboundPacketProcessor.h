@@ -14,7 +14,12 @@
 #ifndef hifi_OctreeInboundPacketProcessor_h
 #define hifi_OctreeInboundPacketProcessor_h
 
+#include <vector>
+
 #include <QtCore/QSharedPointer>
+#include <QtCore/QThreadPool>
+
+#include <Octree.h>
 
 #include <ReceivedPacketProcessor.h>
 
@@ -81,12 +86,24 @@ public:
 protected:
 
     virtual void processPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode) override;
+    virtual void processPackets(std::vector<NodeSharedReceivedMessagePair>& packets) override;
 
     virtual uint32_t getMaxWait() const override;
     virtual void preProcess() override;
     virtual void midProcess() override;
 
 private:
+    // an edit packet whose edits the tree decoded ahead of applying them
+    struct DecodedEditPacket {
+        NodeSharedReceivedMessagePair packet;
+        bool isDecodable { false };
+        unsigned short int sequence { 0 };
+        quint64 transitTime { 0 };
+        std::vector<Octree::DecodedEditPointer> edits;
+    };
+
+    static void decodeEditPacket(const Octree& tree, DecodedEditPacket& decodedPacket);
+
     int sendNackPackets();
 
 private:
@@ -106,6 +123,8 @@ private:
     QReadWriteLock _senderStatsLock;
 
     std::atomic<uint64_t> _lastNackTime;
+
+    QThreadPool _decodePool;
     bool _shuttingDown;
 };
 #endif // hifi_OctreeInboundPacketProcessor_h
@@ -0,0 +1,114 @@
+//
+//  OctreeSendPool.cpp
+//  assignment-client/src/octree
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "OctreeSendPool.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include <QtCore/QCoreApplication>
+
+#include "OctreeSendThread.h"
+#include "OctreeServerConsts.h"
+
+OctreeSendPool::OctreeSendPool(int numThreads) {
+    qDebug() << "Sending to nodes from a pool of" << numThreads << "threads";
+
+    for (int i = 0; i < numThreads; ++i) {
+        _workers.emplace_back(new Worker(*this));
+        _workers.back()->setObjectName(QString("Octree Send Pool %1").arg(i));
+        _workers.back()->start();
+    }
+}
+
+OctreeSendPool::~OctreeSendPool() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _isStopping = true;
+    }
+    _workCondition.notify_all();
+
+    for (auto& worker : _workers) {
+        worker->wait();
+    }
+}
+
+void OctreeSendPool::add(OctreeSendThread* sendThread) {
+    assert(!sendThread->isThreaded());
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto worker = std::min_element(_workers.begin(), _workers.end(), [](const auto& a, const auto& b) {
+            return a->schedule.size() < b->schedule.size();
+        })->get();
+
+        sendThread->moveToThread(worker);
+        worker->schedule.push_back({ sendThread, Clock::now() });
+        _assignments[sendThread] = worker;
+    }
+    _workCondition.notify_all();
+}
+
+void OctreeSendPool::remove(OctreeSendThread* sendThread) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    auto it = _assignments.find(sendThread);
+    if (it == _assignments.end()) {
+        return;
+    }
+
+    Worker* worker = it->second;
+    _serviceCompleteCondition.wait(lock, [&] { return worker->inService != sendThread; });
+
+    _assignments.erase(sendThread);
+    auto& schedule = worker->schedule;
+    schedule.erase(std::remove_if(schedule.begin(), schedule.end(), [&](const Entry& entry) {
+        return entry.sendThread == sendThread;
+    }), schedule.end());
+}
+
+void OctreeSendPool::Worker::run() {
+    static const auto SEND_INTERVAL = std::chrono::microseconds(OCTREE_SEND_INTERVAL_USECS);
+
+    std::unique_lock<std::mutex> lock(_pool._mutex);
+    while (!_pool._isStopping) {
+        if (schedule.empty()) {
+            _pool._workCondition.wait(lock);
+            continue;
+        }
+
+        auto now = Clock::now();
+        if (schedule.front().nextSend > now) {
+            _pool._workCondition.wait_until(lock, schedule.front().nextSend);
+            continue;
+        }
+
+        Entry entry = schedule.front();
+        schedule.pop_front();
+        inService = entry.sendThread;
+        lock.unlock();
+
+        // what a threaded send state would have processed from its own event loop
+        QCoreApplication::sendPostedEvents(entry.sendThread);
+        bool keepSending = entry.sendThread->sendToNode();
+
+        lock.lock();
+        inService = nullptr;
+        _pool._serviceCompleteCondition.notify_all();
+
+        if (keepSending) {
+            entry.nextSend = now + SEND_INTERVAL;
+            schedule.push_back(entry);
+        } else {
+            // it's done, tell the server like its thread finishing would (it can't be destroyed while we hold the lock)
+            _pool._assignments.erase(entry.sendThread);
+            emit entry.sendThread->finished();
+        }
+    }
+}
@@ -0,0 +1,77 @@
+//
+//  OctreeSendPool.h
+//  assignment-client/src/octree
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_OctreeSendPool_h
+#define vircadia_OctreeSendPool_h
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <QtCore/QThread>
+
+#include <PortableHighResolutionClock.h>
+
+class OctreeSendThread;
+
+// Sends to every node from a small, fixed set of worker threads instead of one OctreeSendThread thread per node.
+//
+// Each send state is given to the worker with the fewest and lives on that worker's thread from then on, so that the
+// queued signals it gets from the tree are still delivered on the thread that sends for it. A worker goes round its
+// send states in turn, each one at most once per send interval, and each turn is limited by the state's time budget.
+class OctreeSendPool {
+public:
+    using Clock = p_high_resolution_clock;
+
+    OctreeSendPool(int numThreads);
+    ~OctreeSendPool();
+
+    // the send state must not be threaded, and is moved to the worker's thread
+    void add(OctreeSendThread* sendThread);
+
+    // stops servicing the send state - blocks while a worker is in the middle of sending for it
+    void remove(OctreeSendThread* sendThread);
+
+    int getNumThreads() const { return (int)_workers.size(); }
+
+private:
+    Q_DISABLE_COPY(OctreeSendPool)
+
+    struct Entry {
+        OctreeSendThread* sendThread;
+        Clock::time_point nextSend;
+    };
+
+    class Worker : public QThread {
+    public:
+        Worker(OctreeSendPool& pool) : _pool(pool) {}
+
+        void run() override;
+
+        std::deque<Entry> schedule;
+        OctreeSendThread* inService { nullptr };
+
+    private:
+        OctreeSendPool& _pool;
+    };
+
+    std::mutex _mutex;
+    std::condition_variable _workCondition;
+    std::condition_variable _serviceCompleteCondition;
+
+    std::vector<std::unique_ptr<Worker>> _workers;
+    std::unordered_map<OctreeSendThread*, Worker*> _assignments;
+    bool _isStopping { false };
+};
+
+#endif // vircadia_OctreeSendPool_h
@@ -14,6 +14,7 @@
 #include <chrono>
 #include <thread>
 
+#include <Gzip.h>
 #include <NodeList.h>
 #include <NumericalConstants.h>
 #include <udt/PacketHeaders.h>
@@ -67,14 +68,40 @@ void OctreeSendThread::setIsShuttingDown() {
 
 
 bool OctreeSendThread::process() {
+    quint64  start = usecTimestampNow();
+
+    if (!sendToNode()) {
+        return false; // exit early if we're shutting down
+    }
+
+    // Only sleep if we're still running and we got the lock last time we tried, otherwise try to get the lock asap
+    if (isStillRunning()) {
+        // dynamically sleep until we need to fire off the next set of octree elements
+        int elapsed = (usecTimestampNow() - start);
+        int usecToSleep =  OCTREE_SEND_INTERVAL_USECS - elapsed;
+
+        if (usecToSleep <= 0) {
+            const int MIN_USEC_TO_SLEEP = 1;
+            usecToSleep = MIN_USEC_TO_SLEEP;
+        }
+
+        {
+            PerformanceWarning warn(false,"OctreeSendThread... usleep()",false,&_usleepTime,&_usleepCalls);
+            std::this_thread::sleep_for(std::chrono::microseconds(usecToSleep));
+        }
+
+    }
+
+    return isStillRunning();  // keep running till they terminate us
+}
+
+bool OctreeSendThread::sendToNode() {
     if (_isShuttingDown) {
         return false; // exit early if we're shutting down
     }
 
     OctreeServer::didProcess(this);
 
-    quint64  start = usecTimestampNow();
-
     // we'd better have a server at this point, or we're in trouble
     assert(_myServer);
 
@@ -97,29 +124,7 @@ bool OctreeSendThread::process() {
         }
     }
 
-    if (_isShuttingDown) {
-        return false; // exit early if we're shutting down
-    }
-
-    // Only sleep if we're still running and we got the lock last time we tried, otherwise try to get the lock asap
-    if (isStillRunning()) {
-        // dynamically sleep until we need to fire off the next set of octree elements
-        int elapsed = (usecTimestampNow() - start);
-        int usecToSleep =  OCTREE_SEND_INTERVAL_USECS - elapsed;
-
-        if (usecToSleep <= 0) {
-            const int MIN_USEC_TO_SLEEP = 1;
-            usecToSleep = MIN_USEC_TO_SLEEP;
-        }
-
-        {
-            PerformanceWarning warn(false,"OctreeSendThread... usleep()",false,&_usleepTime,&_usleepCalls);
-            std::this_thread::sleep_for(std::chrono::microseconds(usecToSleep));
-        }
-
-    }
-
-    return isStillRunning();  // keep running till they terminate us
+    return !_isShuttingDown;
 }
 
 AtomicUIntStat OctreeSendThread::_usleepTime { 0 };
@@ -320,6 +325,7 @@ int OctreeSendThread::packetDistributor(SharedNodePointer node, OctreeQueryNode*
     _truePacketsSent = 0;
     _trueBytesSent = 0;
     _packetsSentThisInterval = 0;
+    _sendDeadline = _sendTimeBudget > 0 ? usecTimestampNow() + _sendTimeBudget : std::numeric_limits<quint64>::max();
 
     bool isFullScene = nodeData->shouldForceFullScene();
     if (isFullScene) {
@@ -327,6 +333,12 @@ int OctreeSendThread::packetDistributor(SharedNodePointer node, OctreeQueryNode*
         nodeData->setShouldForceFullScene(false);
     }
 
+    // the packet is always sent or reset below, so the dictionary is only ever switched between packets
+    const auto& compressionDictionary = _myServer->getCompressionDictionary();
+    bool useDictionary = !compressionDictionary.isEmpty() &&
+        nodeData->getCompressionDictionaryID() == getZlibDictionaryID(compressionDictionary);
+    nodeData->setUsesCompressionDictionary(useDictionary);
+
     if (nodeData->isPacketWaiting()) {
         // send the waiting packet
         _packetsSentThisInterval += handlePacketSend(node, nodeData);
@@ -337,6 +349,7 @@ int OctreeSendThread::packetDistributor(SharedNodePointer node, OctreeQueryNode*
     targetSize = nodeData->getAvailable() - sizeof(OCTREE_PACKET_INTERNAL_SECTION_SIZE);
 
     _packetData.changeSettings(true, targetSize); // FIXME - eventually support only compressed packets
+    _packetData.setCompressionDictionary(useDictionary ? compressionDictionary : QByteArray());
 
     // If the current view frustum has changed OR we have nothing to send, then search against
     // the current view frustum for things to send.
@@ -363,9 +376,7 @@ int OctreeSendThread::packetDistributor(SharedNodePointer node, OctreeQueryNode*
 
     quint64 start = usecTimestampNow();
 
-    _myServer->getOctree()->withReadLock([&]{
-        traverseTreeAndSendContents(node, nodeData, viewFrustumChanged, isFullScene);
-    });
+    traverseTreeAndSendContents(node, nodeData, viewFrustumChanged, isFullScene);
 
     // Here's where we can/should allow the server to send other data...
     // send the environment packet
@@ -425,6 +436,14 @@ int OctreeSendThread::packetDistributor(SharedNodePointer node, OctreeQueryNode*
     return _truePacketsSent;
 }
 
+void OctreeSendThread::withTreeReadLock(const std::function<void()>& f) {
+    quint64 lockWaitStart = usecTimestampNow();
+    _myServer->getOctree()->withReadLock([&] {
+        OctreeServer::trackTreeWaitTime((float)(usecTimestampNow() - lockWaitStart));
+        f();
+    });
+}
+
 bool OctreeSendThread::traverseTreeAndSendContents(SharedNodePointer node, OctreeQueryNode* nodeData, bool viewFrustumChanged, bool isFullScene) {
     // calculate max number of packets that can be sent during this interval
     int clientMaxPacketsPerInterval = std::max(1, (nodeData->getMaxQueryPacketsPerSecond() / INTERVALS_PER_SECOND));
@@ -441,7 +460,8 @@ bool OctreeSendThread::traverseTreeAndSendContents(SharedNodePointer node, Octre
 
     bool somethingToSend = true; // assume we have something
     bool hadSomething = hasSomethingToSend(nodeData);
-    while (somethingToSend && _packetsSentThisInterval < maxPacketsPerInterval && !nodeData->isShuttingDown()) {
+    while (somethingToSend && _packetsSentThisInterval < maxPacketsPerInterval && !nodeData->isShuttingDown() &&
+           usecTimestampNow() < _sendDeadline) {
         float compressAndWriteElapsedUsec = OctreeServer::SKIP_TIME;
         float packetSendingElapsedUsec = OctreeServer::SKIP_TIME;
 
@@ -450,7 +470,9 @@ bool OctreeSendThread::traverseTreeAndSendContents(SharedNodePointer node, Octre
         bool lastNodeDidntFit = false; // assume each node fits
         params.stopReason = EncodeBitstreamParams::UNKNOWN; // reset params.stopReason before traversal
 
-        somethingToSend = traverseTreeAndBuildNextPacketPayload(params, nodeData->getJSONParameters());
+        withTreeReadLock([&] {
+            somethingToSend = traverseTreeAndBuildNextPacketPayload(params, nodeData->getJSONParameters());
+        });
 
         if (params.stopReason == EncodeBitstreamParams::DIDNT_FIT) {
             lastNodeDidntFit = true;
@@ -474,6 +496,8 @@ bool OctreeSendThread::traverseTreeAndSendContents(SharedNodePointer node, Octre
                 // either there is room, or we've flushed and reset nodeData's data buffer
                 // so we can transfer whatever is in _packetData to nodeData
                 nodeData->writeToPacket(_packetData.getFinalizedData(), _packetData.getFinalizedSize());
+                OctreeServer::trackCompressedSection(_packetData.getUncompressedSize(), _packetData.getFinalizedSize(),
+                                                     nodeData->usesCompressionDictionary());
                 compressAndWriteElapsedUsec = (float)(usecTimestampNow()- compressAndWriteStart);
             }
 
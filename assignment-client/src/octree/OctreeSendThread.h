@@ -15,6 +15,8 @@
 #define hifi_OctreeSendThread_h
 
 #include <atomic>
+#include <functional>
+#include <limits>
 
 #include <GenericThread.h>
 #include <Node.h>
@@ -38,6 +40,13 @@ public:
 
     QUuid getNodeUuid() const { return _nodeUuid; }
 
+    // one pass of sending to the node, returns false once there's nothing more to send to it
+    // called from our own thread, or from an OctreeSendPool worker when the thread isn't threaded
+    bool sendToNode();
+
+    // how long one pass may spend sending packets, 0 is no limit
+    void setSendTimeBudget(quint64 usecs) { _sendTimeBudget = usecs; }
+
     static AtomicUIntStat _totalBytes;
     static AtomicUIntStat _totalWastedBytes;
     static AtomicUIntStat _totalPackets;
@@ -56,6 +65,10 @@ protected:
             bool viewFrustumChanged, bool isFullScene);
     virtual bool traverseTreeAndBuildNextPacketPayload(EncodeBitstreamParams& params, const QJsonObject& jsonFilters) = 0;
 
+    /// Holds the tree's read lock for the length of f only. A send pass takes it once per step (traversal, packet
+    /// payload) rather than for the whole pass, so that edits get the write lock in between steps.
+    void withTreeReadLock(const std::function<void()>& f);
+
     OctreePacketData _packetData;
     QWeakPointer<Node> _node;
     OctreeServer* _myServer { nullptr };
@@ -74,6 +87,9 @@ private:
     int _trueBytesSent { 0 }; // available for debug stats
     int _packetsSentThisInterval { 0 }; // used for bandwidth throttle condition
     bool _isShuttingDown { false };
+
+    quint64 _sendTimeBudget { 0 };
+    quint64 _sendDeadline { std::numeric_limits<quint64>::max() };
 };
 
 #endif // hifi_OctreeSendThread_h
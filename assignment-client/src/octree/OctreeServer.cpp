@@ -28,6 +28,7 @@
 #include "../AssignmentClient.h"
 
 #include "OctreeQueryNode.h"
+#include "OctreeSendPool.h"
 #include "OctreeServerConsts.h"
 #include <QtCore/QStandardPaths>
 #include <PathUtils.h>
@@ -54,6 +55,8 @@ int OctreeServer::_extraLongEncode = 0;
 int OctreeServer::_longEncode = 0;
 int OctreeServer::_shortEncode = 0;
 int OctreeServer::_noEncode = 0;
+std::atomic<int> OctreeServer::_encodeCacheHits { 0 };
+std::atomic<int> OctreeServer::_encodeCacheMisses { 0 };
 
 SimpleMovingAverage OctreeServer::_averageTreeWaitTime(MOVING_AVERAGE_SAMPLE_COUNTS);
 SimpleMovingAverage OctreeServer::_averageTreeShortWaitTime(MOVING_AVERAGE_SAMPLE_COUNTS);
@@ -76,6 +79,8 @@ int OctreeServer::_extraLongCompress = 0;
 int OctreeServer::_longCompress = 0;
 int OctreeServer::_shortCompress = 0;
 int OctreeServer::_noCompress = 0;
+std::atomic<quint64> OctreeServer::_sectionBytes[2];
+std::atomic<quint64> OctreeServer::_compressedSectionBytes[2];
 
 SimpleMovingAverage OctreeServer::_averagePacketSendingTime(MOVING_AVERAGE_SAMPLE_COUNTS);
 int OctreeServer::_noSend = 0;
@@ -104,6 +109,8 @@ void OctreeServer::resetSendingStats() {
     _longEncode = 0;
     _shortEncode = 0;
     _noEncode = 0;
+    _encodeCacheHits = 0;
+    _encodeCacheMisses = 0;
 
     _averageInsideTime.reset();
     _averageTreeWaitTime.reset();
@@ -127,6 +134,10 @@ void OctreeServer::resetSendingStats() {
     _longCompress = 0;
     _shortCompress = 0;
     _noCompress = 0;
+    for (int i = 0; i < 2; ++i) {
+        _sectionBytes[i] = 0;
+        _compressedSectionBytes[i] = 0;
+    }
 
     _averagePacketSendingTime.reset();
     _noSend = 0;
@@ -162,6 +173,20 @@ void OctreeServer::trackEncodeTime(float time) {
     }
 }
 
+void OctreeServer::trackEncodeCacheLookup(bool hit) {
+    if (hit) {
+        _encodeCacheHits++;
+    } else {
+        _encodeCacheMisses++;
+    }
+}
+
+float OctreeServer::getEncodeCacheHitRate() {
+    int hits = _encodeCacheHits;
+    int lookups = hits + _encodeCacheMisses;
+    return (lookups > 0) ? ((float)hits / (float)lookups) : 0.0f;
+}
+
 void OctreeServer::trackTreeWaitTime(float time) {
     const float MAX_SHORT_TIME = 10.0f;
     const float MAX_LONG_TIME = 100.0f;
@@ -202,6 +227,16 @@ void OctreeServer::trackCompressAndWriteTime(float time) {
     }
 }
 
+void OctreeServer::trackCompressedSection(int uncompressedBytes, int compressedBytes, bool usedDictionary) {
+    _sectionBytes[usedDictionary] += uncompressedBytes;
+    _compressedSectionBytes[usedDictionary] += compressedBytes;
+}
+
+const QByteArray& OctreeServer::getCompressionDictionary() const {
+    static const QByteArray NO_DICTIONARY;
+    return NO_DICTIONARY;
+}
+
 void OctreeServer::trackPacketSendingTime(float time) {
     if (time == SKIP_TIME) {
         _noSend++;
@@ -523,6 +558,9 @@ bool OctreeServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
         // encode
         float averageEncodeTime = getAverageEncodeTime();
         statsString += QString().sprintf("                 Average encode time:    %9.2f usecs\r\n", (double)averageEncodeTime);
+        statsString += QString().sprintf("              Encode cache hit rate:                          (%6.2f%%) samples: %12d \r\n",
+                                         (double)(getEncodeCacheHitRate() * AS_PERCENT),
+                                         (int)(_encodeCacheHits + _encodeCacheMisses));
 
         int allEncodeTimes = _noEncode + _shortEncode + _longEncode + _extraLongEncode;
 
@@ -579,6 +617,16 @@ bool OctreeServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
                                          (double)_averageExtraLongCompressTime.getAverage(),
                                          (double)(extraLongVsTotalCompress * AS_PERCENT), _extraLongCompress);
 
+        const char* SECTION_COMPRESSION_NAMES[] = { "Compression ratio without dictionary:", "   Compression ratio with dictionary:" };
+        for (int i = 0; i < 2; ++i) {
+            quint64 sectionBytes = _sectionBytes[i];
+            quint64 compressedSectionBytes = _compressedSectionBytes[i];
+            float ratio = (compressedSectionBytes > 0) ? ((float)sectionBytes / (float)compressedSectionBytes) : 0.0f;
+            statsString += QString().sprintf("%s    %9.2f        bytes compressed: %12llu \r\n",
+                                             SECTION_COMPRESSION_NAMES[i], (double)ratio, (unsigned long long)sectionBytes);
+        }
+        statsString += "\r\n";
+
         float averagePacketSendingTime = getAveragePacketSendingTime();
         statsString += QString().sprintf("         Average packet sending time:    %9.2f usecs (includes node lock)\r\n",
                                          (double)averagePacketSendingTime);
@@ -648,6 +696,8 @@ bool OctreeServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
         statsString += QString().sprintf("<b>%s Edit Statistics... <a href='/resetStats'>[RESET]</a></b>\r\n",
                                          getMyServerName());
         quint64 currentPacketsInQueue = _octreeInboundPacketProcessor->packetsToProcessCount();
+        quint64 queueCapacity = _octreeInboundPacketProcessor->getQueueCapacity();
+        quint64 droppedPackets = _octreeInboundPacketProcessor->getDroppedPacketCount();
         float incomingPPS = _octreeInboundPacketProcessor->getIncomingPPS();
         float processedPPS = _octreeInboundPacketProcessor->getProcessedPPS();
         quint64 averageTransitTimePerPacket = _octreeInboundPacketProcessor->getAverageTransitTimePerPacket();
@@ -671,6 +721,10 @@ bool OctreeServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
 
         statsString += QString("   Current Inbound Packets Queue: %1 packets \r\n")
             .arg(locale.toString((uint)currentPacketsInQueue).rightJustified(COLUMN_WIDTH, ' '));
+        statsString += QString("  Inbound Packets Queue Capacity: %1 packets \r\n")
+            .arg(locale.toString((uint)queueCapacity).rightJustified(COLUMN_WIDTH, ' '));
+        statsString += QString("         Dropped Inbound Packets: %1 packets \r\n")
+            .arg(locale.toString((uint)droppedPackets).rightJustified(COLUMN_WIDTH, ' '));
         statsString += QString("        Packets Queue Network IN: %1 PPS \r\n")
             .arg(locale.toString(incomingPPS, 'f', FLOAT_PRECISION).rightJustified(COLUMN_WIDTH, ' '));
         statsString += QString("    Packets Queue Processing OUT: %1 PPS \r\n")
@@ -724,7 +778,7 @@ bool OctreeServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
             averageLockWaitTimePerElement = senderStats.getAverageLockWaitTimePerElement();
             totalElementsProcessed = senderStats.getTotalElementsProcessed();
             totalPacketsProcessed = senderStats.getTotalPacketsProcessed();
-
+            droppedPackets = _octreeInboundPacketProcessor->getDroppedPacketCountFrom(senderID);
 
             auto received = senderStats._incomingEditSequenceNumberStats.getReceived();
             auto expected = senderStats._incomingEditSequenceNumberStats.getExpectedReceived();
@@ -741,6 +795,8 @@ bool OctreeServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
                 .arg(locale.toString((uint)totalPacketsProcessed).rightJustified(COLUMN_WIDTH, ' '));
             statsString += QString("              Total Inbound Elements: %1 elements\r\n")
                 .arg(locale.toString((uint)totalElementsProcessed).rightJustified(COLUMN_WIDTH, ' '));
+            statsString += QString("             Dropped Inbound Packets: %1 packets\r\n")
+                .arg(locale.toString((uint)droppedPackets).rightJustified(COLUMN_WIDTH, ' '));
             statsString += QString().sprintf("     Average Inbound Elements/Packet: %f elements/packet\r\n",
                                              (double)averageElementsPerPacket);
             statsString += QString("         Average Transit Time/Packet: %1 usecs\r\n")
@@ -880,7 +936,19 @@ OctreeServer::UniqueSendThread OctreeServer::createSendThread(const SharedNodePo
 
     // we want to be notified when the thread finishes
     connect(sendThread.get(), &GenericThread::finished, this, &OctreeServer::removeSendThread);
-    sendThread->initialize(true);
+
+    if (_sendPoolThreads > 0) {
+        if (!_sendPool) {
+            _sendPool.reset(new OctreeSendPool(_sendPoolThreads));
+        }
+
+        // the pool's workers send for it, a turn at a time
+        sendThread->initialize(false);
+        sendThread->setSendTimeBudget(_sendTimeBudgetPerNode);
+        _sendPool->add(sendThread.get());
+    } else {
+        sendThread->initialize(true);
+    }
 
     return sendThread;
 }
@@ -888,6 +956,10 @@ OctreeServer::UniqueSendThread OctreeServer::createSendThread(const SharedNodePo
 void OctreeServer::removeSendThread() {
     // If the object has been deleted since the event was queued, sender() will return nullptr
     if (auto sendThread = qobject_cast<OctreeSendThread*>(sender())) {
+        if (_sendPool) {
+            _sendPool->remove(sendThread);
+        }
+
         // This deletes the unique_ptr, so sendThread is destructed after that line
         _sendThreads.erase(sendThread->getNodeUuid());
     }
@@ -904,6 +976,9 @@ void OctreeServer::handleOctreeQueryPacket(QSharedPointer<ReceivedMessage> messa
         if (it == _sendThreads.end()) {
             _sendThreads.emplace(senderNode->getUUID(), createSendThread(senderNode));
         } else if (it->second->isShuttingDown()) {
+            if (_sendPool) {
+                _sendPool->remove(it->second.get());
+            }
             _sendThreads.erase(it); // Remove right away and wait on thread to be
 
             _sendThreads.emplace(senderNode->getUUID(), createSendThread(senderNode));
@@ -1049,7 +1124,11 @@ void OctreeServer::readConfiguration() {
         qDebug() << "persistFilePath=" << _persistFilePath;
         qDebug() << "persisAbsoluteFilePath=" << _persistAbsoluteFilePath;
 
-        _persistAsFileType = "json.gz";
+        // binary snapshots load faster, what's exported and backed up is still JSON
+        bool persistBinary = false;
+        readOptionBool(QString("persistBinary"), settingsSectionObject, persistBinary);
+        _persistAsFileType = persistBinary ? "bin" : "json.gz";
+        qDebug() << "persistAsFileType=" << _persistAsFileType;
 
         _persistInterval = OctreePersistThread::DEFAULT_PERSIST_INTERVAL;
         int result { -1 };
@@ -1063,6 +1142,9 @@ void OctreeServer::readConfiguration() {
         readOptionBool(QString("persistFileDownload"), settingsSectionObject, _persistFileDownload);
         qDebug() << "persistFileDownload=" << _persistFileDownload;
 
+        readOptionBool(QString("persistJournal"), settingsSectionObject, _persistJournal);
+        qDebug() << "persistJournal=" << _persistJournal;
+
     } else {
         qDebug("persistFilename= DISABLED");
     }
@@ -1098,6 +1180,10 @@ void OctreeServer::readConfiguration() {
     qDebug("packetsPerSecondTotalMax=%d _packetsTotalPerInterval=%d",
                     packetsPerSecondTotalMax, _packetsTotalPerInterval);
 
+    // Check to see if nodes should be sent to from a pool of threads instead of a thread each
+    readOptionInt(QString("sendPoolThreads"), settingsSectionObject, _sendPoolThreads);
+    readOptionInt(QString("sendTimeBudgetPerNode"), settingsSectionObject, _sendTimeBudgetPerNode);
+    qDebug("sendPoolThreads=%d sendTimeBudgetPerNode=%d", _sendPoolThreads, _sendTimeBudgetPerNode);
 
     readAdditionalConfiguration(settingsSectionObject);
 }
@@ -1190,7 +1276,7 @@ void OctreeServer::domainSettingsRequestComplete() {
 
         // now set up PersistThread
         _persistManager = new OctreePersistThread(_tree, _persistAbsoluteFilePath, _persistInterval, _debugTimestampNow,
-                                                 _persistAsFileType);
+                                                 _persistAsFileType, _persistJournal);
         _persistManager->moveToThread(&_persistThread);
         connect(&_persistThread, &QThread::finished, _persistManager, &QObject::deleteLater);
         connect(&_persistThread, &QThread::started, _persistManager, [this] {
@@ -1299,12 +1385,16 @@ void OctreeServer::aboutToFinish() {
     for (auto& it : _sendThreads) {
         auto& sendThread = *it.second;
         sendThread.setIsShuttingDown();
+        if (_sendPool) {
+            _sendPool->remove(&sendThread);
+        }
         sendThread.terminate();
     }
 
     // Clear will destruct all the unique_ptr to OctreeSendThreads which will call the GenericThread's dtor
     // which waits on the thread to be done before returning
     _sendThreads.clear(); // Cleans up all the send threads.
+    _sendPool.reset();
 
     if (_persistManager) {
         _persistThread.quit();
@@ -1453,6 +1543,7 @@ void OctreeServer::sendStatsPacket() {
     dataObject1["4. totalBytesOctalCodes"] = (double)OctreePacketData::getTotalBytesOfOctalCodes();
     dataObject1["5. totalBytesBitMasks"] = (double)OctreePacketData::getTotalBytesOfBitMasks();
     dataObject1["6. totalBytesBitMasks"] = (double)OctreePacketData::getTotalBytesOfColor();
+    dataObject1["7. encodeCacheHitRate"] = getEncodeCacheHitRate();
 
     QJsonObject timingArray1;
     timingArray1["1. avgLoopTime"] = getAverageLoopTime();
@@ -1475,6 +1566,7 @@ void OctreeServer::sendStatsPacket() {
         dataArray2["1. packetQueue"] = (double)_octreeInboundPacketProcessor->packetsToProcessCount();
         dataArray2["2. totalPackets"] = (double)_octreeInboundPacketProcessor->getTotalPacketsProcessed();
         dataArray2["3. totalElements"] = (double)_octreeInboundPacketProcessor->getTotalElementsProcessed();
+        dataArray2["4. droppedPackets"] = (double)_octreeInboundPacketProcessor->getDroppedPacketCount();
 
         timingArray2["1. avgTransitTimePerPacket"] = (double)_octreeInboundPacketProcessor->getAverageTransitTimePerPacket();
         timingArray2["2. avgProcessTimePerPacket"] = (double)_octreeInboundPacketProcessor->getAverageProcessTimePerPacket();
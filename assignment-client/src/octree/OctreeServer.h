@@ -12,6 +12,7 @@
 #ifndef hifi_OctreeServer_h
 #define hifi_OctreeServer_h
 
+#include <atomic>
 #include <memory>
 
 #include <QStringList>
@@ -24,6 +25,7 @@
 #include <ThreadedAssignment.h>
 
 #include "OctreePersistThread.h"
+#include "OctreeSendPool.h"
 #include "OctreeSendThread.h"
 #include "OctreeServerConsts.h"
 #include "OctreeInboundPacketProcessor.h"
@@ -83,6 +85,8 @@ public:
     virtual bool hasSpecialPacketsToSend(const SharedNodePointer& node) { return false; }
     virtual int sendSpecialPackets(const SharedNodePointer& node, OctreeQueryNode* queryNode, int& packetsSent) { return 0; }
     virtual QString serverSubclassStats() { return QString(); }
+    // the dictionary to compress the sections of packets to viewers that have it against, empty for none
+    virtual const QByteArray& getCompressionDictionary() const;
     virtual void trackSend(const QUuid& dataID, quint64 dataLastEdited, const QUuid& viewerNode) { }
     virtual void trackViewerGone(const QUuid& viewerNode) { }
 
@@ -94,6 +98,9 @@ public:
     static void trackEncodeTime(float time);
     static float getAverageEncodeTime() { return _averageEncodeTime.getAverage(); }
 
+    static void trackEncodeCacheLookup(bool hit);
+    static float getEncodeCacheHitRate();
+
     static void trackInsideTime(float time) { _averageInsideTime.updateAverage(time); }
     static float getAverageInsideTime() { return _averageInsideTime.getAverage(); }
 
@@ -109,6 +116,8 @@ public:
     static void trackCompressAndWriteTime(float time);
     static float getAverageCompressAndWriteTime() { return _averageCompressAndWriteTime.getAverage(); }
 
+    static void trackCompressedSection(int uncompressedBytes, int compressedBytes, bool usedDictionary);
+
     static void trackPacketSendingTime(float time);
     static float getAveragePacketSendingTime() { return _averagePacketSendingTime.getAverage(); }
 
@@ -198,12 +207,18 @@ protected:
 
     std::chrono::milliseconds _persistInterval;
     bool _persistFileDownload;
+    bool _persistJournal { false };
     int _maxBackupVersions;
 
     time_t _started;
     quint64 _startedUSecs;
     QString _safeServerName;
-    
+
+    // 0 gives each node a send thread of its own
+    int _sendPoolThreads { 0 };
+    int _sendTimeBudgetPerNode { DEFAULT_SEND_TIME_BUDGET_PER_NODE_USECS };
+    std::unique_ptr<OctreeSendPool> _sendPool;
+
     SendThreads _sendThreads;
 
     static int _clientCount;
@@ -217,6 +232,8 @@ protected:
     static int _longEncode;
     static int _shortEncode;
     static int _noEncode;
+    static std::atomic<int> _encodeCacheHits;
+    static std::atomic<int> _encodeCacheMisses;
 
     static SimpleMovingAverage _averageInsideTime;
 
@@ -242,6 +259,10 @@ protected:
     static int _shortCompress;
     static int _noCompress;
 
+    // uncompressed and compressed bytes of the sections compressed without and with the dictionary
+    static std::atomic<quint64> _sectionBytes[2];
+    static std::atomic<quint64> _compressedSectionBytes[2];
+
     static SimpleMovingAverage _averagePacketSendingTime;
     static int _noSend;
 
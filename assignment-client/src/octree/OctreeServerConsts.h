@@ -26,4 +26,8 @@ const int MAX_FILENAME_LENGTH = 1024;
 const int INTERVALS_PER_SECOND = 90;
 const int OCTREE_SEND_INTERVAL_USECS = (1000 * 1000)/INTERVALS_PER_SECOND;
 
+/// When sending from a pool of threads, this is how long one node's turn can take before the worker moves on to the
+/// next node. What's left of the node's traversal is picked up again on its next turn.
+const int DEFAULT_SEND_TIME_BUDGET_PER_NODE_USECS = 2000;
+
 #endif // hifi_OctreeServerConsts_h
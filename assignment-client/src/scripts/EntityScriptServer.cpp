@@ -13,6 +13,9 @@
 
 #include <mutex>
 
+#include <QtCore/QJsonArray>
+#include <QtCore/QThread>
+
 #include <AudioConstants.h>
 #include <AudioInjectorManager.h>
 #include <ClientServerUtils.h>
@@ -54,6 +57,35 @@ void messageHandler(QtMsgType type, const QMessageLogContext& context, const QSt
 
 int EntityScriptServer::_entitiesScriptEngineCount = 0;
 
+static const int MAX_ENTITIES_SCRIPT_ENGINES = 4;
+
+static size_t getEntitiesScriptEngineIndex(const EntityItemID& entityID, size_t numEngines) {
+    return qHash(entityID) % numEngines;
+}
+
+// Passes calls the EntityScriptingInterface makes, from any of the engines, on to the engine running the entity's script.
+// It's replaced rather than changed when the engines are, so it doesn't need a lock.
+class EntitiesScriptEngineRouter : public EntitiesScriptEngineProvider {
+public:
+    EntitiesScriptEngineRouter(const std::vector<ScriptEnginePointer>& engines) : _engines(engines) {}
+
+    void callEntityScriptMethod(const EntityItemID& entityID, const QString& methodName,
+                                const QStringList& params, const QUuid& remoteCallerID) override {
+        getEngine(entityID)->callEntityScriptMethod(entityID, methodName, params, remoteCallerID);
+    }
+
+    QFuture<QVariant> getLocalEntityScriptDetails(const EntityItemID& entityID) override {
+        return getEngine(entityID)->getLocalEntityScriptDetails(entityID);
+    }
+
+private:
+    const ScriptEnginePointer& getEngine(const EntityItemID& entityID) const {
+        return _engines[getEntitiesScriptEngineIndex(entityID, _engines.size())];
+    }
+
+    const std::vector<ScriptEnginePointer> _engines;
+};
+
 EntityScriptServer::EntityScriptServer(ReceivedMessage& message) : ThreadedAssignment(message) {
     qInstallMessageHandler(messageHandler);
 
@@ -130,7 +162,8 @@ void EntityScriptServer::handleEntityScriptGetStatusPacket(QSharedPointer<Receiv
         replyPacketList->writePrimitive(messageID);
 
         EntityScriptDetails details;
-        if (_entitiesScriptEngine->getEntityScriptDetails(entityID, details)) {
+        auto entitiesScriptEngine = getEntitiesScriptEngine(entityID);
+        if (entitiesScriptEngine && entitiesScriptEngine->getEntityScriptDetails(entityID, details)) {
             replyPacketList->writePrimitive(true);
             replyPacketList->writePrimitive(details.status);
             replyPacketList->writeString(details.errorInfo);
@@ -172,10 +205,29 @@ void EntityScriptServer::handleSettings() {
 
     qDebug() << QString("Received entity script server settings, Max Entity PPS: %1, Entity PPS Per Entity Script: %2")
                 .arg(_maxEntityPPS).arg(_entityPPSPerScript);
+
+    // profiling can be turned on and off without restarting the scripts
+    static const QString PROFILE_SCRIPTS_OPTION = "profile_scripts";
+    bool profileScripts = entityScriptServerSettings[PROFILE_SCRIPTS_OPTION].toBool();
+    if (profileScripts != _profileScripts) {
+        _profileScripts = profileScripts;
+        qDebug() << "Script profiling" << (_profileScripts ? "enabled" : "disabled");
+        for (const auto& engine : _entitiesScriptEngines) {
+            if (_profileScripts) {
+                engine->resetProfile();
+                engine->startProfiling();
+            } else {
+                engine->stopProfiling();
+            }
+        }
+    }
 }
 
 void EntityScriptServer::updateEntityPPS() {
-    int numRunningScripts = _entitiesScriptEngine->getNumRunningEntityScripts();
+    int numRunningScripts = 0;
+    for (const auto& engine : _entitiesScriptEngines) {
+        numRunningScripts += engine->getNumRunningEntityScripts();
+    }
     int pps;
     if (std::numeric_limits<int>::max() / _entityPPSPerScript < numRunningScripts) {
         qWarning() << QString("Integer multiplication would overflow, clamping to maxint: %1 * %2").arg(numRunningScripts).arg(_entityPPSPerScript);
@@ -236,7 +288,7 @@ void EntityScriptServer::pushLogs() {
 
 void EntityScriptServer::handleEntityScriptCallMethodPacket(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode) {
 
-    if (_entitiesScriptEngine && _entityViewer.getTree() && !_shuttingDown) {
+    if (!_entitiesScriptEngines.empty() && _entityViewer.getTree() && !_shuttingDown) {
         auto entityID = QUuid::fromRfc4122(receivedMessage->read(NUM_BYTES_RFC4122_UUID));
 
         auto method = receivedMessage->readString();
@@ -250,7 +302,7 @@ void EntityScriptServer::handleEntityScriptCallMethodPacket(QSharedPointer<Recei
             params << paramString;
         }
 
-        _entitiesScriptEngine->callEntityScriptMethod(entityID, method, params, senderNode->getUUID());
+        getEntitiesScriptEngine(entityID)->callEntityScriptMethod(entityID, method, params, senderNode->getUUID());
     }
 }
 
@@ -281,8 +333,8 @@ void EntityScriptServer::run() {
         NodeType::EntityServer, NodeType::MessagesMixer, NodeType::AssetServer
     });
 
-    // Setup Script Engine
-    resetEntitiesScriptEngine();
+    // Setup Script Engines
+    resetEntitiesScriptEngines();
 
     auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
     entityScriptingInterface->init();
@@ -444,7 +496,7 @@ void EntityScriptServer::selectAudioFormat(const QString& selectedCodecName) {
     }
 }
 
-void EntityScriptServer::resetEntitiesScriptEngine() {
+ScriptEnginePointer EntityScriptServer::createEntitiesScriptEngine(bool updatesEntityTree) {
     auto engineName = QString("about:Entities %1").arg(++_entitiesScriptEngineCount);
     auto newEngine = scriptEngineFactory(ScriptEngine::ENTITY_SERVER_SCRIPT, NO_SCRIPT, engineName);
 
@@ -461,50 +513,76 @@ void EntityScriptServer::resetEntitiesScriptEngine() {
     connect(newEngine.data(), &ScriptEngine::warningMessage, scriptEngines, &ScriptEngines::onWarningMessage);
     connect(newEngine.data(), &ScriptEngine::infoMessage, scriptEngines, &ScriptEngines::onInfoMessage);
 
-    connect(newEngine.data(), &ScriptEngine::update, this, [this] {
-        _entityViewer.queryOctree();
-        _entityViewer.getTree()->preUpdate();
-        _entityViewer.getTree()->update();
-    });
+    // the tree only needs updating once a frame, whichever engine's frame it is
+    if (updatesEntityTree) {
+        connect(newEngine.data(), &ScriptEngine::update, this, [this] {
+            _entityViewer.queryOctree();
+            _entityViewer.getTree()->preUpdate();
+            _entityViewer.getTree()->update();
+        });
+    }
+
+    connect(newEngine.data(), &ScriptEngine::entityScriptDetailsUpdated, this, &EntityScriptServer::updateEntityPPS);
 
     scriptEngines->runScriptInitializers(newEngine);
     newEngine->runInThread();
-    auto newEngineSP = qSharedPointerCast<EntitiesScriptEngineProvider>(newEngine);
-    // On the entity script server, these are the same
-    DependencyManager::get<EntityScriptingInterface>()->setPersistentEntitiesScriptEngine(newEngineSP);
-    DependencyManager::get<EntityScriptingInterface>()->setNonPersistentEntitiesScriptEngine(newEngineSP);
+    if (_profileScripts) {
+        newEngine->startProfiling();
+    }
+    return newEngine;
+}
+
+void EntityScriptServer::resetEntitiesScriptEngines() {
+    for (const auto& engine : _entitiesScriptEngines) {
+        disconnect(engine.data(), &ScriptEngine::entityScriptDetailsUpdated, this, &EntityScriptServer::updateEntityPPS);
+    }
 
-    if (_entitiesScriptEngine) {
-        disconnect(_entitiesScriptEngine.data(), &ScriptEngine::entityScriptDetailsUpdated,
-                   this, &EntityScriptServer::updateEntityPPS);
+    // leave a core for the entity tree, the network and the audio
+    int numEngines = std::max(1, std::min(QThread::idealThreadCount() - 1, MAX_ENTITIES_SCRIPT_ENGINES));
+    std::vector<ScriptEnginePointer> newEngines;
+    for (int i = 0; i < numEngines; i++) {
+        newEngines.push_back(createEntitiesScriptEngine(i == 0));
     }
 
-    _entitiesScriptEngine.swap(newEngine);
-    connect(_entitiesScriptEngine.data(), &ScriptEngine::entityScriptDetailsUpdated,
-            this, &EntityScriptServer::updateEntityPPS);
+    QSharedPointer<EntitiesScriptEngineProvider> router(new EntitiesScriptEngineRouter(newEngines));
+    // On the entity script server, these are the same
+    DependencyManager::get<EntityScriptingInterface>()->setPersistentEntitiesScriptEngine(router);
+    DependencyManager::get<EntityScriptingInterface>()->setNonPersistentEntitiesScriptEngine(router);
+
+    _entitiesScriptEngines.swap(newEngines);
+    _lastScriptExecutionUsecs.assign(_entitiesScriptEngines.size(), 0);
+}
+
+ScriptEnginePointer EntityScriptServer::getEntitiesScriptEngine(const EntityItemID& entityID) const {
+    if (_entitiesScriptEngines.empty()) {
+        return ScriptEnginePointer();
+    }
+    return _entitiesScriptEngines[getEntitiesScriptEngineIndex(entityID, _entitiesScriptEngines.size())];
 }
 
 
 void EntityScriptServer::clear() {
-    // unload and stop the engine
-    if (_entitiesScriptEngine) {
+    // unload and stop the engines, all of them before waiting on any
+    for (const auto& engine : _entitiesScriptEngines) {
         // do this here (instead of in deleter) to avoid marshalling unload signals back to this thread
-        _entitiesScriptEngine->unloadAllEntityScripts();
-        _entitiesScriptEngine->stop();
-        _entitiesScriptEngine->waitTillDoneRunning();
+        engine->unloadAllEntityScripts();
+        engine->stop();
+    }
+    for (const auto& engine : _entitiesScriptEngines) {
+        engine->waitTillDoneRunning();
     }
 
     _entityViewer.clear();
 
-    // reset the engine
+    // reset the engines
     if (!_shuttingDown) {
-        resetEntitiesScriptEngine();
+        resetEntitiesScriptEngines();
     }
 }
 
 void EntityScriptServer::shutdownScriptEngine() {
-    if (_entitiesScriptEngine) {
-        _entitiesScriptEngine->disconnectNonEssentialSignals(); // disconnect all slots/signals from the script engine, except essential
+    for (const auto& engine : _entitiesScriptEngines) {
+        engine->disconnectNonEssentialSignals(); // disconnect all slots/signals from the script engine, except essential
     }
     _shuttingDown = true;
 
@@ -513,7 +591,7 @@ void EntityScriptServer::shutdownScriptEngine() {
     auto scriptEngines = DependencyManager::get<ScriptEngines>();
     scriptEngines->shutdownScripting();
 
-    _entitiesScriptEngine.clear();
+    _entitiesScriptEngines.clear();
 
     auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
     // our entity tree is going to go away so tell that to the EntityScriptingInterface
@@ -531,8 +609,8 @@ void EntityScriptServer::addingEntity(const EntityItemID& entityID) {
 }
 
 void EntityScriptServer::deletingEntity(const EntityItemID& entityID) {
-    if (_entityViewer.getTree() && !_shuttingDown && _entitiesScriptEngine) {
-        _entitiesScriptEngine->unloadEntityScript(entityID, true);
+    if (_entityViewer.getTree() && !_shuttingDown && !_entitiesScriptEngines.empty()) {
+        getEntitiesScriptEngine(entityID)->unloadEntityScript(entityID, true);
     }
 }
 
@@ -543,20 +621,21 @@ void EntityScriptServer::entityServerScriptChanging(const EntityItemID& entityID
 }
 
 void EntityScriptServer::checkAndCallPreload(const EntityItemID& entityID, bool forceRedownload) {
-    if (_entityViewer.getTree() && !_shuttingDown && _entitiesScriptEngine) {
+    if (_entityViewer.getTree() && !_shuttingDown && !_entitiesScriptEngines.empty()) {
+        auto entitiesScriptEngine = getEntitiesScriptEngine(entityID);
 
         EntityItemPointer entity = _entityViewer.getTree()->findEntityByEntityItemID(entityID);
         EntityScriptDetails details;
-        bool isRunning = _entitiesScriptEngine->getEntityScriptDetails(entityID, details);
+        bool isRunning = entitiesScriptEngine->getEntityScriptDetails(entityID, details);
         if (entity && (forceRedownload || !isRunning || details.scriptText != entity->getServerScripts())) {
             if (isRunning) {
-                _entitiesScriptEngine->unloadEntityScript(entityID, true);
+                entitiesScriptEngine->unloadEntityScript(entityID, true);
             }
 
             QString scriptUrl = entity->getServerScripts();
             if (!scriptUrl.isEmpty()) {
                 scriptUrl = DependencyManager::get<ResourceManager>()->normalizeURL(scriptUrl);
-                _entitiesScriptEngine->loadEntityScript(entityID, scriptUrl, forceRedownload);
+                entitiesScriptEngine->loadEntityScript(entityID, scriptUrl, forceRedownload);
             }
         }
     }
@@ -573,10 +652,36 @@ void EntityScriptServer::sendStatsPacket() {
 
     QJsonObject scriptEngineStats;
     int numberRunningScripts = 0;
-    const auto scriptEngine = _entitiesScriptEngine;
-    if (scriptEngine) {
-        numberRunningScripts = scriptEngine->getNumRunningEntityScripts();
+    auto now = usecTimestampNow();
+    auto statsPeriodUsecs = _lastStatsTime > 0 && now > _lastStatsTime ? now - _lastStatsTime : 0;
+    for (size_t i = 0; i < _entitiesScriptEngines.size(); i++) {
+        const auto& engine = _entitiesScriptEngines[i];
+        int engineRunningScripts = engine->getNumRunningEntityScripts();
+        numberRunningScripts += engineRunningScripts;
+
+        // the share of the time since the last stats that the engine's thread spent running its scripts
+        auto executionUsecs = engine->getScriptExecutionUsecs();
+        float usage = statsPeriodUsecs > 0 ?
+            (float)(executionUsecs - _lastScriptExecutionUsecs[i]) / (float)statsPeriodUsecs : 0.0f;
+        _lastScriptExecutionUsecs[i] = executionUsecs;
+
+        QJsonObject engineStats;
+        engineStats["number_running_scripts"] = engineRunningScripts;
+        engineStats["script_cpu_usage"] = usage;
+        if (_profileScripts) {
+            // the slowest functions since the last stats, a whole profile would be too much to send every time
+            static const int MAX_PROFILED_FUNCTIONS = 10;
+            auto profile = engine->getProfile();
+            engine->resetProfile();
+            QJsonArray functions;
+            for (int j = 0; j < std::min(profile.size(), MAX_PROFILED_FUNCTIONS); j++) {
+                functions.push_back(QJsonObject::fromVariantMap(profile[j].toMap()));
+            }
+            engineStats["slowest_functions"] = functions;
+        }
+        scriptEngineStats[QString("engine_%1").arg(i)] = engineStats;
     }
+    _lastStatsTime = now;
     scriptEngineStats["number_running_scripts"] = numberRunningScripts;
     statsObject["script_engine_stats"] = scriptEngineStats;
     
@@ -620,7 +725,7 @@ void EntityScriptServer::handleOctreePacket(QSharedPointer<ReceivedMessage> mess
             // pull out the piggybacked packet and create a new QSharedPointer<NLPacket> for it
             int piggyBackedSizeWithHeader = message->getSize() - statsMessageLength;
 
-            auto buffer = std::unique_ptr<char[]>(new char[piggyBackedSizeWithHeader]);
+            auto buffer = udt::PacketBufferPool::allocate(piggyBackedSizeWithHeader);
             memcpy(buffer.get(), message->getRawMessage() + statsMessageLength, piggyBackedSizeWithHeader);
 
             auto newPacket = NLPacket::fromReceivedPacket(std::move(buffer), piggyBackedSizeWithHeader, message->getSenderSockAddr());
@@ -62,7 +62,9 @@ private:
     void negotiateAudioFormat();
     void selectAudioFormat(const QString& selectedCodecName);
 
-    void resetEntitiesScriptEngine();
+    void resetEntitiesScriptEngines();
+    ScriptEnginePointer createEntitiesScriptEngine(bool updatesEntityTree);
+    ScriptEnginePointer getEntitiesScriptEngine(const EntityItemID& entityID) const;
     void clear();
     void shutdownScriptEngine();
 
@@ -76,13 +78,17 @@ private:
     bool _shuttingDown { false };
 
     static int _entitiesScriptEngineCount;
-    ScriptEnginePointer _entitiesScriptEngine;
+    // each on its own thread, entity scripts are spread across them by entity ID so that a slow one holds up fewer others
+    std::vector<ScriptEnginePointer> _entitiesScriptEngines;
+    std::vector<quint64> _lastScriptExecutionUsecs;
+    quint64 _lastStatsTime { 0 };
     SimpleEntitySimulationPointer _entitySimulation;
     EntityEditPacketSender _entityEditSender;
     EntityTreeHeadlessViewer _entityViewer;
 
     int _maxEntityPPS { DEFAULT_MAX_ENTITY_PPS };
     int _entityPPSPerScript { DEFAULT_ENTITY_PPS_PER_SCRIPT };
+    bool _profileScripts { false };
 
     std::set<QUuid> _logListeners;
     std::vector<std::pair<QUuid, quint64>> _killedListeners;
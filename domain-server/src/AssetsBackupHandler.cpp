@@ -12,6 +12,7 @@
 #include "AssetsBackupHandler.h"
 
 #include <QJsonDocument>
+#include <QCryptographicHash>
 #include <QDate>
 #include <QtCore/QLoggingCategory>
 
@@ -38,6 +39,8 @@ using namespace std;
 static const QString ASSETS_DIR { "/assets/" };
 static const QString MAPPINGS_FILE { "mappings.json" };
 static const QString ZIP_ASSETS_FOLDER { "files" };
+static const QString PARTIAL_ASSET_EXTENSION { ".part" };
+static const qint64 ASSET_COPY_CHUNK_SIZE { 1024 * 1024 };
 static const chrono::minutes MAX_REFRESH_TIME { 5 };
 
 Q_DECLARE_LOGGING_CATEGORY(asset_backup)
@@ -313,11 +316,19 @@ std::pair<bool, QString> AssetsBackupHandler::recoverBackup(const QString& backu
             return { false, errorStr };
         }
 
+        // assets are named by the hash of their contents, so only the ones we don't already have are extracted
+        set<AssetUtils::AssetHash> assetsToExtract;
+        for (const auto& mapping : emplaced_backup->mappings) {
+            if (_assetsOnDisk.find(mapping.second) == end(_assetsOnDisk)) {
+                assetsToExtract.insert(mapping.second);
+            }
+        }
+
         QuaZipDir zipDir { &zip, ZIP_ASSETS_FOLDER };
 
         auto assetNames = zipDir.entryList(QDir::Files);
         for (const auto& asset : assetNames) {
-            if (AssetUtils::isValidHash(asset)) {
+            if (assetsToExtract.find(asset) != end(assetsToExtract)) {
                 if (!zip.setCurrentFile(zipDir.filePath(asset))) {
                     qCCritical(asset_backup) << "Failed to find" << asset << "while recovering backup";
                     qCCritical(asset_backup) << "    Error:" << zip.getZipError();
@@ -331,7 +342,7 @@ std::pair<bool, QString> AssetsBackupHandler::recoverBackup(const QString& backu
                     continue;
                 }
 
-                writeAssetFile(asset, zipFile.readAll());
+                extractAssetFile(asset, zipFile);
             }
         }
 
@@ -394,22 +405,34 @@ void AssetsBackupHandler::consolidateBackup(const QString& backupName, QuaZip& z
         return;
     }
 
+    // several paths can map to the same asset, which only goes in the zip once
+    set<AssetUtils::AssetHash> hashes;
     for (const auto& mapping : it->mappings) {
-        const auto& hash = mapping.second;
+        hashes.insert(mapping.second);
+    }
 
-        QDir assetsDir { _assetsDirectory };
+    QDir assetsDir { _assetsDirectory };
+    for (const auto& hash : hashes) {
         QFile file { assetsDir.filePath(hash) };
         if (!file.open(QFile::ReadOnly)) {
             qCCritical(asset_backup) << "Could not open asset file" << file.fileName();
             continue;
         }
 
+        // most assets (textures, models, sounds) are compressed already, so they aren't worth deflating hard
         QuaZipFile zipFile { &zip };
-        if (!zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo(ZIP_ASSETS_FOLDER + "/" + hash))) {
+        if (!zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo(ZIP_ASSETS_FOLDER + "/" + hash), nullptr, 0,
+                          Z_DEFLATED, Z_BEST_SPEED)) {
             qCDebug(asset_backup) << "Could not open zip file:" << zipFile.getZipError();
             continue;
         }
-        zipFile.write(file.readAll());
+        QByteArray chunk;
+        while (!(chunk = file.read(ASSET_COPY_CHUNK_SIZE)).isEmpty()) {
+            if (zipFile.write(chunk) != chunk.size()) {
+                qCCritical(asset_backup) << "Could not write asset file" << file.fileName() << "to zip";
+                break;
+            }
+        }
         zipFile.close();
         if (zipFile.getZipError() != UNZ_OK) {
             qCDebug(asset_backup) << "Could not close zip file: " << zipFile.getZipError();
@@ -520,6 +543,44 @@ bool AssetsBackupHandler::writeAssetFile(const AssetUtils::AssetHash& hash, cons
     return true;
 }
 
+bool AssetsBackupHandler::extractAssetFile(const AssetUtils::AssetHash& hash, QIODevice& source) {
+    QDir assetsDir { _assetsDirectory };
+    QFile file { assetsDir.filePath(hash + PARTIAL_ASSET_EXTENSION) };
+    if (!file.open(QFile::WriteOnly)) {
+        qCCritical(asset_backup) << "Could not open asset file for write:" << file.fileName();
+        return false;
+    }
+
+    QCryptographicHash contentHash { QCryptographicHash::Sha256 };
+    QByteArray chunk;
+    while (!(chunk = source.read(ASSET_COPY_CHUNK_SIZE)).isEmpty()) {
+        contentHash.addData(chunk);
+        if (file.write(chunk) != chunk.size()) {
+            qCCritical(asset_backup) << "Could not write data to file" << file.fileName();
+            file.remove();
+            return false;
+        }
+    }
+    file.close();
+
+    if (QString(contentHash.result().toHex()) != hash) {
+        qCCritical(asset_backup) << "Asset file in backup does not match its hash:" << hash;
+        file.remove();
+        return false;
+    }
+
+    QFile::remove(assetsDir.filePath(hash));
+    if (!file.rename(assetsDir.filePath(hash))) {
+        qCCritical(asset_backup) << "Could not move asset file into place:" << file.fileName();
+        file.remove();
+        return false;
+    }
+
+    _assetsOnDisk.insert(hash);
+
+    return true;
+}
+
 void AssetsBackupHandler::computeServerStateDifference(const AssetUtils::Mappings& currentMappings,
                                                        const AssetUtils::Mappings& newMappings) {
     _mappingsLeftToSet.reserve((int)newMappings.size());
@@ -15,6 +15,7 @@
 #include <set>
 #include <map>
 
+#include <QIODevice>
 #include <QObject>
 #include <QTimer>
 #include <QJsonDocument>
@@ -57,6 +58,8 @@ private:
     void downloadMissingFiles(const AssetUtils::Mappings& mappings);
     void downloadNextMissingFile();
     bool writeAssetFile(const AssetUtils::AssetHash& hash, const QByteArray& data);
+    // copies an asset out of a backup zip a chunk at a time, keeping it only if its contents match its hash
+    bool extractAssetFile(const AssetUtils::AssetHash& hash, QIODevice& source);
 
     void computeServerStateDifference(const AssetUtils::Mappings& currentMappings,
                                       const AssetUtils::Mappings& newMappings);
@@ -340,19 +340,19 @@ void DomainContentBackupManager::recoverFromBackup(MiniPromise::Promise promise,
     });
 }
 
-void DomainContentBackupManager::recoverFromUploadedBackup(MiniPromise::Promise promise, QByteArray uploadedBackup, QString username) {
+void DomainContentBackupManager::recoverFromUploadedBackup(MiniPromise::Promise promise, QString uploadedFilename, QString username) {
 
     if (QThread::currentThread() != thread()) {
         QMetaObject::invokeMethod(this, "recoverFromUploadedBackup", Q_ARG(MiniPromise::Promise, promise),
-                                  Q_ARG(QByteArray, uploadedBackup), Q_ARG(QString, username));
+                                  Q_ARG(QString, uploadedFilename), Q_ARG(QString, username));
         return;
     }
 
     qDebug() << "Recovering from uploaded content archive";
 
-    // create a buffer and then a QuaZip from that buffer
-    QBuffer uploadedBackupBuffer { &uploadedBackup };
-    QuaZip uploadedZip { &uploadedBackupBuffer };
+    // read the archive from where it was stored, rather than from memory, since content archives can be large
+    QFile uploadedBackupFile { uploadedFilename };
+    QuaZip uploadedZip { &uploadedBackupFile };
 
     QString backupName = MANUAL_BACKUP_PREFIX + "uploaded.zip";
     bool success = recoverFromBackupZip(backupName, uploadedZip, username, QString());
@@ -96,7 +96,7 @@ public slots:
     void getAllBackupsAndStatus(MiniPromise::Promise promise);
     void createManualBackup(MiniPromise::Promise promise, const QString& name);
     void recoverFromBackup(MiniPromise::Promise promise, const QString& backupName, const QString& username);
-    void recoverFromUploadedBackup(MiniPromise::Promise promise, QByteArray uploadedBackup, QString username);
+    void recoverFromUploadedBackup(MiniPromise::Promise promise, QString uploadedFilename, QString username);
     void recoverFromUploadedFile(MiniPromise::Promise promise, QString uploadedFilename, QString username, QString sourceFilename);
     void deleteBackup(MiniPromise::Promise promise, const QString& backupName);
 
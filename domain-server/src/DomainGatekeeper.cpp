@@ -15,6 +15,7 @@
 #include <openssl/err.h>
 #include <openssl/rsa.h>
 #include <openssl/x509.h>
+#include <functional>
 #include <random>
 
 #include <QtCore/QDataStream>
@@ -123,8 +124,14 @@ void DomainGatekeeper::processConnectRequestPacket(QSharedPointer<ReceivedMessag
             }
         }
 
+        // the signature is checked on a pool thread, this request is processed again once it has been
+        if (!username.isEmpty() && startUserSignatureCheck(message, username, usernameSignature)) {
+            return;
+        }
+
         node = processAgentConnectRequest(nodeConnection, username, usernameSignature, 
                                           domainUsername, domainTokens.value(0), domainTokens.value(1));
+        _userSignatureChecks.remove(usernameSignature);
     }
 
     if (node) {
@@ -688,6 +695,81 @@ void DomainGatekeeper::cleanupICEPeerForNode(const QUuid& nodeID) {
     }
 }
 
+QByteArray DomainGatekeeper::hashUsernameWithToken(const QString& lowerUsername, const QUuid& connectionToken) {
+    QByteArray lowercaseUsernameUTF8 = lowerUsername.toUtf8();
+    return QCryptographicHash::hash(lowercaseUsernameUTF8.append(connectionToken.toRfc4122()), QCryptographicHash::Sha256);
+}
+
+int DomainGatekeeper::checkUserSignature(const QByteArray& publicKey, const QByteArray& usernameWithToken,
+                                         const QByteArray& usernameSignature) {
+    const unsigned char* publicKeyData = reinterpret_cast<const unsigned char*>(publicKey.constData());
+
+    // first load up the public key into an RSA struct
+    RSA* rsaPublicKey = d2i_RSA_PUBKEY(NULL, &publicKeyData, publicKey.size());
+    if (!rsaPublicKey) {
+        return -1;
+    }
+
+    int decryptResult = RSA_verify(NID_sha256,
+                                   reinterpret_cast<const unsigned char*>(usernameWithToken.constData()),
+                                   usernameWithToken.size(),
+                                   reinterpret_cast<const unsigned char*>(usernameSignature.constData()),
+                                   usernameSignature.size(),
+                                   rsaPublicKey);
+
+    // free up the public key, we don't need it anymore
+    RSA_free(rsaPublicKey);
+
+    return decryptResult == 1 ? 1 : 0;
+}
+
+class UserSignatureCheckTask : public QRunnable {
+public:
+    UserSignatureCheckTask(std::function<void()> check) : _check(check) {}
+    void run() override { _check(); }
+
+private:
+    std::function<void()> _check;
+};
+
+bool DomainGatekeeper::startUserSignatureCheck(QSharedPointer<ReceivedMessage> message, const QString& username,
+                                               const QByteArray& usernameSignature) {
+    if (usernameSignature.isEmpty() || _userSignatureChecks.contains(usernameSignature)) {
+        return false;
+    }
+    if (_pendingUserSignatureChecks.contains(usernameSignature)) {
+        // this is a duplicate of a request that's already being checked
+        return true;
+    }
+
+    // without a key and token the request is processed right away, which asks for what's missing
+    auto lowerUsername = username.toLower();
+    UserSignatureCheck check;
+    check.publicKey = _userPublicKeys.value(lowerUsername).first;
+    check.connectionToken = _connectionTokenHash.value(lowerUsername);
+    if (check.publicKey.isEmpty() || check.connectionToken.isNull()) {
+        return false;
+    }
+
+    _pendingUserSignatureChecks.insert(usernameSignature);
+    QByteArray usernameWithToken = hashUsernameWithToken(lowerUsername, check.connectionToken);
+    _userSignatureCheckPool.start(new UserSignatureCheckTask([this, message, usernameWithToken, usernameSignature, check] {
+        UserSignatureCheck result = check;
+        result.result = checkUserSignature(check.publicKey, usernameWithToken, usernameSignature);
+        QMetaObject::invokeMethod(this, [this, message, usernameSignature, result] {
+            finishUserSignatureCheck(message, usernameSignature, result);
+        });
+    }));
+    return true;
+}
+
+void DomainGatekeeper::finishUserSignatureCheck(QSharedPointer<ReceivedMessage> message, const QByteArray& usernameSignature,
+                                                const UserSignatureCheck& check) {
+    _pendingUserSignatureChecks.remove(usernameSignature);
+    _userSignatureChecks.insert(usernameSignature, check);
+    processConnectRequestPacket(message);
+}
+
 bool DomainGatekeeper::verifyUserSignature(const QString& username,
                                            const QByteArray& usernameSignature,
                                            const SockAddr& senderSockAddr) {
@@ -702,48 +784,36 @@ bool DomainGatekeeper::verifyUserSignature(const QString& username,
 
     if (!publicKeyArray.isEmpty() && !connectionToken.isNull()) {
         // if we do have a public key for the user, check for a signature match
+        // the pool may already have checked it with the same key and token
+        int checkResult;
+        auto check = _userSignatureChecks.find(usernameSignature);
+        if (check != _userSignatureChecks.end() && check->publicKey == publicKeyArray
+                && check->connectionToken == connectionToken) {
+            checkResult = check->result;
+        } else {
+            checkResult = checkUserSignature(publicKeyArray, hashUsernameWithToken(lowerUsername, connectionToken),
+                                             usernameSignature);
+        }
 
-        const unsigned char* publicKeyData = reinterpret_cast<const unsigned char*>(publicKeyArray.constData());
-
-        // first load up the public key into an RSA struct
-        RSA* rsaPublicKey = d2i_RSA_PUBKEY(NULL, &publicKeyData, publicKeyArray.size());
-
-        QByteArray lowercaseUsernameUTF8 = lowerUsername.toUtf8();
-        QByteArray usernameWithToken = QCryptographicHash::hash(lowercaseUsernameUTF8.append(connectionToken.toRfc4122()),
-                                                                QCryptographicHash::Sha256);
-
-        if (rsaPublicKey) {
-            int decryptResult = RSA_verify(NID_sha256,
-                                           reinterpret_cast<const unsigned char*>(usernameWithToken.constData()),
-                                           usernameWithToken.size(),
-                                           reinterpret_cast<const unsigned char*>(usernameSignature.constData()),
-                                           usernameSignature.size(),
-                                           rsaPublicKey);
-
-            if (decryptResult == 1) {
-                qDebug() << "Username signature matches for" << username;
-
-                // free up the public key and remove connection token before we return
-                RSA_free(rsaPublicKey);
-                _connectionTokenHash.remove(username);
+        if (checkResult == 1) {
+            qDebug() << "Username signature matches for" << username;
 
-                return true;
+            // remove connection token before we return
+            _connectionTokenHash.remove(username);
 
-            } else {
-                // we only send back a LoginErrorMetaverse if this wasn't an "optimistic" key
-                // (a key that we hoped would work but is probably stale)
+            return true;
 
-                if (!senderSockAddr.isNull() && !isOptimisticKey) {
-                    qDebug() << "Error decrypting metaverse username signature for" << username << "- denying connection.";
-                    sendConnectionDeniedPacket("Error decrypting username signature.", senderSockAddr,
-                        DomainHandler::ConnectionRefusedReason::LoginErrorMetaverse);
-                } else if (!senderSockAddr.isNull()) {
-                    qDebug() << "Error decrypting metaverse username signature for" << username << "with optimistic key -"
-                        << "re-requesting public key and delaying connection";
-                }
+        } else if (checkResult == 0) {
+            // we only send back a LoginErrorMetaverse if this wasn't an "optimistic" key
+            // (a key that we hoped would work but is probably stale)
 
-                // free up the public key, we don't need it anymore
-                RSA_free(rsaPublicKey);
+            if (!senderSockAddr.isNull() && !isOptimisticKey) {
+                qDebug() << "Error decrypting metaverse username signature for" << username << "- denying connection.";
+                sendConnectionDeniedPacket("Error decrypting username signature.", senderSockAddr,
+                    DomainHandler::ConnectionRefusedReason::LoginErrorMetaverse);
+            } else if (!senderSockAddr.isNull()) {
+                qDebug() << "Error decrypting metaverse username signature for" << username << "with optimistic key -"
+                    << "re-requesting public key and delaying connection";
             }
 
         } else {
@@ -21,6 +21,7 @@
 #include <QtCore/QObject>
 #include <QtNetwork/QNetworkReply>
 #include <QtCore/QSharedPointer>
+#include <QtCore/QThreadPool>
 
 #include <DomainHandler.h>
 
@@ -110,7 +111,23 @@ private:
     void pingPunchForConnectingPeer(const SharedNetworkPeer& peer);
     
     void requestUserPublicKey(const QString& username, bool isOptimistic = false);
-    
+
+    // Username signatures are checked on a thread pool while there's a public key and connection token to check them
+    // with, their connect requests are then processed again with the result.
+    class UserSignatureCheck {
+    public:
+        QByteArray publicKey;
+        QUuid connectionToken;
+        int result; // 1 if the signature matches, 0 if it doesn't, -1 if the public key couldn't be used
+    };
+    static QByteArray hashUsernameWithToken(const QString& lowerUsername, const QUuid& connectionToken);
+    static int checkUserSignature(const QByteArray& publicKey, const QByteArray& usernameWithToken,
+                                  const QByteArray& usernameSignature);
+    bool startUserSignatureCheck(QSharedPointer<ReceivedMessage> message, const QString& username,
+                                 const QByteArray& usernameSignature);
+    void finishUserSignatureCheck(QSharedPointer<ReceivedMessage> message, const QByteArray& usernameSignature,
+                                  const UserSignatureCheck& check);
+
     DomainServer* _server;
     
     std::unordered_map<QUuid, PendingAssignedNodeData> _pendingAssignedNodes;
@@ -162,6 +179,10 @@ private:
     DomainUserIdentities _verifiedDomainUserIdentities;  // Verified domain users.
 
     QHash<QString, QStringList> _domainGroupMemberships;  // <domainUserName, [domainGroupName]>
+
+    QHash<QByteArray, UserSignatureCheck> _userSignatureChecks; // by signature, for the connect requests processed next
+    QSet<QByteArray> _pendingUserSignatureChecks;
+    QThreadPool _userSignatureCheckPool; // last, so that its checks are done before the rest is destroyed
 };
 
 
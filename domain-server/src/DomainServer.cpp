@@ -16,6 +16,7 @@
 #include <random>
 #include <iostream>
 #include <chrono>
+#include <functional>
 
 #include <QDir>
 #include <QJsonDocument>
@@ -1253,7 +1254,11 @@ void DomainServer::processListRequestPacket(QSharedPointer<ReceivedMessage> mess
     }
 
     // update the NodeInterestSet in case there have been any changes
-    nodeData->setNodeInterestSet(safeInterestSet);
+    if (safeInterestSet != nodeData->getNodeInterestSet()) {
+        // the lists it was sent so far could be missing the nodes it's now interested in
+        nodeData->setMinimumDomainListDeltaVersion(++_domainListVersion);
+        nodeData->setNodeInterestSet(safeInterestSet);
+    }
 
     // update the connecting hostname in case it has changed
     nodeData->setPlaceName(nodeRequestData.placeName);
@@ -1261,6 +1266,10 @@ void DomainServer::processListRequestPacket(QSharedPointer<ReceivedMessage> mess
     // client-side send time of last connect/domain list request
     nodeData->setLastDomainCheckinTimestamp(nodeRequestData.lastPingTimestamp);
 
+    // the other nodes are sent this one again if its sockets or permissions changed
+    updateDomainListEntry(sendingNode);
+    nodeData->setDomainListVersion(nodeRequestData.domainListVersion);
+
     sendDomainListToNode(sendingNode, message->getFirstPacketReceiveTime(), message->getSenderSockAddr(), false);
 }
 
@@ -1340,6 +1349,7 @@ void DomainServer::handleConnectedNode(SharedNodePointer newNode, quint64 reques
     }
 
     // send out this node to our other connected nodes
+    updateDomainListEntry(newNode);
     broadcastNewNode(newNode);
 }
 
@@ -1347,12 +1357,49 @@ void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 r
     const int NUM_DOMAIN_LIST_EXTENDED_HEADER_BYTES = NUM_BYTES_RFC4122_UUID + NLPacket::NUM_BYTES_LOCALID +
         NUM_BYTES_RFC4122_UUID + NLPacket::NUM_BYTES_LOCALID + 4;
 
+    DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
+    auto limitedNodeList = DependencyManager::get<LimitedNodeList>();
+
+    // only send what changed since the list this node last received, unless it's new or too far behind
+    quint32 sinceVersion = nodeData->getDomainListVersion();
+    bool isDelta = !newConnection && sinceVersion > 0 && sinceVersion <= _domainListVersion
+        && sinceVersion >= nodeData->getMinimumDomainListDeltaVersion() && sinceVersion >= _oldestDomainListDeltaVersion;
+
+    // collect the entries first, the header has how many there are so that the node knows when it has all of them
+    std::vector<SharedNodePointer> listedNodes;
+    std::vector<QUuid> removedNodes;
+
+    // store the nodeInterestSet on this DomainServerNodeData, in case it has changed
+    auto& nodeInterestSet = nodeData->getNodeInterestSet();
+
+    // DTLSServerSession* dtlsSession = _isUsingDTLS ? _dtlsSessions[senderSockAddr] : NULL;
+    if (nodeInterestSet.size() > 0 && nodeData->isAuthenticated()) {
+        // if this authenticated node has any interest types, send back those nodes as well
+        limitedNodeList->eachNode([this, node, isDelta, sinceVersion, &listedNodes](const SharedNodePointer& otherNode) {
+            if (otherNode->getUUID() != node->getUUID() && isInInterestSet(node, otherNode)) {
+                auto otherNodeData = static_cast<DomainServerNodeData*>(otherNode->getLinkedData());
+                if (otherNodeData->getDomainListEntry().isEmpty()) {
+                    updateDomainListEntry(otherNode);
+                }
+                if (!isDelta || otherNodeData->getDomainListEntryVersion() > sinceVersion) {
+                    listedNodes.push_back(otherNode);
+                }
+            }
+        });
+
+        if (isDelta) {
+            for (auto it = _removedNodes.rbegin(); it != _removedNodes.rend() && it->version > sinceVersion; ++it) {
+                if (nodeInterestSet.contains(it->type)) {
+                    removedNodes.push_back(it->uuid);
+                }
+            }
+        }
+    }
+
     // setup the extended header for the domain list packets
     // this data is at the beginning of each of the domain list packets
     QByteArray extendedHeader(NUM_DOMAIN_LIST_EXTENDED_HEADER_BYTES, 0);
     QDataStream extendedHeaderStream(&extendedHeader, QIODevice::WriteOnly);
-    DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
-    auto limitedNodeList = DependencyManager::get<LimitedNodeList>();
 
     extendedHeaderStream << limitedNodeList->getSessionUUID();
     extendedHeaderStream << limitedNodeList->getSessionLocalID();
@@ -1364,35 +1411,33 @@ void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 r
     extendedHeaderStream << quint64(duration_cast<microseconds>(system_clock::now().time_since_epoch()).count());
     extendedHeaderStream << quint64(duration_cast<microseconds>(p_high_resolution_clock::now().time_since_epoch()).count()) - requestPacketReceiveTime;
     extendedHeaderStream << newConnection;
+    extendedHeaderStream << _domainListVersion;
+    extendedHeaderStream << isDelta;
+    extendedHeaderStream << quint32(listedNodes.size() + removedNodes.size());
     auto domainListPackets = NLPacketList::create(PacketType::DomainList, extendedHeader);
 
     // always send the node their own UUID back
     QDataStream domainListStream(domainListPackets.get());
 
-    // store the nodeInterestSet on this DomainServerNodeData, in case it has changed
-    auto& nodeInterestSet = nodeData->getNodeInterestSet();
-
-    if (nodeInterestSet.size() > 0) {
+    for (const auto& otherNode : listedNodes) {
+        // since we're about to add a node to the packet we start a segment
+        domainListPackets->startSegment();
 
-        // DTLSServerSession* dtlsSession = _isUsingDTLS ? _dtlsSessions[senderSockAddr] : NULL;
-        if (nodeData->isAuthenticated()) {
-            // if this authenticated node has any interest types, send back those nodes as well
-            limitedNodeList->eachNode([this, node, &domainListPackets, &domainListStream](const SharedNodePointer& otherNode) {
-                if (otherNode->getUUID() != node->getUUID() && isInInterestSet(node, otherNode)) {
-                    // since we're about to add a node to the packet we start a segment
-                    domainListPackets->startSegment();
+        // don't send avatar nodes to other avatars, that will come from avatar mixer
+        domainListStream << false;
+        domainListPackets->write(static_cast<DomainServerNodeData*>(otherNode->getLinkedData())->getDomainListEntry());
 
-                    // don't send avatar nodes to other avatars, that will come from avatar mixer
-                    domainListStream << *otherNode.data();
+        // pack the secret that these two nodes will use to communicate with each other
+        domainListStream << connectionSecretForNodes(node, otherNode);
 
-                    // pack the secret that these two nodes will use to communicate with each other
-                    domainListStream << connectionSecretForNodes(node, otherNode);
+        // we've added the node we wanted so end the segment now
+        domainListPackets->endSegment();
+    }
 
-                    // we've added the node we wanted so end the segment now
-                    domainListPackets->endSegment();
-                }
-            });
-        }
+    for (const auto& removedNode : removedNodes) {
+        domainListPackets->startSegment();
+        domainListStream << true << removedNode;
+        domainListPackets->endSegment();
     }
 
     // send an empty list to the node, in case there were no other nodes
@@ -1402,6 +1447,21 @@ void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 r
     limitedNodeList->sendPacketList(std::move(domainListPackets), *node);
 }
 
+void DomainServer::updateDomainListEntry(const SharedNodePointer& node) {
+    DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
+    if (!nodeData) {
+        return;
+    }
+
+    QByteArray entry;
+    QDataStream entryStream(&entry, QIODevice::WriteOnly);
+    entryStream << *node.data();
+
+    if (entry != nodeData->getDomainListEntry()) {
+        nodeData->setDomainListEntry(entry, ++_domainListVersion);
+    }
+}
+
 QUuid DomainServer::connectionSecretForNodes(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB) {
     DomainServerNodeData* nodeAData = static_cast<DomainServerNodeData*>(nodeA->getLinkedData());
     DomainServerNodeData* nodeBData = static_cast<DomainServerNodeData*>(nodeB->getLinkedData());
@@ -2039,11 +2099,30 @@ void DomainServer::processOctreeDataRequestMessage(QSharedPointer<ReceivedMessag
     nodeList->sendPacketList(std::move(reply), message->getSenderSockAddr());
 }
 
+class NodeStatsTask : public QRunnable {
+public:
+    NodeStatsTask(std::function<void()> parse) : _parse(parse) {}
+    void run() override { _parse(); }
+
+private:
+    std::function<void()> _parse;
+};
+
 void DomainServer::processNodeJSONStatsPacket(QSharedPointer<ReceivedMessage> packetList, SharedNodePointer sendingNode) {
-    auto nodeData = static_cast<DomainServerNodeData*>(sendingNode->getLinkedData());
-    if (nodeData) {
-        nodeData->updateJSONStats(packetList->getMessage());
+    if (!sendingNode->getLinkedData()) {
+        return;
     }
+
+    // the stats are parsed on the pool, only the result is kept on this thread
+    _statsProcessingPool.start(new NodeStatsTask([this, packetList, sendingNode] {
+        QJsonObject stats = DomainServerNodeData::parseJSONStats(packetList->getMessage());
+        QMetaObject::invokeMethod(this, [packetList, sendingNode, stats] {
+            auto nodeData = static_cast<DomainServerNodeData*>(sendingNode->getLinkedData());
+            if (nodeData) {
+                nodeData->setJSONStats(stats, packetList->getFirstPacketReceiveTime());
+            }
+        });
+    }));
 }
 
 QJsonObject DomainServer::jsonForSocket(const SockAddr& socket) {
@@ -2431,17 +2510,13 @@ bool DomainServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
                 // see if we have a node that matches this ID
                 SharedNodePointer matchingNode = nodeList->nodeWithUUID(matchingUUID);
                 if (matchingNode) {
-                    // create a QJsonDocument with the stats QJsonObject
-                    QJsonObject statsObject =
-                        static_cast<DomainServerNodeData*>(matchingNode->getLinkedData())->getStatsJSONObject();
-
-                    // add the node type to the JSON data for output purposes
-                    statsObject["node_type"] = NodeType::getNodeTypeName(matchingNode->getType()).toLower().replace(' ', '-');
-
-                    QJsonDocument statsDocument(statsObject);
+                    // the stats are only serialized again once the node has sent new ones
+                    auto nodeData = static_cast<DomainServerNodeData*>(matchingNode->getLinkedData());
+                    const QByteArray& statsJSON =
+                        nodeData->getStatsJSON(NodeType::getNodeTypeName(matchingNode->getType()).toLower().replace(' ', '-'));
 
                     // send the response
-                    connection->respond(HTTPConnection::StatusCode200, statsDocument.toJson(), qPrintable(JSON_MIME_TYPE));
+                    connection->respond(HTTPConnection::StatusCode200, statsJSON, qPrintable(JSON_MIME_TYPE));
 
                     // tell the caller we processed the request
                     return true;
@@ -3399,6 +3474,14 @@ void DomainServer::nodeKilled(SharedNodePointer node) {
         }
     }
 
+    // the nodes that check in next are sent this node's removal, for as long as we remember it
+    static const size_t MAX_REMOVED_NODES_HISTORY = 1000;
+    _removedNodes.push_back({ ++_domainListVersion, node->getUUID(), node->getType() });
+    if (_removedNodes.size() > MAX_REMOVED_NODES_HISTORY) {
+        _oldestDomainListDeltaVersion = _removedNodes.front().version;
+        _removedNodes.pop_front();
+    }
+
     broadcastNodeDisconnect(node);
 }
 
@@ -3853,7 +3936,23 @@ void DomainServer::handleDomainContentReplacementFromURLRequest(QSharedPointer<R
 
         qDebug() << "Downloading JSON from: " << modelsURL.toString(QUrl::FullyEncoded);
 
-        connect(reply, &QNetworkReply::finished, [this, reply, modelsURL, username]() {
+        // content archives can be several GB, so they are written to a temporary file as they arrive
+        std::shared_ptr<QTemporaryFile> downloadedArchive;
+        if (modelsURL.fileName().endsWith(".zip")) {
+            static const QString TEMPORARY_CONTENT_FILEPATH { QDir::tempPath() + "/hifiDownloadedContent_XXXXXX.zip" };
+            downloadedArchive = std::make_shared<QTemporaryFile>(TEMPORARY_CONTENT_FILEPATH);
+            if (!downloadedArchive->open()) {
+                qWarning() << "Could not create a temporary file for the content archive from" << modelsURL;
+                reply->abort();
+                reply->deleteLater();
+                return;
+            }
+            connect(reply, &QNetworkReply::readyRead, [reply, downloadedArchive]() {
+                downloadedArchive->write(reply->readAll());
+            });
+        }
+
+        connect(reply, &QNetworkReply::finished, [this, reply, modelsURL, username, downloadedArchive]() {
             QNetworkReply::NetworkError networkError = reply->error();
             if (networkError == QNetworkReply::NoError) {
                 if (modelsURL.fileName().endsWith(".json.gz")) {
@@ -3862,8 +3961,13 @@ void DomainServer::handleDomainContentReplacementFromURLRequest(QSharedPointer<R
                     QString itemName = urlQuery.queryItemValue(CONTENT_SET_NAME_QUERY_PARAM);
                     handleOctreeFileReplacement(reply->readAll(), modelsURL.fileName(), itemName, username);
                 } else if (modelsURL.fileName().endsWith(".zip")) {
+                    downloadedArchive->write(reply->readAll());
+                    downloadedArchive->close();
+
+                    // the temporary file is removed once the recovery is done with it
                     auto deferred = makePromise("recoverFromUploadedBackup");
-                    _contentManager->recoverFromUploadedBackup(deferred, reply->readAll(), username);
+                    deferred->then([downloadedArchive](QString error, QVariantMap result) {});
+                    _contentManager->recoverFromUploadedBackup(deferred, downloadedArchive->fileName(), username);
                 }
             } else {
                 qDebug() << "Error downloading JSON from specified file: " << modelsURL;
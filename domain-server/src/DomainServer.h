@@ -13,6 +13,8 @@
 #ifndef hifi_DomainServer_h
 #define hifi_DomainServer_h
 
+#include <deque>
+
 #include <QtCore/QCoreApplication>
 #include <QtCore/QHash>
 #include <QtCore/QJsonObject>
@@ -20,6 +22,7 @@
 #include <QtCore/QSharedPointer>
 #include <QtCore/QStringList>
 #include <QtCore/QThread>
+#include <QtCore/QThreadPool>
 #include <QtCore/QUrl>
 #include <QHostAddress>
 #include <QAbstractNativeEventFilter>
@@ -205,6 +208,7 @@ private:
 
     QUuid connectionSecretForNodes(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB);
     void broadcastNewNode(const SharedNodePointer& node);
+    void updateDomainListEntry(const SharedNodePointer& node);
 
     void parseAssignmentConfigs(QSet<Assignment::Type>& excludedTypes);
     void addStaticAssignmentToAssignmentHash(Assignment* newAssignment);
@@ -332,9 +336,23 @@ private:
 
     QThread _assetClientThread;
 
+    // The domain list is versioned so that the nodes checking in are only sent the nodes added, changed or removed since
+    // the list they last received had.
+    class RemovedNode {
+    public:
+        quint32 version;
+        QUuid uuid;
+        NodeType_t type;
+    };
+    quint32 _domainListVersion { 0 };
+    std::deque<RemovedNode> _removedNodes; // oldest first
+    quint32 _oldestDomainListDeltaVersion { 0 }; // the removals before this have been forgotten
+
 #if defined(WEBRTC_DATA_CHANNELS)
     std::unique_ptr<WebRTCSignalingServer> _webrtcSignalingServer { nullptr };
 #endif
+
+    QThreadPool _statsProcessingPool; // last, so that its tasks are done before the rest is destroyed
 };
 
 
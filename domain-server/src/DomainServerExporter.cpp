@@ -296,12 +296,24 @@ bool DomainServerExporter::handleHTTPRequest(HTTPConnection* connection, const Q
 
     if (url.path() == URI_METRICS) {
         auto nodeList = DependencyManager::get<LimitedNodeList>();
-        QString output = "";
-        QTextStream outStream(&output);
-
-        nodeList->eachNode([this, &outStream](const SharedNodePointer& node) { generateMetricsForNode(outStream, node); });
+        QByteArray output;
+        QSet<QUuid> exportedNodes;
+
+        nodeList->eachNode([this, &output, &exportedNodes](const SharedNodePointer& node) {
+            output.append(getMetricsForNode(node));
+            exportedNodes.insert(node->getUUID());
+        });
+
+        // forget the metrics of the nodes that are gone
+        for (auto it = _nodeMetrics.begin(); it != _nodeMetrics.end();) {
+            if (exportedNodes.contains(it.key())) {
+                ++it;
+            } else {
+                it = _nodeMetrics.erase(it);
+            }
+        }
 
-        connection->respond(HTTPConnection::StatusCode200, output.toUtf8(), qPrintable(EXPORTER_MIME_TYPE));
+        connection->respond(HTTPConnection::StatusCode200, output, qPrintable(EXPORTER_MIME_TYPE));
         return true;
     }
 
@@ -309,39 +321,80 @@ bool DomainServerExporter::handleHTTPRequest(HTTPConnection* connection, const Q
 }
 
 QString DomainServerExporter::escapeName(const QString& name) {
-    QRegularExpression invalidCharacters("[^A-Za-z0-9_]");
+    // the stats use the same few names over and over, they're only escaped once
+    auto cached = _escapedNames.find(name);
+    if (cached != _escapedNames.end()) {
+        return cached.value();
+    }
+
+    static const QRegularExpression invalidCharacters("[^A-Za-z0-9_]");
+    static const QRegularExpression numberedPrefix("^\\d+\\. ");
+    static const QRegularExpression numberPrefix("^\\d+_");
+    static const QRegularExpression zPrefix("^z_");
+    static const QRegularExpression percent("%");
+    static const QRegularExpression mixedCase("([a-z])([A-Z])");
+    static const QRegularExpression leadingUnderscores("^_+");
+    static const QRegularExpression trailingUnderscores("_+$");
+    static const QRegularExpression underscores("_+");
 
     QString result = name;
 
     // If a key is named something like: "6. threads", turn it into just "threads"
-    result.replace(QRegularExpression("^\\d+\\. "), "");
-    result.replace(QRegularExpression("^\\d+_"), "");
+    result.replace(numberedPrefix, "");
+    result.replace(numberPrefix, "");
 
     // If a key is named something like "z_listeners", turn it into just "listeners"
-    result.replace(QRegularExpression("^z_"), "");
+    result.replace(zPrefix, "");
 
     // If a key is named something like "lost%", change it to "lost_percent_".
     // redundant underscores will be removed below.
-    result.replace(QRegularExpression("%"), "_percent_");
+    result.replace(percent, "_percent_");
 
     // change mixedCaseNames to mixed_case_names
-    result.replace(QRegularExpression("([a-z])([A-Z])"), "\\1_\\2");
+    result.replace(mixedCase, "\\1_\\2");
 
     // Replace all invalid characters with a _
     result.replace(invalidCharacters, "_");
 
     // Remove any "_" characters at the beginning or end
-    result.replace(QRegularExpression("^_+"), "");
-    result.replace(QRegularExpression("_+$"), "");
+    result.replace(leadingUnderscores, "");
+    result.replace(trailingUnderscores, "");
 
     // Replace any duplicated _ characters with a single one
-    result.replace(QRegularExpression("_+"), "_");
+    result.replace(underscores, "_");
 
     result = result.toLower();
 
+    // node UUIDs are keys too, don't let those grow the cache forever
+    const int MAX_ESCAPED_NAMES = 10000;
+    if (_escapedNames.size() >= MAX_ESCAPED_NAMES) {
+        _escapedNames.clear();
+    }
+    _escapedNames.insert(name, result);
+
     return result;
 }
 
+const QByteArray& DomainServerExporter::getMetricsForNode(const SharedNodePointer& node) {
+    static const QByteArray NO_METRICS;
+    auto nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
+    if (!nodeData) {
+        return NO_METRICS;
+    }
+
+    NodeMetrics& nodeMetrics = _nodeMetrics[node->getUUID()];
+    if (nodeMetrics.metrics.isEmpty() || nodeMetrics.statsReceiveTime != nodeData->getStatsReceiveTime()) {
+        QString output;
+        QTextStream outStream(&output);
+        generateMetricsForNode(outStream, node);
+        outStream.flush();
+
+        nodeMetrics.metrics = output.toUtf8();
+        nodeMetrics.statsReceiveTime = nodeData->getStatsReceiveTime();
+    }
+    return nodeMetrics.metrics;
+}
+
 void DomainServerExporter::generateMetricsForNode(QTextStream& stream, const SharedNodePointer& node) {
     QJsonObject statsObject = static_cast<DomainServerNodeData*>(node->getLinkedData())->getStatsJSONObject();
     QString nodeType = NodeType::getNodeTypeName(static_cast<NodeType_t>(node->getType()));
@@ -48,8 +48,17 @@ public:
 
 private:
     QString escapeName(const QString &name);
+    const QByteArray& getMetricsForNode(const SharedNodePointer& node);
     void generateMetricsForNode(QTextStream& stream, const SharedNodePointer& node);
     void generateMetricsFromJson(QTextStream& stream, QString originalPath, QString path, QHash<QString, QString> labels, const QJsonObject& obj);
+
+    // Each node's metrics are only generated again once it has sent new stats
+    struct NodeMetrics {
+        quint64 statsReceiveTime { 0 };
+        QByteArray metrics;
+    };
+    QHash<QUuid, NodeMetrics> _nodeMetrics;
+    QHash<QString, QString> _escapedNames;
 };
 
 #endif // DOMAINSERVEREXPORTER_H
@@ -20,15 +20,37 @@
 #include <udt/PacketHeaders.h>
 
 DomainServerNodeData::StringPairHash DomainServerNodeData::_overrideHash;
+QReadWriteLock DomainServerNodeData::_overrideHashLock;
 
 DomainServerNodeData::DomainServerNodeData() {
     _paymentIntervalTimer.start();
 }
 
-void DomainServerNodeData::updateJSONStats(QByteArray statsByteArray) {
+QJsonObject DomainServerNodeData::parseJSONStats(const QByteArray& statsByteArray) {
     auto document = QJsonDocument::fromBinaryData(statsByteArray);
     Q_ASSERT(document.isObject());
-    _statsJSONObject = overrideValuesIfNeeded(document.object());
+    QReadLocker locker(&_overrideHashLock);
+    return overrideValuesIfNeeded(document.object());
+}
+
+void DomainServerNodeData::setJSONStats(const QJsonObject& stats, quint64 receiveTime) {
+    if (receiveTime >= _statsReceiveTime) {
+        _statsJSONObject = stats;
+        _statsReceiveTime = receiveTime;
+    }
+}
+
+const QByteArray& DomainServerNodeData::getStatsJSON(const QString& nodeTypeName) {
+    if (_statsJSON.isEmpty() || _statsJSONReceiveTime != _statsReceiveTime) {
+        QJsonObject statsObject = _statsJSONObject;
+
+        // add the node type to the JSON data for output purposes
+        statsObject["node_type"] = nodeTypeName;
+
+        _statsJSON = QJsonDocument(statsObject).toJson();
+        _statsJSONReceiveTime = _statsReceiveTime;
+    }
+    return _statsJSON;
 }
 
 QJsonObject DomainServerNodeData::overrideValuesIfNeeded(const QJsonObject& newStats) {
@@ -69,10 +91,12 @@ QJsonArray DomainServerNodeData::overrideValuesIfNeeded(const QJsonArray& newSta
 void DomainServerNodeData::addOverrideForKey(const QString& key, const QString& value,
                                              const QString& overrideValue) {
     // Insert override value
+    QWriteLocker locker(&_overrideHashLock);
     _overrideHash.insert({key, value}, overrideValue);
 }
 
 void DomainServerNodeData::removeOverrideForKey(const QString& key, const QString& value) {
     // Remove override value
+    QWriteLocker locker(&_overrideHashLock);
     _overrideHash.remove({key, value});
 }
@@ -17,6 +17,7 @@
 #include <QtCore/QHash>
 #include <QtCore/QUuid>
 #include <QtCore/QJsonObject>
+#include <QtCore/QReadWriteLock>
 
 #include <SockAddr.h>
 #include <NLPacket.h>
@@ -29,7 +30,13 @@ public:
 
     const QJsonObject& getStatsJSONObject() const { return _statsJSONObject; }
 
-    void updateJSONStats(QByteArray statsByteArray);
+    // parses the stats a node sent, with the overrides applied, from any thread
+    static QJsonObject parseJSONStats(const QByteArray& statsByteArray);
+    // keeps the stats of the latest packet the node sent, they may finish parsing out of order
+    void setJSONStats(const QJsonObject& stats, quint64 receiveTime);
+    quint64 getStatsReceiveTime() const { return _statsReceiveTime; }
+    // the stats as they're served over HTTP, only serialized again once new stats have arrived
+    const QByteArray& getStatsJSON(const QString& nodeTypeName);
 
     void setAssignmentUUID(const QUuid& assignmentUUID) { _assignmentUUID = assignmentUUID; }
     const QUuid& getAssignmentUUID() const { return _assignmentUUID; }
@@ -76,10 +83,23 @@ public:
 
     bool hasCheckedIn() const { return _hasCheckedIn; }
     void setHasCheckedIn(bool hasCheckedIn) { _hasCheckedIn = hasCheckedIn; }
-    
+
+    // this node as it's listed in the other nodes' domain lists, and the domain list version it last changed at
+    const QByteArray& getDomainListEntry() const { return _domainListEntry; }
+    quint32 getDomainListEntryVersion() const { return _domainListEntryVersion; }
+    void setDomainListEntry(const QByteArray& entry, quint32 version) { _domainListEntry = entry; _domainListEntryVersion = version; }
+
+    // the version of the last domain list this node fully received
+    quint32 getDomainListVersion() const { return _domainListVersion; }
+    void setDomainListVersion(quint32 version) { _domainListVersion = version; }
+
+    // the lists this node received before this version can't have changes sent since them, e.g. its interests were different
+    quint32 getMinimumDomainListDeltaVersion() const { return _minimumDomainListDeltaVersion; }
+    void setMinimumDomainListDeltaVersion(quint32 version) { _minimumDomainListDeltaVersion = version; }
+
 private:
-    QJsonObject overrideValuesIfNeeded(const QJsonObject& newStats);
-    QJsonArray overrideValuesIfNeeded(const QJsonArray& newStats);
+    static QJsonObject overrideValuesIfNeeded(const QJsonObject& newStats);
+    static QJsonArray overrideValuesIfNeeded(const QJsonArray& newStats);
     
     QHash<QUuid, QUuid> _sessionSecretHash;
     QUuid _assignmentUUID;
@@ -89,7 +109,11 @@ private:
     
     using StringPairHash = QHash<QPair<QString, QString>, QString>;
     QJsonObject _statsJSONObject;
+    quint64 _statsReceiveTime { 0 };
+    QByteArray _statsJSON;
+    quint64 _statsJSONReceiveTime { 0 };
     static StringPairHash _overrideHash;
+    static QReadWriteLock _overrideHashLock;
     
     SockAddr _sendingSockAddr;
     bool _isAuthenticated = true;
@@ -103,6 +127,11 @@ private:
     bool _wasAssigned { false };
 
     bool _hasCheckedIn { false };
+
+    QByteArray _domainListEntry;
+    quint32 _domainListEntryVersion { 0 };
+    quint32 _domainListVersion { 0 };
+    quint32 _minimumDomainListDeltaVersion { 0 };
 };
 
 #endif // hifi_DomainServerNodeData_h
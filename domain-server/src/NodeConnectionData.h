@@ -30,6 +30,7 @@ public:
     SockAddr senderSockAddr;
     QList<NodeType_t> interestList;
     QString placeName;
+    quint32 domainListVersion { 0 }; // the last domain list the node fully received, 0 for none
     QString hardwareAddress;
     QUuid machineFingerprint;
     QString SystemInfo;
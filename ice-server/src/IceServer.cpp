@@ -17,6 +17,7 @@
 #include <QtCore/QDataStream>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
+#include <QtCore/QRunnable>
 #include <QtCore/QTimer>
 #include <QtNetwork/QNetworkReply>
 #include <QtNetwork/QNetworkRequest>
@@ -26,12 +27,18 @@
 #include <NetworkAccessManager.h>
 #include <NetworkingConstants.h>
 #include <MetaverseAPI.h>
+#include <NumericalConstants.h>
 #include <udt/PacketHeaders.h>
 #include <SharedUtil.h>
 
 const int CLEAR_INACTIVE_PEERS_INTERVAL_MSECS = 1 * 1000;
 const int PEER_SILENCE_THRESHOLD_MSECS = 5 * 1000;
 
+// public keys are re-requested this long after they were fetched, and forgotten if their domain isn't heartbeating
+const quint64 DOMAIN_PUBLIC_KEY_TTL_USECS = 10 * 60 * USECS_PER_SECOND;
+// a heartbeat that's the same as the last one verified for its domain, from the same address, isn't checked again for this long
+const quint64 HEARTBEAT_REVERIFY_INTERVAL_USECS = 60 * USECS_PER_SECOND;
+
 IceServer::IceServer(int argc, char* argv[]) :
     QCoreApplication(argc, argv),
     _id(QUuid::createUuid()),
@@ -78,20 +85,7 @@ void IceServer::processPacket(std::unique_ptr<udt::Packet> packet) {
     if (nlPacket->getPayloadSize() >= NLPacket::localHeaderSize(PacketType::ICEServerHeartbeat)) {
         
         if (nlPacket->getType() == PacketType::ICEServerHeartbeat) {
-            SharedNetworkPeer peer = addOrUpdateHeartbeatingPeer(*nlPacket);
-            if (peer) {
-                // so that we can send packets to the heartbeating peer when we need, we need to activate a socket now
-                peer->activateMatchingOrNewSymmetricSocket(nlPacket->getSenderSockAddr());
-
-                // we have an active and verified heartbeating peer
-                // send them an ACK packet so they know that they are being heard and ready for ICE
-                static auto ackPacket = NLPacket::create(PacketType::ICEServerHeartbeatACK);
-                _serverSocket.writePacket(*ackPacket, nlPacket->getSenderSockAddr());
-            } else {
-                // we couldn't verify this peer - respond back to them so they know they may need to perform keypair re-generation
-                static auto deniedPacket = NLPacket::create(PacketType::ICEServerHeartbeatDenied);
-                _serverSocket.writePacket(*deniedPacket, nlPacket->getSenderSockAddr());
-            }
+            processHeartbeat(*nlPacket);
         } else if (nlPacket->getType() == PacketType::ICEServerQuery) {
             QDataStream heartbeatStream(nlPacket.get());
             
@@ -128,85 +122,145 @@ void IceServer::processPacket(std::unique_ptr<udt::Packet> packet) {
     }
 }
 
-SharedNetworkPeer IceServer::addOrUpdateHeartbeatingPeer(NLPacket& packet) {
+class HeartbeatCheckTask : public QRunnable {
+public:
+    HeartbeatCheckTask(std::function<void()> check) : _check(check) {}
+    void run() override { _check(); }
 
-    // pull the UUID, public and private sock addrs for this peer
-    QUuid senderUUID;
-    SockAddr publicSocket, localSocket;
-    QByteArray signature;
+private:
+    std::function<void()> _check;
+};
+
+void IceServer::processHeartbeat(NLPacket& packet) {
+    Heartbeat heartbeat;
+    heartbeat.senderSockAddr = packet.getSenderSockAddr();
 
+    // pull the UUID, public and private sock addrs for this peer
     QDataStream heartbeatStream(&packet);
-    heartbeatStream >> senderUUID >> publicSocket >> localSocket;
+    heartbeatStream >> heartbeat.senderUUID >> heartbeat.publicSocket >> heartbeat.localSocket;
 
-    auto signedPlaintext = QByteArray::fromRawData(packet.getPayload(), heartbeatStream.device()->pos());
-    heartbeatStream >> signature;
+    heartbeat.plaintext = QByteArray(packet.getPayload(), heartbeatStream.device()->pos());
+    heartbeatStream >> heartbeat.signature;
 
-    // make sure this is a verified heartbeat before performing any more processing
-    if (isVerifiedHeartbeat(senderUUID, signedPlaintext, signature)) {
-        // make sure we have this sender in our peer hash
-        SharedNetworkPeer matchingPeer = _activePeers.value(senderUUID);
+    const QUuid& domainID = heartbeat.senderUUID;
 
-        if (!matchingPeer) {
-            // if we don't have this sender we need to create them now
-            matchingPeer = QSharedPointer<NetworkPeer>::create(senderUUID, publicSocket, localSocket);
-            _activePeers.insert(senderUUID, matchingPeer);
+    // check if we have a public key for this domain ID - if we do not then fire off the request for it,
+    // unless we're already waiting for one
+    auto it = _domainPublicKeys.find(domainID);
+    if (it == _domainPublicKeys.end()) {
+        if (!_pendingPublicKeyRequests.contains(domainID)) {
+            requestDomainPublicKey(domainID);
+        }
+        respondToHeartbeat(heartbeat, false);
+        return;
+    }
 
-            qDebug() << "Added a new network peer" << *matchingPeer;
-        } else {
-            // we already had the peer so just potentially update their sockets
-            matchingPeer->setPublicSocket(publicSocket);
-            matchingPeer->setLocalSocket(localSocket);
+    auto now = usecTimestampNow();
+    if (now - it->second.fetchedMicrostamp > DOMAIN_PUBLIC_KEY_TTL_USECS && !_pendingPublicKeyRequests.contains(domainID)) {
+        // refresh the key, heartbeats are still checked with the one we have until the new one arrives
+        requestDomainPublicKey(domainID);
+    }
+
+    // signatures are deterministic, so the same heartbeat signed with the same key has the same signature
+    auto verified = _verifiedHeartbeats.find(domainID);
+    if (verified != _verifiedHeartbeats.end() && now - verified->second.verifiedMicrostamp < HEARTBEAT_REVERIFY_INTERVAL_USECS
+            && verified->second.senderSockAddr == heartbeat.senderSockAddr
+            && verified->second.plaintext == heartbeat.plaintext && verified->second.signature == heartbeat.signature) {
+        respondToHeartbeat(heartbeat, true);
+        return;
+    }
+
+    if (_pendingHeartbeatChecks.contains(domainID)) {
+        // the domain will heartbeat again, once the check in progress is done
+        return;
+    }
+
+    // attempt to verify the signature for this heartbeat away from the socket's thread
+    _pendingHeartbeatChecks.insert(domainID);
+    RSASharedPtr rsaPublicKey = it->second.key;
+    _heartbeatCheckPool.start(new HeartbeatCheckTask([this, heartbeat, rsaPublicKey] {
+        bool isVerified = isVerifiedHeartbeat(rsaPublicKey.get(), heartbeat.plaintext, heartbeat.signature);
+        QMetaObject::invokeMethod(this, [this, heartbeat, isVerified] {
+            finishHeartbeatCheck(heartbeat, isVerified);
+        });
+    }));
+}
+
+void IceServer::finishHeartbeatCheck(const Heartbeat& heartbeat, bool isVerified) {
+    const QUuid& domainID = heartbeat.senderUUID;
+    _pendingHeartbeatChecks.remove(domainID);
+
+    if (isVerified) {
+        VerifiedHeartbeat& verified = _verifiedHeartbeats[domainID];
+        verified.senderSockAddr = heartbeat.senderSockAddr;
+        verified.plaintext = heartbeat.plaintext;
+        verified.signature = heartbeat.signature;
+        verified.verifiedMicrostamp = usecTimestampNow();
+    } else {
+        qDebug() << "Failed to verify heartbeat for" << domainID << "- re-requesting public key from API.";
+
+        // we could not verify this heartbeat (could not load public key, bad actor)
+        // ask the metaverse API for the right public key
+        _verifiedHeartbeats.erase(domainID);
+        if (!_pendingPublicKeyRequests.contains(domainID)) {
+            requestDomainPublicKey(domainID);
         }
+    }
 
-        // update our last heard microstamp for this network peer to now
-        matchingPeer->setLastHeardMicrostamp(usecTimestampNow());
-        
-        return matchingPeer;
+    respondToHeartbeat(heartbeat, isVerified);
+}
+
+void IceServer::respondToHeartbeat(const Heartbeat& heartbeat, bool isVerified) {
+    if (isVerified) {
+        SharedNetworkPeer peer = addOrUpdateHeartbeatingPeer(heartbeat);
+
+        // so that we can send packets to the heartbeating peer when we need, we need to activate a socket now
+        peer->activateMatchingOrNewSymmetricSocket(heartbeat.senderSockAddr);
+
+        // we have an active and verified heartbeating peer
+        // send them an ACK packet so they know that they are being heard and ready for ICE
+        static auto ackPacket = NLPacket::create(PacketType::ICEServerHeartbeatACK);
+        _serverSocket.writePacket(*ackPacket, heartbeat.senderSockAddr);
     } else {
-        // not verified, return the empty peer object
-        return SharedNetworkPeer();
+        // we couldn't verify this peer - respond back to them so they know they may need to perform keypair re-generation
+        static auto deniedPacket = NLPacket::create(PacketType::ICEServerHeartbeatDenied);
+        _serverSocket.writePacket(*deniedPacket, heartbeat.senderSockAddr);
     }
 }
 
-bool IceServer::isVerifiedHeartbeat(const QUuid& domainID, const QByteArray& plaintext, const QByteArray& signature) {
-    // make sure we're not already waiting for a public key for this domain-server
-    if (!_pendingPublicKeyRequests.contains(domainID)) {
-        // check if we have a public key for this domain ID - if we do not then fire off the request for it
-        auto it = _domainPublicKeys.find(domainID);
-        if (it != _domainPublicKeys.end()) {
-
-            // attempt to verify the signature for this heartbeat
-            const auto rsaPublicKey = it->second.get();
-
-            if (rsaPublicKey) {
-                auto hashedPlaintext = QCryptographicHash::hash(plaintext, QCryptographicHash::Sha256);
-                int verificationResult = RSA_verify(NID_sha256,
-                                                    reinterpret_cast<const unsigned char*>(hashedPlaintext.constData()),
-                                                    hashedPlaintext.size(),
-                                                    reinterpret_cast<const unsigned char*>(signature.constData()),
-                                                    signature.size(),
-                                                    rsaPublicKey);
-
-                if (verificationResult == 1) {
-                    // this is the only success case - we return true here to indicate that the heartbeat is verified
-                    return true;
-                } else {
-                    qDebug() << "Failed to verify heartbeat for" << domainID << "- re-requesting public key from API.";
-                }
+SharedNetworkPeer IceServer::addOrUpdateHeartbeatingPeer(const Heartbeat& heartbeat) {
+    // make sure we have this sender in our peer hash
+    SharedNetworkPeer matchingPeer = _activePeers.value(heartbeat.senderUUID);
 
-            } else {
-                // we can't let this user in since we couldn't convert their public key to an RSA key we could use
-                qWarning() << "Public key for" << domainID << "is not a usable RSA* public key.";
-                qWarning() << "Re-requesting public key from API";
-            }
-        }
+    if (!matchingPeer) {
+        // if we don't have this sender we need to create them now
+        matchingPeer = QSharedPointer<NetworkPeer>::create(heartbeat.senderUUID, heartbeat.publicSocket, heartbeat.localSocket);
+        _activePeers.insert(heartbeat.senderUUID, matchingPeer);
 
-        // we could not verify this heartbeat (missing public key, could not load public key, bad actor)
-        // ask the metaverse API for the right public key and return false to indicate that this is not verified
-        requestDomainPublicKey(domainID);
+        qDebug() << "Added a new network peer" << *matchingPeer;
+    } else {
+        // we already had the peer so just potentially update their sockets
+        matchingPeer->setPublicSocket(heartbeat.publicSocket);
+        matchingPeer->setLocalSocket(heartbeat.localSocket);
     }
 
-    return false;
+    // update our last heard microstamp for this network peer to now
+    matchingPeer->setLastHeardMicrostamp(usecTimestampNow());
+
+    return matchingPeer;
+}
+
+bool IceServer::isVerifiedHeartbeat(RSA* rsaPublicKey, const QByteArray& plaintext, const QByteArray& signature) {
+    auto hashedPlaintext = QCryptographicHash::hash(plaintext, QCryptographicHash::Sha256);
+    int verificationResult = RSA_verify(NID_sha256,
+                                        reinterpret_cast<const unsigned char*>(hashedPlaintext.constData()),
+                                        hashedPlaintext.size(),
+                                        reinterpret_cast<const unsigned char*>(signature.constData()),
+                                        signature.size(),
+                                        rsaPublicKey);
+
+    // this is the only success case
+    return verificationResult == 1;
 }
 
 void IceServer::requestDomainPublicKey(const QUuid& domainID) {
@@ -265,7 +319,12 @@ void IceServer::publicKeyReplyFinished(QNetworkReply* reply) {
                 RSA* rsaPublicKey = d2i_RSA_PUBKEY(NULL, &publicKeyData, apiPublicKey.size());
 
                 if (rsaPublicKey) {
-                    _domainPublicKeys[domainID] = { rsaPublicKey, RSA_free };
+                    DomainPublicKey& publicKey = _domainPublicKeys[domainID];
+                    publicKey.key = RSASharedPtr(rsaPublicKey, RSA_free);
+                    publicKey.fetchedMicrostamp = usecTimestampNow();
+
+                    // heartbeats are checked against the new key from now on
+                    _verifiedHeartbeats.erase(domainID);
                 } else {
                     qWarning() << "Could not convert in-memory public key for" << domainID << "to usable RSA public key.";
                     qWarning() << "Public key will be re-requested on next heartbeat.";
@@ -310,8 +369,8 @@ void IceServer::clearInactivePeers() {
         if ((usecTimestampNow() - peer->getLastHeardMicrostamp()) > (PEER_SILENCE_THRESHOLD_MSECS * 1000)) {
             qDebug() << "Removing peer from memory for inactivity -" << *peer;
 
-            // if we had a public key for this domain, remove it now
-            _domainPublicKeys.erase(peer->getUUID());
+            // the public key is kept until it expires, in case the domain is only briefly disconnected
+            _verifiedHeartbeats.erase(peer->getUUID());
 
             // remove the peer object
             peerItem = _activePeers.erase(peerItem);
@@ -320,4 +379,14 @@ void IceServer::clearInactivePeers() {
             ++peerItem;
         }
     }
+
+    // forget the expired public keys of domains that aren't heartbeating, the others are refreshed when they next do
+    auto now = usecTimestampNow();
+    for (auto it = _domainPublicKeys.begin(); it != _domainPublicKeys.end();) {
+        if (now - it->second.fetchedMicrostamp > DOMAIN_PUBLIC_KEY_TTL_USECS && !_activePeers.contains(it->first)) {
+            it = _domainPublicKeys.erase(it);
+        } else {
+            ++it;
+        }
+    }
 }
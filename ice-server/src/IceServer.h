@@ -13,7 +13,10 @@
 #ifndef hifi_IceServer_h
 #define hifi_IceServer_h
 
+#include <memory>
+
 #include <QtCore/QCoreApplication>
+#include <QtCore/QThreadPool>
 #include <QUdpSocket>
 
 #include <openssl/rsa.h>
@@ -39,10 +42,24 @@ private:
     bool packetVersionMatch(const udt::Packet& packet);
     void processPacket(std::unique_ptr<udt::Packet> packet);
     
-    SharedNetworkPeer addOrUpdateHeartbeatingPeer(NLPacket& incomingPacket);
+    class Heartbeat {
+    public:
+        QUuid senderUUID;
+        SockAddr publicSocket;
+        SockAddr localSocket;
+        SockAddr senderSockAddr;
+        QByteArray plaintext;
+        QByteArray signature;
+    };
+
+    void processHeartbeat(NLPacket& packet);
+    void finishHeartbeatCheck(const Heartbeat& heartbeat, bool isVerified);
+    void respondToHeartbeat(const Heartbeat& heartbeat, bool isVerified);
+
+    SharedNetworkPeer addOrUpdateHeartbeatingPeer(const Heartbeat& heartbeat);
     void sendPeerInformationPacket(const NetworkPeer& peer, const SockAddr* destinationSockAddr);
 
-    bool isVerifiedHeartbeat(const QUuid& domainID, const QByteArray& plaintext, const QByteArray& signature);
+    static bool isVerifiedHeartbeat(RSA* rsaPublicKey, const QByteArray& plaintext, const QByteArray& signature);
     void requestDomainPublicKey(const QUuid& domainID);
 
     QUuid _id;
@@ -51,11 +68,30 @@ private:
     using NetworkPeerHash = QHash<QUuid, SharedNetworkPeer>;
     NetworkPeerHash _activePeers;
 
-    using RSAUniquePtr = std::unique_ptr<RSA, std::function<void(RSA*)>>;
-    using DomainPublicKeyHash = std::unordered_map<QUuid, RSAUniquePtr>;
+    // shared with the checks on the pool, that may still be using a key that has since been replaced
+    using RSASharedPtr = std::shared_ptr<RSA>;
+    class DomainPublicKey {
+    public:
+        RSASharedPtr key;
+        quint64 fetchedMicrostamp { 0 };
+    };
+    using DomainPublicKeyHash = std::unordered_map<QUuid, DomainPublicKey>;
     DomainPublicKeyHash _domainPublicKeys;
 
     QSet<QUuid> _pendingPublicKeyRequests;
+
+    // the last heartbeat of each domain whose signature was checked, and when, since domains repeat themselves
+    class VerifiedHeartbeat {
+    public:
+        SockAddr senderSockAddr;
+        QByteArray plaintext;
+        QByteArray signature;
+        quint64 verifiedMicrostamp { 0 };
+    };
+    std::unordered_map<QUuid, VerifiedHeartbeat> _verifiedHeartbeats;
+
+    QSet<QUuid> _pendingHeartbeatChecks;
+    QThreadPool _heartbeatCheckPool; // last, so that its checks are done before the rest is destroyed
 };
 
 #endif // hifi_IceServer_h
@@ -82,6 +82,7 @@
 #include <VirtualPadManager.h>
 #include <DebugDraw.h>
 #include <DeferredLightingEffect.h>
+#include <EntityCompressionDictionary.h>
 #include <EntityScriptClient.h>
 #include <EntityScriptServerLogClient.h>
 #include <EntityScriptingInterface.h>
@@ -730,6 +731,7 @@ const QString TEST_QUIT_WHEN_FINISHED_OPTION{ "quitWhenFinished" };
 const QString TEST_RESULTS_LOCATION_COMMAND{ "--testResultsLocation" };
 
 bool setupEssentials(int& argc, char** argv, bool runningMarkerExisted) {
+    PROFILE_RANGE(startup, __FUNCTION__);
     const char** constArgv = const_cast<const char**>(argv);
 
     qInstallMessageHandler(messageHandler);
@@ -817,12 +819,8 @@ bool setupEssentials(int& argc, char** argv, bool runningMarkerExisted) {
     pluginManager->setInputPluginProvider([] { return getInputPlugins(); });
     pluginManager->setDisplayPluginProvider([] { return getDisplayPlugins(); });
     pluginManager->setInputPluginSettingsPersister([](const InputPluginList& plugins) { saveInputPluginSettings(plugins); });
-    if (auto steamClient = pluginManager->getSteamClientPlugin()) {
-        steamClient->init();
-    }
-    if (auto oculusPlatform = pluginManager->getOculusPlatformPlugin()) {
-        oculusPlatform->init();
-    }
+    // the plugin libraries load while the rest of the essentials are set up, the Steam and Oculus ones are started after them
+    pluginManager->preloadPlugins();
 
     PROFILE_SET_THREAD_NAME("Main Thread");
 
@@ -976,6 +974,13 @@ bool setupEssentials(int& argc, char** argv, bool runningMarkerExisted) {
         }
     }
 
+    if (auto steamClient = pluginManager->getSteamClientPlugin()) {
+        steamClient->init();
+    }
+    if (auto oculusPlatform = pluginManager->getOculusPlatformPlugin()) {
+        oculusPlatform->init();
+    }
+
     return previousSessionCrashed;
 }
 
@@ -1489,6 +1494,26 @@ Application::Application(int& argc, char** argv, QElapsedTimer& startupTimer, bo
     }
     ResourceCache::setRequestLimit(concurrentDownloads);
 
+    QString concurrentDownloadsPerHostStr = getCmdOption(argc, constArgv, "--concurrent-downloads-per-host");
+    uint32_t concurrentDownloadsPerHost = concurrentDownloadsPerHostStr.toUInt(&success);
+    if (success) {
+        ResourceCache::setRequestLimitPerHost(concurrentDownloadsPerHost);
+    }
+
+    // multithreaded physics is opt-in, see PhysicsEngine::setNumThreads()
+    QString physicsThreadsStr = getCmdOption(argc, constArgv, "--physics-threads");
+    int physicsThreads = physicsThreadsStr.toInt(&success);
+    if (success && physicsThreads > 0) {
+        _physicsEngine->setNumThreads(physicsThreads);
+    }
+
+    // 0 lets physics catch up with real time however long that takes
+    QString physicsStepBudgetStr = getCmdOption(argc, constArgv, "--physics-step-budget");
+    uint64_t physicsStepBudgetMsecs = physicsStepBudgetStr.toULongLong(&success);
+    if (success) {
+        _physicsEngine->setStepBudget(physicsStepBudgetMsecs * USECS_PER_MSEC);
+    }
+
     // perhaps override the avatar url.  Since we will test later for validity
     // we don't need to do so here.
     QString avatarURL = getCmdOption(argc, constArgv, "--avatarURL");
@@ -1733,6 +1758,8 @@ Application::Application(int& argc, char** argv, QElapsedTimer& startupTimer, bo
 
     // The entity octree will have to know about MyAvatar for the parentJointName import
     getEntities()->getTree()->setMyAvatar(myAvatar);
+    // the local tree is only used for rendering and picking, so moving entities are left where they are when they can be
+    getEntities()->getTree()->setLooseElementFit(true);
     _entityClipboard->setMyAvatar(myAvatar);
 
     // For now we're going to set the PPS for outbound packets to be super high, this is
@@ -2130,6 +2157,16 @@ Application::Application(int& argc, char** argv, QElapsedTimer& startupTimer, bo
     });
     Procedural::opaqueStencil = [](gpu::StatePointer state) { PrepareStencil::testMaskDrawShape(*state); };
     Procedural::transparentStencil = [](gpu::StatePointer state) { PrepareStencil::testMask(*state); };
+    Procedural::compileProgram = [this](const gpu::ShaderPointer& program, std::function<void()> callback) {
+        // one procedural program is compiled per presented frame, so that a new shader doesn't stall the frame it shows up in
+        static const size_t PROCEDURAL_PROGRAMS_PER_FRAME = 1;
+        auto gpuContext = getGPUContext();
+        if (gpuContext) {
+            gpuContext->pushProgramsToSync(std::vector<gpu::ShaderPointer>{ program }, callback, PROCEDURAL_PROGRAMS_PER_FRAME, false);
+        } else {
+            callback();
+        }
+    };
 
     EntityTree::setGetEntityObjectOperator([this](const QUuid& id) -> QObject* {
         auto entities = getEntities();
@@ -2269,6 +2306,9 @@ Application::Application(int& argc, char** argv, QElapsedTimer& startupTimer, bo
         properties["active_downloads"] = loadingRequests.size();
         properties["pending_downloads"] = (int)ResourceCache::getPendingRequestCount();
         properties["active_downloads_details"] = loadingRequestsStats;
+        properties["evicted_resources"] = (qint64)ResourceCache::getNumEvictedResources();
+        properties["evicted_resources_size"] = (qint64)ResourceCache::getEvictedResourcesSize();
+        properties["reused_resources"] = (qint64)ResourceCache::getNumReusedResources();
 
         auto statTracker = DependencyManager::get<StatTracker>();
 
@@ -3045,6 +3085,7 @@ Application::~Application() {
 }
 
 void Application::initializeGL() {
+    PROFILE_RANGE(startup, __FUNCTION__);
     qCDebug(interfaceapp) << "Created Display Window.";
 
 #ifdef DISABLE_QML
@@ -3154,6 +3195,7 @@ void Application::initializeGL() {
 }
 
 void Application::initializeDisplayPlugins() {
+    PROFILE_RANGE(startup, __FUNCTION__);
     const auto& displayPlugins = PluginManager::getInstance()->getDisplayPlugins();
     Setting::Handle<QString> activeDisplayPluginSetting{ ACTIVE_DISPLAY_PLUGIN_SETTING_NAME, displayPlugins.at(0)->getName() };
     auto lastActiveDisplayPluginName = activeDisplayPluginSetting.get();
@@ -3212,6 +3254,7 @@ void Application::initializeDisplayPlugins() {
 }
 
 void Application::initializeRenderEngine() {
+    PROFILE_RANGE(startup, __FUNCTION__);
     // FIXME: on low end systems os the shaders take up to 1 minute to compile, so we pause the deadlock watchdog thread.
     DeadlockWatchdogThread::withPause([&] {
         _graphicsEngine.initializeRender();
@@ -3254,6 +3297,7 @@ void Application::showLoginScreen() {
 static const QUrl AUTHORIZED_EXTERNAL_QML_SOURCE { "https://cdn.vircadia.com/community-apps/applications" };
 
 void Application::initializeUi() {
+    PROFILE_RANGE(startup, __FUNCTION__);
 
     // Allow remote QML content from trusted sources ONLY
     {
@@ -5515,6 +5559,7 @@ bool Application::exportEntities(const QString& filename, float x, float y, floa
 }
 
 void Application::loadSettings() {
+    PROFILE_RANGE(startup, __FUNCTION__);
 
     sessionRunTime.set(0); // Just clean living. We're about to saveSettings, which will update value.
     DependencyManager::get<AudioClient>()->loadSettings();
@@ -5678,6 +5723,7 @@ QVector<EntityItemID> Application::pasteEntities(const QString& entityHostType,
 }
 
 void Application::init() {
+    PROFILE_RANGE(startup, __FUNCTION__);
     // Make sure Login state is up to date
 #if !defined(DISABLE_QML)
     DependencyManager::get<DialogsManager>()->toggleLoginDialog();
@@ -5750,6 +5796,8 @@ void Application::init() {
 
     _gameWorkload.startup(getEntities()->getWorkloadSpace(), _graphicsEngine.getRenderScene(), _entitySimulation);
     _entitySimulation->setWorkloadSpace(getEntities()->getWorkloadSpace());
+
+    setupUpdateScheduler();
 }
 
 void Application::pauseUntilLoginDetermined() {
@@ -5931,6 +5979,65 @@ void Application::updateLOD(float deltaTime) const {
     }
 }
 
+void Application::updateDynamicResolution() {
+    PerformanceTimer perfTimer("dynamicResolution");
+    if (isThrottleRendering()) {
+        return;
+    }
+
+    float gpuTime = (float)getGPUContext()->getFrameTimerGPUAverage();
+    int targetRefreshRate = _refreshRateManager.getActiveRefreshRate();
+    _dynamicResolutionManager.update(gpuTime, targetRefreshRate);
+    if (_dynamicResolutionManager.isEnabled() && targetRefreshRate > 0) {
+        _graphicsEngine._frameTimingsScriptingInterface.addResolutionScale(gpuTime, (float)MSECS_PER_SECOND / (float)targetRefreshRate,
+            _dynamicResolutionManager.getResolutionScale());
+    }
+}
+
+void Application::setupUpdateScheduler() {
+    // the overlays move with the avatar, so they can't fall behind for long
+    const int MAX_DEFERRED_OVERLAY_FRAMES = 2;
+    _updateScheduler.addJob("overlays", FrameBudgetScheduler::Priority::Normal, MAX_DEFERRED_OVERLAY_FRAMES, [this](float deltaTime) {
+        _overlays.update(deltaTime);
+    });
+
+    // the queries are only sent every few seconds, or when the view changes, so a few frames late doesn't matter
+    const int MAX_DEFERRED_QUERY_FRAMES = 10;
+    _updateScheduler.addJob("queryOctree", FrameBudgetScheduler::Priority::Low, MAX_DEFERRED_QUERY_FRAMES, [this](float) {
+        queryOctreeIfViewChanged();
+    });
+}
+
+void Application::queryOctreeIfViewChanged() {
+    QMutexLocker viewLocker(&_viewMutex);
+
+    bool viewIsDifferentEnough = false;
+    if (_conicalViews.size() == _lastQueriedViews.size()) {
+        for (size_t i = 0; i < _conicalViews.size(); ++i) {
+            if (!_conicalViews[i].isVerySimilar(_lastQueriedViews[i])) {
+                viewIsDifferentEnough = true;
+                break;
+            }
+        }
+    } else {
+        viewIsDifferentEnough = true;
+    }
+
+
+    // if it's been a while since our last query or the view has significantly changed then send a query, otherwise suppress it
+    static const std::chrono::seconds MIN_PERIOD_BETWEEN_QUERIES { 3 };
+    auto now = SteadyClock::now();
+    if (now > _queryExpiry || viewIsDifferentEnough) {
+        if (DependencyManager::get<SceneScriptingInterface>()->shouldRenderEntities()) {
+            queryOctree(NodeType::EntityServer, PacketType::EntityQuery);
+        }
+        queryAvatars();
+
+        _lastQueriedViews = _conicalViews;
+        _queryExpiry = now + MIN_PERIOD_BETWEEN_QUERIES;
+    }
+}
+
 void Application::pushPostUpdateLambda(void* key, const std::function<void()>& func) {
     std::unique_lock<std::mutex> guard(_postUpdateLambdasLock);
     _postUpdateLambdas[key] = func;
@@ -6357,6 +6464,8 @@ void Application::update(float deltaTime) {
         return;
     }
 
+    quint64 updateStart = usecTimestampNow();
+
     if (!_physicsEnabled) {
         if (!domainLoadingInProgress) {
             PROFILE_ASYNC_BEGIN(app, "Scene Loading", "");
@@ -6730,18 +6839,13 @@ void Application::update(float deltaTime) {
     PerformanceWarning warn(showWarnings, "Application::update()");
 
     updateLOD(deltaTime);
+    updateDynamicResolution();
 
     if (!_loginDialogID.isNull()) {
         _loginStateManager.update(getMyAvatar()->getDominantHand(), _loginDialogID);
         updateLoginDialogPosition();
     }
 
-    {
-        PROFILE_RANGE_EX(app, "Overlays", 0xffff0000, (uint64_t)getActiveDisplayPlugin()->presentCount());
-        PerformanceTimer perfTimer("overlays");
-        _overlays.update(deltaTime);
-    }
-
     // Update _viewFrustum with latest camera and view frustum data...
     // NOTE: we get this from the view frustum, to make it simpler, since the
     // loadViewFrumstum() method will get the correct details from the camera
@@ -6762,37 +6866,14 @@ void Application::update(float deltaTime) {
 
     quint64 now = usecTimestampNow();
 
-    // Update my voxel servers with my current voxel query...
+    // The overlays and the query of the voxel servers for the current view can wait a frame when this one runs long
     {
-        PROFILE_RANGE_EX(app, "QueryOctree", 0xffff0000, (uint64_t)getActiveDisplayPlugin()->presentCount());
-        PerformanceTimer perfTimer("queryOctree");
-        QMutexLocker viewLocker(&_viewMutex);
-
-        bool viewIsDifferentEnough = false;
-        if (_conicalViews.size() == _lastQueriedViews.size()) {
-            for (size_t i = 0; i < _conicalViews.size(); ++i) {
-                if (!_conicalViews[i].isVerySimilar(_lastQueriedViews[i])) {
-                    viewIsDifferentEnough = true;
-                    break;
-                }
-            }
-        } else {
-            viewIsDifferentEnough = true;
-        }
-
-
-        // if it's been a while since our last query or the view has significantly changed then send a query, otherwise suppress it
-        static const std::chrono::seconds MIN_PERIOD_BETWEEN_QUERIES { 3 };
-        auto now = SteadyClock::now();
-        if (now > _queryExpiry || viewIsDifferentEnough) {
-            if (DependencyManager::get<SceneScriptingInterface>()->shouldRenderEntities()) {
-                queryOctree(NodeType::EntityServer, PacketType::EntityQuery);
-            }
-            queryAvatars();
-
-            _lastQueriedViews = _conicalViews;
-            _queryExpiry = now + MIN_PERIOD_BETWEEN_QUERIES;
-        }
+        PROFILE_RANGE_EX(app, "DeferrableUpdates", 0xffff0000, (uint64_t)getActiveDisplayPlugin()->presentCount());
+        int targetRefreshRate = _refreshRateManager.getActiveRefreshRate();
+        quint64 frameBudget = targetRefreshRate > 0 ? USECS_PER_SECOND / targetRefreshRate : USECS_PER_SECOND;
+        _updateScheduler.run(updateStart, frameBudget, deltaTime);
+        _graphicsEngine._frameTimingsScriptingInterface.addUpdateBudgetSample((float)frameBudget / USECS_PER_MSEC,
+            (float)_updateScheduler.getLastFrameUsecs() / USECS_PER_MSEC, _updateScheduler.getDeferredJobs());
     }
 
     // sent nack packets containing missing sequence numbers of received packets from nodes
@@ -6966,6 +7047,28 @@ void Application::updateRenderArgs(float deltaTime) {
             appRenderArgs._renderArgs._stencilMaskOperator = getActiveDisplayPlugin()->getStencilMaskMeshOperator();
         }
 
+        if (appRenderArgs._isStereo) {
+            appRenderArgs._renderArgs._foveationRadius = getActiveDisplayPlugin()->getFoveationRadius();
+        }
+        if (appRenderArgs._renderArgs._foveationRadius > 0.0f) {
+            // follow the gaze of the eyes that are tracked, the others keep to the center the display gives
+            auto headPose = myAvatar->getControllerPoseInSensorFrame(controller::Action::HEAD);
+            glm::quat inverseHeadRotation = glm::inverse(headPose.isValid() ? headPose.getRotation() : glmExtractRotation(appRenderArgs._headPose));
+            glm::vec2 foveationCenters[2];
+            for_each_eye([&](Eye eye) {
+                foveationCenters[eye] = getActiveDisplayPlugin()->getFoveationCenter(eye);
+                auto eyePose = myAvatar->getControllerPoseInSensorFrame(eye == Eye::Left ? controller::Action::LEFT_EYE : controller::Action::RIGHT_EYE);
+                if (eyePose.isValid()) {
+                    glm::vec3 gaze = inverseHeadRotation * eyePose.getRotation() * Vectors::FRONT;
+                    glm::vec4 clipGaze = appRenderArgs._eyeProjections[eye] * glm::vec4(gaze, 0.0f);
+                    if (clipGaze.w > 0.0f) {
+                        foveationCenters[eye] = glm::clamp(glm::vec2(clipGaze) / clipGaze.w, glm::vec2(-1.0f), glm::vec2(1.0f));
+                    }
+                }
+            });
+            appRenderArgs._renderArgs._foveationCenters = glm::vec4(foveationCenters[Eye::Left], foveationCenters[Eye::Right]);
+        }
+
         {
             QMutexLocker viewLocker(&_viewMutex);
             _myCamera.loadViewFrustum(_displayViewFrustum);
@@ -7096,6 +7199,7 @@ void Application::queryOctree(NodeType_t serverType, PacketType packetType) {
         _octreeQuery.setBoundaryLevelAdjust(lodManager->getBoundaryLevelAdjust());
     }
     _octreeQuery.setReportInitialCompletion(isModifiedQuery);
+    _octreeQuery.setCompressionDictionaryID(getEntityCompressionDictionaryID());
 
 
     auto nodeList = DependencyManager::get<NodeList>();
@@ -7298,6 +7402,12 @@ void Application::clearDomainOctreeDetails(bool clearAll) {
     // reset the model renderer
     clearAll ? getEntities()->clear() : getEntities()->clearDomainAndNonOwnedEntities();
 
+    // when changing domain the caches keep what they can hold of the one we're leaving, which is then there straight
+    // away if we go back, and is pushed out by the new domain's content as it loads
+    if (!clearAll) {
+        return;
+    }
+
     DependencyManager::get<AnimationCache>()->clearUnusedResources();
     DependencyManager::get<SoundCache>()->clearUnusedResources();
     DependencyManager::get<MaterialCache>()->clearUnusedResources();
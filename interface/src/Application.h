@@ -58,6 +58,8 @@
 #include "FancyCamera.h"
 #include "ConnectionMonitor.h"
 #include "CursorManager.h"
+#include "DynamicResolutionManager.h"
+#include "FrameBudgetScheduler.h"
 #include "gpu/Context.h"
 #include "LoginStateManager.h"
 #include "Menu.h"
@@ -202,10 +204,13 @@ public:
 
     PerformanceManager& getPerformanceManager() { return _performanceManager; }
     RefreshRateManager& getRefreshRateManager() { return _refreshRateManager; }
+    DynamicResolutionManager& getDynamicResolutionManager() { return _dynamicResolutionManager; }
 
     size_t getRenderFrameCount() const { return _graphicsEngine.getRenderFrameCount(); }
     float getRenderLoopRate() const { return _graphicsEngine.getRenderLoopRate(); }
     float getNumCollisionObjects() const;
+    int getNumCollisionShapes() const { return _shapeManager.getNumShapes(); }
+    size_t getCollisionShapesSize() const { return _shapeManager.getShapesSize(); }
     float getTargetRenderFrameRate() const; // frames/second
 
     static void setupQmlSurface(QQmlContext* surfaceContext, bool setAdditionalContextProperties);
@@ -564,6 +569,9 @@ private:
 
     // Various helper functions called during update()
     void updateLOD(float deltaTime) const;
+    void updateDynamicResolution();
+    void setupUpdateScheduler();
+    void queryOctreeIfViewChanged();
     void updateThreads(float deltaTime);
     void updateDialogs(float deltaTime) const;
 
@@ -739,6 +747,8 @@ private:
     LoginStateManager _loginStateManager;
     PerformanceManager _performanceManager;
     RefreshRateManager _refreshRateManager;
+    DynamicResolutionManager _dynamicResolutionManager;
+    FrameBudgetScheduler _updateScheduler;
 
     GameWorkload _gameWorkload;
 
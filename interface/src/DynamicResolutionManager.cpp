@@ -0,0 +1,78 @@
+//
+//  DynamicResolutionManager.cpp
+//  interface/src/
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "DynamicResolutionManager.h"
+
+#include <cmath>
+
+#include <GLMHelpers.h>
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+
+#include "scripting/RenderScriptingInterface.h"
+
+static const float MIN_RESOLUTION_SCALE = 0.5f;
+static const float MAX_RESOLUTION_SCALE = 1.0f;
+// every change of the scale rebuilds the framebuffers of the main view and restarts its TAA history, so it changes in steps
+static const float RESOLUTION_SCALE_STEP = 0.05f;
+// the share of the frame time the gpu is kept to, to leave room for the spikes
+static const float GPU_TIME_BUDGET = 0.9f;
+// the gpu time is a moving average, that is left to settle after each change
+static const quint64 MIN_CHANGE_INTERVAL_USECS = USECS_PER_SECOND / 2;
+
+DynamicResolutionManager::DynamicResolutionManager() {
+    _enabled = _enabledSetting.get();
+}
+
+void DynamicResolutionManager::setEnabled(bool enabled) {
+    if (_enabled != enabled) {
+        _enabled = enabled;
+        _enabledSetting.set(enabled);
+        if (!enabled) {
+            setResolutionScale(MAX_RESOLUTION_SCALE);
+        }
+    }
+}
+
+void DynamicResolutionManager::update(float gpuTime, int targetRefreshRate) {
+    if (!_enabled || gpuTime <= 0.0f || targetRefreshRate <= 0) {
+        return;
+    }
+
+    quint64 now = usecTimestampNow();
+    if (now - _lastChangeUsecs < MIN_CHANGE_INTERVAL_USECS) {
+        return;
+    }
+
+    // the gpu time goes with the number of pixels, the square of the scale
+    float budget = GPU_TIME_BUDGET * (float)MSECS_PER_SECOND / (float)targetRefreshRate;
+    float scale = _resolutionScale;
+    if (gpuTime > budget) {
+        float fittingScale = _resolutionScale * sqrtf(budget / gpuTime);
+        scale = std::min(floorf(fittingScale / RESOLUTION_SCALE_STEP) * RESOLUTION_SCALE_STEP, _resolutionScale - RESOLUTION_SCALE_STEP);
+    } else {
+        float nextScale = _resolutionScale + RESOLUTION_SCALE_STEP;
+        float nextGPUTime = gpuTime * (nextScale * nextScale) / (_resolutionScale * _resolutionScale);
+        if (nextGPUTime < budget) {
+            scale = nextScale;
+        }
+    }
+    scale = glm::clamp(scale, MIN_RESOLUTION_SCALE, MAX_RESOLUTION_SCALE);
+
+    if (fabsf(scale - _resolutionScale) > 0.5f * RESOLUTION_SCALE_STEP) {
+        setResolutionScale(scale);
+        _lastChangeUsecs = now;
+    }
+}
+
+void DynamicResolutionManager::setResolutionScale(float scale) {
+    _resolutionScale = scale;
+    RenderScriptingInterface::getInstance()->setDynamicResolutionScale(scale);
+}
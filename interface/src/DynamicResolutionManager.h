@@ -0,0 +1,41 @@
+//
+//  DynamicResolutionManager.h
+//  interface/src/
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_DynamicResolutionManager_h
+#define vircadia_DynamicResolutionManager_h
+
+#include <QtCore/QtGlobal>
+
+#include <SettingHandle.h>
+
+// Scales the resolution of the main view down when the gpu can't keep up with the refresh rate of the RefreshRateManager,
+// and back up to the viewport resolution scale the settings give once it can
+class DynamicResolutionManager {
+public:
+    DynamicResolutionManager();
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return _enabled; }
+
+    // gpuTime is the moving average of the gpu frame time, in ms
+    void update(float gpuTime, int targetRefreshRate);
+
+    float getResolutionScale() const { return _resolutionScale; }
+
+private:
+    void setResolutionScale(float scale);
+
+    Setting::Handle<bool> _enabledSetting { "dynamicResolution", false };
+    bool _enabled { false };
+    float _resolutionScale { 1.0f };
+    quint64 _lastChangeUsecs { 0 };
+};
+
+#endif // vircadia_DynamicResolutionManager_h
@@ -0,0 +1,64 @@
+//
+//  FrameBudgetScheduler.cpp
+//  interface/src/
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "FrameBudgetScheduler.h"
+
+#include <algorithm>
+
+#include <PerfStat.h>
+#include <Profile.h>
+#include <SharedUtil.h>
+
+// how fast the estimate of a job's run time follows its latest runs
+static const float RUN_TIME_AVERAGE_WEIGHT = 0.1f;
+
+void FrameBudgetScheduler::addJob(const QString& name, Priority priority, int maxDeferredFrames, Job job) {
+    ScheduledJob scheduled;
+    scheduled.name = name;
+    scheduled.timerName = name.toStdString();
+    scheduled.priority = priority;
+    scheduled.maxDeferredFrames = maxDeferredFrames;
+    scheduled.job = job;
+    // jobs are kept in priority order, and in the order they were added within a priority
+    auto itr = std::upper_bound(_jobs.begin(), _jobs.end(), scheduled, [](const ScheduledJob& a, const ScheduledJob& b) {
+        return a.priority < b.priority;
+    });
+    _jobs.insert(itr, scheduled);
+}
+
+void FrameBudgetScheduler::run(quint64 frameStartUsecs, quint64 budgetUsecs, float deltaTime) {
+    _deferredJobs.clear();
+    const quint64 budgetEnd = frameStartUsecs + budgetUsecs;
+
+    for (auto& scheduled : _jobs) {
+        scheduled.pendingDeltaTime += deltaTime;
+
+        quint64 now = usecTimestampNow();
+        quint64 remaining = now < budgetEnd ? budgetEnd - now : 0;
+        bool overdue = scheduled.deferredFrames >= scheduled.maxDeferredFrames;
+        if (!overdue && scheduled.averageUsecs > (float)remaining) {
+            ++scheduled.deferredFrames;
+            _deferredJobs << scheduled.name;
+            continue;
+        }
+
+        {
+            PROFILE_RANGE(app, scheduled.name);
+            PerformanceTimer perfTimer(scheduled.timerName.c_str());
+            scheduled.job(scheduled.pendingDeltaTime);
+        }
+        float runUsecs = (float)(usecTimestampNow() - now);
+        scheduled.averageUsecs += RUN_TIME_AVERAGE_WEIGHT * (runUsecs - scheduled.averageUsecs);
+        scheduled.pendingDeltaTime = 0.0f;
+        scheduled.deferredFrames = 0;
+    }
+
+    _lastFrameUsecs = usecTimestampNow() - frameStartUsecs;
+}
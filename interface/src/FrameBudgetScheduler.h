@@ -0,0 +1,63 @@
+//
+//  FrameBudgetScheduler.h
+//  interface/src/
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_FrameBudgetScheduler_h
+#define vircadia_FrameBudgetScheduler_h
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+// Runs the parts of Application::update that can wait a frame within what is left of the frame's time budget.
+//
+// Each job keeps a moving average of its run time; a job that doesn't fit what is left of the budget is deferred to a
+// later frame, with the time it missed added to the deltaTime it is run with. The higher priorities go first, and a job
+// that has been deferred for its maximum number of frames runs whatever the budget.
+class FrameBudgetScheduler {
+public:
+    enum class Priority {
+        High,
+        Normal,
+        Low
+    };
+
+    // deltaTime is the time since the job last ran, in seconds
+    using Job = std::function<void(float deltaTime)>;
+
+    void addJob(const QString& name, Priority priority, int maxDeferredFrames, Job job);
+
+    // runs the jobs that fit in what is left of budgetUsecs since frameStartUsecs
+    void run(quint64 frameStartUsecs, quint64 budgetUsecs, float deltaTime);
+
+    // the outcome of the last run, the names of the jobs that were deferred to a later frame
+    const QStringList& getDeferredJobs() const { return _deferredJobs; }
+    quint64 getLastFrameUsecs() const { return _lastFrameUsecs; }
+
+private:
+    struct ScheduledJob {
+        QString name;
+        std::string timerName; // PerformanceTimer keeps the pointer to its name
+        Priority priority;
+        int maxDeferredFrames;
+        Job job;
+        float averageUsecs { 0.0f };
+        float pendingDeltaTime { 0.0f };
+        int deferredFrames { 0 };
+    };
+
+    std::vector<ScheduledJob> _jobs;
+    QStringList _deferredJobs;
+    quint64 _lastFrameUsecs { 0 };
+};
+
+#endif // vircadia_FrameBudgetScheduler_h
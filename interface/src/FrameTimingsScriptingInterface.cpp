@@ -8,6 +8,8 @@
 
 #include "FrameTimingsScriptingInterface.h"
 
+#include <algorithm>
+
 #include <TextureCache.h>
 
 void FrameTimingsScriptingInterface::start() {
@@ -51,3 +53,57 @@ QVariantList FrameTimingsScriptingInterface::getValues() const {
     }
     return result;
 }
+
+static const size_t RESOLUTION_SCALE_HISTORY_SIZE = 600;
+
+void FrameTimingsScriptingInterface::addResolutionScale(float gpuTime, float targetTime, float resolutionScale) {
+    if (_resolutionScaleHistory.size() >= RESOLUTION_SCALE_HISTORY_SIZE) {
+        _resolutionScaleHistory.pop_front();
+    }
+    _resolutionScaleHistory.push_back({ gpuTime, targetTime, resolutionScale });
+}
+
+QVariantList FrameTimingsScriptingInterface::getResolutionScaleHistory() const {
+    QVariantList result;
+    for (const auto& sample : _resolutionScaleHistory) {
+        QVariantMap map;
+        map["gpuTime"] = sample.gpuTime;
+        map["targetTime"] = sample.targetTime;
+        map["resolutionScale"] = sample.resolutionScale;
+        result << map;
+    }
+    return result;
+}
+
+static const size_t UPDATE_BUDGET_HISTORY_SIZE = 600;
+
+void FrameTimingsScriptingInterface::addUpdateBudgetSample(float budgetTime, float updateTime, const QStringList& deferredJobs) {
+    if (_updateBudgetHistory.size() >= UPDATE_BUDGET_HISTORY_SIZE) {
+        _updateBudgetHistory.pop_front();
+    }
+    _updateBudgetHistory.push_back({ budgetTime, updateTime, deferredJobs });
+}
+
+QVariantList FrameTimingsScriptingInterface::getUpdateBudgetHistory() const {
+    QVariantList result;
+    for (const auto& sample : _updateBudgetHistory) {
+        QVariantMap map;
+        map["budgetTime"] = sample.budgetTime;
+        map["updateTime"] = sample.updateTime;
+        map["deferredJobs"] = sample.deferredJobs;
+        result << map;
+    }
+    return result;
+}
+
+int FrameTimingsScriptingInterface::getUpdateOverrunCount() const {
+    return (int)std::count_if(_updateBudgetHistory.begin(), _updateBudgetHistory.end(), [](const UpdateBudgetSample& sample) {
+        return sample.updateTime > sample.budgetTime;
+    });
+}
+
+int FrameTimingsScriptingInterface::getDeferredUpdateCount() const {
+    return (int)std::count_if(_updateBudgetHistory.begin(), _updateBudgetHistory.end(), [](const UpdateBudgetSample& sample) {
+        return !sample.deferredJobs.isEmpty();
+    });
+}
@@ -8,7 +8,9 @@
 
 #pragma once
 #include <stdint.h>
+#include <deque>
 #include <QtCore/QObject>
+#include <QtCore/QStringList>
 
 class FrameTimingsScriptingInterface : public QObject {
     Q_OBJECT
@@ -22,6 +24,18 @@ public:
     Q_INVOKABLE void finish();
     Q_INVOKABLE QVariantList getValues() const;
 
+    // the gpu frame times (in ms), frame time targets (in ms) and main view resolution scales that dynamic resolution scaling
+    // went through in the last frames, the oldest first
+    Q_INVOKABLE QVariantList getResolutionScaleHistory() const;
+    void addResolutionScale(float gpuTime, float targetTime, float resolutionScale);
+
+    // the main thread frame budgets (in ms), the time Application::update took against them (in ms) and the names of the
+    // update jobs put off to a later frame, in the last frames, the oldest first
+    Q_INVOKABLE QVariantList getUpdateBudgetHistory() const;
+    // the number of frames in that history where the update ran over its budget, and where a job was put off
+    Q_INVOKABLE int getUpdateOverrunCount() const;
+    Q_INVOKABLE int getDeferredUpdateCount() const;
+    void addUpdateBudgetSample(float budgetTime, float updateTime, const QStringList& deferredJobs);
 
     uint64_t getMax() const { return _max; }
     uint64_t getMin() const { return _min; }
@@ -35,4 +49,18 @@ protected:
     uint64_t _min { 0 };
     float _stdDev { 0 };
     float _mean { 0 };
+
+    struct ResolutionScaleSample {
+        float gpuTime;
+        float targetTime;
+        float resolutionScale;
+    };
+    std::deque<ResolutionScaleSample> _resolutionScaleHistory;
+
+    struct UpdateBudgetSample {
+        float budgetTime;
+        float updateTime;
+        QStringList deferredJobs;
+    };
+    std::deque<UpdateBudgetSample> _updateBudgetHistory;
 };
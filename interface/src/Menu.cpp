@@ -27,6 +27,7 @@
 #include <DependencyManager.h>
 #include <ui/TabletScriptingInterface.h>
 #include <display-plugins/DisplayPlugin.h>
+#include <model-networking/HFMCache.h>
 #include <PathUtils.h>
 #include <SettingHandle.h>
 #include <UserActivityLogger.h>
@@ -509,6 +510,16 @@ Menu::Menu() {
         ModelMeshPartPayload::enableMaterialProceduralShaders = action->isChecked();
     });
 
+    action = addCheckableActionToQMenuAndActionHash(renderOptionsMenu, MenuOption::InstanceModelParts, 0, true);
+    connect(action, &QAction::triggered, [action] {
+        ModelMeshPartPayload::enableInstancing = action->isChecked();
+    });
+
+    action = addCheckableActionToQMenuAndActionHash(renderOptionsMenu, MenuOption::MeshLODs, 0, true);
+    connect(action, &QAction::triggered, [action] {
+        ModelMeshPartPayload::enableLODs = action->isChecked();
+    });
+
     {
         auto drawStatusConfig = qApp->getRenderEngine()->getConfiguration()->getConfig<render::DrawStatus>("RenderMainView.DrawStatus");
         addCheckableActionToQMenuAndActionHash(renderOptionsMenu, MenuOption::HighlightTransitions, 0, false,
@@ -623,8 +634,10 @@ Menu::Menu() {
         HFWebEngineProfile::clearCache();
 #endif
 
-        // Clear the KTX cache on the next restart. It can't be cleared immediately because its files might be in use.
+        // Clear the KTX and model caches on the next restart. They can't be cleared immediately because their files might
+        // be in use.
         Setting::Handle<int>(KTXCache::SETTING_VERSION_NAME, KTXCache::INVALID_VERSION).set(KTXCache::INVALID_VERSION);
+        Setting::Handle<int>(HFMCache::SETTING_VERSION_NAME, HFMCache::INVALID_VERSION).set(HFMCache::INVALID_VERSION);
     });
 
     addCheckableActionToQMenuAndActionHash(networkMenu,
@@ -232,6 +232,8 @@ namespace MenuOption {
     const QString ComputeBlendshapes = "Compute Blendshapes";
     const QString HighlightTransitions = "Highlight Transitions";
     const QString MaterialProceduralShaders = "Enable Procedural Materials";
+    const QString InstanceModelParts = "Instance Repeated Model Parts";
+    const QString MeshLODs = "Draw Mesh LODs";
 }
 
 #endif // hifi_Menu_h
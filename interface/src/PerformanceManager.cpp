@@ -14,6 +14,7 @@
 #include <platform/PlatformKeys.h>
 #include <platform/Profiler.h>
 
+#include "avatar/AvatarManager.h"
 #include "scripting/RenderScriptingInterface.h"
 #include "LODManager.h"
 
@@ -93,7 +94,9 @@ void PerformanceManager::applyPerformancePreset(PerformanceManager::PerformanceP
             RenderScriptingInterface::getInstance()->setShadowsEnabled(true);
             qApp->getRefreshRateManager().setRefreshRateProfile(RefreshRateManager::RefreshRateProfile::REALTIME);
 
+            qApp->getDynamicResolutionManager().setEnabled(false);
             DependencyManager::get<LODManager>()->setWorldDetailQuality(WORLD_DETAIL_HIGH);
+            DependencyManager::get<AvatarManager>()->setMaxJointUpdateRates({ { 0.0f, 0.0f, 15.0f, 5.0f } });
             
             break;
         case PerformancePreset::MID:
@@ -105,7 +108,9 @@ void PerformanceManager::applyPerformancePreset(PerformanceManager::PerformanceP
 
             RenderScriptingInterface::getInstance()->setShadowsEnabled(false);
             qApp->getRefreshRateManager().setRefreshRateProfile(RefreshRateManager::RefreshRateProfile::REALTIME);
+            qApp->getDynamicResolutionManager().setEnabled(true);
             DependencyManager::get<LODManager>()->setWorldDetailQuality(WORLD_DETAIL_MEDIUM);
+            DependencyManager::get<AvatarManager>()->setMaxJointUpdateRates({ { 0.0f, 30.0f, 15.0f, 5.0f } });
 
             break;
         case PerformancePreset::LOW:
@@ -115,7 +120,9 @@ void PerformanceManager::applyPerformancePreset(PerformanceManager::PerformanceP
 
             RenderScriptingInterface::getInstance()->setViewportResolutionScale(recommendedPpiScale);
 
+            qApp->getDynamicResolutionManager().setEnabled(true);
             DependencyManager::get<LODManager>()->setWorldDetailQuality(WORLD_DETAIL_LOW);
+            DependencyManager::get<AvatarManager>()->setMaxJointUpdateRates({ { 0.0f, 15.0f, 5.0f, 5.0f } });
 
             break;
         case PerformancePreset::LOW_POWER:
@@ -125,7 +132,9 @@ void PerformanceManager::applyPerformancePreset(PerformanceManager::PerformanceP
 
             RenderScriptingInterface::getInstance()->setViewportResolutionScale(recommendedPpiScale);
 
+            qApp->getDynamicResolutionManager().setEnabled(true);
             DependencyManager::get<LODManager>()->setWorldDetailQuality(WORLD_DETAIL_LOW);
+            DependencyManager::get<AvatarManager>()->setMaxJointUpdateRates({ { 0.0f, 15.0f, 5.0f, 5.0f } });
 
             break;
         case PerformancePreset::UNKNOWN:
@@ -11,9 +11,12 @@
 
 #include "SecondaryCamera.h"
 
+#include <LightingModel.h>
 #include <RenderDeferredTask.h>
 #include <RenderForwardTask.h>
+#include <RenderShadowTask.h>
 #include <RenderViewTask.h>
+#include <SharedUtil.h>
 
 #include <glm/gtx/transform.hpp>
 #include <gpu/Context.h>
@@ -22,6 +25,10 @@
 
 using RenderArgsPointer = std::shared_ptr<RenderArgs>;
 
+// what the reduced pipeline gives up next to the main view
+static const float REDUCED_SHADOW_MAX_DISTANCE = 20.0f; // meters
+static const float REDUCED_LOD_ANGLE_SCALE = 2.0f;
+
 class SecondaryCameraJob {  // Changes renderContext for our framebuffer and view.
 public:
     using Config = SecondaryCameraJobConfig;
@@ -44,6 +51,8 @@ public:
         _textureHeight = config.textureHeight;
         _mirrorProjection = config.mirrorProjection;
         _portalProjection = config.portalProjection;
+        _reducedPipeline = config.reducedPipeline;
+        _maxFps = config.maxFps;
     }
 
     void setPortalProjection(ViewFrustum& srcViewFrustum) {
@@ -143,6 +152,17 @@ public:
     }
 
     void run(const render::RenderContextPointer& renderContext, RenderArgsPointer& cachedArgs) {
+        // frames between the capped ones skip the rest of the task, leaving the last frame in the framebuffer
+        if (_maxFps > 0.0f) {
+            quint64 now = usecTimestampNow();
+            if (now < _nextFrameTime) {
+                renderContext->taskFlow.abortTask();
+                return;
+            }
+            quint64 frameInterval = (quint64)(USECS_PER_SECOND / _maxFps);
+            _nextFrameTime = (now - _nextFrameTime < frameInterval) ? _nextFrameTime + frameInterval : now + frameInterval;
+        }
+
         auto args = renderContext->args;
         auto textureCache = DependencyManager::get<TextureCache>();
         gpu::FramebufferPointer destFramebuffer;
@@ -153,11 +173,17 @@ public:
             _cachedArgsPointer->_displayMode = args->_displayMode;
             _cachedArgsPointer->_renderMode = args->_renderMode;
             _cachedArgsPointer->_stencilMaskMode = args->_stencilMaskMode;
+            _cachedArgsPointer->_lodAngleHalfTan = args->_lodAngleHalfTan;
+            _cachedArgsPointer->_lodAngleHalfTanSq = args->_lodAngleHalfTanSq;
             args->_blitFramebuffer = destFramebuffer;
             args->_viewport = glm::ivec4(0, 0, destFramebuffer->getWidth(), destFramebuffer->getHeight());
             args->_displayMode = RenderArgs::MONO;
             args->_renderMode = RenderArgs::RenderMode::SECONDARY_CAMERA_RENDER_MODE;
             args->_stencilMaskMode = StencilMaskMode::NONE;
+            if (_reducedPipeline) {
+                args->_lodAngleHalfTan *= REDUCED_LOD_ANGLE_SCALE;
+                args->_lodAngleHalfTanSq = args->_lodAngleHalfTan * args->_lodAngleHalfTan;
+            }
 
             gpu::doInBatch("SecondaryCameraJob::run", args->_context, [&](gpu::Batch& batch) {
                 batch.disableContextStereo();
@@ -218,6 +244,9 @@ private:
     int _textureHeight;
     bool _mirrorProjection;
     bool _portalProjection;
+    bool _reducedPipeline;
+    float _maxFps;
+    quint64 _nextFrameTime { 0 };
     EntityPropertyFlags _attachedEntityPropertyFlags;
 };
 
@@ -239,6 +268,28 @@ void SecondaryCameraJobConfig::setOrientation(glm::quat orient) {
     }
 }
 
+void SecondaryCameraJobConfig::setReducedPipeline(bool reduced) {
+    reducedPipeline = reduced;
+
+    // the effects are switched in the secondary view's own jobs, leaving the main view's alone
+    auto renderConfig = qApp->getRenderEngine()->getConfiguration();
+    auto lightingModelConfig = renderConfig->getConfig<MakeLightingModel>("RenderSecondView.LightingModel");
+    if (lightingModelConfig) {
+        lightingModelConfig->enableHaze = !reduced;
+        lightingModelConfig->enableBloom = !reduced;
+        if (reduced) {
+            lightingModelConfig->setAmbientOcclusion(false);
+        }
+        emit lightingModelConfig->dirty();
+    }
+    auto shadowSetupConfig = renderConfig->getConfig<RenderShadowSetup>("RenderSecondView.ShadowSetup");
+    if (shadowSetupConfig) {
+        shadowSetupConfig->maxDistance = reduced ? REDUCED_SHADOW_MAX_DISTANCE : 0.0f;
+        emit shadowSetupConfig->dirty();
+    }
+    emit dirty();
+}
+
 void SecondaryCameraJobConfig::enableSecondaryCameraRenderConfigs(bool enabled) {
     qApp->getRenderEngine()->getConfiguration()->getConfig<SecondaryCameraRenderTask>("SecondaryCameraJob")->setEnabled(enabled);
     setEnabled(enabled);
@@ -262,6 +313,8 @@ public:
             args->_displayMode = cachedArgs->_displayMode;
             args->_renderMode = cachedArgs->_renderMode;
             args->_stencilMaskMode = cachedArgs->_stencilMaskMode;
+            args->_lodAngleHalfTan = cachedArgs->_lodAngleHalfTan;
+            args->_lodAngleHalfTanSq = cachedArgs->_lodAngleHalfTanSq;
         }
         args->popViewFrustum();
 
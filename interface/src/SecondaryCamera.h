@@ -28,6 +28,8 @@ class SecondaryCameraJobConfig : public render::Task::Config { // Exposes second
     Q_PROPERTY(float farClipPlaneDistance MEMBER farClipPlaneDistance NOTIFY dirty)  // Secondary camera's far clip plane distance. In meters.
     Q_PROPERTY(bool mirrorProjection MEMBER mirrorProjection NOTIFY dirty)  // Flag to use attached mirror entity to build frustum for the mirror and set mirrored camera position/orientation.
     Q_PROPERTY(bool portalProjection MEMBER portalProjection NOTIFY dirty)  // Flag to use attached portal entity to build frustum for the portal and set portal camera position/orientation.
+    Q_PROPERTY(bool reducedPipeline READ getReducedPipeline WRITE setReducedPipeline NOTIFY dirty)  // Render without haze or bloom, with shorter shadows and less detail, for a cheaper view.
+    Q_PROPERTY(float maxFps MEMBER maxFps NOTIFY dirty)  // Most frames per second to render, e.g. when streaming the view out. 0 renders every frame.
 public:
     QUuid attachedEntityId;
     QUuid portalEntranceEntityId;
@@ -40,6 +42,8 @@ public:
     int textureHeight { TextureCache::DEFAULT_SPECTATOR_CAM_HEIGHT };
     bool mirrorProjection { false };
     bool portalProjection { false };
+    bool reducedPipeline { false };
+    float maxFps { 0.0f };
 
     SecondaryCameraJobConfig() : render::Task::Config(false) {}
 signals:
@@ -49,6 +53,8 @@ public slots:
     void setPosition(glm::vec3 pos);
     glm::quat getOrientation() { return orientation; }
     void setOrientation(glm::quat orient);
+    bool getReducedPipeline() { return reducedPipeline; }
+    void setReducedPipeline(bool reduced);
     void enableSecondaryCameraRenderConfigs(bool enabled);
     void resetSizeSpectatorCamera(int width, int height);
 };
@@ -35,6 +35,7 @@
 #include <RegisteredMetaTypes.h>
 #include <Rig.h>
 #include <SettingHandle.h>
+#include <TBBHelpers.h>
 #include <UsersScriptingInterface.h>
 #include <UUID.h>
 #include <shared/ConicalViewFrustum.h>
@@ -303,6 +304,26 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
 
         auto passExpiry = updatePriorityExpiries[p];
 
+        {
+            // the avatars' poses don't depend on one another, so those that have new joint data are all posed at once
+            // here and then simulated in order below
+            PROFILE_RANGE(simulation, "updateJointPoses");
+            uint64_t now = usecTimestampNow();
+            std::vector<std::shared_ptr<OtherAvatar>> avatarsToPose;
+            for (const auto& sortData : sortedAvatarVector) {
+                const auto avatar = std::static_pointer_cast<OtherAvatar>(sortData.getAvatar());
+                // further away avatars are posed less often
+                uint8_t region = avatar->getWorkloadRegion();
+                avatar->updateJointUpdateDeferral(now, region < workload::Region::NUM_KNOWN_REGIONS ? _maxJointUpdateRates[region] : 0.0f);
+                if (sortData.getPriority() > OUT_OF_VIEW_THRESHOLD && avatar->hasJointUpdate()) {
+                    avatarsToPose.push_back(avatar);
+                }
+            }
+            tbb::parallel_for(size_t(0), avatarsToPose.size(), [&](size_t i) {
+                avatarsToPose[i]->updateJointPoses();
+            });
+        }
+
         for (auto it = sortedAvatarVector.begin(); it != sortedAvatarVector.end(); ++it) {
             const SortableAvatar& sortData = *it;
             const auto avatar = std::static_pointer_cast<OtherAvatar>(sortData.getAvatar());
@@ -331,7 +352,7 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
             if (now < passExpiry) {
                 // we're within budget
                 bool inView = sortData.getPriority() > OUT_OF_VIEW_THRESHOLD;
-                if (inView && avatar->hasNewJointData()) {
+                if (inView && avatar->hasJointUpdate()) {
                     numAvatarsUpdated++;
                 }
                 auto transitStatus = avatar->_transit.update(deltaTime, avatar->_serverPosition, _transitConfig);
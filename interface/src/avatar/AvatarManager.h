@@ -12,6 +12,7 @@
 #ifndef hifi_AvatarManager_h
 #define hifi_AvatarManager_h
 
+#include <array>
 #include <set>
 
 #include <QtCore/QHash>
@@ -253,6 +254,12 @@ public:
 
     void accumulateGrabPositions(std::map<QUuid, GrabLocationAccumulator>& grabAccumulators);
 
+    // The most times a second that the poses of the other avatars in each workload region are updated from their joint
+    // data.  0 is every frame.
+    using JointUpdateRates = std::array<float, workload::Region::NUM_KNOWN_REGIONS>;
+    void setMaxJointUpdateRates(const JointUpdateRates& rates) { _maxJointUpdateRates = rates; }
+    const JointUpdateRates& getMaxJointUpdateRates() const { return _maxJointUpdateRates; }
+
 public slots:
     /*@jsdoc
      * @function AvatarManager.updateAvatarRenderStatus
@@ -312,6 +319,7 @@ private:
 
     AvatarTransit::TransitConfig  _transitConfig;
     bool _drawOtherAvatarSkeletons { false };
+    JointUpdateRates _maxJointUpdateRates { { 0.0f, 0.0f, 15.0f, 5.0f } };
 };
 
 #endif // hifi_AvatarManager_h
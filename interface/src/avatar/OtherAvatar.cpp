@@ -248,6 +248,17 @@ void OtherAvatar::setCollisionWithOtherAvatarsFlags() {
     }
 }
 
+void OtherAvatar::updateJointPoses() {
+    _skeletonModel->getRig().copyJointsFromJointData(_jointData);
+    glm::mat4 rootTransform = glm::scale(_skeletonModel->getScale()) * glm::translate(_skeletonModel->getOffset());
+    _skeletonModel->getRig().computeExternalPoses(rootTransform);
+    _jointPosesUpdated = true;
+}
+
+void OtherAvatar::updateJointUpdateDeferral(uint64_t now, float maxRate) {
+    _jointUpdateDeferred = maxRate > 0.0f && now - _lastJointUpdateTime < (uint64_t)(USECS_PER_SECOND / maxRate);
+}
+
 void OtherAvatar::simulate(float deltaTime, bool inView) {
     PROFILE_RANGE(simulation, "simulate");
 
@@ -266,10 +277,12 @@ void OtherAvatar::simulate(float deltaTime, bool inView) {
         PROFILE_RANGE(simulation, "updateJoints");
         if (inView) {
             Head* head = getHead();
-            if (_hasNewJointData || _transit.isActive()) {
-                _skeletonModel->getRig().copyJointsFromJointData(_jointData);
-                glm::mat4 rootTransform = glm::scale(_skeletonModel->getScale()) * glm::translate(_skeletonModel->getOffset());
-                _skeletonModel->getRig().computeExternalPoses(rootTransform);
+            if (hasJointUpdate() || _transit.isActive()) {
+                _lastJointUpdateTime = usecTimestampNow();
+                if (!_jointPosesUpdated) {
+                    updateJointPoses();
+                }
+                _jointPosesUpdated = false;
                 _jointDataSimulationRate.increment();
 
                 head->simulate(deltaTime);
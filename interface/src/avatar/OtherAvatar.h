@@ -63,6 +63,14 @@ public:
 
     void setCollisionWithOtherAvatarsFlags() override;
 
+    // Poses the rig from the joint data that's arrived since the last simulate().  Only touches this avatar, so
+    // AvatarManager does it for many avatars at once before simulating them one by one.
+    void updateJointPoses();
+
+    // Defers applying new joint data until 1 / maxRate seconds have passed since it was last applied, if maxRate isn't 0.
+    void updateJointUpdateDeferral(uint64_t now, float maxRate);
+    bool hasJointUpdate() const { return _hasNewJointData && !_jointUpdateDeferred; }
+
     void simulate(float deltaTime, bool inView) override;
     void debugJointData() const;
     friend AvatarManager;
@@ -91,6 +99,9 @@ protected:
     uint8_t _workloadRegion { workload::Region::INVALID };
     BodyLOD _bodyLOD { BodyLOD::Sphere };
     bool _needsDetailedRebuild { false };
+    bool _jointPosesUpdated { false };
+    bool _jointUpdateDeferred { false };
+    uint64_t _lastJointUpdateTime { 0 };
 };
 
 using OtherAvatarPointer = std::shared_ptr<OtherAvatar>;
@@ -189,17 +189,35 @@ void RenderScriptingInterface::forceViewportResolutionScale(float scale) {
         _viewportResolutionScale = (scale);
         _viewportResolutionScaleSetting.set(scale);
 
-        auto renderConfig = qApp->getRenderEngine()->getConfiguration();
-        assert(renderConfig);
-        auto deferredView = renderConfig->getConfig("RenderMainView.RenderDeferredTask");
-        // mainView can be null if we're rendering in forward mode
-        if (deferredView) {
-            deferredView->setProperty("resolutionScale", _viewportResolutionScale);
-        }
-        auto forwardView = renderConfig->getConfig("RenderMainView.RenderForwardTask");
-        // mainView can be null if we're rendering in forward mode
-        if (forwardView) {
-            forwardView->setProperty("resolutionScale", _viewportResolutionScale);
+        applyResolutionScale();
+    });
+}
+
+void RenderScriptingInterface::setDynamicResolutionScale(float scale) {
+    if (scale <= 0.f) {
+        return;
+    }
+    _renderSettingLock.withWriteLock([&] {
+        if (_dynamicResolutionScale != scale) {
+            _dynamicResolutionScale = scale;
+            applyResolutionScale();
         }
     });
 }
+
+void RenderScriptingInterface::applyResolutionScale() {
+    float resolutionScale = _viewportResolutionScale * _dynamicResolutionScale;
+
+    auto renderConfig = qApp->getRenderEngine()->getConfiguration();
+    assert(renderConfig);
+    auto deferredView = renderConfig->getConfig("RenderMainView.RenderDeferredTask");
+    // mainView can be null if we're rendering in forward mode
+    if (deferredView) {
+        deferredView->setProperty("resolutionScale", resolutionScale);
+    }
+    auto forwardView = renderConfig->getConfig("RenderMainView.RenderForwardTask");
+    // mainView can be null if we're rendering in forward mode
+    if (forwardView) {
+        forwardView->setProperty("resolutionScale", resolutionScale);
+    }
+}
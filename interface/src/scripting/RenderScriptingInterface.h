@@ -74,6 +74,9 @@ public:
     // Need to be called on start up to re-initialize the runtime to the saved setting states
     void loadSettings();
 
+    // The scale that dynamic resolution applies on top of the viewport resolution scale, not saved to the settings
+    void setDynamicResolutionScale(float scale);
+
 public slots:
     /*@jsdoc
      * Gets the configuration for a rendering job by name.
@@ -196,6 +199,7 @@ private:
     bool _ambientOcclusionEnabled{ false };
     AntialiasingConfig::Mode _antialiasingMode{ AntialiasingConfig::Mode::TAA };
     float _viewportResolutionScale{ 1.0f };
+    float _dynamicResolutionScale{ 1.0f };
 
     // Actual settings saved on disk
     Setting::Handle<int> _renderMethodSetting { "renderMethod", RENDER_FORWARD ? render::Args::RenderMethod::FORWARD : render::Args::RenderMethod::DEFERRED };
@@ -211,6 +215,7 @@ private:
     void forceAmbientOcclusionEnabled(bool enabled);
     void forceAntialiasingMode(AntialiasingConfig::Mode mode);
     void forceViewportResolutionScale(float scale);
+    void applyResolutionScale();
 
     static std::once_flag registry_flag;
 };
@@ -514,6 +514,12 @@ void setupPreferences() {
         auto preference = new CheckPreference(AUDIO_BUFFERS, "Disable output starve detection", getter, setter);
         preferences->addPreference(preference);
     }
+    {
+        auto getter = []()->bool { return DependencyManager::get<AudioClient>()->getLowLatencyEnabled(); };
+        auto setter = [](bool value) { DependencyManager::get<AudioClient>()->setLowLatencyEnabled(value); };
+        auto preference = new CheckPreference(AUDIO_BUFFERS, "Low latency device buffers", getter, setter);
+        preferences->addPreference(preference);
+    }
     {
         auto getter = []()->float { return DependencyManager::get<AudioClient>()->getOutputBufferSize(); };
         auto setter = [](float value) { DependencyManager::get<AudioClient>()->setOutputBufferSize(value); };
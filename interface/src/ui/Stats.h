@@ -87,6 +87,10 @@ private: \
  *     <em>Read-only.</em>
  * @property {number} physicsObjectCount - The number of objects that have collisions enabled.
  *     <em>Read-only.</em>
+ * @property {number} physicsShapeCount - The number of collision shapes, which objects with the same shape share.
+ *     <em>Read-only.</em>
+ * @property {number} physicsShapeMemory - The approximate memory size of the collision shapes, in MB.
+ *     <em>Read-only.</em>
  * @property {number} updatedAvatarCount - The number of avatars in the domain, other than the client's, that were updated in 
  *     the most recent game loop.
  *     <em>Read-only.</em>
@@ -485,6 +489,8 @@ class Stats : public QQuickItem {
     STATS_PROPERTY(QString, uxMode, QString())
     STATS_PROPERTY(int, heroAvatarCount, 0)
     STATS_PROPERTY(int, physicsObjectCount, 0)
+    STATS_PROPERTY(int, physicsShapeCount, 0)
+    STATS_PROPERTY(int, physicsShapeMemory, 0)
     STATS_PROPERTY(int, updatedAvatarCount, 0)
     STATS_PROPERTY(int, updatedHeroAvatarCount, 0)
     STATS_PROPERTY(int, notUpdatedAvatarCount, 0)
@@ -795,6 +801,20 @@ signals:
      */
     void physicsObjectCountChanged();
 
+    /*@jsdoc
+     * Triggered when the value of the <code>physicsShapeCount</code> property changes.
+     * @function Stats.physicsShapeCountChanged
+     * @returns {Signal}
+     */
+    void physicsShapeCountChanged();
+
+    /*@jsdoc
+     * Triggered when the value of the <code>physicsShapeMemory</code> property changes.
+     * @function Stats.physicsShapeMemoryChanged
+     * @returns {Signal}
+     */
+    void physicsShapeMemoryChanged();
+
     /*@jsdoc
      * Triggered when the value of the <code>updatedAvatarCount</code> property changes.
      * @function Stats.updatedAvatarCountChanged
@@ -14,6 +14,7 @@
 #include <string>
 #include "AnimationCache.h"
 #include "AnimNode.h"
+#include "CompressedAnimation.h"
 
 // Playback a single animation timeline.
 // url determines the location of the fbx file to use within this clip.
@@ -71,9 +72,12 @@ protected:
 
     AnimPoseVec _poses;
 
-    // _anim[frame][joint]
-    std::vector<AnimPoseVec> _anim;
-    std::vector<AnimPoseVec> _mirrorAnim;
+    CompressedAnimation _anim;
+    CompressedAnimation _mirrorAnim;
+
+    // the frames either side of _frame, decompressed to be blended
+    AnimPoseVec _prevPoses;
+    AnimPoseVec _nextPoses;
 
     QString _url;
     float _startFrame;
@@ -67,7 +67,35 @@ glm::vec3 AnimPose::xformVectorFast(const glm::vec3& rhs) const {
     return _rot * (_scale * rhs);
 }
 
+// glm::quat_cast() makes the largest component of the rotation positive, so do the same to get identical poses
+// whichever way they're composed
+static glm::quat withQuatCastSign(const glm::quat& q) {
+    float largest = q.w;
+    if (q.x * q.x > largest * largest) {
+        largest = q.x;
+    }
+    if (q.y * q.y > largest * largest) {
+        largest = q.y;
+    }
+    if (q.z * q.z > largest * largest) {
+        largest = q.z;
+    }
+    return largest < 0.0f ? -q : q;
+}
+
 AnimPose AnimPose::operator*(const AnimPose& rhs) const {
+    // Under a positive uniform scale the parts can be composed directly, which is much cheaper than going through a
+    // matrix and taking it apart again.  Skeletons are nearly always scaled this way.
+    if (_scale.x > 0.0f && _scale.x == _scale.y && _scale.x == _scale.z &&
+        rhs._scale.x > 0.0f && rhs._scale.y > 0.0f && rhs._scale.z > 0.0f) {
+        glm::quat rot = withQuatCastSign(_rot * rhs._rot);
+        float lengthSquared = glm::length2(rot);
+        if (glm::abs(lengthSquared - 1.0f) > EPSILON) {
+            rot *= 1.0f / sqrtf(lengthSquared);
+        }
+        return AnimPose(_scale.x * rhs._scale, rot, _trans + _rot * (_scale.x * rhs._trans));
+    }
+
     glm::mat4 result;
     glm_mat4u_mul(*this, rhs, result);
     return AnimPose(result);
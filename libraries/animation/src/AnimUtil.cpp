@@ -13,8 +13,116 @@
 #include <NumericalConstants.h>
 #include <DebugDraw.h>
 
-// TODO: use restrict keyword
-// TODO: excellent candidate for simd vectorization.
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+// The poses are blended one at a time, with the scale, rotation and translation of each in an SSE register. The
+// vec3s are loaded and stored without touching the float after them, which belongs to the next member or pose.
+static inline __m128 loadVec3(const glm::vec3& v) {
+    return _mm_movelh_ps(_mm_loadl_pi(_mm_setzero_ps(), (const __m64*)&v.x), _mm_load_ss(&v.z));
+}
+
+static inline void storeVec3(glm::vec3& v, __m128 value) {
+    _mm_storel_pi((__m64*)&v.x, value);
+    _mm_store_ss(&v.z, _mm_movehl_ps(value, value));
+}
+
+static inline __m128 loadQuat(const glm::quat& q) {
+    return _mm_loadu_ps(&q.x);
+}
+
+// the dot product in all four lanes
+static inline __m128 dot4(__m128 a, __m128 b) {
+    __m128 m = _mm_mul_ps(a, b);
+    m = _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 0, 3, 2)));
+}
+
+// b, negated if it's further than 90 degrees from a
+static inline __m128 alignQuat(__m128 a, __m128 b) {
+    return _mm_xor_ps(b, _mm_and_ps(dot4(a, b), _mm_set1_ps(-0.0f)));
+}
+
+// same as glm::normalize(), which gives the identity for a zero length quat
+static inline void storeNormalizedQuat(glm::quat& q, __m128 value) {
+    __m128 lengthSquared = dot4(value, value);
+    if (_mm_cvtss_f32(lengthSquared) > 0.0f) {
+        _mm_storeu_ps(&q.x, _mm_div_ps(value, _mm_sqrt_ps(lengthSquared)));
+    } else {
+        q = glm::quat();
+    }
+}
+
+void blend(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, AnimPose* result) {
+    const __m128 alphaA = _mm_set1_ps(1.0f - alpha);
+    const __m128 alphaB = _mm_set1_ps(alpha);
+    for (size_t i = 0; i < numPoses; i++) {
+        const AnimPose& aPose = a[i];
+        const AnimPose& bPose = b[i];
+
+        // everything is loaded before anything is stored, result may be a or b
+        __m128 scale = _mm_add_ps(_mm_mul_ps(loadVec3(aPose.scale()), alphaA), _mm_mul_ps(loadVec3(bPose.scale()), alphaB));
+        __m128 aRot = loadQuat(aPose.rot());
+        __m128 bRot = alignQuat(aRot, loadQuat(bPose.rot()));
+        __m128 rot = _mm_add_ps(_mm_mul_ps(aRot, alphaA), _mm_mul_ps(bRot, alphaB));
+        __m128 trans = _mm_add_ps(_mm_mul_ps(loadVec3(aPose.trans()), alphaA), _mm_mul_ps(loadVec3(bPose.trans()), alphaB));
+
+        storeVec3(result[i].scale(), scale);
+        storeNormalizedQuat(result[i].rot(), rot);
+        storeVec3(result[i].trans(), trans);
+    }
+}
+
+void blend3(size_t numPoses, const AnimPose* a, const AnimPose* b, const AnimPose* c, float* alphas, AnimPose* result) {
+    const __m128 alpha0 = _mm_set1_ps(alphas[0]);
+    const __m128 alpha1 = _mm_set1_ps(alphas[1]);
+    const __m128 alpha2 = _mm_set1_ps(alphas[2]);
+    for (size_t i = 0; i < numPoses; i++) {
+        const AnimPose& aPose = a[i];
+        const AnimPose& bPose = b[i];
+        const AnimPose& cPose = c[i];
+
+        __m128 scale = _mm_add_ps(_mm_add_ps(_mm_mul_ps(loadVec3(aPose.scale()), alpha0),
+            _mm_mul_ps(loadVec3(bPose.scale()), alpha1)), _mm_mul_ps(loadVec3(cPose.scale()), alpha2));
+        __m128 aRot = loadQuat(aPose.rot());
+        __m128 bRot = alignQuat(aRot, loadQuat(bPose.rot()));
+        __m128 cRot = alignQuat(aRot, loadQuat(cPose.rot()));
+        __m128 rot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(aRot, alpha0), _mm_mul_ps(bRot, alpha1)), _mm_mul_ps(cRot, alpha2));
+        __m128 trans = _mm_add_ps(_mm_add_ps(_mm_mul_ps(loadVec3(aPose.trans()), alpha0),
+            _mm_mul_ps(loadVec3(bPose.trans()), alpha1)), _mm_mul_ps(loadVec3(cPose.trans()), alpha2));
+
+        storeVec3(result[i].scale(), scale);
+        storeNormalizedQuat(result[i].rot(), rot);
+        storeVec3(result[i].trans(), trans);
+    }
+}
+
+void blend4(size_t numPoses, const AnimPose* a, const AnimPose* b, const AnimPose* c, const AnimPose* d, float* alphas, AnimPose* result) {
+    const __m128 alpha0 = _mm_set1_ps(alphas[0]);
+    const __m128 alpha1 = _mm_set1_ps(alphas[1]);
+    const __m128 alpha2 = _mm_set1_ps(alphas[2]);
+    const __m128 alpha3 = _mm_set1_ps(alphas[3]);
+    for (size_t i = 0; i < numPoses; i++) {
+        const AnimPose& aPose = a[i];
+        const AnimPose& bPose = b[i];
+        const AnimPose& cPose = c[i];
+        const AnimPose& dPose = d[i];
+
+        __m128 scale = _mm_add_ps(_mm_add_ps(_mm_mul_ps(loadVec3(aPose.scale()), alpha0), _mm_mul_ps(loadVec3(bPose.scale()), alpha1)),
+            _mm_add_ps(_mm_mul_ps(loadVec3(cPose.scale()), alpha2), _mm_mul_ps(loadVec3(dPose.scale()), alpha3)));
+        __m128 aRot = loadQuat(aPose.rot());
+        __m128 bRot = alignQuat(aRot, loadQuat(bPose.rot()));
+        __m128 cRot = alignQuat(aRot, loadQuat(cPose.rot()));
+        __m128 dRot = alignQuat(aRot, loadQuat(dPose.rot()));
+        __m128 rot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(aRot, alpha0), _mm_mul_ps(bRot, alpha1)),
+            _mm_add_ps(_mm_mul_ps(cRot, alpha2), _mm_mul_ps(dRot, alpha3)));
+        __m128 trans = _mm_add_ps(_mm_add_ps(_mm_mul_ps(loadVec3(aPose.trans()), alpha0), _mm_mul_ps(loadVec3(bPose.trans()), alpha1)),
+            _mm_add_ps(_mm_mul_ps(loadVec3(cPose.trans()), alpha2), _mm_mul_ps(loadVec3(dPose.trans()), alpha3)));
+
+        storeVec3(result[i].scale(), scale);
+        storeNormalizedQuat(result[i].rot(), rot);
+        storeVec3(result[i].trans(), trans);
+    }
+}
+#else
 void blend(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, AnimPose* result) {
     for (size_t i = 0; i < numPoses; i++) {
         const AnimPose& aPose = a[i];
@@ -50,6 +158,7 @@ void blend4(size_t numPoses, const AnimPose* a, const AnimPose* b, const AnimPos
         result[i].trans() = alphas[0] * aPose.trans() + alphas[1] * bPose.trans() + alphas[2] * cPose.trans() + alphas[3] * dPose.trans();
     }
 }
+#endif
 
 // additive blend
 void blendAdd(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, AnimPose* result) {
@@ -0,0 +1,213 @@
+//
+//  CompressedAnimation.cpp
+//  libraries/animation/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "CompressedAnimation.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include <GLMHelpers.h>
+#include <NumericalConstants.h>
+
+#include "AnimUtil.h"
+
+// how far the interpolated poses may be from the frames that were dropped
+static const float ROTATION_TOLERANCE = 0.2f * RADIANS_PER_DEGREE;
+static const float TRANSLATION_TOLERANCE_RATIO = 0.001f; // of the joint's largest translation
+
+// keys are kept at least this often, so that finding the frames to drop doesn't take too long
+static const int MAX_FRAMES_PER_KEY = 64;
+
+static const int MAX_KEY_FRAME = std::numeric_limits<uint16_t>::max();
+static const float TRANSLATION_RANGE = (float)std::numeric_limits<uint16_t>::max();
+
+// Finds the frames to keep as keys: the first, the last, and as few in between as it takes for every frame to be within
+// tolerance of the interpolation of the keys either side of it.  A track that doesn't change is left with just the first.
+template <typename T, typename Interpolate, typename IsClose>
+static std::vector<int> findKeyFrames(const std::vector<T>& values, Interpolate interpolate, IsClose isClose) {
+    const int numFrames = (int)values.size();
+    if (std::all_of(values.begin(), values.end(), [&](const T& value) { return isClose(value, values[0]); })) {
+        return { 0 };
+    }
+
+    std::vector<int> keys { 0 };
+    int key = 0;
+    while (key < numFrames - 1) {
+        int next = key + 1;
+        while (next + 1 < numFrames && next + 1 - key <= MAX_FRAMES_PER_KEY) {
+            int candidate = next + 1;
+            bool interpolates = true;
+            for (int i = key + 1; i < candidate && interpolates; i++) {
+                float alpha = (float)(i - key) / (float)(candidate - key);
+                interpolates = isClose(interpolate(values[key], values[candidate], alpha), values[i]);
+            }
+            if (!interpolates) {
+                break;
+            }
+            next = candidate;
+        }
+        keys.push_back(next);
+        key = next;
+    }
+    return keys;
+}
+
+// the frames are only needed when some were dropped
+static std::vector<uint16_t> toKeyFrames(const std::vector<int>& keys, int numFrames) {
+    std::vector<uint16_t> keyFrames;
+    if ((int)keys.size() != numFrames) {
+        keyFrames.reserve(keys.size());
+        for (int key : keys) {
+            keyFrames.push_back((uint16_t)key);
+        }
+    }
+    return keyFrames;
+}
+
+// returns how far frame is from the previous key to the next
+static float findKeys(const std::vector<uint16_t>& keyFrames, size_t numKeys, int frame, size_t& prevKey, size_t& nextKey) {
+    if (numKeys == 1) {
+        prevKey = nextKey = 0;
+        return 0.0f;
+    }
+    if (keyFrames.empty()) {
+        prevKey = nextKey = (size_t)frame;
+        return 0.0f;
+    }
+
+    auto it = std::upper_bound(keyFrames.begin(), keyFrames.end(), (uint16_t)frame);
+    nextKey = it - keyFrames.begin();
+    prevKey = nextKey - 1;
+    if (nextKey == keyFrames.size() || keyFrames[prevKey] == frame) {
+        nextKey = prevKey;
+        return 0.0f;
+    }
+    return (float)(frame - keyFrames[prevKey]) / (float)(keyFrames[nextKey] - keyFrames[prevKey]);
+}
+
+CompressedAnimation::CompressedAnimation(const std::vector<AnimPoseVec>& anim) :
+    _numFrames((int)anim.size())
+{
+    if (anim.empty()) {
+        return;
+    }
+
+    const int numJoints = (int)anim[0].size();
+    _joints.resize(numJoints);
+
+    // keyframes are stored as 16 bit frame numbers, longer animations are only quantized
+    const bool reduceKeys = _numFrames <= MAX_KEY_FRAME + 1;
+
+    std::vector<glm::quat> rotations(_numFrames);
+    std::vector<glm::vec3> translations(_numFrames);
+    for (int j = 0; j < numJoints; j++) {
+        Joint& joint = _joints[j];
+
+        for (int frame = 0; frame < _numFrames; frame++) {
+            rotations[frame] = anim[frame][j].rot();
+            translations[frame] = anim[frame][j].trans();
+        }
+
+        std::vector<int> rotationKeys;
+        if (reduceKeys) {
+            const float MIN_DOT = cosf(0.5f * ROTATION_TOLERANCE);
+            rotationKeys = findKeyFrames(rotations,
+                [](const glm::quat& a, const glm::quat& b, float alpha) { return safeLerp(a, b, alpha); },
+                [&](const glm::quat& a, const glm::quat& b) { return fabsf(glm::dot(a, b)) >= MIN_DOT; });
+        } else {
+            rotationKeys.resize(_numFrames);
+            std::iota(rotationKeys.begin(), rotationKeys.end(), 0);
+        }
+        joint.rotationFrames = toKeyFrames(rotationKeys, _numFrames);
+        joint.rotations.resize(rotationKeys.size());
+        for (size_t i = 0; i < rotationKeys.size(); i++) {
+            packOrientationQuatToSixBytes(joint.rotations[i].data(), rotations[rotationKeys[i]]);
+        }
+
+        glm::vec3 translationMax = translations[0];
+        joint.translationMin = translations[0];
+        float maxLength = 0.0f;
+        for (const auto& translation : translations) {
+            joint.translationMin = glm::min(joint.translationMin, translation);
+            translationMax = glm::max(translationMax, translation);
+            maxLength = std::max(maxLength, glm::length(translation));
+        }
+        joint.translationStep = (translationMax - joint.translationMin) / TRANSLATION_RANGE;
+
+        std::vector<int> translationKeys;
+        if (reduceKeys) {
+            const float tolerance = TRANSLATION_TOLERANCE_RATIO * maxLength;
+            translationKeys = findKeyFrames(translations,
+                [](const glm::vec3& a, const glm::vec3& b, float alpha) { return lerp(a, b, alpha); },
+                [&](const glm::vec3& a, const glm::vec3& b) { return glm::distance(a, b) <= tolerance; });
+        } else {
+            translationKeys.resize(_numFrames);
+            std::iota(translationKeys.begin(), translationKeys.end(), 0);
+        }
+        joint.translationFrames = toKeyFrames(translationKeys, _numFrames);
+        joint.translations.resize(translationKeys.size());
+        for (size_t i = 0; i < translationKeys.size(); i++) {
+            const glm::vec3& translation = translations[translationKeys[i]];
+            for (int c = 0; c < 3; c++) {
+                float step = joint.translationStep[c];
+                joint.translations[i][c] = step > 0.0f ?
+                    (uint16_t)glm::clamp(roundf((translation[c] - joint.translationMin[c]) / step), 0.0f, TRANSLATION_RANGE) : 0;
+            }
+        }
+
+        const glm::vec3& scale = anim[0][j].scale();
+        if (std::all_of(anim.begin(), anim.end(), [&](const AnimPoseVec& poses) { return poses[j].scale() == scale; })) {
+            joint.scales.push_back(scale);
+        } else {
+            joint.scales.reserve(_numFrames);
+            for (const auto& poses : anim) {
+                joint.scales.push_back(poses[j].scale());
+            }
+        }
+    }
+}
+
+void CompressedAnimation::getPoses(int frame, AnimPoseVec& posesOut) const {
+    posesOut.resize(_joints.size());
+    for (size_t j = 0; j < _joints.size(); j++) {
+        const Joint& joint = _joints[j];
+        AnimPose& pose = posesOut[j];
+
+        size_t prevKey, nextKey;
+        float alpha = findKeys(joint.rotationFrames, joint.rotations.size(), frame, prevKey, nextKey);
+        unpackOrientationQuatFromSixBytes(joint.rotations[prevKey].data(), pose.rot());
+        if (nextKey != prevKey) {
+            glm::quat nextRotation;
+            unpackOrientationQuatFromSixBytes(joint.rotations[nextKey].data(), nextRotation);
+            pose.rot() = safeLerp(pose.rot(), nextRotation, alpha);
+        }
+
+        alpha = findKeys(joint.translationFrames, joint.translations.size(), frame, prevKey, nextKey);
+        const PackedTranslation& prevTranslation = joint.translations[prevKey];
+        const PackedTranslation& nextTranslation = joint.translations[nextKey];
+        for (int c = 0; c < 3; c++) {
+            float packed = lerp((float)prevTranslation[c], (float)nextTranslation[c], alpha);
+            pose.trans()[c] = joint.translationMin[c] + packed * joint.translationStep[c];
+        }
+
+        pose.scale() = joint.scales.size() == 1 ? joint.scales[0] : joint.scales[frame];
+    }
+}
+
+size_t CompressedAnimation::getMemorySize() const {
+    size_t size = sizeof(CompressedAnimation) + _joints.size() * sizeof(Joint);
+    for (const auto& joint : _joints) {
+        size += joint.rotationFrames.size() * sizeof(uint16_t) + joint.rotations.size() * sizeof(PackedRotation);
+        size += joint.translationFrames.size() * sizeof(uint16_t) + joint.translations.size() * sizeof(PackedTranslation);
+        size += joint.scales.size() * sizeof(glm::vec3);
+    }
+    return size;
+}
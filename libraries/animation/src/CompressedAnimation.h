@@ -0,0 +1,62 @@
+//
+//  CompressedAnimation.h
+//  libraries/animation/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_CompressedAnimation_h
+#define vircadia_CompressedAnimation_h
+
+#include <array>
+#include <vector>
+
+#include "AnimPose.h"
+
+// The relative poses of every joint of an animation at every frame, in a fraction of the memory they'd take as AnimPoses.
+//
+// Each joint's rotations and translations are reduced to the keyframes that can't be interpolated from the keyframes
+// around them, and quantized: rotations to six bytes and translations to 16 bits per component of their range. Joints
+// that don't move, which are most of them in most animations, are left with a single key.
+class CompressedAnimation {
+public:
+    CompressedAnimation() {}
+
+    // anim[frame][joint], every frame has to have the same number of joints
+    explicit CompressedAnimation(const std::vector<AnimPoseVec>& anim);
+
+    int getNumFrames() const { return _numFrames; }
+    int getNumJoints() const { return (int)_joints.size(); }
+
+    // frame has to be in [0, getNumFrames())
+    void getPoses(int frame, AnimPoseVec& posesOut) const;
+
+    size_t getMemorySize() const;
+
+private:
+    using PackedRotation = std::array<unsigned char, 6>;
+    using PackedTranslation = std::array<uint16_t, 3>;
+
+    class Joint {
+    public:
+        // the frames of the keys, empty when every frame is one
+        std::vector<uint16_t> rotationFrames;
+        std::vector<PackedRotation> rotations;
+
+        std::vector<uint16_t> translationFrames;
+        std::vector<PackedTranslation> translations;
+        glm::vec3 translationMin;
+        glm::vec3 translationStep;
+
+        // a single scale unless it changes, which it doesn't in retargeted animations
+        std::vector<glm::vec3> scales;
+    };
+
+    int _numFrames { 0 };
+    std::vector<Joint> _joints;
+};
+
+#endif // vircadia_CompressedAnimation_h
@@ -84,7 +84,7 @@ void FlowCollisionSystem::resetCollisions() {
     _selfCollisions.clear();
 }
 
-FlowCollisionResult FlowCollisionSystem::computeCollision(const std::vector<FlowCollisionResult> collisions) {
+FlowCollisionResult FlowCollisionSystem::computeCollision(const std::vector<FlowCollisionResult>& collisions) {
     FlowCollisionResult result;
     if (collisions.size() > 1) {
         for (size_t i = 0; i < collisions.size(); i++) {
@@ -118,21 +118,27 @@ void FlowCollisionSystem::setScale(float scale) {
     }
 };
 
-std::vector<FlowCollisionResult> FlowCollisionSystem::checkFlowThreadCollisions(FlowThread* flowThread) {
-    std::vector<std::vector<FlowCollisionResult>> FlowThreadResults;
-    FlowThreadResults.resize(flowThread->_joints.size());
+void FlowCollisionSystem::checkFlowThreadCollisions(FlowThread* flowThread, std::vector<FlowCollisionResult>& results) {
+    std::vector<std::vector<FlowCollisionResult>>& FlowThreadResults = _jointCollisions;
+    if (FlowThreadResults.size() < flowThread->_joints.size()) {
+        FlowThreadResults.resize(flowThread->_joints.size());
+    }
+    for (size_t i = 0; i < flowThread->_joints.size(); i++) {
+        FlowThreadResults[i].clear();
+    }
     for (size_t j = 0; j < _allCollisions.size(); j++) {
         FlowCollisionSphere &sphere = _allCollisions[j];
         FlowCollisionResult rootCollision = sphere.computeSphereCollision(flowThread->_positions[0], flowThread->_radius);
-        std::vector<FlowCollisionResult> collisionData = { rootCollision };
         bool tooFar = rootCollision._distance >(flowThread->_length + rootCollision._radius);
         FlowCollisionResult nextCollision;
         if (!tooFar) {
             if (sphere._isTouch) {
+                FlowCollisionResult prevCollision = rootCollision;
                 for (size_t i = 1; i < flowThread->_joints.size(); i++) {
-                    auto prevCollision = collisionData[i - 1];
+                    if (i > 1) {
+                        prevCollision = nextCollision;
+                    }
                     nextCollision = _allCollisions[j].computeSphereCollision(flowThread->_positions[i], flowThread->_radius);
-                    collisionData.push_back(nextCollision);
                     if (prevCollision._offset > 0.0f) {
                         if (i == 1) {
                             FlowThreadResults[i - 1].push_back(prevCollision);
@@ -161,11 +167,10 @@ std::vector<FlowCollisionResult> FlowCollisionSystem::checkFlowThreadCollisions(
         }
     }
 
-    std::vector<FlowCollisionResult> results;
+    results.clear();
     for (size_t i = 0; i < flowThread->_joints.size(); i++) {
         results.push_back(computeCollision(FlowThreadResults[i]));
     }
-    return results;
 };
 
 FlowCollisionSettings FlowCollisionSystem::getCollisionSettingsByJoint(int jointIndex) {
@@ -359,13 +364,12 @@ void FlowThread::computeFlowThread(int rootIndex) {
 };
 
 void FlowThread::computeRecovery() {
-    int parentIndex = _joints[0];
-    auto parentJoint = _jointsPointer->at(parentIndex);
-    _jointsPointer->at(parentIndex)._recoveryPosition = parentJoint._recoveryPosition = parentJoint._currentPosition;
-    glm::quat parentRotation = parentJoint._parentWorldRotation * parentJoint._initialRotation;
+    FlowJoint* parentJoint = &_jointsPointer->at(_joints[0]);
+    parentJoint->_recoveryPosition = parentJoint->_currentPosition;
+    glm::quat parentRotation = parentJoint->_parentWorldRotation * parentJoint->_initialRotation;
     for (size_t i = 1; i < _joints.size(); i++) {
-        auto joint = _jointsPointer->at(_joints[i]);
-        _jointsPointer->at(_joints[i])._recoveryPosition = joint._recoveryPosition = parentJoint._recoveryPosition + (parentRotation * (joint._initialTranslation * 0.01f));
+        FlowJoint* joint = &_jointsPointer->at(_joints[i]);
+        joint->_recoveryPosition = parentJoint->_recoveryPosition + (parentRotation * (joint->_initialTranslation * 0.01f));
         parentJoint = joint;
     }
 };
@@ -384,10 +388,10 @@ void FlowThread::update(float deltaTime) {
 
 void FlowThread::solve(FlowCollisionSystem& collisionSystem) {
     if (collisionSystem.getActive()) {
-        auto bodyCollisions = collisionSystem.checkFlowThreadCollisions(this);
+        collisionSystem.checkFlowThreadCollisions(this, _collisionResults);
         for (size_t i = 0; i < _joints.size(); i++) {
             int index = _joints[i];
-            _jointsPointer->at(index).solve(bodyCollisions[i]);
+            _jointsPointer->at(index).solve(_collisionResults[i]);
         }
     } else {
         for (size_t i = 0; i < _joints.size(); i++) {
@@ -402,33 +406,35 @@ void FlowThread::computeJointRotations() {
     auto pos0 = _rootFramePositions[0];
     auto pos1 = _rootFramePositions[1];
 
-    auto joint0 = _jointsPointer->at(_joints[0]);
-    auto joint1 = _jointsPointer->at(_joints[1]);
+    FlowJoint* joint0 = &_jointsPointer->at(_joints[0]);
+    FlowJoint* joint1 = &_jointsPointer->at(_joints[1]);
 
-    auto initial_pos1 = pos0 + (joint0._initialRotation * (joint1._initialTranslation * 0.01f));
+    auto initial_pos1 = pos0 + (joint0->_initialRotation * (joint1->_initialTranslation * 0.01f));
 
     auto vec0 = initial_pos1 - pos0;
     auto vec1 = pos1 - pos0;
 
     auto delta = rotationBetween(vec0, vec1);
 
-    joint0._currentRotation = _jointsPointer->at(_joints[0])._currentRotation = delta * joint0._initialRotation;
+    joint0->_currentRotation = delta * joint0->_initialRotation;
     
     for (size_t i = 1; i < _joints.size() - 1; i++) {
-        auto nextJoint = _jointsPointer->at(_joints[i + 1]);
+        FlowJoint* nextJoint = &_jointsPointer->at(_joints[i + 1]);
+        glm::quat inverseRotation = glm::inverse(joint0->_currentRotation);
+        glm::vec3 translation = joint0->_initialTranslation * 0.01f;
         for (size_t j = i; j < _joints.size(); j++) {
-            _rootFramePositions[j] = glm::inverse(joint0._currentRotation) * _rootFramePositions[j] - (joint0._initialTranslation * 0.01f);
+            _rootFramePositions[j] = inverseRotation * _rootFramePositions[j] - translation;
         }
         pos0 = _rootFramePositions[i];
         pos1 = _rootFramePositions[i + 1];
-        initial_pos1 = pos0 + joint1._initialRotation * (nextJoint._initialTranslation * 0.01f);
+        initial_pos1 = pos0 + joint1->_initialRotation * (nextJoint->_initialTranslation * 0.01f);
 
         vec0 = initial_pos1 - pos0;
         vec1 = pos1 - pos0;
 
         delta = rotationBetween(vec0, vec1);
 
-        joint1._currentRotation = _jointsPointer->at(joint1._index)._currentRotation = delta * joint1._initialRotation;
+        joint1->_currentRotation = delta * joint1->_initialRotation;
         joint0 = joint1;
         joint1 = nextJoint;
     }
@@ -135,9 +135,10 @@ class FlowCollisionSystem {
 public:
     FlowCollisionSystem() {};
     void addCollisionSphere(int jointIndex, const FlowCollisionSettings& settings, const glm::vec3& position = { 0.0f, 0.0f, 0.0f }, bool isSelfCollision = true, bool isTouch = false);
-    FlowCollisionResult computeCollision(const std::vector<FlowCollisionResult> collisions);
+    FlowCollisionResult computeCollision(const std::vector<FlowCollisionResult>& collisions);
 
-    std::vector<FlowCollisionResult> checkFlowThreadCollisions(FlowThread* flowThread);
+    // fills results with the combined collision of each joint of flowThread
+    void checkFlowThreadCollisions(FlowThread* flowThread, std::vector<FlowCollisionResult>& results);
 
     std::vector<FlowCollisionSphere>& getSelfCollisions() { return _selfCollisions; };
     std::vector<FlowCollisionSphere>& getSelfTouchCollisions() { return _selfTouchCollisions; };
@@ -157,6 +158,8 @@ protected:
     std::vector<FlowCollisionSphere> _othersCollisions;
     std::vector<FlowCollisionSphere> _selfTouchCollisions;
     std::vector<FlowCollisionSphere> _allCollisions;
+    // the collisions found for each joint of the thread being checked, kept to save allocating them on every frame
+    std::vector<std::vector<FlowCollisionResult>> _jointCollisions;
     float _scale { 1.0f };
     bool _active { false };
 };
@@ -280,6 +283,7 @@ public:
     float _length{ 0.0f };
     std::map<int, FlowJoint>* _jointsPointer;
     std::vector<glm::vec3> _rootFramePositions;
+    std::vector<FlowCollisionResult> _collisionResults;
 };
 
 class Flow : public QObject{
@@ -12,6 +12,7 @@
 
 #include "AudioClient.h"
 
+#include <algorithm>
 #include <cstring>
 #include <math.h>
 #include <sys/stat.h>
@@ -62,6 +63,12 @@ const int AudioClient::MIN_BUFFER_FRAMES = 1;
 
 const int AudioClient::MAX_BUFFER_FRAMES = 20;
 
+// the output device buffer holds this many times the output buffer frames, and the input device callbacks are this many
+// times smaller, in the low latency mode
+static const int OUTPUT_BUFFER_SIZE_MULTIPLIER = 16;
+static const int LOW_LATENCY_OUTPUT_BUFFER_SIZE_MULTIPLIER = 4;
+static const int LOW_LATENCY_INPUT_CALLBACK_DIVISOR = 2;
+
 #if defined(Q_OS_ANDROID)
 static const int CHECK_INPUT_READS_MSECS = 2000;
 static const int MIN_READS_TO_CONSIDER_INPUT_ALIVE = 10;
@@ -328,6 +335,8 @@ AudioClient::AudioClient() {
 
     connect(&_receivedAudioStream, &MixedProcessedAudioStream::processSamples,
 	    this, &AudioClient::processReceivedSamples, Qt::DirectConnection);
+    connect(&_receivedAudioStream, &MixedProcessedAudioStream::processOffloadedSources,
+        this, &AudioClient::processOffloadedSources, Qt::DirectConnection);
     connect(this, &AudioClient::changeDevice, this, [=](const HifiAudioDeviceInfo& outputDeviceInfo) {
         qCDebug(audioclient)<< "got AudioClient::changeDevice signal, about to call switchOutputToAudioDevice() outputDeviceInfo: ["<< outputDeviceInfo.deviceName() << "]";
         switchOutputToAudioDevice(outputDeviceInfo);
@@ -378,6 +387,10 @@ AudioClient::AudioClient() {
         PacketReceiver::makeUnsourcedListenerReference<AudioClient>(this, &AudioClient::handleAudioDataPacket));
     packetReceiver.registerListener(PacketType::MixedAudio,
         PacketReceiver::makeUnsourcedListenerReference<AudioClient>(this, &AudioClient::handleAudioDataPacket));
+    packetReceiver.registerListener(PacketType::MixedAudioWithSources,
+        PacketReceiver::makeUnsourcedListenerReference<AudioClient>(this, &AudioClient::handleAudioDataPacket));
+    packetReceiver.registerListener(PacketType::AudioForwardErrorCorrection,
+        PacketReceiver::makeUnsourcedListenerReference<AudioClient>(this, &AudioClient::handleAudioDataPacket));
     packetReceiver.registerListener(PacketType::NoisyMute,
         PacketReceiver::makeUnsourcedListenerReference<AudioClient>(this, &AudioClient::handleNoisyMutePacket));
     packetReceiver.registerListener(PacketType::MuteEnvironment,
@@ -400,6 +413,7 @@ AudioClient::~AudioClient() {
 
     stop();
 
+    releaseOffloadedSources();
     if (_codec && _encoder) {
         _codec->releaseEncoder(_encoder);
         _encoder = nullptr;
@@ -861,7 +875,7 @@ void AudioClient::handleAudioEnvironmentDataPacket(QSharedPointer<ReceivedMessag
 void AudioClient::handleAudioDataPacket(QSharedPointer<ReceivedMessage> message) {
     if (message->getType() == PacketType::SilentAudioFrame) {
         _silentInbound.increment();
-    } else {
+    } else if (message->getType() != PacketType::AudioForwardErrorCorrection) {
         _audioInbound.increment();
     }
 
@@ -971,6 +985,13 @@ void AudioClient::negotiateAudioFormat() {
         negotiateFormatPacket->writeString(codecName);
     }
 
+    // the FEC group size we'd like, mixers that don't support FEC ignore it
+    negotiateFormatPacket->writePrimitive((quint8)std::max(0, std::min(_fecGroupSize.get(), AudioFEC::MAX_GROUP_SIZE)));
+
+    // then the number of sources we'd like to spatialize ourselves
+    negotiateFormatPacket->writePrimitive((quint8)std::max(0, std::min(_offloadedSourceCount.get(),
+                                                                      AudioConstants::MAX_OFFLOADED_SOURCES)));
+
     // grab our audio mixer from the NodeList, if it exists
     SharedNodePointer audioMixer = nodeList->soloNodeOfType(NodeType::AudioMixer);
 
@@ -983,6 +1004,21 @@ void AudioClient::negotiateAudioFormat() {
 void AudioClient::handleSelectedAudioFormat(QSharedPointer<ReceivedMessage> message) {
     QString selectedCodecName = message->readString();
     selectAudioFormat(selectedCodecName);
+
+    // mixers that don't support FEC don't send a group size
+    quint8 fecGroupSize = 0;
+    if (message->getBytesLeftToRead() >= (qint64)sizeof(fecGroupSize)) {
+        message->readPrimitive(&fecGroupSize);
+    }
+    _fecEncoder.setGroupSize(fecGroupSize);
+    _receivedAudioStream.setupFEC(fecGroupSize);
+
+    // nor the number of sources they leave for us to spatialize
+    quint8 offloadedSourceCount = 0;
+    if (message->getBytesLeftToRead() >= (qint64)sizeof(offloadedSourceCount)) {
+        message->readPrimitive(&offloadedSourceCount);
+    }
+    qCDebug(audioclient) << "Offloaded sources:" << offloadedSourceCount;
 }
 
 void AudioClient::selectAudioFormat(const QString& selectedCodecName) {
@@ -992,6 +1028,7 @@ void AudioClient::selectAudioFormat(const QString& selectedCodecName) {
     qCDebug(audioclient) << "Selected codec:" << _selectedCodecName << "; Is stereo input:" << _isStereoInput;
 
     // release any old codec encoder/decoder first...
+    releaseOffloadedSources();
     if (_codec && _encoder) {
         _codec->releaseEncoder(_encoder);
         _encoder = nullptr;
@@ -1414,7 +1451,7 @@ void AudioClient::handleAudioInput(QByteArray& audioBuffer) {
 
         emitAudioPacket(encodedBuffer.data(), encodedBuffer.size(), _outgoingAvatarAudioSequenceNumber, _isStereoInput,
                         audioTransform, avatarBoundingBoxCorner, avatarBoundingBoxScale,
-                        packetType, _selectedCodecName);
+                        packetType, _selectedCodecName, &_fecEncoder);
         _stats.sentPacket();
     }
 }
@@ -1589,36 +1626,62 @@ bool AudioClient::mixLocalAudioInjectors(float* mixBuffer) {
 
     memset(mixBuffer, 0, AudioConstants::NETWORK_FRAME_SAMPLES_STEREO * sizeof(float));
 
+    glm::vec3 listenerPosition = _positionGetter();
+    _localInjectorMixes.clear();
     for (const AudioInjectorPointer& injector : _activeLocalAudioInjectors) {
+        LocalInjectorMix mix { injector, injector->getOptions(), glm::vec3(), 0.0f, 0.0f };
+
+        bool isSystemSound = !mix.options.positionSet && !mix.options.ambisonic;
+        mix.gain = mix.options.volume * (isSystemSound ? _systemInjectorGain : _localInjectorGain);
+
+        if (mix.options.positionSet) {
+            // distance attenuation
+            mix.relativePosition = mix.options.position - listenerPosition;
+            mix.distance = glm::max(glm::length(mix.relativePosition), EPSILON);
+            mix.gain = gainForSource(mix.distance, mix.gain);
+        }
+        _localInjectorMixes.push_back(std::move(mix));
+    }
+
+    // only the loudest injectors are mixed, the order they are mixed in doesn't matter
+    static const size_t MAX_MIXED_LOCAL_INJECTORS = 16;
+    size_t numMixed = std::min(_localInjectorMixes.size(), MAX_MIXED_LOCAL_INJECTORS);
+    if (numMixed < _localInjectorMixes.size()) {
+        std::nth_element(_localInjectorMixes.begin(), _localInjectorMixes.begin() + numMixed, _localInjectorMixes.end(),
+                         [](const LocalInjectorMix& a, const LocalInjectorMix& b) { return a.gain > b.gain; });
+    }
+
+    for (size_t i = 0; i < _localInjectorMixes.size(); ++i) {
+        const auto& injector = _localInjectorMixes[i].injector;
+        const auto& options = _localInjectorMixes[i].options;
+        float gain = _localInjectorMixes[i].gain;
+
         // the lock guarantees that injectorBuffer, if found, is invariant
         auto injectorBuffer = injector->getLocalBuffer();
         if (injectorBuffer) {
 
-            auto options = injector->getOptions();
-
             static const int HRTF_DATASET_INDEX = 1;
 
             int numChannels = options.ambisonic ? AudioConstants::AMBISONIC : (options.stereo ? AudioConstants::STEREO : AudioConstants::MONO);
             size_t bytesToRead = numChannels * AudioConstants::NETWORK_FRAME_BYTES_PER_CHANNEL;
 
+            if (i >= numMixed) {
+                // too quiet to be mixed this frame, the HRTF starts afresh if it is mixed again
+                if (0 < injectorBuffer->skip(bytesToRead)) {
+                    injector->getLocalHRTF().reset();
+                } else {
+                    injector->finishLocalInjection();
+                    injectorsToRemove.append(injector);
+                }
+                continue;
+            }
+
             // get one frame from the injector
             memset(_localScratchBuffer, 0, bytesToRead);
             if (0 < injectorBuffer->readData((char*)_localScratchBuffer, bytesToRead)) {
 
-                bool isSystemSound = !options.positionSet && !options.ambisonic;
-
-                float gain = options.volume * (isSystemSound ? _systemInjectorGain : _localInjectorGain);
-
                 if (options.ambisonic) {
 
-                    if (options.positionSet) {
-
-                        // distance attenuation
-                        glm::vec3 relativePosition = options.position - _positionGetter();
-                        float distance = glm::max(glm::length(relativePosition), EPSILON);
-                        gain = gainForSource(distance, gain);
-                    }
-
                     //
                     // Calculate the soundfield orientation relative to the listener.
                     // Injector orientation can be used to align a recording to our world coordinates.
@@ -1636,14 +1699,6 @@ bool AudioClient::mixLocalAudioInjectors(float* mixBuffer) {
                                                    qw, qx, qy, qz, gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
                 } else if (options.stereo) {
 
-                    if (options.positionSet) {
-
-                        // distance attenuation
-                        glm::vec3 relativePosition = options.position - _positionGetter();
-                        float distance = glm::max(glm::length(relativePosition), EPSILON);
-                        gain = gainForSource(distance, gain);
-                    }
-
                     // direct mix into mixBuffer
                     injector->getLocalHRTF().mixStereo(_localScratchBuffer, mixBuffer, gain,
                                                        AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
@@ -1651,16 +1706,12 @@ bool AudioClient::mixLocalAudioInjectors(float* mixBuffer) {
 
                     if (options.positionSet) {
 
-                        // distance attenuation
-                        glm::vec3 relativePosition = options.position - _positionGetter();
-                        float distance = glm::max(glm::length(relativePosition), EPSILON);
-                        gain = gainForSource(distance, gain);
-
-                        float azimuth = azimuthForSource(relativePosition);
+                        float azimuth = azimuthForSource(_localInjectorMixes[i].relativePosition);
 
                         // spatialize into mixBuffer
                         injector->getLocalHRTF().render(_localScratchBuffer, mixBuffer, HRTF_DATASET_INDEX,
-                                                        azimuth, distance, gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+                                                        azimuth, _localInjectorMixes[i].distance, gain,
+                                                        AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
                     } else {
 
                         // direct mix into mixBuffer
@@ -1683,6 +1734,7 @@ bool AudioClient::mixLocalAudioInjectors(float* mixBuffer) {
             injectorsToRemove.append(injector);
         }
     }
+    _localInjectorMixes.clear();
 
     for (const AudioInjectorPointer& injector : injectorsToRemove) {
         //qCDebug(audioclient) << "removing injector";
@@ -1724,6 +1776,95 @@ void AudioClient::processReceivedSamples(const QByteArray& decodedBuffer, QByteA
     }
 }
 
+void AudioClient::processOffloadedSources(const QByteArray& offloadedSources, QByteArray& decodedBuffer) {
+    static const int HRTF_DATASET_INDEX = 1;
+    const int SOURCE_HEADER_SIZE = sizeof(quint8) + sizeof(glm::vec3) + sizeof(float) + sizeof(quint16);
+
+    if (decodedBuffer.size() != AudioConstants::NETWORK_FRAME_BYTES_STEREO || offloadedSources.isEmpty()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_offloadedSourcesMutex);
+
+    int16_t* mixSamples = reinterpret_cast<int16_t*>(decodedBuffer.data());
+    for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_STEREO; i++) {
+        _offloadedMixBuffer[i] = mixSamples[i] * (1 / 32768.0f);
+    }
+
+    const char* data = offloadedSources.constData();
+    const char* end = data + offloadedSources.size();
+
+    quint8 numSources = (quint8)*data++;
+    for (int i = 0; i < numSources && end - data >= SOURCE_HEADER_SIZE; i++) {
+        quint8 slot;
+        glm::vec3 relativePosition;
+        float gain;
+        quint16 frameSize;
+        memcpy(&slot, data, sizeof(slot));
+        data += sizeof(slot);
+        memcpy(&relativePosition, data, sizeof(relativePosition));
+        data += sizeof(relativePosition);
+        memcpy(&gain, data, sizeof(gain));
+        data += sizeof(gain);
+        memcpy(&frameSize, data, sizeof(frameSize));
+        data += sizeof(frameSize);
+
+        if (end - data < frameSize) {
+            break;
+        }
+        QByteArray encodedFrame = QByteArray::fromRawData(data, frameSize);
+        data += frameSize;
+
+        int index = slot & ~AudioConstants::OFFLOADED_SOURCE_RESET;
+        if (index >= AudioConstants::MAX_OFFLOADED_SOURCES) {
+            continue;
+        }
+        auto& source = _offloadedSources[index];
+
+        // a different source, or one we missed frames of
+        if (slot & AudioConstants::OFFLOADED_SOURCE_RESET) {
+            if (_codec && source.decoder) {
+                _codec->releaseDecoder(source.decoder);
+            }
+            source.decoder = nullptr;
+            source.hrtf.reset();
+        }
+        if (!source.decoder && _codec) {
+            source.decoder = _codec->createDecoder(AudioConstants::SAMPLE_RATE, AudioConstants::MONO);
+        }
+
+        QByteArray decodedFrame;
+        if (source.decoder) {
+            source.decoder->decode(encodedFrame, decodedFrame);
+        } else {
+            decodedFrame = encodedFrame;
+        }
+        if (decodedFrame.size() != AudioConstants::NETWORK_FRAME_BYTES_PER_CHANNEL) {
+            continue;
+        }
+
+        // the mixer has already applied the distance attenuation, the direction is turned by our latest orientation
+        float distance = glm::max(glm::length(relativePosition), EPSILON);
+        float azimuth = azimuthForSource(relativePosition);
+        source.hrtf.render(reinterpret_cast<const int16_t*>(decodedFrame.constData()), _offloadedMixBuffer,
+                           HRTF_DATASET_INDEX, azimuth, distance, gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+    }
+
+    _offloadedSourcesLimiter.render(_offloadedMixBuffer, mixSamples, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+}
+
+void AudioClient::releaseOffloadedSources() {
+    std::lock_guard<std::mutex> lock(_offloadedSourcesMutex);
+
+    for (auto& source : _offloadedSources) {
+        if (_codec && source.decoder) {
+            _codec->releaseDecoder(source.decoder);
+        }
+        source.decoder = nullptr;
+        source.hrtf.reset();
+    }
+}
+
 void AudioClient::sendMuteEnvironmentPacket() {
     auto nodeList = DependencyManager::get<NodeList>();
 
@@ -1955,14 +2096,21 @@ bool AudioClient::switchInputToAudioDevice(const HifiAudioDeviceInfo inputDevice
             if (!_isStereoInput || _inputFormat.channelCount() == 2) {
                 _audioInput = new QAudioInput(_inputDeviceInfo.getDevice(), _inputFormat, this);
                 _numInputCallbackBytes = calculateNumberOfInputCallbackBytes(_inputFormat);
-                _audioInput->setBufferSize(_numInputCallbackBytes);
-                // different audio input devices may have different volumes
-                emit inputVolumeChanged(_audioInput->volume());
 
                 // how do we want to handle input working, but output not working?
                 int numFrameSamples = calculateNumberOfFrameSamples(_numInputCallbackBytes);
                 _inputRingBuffer.resizeForFrameSize(numFrameSamples);
 
+                if (_lowLatencyEnabled.get()) {
+                    // the ring buffer still takes whole network frames, that are sent as soon as they are
+                    int bytesPerFrame = _inputFormat.channelCount() * AudioConstants::SAMPLE_SIZE;
+                    _numInputCallbackBytes = std::max(bytesPerFrame,
+                        (_numInputCallbackBytes / (LOW_LATENCY_INPUT_CALLBACK_DIVISOR * bytesPerFrame)) * bytesPerFrame);
+                }
+                _audioInput->setBufferSize(_numInputCallbackBytes);
+                // different audio input devices may have different volumes
+                emit inputVolumeChanged(_audioInput->volume());
+
 #if defined(Q_OS_ANDROID)
                 if (_audioInput) {
                     _shouldRestartInputSetup = true;
@@ -2202,7 +2350,8 @@ bool AudioClient::switchOutputToAudioDevice(const HifiAudioDeviceInfo outputDevi
             int deviceChannelCount = _outputFormat.channelCount();
             int frameSize = (AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL * deviceChannelCount * _outputFormat.sampleRate()) / _desiredOutputFormat.sampleRate();
             int requestedSize = _sessionOutputBufferSizeFrames * frameSize * AudioConstants::SAMPLE_SIZE;
-            _audioOutput->setBufferSize(requestedSize * 16);
+            _audioOutput->setBufferSize(requestedSize * (_lowLatencyEnabled.get() ? LOW_LATENCY_OUTPUT_BUFFER_SIZE_MULTIPLIER :
+                                                                                 OUTPUT_BUFFER_SIZE_MULTIPLIER));
 
             connect(_audioOutput, &QAudioOutput::notify, this, &AudioClient::outputNotify);
 
@@ -2260,6 +2409,19 @@ bool AudioClient::switchOutputToAudioDevice(const HifiAudioDeviceInfo outputDevi
     return supportedFormat;
 }
 
+void AudioClient::setLowLatencyEnabled(bool enabled) {
+    if (_lowLatencyEnabled.get() == enabled) {
+        return;
+    }
+    _lowLatencyEnabled.set(enabled);
+
+    // set the devices up again, with their new buffer sizes
+    QMetaObject::invokeMethod(this, [this] {
+        switchInputToAudioDevice(_inputDeviceInfo);
+        switchOutputToAudioDevice(_outputDeviceInfo);
+    });
+}
+
 int AudioClient::setOutputBufferSize(int numFrames, bool persist) {
     qCDebug(audioclient) << __FUNCTION__ << "numFrames:" << numFrames << "persist:" << persist;
 
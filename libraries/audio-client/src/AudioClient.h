@@ -13,6 +13,7 @@
 #ifndef hifi_AudioClient_h
 #define hifi_AudioClient_h
 
+#include <array>
 #include <fstream>
 #include <memory>
 #include <vector>
@@ -31,6 +32,7 @@
 #include <QtMultimedia/QAudioInput>
 #include <AbstractAudioInterface.h>
 #include <AudioEffectOptions.h>
+#include <AudioFEC.h>
 #include <AudioStreamStats.h>
 #include <shared/WebRTC.h>
 
@@ -153,6 +155,10 @@ public:
     bool getOutputStarveDetectionEnabled() { return _outputStarveDetectionEnabled.get(); }
     void setOutputStarveDetectionEnabled(bool enabled) { _outputStarveDetectionEnabled.set(enabled); }
 
+    // keeps less audio in the device buffers, at the risk of more starves, once the devices are set up again
+    bool getLowLatencyEnabled() { return _lowLatencyEnabled.get(); }
+    void setLowLatencyEnabled(bool enabled);
+
     bool isSimulatingJitter() { return _gate.isSimulatingJitter(); }
     void setIsSimulatingJitter(bool enable) { _gate.setIsSimulatingJitter(enable); }
 
@@ -247,6 +253,7 @@ public slots:
     virtual void toggleServerEcho() override { _shouldEchoToServer = !_shouldEchoToServer; }
 
     void processReceivedSamples(const QByteArray& inputBuffer, QByteArray& outputBuffer);
+    void processOffloadedSources(const QByteArray& offloadedSources, QByteArray& decodedBuffer);
     void sendMuteEnvironmentPacket();
 
     int setOutputBufferSize(int numFrames, bool persist = true);
@@ -402,6 +409,11 @@ private:
     Setting::Handle<int> _outputBufferSizeFrames{"audioOutputBufferFrames", DEFAULT_BUFFER_FRAMES};
     int _sessionOutputBufferSizeFrames{ _outputBufferSizeFrames.get() };
     Setting::Handle<bool> _outputStarveDetectionEnabled{ "audioOutputStarveDetectionEnabled", DEFAULT_STARVE_DETECTION_ENABLED};
+    Setting::Handle<bool> _lowLatencyEnabled{ "audioLowLatencyEnabled", false };
+    // asked of the mixer in the codec negotiation, 0 for no FEC
+    Setting::Handle<int> _fecGroupSize{ "audioFECGroupSize", 0 };
+    // asked of the mixer in the codec negotiation, 0 to have it mix every source
+    Setting::Handle<int> _offloadedSourceCount{ "audioOffloadedSources", 0 };
 
     StDev _stdev;
     QElapsedTimer _timeSinceLastReceived;
@@ -510,12 +522,36 @@ private:
 
     QVector<AudioInjectorPointer> _activeLocalAudioInjectors;
 
+    // The injectors of a frame ranked by how loud they will be heard. Only the loudest are mixed, the others are skipped
+    // through so that they are in the right place if they become loud enough to be mixed again.
+    struct LocalInjectorMix {
+        AudioInjectorPointer injector;
+        AudioInjectorOptions options;
+        glm::vec3 relativePosition;
+        float distance;
+        float gain;
+    };
+    std::vector<LocalInjectorMix> _localInjectorMixes;
+
     bool _isPlayingBackRecording { false };
     bool _audioPaused { false };
 
     CodecPluginPointer _codec;
     QString _selectedCodecName;
     Encoder* _encoder { nullptr };  // for outbound mic stream
+    AudioFECEncoder _fecEncoder;    // for outbound mic stream
+
+    // the loudest sources, which the mixer leaves for us to spatialize with our latest orientation
+    // (used by network audio thread)
+    struct OffloadedSource {
+        AudioHRTF hrtf;
+        Decoder* decoder { nullptr };
+    };
+    std::array<OffloadedSource, AudioConstants::MAX_OFFLOADED_SOURCES> _offloadedSources;
+    std::mutex _offloadedSourcesMutex;
+    float _offloadedMixBuffer[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
+    AudioLimiter _offloadedSourcesLimiter { AudioConstants::SAMPLE_RATE, AudioConstants::STEREO };
+    void releaseOffloadedSources();
 
     RateCounter<> _silentOutbound;
     RateCounter<> _audioOutbound;
@@ -111,6 +111,7 @@ void AudioIOStats::publish() {
     // update the interface
     _interface->updateLocalBuffers(_inputMsRead, _inputMsUnplayed, _outputMsUnplayed, _packetTimegaps);
     _interface->updateClientStream(stats);
+    _interface->updateLatencies(_inputMsRead, _inputMsUnplayed, _outputMsUnplayed);
 
     // prepare a packet to the mixer
     int statsPacketSize = sizeof(appendFlag) + sizeof(numStreamStatsToPack) + sizeof(stats);
@@ -180,6 +181,21 @@ void AudioStatsInterface::updateLocalBuffers(const MovingMinMaxAvg<float>& input
     sentTimegapMsAvgWindow(timegaps.getWindowAverage() / USECS_PER_MSEC);
 }
 
+void AudioStatsInterface::updateLatencies(const MovingMinMaxAvg<float>& inputMsRead,
+    const MovingMinMaxAvg<float>& inputMsUnplayed,
+    const MovingMinMaxAvg<float>& outputMsUnplayed) {
+    // audio waits for the rest of the block read from the device it's in, then in the input ring buffer
+    inputLatencyMs((float)(inputMsRead.getWindowAverage() + inputMsUnplayed.getWindowAverage()));
+    jitterBufferLatencyMs(_client->framesAvailableAvg() * AudioConstants::NETWORK_FRAME_MSECS);
+    outputLatencyMs((float)outputMsUnplayed.getWindowAverage());
+
+    // a network frame is sent once it's whole, then goes to the mixer and back in about a ping, waiting in the mixer's
+    // jitter buffer of the sending client's stream on the way
+    float mixerJitterBufferLatencyMs = _mixer->framesAvailableAvg() * AudioConstants::NETWORK_FRAME_MSECS;
+    estimatedLatencyMs(inputLatencyMs() + AudioConstants::NETWORK_FRAME_MSECS + pingMs() + mixerJitterBufferLatencyMs +
+                       jitterBufferLatencyMs() + outputLatencyMs());
+}
+
 void AudioStatsInterface::updateInjectorStreams(const QHash<QUuid, AudioStreamStats>& stats) {
     // Get existing injectors
     auto injectorIds = _injectors->dynamicPropertyNames();
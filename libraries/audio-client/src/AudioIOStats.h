@@ -244,14 +244,25 @@ class AudioStatsInterface : public QObject {
      *
      * @property {AudioStats.AudioStreamStats} clientStream - Statistics of the client's audio stream.
      *     <em>Read-only.</em>
+     * @property {number} estimatedLatencyMs - The estimated time audio takes from the microphone of a client to the speakers 
+     *     of another with the same latencies, through the audio mixer, in ms.
+     *     <em>Read-only.</em>
+     * @property {number} inputLatencyMs - The recent average time microphone audio waits in the input buffers before it's 
+     *     sent, in ms.
+     *     <em>Read-only.</em>
      * @property {number} inputReadMsMax - The maximum duration of a block of audio data recently read from the microphone, in 
      *     ms.
      *     <em>Read-only.</em>
      * @property {number} inputUnplayedMsMax - The maximum duration of microphone audio recently in the input buffer waiting to 
      *     be played, in ms.
      *     <em>Read-only.</em>
+     * @property {number} jitterBufferLatencyMs - The recent average time received audio waits in the jitter buffer, in ms.
+     *     <em>Read-only.</em>
      * @property {AudioStats.AudioStreamStats} mixerStream - Statistics of the audio mixer's stream.
      *     <em>Read-only.</em>
+     * @property {number} outputLatencyMs - The recent average time output audio waits in the output buffer before it's 
+     *     played, in ms.
+     *     <em>Read-only.</em>
      * @property {number} outputUnplayedMsMax - The maximum duration of output audio recently in the output buffer waiting to 
      *     be played, in ms.
      *     <em>Read-only.</em>
@@ -304,6 +315,39 @@ class AudioStatsInterface : public QObject {
      */
     AUDIO_PROPERTY(float, outputUnplayedMsMax);
 
+    /*@jsdoc
+     * Triggered when the recent average time microphone audio waits in the input buffers before it's sent changes.
+     * @function AudioStats.inputLatencyMsChanged
+     * @param {number} inputLatencyMs - The recent average time microphone audio waits in the input buffers, in ms.
+     * @returns {Signal} 
+     */
+    AUDIO_PROPERTY(float, inputLatencyMs);
+
+    /*@jsdoc
+     * Triggered when the recent average time received audio waits in the jitter buffer changes.
+     * @function AudioStats.jitterBufferLatencyMsChanged
+     * @param {number} jitterBufferLatencyMs - The recent average time received audio waits in the jitter buffer, in ms.
+     * @returns {Signal} 
+     */
+    AUDIO_PROPERTY(float, jitterBufferLatencyMs);
+
+    /*@jsdoc
+     * Triggered when the recent average time output audio waits in the output buffer before it's played changes.
+     * @function AudioStats.outputLatencyMsChanged
+     * @param {number} outputLatencyMs - The recent average time output audio waits in the output buffer, in ms.
+     * @returns {Signal} 
+     */
+    AUDIO_PROPERTY(float, outputLatencyMs);
+
+    /*@jsdoc
+     * Triggered when the estimated time audio takes from the microphone of a client to the speakers of another changes.
+     * @function AudioStats.estimatedLatencyMsChanged
+     * @param {number} estimatedLatencyMs - The estimated time audio takes from the microphone of a client to the speakers 
+     *     of another with the same latencies, through the audio mixer, in ms.
+     * @returns {Signal} 
+     */
+    AUDIO_PROPERTY(float, estimatedLatencyMs);
+
 
     /*@jsdoc
      * Triggered when the overall maximum time between sending data packets to the audio mixer changes.
@@ -353,6 +397,9 @@ public:
                             const MovingMinMaxAvg<float>& inputMsUnplayed,
                             const MovingMinMaxAvg<float>& outputMsUnplayed,
                             const MovingMinMaxAvg<quint64>& timegaps);
+    void updateLatencies(const MovingMinMaxAvg<float>& inputMsRead,
+                         const MovingMinMaxAvg<float>& inputMsUnplayed,
+                         const MovingMinMaxAvg<float>& outputMsUnplayed);
     void updateMixerStream(const AudioStreamStats& stats) { _mixer->updateStream(stats); emit mixerStreamChanged(); }
     void updateClientStream(const AudioStreamStats& stats) { _client->updateStream(stats); emit clientStreamChanged(); }
     void updateInjectorStreams(const QHash<QUuid, AudioStreamStats>& stats);
@@ -16,10 +16,11 @@
 #include <Transform.h>
 
 #include "AudioConstants.h"
+#include "AudioFEC.h"
 
 void AbstractAudioInterface::emitAudioPacket(const void* audioData, size_t bytes, quint16& sequenceNumber, bool isStereo,
                                              const Transform& transform, glm::vec3 avatarBoundingBoxCorner, glm::vec3 avatarBoundingBoxScale,
-                                             PacketType packetType, QString codecName) {
+                                             PacketType packetType, QString codecName, AudioFECEncoder* fecEncoder) {
     static std::mutex _mutex;
     using Locker = std::unique_lock<std::mutex>;
     auto nodeList = DependencyManager::get<NodeList>();
@@ -67,5 +68,11 @@ void AbstractAudioInterface::emitAudioPacket(const void* audioData, size_t bytes
         }
         nodeList->flagTimeForConnectionStep(LimitedNodeList::ConnectionStep::SendAudioPacket);
         nodeList->sendUnreliablePacket(*audioPacket, *audioMixer);
+
+        if (fecEncoder) {
+            if (auto parityPacket = fecEncoder->addPacket(*audioPacket)) {
+                nodeList->sendUnreliablePacket(*parityPacket, *audioMixer);
+            }
+        }
     }
 }
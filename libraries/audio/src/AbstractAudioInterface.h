@@ -22,6 +22,7 @@
 #include "AudioSolo.h"
 
 class AudioInjector;
+class AudioFECEncoder;
 class AudioInjectorLocalBuffer;
 class Transform;
 
@@ -32,7 +33,8 @@ public:
 
     static void emitAudioPacket(const void* audioData, size_t bytes, quint16& sequenceNumber, bool isStereo,
                                 const Transform& transform, glm::vec3 avatarBoundingBoxCorner, glm::vec3 avatarBoundingBoxScale,
-                                PacketType packetType, QString codecName = QString(""));
+                                PacketType packetType, QString codecName = QString(""),
+                                AudioFECEncoder* fecEncoder = nullptr);
 
     // threadsafe
     // moves injector->getLocalBuffer() to another thread (so removes its parent)
@@ -41,6 +41,10 @@ namespace AudioConstants {
     // be careful with overflows when using this constant
     const int NETWORK_FRAME_USECS = static_cast<int>(NETWORK_FRAME_MSECS * 1000.0f);
     
+    // sources a listener can spatialize itself, sent alongside its mix instead of in it
+    const int MAX_OFFLOADED_SOURCES = 8;
+    const uint8_t OFFLOADED_SOURCE_RESET = 0x80; // set on a source's slot when its decoder and HRTF start over
+
     const int MIN_SAMPLE_VALUE = std::numeric_limits<AudioSample>::min();
     const int MAX_SAMPLE_VALUE = std::numeric_limits<AudioSample>::max();
 }
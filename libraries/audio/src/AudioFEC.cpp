@@ -0,0 +1,157 @@
+//
+//  AudioFEC.cpp
+//  libraries/audio/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioFEC.h"
+
+#include <algorithm>
+#include <cstring>
+
+// XORs bytes into parity at offset, growing it with zeros first if it is too short
+static void xorInto(QByteArray& parity, int offset, const char* bytes, int size) {
+    if (parity.size() < offset + size) {
+        parity.append(QByteArray(offset + size - parity.size(), 0));
+    }
+
+    char* out = parity.data() + offset;
+    for (int i = 0; i < size; ++i) {
+        out[i] ^= bytes[i];
+    }
+}
+
+void AudioFECEncoder::setGroupSize(int groupSize) {
+    _groupSize = std::max(0, std::min(groupSize, AudioFEC::MAX_GROUP_SIZE));
+    _numPackets = 0;
+}
+
+std::unique_ptr<NLPacket> AudioFECEncoder::addPacket(const NLPacket& audioPacket) {
+    if (_groupSize == 0 || audioPacket.getPayloadSize() < (qint64)sizeof(quint16)) {
+        return nullptr;
+    }
+
+    quint16 sequence;
+    memcpy(&sequence, audioPacket.getPayload(), sizeof(quint16));
+
+    if (_numPackets > 0 && sequence != (quint16)(_firstSequence + _numPackets)) {
+        // the group has to be consecutive packets, start over
+        _numPackets = 0;
+    }
+
+    if (_numPackets == 0) {
+        _firstSequence = sequence;
+        _lengthParity = 0;
+        _parity.clear();
+    }
+
+    auto type = (char)audioPacket.getType();
+    auto afterSequence = audioPacket.getPayload() + sizeof(quint16);
+    int size = (int)audioPacket.getPayloadSize() - (int)sizeof(quint16);
+
+    xorInto(_parity, 0, &type, sizeof(type));
+    xorInto(_parity, sizeof(type), afterSequence, size);
+    _lengthParity ^= (quint16)(sizeof(type) + size);
+
+    if (++_numPackets < _groupSize) {
+        return nullptr;
+    }
+
+    auto parityPacket = NLPacket::create(PacketType::AudioForwardErrorCorrection, AudioFEC::HEADER_BYTES + _parity.size());
+    parityPacket->writePrimitive(_firstSequence);
+    parityPacket->writePrimitive((quint8)_numPackets);
+    parityPacket->writePrimitive(_lengthParity);
+    parityPacket->write(_parity);
+
+    _numPackets = 0;
+    return parityPacket;
+}
+
+void AudioFECDecoder::reset() {
+    for (auto& received : _history) {
+        received.isValid = false;
+        received.protectedBytes.clear();
+    }
+}
+
+void AudioFECDecoder::addPacket(quint16 sequence, PacketType type, const char* afterSequence, int size) {
+    auto& received = _history[sequence & (HISTORY_SIZE - 1)];
+    received.isValid = true;
+    received.sequence = sequence;
+    received.protectedBytes.resize(sizeof(char) + size);
+    received.protectedBytes[0] = (char)type;
+    memcpy(received.protectedBytes.data() + sizeof(char), afterSequence, size);
+}
+
+bool AudioFECDecoder::peekLastSequence(ReceivedMessage& parityMessage, quint16& lastSequence) {
+    parityMessage.seek(0);
+    if (parityMessage.getBytesLeftToRead() < AudioFEC::HEADER_BYTES) {
+        return false;
+    }
+
+    quint16 firstSequence;
+    quint8 numPackets;
+    parityMessage.readPrimitive(&firstSequence);
+    parityMessage.readPrimitive(&numPackets);
+    lastSequence = firstSequence + numPackets - 1;
+    return numPackets > 0;
+}
+
+bool AudioFECDecoder::recover(ReceivedMessage& parityMessage, quint16& sequence, PacketType& type,
+                              QByteArray& afterSequence) const {
+    parityMessage.seek(0);
+    if (parityMessage.getBytesLeftToRead() < AudioFEC::HEADER_BYTES) {
+        return false;
+    }
+
+    quint16 firstSequence;
+    quint8 numPackets;
+    quint16 length;
+    parityMessage.readPrimitive(&firstSequence);
+    parityMessage.readPrimitive(&numPackets);
+    parityMessage.readPrimitive(&length);
+
+    if (numPackets == 0 || numPackets > AudioFEC::MAX_GROUP_SIZE) {
+        return false;
+    }
+
+    // find the one we don't have
+    int numMissing = 0;
+    for (quint16 i = 0; i < numPackets; ++i) {
+        quint16 groupSequence = firstSequence + i;
+        const auto& received = _history[groupSequence & (HISTORY_SIZE - 1)];
+        if (!received.isValid || received.sequence != groupSequence) {
+            ++numMissing;
+            sequence = groupSequence;
+        }
+    }
+
+    if (numMissing != 1) {
+        return false;
+    }
+
+    // XOR the parity with everything we do have, what's left is the missing packet
+    QByteArray rebuilt = parityMessage.read(parityMessage.getBytesLeftToRead());
+    for (quint16 i = 0; i < numPackets; ++i) {
+        quint16 groupSequence = firstSequence + i;
+        if (groupSequence == sequence) {
+            continue;
+        }
+
+        const auto& received = _history[groupSequence & (HISTORY_SIZE - 1)];
+        xorInto(rebuilt, 0, received.protectedBytes.constData(), received.protectedBytes.size());
+        length ^= (quint16)received.protectedBytes.size();
+    }
+
+    if (length < sizeof(char) || length > (quint16)rebuilt.size()) {
+        return false;
+    }
+
+    type = (PacketType)(quint8)rebuilt[0];
+    afterSequence = rebuilt.mid(sizeof(char), length - sizeof(char));
+    return true;
+}
@@ -0,0 +1,83 @@
+//
+//  AudioFEC.h
+//  libraries/audio/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_AudioFEC_h
+#define vircadia_AudioFEC_h
+
+#include <array>
+#include <memory>
+
+#include <QtCore/QByteArray>
+
+#include <NLPacket.h>
+#include <ReceivedMessage.h>
+
+// XOR forward error correction for the unreliable audio streams (mic audio to the mixer, mixed audio to the client).
+// After every group of consecutive audio packets the sender sends an AudioForwardErrorCorrection packet holding the
+// XOR of the group, from which the receiver can rebuild any one packet of the group that went missing.
+//
+// What is protected is the packet type and everything after the sequence number, so a rebuilt packet can be handed
+// to the stream exactly as if it had arrived.
+//
+// The group size is negotiated along with the codec: the client asks for one after its codec list in
+// NegotiateAudioFormat and the mixer answers with the size both sides use after the codec name in SelectedAudioFormat.
+// Peers that don't know about it leave those trailers out, and get no FEC.
+namespace AudioFEC {
+    const int MAX_GROUP_SIZE = 8;
+    const int DEFAULT_GROUP_SIZE = 4;
+
+    // sequence number of the first packet in the group, number of packets, XOR of their lengths
+    const int HEADER_BYTES = sizeof(quint16) + sizeof(quint8) + sizeof(quint16);
+}
+
+class AudioFECEncoder {
+public:
+    // 0 disables FEC
+    void setGroupSize(int groupSize);
+    int getGroupSize() const { return _groupSize; }
+
+    // adds an audio packet that is about to be sent, returns the parity packet to send after it if it completes a group
+    std::unique_ptr<NLPacket> addPacket(const NLPacket& audioPacket);
+
+private:
+    int _groupSize { 0 };
+    int _numPackets { 0 };
+    quint16 _firstSequence { 0 };
+    quint16 _lengthParity { 0 };
+    QByteArray _parity;
+};
+
+class AudioFECDecoder {
+public:
+    void reset();
+
+    // remembers a received audio packet so that a missing neighbour can be rebuilt with it
+    void addPacket(quint16 sequence, PacketType type, const char* afterSequence, int size);
+
+    // rebuilds the one packet of the parity packet's group that hasn't been added
+    // returns false if none or more than one of them is missing
+    bool recover(ReceivedMessage& parityMessage, quint16& sequence, PacketType& type, QByteArray& afterSequence) const;
+
+    // the sequence number of the last packet in the group the parity packet covers
+    static bool peekLastSequence(ReceivedMessage& parityMessage, quint16& lastSequence);
+
+private:
+    // a power of two so that indexing by sequence number stays consistent when it wraps
+    static const int HISTORY_SIZE = 2 * AudioFEC::MAX_GROUP_SIZE;
+
+    struct Received {
+        bool isValid { false };
+        quint16 sequence { 0 };
+        QByteArray protectedBytes; // type then everything after the sequence number
+    };
+    std::array<Received, HISTORY_SIZE> _history;
+};
+
+#endif // vircadia_AudioFEC_h
@@ -16,6 +16,7 @@
 #include <assert.h>
 
 #include "AudioHRTFData.h"
+#include "AudioMixKernels.h"
 
 #if defined(_MSC_VER)
 #define ALIGN32 __declspec(align(32))
@@ -691,43 +692,6 @@ static void interpolate(const float* src0, const float* src1, float* dst, float
 
 #endif
 
-// apply gain crossfade with accumulation (interleaved)
-static void gainfade_1x2(int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
-
-    gain0 *= (1/32768.0f);  // int16_t to float
-    gain1 *= (1/32768.0f);
-
-    for (int i = 0; i < numFrames; i++) {
-
-        float frac = win[i];
-        float gain = gain1 + frac * (gain0 - gain1);
-
-        float x0 = (float)src[i] * gain;
-
-        dst[2*i+0] += x0;
-        dst[2*i+1] += x0;
-    }
-}
-
-// apply gain crossfade with accumulation (interleaved)
-static void gainfade_2x2(int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
-
-    gain0 *= (1/32768.0f);  // int16_t to float
-    gain1 *= (1/32768.0f);
-
-    for (int i = 0; i < numFrames; i++) {
-
-        float frac = win[i];
-        float gain = gain1 + frac * (gain0 - gain1);
-
-        float x0 = (float)src[2*i+0] * gain;
-        float x1 = (float)src[2*i+1] * gain;
-
-        dst[2*i+0] += x0;
-        dst[2*i+1] += x1;
-    }
-}
-
 // design a 2nd order Thiran allpass
 static void ThiranBiquad(float f, float& b0, float& b1, float& b2, float& a1, float& a2) {
 
@@ -1060,7 +1024,7 @@ static void setFilters(float firCoef[4][HRTF_TAPS], float bqCoef[5][8], int dela
     }
 }
 
-void AudioHRTF::render(int16_t* input, float* output, int index, float azimuth, float distance, float gain, int numFrames,
+void AudioHRTF::render(const int16_t* input, float* output, int index, float azimuth, float distance, float gain, int numFrames,
                        float lpfDistance) {
 
     assert(index >= 0);
@@ -1162,7 +1126,7 @@ void AudioHRTF::render(int16_t* input, float* output, int index, float azimuth,
     _resetState = false;
 }
 
-void AudioHRTF::mixMono(int16_t* input, float* output, float gain, int numFrames) {
+void AudioHRTF::mixMono(const int16_t* input, float* output, float gain, int numFrames) {
 
     assert(numFrames == HRTF_BLOCK);
 
@@ -1174,8 +1138,8 @@ void AudioHRTF::mixMono(int16_t* input, float* output, float gain, int numFrames
         _gainState = gain;
     }
 
-    // crossfade gain and accumulate
-    gainfade_1x2(input, output, crossfadeTable, _gainState, gain, HRTF_BLOCK);
+    // crossfade gain and accumulate (int16_t to float)
+    gainfade_1x2(input, output, crossfadeTable, _gainState * (1/32768.0f), gain * (1/32768.0f), HRTF_BLOCK);
 
     // new parameters become old
     _gainState = gain;
@@ -1183,7 +1147,7 @@ void AudioHRTF::mixMono(int16_t* input, float* output, float gain, int numFrames
     _resetState = false;
 }
 
-void AudioHRTF::mixStereo(int16_t* input, float* output, float gain, int numFrames) {
+void AudioHRTF::mixStereo(const int16_t* input, float* output, float gain, int numFrames) {
 
     assert(numFrames == HRTF_BLOCK);
 
@@ -1195,8 +1159,8 @@ void AudioHRTF::mixStereo(int16_t* input, float* output, float gain, int numFram
         _gainState = gain;
     }
 
-    // crossfade gain and accumulate
-    gainfade_2x2(input, output, crossfadeTable, _gainState, gain, HRTF_BLOCK);
+    // crossfade gain and accumulate (int16_t to float)
+    gainfade_2x2(input, output, crossfadeTable, _gainState * (1/32768.0f), gain * (1/32768.0f), HRTF_BLOCK);
 
     // new parameters become old
     _gainState = gain;
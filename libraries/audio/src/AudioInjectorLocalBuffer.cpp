@@ -11,6 +11,8 @@
 
 #include "AudioInjectorLocalBuffer.h"
 
+#include <algorithm>
+
 AudioInjectorLocalBuffer::AudioInjectorLocalBuffer(AudioDataPointer audioData) :
     _audioData(audioData)
 {
@@ -65,6 +67,23 @@ qint64 AudioInjectorLocalBuffer::readData(char* data, qint64 maxSize) {
     }
 }
 
+qint64 AudioInjectorLocalBuffer::skip(qint64 maxSize) {
+    if (_isStopped || !_audioData || _audioData->getNumBytes() == 0) {
+        return 0;
+    }
+
+    int numBytes = (int)_audioData->getNumBytes();
+    int bytesToEnd = numBytes - _currentOffset;
+    if (!_shouldLoop) {
+        int bytesSkipped = (int)std::min(maxSize, (qint64)bytesToEnd);
+        _currentOffset += bytesSkipped;
+        return bytesSkipped;
+    }
+
+    _currentOffset = (int)((_currentOffset + maxSize) % numBytes);
+    return maxSize;
+}
+
 qint64 AudioInjectorLocalBuffer::recursiveReadFromFront(char* data, qint64 maxSize) {
     // see how much we can get in this pass
     int bytesRead = maxSize;
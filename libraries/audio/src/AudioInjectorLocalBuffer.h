@@ -31,6 +31,9 @@ public:
     qint64 readData(char* data, qint64 maxSize) override;
     qint64 writeData(const char* data, qint64 maxSize) override { return 0; }
 
+    // moves on by up to maxSize bytes as readData would, without copying them; returns 0 once the sound has finished
+    qint64 skip(qint64 maxSize);
+
     void setShouldLoop(bool shouldLoop) { _shouldLoop = shouldLoop; }
     void setCurrentOffset(int currentOffset) { _currentOffset = currentOffset; }
 
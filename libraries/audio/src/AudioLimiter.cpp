@@ -11,6 +11,7 @@
 #include <assert.h>
 
 #include "AudioDynamics.h"
+#include "AudioMixKernels.h"
 
 //
 // Limiter (common)
@@ -22,6 +23,9 @@ protected:
     int32_t _holdTable[NARC];
     int32_t _releaseTable[NARC];
 
+    // the envelope runs a frame at a time, its gains are applied to a block of frames at once
+    static const int BLOCK_FRAMES = 64;
+
     int32_t _rmsAttack = 0x7fffffff;
     int32_t _rmsRelease = 0x7fffffff;
     int32_t _arcRelease = 0x7fffffff;
@@ -209,36 +213,44 @@ public:
 template<int N>
 void LimiterMono<N>::process(float* input, int16_t* output, int numFrames) {
 
-    for (int n = 0; n < numFrames; n++) {
+    float delayed[BLOCK_FRAMES];
+    float gains[BLOCK_FRAMES];
+    float dithers[BLOCK_FRAMES];
+
+    for (int n0 = 0; n0 < numFrames; n0 += BLOCK_FRAMES) {
+
+        int count = MIN(BLOCK_FRAMES, numFrames - n0);
 
-        // peak detect and convert to log2 domain
-        int32_t peak = peaklog2(&input[n]);
+        for (int i = 0; i < count; i++) {
 
-        // compute limiter attenuation
-        int32_t attn = MAX(_threshold - peak, 0);
+            int n = n0 + i;
 
-        // apply envelope
-        attn = envelope(attn);
+            // peak detect and convert to log2 domain
+            int32_t peak = peaklog2(&input[n]);
 
-        // convert from log2 domain
-        attn = fixexp2(attn);
+            // compute limiter attenuation
+            int32_t attn = MAX(_threshold - peak, 0);
 
-        // lowpass filter
-        attn = _filter.process(attn);
-        float gain = attn * _outGain;
+            // apply envelope
+            attn = envelope(attn);
 
-        // delay audio
-        float x = input[n];
-        _delay.process(x);
+            // convert from log2 domain
+            attn = fixexp2(attn);
 
-        // apply gain
-        x *= gain;
+            // lowpass filter
+            attn = _filter.process(attn);
+            gains[i] = attn * _outGain;
 
-        // apply dither
-        x += dither();
+            // delay audio
+            float x = input[n];
+            _delay.process(x);
+            delayed[i] = x;
 
-        // store 16-bit output
-        output[n] = (int16_t)floatToInt(x);
+            dithers[i] = dither();
+        }
+
+        // apply gain and dither, store 16-bit output
+        gainDitherToInt16(delayed, gains, dithers, &output[n0], count, 1);
     }
 }
 
@@ -261,41 +273,46 @@ public:
 template<int N>
 void LimiterStereo<N>::process(float* input, int16_t* output, int numFrames) {
 
-    for (int n = 0; n < numFrames; n++) {
+    float delayed[2 * BLOCK_FRAMES];
+    float gains[BLOCK_FRAMES];
+    float dithers[BLOCK_FRAMES];
+
+    for (int n0 = 0; n0 < numFrames; n0 += BLOCK_FRAMES) {
 
-        // peak detect and convert to log2 domain
-        int32_t peak = peaklog2(&input[2*n+0], &input[2*n+1]);
+        int count = MIN(BLOCK_FRAMES, numFrames - n0);
 
-        // compute limiter attenuation
-        int32_t attn = MAX(_threshold - peak, 0);
+        for (int i = 0; i < count; i++) {
 
-        // apply envelope
-        attn = envelope(attn);
+            int n = n0 + i;
 
-        // convert from log2 domain
-        attn = fixexp2(attn);
+            // peak detect and convert to log2 domain
+            int32_t peak = peaklog2(&input[2*n+0], &input[2*n+1]);
 
-        // lowpass filter
-        attn = _filter.process(attn);
-        float gain = attn * _outGain;
+            // compute limiter attenuation
+            int32_t attn = MAX(_threshold - peak, 0);
 
-        // delay audio
-        float x0 = input[2*n+0];
-        float x1 = input[2*n+1];
-        _delay.process(x0, x1);
+            // apply envelope
+            attn = envelope(attn);
 
-        // apply gain
-        x0 *= gain;
-        x1 *= gain;
+            // convert from log2 domain
+            attn = fixexp2(attn);
 
-        // apply dither
-        float d = dither();
-        x0 += d;
-        x1 += d;
+            // lowpass filter
+            attn = _filter.process(attn);
+            gains[i] = attn * _outGain;
 
-        // store 16-bit output
-        output[2*n+0] = (int16_t)floatToInt(x0);
-        output[2*n+1] = (int16_t)floatToInt(x1);
+            // delay audio
+            float x0 = input[2*n+0];
+            float x1 = input[2*n+1];
+            _delay.process(x0, x1);
+            delayed[2*i+0] = x0;
+            delayed[2*i+1] = x1;
+
+            dithers[i] = dither();
+        }
+
+        // apply gain and dither, store 16-bit output
+        gainDitherToInt16(delayed, gains, dithers, &output[2*n0], count, 2);
     }
 }
 
@@ -318,49 +335,50 @@ public:
 template<int N>
 void LimiterQuad<N>::process(float* input, int16_t* output, int numFrames) {
 
-    for (int n = 0; n < numFrames; n++) {
-
-        // peak detect and convert to log2 domain
-        int32_t peak = peaklog2(&input[4*n+0], &input[4*n+1], &input[4*n+2], &input[4*n+3]);
-
-        // compute limiter attenuation
-        int32_t attn = MAX(_threshold - peak, 0);
-
-        // apply envelope
-        attn = envelope(attn);
-
-        // convert from log2 domain
-        attn = fixexp2(attn);
-
-        // lowpass filter
-        attn = _filter.process(attn);
-        float gain = attn * _outGain;
-
-        // delay audio
-        float x0 = input[4*n+0];
-        float x1 = input[4*n+1];
-        float x2 = input[4*n+2];
-        float x3 = input[4*n+3];
-        _delay.process(x0, x1, x2, x3);
-
-        // apply gain
-        x0 *= gain;
-        x1 *= gain;
-        x2 *= gain;
-        x3 *= gain;
-
-        // apply dither
-        float d = dither();
-        x0 += d;
-        x1 += d;
-        x2 += d;
-        x3 += d;
-
-        // store 16-bit output
-        output[4*n+0] = (int16_t)floatToInt(x0);
-        output[4*n+1] = (int16_t)floatToInt(x1);
-        output[4*n+2] = (int16_t)floatToInt(x2);
-        output[4*n+3] = (int16_t)floatToInt(x3);
+    float delayed[4 * BLOCK_FRAMES];
+    float gains[BLOCK_FRAMES];
+    float dithers[BLOCK_FRAMES];
+
+    for (int n0 = 0; n0 < numFrames; n0 += BLOCK_FRAMES) {
+
+        int count = MIN(BLOCK_FRAMES, numFrames - n0);
+
+        for (int i = 0; i < count; i++) {
+
+            int n = n0 + i;
+
+            // peak detect and convert to log2 domain
+            int32_t peak = peaklog2(&input[4*n+0], &input[4*n+1], &input[4*n+2], &input[4*n+3]);
+
+            // compute limiter attenuation
+            int32_t attn = MAX(_threshold - peak, 0);
+
+            // apply envelope
+            attn = envelope(attn);
+
+            // convert from log2 domain
+            attn = fixexp2(attn);
+
+            // lowpass filter
+            attn = _filter.process(attn);
+            gains[i] = attn * _outGain;
+
+            // delay audio
+            float x0 = input[4*n+0];
+            float x1 = input[4*n+1];
+            float x2 = input[4*n+2];
+            float x3 = input[4*n+3];
+            _delay.process(x0, x1, x2, x3);
+            delayed[4*i+0] = x0;
+            delayed[4*i+1] = x1;
+            delayed[4*i+2] = x2;
+            delayed[4*i+3] = x3;
+
+            dithers[i] = dither();
+        }
+
+        // apply gain and dither, store 16-bit output
+        gainDitherToInt16(delayed, gains, dithers, &output[4*n0], count, 4);
     }
 }
 
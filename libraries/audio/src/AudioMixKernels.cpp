@@ -0,0 +1,372 @@
+//
+//  AudioMixKernels.cpp
+//  libraries/audio/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioMixKernels.h"
+
+//
+// Reference code, also used for whatever is left over after the vectorized loops
+//
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+
+#include <emmintrin.h>
+
+// round-to-nearest, the same as the vectorized conversion
+static inline int32_t roundToInt(float x) {
+    return _mm_cvt_ss2si(_mm_set_ss(x));
+}
+
+#else
+
+// round half away from zero, the same as the vectorized conversion
+static inline int32_t roundToInt(float x) {
+    x += (x < 0.0f ? -0.5f : 0.5f);
+    return (int32_t)x;
+}
+
+#endif
+
+static inline int16_t saturateToInt16(int32_t x) {
+    return (int16_t)(x < -32768 ? -32768 : (x > 32767 ? 32767 : x));
+}
+
+static void gainfade_1x2_ref(const int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
+
+    float gainDelta = gain0 - gain1;
+
+    for (int i = 0; i < numFrames; i++) {
+
+        float gain = gain1 + win[i] * gainDelta;
+
+        float x0 = (float)src[i] * gain;
+
+        dst[2*i+0] += x0;
+        dst[2*i+1] += x0;
+    }
+}
+
+static void gainfade_2x2_ref(const int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
+
+    float gainDelta = gain0 - gain1;
+
+    for (int i = 0; i < numFrames; i++) {
+
+        float gain = gain1 + win[i] * gainDelta;
+
+        float x0 = (float)src[2*i+0] * gain;
+        float x1 = (float)src[2*i+1] * gain;
+
+        dst[2*i+0] += x0;
+        dst[2*i+1] += x1;
+    }
+}
+
+static void gainDitherToInt16_ref(const float* src, const float* gain, const float* dither, int16_t* dst,
+                                  int numFrames, int numChannels) {
+
+    for (int i = 0; i < numFrames; i++) {
+        for (int c = 0; c < numChannels; c++) {
+            float x = src[numChannels*i+c] * gain[i] + dither[i];
+            dst[numChannels*i+c] = saturateToInt16(roundToInt(x));
+        }
+    }
+}
+
+static bool isSilent_ref(const float* src, int numSamples) {
+
+    for (int i = 0; i < numSamples; i++) {
+        if (src[i] != 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//
+// on x86 architecture, assume that SSE2 is present
+//
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+
+static void gainfade_1x2_SSE(const int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
+
+    __m128 g1 = _mm_set1_ps(gain1);
+    __m128 gd = _mm_set1_ps(gain0 - gain1);
+
+    int i = 0;
+    for (; i <= numFrames - 4; i += 4) {
+
+        // sign-extend 4 samples to int32
+        __m128i s = _mm_loadl_epi64((const __m128i*)&src[i]);
+        __m128 x = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16));
+
+        __m128 gain = _mm_add_ps(g1, _mm_mul_ps(_mm_loadu_ps(&win[i]), gd));
+        x = _mm_mul_ps(x, gain);
+
+        // duplicate into both channels
+        _mm_storeu_ps(&dst[2*i+0], _mm_add_ps(_mm_loadu_ps(&dst[2*i+0]), _mm_unpacklo_ps(x, x)));
+        _mm_storeu_ps(&dst[2*i+4], _mm_add_ps(_mm_loadu_ps(&dst[2*i+4]), _mm_unpackhi_ps(x, x)));
+    }
+
+    gainfade_1x2_ref(&src[i], &dst[2*i], &win[i], gain0, gain1, numFrames - i);
+}
+
+static void gainfade_2x2_SSE(const int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
+
+    __m128 g1 = _mm_set1_ps(gain1);
+    __m128 gd = _mm_set1_ps(gain0 - gain1);
+
+    int i = 0;
+    for (; i <= numFrames - 4; i += 4) {
+
+        // sign-extend 4 frames to int32
+        __m128i s = _mm_loadu_si128((const __m128i*)&src[2*i]);
+        __m128 x0 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16));
+        __m128 x1 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16));
+
+        // expand the per-frame gain to both channels
+        __m128 gain = _mm_add_ps(g1, _mm_mul_ps(_mm_loadu_ps(&win[i]), gd));
+        x0 = _mm_mul_ps(x0, _mm_unpacklo_ps(gain, gain));
+        x1 = _mm_mul_ps(x1, _mm_unpackhi_ps(gain, gain));
+
+        _mm_storeu_ps(&dst[2*i+0], _mm_add_ps(_mm_loadu_ps(&dst[2*i+0]), x0));
+        _mm_storeu_ps(&dst[2*i+4], _mm_add_ps(_mm_loadu_ps(&dst[2*i+4]), x1));
+    }
+
+    gainfade_2x2_ref(&src[2*i], &dst[2*i], &win[i], gain0, gain1, numFrames - i);
+}
+
+static void gainDitherToInt16_SSE(const float* src, const float* gain, const float* dither, int16_t* dst,
+                                  int numFrames, int numChannels) {
+
+    int i = 0;
+    switch (numChannels) {
+    case 1:
+        for (; i <= numFrames - 8; i += 8) {
+            __m128 x0 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&src[i+0]), _mm_loadu_ps(&gain[i+0])), _mm_loadu_ps(&dither[i+0]));
+            __m128 x1 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&src[i+4]), _mm_loadu_ps(&gain[i+4])), _mm_loadu_ps(&dither[i+4]));
+
+            __m128i y = _mm_packs_epi32(_mm_cvtps_epi32(x0), _mm_cvtps_epi32(x1));
+            _mm_storeu_si128((__m128i*)&dst[i], y);
+        }
+        break;
+
+    case 2:
+        for (; i <= numFrames - 4; i += 4) {
+            __m128 g = _mm_loadu_ps(&gain[i]);
+            __m128 d = _mm_loadu_ps(&dither[i]);
+
+            __m128 x0 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&src[2*i+0]), _mm_unpacklo_ps(g, g)), _mm_unpacklo_ps(d, d));
+            __m128 x1 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&src[2*i+4]), _mm_unpackhi_ps(g, g)), _mm_unpackhi_ps(d, d));
+
+            __m128i y = _mm_packs_epi32(_mm_cvtps_epi32(x0), _mm_cvtps_epi32(x1));
+            _mm_storeu_si128((__m128i*)&dst[2*i], y);
+        }
+        break;
+
+    case 4:
+        for (; i <= numFrames - 2; i += 2) {
+            __m128 x0 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&src[4*i+0]), _mm_set1_ps(gain[i+0])), _mm_set1_ps(dither[i+0]));
+            __m128 x1 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&src[4*i+4]), _mm_set1_ps(gain[i+1])), _mm_set1_ps(dither[i+1]));
+
+            __m128i y = _mm_packs_epi32(_mm_cvtps_epi32(x0), _mm_cvtps_epi32(x1));
+            _mm_storeu_si128((__m128i*)&dst[4*i], y);
+        }
+        break;
+    }
+
+    gainDitherToInt16_ref(&src[numChannels*i], &gain[i], &dither[i], &dst[numChannels*i], numFrames - i, numChannels);
+}
+
+static bool isSilent_SSE(const float* src, int numSamples) {
+
+    __m128 zero = _mm_setzero_ps();
+
+    int i = 0;
+    for (; i <= numSamples - 8; i += 8) {
+        __m128 nz0 = _mm_cmpneq_ps(_mm_loadu_ps(&src[i+0]), zero);
+        __m128 nz1 = _mm_cmpneq_ps(_mm_loadu_ps(&src[i+4]), zero);
+        if (_mm_movemask_ps(_mm_or_ps(nz0, nz1))) {
+            return false;
+        }
+    }
+
+    return isSilent_ref(&src[i], numSamples - i);
+}
+
+//
+// Runtime CPU dispatch
+//
+
+#include "CPUDetect.h"
+
+void gainfade_1x2_AVX2(const int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames);
+void gainfade_2x2_AVX2(const int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames);
+void gainDitherToInt16_AVX2(const float* src, const float* gain, const float* dither, int16_t* dst,
+                            int numFrames, int numChannels);
+bool isSilent_AVX2(const float* src, int numSamples);
+
+void gainfade_1x2(const int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
+
+    static auto f = cpuSupportsAVX2() ? gainfade_1x2_AVX2 : gainfade_1x2_SSE;
+    (*f)(src, dst, win, gain0, gain1, numFrames);   // dispatch
+}
+
+void gainfade_2x2(const int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
+
+    static auto f = cpuSupportsAVX2() ? gainfade_2x2_AVX2 : gainfade_2x2_SSE;
+    (*f)(src, dst, win, gain0, gain1, numFrames);   // dispatch
+}
+
+void gainDitherToInt16(const float* src, const float* gain, const float* dither, int16_t* dst,
+                       int numFrames, int numChannels) {
+
+    static auto f = cpuSupportsAVX2() ? gainDitherToInt16_AVX2 : gainDitherToInt16_SSE;
+    (*f)(src, gain, dither, dst, numFrames, numChannels);   // dispatch
+}
+
+bool isSilent(const float* src, int numSamples) {
+
+    static auto f = cpuSupportsAVX2() ? isSilent_AVX2 : isSilent_SSE;
+    return (*f)(src, numSamples);   // dispatch
+}
+
+//
+// on ARM architecture, use NEON when present
+//
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+
+#include <arm_neon.h>
+
+// round half away from zero, then saturate to int16
+static inline int16x4_t roundToInt16(float32x4_t x) {
+    uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(0x80000000));
+    float32x4_t half = vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(vdupq_n_f32(0.5f)), sign));
+    return vqmovn_s32(vcvtq_s32_f32(vaddq_f32(x, half)));
+}
+
+void gainfade_1x2(const int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
+
+    float32x4_t g1 = vdupq_n_f32(gain1);
+    float32x4_t gd = vdupq_n_f32(gain0 - gain1);
+
+    int i = 0;
+    for (; i <= numFrames - 4; i += 4) {
+
+        float32x4_t x = vcvtq_f32_s32(vmovl_s16(vld1_s16(&src[i])));
+
+        float32x4_t gain = vaddq_f32(g1, vmulq_f32(vld1q_f32(&win[i]), gd));
+        x = vmulq_f32(x, gain);
+
+        // duplicate into both channels
+        float32x4x2_t y = vzipq_f32(x, x);
+        vst1q_f32(&dst[2*i+0], vaddq_f32(vld1q_f32(&dst[2*i+0]), y.val[0]));
+        vst1q_f32(&dst[2*i+4], vaddq_f32(vld1q_f32(&dst[2*i+4]), y.val[1]));
+    }
+
+    gainfade_1x2_ref(&src[i], &dst[2*i], &win[i], gain0, gain1, numFrames - i);
+}
+
+void gainfade_2x2(const int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
+
+    float32x4_t g1 = vdupq_n_f32(gain1);
+    float32x4_t gd = vdupq_n_f32(gain0 - gain1);
+
+    int i = 0;
+    for (; i <= numFrames - 4; i += 4) {
+
+        int16x8_t s = vld1q_s16(&src[2*i]);
+        float32x4_t x0 = vcvtq_f32_s32(vmovl_s16(vget_low_s16(s)));
+        float32x4_t x1 = vcvtq_f32_s32(vmovl_s16(vget_high_s16(s)));
+
+        // expand the per-frame gain to both channels
+        float32x4_t gain = vaddq_f32(g1, vmulq_f32(vld1q_f32(&win[i]), gd));
+        float32x4x2_t g = vzipq_f32(gain, gain);
+        x0 = vmulq_f32(x0, g.val[0]);
+        x1 = vmulq_f32(x1, g.val[1]);
+
+        vst1q_f32(&dst[2*i+0], vaddq_f32(vld1q_f32(&dst[2*i+0]), x0));
+        vst1q_f32(&dst[2*i+4], vaddq_f32(vld1q_f32(&dst[2*i+4]), x1));
+    }
+
+    gainfade_2x2_ref(&src[2*i], &dst[2*i], &win[i], gain0, gain1, numFrames - i);
+}
+
+void gainDitherToInt16(const float* src, const float* gain, const float* dither, int16_t* dst,
+                       int numFrames, int numChannels) {
+
+    int i = 0;
+    switch (numChannels) {
+    case 1:
+        for (; i <= numFrames - 4; i += 4) {
+            float32x4_t x = vaddq_f32(vmulq_f32(vld1q_f32(&src[i]), vld1q_f32(&gain[i])), vld1q_f32(&dither[i]));
+            vst1_s16(&dst[i], roundToInt16(x));
+        }
+        break;
+
+    case 2:
+        for (; i <= numFrames - 4; i += 4) {
+            float32x4x2_t g = vzipq_f32(vld1q_f32(&gain[i]), vld1q_f32(&gain[i]));
+            float32x4x2_t d = vzipq_f32(vld1q_f32(&dither[i]), vld1q_f32(&dither[i]));
+
+            float32x4_t x0 = vaddq_f32(vmulq_f32(vld1q_f32(&src[2*i+0]), g.val[0]), d.val[0]);
+            float32x4_t x1 = vaddq_f32(vmulq_f32(vld1q_f32(&src[2*i+4]), g.val[1]), d.val[1]);
+
+            vst1q_s16(&dst[2*i], vcombine_s16(roundToInt16(x0), roundToInt16(x1)));
+        }
+        break;
+
+    case 4:
+        for (; i < numFrames; i++) {
+            float32x4_t x = vaddq_f32(vmulq_f32(vld1q_f32(&src[4*i]), vdupq_n_f32(gain[i])), vdupq_n_f32(dither[i]));
+            vst1_s16(&dst[4*i], roundToInt16(x));
+        }
+        break;
+    }
+
+    gainDitherToInt16_ref(&src[numChannels*i], &gain[i], &dither[i], &dst[numChannels*i], numFrames - i, numChannels);
+}
+
+bool isSilent(const float* src, int numSamples) {
+
+    int i = 0;
+    for (; i <= numSamples - 8; i += 8) {
+        // nonzero bits other than the sign mean a nonzero sample
+        uint32x4_t b0 = vandq_u32(vreinterpretq_u32_f32(vld1q_f32(&src[i+0])), vdupq_n_u32(0x7fffffff));
+        uint32x4_t b1 = vandq_u32(vreinterpretq_u32_f32(vld1q_f32(&src[i+4])), vdupq_n_u32(0x7fffffff));
+        uint32x4_t b = vorrq_u32(b0, b1);
+        uint32x2_t r = vorr_u32(vget_low_u32(b), vget_high_u32(b));
+        if (vget_lane_u32(vpmax_u32(r, r), 0)) {
+            return false;
+        }
+    }
+
+    return isSilent_ref(&src[i], numSamples - i);
+}
+
+#else   // portable reference code
+
+void gainfade_1x2(const int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
+    gainfade_1x2_ref(src, dst, win, gain0, gain1, numFrames);
+}
+
+void gainfade_2x2(const int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
+    gainfade_2x2_ref(src, dst, win, gain0, gain1, numFrames);
+}
+
+void gainDitherToInt16(const float* src, const float* gain, const float* dither, int16_t* dst,
+                       int numFrames, int numChannels) {
+    gainDitherToInt16_ref(src, gain, dither, dst, numFrames, numChannels);
+}
+
+bool isSilent(const float* src, int numSamples) {
+    return isSilent_ref(src, numSamples);
+}
+
+#endif
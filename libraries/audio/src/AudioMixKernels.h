@@ -0,0 +1,36 @@
+//
+//  AudioMixKernels.h
+//  libraries/audio/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_AudioMixKernels_h
+#define vircadia_AudioMixKernels_h
+
+#include <stdint.h>
+
+//
+// Inner loops of the mixer, vectorized for SSE2/AVX2 on x86 and NEON on ARM.
+// On x86 the AVX2 versions are selected at runtime.
+//
+
+// accumulate int16 mono into interleaved stereo float, crossfading the gain from gain0 to gain1 over win
+// the gains apply to the raw int16 values, so 1/32768 maps full-scale int16 to full-scale float
+void gainfade_1x2(const int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames);
+
+// accumulate int16 interleaved stereo into interleaved stereo float, crossfading the gain as above
+void gainfade_2x2(const int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames);
+
+// dst = round(src * gain + dither) saturated to int16, for interleaved src/dst with one gain and dither per frame
+// numChannels can be 1, 2 or 4
+void gainDitherToInt16(const float* src, const float* gain, const float* dither, int16_t* dst,
+                       int numFrames, int numChannels);
+
+// true if every sample is zero
+bool isSilent(const float* src, int numSamples);
+
+#endif // vircadia_AudioMixKernels_h
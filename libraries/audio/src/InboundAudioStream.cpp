@@ -73,6 +73,10 @@ void InboundAudioStream::reset() {
     _lastPopOutput = AudioRingBuffer::ConstIterator();
     _isStarved = true;
     _hasStarted = false;
+    _isAwaitingFEC = false;
+    _heldPackets.clear();
+    _lastParityMessage.reset();
+    _fecDecoder.reset();
     resetStats();
     // FIXME: calling cleanupCodec() seems to be the cause of the buzzsaw -- we get an assert
     // after this is called in AudioClient.  Ponder and fix...
@@ -119,15 +123,63 @@ void InboundAudioStream::perSecondCallbackForUpdatingStats() {
 }
 
 int InboundAudioStream::parseData(ReceivedMessage& message) {
+    if (message.getType() == PacketType::AudioForwardErrorCorrection) {
+        return parseFECData(message);
+    }
+
     // parse sequence number and track it
     quint16 sequence;
     message.readPrimitive(&sequence);
     SequenceNumberStats::ArrivalInfo arrivalInfo =
         _incomingSequenceNumberStats.sequenceNumberReceived(sequence, message.getSourceID());
-    QString codecInPacket = message.readString();
 
     packetReceivedUpdateTimingStats();
 
+    if (_fecGroupSize > 0) {
+        _fecDecoder.addPacket(sequence, message.getType(), message.getRawMessage() + sizeof(quint16),
+                              message.getSize() - sizeof(quint16));
+
+        if (_isAwaitingFEC) {
+            if (arrivalInfo._status == SequenceNumberStats::OnTime && (int)_heldPackets.size() < _fecGroupSize) {
+                holdPacket(message, arrivalInfo);
+                return message.getSize();
+            }
+
+            if (arrivalInfo._status == SequenceNumberStats::Recovered && sequence == _fecMissingSequence) {
+                // it wasn't lost, only late - play it ahead of the packets that were waiting on it
+                SequenceNumberStats::ArrivalInfo onTime { SequenceNumberStats::OnTime, 0 };
+                parseAudioPacket(message, onTime);
+                _heldPackets.front().arrivalInfo = onTime;
+                releaseHeldPackets();
+                return message.getPosition();
+            }
+
+            // another loss or waited too long for the parity, carry on without the missing packet
+            releaseHeldPackets();
+
+        } else if (arrivalInfo._status == SequenceNumberStats::Early && arrivalInfo._seqDiffFromExpected == 1) {
+            // a single packet is missing, wait for the parity of its group to rebuild it rather than
+            // filling it in right away
+            _isAwaitingFEC = true;
+            _fecMissingSequence = sequence - 1;
+            holdPacket(message, arrivalInfo);
+
+            // if the missing packet ended its group, the parity came in before we knew it was missing
+            if (_lastParityMessage) {
+                auto lastParityMessage = std::move(_lastParityMessage);
+                parseFECData(*lastParityMessage);
+            }
+            return message.getSize();
+        }
+    }
+
+    parseAudioPacket(message, arrivalInfo);
+    return message.getPosition();
+}
+
+void InboundAudioStream::parseAudioPacket(ReceivedMessage& message, SequenceNumberStats::ArrivalInfo arrivalInfo) {
+    QString codecInPacket = message.readString();
+
     int networkFrames;
 
     // parse the info after the seq number and before the audio data (the stream properties)
@@ -227,8 +279,77 @@ int InboundAudioStream::parseData(ReceivedMessage& message) {
     }
 
     framesAvailableChanged();
+}
 
-    return message.getPosition();
+void InboundAudioStream::holdPacket(ReceivedMessage& message, SequenceNumberStats::ArrivalInfo arrivalInfo) {
+    HeldPacket held;
+    held.message.reset(new ReceivedMessage(message.getMessage(), message.getType(), message.getVersion(),
+                                           message.getSenderSockAddr(), message.getSourceID()));
+    held.message->seek(sizeof(quint16));
+    held.arrivalInfo = arrivalInfo;
+    _heldPackets.push_back(std::move(held));
+}
+
+void InboundAudioStream::releaseHeldPackets() {
+    _isAwaitingFEC = false;
+
+    for (auto& held : _heldPackets) {
+        parseAudioPacket(*held.message, held.arrivalInfo);
+    }
+    _heldPackets.clear();
+}
+
+int InboundAudioStream::parseFECData(ReceivedMessage& message) {
+    if (!_isAwaitingFEC) {
+        // nothing is missing yet, but keep it in case the packet right before it turns out to be
+        _lastParityMessage.reset(new ReceivedMessage(message.getMessage(), message.getType(), message.getVersion(),
+                                                     message.getSenderSockAddr(), message.getSourceID()));
+        return message.getSize();
+    }
+
+    quint16 sequence;
+    PacketType type;
+    QByteArray afterSequence;
+    bool isAudioType = false;
+
+    if (_fecDecoder.recover(message, sequence, type, afterSequence) && sequence == _fecMissingSequence) {
+        isAudioType = type == PacketType::MixedAudio || type == PacketType::SilentAudioFrame
+            || type == PacketType::MicrophoneAudioNoEcho || type == PacketType::MicrophoneAudioWithEcho;
+    }
+
+    if (isAudioType) {
+        QByteArray rebuilt(reinterpret_cast<const char*>(&sequence), sizeof(quint16));
+        rebuilt.append(afterSequence);
+
+        ReceivedMessage recovered(rebuilt, type, versionForPacketType(type), message.getSenderSockAddr(),
+                                  message.getSourceID());
+        recovered.seek(sizeof(quint16));
+
+        SequenceNumberStats::ArrivalInfo onTime { SequenceNumberStats::OnTime, 0 };
+        parseAudioPacket(recovered, onTime);
+        ++_fecRecoveredCount;
+
+        // the packet that found the gap is now on time
+        _heldPackets.front().arrivalInfo = onTime;
+        releaseHeldPackets();
+    } else {
+        quint16 lastSequence;
+        if (!AudioFECDecoder::peekLastSequence(message, lastSequence) || (qint16)(lastSequence - _fecMissingSequence) >= 0) {
+            // this was the missing packet's group and it can't be rebuilt, or that group's parity was lost too
+            releaseHeldPackets();
+        }
+    }
+
+    return message.getSize();
+}
+
+void InboundAudioStream::setupFEC(int groupSize) {
+    if (_isAwaitingFEC) {
+        releaseHeldPackets();
+    }
+    _fecGroupSize = std::max(0, std::min(groupSize, AudioFEC::MAX_GROUP_SIZE));
+    _lastParityMessage.reset();
+    _fecDecoder.reset();
 }
 
 int InboundAudioStream::parseStreamProperties(PacketType type, const QByteArray& packetAfterSeqNum, int& numAudioSamples) {
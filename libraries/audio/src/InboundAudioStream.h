@@ -12,6 +12,9 @@
 #ifndef hifi_InboundAudioStream_h
 #define hifi_InboundAudioStream_h
 
+#include <memory>
+#include <vector>
+
 #include <Node.h>
 #include <NodeData.h>
 #include <NumericalConstants.h>
@@ -21,6 +24,7 @@
 
 #include <plugins/CodecPlugin.h>
 
+#include "AudioFEC.h"
 #include "AudioRingBuffer.h"
 #include "MovingMinMaxAvg.h"
 #include "SequenceNumberStats.h"
@@ -105,6 +109,11 @@ public:
     void setupCodec(CodecPluginPointer codec, const QString& codecName, int numChannels);
     void cleanupCodec();
 
+    /// rebuilds lost packets from the AudioForwardErrorCorrection packets sent with groups of groupSize packets,
+    /// 0 turns it off
+    void setupFEC(int groupSize);
+    int getFECRecoveredCount() const { return _fecRecoveredCount; }
+
 signals:
     void mismatchedAudioCodec(SharedNodePointer sendingNode, const QString& currentCodec, const QString& recievedCodec);
 
@@ -117,6 +126,13 @@ public slots:
 private:
     void packetReceivedUpdateTimingStats();
 
+    // everything after the sequence number, once the packet's arrival has been tracked
+    void parseAudioPacket(ReceivedMessage& message, SequenceNumberStats::ArrivalInfo arrivalInfo);
+
+    int parseFECData(ReceivedMessage& message);
+    void holdPacket(ReceivedMessage& message, SequenceNumberStats::ArrivalInfo arrivalInfo);
+    void releaseHeldPackets();
+
     void popSamplesNoCheck(int samples);
     void framesAvailableChanged();
 
@@ -190,6 +206,21 @@ protected:
     QMutex _decoderMutex;
     Decoder* _decoder { nullptr };
     int _mismatchedAudioCodecCount { 0 };
+
+    // FEC - while a lost packet may still be rebuilt, the packets after it wait here so that they reach the decoder
+    // in order
+    struct HeldPacket {
+        std::unique_ptr<ReceivedMessage> message;
+        SequenceNumberStats::ArrivalInfo arrivalInfo;
+    };
+
+    int _fecGroupSize { 0 };
+    AudioFECDecoder _fecDecoder;
+    bool _isAwaitingFEC { false };
+    quint16 _fecMissingSequence { 0 };
+    std::vector<HeldPacket> _heldPackets;
+    std::unique_ptr<ReceivedMessage> _lastParityMessage;
+    int _fecRecoveredCount { 0 };
 };
 
 float calculateRepeatedFrameFadeFactor(int indexOfRepeat);
@@ -10,6 +10,9 @@
 //
 
 #include "MixedProcessedAudioStream.h"
+
+#include <cstring>
+
 #include "AudioLogging.h"
 #include "TryLocker.h"
 
@@ -25,6 +28,21 @@ void MixedProcessedAudioStream::outputFormatChanged(int sampleRate, int channelC
     _ringBuffer.resizeForFrameSize(deviceOutputFrameSamples);
 }
 
+int MixedProcessedAudioStream::parseStreamProperties(PacketType type, const QByteArray& packetAfterSeqNum,
+                                                     int& numAudioSamples) {
+    if (type == PacketType::MixedAudioWithSources && packetAfterSeqNum.size() >= (int)sizeof(quint16)) {
+        // the mix is sized so that the offloaded sources can follow it
+        quint16 encodedMixSize = 0;
+        memcpy(&encodedMixSize, packetAfterSeqNum.constData(), sizeof(quint16));
+        _encodedMixSize = encodedMixSize;
+        numAudioSamples = AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL;
+        return sizeof(quint16);
+    }
+
+    _encodedMixSize = -1;
+    return InboundAudioStream::parseStreamProperties(type, packetAfterSeqNum, numAudioSamples);
+}
+
 int MixedProcessedAudioStream::writeDroppableSilentFrames(int silentFrames) {
     int deviceSilentFrames = networkToDeviceFrames(silentFrames);
     int deviceSilentFramesWritten = InboundAudioStream::writeDroppableSilentFrames(deviceSilentFrames);
@@ -69,10 +87,22 @@ int MixedProcessedAudioStream::parseAudioData(const QByteArray& packetAfterStrea
     // thread which, while high performance, is not as sensitive to
     // delays as the real-time thread.
     QMutexLocker lock(&_decoderMutex);
+
+    QByteArray encodedMix = packetAfterStreamProperties;
+    QByteArray offloadedSources;
+    if (_encodedMixSize >= 0 && _encodedMixSize <= packetAfterStreamProperties.size()) {
+        encodedMix = packetAfterStreamProperties.left(_encodedMixSize);
+        offloadedSources = packetAfterStreamProperties.mid(_encodedMixSize);
+    }
+
     if (_decoder) {
-        _decoder->decode(packetAfterStreamProperties, decodedBuffer);
+        _decoder->decode(encodedMix, decodedBuffer);
     } else {
-        decodedBuffer = packetAfterStreamProperties;
+        decodedBuffer = encodedMix;
+    }
+
+    if (!offloadedSources.isEmpty()) {
+        emit processOffloadedSources(offloadedSources, decodedBuffer);
     }
 
     emit addedStereoSamples(decodedBuffer);
@@ -29,10 +29,14 @@ signals:
 
     void processSamples(const QByteArray& inputBuffer, QByteArray& outputBuffer);
 
+    // the sources the mixer left out of the mix for the listener to spatialize, to be added to the decoded mix
+    void processOffloadedSources(const QByteArray& offloadedSources, QByteArray& decodedBuffer);
+
 public:
     void outputFormatChanged(int sampleRate, int channelCount);
 
 protected:
+    int parseStreamProperties(PacketType type, const QByteArray& packetAfterSeqNum, int& numAudioSamples) override;
     int writeDroppableSilentFrames(int silentFrames) override;
     int parseAudioData(const QByteArray& packetAfterStreamProperties) override;
     int lostAudioData(int numPackets) override;
@@ -44,6 +48,7 @@ private:
 private:
     quint64 _outputSampleRate;
     quint64 _outputChannelCount;
+    int _encodedMixSize { -1 }; // when the packet also carries offloaded sources
 };
 
 #endif // hifi_MixedProcessedAudioStream_h
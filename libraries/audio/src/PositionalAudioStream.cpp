@@ -73,6 +73,11 @@ void PositionalAudioStream::updateLastPopOutputLoudnessAndTrailingLoudness() {
     }
 }
 
+void PositionalAudioStream::copyLastPopOutput() {
+    AudioRingBuffer::ConstIterator lastPopOutput = _lastPopOutput;
+    lastPopOutput.readSamples(_lastPopFrame, _ringBuffer.getNumFrameSamples());
+}
+
 int PositionalAudioStream::parsePositionalData(const QByteArray& positionalByteArray) {
     QDataStream packetStream(positionalByteArray);
 
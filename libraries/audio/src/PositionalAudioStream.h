@@ -12,6 +12,8 @@
 #ifndef hifi_PositionalAudioStream_h
 #define hifi_PositionalAudioStream_h
 
+#include <vector>
+
 #include <glm/gtx/quaternion.hpp>
 #include <AABox.h>
 
@@ -59,6 +61,11 @@ public:
     float getLastPopOutputLoudness() const { return _lastPopOutputLoudness; }
     float getQuietestFrameLoudness() const { return _quietestFrameLoudness; }
 
+    // copies the frame that was just popped out of the ring buffer, so that the mixer unwraps it once per frame
+    // instead of once per listener
+    void copyLastPopOutput();
+    const int16_t* getLastPopFrame() const { return _lastPopFrame; }
+
     bool shouldLoopbackForNode() const { return _shouldLoopbackForNode; }
     bool isStereo() const { return _isStereo; }
 
@@ -79,6 +86,11 @@ public:
     bool isIgnoreBoxEnabled() const { return _isIgnoreBoxEnabled; }
     const IgnoreBox& getIgnoreBox() const { return _ignoreBox; }
 
+    // the indices of the audio mixer's zones that contain the stream
+    // set from single AudioMixerSlave while processing packets for node, read by AudioMixerSlave(s) while mixing
+    std::vector<int>& editAudioZones() { return _audioZones; }
+    const std::vector<int>& getAudioZones() const { return _audioZones; }
+
 protected:
     // disallow copying of PositionalAudioStream objects
     PositionalAudioStream(const PositionalAudioStream&);
@@ -107,8 +119,12 @@ protected:
     float _quietestFrameLoudness;
     int _frameCounter;
 
+    int16_t _lastPopFrame[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO] {};
+
     bool _isIgnoreBoxEnabled { false };
     IgnoreBox _ignoreBox;
+
+    std::vector<int> _audioZones;
 };
 
 #endif // hifi_PositionalAudioStream_h
@@ -12,12 +12,16 @@
 #include "Sound.h"
 
 #include <stdint.h>
+#include <memory>
+#include <vector>
 
 #include <glm/glm.hpp>
 
 #include <QRunnable>
 #include <QThreadPool>
+#include <QCryptographicHash>
 #include <QDataStream>
+#include <QFile>
 #include <QtCore/QDebug>
 #include <QtNetwork/QNetworkRequest>
 #include <QtNetwork/QNetworkReply>
@@ -30,6 +34,7 @@
 #include "AudioRingBuffer.h"
 #include "AudioLogging.h"
 #include "AudioSRC.h"
+#include "SoundCache.h"
 
 #include "flump3dec.h"
 
@@ -37,6 +42,15 @@ int audioDataPointerMetaTypeID = qRegisterMetaType<AudioDataPointer>("AudioDataP
 
 using AudioConstants::AudioSample;
 
+// Decoded sounds are cached as this header followed by the samples. The version is part of the cache key, so changing
+// the format or the decoding just misses the old files, which age out of the cache.
+static const uint32_t DECODED_SOUND_VERSION = 1;
+struct DecodedSoundHeader {
+    uint32_t version;
+    uint32_t numChannels;
+    uint32_t numSamples;
+};
+
 AudioDataPointer AudioData::make(uint32_t numSamples, uint32_t numChannels,
                                  const AudioSample* samples) {
     // Compute the amount of memory required for the audio data object
@@ -121,32 +135,47 @@ void SoundProcessor::run() {
     static const QString STEREO_RAW_EXTENSION = ".stereo.raw";
     QString fileType;
 
-    QByteArray outputAudioByteArray;
-    AudioProperties properties;
-
     if (fileName.endsWith(WAV_EXTENSION)) {
         fileType = "WAV";
-        properties = interpretAsWav(_data, outputAudioByteArray);
     } else if (fileName.endsWith(MP3_EXTENSION)) {
         fileType = "MP3";
-        properties = interpretAsMP3(_data, outputAudioByteArray);
     } else if (fileName.endsWith(STEREO_RAW_EXTENSION)) {
         // check if this was a stereo raw file
         // since it's raw the only way for us to know that is if the file was called .stereo.raw
+        fileType = "stereo RAW";
+    } else if (fileName.endsWith(RAW_EXTENSION)) {
+        fileType = "RAW";
+    } else {
+        qCWarning(audio) << "Unknown sound file type";
+        emit onError(300, "Failed to load sound file, reason: unknown sound file type");
+        return;
+    }
+
+    // the same file is decoded the same way wherever it was downloaded from
+    auto cacheKey = getCacheKey(fileType);
+    if (auto audioData = loadDecoded(cacheKey)) {
+        emit onSuccess(audioData);
+        return;
+    }
+
+    QByteArray outputAudioByteArray;
+    AudioProperties properties;
+
+    if (fileType == "WAV") {
+        properties = interpretAsWav(_data, outputAudioByteArray);
+    } else if (fileType == "MP3") {
+        properties = interpretAsMP3(_data, outputAudioByteArray);
+    } else if (fileType == "stereo RAW") {
         qCDebug(audio) << "Processing sound of" << _data.size() << "bytes from" << fileName << "as stereo audio file.";
         // Process as 48khz RAW file
         properties.numChannels = 2;
         properties.sampleRate = 48000;
-        outputAudioByteArray = _data;
-    } else if (fileName.endsWith(RAW_EXTENSION)) {
+        outputAudioByteArray = downSample(_data, properties);
+    } else {
         // Process as 48khz RAW file
         properties.numChannels = 1;
         properties.sampleRate = 48000;
-        outputAudioByteArray = _data;
-    } else {
-        qCWarning(audio) << "Unknown sound file type";
-        emit onError(300, "Failed to load sound file, reason: unknown sound file type");
-        return;
+        outputAudioByteArray = downSample(_data, properties);
     }
 
     if (properties.sampleRate == 0) {
@@ -155,14 +184,68 @@ void SoundProcessor::run() {
         return;
     }
 
-    auto data = downSample(outputAudioByteArray, properties);
-
-    int numSamples = data.size() / AudioConstants::SAMPLE_SIZE;
+    int numSamples = outputAudioByteArray.size() / AudioConstants::SAMPLE_SIZE;
     auto audioData = AudioData::make(numSamples, properties.numChannels,
-                                     (const AudioSample*)data.constData());
+                                     (const AudioSample*)outputAudioByteArray.constData());
+    outputAudioByteArray.clear();
+    saveDecoded(cacheKey, audioData);
     emit onSuccess(audioData);
 }
 
+std::string SoundProcessor::getCacheKey(const QString& fileType) const {
+    QCryptographicHash hasher(QCryptographicHash::Md5);
+    hasher.addData((const char*)&DECODED_SOUND_VERSION, sizeof(DECODED_SOUND_VERSION));
+    hasher.addData(fileType.toUtf8());
+    hasher.addData(_data);
+    return hasher.result().toHex().toStdString();
+}
+
+AudioDataPointer SoundProcessor::loadDecoded(const std::string& cacheKey) const {
+    auto soundCache = DependencyManager::get<SoundCache>();
+    if (!soundCache) {
+        return AudioDataPointer();
+    }
+    auto file = soundCache->_decodedCache->getFile(cacheKey);
+    if (!file) {
+        return AudioDataPointer();
+    }
+
+    // mapped rather than read, so the samples are only copied once, into the AudioData
+    QFile cachedFile(QString::fromStdString(file->getFilepath()));
+    if (!cachedFile.open(QIODevice::ReadOnly) || cachedFile.size() < (qint64)sizeof(DecodedSoundHeader)) {
+        return AudioDataPointer();
+    }
+    auto mapped = cachedFile.map(0, cachedFile.size());
+    if (!mapped) {
+        return AudioDataPointer();
+    }
+    DecodedSoundHeader header;
+    memcpy(&header, mapped, sizeof(header));
+    AudioDataPointer audioData;
+    if (header.version == DECODED_SOUND_VERSION &&
+        cachedFile.size() == (qint64)(sizeof(header) + header.numSamples * sizeof(AudioSample))) {
+        audioData = AudioData::make(header.numSamples, header.numChannels,
+                                    (const AudioSample*)(mapped + sizeof(header)));
+    } else {
+        qCWarning(audio) << "Invalid decoded sound in cache under hash" << cacheKey.c_str() << ", decoding again...";
+    }
+    cachedFile.unmap(mapped);
+    return audioData;
+}
+
+void SoundProcessor::saveDecoded(const std::string& cacheKey, const AudioDataPointer& audioData) const {
+    auto soundCache = DependencyManager::get<SoundCache>();
+    if (!soundCache) {
+        return;
+    }
+    DecodedSoundHeader header { DECODED_SOUND_VERSION, audioData->getNumChannels(), audioData->getNumSamples() };
+    QByteArray data;
+    data.reserve(sizeof(header) + audioData->getNumBytes());
+    data.append((const char*)&header, sizeof(header));
+    data.append(audioData->rawData(), audioData->getNumBytes());
+    soundCache->_decodedCache->writeFile(data.constData(), cache::FileCache::Metadata(cacheKey, data.size()), true);
+}
+
 QByteArray SoundProcessor::downSample(const QByteArray& rawAudioByteArray,
                                       AudioProperties properties) {
 
@@ -238,7 +321,7 @@ struct WAVEFormat {
     quint16     bitsPerSample;
 };
 
-// returns wavfile sample rate, used for resampling
+// returns wavfile properties, with its audio resampled to the mixer's rate
 SoundProcessor::AudioProperties SoundProcessor::interpretAsWav(const QByteArray& inputAudioByteArray,
                                                                QByteArray& outputAudioByteArray) {
     AudioProperties properties;
@@ -320,20 +403,21 @@ SoundProcessor::AudioProperties SoundProcessor::interpretAsWav(const QByteArray&
         waveStream.skipRawData(qFromLittleEndian<quint32>(data.size));  // next chunk
     }
 
-    // Read the "data" chunk
-    quint32 outputAudioByteArraySize = qFromLittleEndian<quint32>(data.size);
-    outputAudioByteArray.resize(outputAudioByteArraySize);
-    auto bytesRead = waveStream.readRawData(outputAudioByteArray.data(), outputAudioByteArraySize);
-    if (bytesRead != (int)outputAudioByteArraySize) {
+    // Resample the "data" chunk where it is, rather than copying it out of the file first
+    quint32 dataSize = qFromLittleEndian<quint32>(data.size);
+    qint64 dataOffset = waveStream.device()->pos();
+    if (dataOffset + dataSize > (qint64)inputAudioByteArray.size()) {
         qCWarning(audio) << "Error reading WAV file";
         return AudioProperties();
     }
 
     properties.sampleRate = wave.sampleRate;
+    outputAudioByteArray = downSample(QByteArray::fromRawData(inputAudioByteArray.constData() + dataOffset, dataSize),
+                                      properties);
     return properties;
 }
 
-// returns MP3 sample rate, used for resampling
+// returns MP3 properties, with its audio resampled to the mixer's rate
 SoundProcessor::AudioProperties SoundProcessor::interpretAsMP3(const QByteArray& inputAudioByteArray,
                                                                QByteArray& outputAudioByteArray) {
     AudioProperties properties;
@@ -362,6 +446,10 @@ SoundProcessor::AudioProperties SoundProcessor::interpretAsMP3(const QByteArray&
     bs_set_data(bitstream, (uint8_t*)inputAudioByteArray.data(), inputAudioByteArray.size());
     int frameCount = 0;
 
+    // frames are resampled as they are decoded, so a long file is never held at its own rate as well as the mixer's
+    std::unique_ptr<AudioSRC> resampler;
+    std::vector<int16_t> resampled;
+
     // skip ID3 tag, if present
     Mp3TlRetcode result = mp3tl_skip_id3(decoder);
 
@@ -385,6 +473,20 @@ SoundProcessor::AudioProperties SoundProcessor::interpretAsMP3(const QByteArray&
                 properties.sampleRate = header->sample_rate;
                 properties.numChannels = header->channels;
 
+                if (properties.sampleRate != AudioConstants::SAMPLE_RATE) {
+                    resampler.reset(new AudioSRC(properties.sampleRate, AudioConstants::SAMPLE_RATE, properties.numChannels));
+                    resampled.resize(resampler->getMaxOutput(MP3_SAMPLES_MAX) * properties.numChannels);
+                }
+
+                // a guess at the decoded size from the bitrate, bounded in case the header is wrong
+                if (header->bitrate > 0) {
+                    static const qint64 MAX_DECODED_RATIO = 16;
+                    qint64 estimatedBytes = (qint64)inputAudioByteArray.size() * 8 / (header->bitrate * 1000) *
+                        AudioConstants::SAMPLE_RATE * properties.numChannels * AudioConstants::SAMPLE_SIZE;
+                    outputAudioByteArray.reserve((int)std::min(estimatedBytes,
+                                                               inputAudioByteArray.size() * MAX_DECODED_RATIO));
+                }
+
                 // skip Xing header, if present
                 result = mp3tl_skip_xing(decoder, header);
             }
@@ -401,7 +503,14 @@ SoundProcessor::AudioProperties SoundProcessor::interpretAsMP3(const QByteArray&
                 }
 
                 if (result == MP3TL_ERR_OK || result == MP3TL_ERR_BAD_FRAME) {
-                    outputAudioByteArray.append((char*)mp3Buffer, len);
+                    if (resampler) {
+                        int numFrames = resampler->render((const int16_t*)mp3Buffer, resampled.data(),
+                                                          header->frame_samples);
+                        outputAudioByteArray.append((const char*)resampled.data(),
+                                                    numFrames * properties.numChannels * sizeof(int16_t));
+                    } else {
+                        outputAudioByteArray.append((char*)mp3Buffer, len);
+                    }
                 }
             }
         }
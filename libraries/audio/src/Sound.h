@@ -105,6 +105,7 @@ public:
 
     QByteArray downSample(const QByteArray& rawAudioByteArray,
                           AudioProperties properties);
+    // These return the properties of the file, and its audio in outputAudioByteArray at the mixer's sample rate
     AudioProperties interpretAsWav(const QByteArray& inputAudioByteArray,
                                    QByteArray& outputAudioByteArray);
     AudioProperties interpretAsMP3(const QByteArray& inputAudioByteArray,
@@ -115,6 +116,10 @@ signals:
     void onError(int error, QString str);
 
 private:
+    std::string getCacheKey(const QString& fileType) const;
+    AudioDataPointer loadDecoded(const std::string& cacheKey) const;
+    void saveDecoded(const std::string& cacheKey, const AudioDataPointer& audioData) const;
+
     const QWeakPointer<Resource> _sound;
     const QByteArray _data;
 };
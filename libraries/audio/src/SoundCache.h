@@ -15,6 +15,7 @@
 #include <QtCore/QSharedPointer>
 
 #include <ResourceCache.h>
+#include <shared/FileCache.h>
 
 #include "Sound.h"
 
@@ -30,7 +31,15 @@ protected:
     QSharedPointer<Resource> createResourceCopy(const QSharedPointer<Resource>& resource) override;
 
 private:
+    friend class SoundProcessor;
+
     SoundCache(QObject* parent = NULL);
+
+    static const std::string DECODED_DIRNAME;
+    static const std::string DECODED_EXT;
+
+    // sounds decoded and resampled to the mixer's rate, keyed by a hash of the downloaded file
+    std::shared_ptr<cache::FileCache> _decodedCache { std::make_shared<cache::FileCache>(DECODED_DIRNAME, DECODED_EXT) };
 };
 
 #endif // hifi_SoundCache_h
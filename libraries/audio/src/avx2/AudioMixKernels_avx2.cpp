@@ -0,0 +1,179 @@
+//
+//  AudioMixKernels_avx2.cpp
+//  libraries/audio/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifdef __AVX2__
+
+#include <immintrin.h>
+
+#include "../AudioMixKernels.h"
+
+// the leftovers are handled with scalar code that rounds the same way as the vector conversion
+static inline int16_t floatToInt16(float x) {
+    int32_t y = _mm_cvt_ss2si(_mm_set_ss(x));
+    return (int16_t)(y < -32768 ? -32768 : (y > 32767 ? 32767 : y));
+}
+
+void gainfade_1x2_AVX2(const int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
+
+    __m256 g1 = _mm256_set1_ps(gain1);
+    __m256 gd = _mm256_set1_ps(gain0 - gain1);
+
+    int i = 0;
+    for (; i <= numFrames - 8; i += 8) {
+
+        __m256 x = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)&src[i])));
+
+        __m256 gain = _mm256_add_ps(g1, _mm256_mul_ps(_mm256_loadu_ps(&win[i]), gd));
+        x = _mm256_mul_ps(x, gain);
+
+        // duplicate into both channels, then put the frames back in order across lanes
+        __m256 lo = _mm256_unpacklo_ps(x, x);
+        __m256 hi = _mm256_unpackhi_ps(x, x);
+        __m256 y0 = _mm256_permute2f128_ps(lo, hi, 0x20);
+        __m256 y1 = _mm256_permute2f128_ps(lo, hi, 0x31);
+
+        _mm256_storeu_ps(&dst[2*i+0], _mm256_add_ps(_mm256_loadu_ps(&dst[2*i+0]), y0));
+        _mm256_storeu_ps(&dst[2*i+8], _mm256_add_ps(_mm256_loadu_ps(&dst[2*i+8]), y1));
+    }
+
+    float gainDelta = gain0 - gain1;
+    for (; i < numFrames; i++) {
+        float x0 = (float)src[i] * (gain1 + win[i] * gainDelta);
+        dst[2*i+0] += x0;
+        dst[2*i+1] += x0;
+    }
+
+    _mm256_zeroupper();
+}
+
+void gainfade_2x2_AVX2(const int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
+
+    __m256 g1 = _mm256_set1_ps(gain1);
+    __m256 gd = _mm256_set1_ps(gain0 - gain1);
+
+    int i = 0;
+    for (; i <= numFrames - 8; i += 8) {
+
+        __m256 x0 = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)&src[2*i+0])));
+        __m256 x1 = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)&src[2*i+8])));
+
+        // expand the per-frame gain to both channels
+        __m256 gain = _mm256_add_ps(g1, _mm256_mul_ps(_mm256_loadu_ps(&win[i]), gd));
+        __m256 lo = _mm256_unpacklo_ps(gain, gain);
+        __m256 hi = _mm256_unpackhi_ps(gain, gain);
+        x0 = _mm256_mul_ps(x0, _mm256_permute2f128_ps(lo, hi, 0x20));
+        x1 = _mm256_mul_ps(x1, _mm256_permute2f128_ps(lo, hi, 0x31));
+
+        _mm256_storeu_ps(&dst[2*i+0], _mm256_add_ps(_mm256_loadu_ps(&dst[2*i+0]), x0));
+        _mm256_storeu_ps(&dst[2*i+8], _mm256_add_ps(_mm256_loadu_ps(&dst[2*i+8]), x1));
+    }
+
+    float gainDelta = gain0 - gain1;
+    for (; i < numFrames; i++) {
+        float gain = gain1 + win[i] * gainDelta;
+        dst[2*i+0] += (float)src[2*i+0] * gain;
+        dst[2*i+1] += (float)src[2*i+1] * gain;
+    }
+
+    _mm256_zeroupper();
+}
+
+// round, saturate to int16 and store 16 samples
+static inline void storeInt16(int16_t* dst, __m256 x0, __m256 x1) {
+    __m256i y = _mm256_packs_epi32(_mm256_cvtps_epi32(x0), _mm256_cvtps_epi32(x1));
+    y = _mm256_permute4x64_epi64(y, 0xd8);  // packs works within lanes
+    _mm256_storeu_si256((__m256i*)dst, y);
+}
+
+// a in the low lane, b in the high lane
+static inline __m256 broadcastPair(float a, float b) {
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(a)), _mm_set1_ps(b), 1);
+}
+
+void gainDitherToInt16_AVX2(const float* src, const float* gain, const float* dither, int16_t* dst,
+                            int numFrames, int numChannels) {
+
+    int i = 0;
+    switch (numChannels) {
+    case 1:
+        for (; i <= numFrames - 16; i += 16) {
+            __m256 x0 = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i+0]), _mm256_loadu_ps(&gain[i+0])),
+                                      _mm256_loadu_ps(&dither[i+0]));
+            __m256 x1 = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i+8]), _mm256_loadu_ps(&gain[i+8])),
+                                      _mm256_loadu_ps(&dither[i+8]));
+            storeInt16(&dst[i], x0, x1);
+        }
+        break;
+
+    case 2:
+        for (; i <= numFrames - 8; i += 8) {
+            __m256 g = _mm256_loadu_ps(&gain[i]);
+            __m256 d = _mm256_loadu_ps(&dither[i]);
+
+            __m256 glo = _mm256_unpacklo_ps(g, g);
+            __m256 ghi = _mm256_unpackhi_ps(g, g);
+            __m256 dlo = _mm256_unpacklo_ps(d, d);
+            __m256 dhi = _mm256_unpackhi_ps(d, d);
+
+            __m256 x0 = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[2*i+0]), _mm256_permute2f128_ps(glo, ghi, 0x20)),
+                                      _mm256_permute2f128_ps(dlo, dhi, 0x20));
+            __m256 x1 = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[2*i+8]), _mm256_permute2f128_ps(glo, ghi, 0x31)),
+                                      _mm256_permute2f128_ps(dlo, dhi, 0x31));
+            storeInt16(&dst[2*i], x0, x1);
+        }
+        break;
+
+    case 4:
+        for (; i <= numFrames - 4; i += 4) {
+            __m256 g0 = broadcastPair(gain[i+0], gain[i+1]);
+            __m256 g1 = broadcastPair(gain[i+2], gain[i+3]);
+            __m256 d0 = broadcastPair(dither[i+0], dither[i+1]);
+            __m256 d1 = broadcastPair(dither[i+2], dither[i+3]);
+
+            __m256 x0 = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[4*i+0]), g0), d0);
+            __m256 x1 = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[4*i+8]), g1), d1);
+            storeInt16(&dst[4*i], x0, x1);
+        }
+        break;
+    }
+
+    for (; i < numFrames; i++) {
+        for (int c = 0; c < numChannels; c++) {
+            dst[numChannels*i+c] = floatToInt16(src[numChannels*i+c] * gain[i] + dither[i]);
+        }
+    }
+
+    _mm256_zeroupper();
+}
+
+bool isSilent_AVX2(const float* src, int numSamples) {
+
+    __m256 zero = _mm256_setzero_ps();
+    bool silent = true;
+
+    int i = 0;
+    for (; i <= numSamples - 16; i += 16) {
+        __m256 nz0 = _mm256_cmp_ps(_mm256_loadu_ps(&src[i+0]), zero, _CMP_NEQ_UQ);
+        __m256 nz1 = _mm256_cmp_ps(_mm256_loadu_ps(&src[i+8]), zero, _CMP_NEQ_UQ);
+        if (_mm256_movemask_ps(_mm256_or_ps(nz0, nz1))) {
+            silent = false;
+            break;
+        }
+    }
+
+    _mm256_zeroupper();
+
+    for (; silent && i < numSamples; i++) {
+        silent = (src[i] == 0.0f);
+    }
+    return silent;
+}
+
+#endif
@@ -60,6 +60,13 @@ static const int SENSOR_TO_WORLD_SCALE_RADIX = 10;
 static const float AUDIO_LOUDNESS_SCALE = 1024.0f;
 static const float DEFAULT_AVATAR_DENSITY = 1000.0f; // density of water
 
+// joint rotation deltas are the vector part of the quaternion from the reference rotation, in 4 bits of width followed
+// by the three zigzag encoded components in that many bits each, and rounded up to whole bytes
+static const float JOINT_ROTATION_DELTA_SCALE = 16384.0f;
+static const int JOINT_ROTATION_DELTA_WIDTH_BITS = 4;
+static const int MAX_JOINT_ROTATION_DELTA_WIDTH = 12; // 5 bytes, any wider is no smaller than a SixByteQuat
+static const int MAX_JOINTS_PER_SECTION = 256; // the number of joints is sent in a byte
+
 #define ASSERT(COND)  do { if (!(COND)) { abort(); } } while(0)
 
 size_t AvatarDataPacket::maxFaceTrackerInfoSize(size_t numBlendshapeCoefficients) {
@@ -93,6 +100,11 @@ size_t AvatarDataPacket::minJointDataSize(size_t numJoints) {
     return totalSize;
 }
 
+size_t AvatarDataPacket::jointRotationDeltasSize(size_t numJoints) {
+    // sequences and the delta bits, deltas are always smaller than the rotations they replace
+    return 2 * sizeof(uint16_t) + calcBitVectorSize((int)numJoints);
+}
+
 size_t AvatarDataPacket::maxJointDefaultPoseFlagsSize(size_t numJoints) {
     const size_t bitVectorSize = calcBitVectorSize((int)numJoints);
     size_t totalSize = sizeof(uint8_t); // numJoints
@@ -104,6 +116,89 @@ size_t AvatarDataPacket::maxJointDefaultPoseFlagsSize(size_t numJoints) {
     return totalSize;
 }
 
+static glm::quat applyJointRotationDelta(const glm::quat& referenceRotation, const int32_t components[3]) {
+    glm::vec3 axis(components[0], components[1], components[2]);
+    axis /= JOINT_ROTATION_DELTA_SCALE;
+    float w = sqrtf(std::max(0.0f, 1.0f - glm::dot(axis, axis)));
+    return glm::normalize(referenceRotation * glm::normalize(glm::quat(w, axis.x, axis.y, axis.z)));
+}
+
+static int jointRotationDeltaSize(unsigned char firstByte) {
+    int width = firstByte >> (BITS_IN_BYTE - JOINT_ROTATION_DELTA_WIDTH_BITS);
+    return (JOINT_ROTATION_DELTA_WIDTH_BITS + 3 * width + BITS_IN_BYTE - 1) / BITS_IN_BYTE;
+}
+
+// returns the number of bytes packed, or 0 if the delta is too large to be worth it
+// packedRotation is what the receiver will unpack, including the quantization
+static int packJointRotationDelta(unsigned char* buffer, const glm::quat& referenceRotation, const glm::quat& rotation,
+                                  glm::quat& packedRotation) {
+    glm::quat delta = glm::inverse(referenceRotation) * rotation;
+    if (delta.w < 0.0f) {
+        delta = -delta;
+    }
+
+    const float MAX_COMPONENT = (float)((1 << (MAX_JOINT_ROTATION_DELTA_WIDTH - 1)) - 1) / JOINT_ROTATION_DELTA_SCALE;
+    glm::vec3 axis(delta.x, delta.y, delta.z);
+    if (glm::any(glm::greaterThan(glm::abs(axis), glm::vec3(MAX_COMPONENT)))) {
+        return 0;
+    }
+
+    int32_t components[3];
+    uint32_t zigzagged[3];
+    uint32_t maxZigzagged = 0;
+    for (int i = 0; i < 3; i++) {
+        components[i] = (int32_t)lroundf(axis[i] * JOINT_ROTATION_DELTA_SCALE);
+        zigzagged[i] = ((uint32_t)components[i] << 1) ^ (uint32_t)(components[i] >> 31);
+        maxZigzagged = std::max(maxZigzagged, zigzagged[i]);
+    }
+
+    int width = 0;
+    while ((maxZigzagged >> width) != 0) {
+        ++width;
+    }
+
+    uint64_t packed = (uint64_t)width;
+    for (int i = 0; i < 3; i++) {
+        packed = (packed << width) | zigzagged[i];
+    }
+
+    int numBits = JOINT_ROTATION_DELTA_WIDTH_BITS + 3 * width;
+    int numBytes = (numBits + BITS_IN_BYTE - 1) / BITS_IN_BYTE;
+    packed <<= numBytes * BITS_IN_BYTE - numBits;
+    for (int i = numBytes - 1; i >= 0; --i) {
+        buffer[i] = (unsigned char)(packed & 0xff);
+        packed >>= BITS_IN_BYTE;
+    }
+
+    packedRotation = applyJointRotationDelta(referenceRotation, components);
+    return numBytes;
+}
+
+// the size must come from jointRotationDeltaSize
+static glm::quat unpackJointRotationDelta(const unsigned char* buffer, int numBytes, const glm::quat& referenceRotation) {
+    uint64_t packed = 0;
+    for (int i = 0; i < numBytes; i++) {
+        packed = (packed << BITS_IN_BYTE) | buffer[i];
+    }
+
+    int width = buffer[0] >> (BITS_IN_BYTE - JOINT_ROTATION_DELTA_WIDTH_BITS);
+    packed >>= numBytes * BITS_IN_BYTE - (JOINT_ROTATION_DELTA_WIDTH_BITS + 3 * width);
+
+    int32_t components[3];
+    uint64_t mask = ((uint64_t)1 << width) - 1;
+    for (int i = 2; i >= 0; --i) {
+        uint32_t zigzagged = (uint32_t)(packed & mask);
+        components[i] = (int32_t)(zigzagged >> 1) ^ -(int32_t)(zigzagged & 1);
+        packed >>= width;
+    }
+    return applyJointRotationDelta(referenceRotation, components);
+}
+
+// for the joint validity and delta bits, which are packed lowest bit first
+static bool isBitSet(const unsigned char* bits, int index) {
+    return (bits[index / BITS_IN_BYTE] & (1 << (index % BITS_IN_BYTE))) != 0;
+}
+
 AvatarData::AvatarData() :
     SpatiallyNestable(NestableType::Avatar, QUuid()),
     _handPosition(0.0f),
@@ -282,6 +377,77 @@ QByteArray AvatarData::toByteArrayStateful(AvatarDataDetail dataDetail, bool dro
     return avatarByteArray;
 }
 
+AvatarDataPacket::HasFlags AvatarData::getWantedDataFlags(AvatarDataDetail dataDetail, quint64 lastSentTime,
+                                                          bool dropFaceTracking) const {
+    bool sendAll = (dataDetail == SendAllData);
+    bool sendMinimum = (dataDetail == MinimumData);
+    bool sendPALMinimum = (dataDetail == PALMinimum);
+
+    if (dataDetail == NoData) {
+        return 0;
+    }
+
+    lazyInitHeadData();
+
+    bool hasAvatarGlobalPosition = true; // always include global position
+    bool hasAvatarOrientation = false;
+    bool hasAvatarBoundingBox = false;
+    bool hasAvatarScale = false;
+    bool hasLookAtPosition = false;
+    bool hasAudioLoudness = false;
+    bool hasSensorToWorldMatrix = false;
+    bool hasJointData = false;
+    bool hasJointDefaultPoseFlags = false;
+    bool hasAdditionalFlags = false;
+
+    // local position, and parent info only apply to avatars that are parented. The local position
+    // and the parent info can change independently though, so we track their "changed since"
+    // separately
+    bool hasParentInfo = false;
+    bool hasAvatarLocalPosition = false;
+    bool hasHandControllers = false;
+
+    bool hasFaceTrackerInfo = false;
+
+    if (sendPALMinimum) {
+        hasAudioLoudness = true;
+    } else {
+        hasAvatarOrientation = sendAll || rotationChangedSince(lastSentTime);
+        hasAvatarBoundingBox = sendAll || avatarBoundingBoxChangedSince(lastSentTime);
+        hasAvatarScale = sendAll || avatarScaleChangedSince(lastSentTime);
+        hasLookAtPosition = sendAll || lookAtPositionChangedSince(lastSentTime);
+        hasAudioLoudness = sendAll || audioLoudnessChangedSince(lastSentTime);
+        hasSensorToWorldMatrix = sendAll || sensorToWorldMatrixChangedSince(lastSentTime);
+        hasAdditionalFlags = sendAll || additionalFlagsChangedSince(lastSentTime);
+        hasParentInfo = sendAll || parentInfoChangedSince(lastSentTime);
+        hasAvatarLocalPosition = hasParent() && (sendAll ||
+            tranlationChangedSince(lastSentTime) ||
+            parentInfoChangedSince(lastSentTime));
+        hasHandControllers = _controllerLeftHandMatrixCache.isValid() || _controllerRightHandMatrixCache.isValid();
+        hasFaceTrackerInfo = !dropFaceTracking && (getHasScriptedBlendshapes() || _headData->_hasInputDrivenBlendshapes) &&
+            (sendAll || faceTrackerInfoChangedSince(lastSentTime));
+        hasJointData = !sendMinimum;
+        hasJointDefaultPoseFlags = hasJointData;
+    }
+
+    return
+        (hasAvatarGlobalPosition ? AvatarDataPacket::PACKET_HAS_AVATAR_GLOBAL_POSITION : 0)
+        | (hasAvatarBoundingBox ? AvatarDataPacket::PACKET_HAS_AVATAR_BOUNDING_BOX : 0)
+        | (hasAvatarOrientation ? AvatarDataPacket::PACKET_HAS_AVATAR_ORIENTATION : 0)
+        | (hasAvatarScale ? AvatarDataPacket::PACKET_HAS_AVATAR_SCALE : 0)
+        | (hasLookAtPosition ? AvatarDataPacket::PACKET_HAS_LOOK_AT_POSITION : 0)
+        | (hasAudioLoudness ? AvatarDataPacket::PACKET_HAS_AUDIO_LOUDNESS : 0)
+        | (hasSensorToWorldMatrix ? AvatarDataPacket::PACKET_HAS_SENSOR_TO_WORLD_MATRIX : 0)
+        | (hasAdditionalFlags ? AvatarDataPacket::PACKET_HAS_ADDITIONAL_FLAGS : 0)
+        | (hasParentInfo ? AvatarDataPacket::PACKET_HAS_PARENT_INFO : 0)
+        | (hasAvatarLocalPosition ? AvatarDataPacket::PACKET_HAS_AVATAR_LOCAL_POSITION : 0)
+        | (hasHandControllers ? AvatarDataPacket::PACKET_HAS_HAND_CONTROLLERS : 0)
+        | (hasFaceTrackerInfo ? AvatarDataPacket::PACKET_HAS_FACE_TRACKER_INFO : 0)
+        | (hasJointData ? AvatarDataPacket::PACKET_HAS_JOINT_DATA : 0)
+        | (hasJointDefaultPoseFlags ? AvatarDataPacket::PACKET_HAS_JOINT_DEFAULT_POSE_FLAGS : 0)
+        | (hasJointData ? AvatarDataPacket::PACKET_HAS_GRAB_JOINTS : 0);
+}
+
 QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSentTime,
                                    const QVector<JointData>& lastSentJointData, AvatarDataPacket::SendStatus& sendStatus,
                                    bool dropFaceTracking, bool distanceAdjust, glm::vec3 viewerPosition,
@@ -290,8 +456,6 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 
     bool cullSmallChanges = (dataDetail == CullSmallData);
     bool sendAll = (dataDetail == SendAllData);
-    bool sendMinimum = (dataDetail == MinimumData);
-    bool sendPALMinimum = (dataDetail == PALMinimum);
 
     lazyInitHeadData();
     ASSERT(maxDataSize == 0 || (size_t)maxDataSize >= AvatarDataPacket::MIN_BULK_PACKET_SIZE);
@@ -341,67 +505,11 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 
     if (sendStatus.itemFlags == 0) {
         // New avatar ...
-        bool hasAvatarGlobalPosition = true; // always include global position
-        bool hasAvatarOrientation = false;
-        bool hasAvatarBoundingBox = false;
-        bool hasAvatarScale = false;
-        bool hasLookAtPosition = false;
-        bool hasAudioLoudness = false;
-        bool hasSensorToWorldMatrix = false;
-        bool hasJointData = false;
-        bool hasJointDefaultPoseFlags = false;
-        bool hasAdditionalFlags = false;
-
-        // local position, and parent info only apply to avatars that are parented. The local position
-        // and the parent info can change independently though, so we track their "changed since"
-        // separately
-        bool hasParentInfo = false;
-        bool hasAvatarLocalPosition = false;
-        bool hasHandControllers = false;
-
-        bool hasFaceTrackerInfo = false;
-
-        if (sendPALMinimum) {
-            hasAudioLoudness = true;
-        } else {
-            hasAvatarOrientation = sendAll || rotationChangedSince(lastSentTime);
-            hasAvatarBoundingBox = sendAll || avatarBoundingBoxChangedSince(lastSentTime);
-            hasAvatarScale = sendAll || avatarScaleChangedSince(lastSentTime);
-            hasLookAtPosition = sendAll || lookAtPositionChangedSince(lastSentTime);
-            hasAudioLoudness = sendAll || audioLoudnessChangedSince(lastSentTime);
-            hasSensorToWorldMatrix = sendAll || sensorToWorldMatrixChangedSince(lastSentTime);
-            hasAdditionalFlags = sendAll || additionalFlagsChangedSince(lastSentTime);
-            hasParentInfo = sendAll || parentInfoChangedSince(lastSentTime);
-            hasAvatarLocalPosition = hasParent() && (sendAll ||
-                tranlationChangedSince(lastSentTime) ||
-                parentInfoChangedSince(lastSentTime));
-            hasHandControllers = _controllerLeftHandMatrixCache.isValid() || _controllerRightHandMatrixCache.isValid();
-            hasFaceTrackerInfo = !dropFaceTracking && (getHasScriptedBlendshapes() || _headData->_hasInputDrivenBlendshapes) &&
-                (sendAll || faceTrackerInfoChangedSince(lastSentTime));
-            hasJointData = !sendMinimum;
-            hasJointDefaultPoseFlags = hasJointData;
-        }
-
-        wantedFlags =
-            (hasAvatarGlobalPosition ? AvatarDataPacket::PACKET_HAS_AVATAR_GLOBAL_POSITION : 0)
-            | (hasAvatarBoundingBox ? AvatarDataPacket::PACKET_HAS_AVATAR_BOUNDING_BOX : 0)
-            | (hasAvatarOrientation ? AvatarDataPacket::PACKET_HAS_AVATAR_ORIENTATION : 0)
-            | (hasAvatarScale ? AvatarDataPacket::PACKET_HAS_AVATAR_SCALE : 0)
-            | (hasLookAtPosition ? AvatarDataPacket::PACKET_HAS_LOOK_AT_POSITION : 0)
-            | (hasAudioLoudness ? AvatarDataPacket::PACKET_HAS_AUDIO_LOUDNESS : 0)
-            | (hasSensorToWorldMatrix ? AvatarDataPacket::PACKET_HAS_SENSOR_TO_WORLD_MATRIX : 0)
-            | (hasAdditionalFlags ? AvatarDataPacket::PACKET_HAS_ADDITIONAL_FLAGS : 0)
-            | (hasParentInfo ? AvatarDataPacket::PACKET_HAS_PARENT_INFO : 0)
-            | (hasAvatarLocalPosition ? AvatarDataPacket::PACKET_HAS_AVATAR_LOCAL_POSITION : 0)
-            | (hasHandControllers ? AvatarDataPacket::PACKET_HAS_HAND_CONTROLLERS : 0)
-            | (hasFaceTrackerInfo ? AvatarDataPacket::PACKET_HAS_FACE_TRACKER_INFO : 0)
-            | (hasJointData ? AvatarDataPacket::PACKET_HAS_JOINT_DATA : 0)
-            | (hasJointDefaultPoseFlags ? AvatarDataPacket::PACKET_HAS_JOINT_DEFAULT_POSE_FLAGS : 0)
-            | (hasJointData ? AvatarDataPacket::PACKET_HAS_GRAB_JOINTS : 0);
-
-            sendStatus.itemFlags = wantedFlags;
-            sendStatus.rotationsSent = 0;
-            sendStatus.translationsSent = 0;
+        wantedFlags = getWantedDataFlags(dataDetail, lastSentTime, dropFaceTracking);
+
+        sendStatus.itemFlags = wantedFlags;
+        sendStatus.rotationsSent = 0;
+        sendStatus.translationsSent = 0;
     } else {  // Continuing avatar ...
         wantedFlags = sendStatus.itemFlags;
         if (wantedFlags & AvatarDataPacket::PACKET_HAS_GRAB_JOINTS) {
@@ -437,6 +545,7 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
     const size_t byteArraySize = AvatarDataPacket::MAX_CONSTANT_HEADER_SIZE + NUM_BYTES_RFC4122_UUID +
         AvatarDataPacket::maxFaceTrackerInfoSize(_headData->getBlendshapeCoefficients().size()) +
         AvatarDataPacket::maxJointDataSize(_jointData.size()) +
+        AvatarDataPacket::jointRotationDeltasSize(_jointData.size()) +
         AvatarDataPacket::maxJointDefaultPoseFlagsSize(_jointData.size()) +
         AvatarDataPacket::FAR_GRAB_JOINTS_SIZE;
 
@@ -687,8 +796,16 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
     assert(numJoints <= 255);
     const int jointBitVectorSize = calcBitVectorSize(numJoints);
 
+    // the receiver only has the joint state to apply deltas to if nothing was culled from it, or if this isn't the first
+    // section of the new state. The rest of the key sections are absolute rotations.
+    const bool isJointKey = sendStatus.rotationsSent == 0 && sendStatus.translationsSent == 0
+        && (sendAll || lastSentJointData.size() != numJoints);
+    const bool useJointRotationDeltas = sendStatus.sendJointRotationDeltas && !isJointKey;
+    const size_t jointRotationDeltasSize = sendStatus.sendJointRotationDeltas ?
+        AvatarDataPacket::jointRotationDeltasSize(numJoints) : 0;
+
     // include jointData if there is room for the most minimal section. i.e. no translations or rotations.
-    IF_AVATAR_SPACE(PACKET_HAS_JOINT_DATA, AvatarDataPacket::minJointDataSize(numJoints)) {
+    IF_AVATAR_SPACE(PACKET_HAS_JOINT_DATA, AvatarDataPacket::minJointDataSize(numJoints) + jointRotationDeltasSize) {
         // Minimum space required for another rotation joint -
         // size of joint + following translation bit-vector + translation scale:
         const ptrdiff_t minSizeForJoint = sizeof(AvatarDataPacket::SixByteQuat) + jointBitVectorSize + sizeof(float);
@@ -719,6 +836,23 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 
         destinationBuffer += jointBitVectorSize; // Move pointer past the validity bytes
 
+        unsigned char* deltaPosition = nullptr;
+        if (sendStatus.sendJointRotationDeltas) {
+            includedFlags |= AvatarDataPacket::PACKET_HAS_JOINT_ROTATION_DELTAS;
+
+            uint16_t jointReferenceSequence = isJointKey ? AvatarDataPacket::JOINT_KEY_SEQUENCE
+                                                         : sendStatus.jointReferenceSequence;
+            AVATAR_MEMCPY(sendStatus.jointSequence);
+            AVATAR_MEMCPY(jointReferenceSequence);
+
+            deltaPosition = destinationBuffer;
+            memset(deltaPosition, 0, jointBitVectorSize);
+            destinationBuffer += jointBitVectorSize;
+
+            // the continuing sections apply on top of this one
+            sendStatus.jointReferenceSequence = sendStatus.jointSequence;
+        }
+
         // sentJointDataOut and lastSentJointData might be the same vector
         if (sentJointDataOut) {
             sentJointDataOut->resize(numJoints); // Make sure the destination is resized before using it
@@ -728,6 +862,11 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 
         float minRotationDOT = (distanceAdjust && cullSmallChanges) ? getDistanceBasedMinRotationDOT(viewerPosition) : AVATAR_MIN_ROTATION_DOT;
 
+        // without deltas the rotations are back to back, so they're packed together once the section is laid out
+        unsigned char* const rotationsPosition = destinationBuffer;
+        glm::quat rotationsToPack[MAX_JOINTS_PER_SECTION];
+        int numRotationsToPack = 0;
+
         int i = sendStatus.rotationsSent;
         for (; i < numJoints; ++i) {
             const JointData& data = joints[i];
@@ -743,10 +882,24 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 #ifdef WANT_DEBUG
                         rotationSentCount++;
 #endif
-                        destinationBuffer += packOrientationQuatToSixBytes(destinationBuffer, data.rotation);
+                        glm::quat packedRotation;
+                        int deltaSize = (useJointRotationDeltas && !last.rotationIsDefaultPose) ?
+                            packJointRotationDelta(destinationBuffer, last.rotation, data.rotation, packedRotation) : 0;
+                        if (deltaSize > 0) {
+                            deltaPosition[i / BITS_IN_BYTE] |= 1 << (i % BITS_IN_BYTE);
+                            destinationBuffer += deltaSize;
+                        } else if (!useJointRotationDeltas) {
+                            rotationsToPack[numRotationsToPack++] = data.rotation;
+                            destinationBuffer += sizeof(AvatarDataPacket::SixByteQuat);
+                            packedRotation = data.rotation;
+                        } else {
+                            destinationBuffer += packOrientationQuatToSixBytes(destinationBuffer, data.rotation);
+                            packedRotation = data.rotation;
+                        }
 
                         if (sentJoints) {
-                            sentJoints[i].rotation = data.rotation;
+                            // the next deltas are from what the receiver reconstructed
+                            sentJoints[i].rotation = packedRotation;
                         }
                     }
                 }
@@ -760,6 +913,7 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 
         }
         sendStatus.rotationsSent = i;
+        packOrientationQuatsToSixBytes(rotationsPosition, rotationsToPack, numRotationsToPack);
 
         // joint translation data
         validityPosition = destinationBuffer;
@@ -777,6 +931,10 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 
         float minTranslation = (distanceAdjust && cullSmallChanges) ? getDistanceBasedMinTranslationDistance(viewerPosition) : AVATAR_MIN_TRANSLATION;
 
+        unsigned char* const translationsPosition = destinationBuffer;
+        glm::vec3 translationsToPack[MAX_JOINTS_PER_SECTION];
+        int numTranslationsToPack = 0;
+
         i = sendStatus.translationsSent;
         for (; i < numJoints; ++i) {
             const JointData& data = joints[i];
@@ -791,8 +949,8 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 #ifdef WANT_DEBUG
                         translationSentCount++;
 #endif
-                        destinationBuffer += packFloatVec3ToSignedTwoByteFixed(destinationBuffer, data.translation / maxTranslationDimension,
-                                                                               TRANSLATION_COMPRESSION_RADIX);
+                        translationsToPack[numTranslationsToPack++] = data.translation / maxTranslationDimension;
+                        destinationBuffer += sizeof(AvatarDataPacket::SixByteTrans);
 
                         if (sentJoints) {
                             sentJoints[i].translation = data.translation;
@@ -809,6 +967,8 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 
         }
         sendStatus.translationsSent = i;
+        packFloatVec3sToSignedTwoByteFixed(translationsPosition, translationsToPack, numTranslationsToPack,
+                                           TRANSLATION_COMPRESSION_RADIX);
 
         IF_AVATAR_SPACE(PACKET_HAS_GRAB_JOINTS, sizeof (AvatarDataPacket::FarGrabJoints)) {
             // the far-grab joints may range further than 3 meters, so we can't use packFloatVec3ToSignedTwoByteFixed etc
@@ -970,6 +1130,13 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
     // lazily allocate memory for HeadData in case we're not an Avatar instance
     lazyInitHeadData();
 
+    bool defersJointDecode = _defersJointDecode;
+    _defersJointDecode = false;
+    if (_pendingJointData.isPending) {
+        // this avatar's joints from an earlier segment have to go on before these
+        decodePendingJointData();
+    }
+
     AvatarDataPacket::HasFlags packetStateFlags;
 
     const unsigned char* startPosition = reinterpret_cast<const unsigned char*>(buffer.data());
@@ -997,6 +1164,7 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
     bool hasJointData             = HAS_FLAG(packetStateFlags, AvatarDataPacket::PACKET_HAS_JOINT_DATA);
     bool hasJointDefaultPoseFlags = HAS_FLAG(packetStateFlags, AvatarDataPacket::PACKET_HAS_JOINT_DEFAULT_POSE_FLAGS);
     bool hasGrabJoints            = HAS_FLAG(packetStateFlags, AvatarDataPacket::PACKET_HAS_GRAB_JOINTS);
+    bool hasJointRotationDeltas   = HAS_FLAG(packetStateFlags, AvatarDataPacket::PACKET_HAS_JOINT_ROTATION_DELTAS);
 
     quint64 now = usecTimestampNow();
 
@@ -1320,6 +1488,12 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
         _faceTrackerUpdateRate.increment();
     }
 
+    // the joint sections are only walked here, and decoded at the end of the parse or, if deferred, later
+    PendingJointData joints;
+    bool hasNewJointData = false;
+    bool updatesJointSequence = false;
+    uint16_t jointSequence = 0;
+
     if (hasJointData) {
         auto startSection = sourceBuffer;
 
@@ -1327,82 +1501,73 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
         int numJoints = *sourceBuffer++;
         const int bytesOfValidity = (int)ceil((float)numJoints / (float)BITS_IN_BYTE);
         PACKET_READ_CHECK(JointRotationValidityBits, bytesOfValidity);
-
-        int numValidJointRotations = 0;
-        QVector<bool> validRotations;
-        validRotations.resize(numJoints);
-        { // rotation validity bits
-            unsigned char validity = 0;
-            int validityBit = 0;
-            for (int i = 0; i < numJoints; i++) {
-                if (validityBit == 0) {
-                    validity = *sourceBuffer++;
-                }
-                bool valid = (bool)(validity & (1 << validityBit));
-                if (valid) {
-                    ++numValidJointRotations;
-                }
-                validRotations[i] = valid;
-                validityBit = (validityBit + 1) % BITS_IN_BYTE;
-            }
-        }
-
-        // each joint rotation is stored in 6 bytes.
-        QWriteLocker writeLock(&_jointDataLock);
-        _jointData.resize(numJoints);
-
+        joints.numJoints = numJoints;
+        joints.rotationValidity = sourceBuffer;
+        sourceBuffer += bytesOfValidity;
+
+        uint16_t jointReferenceSequence = AvatarDataPacket::JOINT_KEY_SEQUENCE;
+        if (hasJointRotationDeltas) {
+            PACKET_READ_CHECK(JointRotationDeltas, AvatarDataPacket::jointRotationDeltasSize(numJoints));
+            memcpy(&jointSequence, sourceBuffer, sizeof(uint16_t));
+            sourceBuffer += sizeof(uint16_t);
+            memcpy(&jointReferenceSequence, sourceBuffer, sizeof(uint16_t));
+            sourceBuffer += sizeof(uint16_t);
+            joints.rotationDeltas = sourceBuffer;
+            sourceBuffer += calcBitVectorSize(numJoints);
+        }
+
+        // deltas are from the joint state the sender thinks we have, if we don't then they're dropped and the joints
+        // hold until a key section comes in
+        joints.canApplyDeltas = _hasJointSequence && jointReferenceSequence == _jointSequence;
+        _hasJointSequence = false;
+
+        // each joint rotation is stored in 6 bytes, or less as a delta
         const int COMPRESSED_QUATERNION_SIZE = 6;
-        PACKET_READ_CHECK(JointRotations, numValidJointRotations * COMPRESSED_QUATERNION_SIZE);
+        joints.rotations = sourceBuffer;
+        int numValidJointRotations = 0;
         for (int i = 0; i < numJoints; i++) {
-            JointData& data = _jointData[i];
-            if (validRotations[i]) {
-                sourceBuffer += unpackOrientationQuatFromSixBytes(sourceBuffer, data.rotation);
-                _hasNewJointData = true;
-                data.rotationIsDefaultPose = false;
+            if (!isBitSet(joints.rotationValidity, i)) {
+                continue;
+            }
+            ++numValidJointRotations;
+            if (joints.rotationDeltas && isBitSet(joints.rotationDeltas, i)) {
+                PACKET_READ_CHECK(JointRotationDelta, 1);
+                int deltaSize = jointRotationDeltaSize(*sourceBuffer);
+                PACKET_READ_CHECK(JointRotationDelta, deltaSize);
+                sourceBuffer += deltaSize;
+                hasNewJointData = hasNewJointData || joints.canApplyDeltas;
+            } else {
+                PACKET_READ_CHECK(JointRotation, COMPRESSED_QUATERNION_SIZE);
+                sourceBuffer += COMPRESSED_QUATERNION_SIZE;
+                hasNewJointData = true;
             }
         }
 
-        PACKET_READ_CHECK(JointTranslationValidityBits, bytesOfValidity);
-
         // get translation validity bits -- these indicate which translations were packed
+        PACKET_READ_CHECK(JointTranslationValidityBits, bytesOfValidity);
+        joints.translationValidity = sourceBuffer;
+        sourceBuffer += bytesOfValidity;
         int numValidJointTranslations = 0;
-        QVector<bool> validTranslations;
-        validTranslations.resize(numJoints);
-        { // translation validity bits
-            unsigned char validity = 0;
-            int validityBit = 0;
-            for (int i = 0; i < numJoints; i++) {
-                if (validityBit == 0) {
-                    validity = *sourceBuffer++;
-                }
-                bool valid = (bool)(validity & (1 << validityBit));
-                if (valid) {
-                    ++numValidJointTranslations;
-                }
-                validTranslations[i] = valid;
-                validityBit = (validityBit + 1) % BITS_IN_BYTE;
+        for (int i = 0; i < numJoints; i++) {
+            if (isBitSet(joints.translationValidity, i)) {
+                ++numValidJointTranslations;
             }
-        } // 1 + bytesOfValidity bytes
+        }
 
         // read maxTranslationDimension
-        float maxTranslationDimension;
         PACKET_READ_CHECK(JointMaxTranslationDimension, sizeof(float));
-        memcpy(&maxTranslationDimension, sourceBuffer, sizeof(float));
+        memcpy(&joints.maxTranslationDimension, sourceBuffer, sizeof(float));
         sourceBuffer += sizeof(float);
 
         // each joint translation component is stored in 6 bytes.
         const int COMPRESSED_TRANSLATION_SIZE = 6;
         PACKET_READ_CHECK(JointTranslation, numValidJointTranslations * COMPRESSED_TRANSLATION_SIZE);
+        joints.translations = sourceBuffer;
+        sourceBuffer += numValidJointTranslations * COMPRESSED_TRANSLATION_SIZE;
+        hasNewJointData = hasNewJointData || numValidJointTranslations > 0;
 
-        for (int i = 0; i < numJoints; i++) {
-            JointData& data = _jointData[i];
-            if (validTranslations[i]) {
-                sourceBuffer += unpackFloatVec3FromSignedTwoByteFixed(sourceBuffer, data.translation, TRANSLATION_COMPRESSION_RADIX);
-                data.translation *= maxTranslationDimension;
-                _hasNewJointData = true;
-                data.translationIsDefaultPose = false;
-            }
-        }
+        updatesJointSequence = hasJointRotationDeltas
+            && (joints.canApplyDeltas || jointReferenceSequence == AvatarDataPacket::JOINT_KEY_SEQUENCE);
 
 #ifdef WANT_DEBUG
         if (numValidJointRotations > 15) {
@@ -1459,29 +1624,41 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
     if (hasJointDefaultPoseFlags) {
         auto startSection = sourceBuffer;
 
-        QWriteLocker writeLock(&_jointDataLock);
-
         PACKET_READ_CHECK(JointDefaultPoseFlagsNumJoints, sizeof(uint8_t));
         int numJoints = (int)*sourceBuffer++;
 
-        _jointData.resize(numJoints);
-
         size_t bitVectorSize = calcBitVectorSize(numJoints);
         PACKET_READ_CHECK(JointDefaultPoseFlagsRotationFlags, bitVectorSize);
-        sourceBuffer += readBitVector(sourceBuffer, numJoints, [&](int i, bool value) {
-            _jointData[i].rotationIsDefaultPose = value;
-        });
+        joints.rotationDefaultPoseFlags = sourceBuffer;
+        sourceBuffer += bitVectorSize;
 
         PACKET_READ_CHECK(JointDefaultPoseFlagsTranslationFlags, bitVectorSize);
-        sourceBuffer += readBitVector(sourceBuffer, numJoints, [&](int i, bool value) {
-            _jointData[i].translationIsDefaultPose = value;
-        });
+        joints.translationDefaultPoseFlags = sourceBuffer;
+        sourceBuffer += bitVectorSize;
+        joints.numDefaultPoseJoints = numJoints;
 
         int numBytesRead = sourceBuffer - startSection;
         _jointDefaultPoseFlagsRate.increment(numBytesRead);
         _jointDefaultPoseFlagsUpdateRate.increment();
     }
 
+    if (hasJointData || hasJointDefaultPoseFlags) {
+        if (hasNewJointData) {
+            _hasNewJointData = true;
+        }
+        if (updatesJointSequence) {
+            _jointSequence = jointSequence;
+            _hasJointSequence = true;
+        }
+        if (defersJointDecode) {
+            joints.isPending = true;
+            _pendingJointData = joints;
+        } else {
+            QWriteLocker writeLock(&_jointDataLock);
+            decodeJointData(joints, _jointData);
+        }
+    }
+
     int numBytesRead = sourceBuffer - startPosition;
     _averageBytesReceived.updateAverage(numBytesRead);
 
@@ -1491,6 +1668,104 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
     return numBytesRead;
 }
 
+// the sections were bounds checked by parseDataFromBuffer
+void AvatarData::decodeJointData(const PendingJointData& pending, QVector<JointData>& jointData) {
+    if (pending.rotationValidity) {
+        int numJoints = pending.numJoints;
+        jointData.resize(numJoints);
+
+        const unsigned char* sourceBuffer = pending.rotations;
+        if (!pending.rotationDeltas) {
+            // a key section's rotations are back to back, so they're unpacked together
+            glm::quat rotations[MAX_JOINTS_PER_SECTION];
+            int numValidJointRotations = 0;
+            for (int i = 0; i < numJoints; i++) {
+                if (isBitSet(pending.rotationValidity, i)) {
+                    ++numValidJointRotations;
+                }
+            }
+            unpackOrientationQuatsFromSixBytes(sourceBuffer, rotations, numValidJointRotations);
+
+            int rotationIndex = 0;
+            for (int i = 0; i < numJoints; i++) {
+                if (isBitSet(pending.rotationValidity, i)) {
+                    JointData& data = jointData[i];
+                    data.rotation = rotations[rotationIndex++];
+                    data.rotationIsDefaultPose = false;
+                }
+            }
+        } else {
+            for (int i = 0; i < numJoints; i++) {
+                if (!isBitSet(pending.rotationValidity, i)) {
+                    continue;
+                }
+                JointData& data = jointData[i];
+                if (isBitSet(pending.rotationDeltas, i)) {
+                    int deltaSize = jointRotationDeltaSize(*sourceBuffer);
+                    if (pending.canApplyDeltas) {
+                        data.rotation = unpackJointRotationDelta(sourceBuffer, deltaSize, data.rotation);
+                        data.rotationIsDefaultPose = false;
+                    }
+                    sourceBuffer += deltaSize;
+                } else {
+                    sourceBuffer += unpackOrientationQuatFromSixBytes(sourceBuffer, data.rotation);
+                    data.rotationIsDefaultPose = false;
+                }
+            }
+        }
+
+        // the translations are always back to back
+        glm::vec3 translations[MAX_JOINTS_PER_SECTION];
+        int numValidJointTranslations = 0;
+        for (int i = 0; i < numJoints; i++) {
+            if (isBitSet(pending.translationValidity, i)) {
+                ++numValidJointTranslations;
+            }
+        }
+        unpackFloatVec3sFromSignedTwoByteFixed(pending.translations, translations, numValidJointTranslations,
+                                               TRANSLATION_COMPRESSION_RADIX);
+
+        int translationIndex = 0;
+        for (int i = 0; i < numJoints; i++) {
+            if (isBitSet(pending.translationValidity, i)) {
+                JointData& data = jointData[i];
+                data.translation = translations[translationIndex++] * pending.maxTranslationDimension;
+                data.translationIsDefaultPose = false;
+            }
+        }
+    }
+
+    if (pending.numDefaultPoseJoints >= 0) {
+        int numJoints = pending.numDefaultPoseJoints;
+        jointData.resize(numJoints);
+        readBitVector(pending.rotationDefaultPoseFlags, numJoints, [&](int i, bool value) {
+            jointData[i].rotationIsDefaultPose = value;
+        });
+        readBitVector(pending.translationDefaultPoseFlags, numJoints, [&](int i, bool value) {
+            jointData[i].translationIsDefaultPose = value;
+        });
+    }
+}
+
+void AvatarData::decodePendingJointData() {
+    if (!_pendingJointData.isPending) {
+        return;
+    }
+
+    // decode into a copy so that readers of the joints only wait on the swap
+    QVector<JointData> jointData;
+    {
+        QReadLocker readLock(&_jointDataLock);
+        jointData = _jointData;
+    }
+    decodeJointData(_pendingJointData, jointData);
+    {
+        QWriteLocker writeLock(&_jointDataLock);
+        _jointData.swap(jointData);
+    }
+    _pendingJointData = PendingJointData();
+}
+
 /*@jsdoc
  * <p>The avatar mixer data comprises different types of data, with the data rates of each being tracked in kbps.</p>
  *
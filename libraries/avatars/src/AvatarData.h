@@ -206,6 +206,7 @@ namespace AvatarDataPacket {
     const HasFlags PACKET_HAS_JOINT_DATA               = 1U << 12;
     const HasFlags PACKET_HAS_JOINT_DEFAULT_POSE_FLAGS = 1U << 13;
     const HasFlags PACKET_HAS_GRAB_JOINTS              = 1U << 14;
+    const HasFlags PACKET_HAS_JOINT_ROTATION_DELTAS    = 1U << 15; // the JointData section has the delta fields
     const size_t AVATAR_HAS_FLAGS_SIZE = 2;
 
     using SixByteQuat = uint8_t[6];
@@ -341,7 +342,12 @@ namespace AvatarDataPacket {
     struct JointData {
         uint8_t numJoints;
         uint8_t rotationValidityBits[ceil(numJoints / 8)];     // one bit per joint, if true then a compressed rotation follows.
-        SixByteQuat rotation[numValidRotations];               // encodeded and compressed by packOrientationQuatToSixBytes()
+        // only present if PACKET_HAS_JOINT_ROTATION_DELTAS is set
+        uint16_t jointSequence;                                // the joint state after this section
+        uint16_t jointReferenceSequence;                       // the joint state the deltas apply to, or JOINT_KEY_SEQUENCE
+        uint8_t rotationDeltaBits[ceil(numJoints / 8)];        // one bit per valid rotation, if true then it's a delta
+        SixByteQuat rotation[numValidRotations];               // encodeded and compressed by packOrientationQuatToSixBytes(),
+                                                               // or a 1 to 5 byte delta from the reference rotation
         uint8_t translationValidityBits[ceil(numJoints / 8)];  // one bit per joint, if true then a compressed translation follows.
         float maxTranslationDimension;                         // used to normalize fixed point translation values.
         SixByteTrans translation[numValidTranslations];        // normalized and compressed by packFloatVec3ToSignedTwoByteFixed()
@@ -353,6 +359,10 @@ namespace AvatarDataPacket {
     */
     size_t maxJointDataSize(size_t numJoints);
     size_t minJointDataSize(size_t numJoints);
+    size_t jointRotationDeltasSize(size_t numJoints);
+
+    // a JointData section with this reference sequence carries the whole joint state, and no deltas
+    const uint16_t JOINT_KEY_SEQUENCE = 0xFFFF;
 
     /*
     struct JointDefaultPoseFlags {
@@ -385,6 +395,13 @@ namespace AvatarDataPacket {
         bool sendUUID { false };
         int rotationsSent { 0 };  // ie: index of next unsent joint
         int translationsSent { 0 };
+
+        // send the joint rotations that changed a little as deltas from lastSentJointData, which the receiver has if
+        // the last joint state it got was jointReferenceSequence. Updated to jointSequence once the joints are sent.
+        bool sendJointRotationDeltas { false };
+        uint16_t jointSequence { 0 };
+        uint16_t jointReferenceSequence { JOINT_KEY_SEQUENCE };
+
         operator bool() { return itemFlags == 0; }
     };
 }
@@ -628,6 +645,10 @@ public:
         AvatarDataPacket::SendStatus& sendStatus, bool dropFaceTracking, bool distanceAdjust, glm::vec3 viewerPosition,
         QVector<JointData>* sentJointDataOut, int maxDataSize = 0, AvatarDataRate* outboundDataRateOut = nullptr) const;
 
+    // the sections toByteArray includes for a new avatar, which only depend on the receiver through lastSentTime
+    AvatarDataPacket::HasFlags getWantedDataFlags(AvatarDataDetail dataDetail, quint64 lastSentTime,
+                                                  bool dropFaceTracking) const;
+
     virtual void doneEncoding(bool cullSmallChanges);
 
     /// \return true if an error should be logged
@@ -638,6 +659,15 @@ public:
     /// \return number of bytes parsed
     virtual int parseDataFromBuffer(const QByteArray& buffer);
 
+    /// Has the next parseDataFromBuffer leave the joint rotations and translations in the buffer, to be decoded by
+    /// decodePendingJointData off the thread that parsed the packet. The buffer must outlive the decode.
+    void deferNextJointDecode() { _defersJointDecode = true; }
+    bool hasPendingJointData() const { return _pendingJointData.isPending; }
+
+    /// Decodes the joints left by parseDataFromBuffer into a copy of the joint data and swaps it in; safe to call for
+    /// different avatars in parallel.
+    void decodePendingJointData();
+
     virtual void setCollisionWithOtherAvatarsFlags() {};
 
     // Body Rotation (degrees)
@@ -1730,6 +1760,30 @@ protected:
 
     bool _hasNewJointData { true }; // set in AvatarData, cleared in Avatar
 
+    // the sequence of the received joint state, joint rotation deltas only apply on top of it
+    uint16_t _jointSequence { 0 };
+    bool _hasJointSequence { false };
+
+    // where the joint data sections of a parsed packet are, with what's needed to decode them
+    struct PendingJointData {
+        bool isPending { false };
+        int numJoints { 0 };
+        const unsigned char* rotationValidity { nullptr };
+        const unsigned char* rotationDeltas { nullptr };  // null if there are no deltas
+        const unsigned char* rotations { nullptr };
+        bool canApplyDeltas { false };
+        const unsigned char* translationValidity { nullptr };
+        float maxTranslationDimension { 0.0f };
+        const unsigned char* translations { nullptr };
+        int numDefaultPoseJoints { -1 };  // -1 if there are no default pose flags
+        const unsigned char* rotationDefaultPoseFlags { nullptr };
+        const unsigned char* translationDefaultPoseFlags { nullptr };
+    };
+    static void decodeJointData(const PendingJointData& pending, QVector<JointData>& jointData);
+
+    bool _defersJointDecode { false };
+    PendingJointData _pendingJointData;
+
     mutable HeadData* _headData { nullptr };
 
     QUrl _skeletonModelURL;
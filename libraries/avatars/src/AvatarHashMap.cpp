@@ -11,8 +11,12 @@
 
 #include "AvatarHashMap.h"
 
+#include <algorithm>
+
 #include <QtCore/QDataStream>
 
+#include <tbb/parallel_for.h>
+
 #include <NodeList.h>
 #include <udt/PacketHeaders.h>
 #include <PerfStat.h>
@@ -247,12 +251,33 @@ void AvatarHashMap::processAvatarDataPacket(QSharedPointer<ReceivedMessage> mess
     PerformanceTimer perfTimer("receiveAvatar");
     // enumerate over all of the avatars in this packet
     // only add them if mixerWeakPointer points to something (meaning that mixer is still around)
+    // their joints, which are most of the work, are left in the packet and decoded across threads once it's been split up
+    std::vector<AvatarSharedPointer> pendingJointAvatars;
     while (message->getBytesLeftToRead()) {
-        parseAvatarData(message, sendingNode);
+        auto avatar = parseAvatarData(message, sendingNode, true);
+        if (avatar->hasPendingJointData()) {
+            pendingJointAvatars.push_back(avatar);
+        }
+    }
+
+    // an avatar sent twice has had its first joints decoded already, and must only be decoded by one thread
+    std::sort(pendingJointAvatars.begin(), pendingJointAvatars.end());
+    pendingJointAvatars.erase(std::unique(pendingJointAvatars.begin(), pendingJointAvatars.end()), pendingJointAvatars.end());
+
+    const size_t MIN_AVATARS_FOR_PARALLEL_DECODE = 4;
+    if (pendingJointAvatars.size() >= MIN_AVATARS_FOR_PARALLEL_DECODE) {
+        tbb::parallel_for(size_t(0), pendingJointAvatars.size(), [&](size_t i) {
+            pendingJointAvatars[i]->decodePendingJointData();
+        });
+    } else {
+        for (auto& avatar : pendingJointAvatars) {
+            avatar->decodePendingJointData();
+        }
     }
 }
 
-AvatarSharedPointer AvatarHashMap::parseAvatarData(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode) {
+AvatarSharedPointer AvatarHashMap::parseAvatarData(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode,
+                                                   bool defersJointDecode) {
     QUuid sessionUUID = QUuid::fromRfc4122(message->readWithoutCopy(NUM_BYTES_RFC4122_UUID));
 
     int positionBeforeRead = message->getPosition();
@@ -277,6 +302,9 @@ AvatarSharedPointer AvatarHashMap::parseAvatarData(QSharedPointer<ReceivedMessag
         } 
         
         // have the matching (or new) avatar parse the data from the packet
+        if (defersJointDecode) {
+            avatar->deferNextJointDecode();
+        }
         int bytesRead = avatar->parseDataFromBuffer(byteArray);
         message->seek(positionBeforeRead + bytesRead);
         _replicas.parseDataFromBuffer(sessionUUID, byteArray);
@@ -247,6 +247,12 @@ void ModelBaker::bakeSourceCopy() {
         // Begin hfm baking
         baker.run();
 
+        QStringList stageTimes;
+        for (const auto& stageTime : baker.getStageTimes()) {
+            stageTimes << stageTime.first + " " + QString::number(stageTime.second, 'f', 1) + "ms";
+        }
+        qCDebug(model_baking) << "Baked" << _modelURL << "--" << stageTimes.join(", ");
+
         const auto& errors = baker.getDracoErrors();
         if (std::find(errors.cbegin(), errors.cend(), true) != errors.cend()) {
             handleError("Failed to finalize the baking of a draco Geometry node from model " + _modelURL.toString());
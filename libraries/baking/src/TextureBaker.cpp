@@ -12,6 +12,7 @@
 #include "TextureBaker.h"
 
 #include <QtCore/QDir>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QEventLoop>
 #include <QtCore/QFile>
 #include <QtNetwork/QNetworkReply>
@@ -129,6 +130,9 @@ void TextureBaker::handleTextureNetworkReply() {
 }
 
 void TextureBaker::processTexture() {
+    QElapsedTimer bakeTimer;
+    bakeTimer.start();
+
     // the baked textures need to have the source hash added for cache checks in Interface
     // so we add that to the processed texture before handling it off to be serialized
     QCryptographicHash hasher(QCryptographicHash::Md5);
@@ -168,6 +172,8 @@ void TextureBaker::processTexture() {
             gpu::BackendTarget::GLES32
         }};
         for (auto target : BACKEND_TARGETS) {
+            QElapsedTimer compressionTimer;
+            compressionTimer.start();
             auto processedTextureAndSize = image::processImage(buffer, _textureURL.toString().toStdString(), image::ColorChannel::NONE,
                                                                ABSOLUTE_MAX_TEXTURE_NUM_PIXELS, _textureType, true,
                                                                target, _abortProcessing);
@@ -192,6 +198,7 @@ void TextureBaker::processTexture() {
                 handleError("Could not determine internal format for compressed KTX: " + _textureURL.toString());
                 return;
             }
+            qCDebug(model_baking) << "Compressed" << _textureURL << "to" << name << "in" << compressionTimer.elapsed() << "ms";
 
             const char* data = reinterpret_cast<const char*>(memKTX->_storage->data());
             const size_t length = memKTX->_storage->size();
@@ -257,7 +264,7 @@ void TextureBaker::processTexture() {
         }
     }
 
-    qCDebug(model_baking) << "Baked texture" << _textureURL;
+    qCDebug(model_baking) << "Baked texture" << _textureURL << "in" << bakeTimer.elapsed() << "ms";
     setIsFinished(true);
 }
 
@@ -178,6 +178,14 @@ namespace controller {
         return inputRecorder->getSaveDirectory();
     }
 
+    void ScriptingInterface::setRouteProfilingEnabled(bool enabled) {
+        DependencyManager::get<UserInputMapper>()->setRouteProfilingEnabled(enabled);
+    }
+
+    QVariantList ScriptingInterface::getRouteCosts() {
+        return DependencyManager::get<UserInputMapper>()->getRouteCosts();
+    }
+
     QStringList ScriptingInterface::getRunningInputDeviceNames() {
         QMutexLocker locker(&_runningDevicesMutex);
         return _runningInputDeviceNames;
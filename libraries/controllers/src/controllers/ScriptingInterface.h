@@ -451,6 +451,42 @@ namespace controller {
          */
         Q_INVOKABLE QStringList getRunningInputDeviceNames();
 
+        /*@jsdoc
+         * Starts or stops timing each of the active controller routes as they are applied. Starting resets the times.
+         * @function Controller.setRouteProfilingEnabled
+         * @param {boolean} enabled - <code>true</code> to time the routes, <code>false</code> to stop.
+         */
+        Q_INVOKABLE void setRouteProfilingEnabled(bool enabled);
+
+        /*@jsdoc
+         * The time spent applying a controller route.
+         * @typedef {object} Controller.RouteCost
+         * @property {string} stage - <code>"device"</code> for a route from a device, <code>"standard"</code> for a route from
+         *     the standard controller.
+         * @property {string} route - The JSON that the route was loaded from, empty if it was made by a script.
+         * @property {number} source - The ID of the route's source input.
+         * @property {number} applied - The number of times that the route was applied.
+         * @property {number} totalUsecs - The total time spent applying the route, in microseconds.
+         * @property {number} averageUsecs - The average time spent applying the route, in microseconds.
+         */
+
+        /*@jsdoc
+         * Gets the time spent applying each of the active controller routes since
+         * {@link Controller.setRouteProfilingEnabled|setRouteProfilingEnabled} was last turned on. The times are reset when a
+         * mapping is enabled or disabled.
+         * @function Controller.getRouteCosts
+         * @returns {Controller.RouteCost[]} The routes, in the order that they are applied.
+         * @example <caption>Report the most expensive route.</caption>
+         * Controller.setRouteProfilingEnabled(true);
+         * Script.setTimeout(function () {
+         *     var costs = Controller.getRouteCosts();
+         *     costs.sort(function (a, b) { return b.totalUsecs - a.totalUsecs; });
+         *     print("Most expensive route: " + JSON.stringify(costs[0]));
+         *     Controller.setRouteProfilingEnabled(false);
+         * }, 5000);
+         */
+        Q_INVOKABLE QVariantList getRouteCosts();
+
         bool isMouseCaptured() const { return _mouseCaptured; }
         bool isTouchCaptured() const { return _touchCaptured; }
         bool isWheelCaptured() const { return _wheelCaptured; }
@@ -8,6 +8,7 @@
 
 #include "UserInputMapper.h"
 
+#include <algorithm>
 #include <set>
 
 #include <QtCore/QThread>
@@ -480,6 +481,9 @@ void UserInputMapper::runMappings() {
     if (debugRoutes) {
         qCDebug(controllers) << "Beginning mapping frame";
     }
+    if (_routesChanged) {
+        compileRoutes();
+    }
     for (const auto& endpointEntry : _endpointsByInput) {
         endpointEntry.second->reset();
     }
@@ -488,12 +492,12 @@ void UserInputMapper::runMappings() {
         qCDebug(controllers) << "Processing device routes";
     }
     // Now process the current values for each level of the stack
-    applyRoutes(_deviceRoutes);
+    applyRoutes(_deviceProgram);
 
     if (debugRoutes) {
         qCDebug(controllers) << "Processing standard routes";
     }
-    applyRoutes(_standardRoutes);
+    applyRoutes(_standardProgram);
 
     InputRecorder* inputRecorder = InputRecorder::getInstance();
     if (inputRecorder->isPlayingback()) {
@@ -516,33 +520,68 @@ void UserInputMapper::runMappings() {
     debugRoutes = false;
 }
 
-// Encapsulate the logic that routes should not be read before they are written
-void UserInputMapper::applyRoutes(const Route::List& routes) {
-    Route::List deferredRoutes;
-
-    for (const auto& route : routes) {
-        if (!route) {
-            continue;
+// The programs point into the routes held by the route lists, so they are rebuilt whenever those lists change
+void UserInputMapper::compileRoutes() {
+    auto compile = [](const Route::List& routes, RouteProgram& program) {
+        program.clear();
+        program.reserve(routes.size());
+        for (const auto& route : routes) {
+            if (!route) {
+                continue;
+            }
+            CompiledRoute compiled;
+            compiled.route = route.get();
+            compiled.filters.reserve(route->filters.size());
+            for (const auto& filter : route->filters) {
+                compiled.filters.push_back(filter.get());
+            }
+            program.push_back(std::move(compiled));
         }
+    };
+    compile(_deviceRoutes, _deviceProgram);
+    compile(_standardRoutes, _standardProgram);
+    _deferredRoutes.reserve(std::max(_deviceProgram.size(), _standardProgram.size()));
+    _routesChanged = false;
+}
 
-        // Try all the deferred routes
-        deferredRoutes.remove_if([](Route::Pointer route) {
-            return UserInputMapper::applyRoute(route);
-        });
+// Encapsulate the logic that routes should not be read before they are written
+void UserInputMapper::applyRoutes(RouteProgram& program) {
+    _deferredRoutes.clear();
+
+    for (auto& compiled : program) {
+        // Try all the deferred routes, keeping the ones that still can't be applied in order
+        size_t stillDeferred = 0;
+        for (auto deferred : _deferredRoutes) {
+            if (!applyCompiledRoute(*deferred)) {
+                _deferredRoutes[stillDeferred++] = deferred;
+            }
+        }
+        _deferredRoutes.resize(stillDeferred);
 
-        if (!applyRoute(route)) {
-            deferredRoutes.push_back(route);
+        if (!applyCompiledRoute(compiled)) {
+            _deferredRoutes.push_back(&compiled);
         }
     }
 
     bool force = true;
-    for (const auto& route : deferredRoutes) {
-        UserInputMapper::applyRoute(route, force);
+    for (auto deferred : _deferredRoutes) {
+        applyCompiledRoute(*deferred, force);
     }
 }
 
+bool UserInputMapper::applyCompiledRoute(CompiledRoute& compiled, bool force) {
+    if (!_routeProfilingEnabled) {
+        return applyRoute(compiled, force);
+    }
+    auto start = usecTimestampNow();
+    bool result = applyRoute(compiled, force);
+    compiled.totalUsecs += usecTimestampNow() - start;
+    ++compiled.applyCount;
+    return result;
+}
 
-bool UserInputMapper::applyRoute(const Route::Pointer& route, bool force) {
+bool UserInputMapper::applyRoute(const CompiledRoute& compiled, bool force) {
+    const auto route = compiled.route;
     if (debugRoutes && route->debug) {
         qCDebug(controllers) << "Applying route " << route->json;
     }
@@ -606,7 +645,7 @@ bool UserInputMapper::applyRoute(const Route::Pointer& route, bool force) {
             qCDebug(controllers) << "Value was t:" << value.translation << "r:" << value.rotation;
         }
         // Apply each of the filters.
-        for (const auto& filter : route->filters) {
+        for (auto filter : compiled.filters) {
             value = filter->apply(value);
         }
 
@@ -631,7 +670,7 @@ bool UserInputMapper::applyRoute(const Route::Pointer& route, bool force) {
             qCDebug(controllers) << "Value was " << value.value << value.timestamp;
         }
         // Apply each of the filters.
-        for (const auto& filter : route->filters) {
+        for (auto filter : compiled.filters) {
             value = filter->apply(value);
         }
 
@@ -1217,6 +1256,7 @@ void UserInputMapper::enableMapping(const Mapping::Pointer& mapping) {
         return (value->source->getInput().device == STANDARD_DEVICE);
     });
     _deviceRoutes.insert(_deviceRoutes.begin(), deviceRoutes.begin(), deviceRoutes.end());
+    _routesChanged = true;
 
     if (!debuggableRoutes) {
         debuggableRoutes = hasDebuggableRoute(_deviceRoutes) || hasDebuggableRoute(_standardRoutes);
@@ -1233,12 +1273,48 @@ void UserInputMapper::disableMapping(const Mapping::Pointer& mapping) {
     _standardRoutes.remove_if([&](const Route::Pointer& value) {
         return routeSet.count(value) != 0;
     });
+    _routesChanged = true;
 
     if (debuggableRoutes) {
         debuggableRoutes = hasDebuggableRoute(_deviceRoutes) || hasDebuggableRoute(_standardRoutes);
     }
 }
 
+void UserInputMapper::setRouteProfilingEnabled(bool enabled) {
+    Locker locker(_lock);
+    if (enabled && !_routeProfilingEnabled) {
+        for (auto program : { &_deviceProgram, &_standardProgram }) {
+            for (auto& compiled : *program) {
+                compiled.totalUsecs = 0;
+                compiled.applyCount = 0;
+            }
+        }
+    }
+    _routeProfilingEnabled = enabled;
+}
+
+QVariantList UserInputMapper::getRouteCosts() const {
+    Locker locker(_lock);
+    QVariantList result;
+    auto addProgram = [&](const RouteProgram& program, const QString& stage) {
+        for (const auto& compiled : program) {
+            QVariantMap cost;
+            cost["stage"] = stage;
+            cost["route"] = compiled.route->json;
+            if (compiled.route->source) {
+                cost["source"] = compiled.route->source->getInput().getID();
+            }
+            cost["applied"] = compiled.applyCount;
+            cost["totalUsecs"] = compiled.totalUsecs;
+            cost["averageUsecs"] = compiled.applyCount > 0 ? (double)compiled.totalUsecs / compiled.applyCount : 0.0;
+            result.push_back(cost);
+        }
+    };
+    addProgram(_deviceProgram, "device");
+    addProgram(_standardProgram, "standard");
+    return result;
+}
+
 void UserInputMapper::setActionState(Action action, float value, bool valid) {
     Locker locker(_lock);
     _actionStates[toInt(action)] = value;
@@ -16,6 +16,7 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include <QtQml/QJSValue>
 #include <QtScript/QScriptValue>
@@ -132,6 +133,11 @@ namespace controller {
 
         EndpointPointer endpointFor(const Input& endpoint) const;
 
+        // when enabled, the time spent applying each active route is accumulated, to be read with getRouteCosts()
+        void setRouteProfilingEnabled(bool enabled);
+        bool isRouteProfilingEnabled() const { return _routeProfilingEnabled; }
+        QVariantList getRouteCosts() const;
+
     signals:
         void actionEvent(int action, float state);
         void inputEvent(int input, float state);
@@ -157,10 +163,22 @@ namespace controller {
         friend class RouteBuilderProxy;
         friend class MappingBuilderProxy;
 
+        // A route as it is run each frame, with the filters it applies flattened out of the route's list. The active
+        // routes are compiled into these when a mapping is enabled or disabled, rather than walked from the lists.
+        struct CompiledRoute {
+            Route* route { nullptr };
+            std::vector<Filter*> filters;
+            quint64 totalUsecs { 0 };
+            quint64 applyCount { 0 };
+        };
+        using RouteProgram = std::vector<CompiledRoute>;
+
         void runMappings();
+        void compileRoutes();
 
-        static void applyRoutes(const RouteList& route);
-        static bool applyRoute(const RoutePointer& route, bool force = false);
+        void applyRoutes(RouteProgram& program);
+        bool applyCompiledRoute(CompiledRoute& compiled, bool force = false);
+        static bool applyRoute(const CompiledRoute& compiled, bool force = false);
         void enableMapping(const MappingPointer& mapping);
         void disableMapping(const MappingPointer& mapping);
         EndpointPointer endpointFor(const QJSValue& endpoint);
@@ -192,6 +210,12 @@ namespace controller {
         RouteList _deviceRoutes;
         RouteList _standardRoutes;
 
+        RouteProgram _deviceProgram;
+        RouteProgram _standardProgram;
+        std::vector<CompiledRoute*> _deferredRoutes;
+        bool _routesChanged { true };
+        bool _routeProfilingEnabled { false };
+
         QSet<QString> _loadedRouteJsonFiles;
 
         InputCalibrationData inputCalibrationData;
@@ -37,9 +37,13 @@
 
 static const QString MONO_PREVIEW = "Mono Preview";
 static const QString DISABLE_PREVIEW = "Disable Preview";
+static const QString FOVEATED_RENDERING = "Foveated Rendering";
 static const QString FRAMERATE = DisplayPlugin::MENU_PATH() + ">Framerate";
 static const QString DEVELOPER_MENU_PATH = "Developer>" + DisplayPlugin::MENU_PATH();
 static const bool DEFAULT_MONO_VIEW = true;
+static const bool DEFAULT_FOVEATED_RENDERING = true;
+// the lenses are sharpest within about this much of their center, in each eye's normalized device coordinates
+static const float FOVEATION_RADIUS = 0.6f;
 #if !defined(Q_OS_MAC)
 static const bool DEFAULT_DISABLE_PREVIEW = false;
 #endif
@@ -64,6 +68,16 @@ glm::mat4 HmdDisplayPlugin::getEyeProjection(Eye eye, const glm::mat4& baseProje
     return _eyeProjections[eye]; 
 }
 
+float HmdDisplayPlugin::getFoveationRadius() const {
+    return _foveatedRendering ? FOVEATION_RADIUS : 0.0f;
+}
+
+glm::vec2 HmdDisplayPlugin::getFoveationCenter(Eye eye) const {
+    // where the projection puts the eye's forward axis, the center of its lens
+    const glm::mat4& projection = _eyeProjections[eye];
+    return glm::vec2(-projection[2][0], -projection[2][1]);
+}
+
 glm::mat4 HmdDisplayPlugin::getCullingProjection(const glm::mat4& baseProjection) const { 
     return _cullingProjection; 
 }
@@ -89,6 +103,13 @@ bool HmdDisplayPlugin::internalActivate() {
         _container->setBoolSetting("monoPreview", _monoPreview);
     }, true, _monoPreview);
 
+    _foveatedRendering = _container->getBoolSetting("foveatedRendering", DEFAULT_FOVEATED_RENDERING);
+    _container->addMenuItem(PluginType::DISPLAY_PLUGIN, MENU_PATH(), FOVEATED_RENDERING,
+        [this](bool clicked) {
+        _foveatedRendering = clicked;
+        _container->setBoolSetting("foveatedRendering", _foveatedRendering);
+    }, true, _foveatedRendering);
+
 #if defined(Q_OS_MAC)
     _disablePreview = true;
 #else
@@ -52,6 +52,8 @@ public:
 
     std::function<void(gpu::Batch&, const gpu::TexturePointer&)> getHUDOperator() override;
     virtual StencilMaskMode getStencilMaskMode() const override { return StencilMaskMode::PAINT; }
+    float getFoveationRadius() const override;
+    glm::vec2 getFoveationCenter(Eye eye) const override;
     void updateVisionSqueezeParameters(float visionSqueezeX, float visionSqueezeY, float visionSqueezeTransition,
                                        int visionSqueezePerEye, float visionSqueezeGroundPlaneY,
                                        float visionSqueezeSpotlightSize);
@@ -130,6 +132,7 @@ private:
     float getLeftCenterPixel() const;
 
     bool _monoPreview { true };
+    bool _foveatedRendering { true };
     bool _clearPreviewFlag { false };
     gpu::TexturePointer _previewTexture;
     glm::vec2 _lastWindowSize;
@@ -65,51 +65,62 @@ public:
     static std::unique_ptr<FileStorage> make(qint64 size);
     virtual ~FileStorage();
 
-    const QByteArray& content() const override { return _wrapperArray; };
-    qint64 bytesLeftToWrite() const override { return _mappedMemorySize - _bytesWritten; }
+    const QByteArray& content() const override;
+    qint64 bytesLeftToWrite() const override { return _size - _bytesWritten; }
     void write(const QByteArray& data) override;
 
 private:
-    FileStorage(std::unique_ptr<QTemporaryFile> file, uchar* mapped, qint64 size);
+    FileStorage(std::unique_ptr<QTemporaryFile> file, qint64 size);
 
-    // Byte array is const because any edit will trigger a deep copy
-    // and pull all the data we want to keep on disk in memory.
-    const QByteArray _wrapperArray;
     std::unique_ptr<QTemporaryFile> _file;
-
-    uchar* const _mappedMemoryAddress { nullptr };
-    const qint64 _mappedMemorySize { 0 };
+    const qint64 _size { 0 };
     qint64 _bytesWritten { 0 };
+
+    // The content is written through the file, so that it sits in the page cache rather than in our own memory,
+    // and is only mapped once it has all been received and is asked for.
+    // Byte array is const because any edit will trigger a deep copy
+    // and pull all the data we want to keep on disk in memory.
+    mutable QByteArray _wrapperArray;
+    mutable uchar* _mappedMemoryAddress { nullptr };
 };
 
 std::unique_ptr<FileStorage> FileStorage::make(qint64 size) {
     auto file = std::unique_ptr<QTemporaryFile>(new QTemporaryFile());
     file->open(); // Open for resize
     file->resize(size);
-    auto mapped = file->map(0, size); // map the entire file
 
-    return std::unique_ptr<FileStorage>(new FileStorage(std::move(file), mapped, size));
+    return std::unique_ptr<FileStorage>(new FileStorage(std::move(file), size));
 }
 
-// Use QByteArray::fromRawData to avoid a new allocation and access the already existing
-// memory directly as long as all operations on the array are const.
-FileStorage::FileStorage(std::unique_ptr<QTemporaryFile> file, uchar* mapped, qint64 size) :
-    _wrapperArray(QByteArray::fromRawData(reinterpret_cast<char*>(mapped), size)),
+FileStorage::FileStorage(std::unique_ptr<QTemporaryFile> file, qint64 size) :
     _file(std::move(file)),
-    _mappedMemoryAddress(mapped),
-    _mappedMemorySize(size)
+    _size(size)
 {
 }
 
 FileStorage::~FileStorage() {
-    _file->unmap(_mappedMemoryAddress);
+    if (_mappedMemoryAddress) {
+        _file->unmap(_mappedMemoryAddress);
+    }
     _file->close();
 }
 
+// Use QByteArray::fromRawData to avoid a new allocation and access the already existing
+// memory directly as long as all operations on the array are const.
+const QByteArray& FileStorage::content() const {
+    if (!_mappedMemoryAddress && _size > 0) {
+        _mappedMemoryAddress = _file->map(0, _size); // map the entire file
+        if (_mappedMemoryAddress) {
+            _wrapperArray = QByteArray::fromRawData(reinterpret_cast<char*>(_mappedMemoryAddress), _size);
+        }
+    }
+    return _wrapperArray;
+}
+
 void FileStorage::write(const QByteArray& data) {
     assert(data.size() <= bytesLeftToWrite());
-    // We write directly to the mapped memory
-    memcpy(_mappedMemoryAddress + _bytesWritten, data.data(), data.size());
+    _file->seek(_bytesWritten);
+    _file->write(data);
     _bytesWritten += data.size();
 }
 
@@ -230,36 +241,72 @@ void HTTPConnection::respond(const char* code, const QByteArray& content, const
 
 void HTTPConnection::respond(const char* code, std::unique_ptr<QIODevice> device, const char* contentType, const Headers& headers) {
     _responseDevice = std::move(device);
+    _isResponseChunked = _responseDevice->isSequential();
+
+    if (_isResponseChunked) {
+        // the size of a sequential device isn't known up front, so its content is sent in chunks as it becomes available
+        Headers chunkedHeaders = headers;
+        chunkedHeaders.insert("Content-Type", contentType);
+        chunkedHeaders.insert("Transfer-Encoding", "chunked");
+        respondWithStatusAndHeaders(code, contentType, chunkedHeaders, 0);
+
+        connect(_responseDevice.get(), &QIODevice::readyRead, this, &HTTPConnection::writeResponseChunks);
+        connect(_responseDevice.get(), &QIODevice::readChannelFinished, this, [this] {
+            _isResponseDeviceFinished = true;
+            writeResponseChunks();
+        });
+    } else {
+        respondWithStatusAndHeaders(code, contentType, headers, _responseDevice->size());
+    }
 
-    if (_responseDevice->isSequential()) {
-        qWarning() << "Error responding to HTTPConnection: sequential IO devices not supported";
-        respondWithStatusAndHeaders(StatusCode500, contentType, headers, 0);
-        _socket->disconnect(SIGNAL(readyRead()), this);
-        _socket->disconnectFromHost();
+    connect(_socket, &QTcpSocket::bytesWritten, this, &HTTPConnection::writeResponseChunks);
+
+    // make sure we receive no further read notifications
+    disconnect(_socket, &QTcpSocket::readyRead, this, nullptr);
+
+    writeResponseChunks();
+}
+
+void HTTPConnection::writeResponseChunks() {
+    if (!_responseDevice) {
         return;
     }
 
-    int totalToBeWritten = _responseDevice->size();
-    respondWithStatusAndHeaders(code, contentType, headers, totalToBeWritten);
+    // Only a few chunks are queued on the socket at a time, the next ones are read as the socket drains,
+    // so that sending a large file to a slow client doesn't pull all of it into memory.
+    const qint64 HTTP_RESPONSE_CHUNK_SIZE = 64 * 1024;
+    const qint64 MAX_RESPONSE_BYTES_TO_WRITE = 4 * HTTP_RESPONSE_CHUNK_SIZE;
+
+    bool isDone = false;
+    while (_socket->bytesToWrite() < MAX_RESPONSE_BYTES_TO_WRITE) {
+        QByteArray chunk = _responseDevice->read(HTTP_RESPONSE_CHUNK_SIZE);
+        if (chunk.isEmpty()) {
+            // a sequential device may only have nothing to read for now, a file is done (or failed)
+            isDone = !_isResponseChunked || (_isResponseDeviceFinished && _responseDevice->bytesAvailable() == 0);
+            break;
+        }
 
-    if (_responseDevice->atEnd()) {
-        _socket->disconnectFromHost();
-    } else {
-        connect(_socket, &QTcpSocket::bytesWritten, this, [this, totalToBeWritten](size_t bytes) mutable {
-            constexpr size_t HTTP_RESPONSE_CHUNK_SIZE = 1024 * 10;
-            if (!_responseDevice->atEnd()) {
-                totalToBeWritten -= _socket->write(_responseDevice->read(HTTP_RESPONSE_CHUNK_SIZE));
-                if (_responseDevice->atEnd()) {
-                    _socket->disconnectFromHost();
-                    disconnect(_socket, &QTcpSocket::bytesWritten, this, nullptr);
-                }
+        if (_isResponseChunked) {
+            _socket->write(QByteArray::number(chunk.size(), 16) + "\r\n");
+            _socket->write(chunk);
+            _socket->write("\r\n");
+        } else {
+            _socket->write(chunk);
+            if (_responseDevice->atEnd()) {
+                isDone = true;
+                break;
             }
-        });
-
+        }
     }
 
-    // make sure we receive no further read notifications
-    disconnect(_socket, &QTcpSocket::readyRead, this, nullptr);
+    if (isDone) {
+        if (_isResponseChunked) {
+            _socket->write("0\r\n\r\n");
+        }
+        disconnect(_socket, &QTcpSocket::bytesWritten, this, nullptr);
+        disconnect(_responseDevice.get(), nullptr, this, nullptr);
+        _socket->disconnectFromHost();
+    }
 }
 
 void HTTPConnection::respondWithStatusAndHeaders(const char* code, const char* contentType, const Headers& headers, qint64 contentLength) {
@@ -343,7 +390,7 @@ void HTTPConnection::readHeaders() {
 
             } else {
                 bool success = false;
-                auto length = clength.toInt(&success);
+                auto length = clength.toLongLong(&success);
                 if (!success) {
                     qWarning() << "Invalid header." << _address << trimmed;
                     respond("400 Bad Request", "The header was malformed.");
@@ -122,6 +122,9 @@ protected slots:
 protected:
     void respondWithStatusAndHeaders(const char* code, const char* contentType, const Headers& headers, qint64 size);
 
+    /// Writes the next chunks of the response device, as long as the socket isn't backed up.
+    void writeResponseChunks();
+
     /// The parent HTTP manager
     HTTPManager* _parentManager;
 
@@ -148,6 +151,12 @@ protected:
 
     /// Response content
     std::unique_ptr<QIODevice> _responseDevice;
+
+    /// Whether the response device is sent with a chunked transfer encoding, because its size isn't known.
+    bool _isResponseChunked { false };
+
+    /// Whether a sequential response device has nothing more to be read.
+    bool _isResponseDeviceFinished { false };
 };
 
 #endif // hifi_HTTPConnection_h
@@ -0,0 +1,175 @@
+//
+//  EnterLeaveIndex.cpp
+//  libraries/entities-renderer/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EnterLeaveIndex.h"
+
+#include <algorithm>
+
+#include "EntityTypes.h"
+
+static const float CELL_SIZE = 16.0f; // meters
+static const int MAX_CELLS_PER_ENTRY = 64;
+static const int CELL_KEY_BITS = 21;
+static const int CELL_KEY_OFFSET = 1 << (CELL_KEY_BITS - 1);
+static const uint64_t CELL_KEY_MASK = (1ULL << CELL_KEY_BITS) - 1;
+
+uint64_t EnterLeaveIndex::cellKey(const glm::ivec3& cell) {
+    return ((uint64_t)(cell.x + CELL_KEY_OFFSET) & CELL_KEY_MASK) |
+        (((uint64_t)(cell.y + CELL_KEY_OFFSET) & CELL_KEY_MASK) << CELL_KEY_BITS) |
+        (((uint64_t)(cell.z + CELL_KEY_OFFSET) & CELL_KEY_MASK) << (2 * CELL_KEY_BITS));
+}
+
+glm::ivec3 EnterLeaveIndex::cellOf(const glm::vec3& point) {
+    return glm::ivec3(glm::floor(point / CELL_SIZE));
+}
+
+void EnterLeaveIndex::update(const EntityItemPointer& entity) {
+    if (!entity) {
+        return;
+    }
+
+    EntityItemID id = entity->getEntityItemID();
+    bool indexed = entity->getType() == EntityTypes::Zone || !entity->getScript().isEmpty();
+
+    auto itr = _entries.find(id);
+    if (itr != _entries.end()) {
+        removeEntry(id, itr->second);
+        if (!indexed) {
+            _entries.erase(itr);
+            return;
+        }
+    } else if (!indexed) {
+        return;
+    } else {
+        itr = _entries.emplace(id, Entry()).first;
+    }
+
+    Entry& entry = itr->second;
+    entry.entity = entity;
+    bool success;
+    entry.bounds = entity->getAABox(success);
+    if (!success || entity->isMovingRelativeToParent() || !entity->getParentID().isNull()) {
+        entry.bucket = Bucket::Dynamic;
+    } else {
+        entry.minCell = cellOf(entry.bounds.getMinimumPoint());
+        entry.maxCell = cellOf(entry.bounds.getMaximumPoint());
+        glm::ivec3 span = entry.maxCell - entry.minCell + glm::ivec3(1);
+        bool large = span.x > MAX_CELLS_PER_ENTRY || span.y > MAX_CELLS_PER_ENTRY || span.z > MAX_CELLS_PER_ENTRY ||
+            span.x * span.y * span.z > MAX_CELLS_PER_ENTRY;
+        entry.bucket = large ? Bucket::Large : Bucket::Grid;
+    }
+    insertEntry(id, entry);
+}
+
+void EnterLeaveIndex::remove(const EntityItemID& id) {
+    auto itr = _entries.find(id);
+    if (itr != _entries.end()) {
+        removeEntry(id, itr->second);
+        _entries.erase(itr);
+    }
+}
+
+void EnterLeaveIndex::clear() {
+    _entries.clear();
+    _cells.clear();
+    _large.clear();
+    _dynamic.clear();
+}
+
+void EnterLeaveIndex::insertEntry(const EntityItemID& id, Entry& entry) {
+    switch (entry.bucket) {
+        case Bucket::Grid:
+            for (int x = entry.minCell.x; x <= entry.maxCell.x; ++x) {
+                for (int y = entry.minCell.y; y <= entry.maxCell.y; ++y) {
+                    for (int z = entry.minCell.z; z <= entry.maxCell.z; ++z) {
+                        _cells[cellKey(glm::ivec3(x, y, z))].push_back(id);
+                    }
+                }
+            }
+            break;
+        case Bucket::Large:
+            _large.insert(id);
+            break;
+        case Bucket::Dynamic:
+            _dynamic.insert(id);
+            break;
+    }
+}
+
+void EnterLeaveIndex::removeEntry(const EntityItemID& id, const Entry& entry) {
+    switch (entry.bucket) {
+        case Bucket::Grid:
+            for (int x = entry.minCell.x; x <= entry.maxCell.x; ++x) {
+                for (int y = entry.minCell.y; y <= entry.maxCell.y; ++y) {
+                    for (int z = entry.minCell.z; z <= entry.maxCell.z; ++z) {
+                        auto cell = _cells.find(cellKey(glm::ivec3(x, y, z)));
+                        if (cell == _cells.end()) {
+                            continue;
+                        }
+                        auto& ids = cell->second;
+                        ids.erase(std::remove(ids.begin(), ids.end(), id), ids.end());
+                        if (ids.empty()) {
+                            _cells.erase(cell);
+                        }
+                    }
+                }
+            }
+            break;
+        case Bucket::Large:
+            _large.erase(id);
+            break;
+        case Bucket::Dynamic:
+            _dynamic.erase(id);
+            break;
+    }
+}
+
+void EnterLeaveIndex::findContaining(const glm::vec3& point, std::vector<EntityItemPointer>& result) {
+    std::vector<EntityItemID> expired;
+
+    auto check = [&](const EntityItemID& id, bool refreshBounds) {
+        auto itr = _entries.find(id);
+        if (itr == _entries.end()) {
+            return;
+        }
+        auto entity = itr->second.entity.lock();
+        if (!entity) {
+            expired.push_back(id);
+            return;
+        }
+        if (refreshBounds) {
+            bool success;
+            AABox bounds = entity->getAABox(success);
+            if (!success || !bounds.contains(point)) {
+                return;
+            }
+        } else if (!itr->second.bounds.contains(point)) {
+            return;
+        }
+        result.push_back(entity);
+    };
+
+    auto cell = _cells.find(cellKey(cellOf(point)));
+    if (cell != _cells.end()) {
+        for (const auto& id : cell->second) {
+            check(id, false);
+        }
+    }
+    for (const auto& id : _large) {
+        check(id, false);
+    }
+    for (const auto& id : _dynamic) {
+        check(id, true);
+    }
+
+    for (const auto& id : expired) {
+        remove(id);
+    }
+}
@@ -0,0 +1,71 @@
+//
+//  EnterLeaveIndex.h
+//  libraries/entities-renderer/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_EnterLeaveIndex_h
+#define vircadia_EnterLeaveIndex_h
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <AABox.h>
+#include <EntityItem.h>
+
+// A spatial index of the entities that the avatar can enter or leave: zones, and entities with a script.
+//
+// Finding the entities that contain the avatar used to search the whole entity tree around it, although only
+// these entities can have events fired on them. They are kept here in a uniform grid of world bounds instead,
+// so that a check only looks at the volumes in the avatar's cell.
+//
+// Entities are added, refreshed and removed by EntityTreeRenderer as the tree tells it of changes. Entities that
+// span a lot of cells (domain wide zones) are kept in a list of their own, and entities that can move without
+// telling us (moving, or parented) are kept in a list whose bounds are recomputed on every check.
+class EnterLeaveIndex {
+public:
+    // adds entity, or refreshes its bounds, if it is a zone or has a script, and removes it otherwise
+    void update(const EntityItemPointer& entity);
+    void remove(const EntityItemID& id);
+    void clear();
+
+    // the indexed entities whose bounds contain point, to be called with the tree read locked
+    void findContaining(const glm::vec3& point, std::vector<EntityItemPointer>& result);
+
+    size_t size() const { return _entries.size(); }
+
+private:
+    enum class Bucket {
+        Grid,
+        Large,
+        Dynamic
+    };
+
+    struct Entry {
+        EntityItemWeakPointer entity;
+        AABox bounds;
+        glm::ivec3 minCell;
+        glm::ivec3 maxCell;
+        Bucket bucket;
+    };
+
+    static uint64_t cellKey(const glm::ivec3& cell);
+    static glm::ivec3 cellOf(const glm::vec3& point);
+
+    void insertEntry(const EntityItemID& id, Entry& entry);
+    void removeEntry(const EntityItemID& id, const Entry& entry);
+
+    std::unordered_map<EntityItemID, Entry> _entries;
+    std::unordered_map<uint64_t, std::vector<EntityItemID>> _cells;
+    std::unordered_set<EntityItemID> _large;
+    std::unordered_set<EntityItemID> _dynamic;
+};
+
+#endif // vircadia_EnterLeaveIndex_h
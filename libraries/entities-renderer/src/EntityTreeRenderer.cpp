@@ -23,6 +23,7 @@
 #include <AbstractViewStateInterface.h>
 #include <AddressManager.h>
 #include <ColorUtils.h>
+#include <EntityCompressionDictionary.h>
 #include <Model.h>
 #include <NetworkAccessManager.h>
 #include <PerfStat.h>
@@ -30,6 +31,7 @@
 #include <Rig.h>
 #include <SceneScriptingInterface.h>
 #include <ScriptEngines.h>
+#include <TBBHelpers.h>
 #include <EntitySimulation.h>
 #include <ZoneRenderer.h>
 #include <PhysicalEntitySimulation.h>
@@ -70,6 +72,7 @@ EntityTreeRenderer::EntityTreeRenderer(bool wantScripts, AbstractViewStateInterf
     });
     setSetPrecisionPickingOperator([](unsigned int rayPickID, bool value) {});
     EntityRenderer::initEntityRenderers();
+    setCompressionDictionary(getEntityCompressionDictionary());
     _currentHoverOverEntityID = UNKNOWN_ENTITY_ID;
     _currentClickingOnEntityID = UNKNOWN_ENTITY_ID;
 
@@ -332,6 +335,8 @@ void EntityTreeRenderer::clear() {
     }
     _entitiesInScene.clear();
     _renderablesToUpdate.clear();
+    _enterLeaveIndex.clear();
+    _lodProxies.clear();
 
     // reset the zone to the default (while we load the next scene)
     _layeredZones.clear();
@@ -443,6 +448,24 @@ void EntityTreeRenderer::addPendingEntities(const render::ScenePointer& scene, r
     }
 }
 
+// computing transforms and bounds only reads the entities, so it is done in parallel ahead of the serial scene updates
+static void prepareRenderUpdates(const std::vector<EntityRendererPointer>& renderables) {
+    const size_t MIN_PARALLEL_RENDERABLES = 32;
+    if (renderables.size() < MIN_PARALLEL_RENDERABLES) {
+        for (const auto& renderable : renderables) {
+            renderable->prepareRenderUpdate();
+        }
+        return;
+    }
+
+    PROFILE_RANGE_EX(simulation_physics, "PrepareRenderables", 0xffff00ff, (uint64_t)renderables.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, renderables.size()), [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t i = range.begin(); i != range.end(); ++i) {
+            renderables[i]->prepareRenderUpdate();
+        }
+    });
+}
+
 void EntityTreeRenderer::updateChangedEntities(const render::ScenePointer& scene, render::Transaction& transaction) {
     PROFILE_RANGE_EX(simulation_physics, "ChangeInScene", 0xffff00ff, (uint64_t)_changedEntities.size());
     PerformanceTimer pt("change");
@@ -458,6 +481,8 @@ void EntityTreeRenderer::updateChangedEntities(const render::ScenePointer& scene
             if (renderable) {
                 // only add valid renderables _renderablesToUpdate
                 _renderablesToUpdate.insert(renderable);
+                _enterLeaveIndex.update(renderable->getEntity());
+                updateLodProxy(renderable->getEntity());
             }
         }
     }
@@ -468,7 +493,9 @@ void EntityTreeRenderer::updateChangedEntities(const render::ScenePointer& scene
         // we expect to update all renderables within available time budget
         PROFILE_RANGE_EX(simulation_physics, "UpdateRenderables", 0xffff00ff, (uint64_t)_renderablesToUpdate.size());
         uint64_t updateStart = usecTimestampNow();
-        for (const auto& renderable : _renderablesToUpdate) {
+        std::vector<EntityRendererPointer> renderables(_renderablesToUpdate.begin(), _renderablesToUpdate.end());
+        prepareRenderUpdates(renderables);
+        for (const auto& renderable : renderables) {
             assert(renderable); // only valid renderables are added to _renderablesToUpdate
             renderable->updateInScene(scene, transaction);
         }
@@ -523,14 +550,23 @@ void EntityTreeRenderer::updateChangedEntities(const render::ScenePointer& scene
             }
             uint64_t expiry = updateStart + timeBudget;
 
-            // process the sorted renderables
-            for (const auto& sortedRenderable : sortedRenderablesVector) {
-                if (usecTimestampNow() > expiry) {
-                    break;
+            // process the sorted renderables, a batch at a time so that each batch is prepared in parallel
+            // and the time budget is checked between batches (a prepared renderable must be updated)
+            const size_t UPDATE_BATCH_SIZE = 64;
+            std::vector<EntityRendererPointer> batch;
+            batch.reserve(UPDATE_BATCH_SIZE);
+            auto sortedIt = sortedRenderablesVector.begin();
+            while (sortedIt != sortedRenderablesVector.end() && usecTimestampNow() <= expiry) {
+                batch.clear();
+                for (; sortedIt != sortedRenderablesVector.end() && batch.size() < UPDATE_BATCH_SIZE; ++sortedIt) {
+                    batch.push_back(sortedIt->getRenderer());
+                }
+
+                prepareRenderUpdates(batch);
+                for (const auto& renderable : batch) {
+                    renderable->updateInScene(scene, transaction);
+                    _renderablesToUpdate.erase(renderable);
                 }
-                const auto& renderable = sortedRenderable.getRenderer();
-                renderable->updateInScene(scene, transaction);
-                _renderablesToUpdate.erase(renderable);
             }
 
             // compute average per-renderable update cost
@@ -566,6 +602,8 @@ void EntityTreeRenderer::update(bool simulate) {
             PerformanceTimer sceneTimer("scene");
             auto scene = _viewState->getMain3DScene();
             if (scene) {
+                updateLodProxies();
+
                 render::Transaction transaction;
                 addPendingEntities(scene, transaction);
 
@@ -613,27 +651,18 @@ void EntityTreeRenderer::handleSpaceUpdate(std::pair<int32_t, glm::vec4> proxyUp
 }
 
 void EntityTreeRenderer::findBestZoneAndMaybeContainingEntities(QSet<EntityItemID>& entitiesContainingAvatar) {
-    float radius = 0.01f; // for now, assume 0.01 meter radius, because we actually check the point inside later
-    QVector<QUuid> entityIDs;
+    std::vector<EntityItemPointer> entities;
 
-    // find the entities near us
+    // find the zones and scripted entities whose bounds contain us
     // don't let someone else change our tree while we search
     _tree->withReadLock([&] {
-        auto entityTree = std::static_pointer_cast<EntityTree>(_tree);
-
-        // FIXME - if EntityTree had a findEntitiesContainingPoint() this could theoretically be a little faster
-        entityTree->evalEntitiesInSphere(_avatarPosition, radius, PickFilter(), entityIDs);
+        _enterLeaveIndex.findContaining(_avatarPosition, entities);
 
         LayeredZones oldLayeredZones(_layeredZones);
         _layeredZones.clear();
 
         // create a list of entities that actually contain the avatar's position
-        for (auto& entityID : entityIDs) {
-            auto entity = entityTree->findEntityByID(entityID);
-            if (!entity) {
-                continue;
-            }
-
+        for (auto& entity : entities) {
             auto isZone = entity->getType() == EntityTypes::Zone;
             auto hasScript = !entity->getScript().isEmpty();
 
@@ -1046,6 +1075,8 @@ void EntityTreeRenderer::mouseMoveEvent(QMouseEvent* event) {
 void EntityTreeRenderer::deletingEntity(const EntityItemID& entityID) {
     // If it's in a pending queue, remove it
     _entitiesToAdd.erase(entityID);
+    _enterLeaveIndex.remove(entityID);
+    _lodProxies.erase(entityID);
 
     auto itr = _entitiesInScene.find(entityID);
     if (_entitiesInScene.end() == itr) {
@@ -1086,11 +1117,75 @@ void EntityTreeRenderer::addingEntity(const EntityItemID& entityID) {
     auto entity = std::static_pointer_cast<EntityTree>(_tree)->findEntityByID(entityID);
     if (entity) {
         _entitiesToAdd.insert({ entity->getEntityItemID(),  entity });
+        _enterLeaveIndex.update(entity);
+        updateLodProxy(entity);
     }
 }
 
+void EntityTreeRenderer::updateLodProxy(const EntityItemPointer& entity) {
+    if (!entity) {
+        return;
+    }
+    auto itr = _lodProxies.find(entity->getEntityItemID());
+    if (entity->isLodProxy()) {
+        if (itr == _lodProxies.end()) {
+            LodProxy proxy;
+            proxy.entity = entity;
+            _lodProxies.emplace(entity->getEntityItemID(), proxy);
+        }
+    } else if (itr != _lodProxies.end()) {
+        hideLodProxy(entity, false, false);
+        _lodProxies.erase(itr);
+    }
+}
+
+void EntityTreeRenderer::updateLodProxies() {
+    if (_lodProxies.empty()) {
+        return;
+    }
+    const auto& views = _viewState->getConicalViews();
+    for (auto itr = _lodProxies.begin(); itr != _lodProxies.end();) {
+        auto entity = itr->second.entity.lock();
+        if (!entity) {
+            itr = _lodProxies.erase(itr);
+            continue;
+        }
+
+        glm::vec3 position = entity->getWorldPosition();
+        float distance = entity->getLodProxyDistance();
+        bool near = false;
+        for (const auto& view : views) {
+            if (glm::distance(view.getPosition(), position) < distance) {
+                near = true;
+                break;
+            }
+        }
+
+        // children that arrive later start out shown, which is right as they are only sent to views near the proxy
+        if (!itr->second.applied || near != itr->second.near) {
+            hideLodProxy(entity, near, !near);
+            itr->second.near = near;
+            itr->second.applied = true;
+        }
+        ++itr;
+    }
+}
+
+void EntityTreeRenderer::hideLodProxy(const EntityItemPointer& entity, bool hideProxy, bool hideChildren) {
+    entity->setHiddenByLodProxy(hideProxy);
+    entity->forEachChild([&](const SpatiallyNestablePointer& child) {
+        if (child->getNestableType() == NestableType::Entity) {
+            std::static_pointer_cast<EntityItem>(child)->setHiddenByLodProxy(hideChildren);
+        }
+    });
+}
+
 void EntityTreeRenderer::entityScriptChanging(const EntityItemID& entityID, bool reload) {
     checkAndCallPreload(entityID, reload, true);
+    if (_tree && !_shuttingDown) {
+        // an entity gaining or losing its script starts or stops being able to be entered
+        _enterLeaveIndex.update(getTree()->findEntityByEntityItemID(entityID));
+    }
     // Force "re-checking" entities so that the logic inside `checkEnterLeaveEntities()` is run.
     // This will ensure that the `enterEntity()` signal is emitted on clients whose avatars
     // are inside an entity when the script is reloaded.
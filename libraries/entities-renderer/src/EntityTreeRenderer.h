@@ -27,6 +27,8 @@
 #include <render/Forward.h>
 #include <workload/Space.h>
 
+#include "EnterLeaveIndex.h"
+
 class AbstractScriptingServicesInterface;
 class AbstractViewStateInterface;
 class Model;
@@ -197,6 +199,19 @@ private:
     glm::vec3 _avatarPosition { 0.0f };
     bool _forceRecheckEntities { true };
     QSet<EntityItemID> _currentEntitiesInside;
+    EnterLeaveIndex _enterLeaveIndex;
+
+    // the entity server only sends the children of a LOD proxy to views near it, so we draw either the proxy or its
+    // children, by the same rule
+    struct LodProxy {
+        EntityItemWeakPointer entity;
+        bool near { false };
+        bool applied { false };
+    };
+    void updateLodProxy(const EntityItemPointer& entity);
+    void updateLodProxies();
+    static void hideLodProxy(const EntityItemPointer& entity, bool hideProxy, bool hideChildren);
+    std::unordered_map<EntityItemID, LodProxy> _lodProxies;
 
     bool _wantScripts;
     ScriptEnginePointer _nonPersistentEntitiesScriptEngine; // used for domain + non-owned avatar entities, cleared on domain switch
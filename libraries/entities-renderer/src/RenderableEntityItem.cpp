@@ -337,14 +337,24 @@ void EntityRenderer::removeFromScene(const ScenePointer& scene, Transaction& tra
     _entity->bumpAncestorChainRenderableVersion();
 }
 
+void EntityRenderer::prepareRenderUpdate() {
+    _preparedUpdate.modelTransform = getTransformToCenterWithMaybeOnlyLocalRotation(_entity, _preparedUpdate.hasModelTransform);
+    _preparedUpdate.bound = _entity->getAABox(_preparedUpdate.hasBound);
+    _preparedUpdate.moving = _entity->isMovingRelativeToParent();
+    _preparedUpdate.visible = _entity->getVisible() && !_entity->isHiddenByLodProxy();
+    _isUpdatePrepared = true;
+}
+
 void EntityRenderer::updateInScene(const ScenePointer& scene, Transaction& transaction) {
     DETAILED_PROFILE_RANGE(simulation_physics, __FUNCTION__);
     if (!isValidRenderItem()) {
+        _isUpdatePrepared = false;
         return;
     }
     _updateTime = usecTimestampNow();
 
     doRenderUpdateSynchronous(scene, transaction, _entity);
+    _isUpdatePrepared = false;
     transaction.updateItem<PayloadProxyInterface>(_renderItemID, [this](PayloadProxyInterface& self) {
         if (!isValidRenderItem()) {
             return;
@@ -411,6 +421,16 @@ bool EntityRenderer::needsRenderUpdateFromEntity(const EntityItemPointer& entity
 }
 
 void EntityRenderer::updateModelTransformAndBound(const EntityItemPointer& entity) {
+    if (_isUpdatePrepared) {
+        if (_preparedUpdate.hasModelTransform) {
+            _modelTransform = _preparedUpdate.modelTransform;
+        }
+        if (_preparedUpdate.hasBound) {
+            _bound = _preparedUpdate.bound;
+        }
+        return;
+    }
+
     bool success = false;
     auto newModelTransform = getTransformToCenterWithMaybeOnlyLocalRotation(entity, success);
     if (success) {
@@ -440,8 +460,8 @@ void EntityRenderer::doRenderUpdateSynchronous(const ScenePointer& scene, Transa
 
         updateModelTransformAndBound(entity);
 
-        _moving = entity->isMovingRelativeToParent();
-        _visible = entity->getVisible();
+        _moving = _isUpdatePrepared ? _preparedUpdate.moving : entity->isMovingRelativeToParent();
+        _visible = _isUpdatePrepared ? _preparedUpdate.visible : entity->getVisible() && !entity->isHiddenByLodProxy();
         entity->setNeedsRenderUpdate(false);
     });
 }
@@ -50,6 +50,11 @@ public:
     // Handlers for rendering events... executed on the main thread, only called by EntityTreeRenderer, 
     // cannot be overridden or accessed by subclasses
     virtual void updateInScene(const ScenePointer& scene, Transaction& transaction) final;
+
+    // The thread-safe part of updateInScene: snapshots the entity's transform, bound and flags so that updateInScene
+    // doesn't compute them on the main thread.  Only called by EntityTreeRenderer, from worker threads, just before
+    // updateInScene.
+    void prepareRenderUpdate();
     virtual bool addToScene(const ScenePointer& scene, Transaction& transaction) final;
     virtual void removeFromScene(const ScenePointer& scene, Transaction& transaction);
 
@@ -134,6 +139,19 @@ protected:
     void updateShapeKeyBuilderFromMaterials(ShapeKey::Builder& builder);
 
     Item::Bound _bound;
+
+    // set by prepareRenderUpdate, used and cleared by the next updateInScene
+    struct PreparedRenderUpdate {
+        Transform modelTransform;
+        Item::Bound bound;
+        bool hasModelTransform { false };
+        bool hasBound { false };
+        bool moving { false };
+        bool visible { false };
+    };
+    PreparedRenderUpdate _preparedUpdate;
+    bool _isUpdatePrepared { false };
+
     SharedSoundPointer _collisionSound;
     QUuid _changeHandlerId;
     ItemID _renderItemID{ Item::INVALID_ITEM_ID };
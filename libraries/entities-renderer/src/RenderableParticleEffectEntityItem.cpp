@@ -40,14 +40,6 @@ static ShapePipelinePointer shapePipelineFactory(const ShapePlumber& plumber, co
     return std::make_shared<render::ShapePipeline>(texturedPipeline, nullptr, nullptr, nullptr);
 }
 
-struct GpuParticle {
-    GpuParticle(const glm::vec3& xyzIn, const glm::vec2& uvIn) : xyz(xyzIn), uv(uvIn) {}
-    glm::vec3 xyz; // Position
-    glm::vec2 uv; // Lifetime + seed
-};
-
-using GpuParticles = std::vector<GpuParticle>;
-
 ParticleEffectEntityRenderer::ParticleEffectEntityRenderer(const EntityItemPointer& entity) : Parent(entity) {
     ParticleUniforms uniforms;
     _uniformBuffer = std::make_shared<Buffer>(sizeof(ParticleUniforms), (const gpu::Byte*) &uniforms);
@@ -58,9 +50,13 @@ ParticleEffectEntityRenderer::ParticleEffectEntityRenderer(const EntityItemPoint
         CUSTOM_PIPELINE_NUMBER = render::ShapePipeline::registerCustomShapePipelineFactory(shapePipelineFactory);
         _vertexFormat = std::make_shared<Format>();
         _vertexFormat->setAttribute(gpu::Stream::POSITION, 0, gpu::Element::VEC3F_XYZ,
-            offsetof(GpuParticle, xyz), gpu::Stream::PER_INSTANCE);
+            offsetof(GpuParticle, origin), gpu::Stream::PER_INSTANCE);
         _vertexFormat->setAttribute(gpu::Stream::COLOR, 0, gpu::Element::VEC2F_UV,
-            offsetof(GpuParticle, uv), gpu::Stream::PER_INSTANCE);
+            offsetof(GpuParticle, birthAndSeed), gpu::Stream::PER_INSTANCE);
+        _vertexFormat->setAttribute(gpu::Stream::NORMAL, 0, gpu::Element::VEC3F_XYZ,
+            offsetof(GpuParticle, velocity), gpu::Stream::PER_INSTANCE);
+        _vertexFormat->setAttribute(gpu::Stream::TEXCOORD0, 0, gpu::Element::VEC3F_XYZ,
+            offsetof(GpuParticle, acceleration), gpu::Stream::PER_INSTANCE);
     });
 }
 
@@ -362,6 +358,19 @@ ParticleEffectEntityRenderer::CpuParticle ParticleEffectEntityRenderer::createPa
     return particle;
 }
 
+void ParticleEffectEntityRenderer::emitParticle(const CpuParticle& particle) {
+    GpuParticle gpuParticle;
+    gpuParticle.origin = particle.relativePosition;
+    if (_particleProperties.emission.shouldTrail) {
+        gpuParticle.origin += particle.basePosition;
+    }
+    gpuParticle.birthAndSeed = glm::vec2((float)(_simulationTime - _epoch) / (float)USECS_PER_SECOND, particle.seed);
+    gpuParticle.velocity = particle.velocity;
+    gpuParticle.acceleration = particle.acceleration;
+    _gpuParticles.push_back(gpuParticle);
+    _expirations.push_back(_simulationTime + particle.expiration);
+}
+
 void ParticleEffectEntityRenderer::stepSimulation() {
     if (_lastSimulated == 0) {
         _lastSimulated = usecTimestampNow();
@@ -373,6 +382,16 @@ void ParticleEffectEntityRenderer::stepSimulation() {
     _lastSimulated = now;
 
     const auto& modelTransform = getModelTransform();
+    if (_prevEmitterShouldTrail != _particleProperties.emission.shouldTrail) {
+        // the particles that trail are in world space, the others are relative to the emitter
+        glm::vec3 offset = _particleProperties.emission.shouldTrail ? modelTransform.getTranslation() : -modelTransform.getTranslation();
+        for (size_t i = _firstParticle; i < _gpuParticles.size(); i++) {
+            _gpuParticles[i].origin += offset;
+        }
+        _numUploadedParticles = std::min(_numUploadedParticles, _firstParticle);
+        _prevEmitterShouldTrail = _particleProperties.emission.shouldTrail;
+    }
+
     if (_emitting && _particleProperties.emitting() &&
         (_shapeType != SHAPE_TYPE_COMPOUND || (_geometryResource && _geometryResource->isLoaded()))) {
         uint64_t emitInterval = _particleProperties.emitIntervalUsecs();
@@ -383,7 +402,7 @@ void ParticleEffectEntityRenderer::stepSimulation() {
                     computeTriangles(_geometryResource->getHFMModel());
                 }
                 // emit particle
-                _cpuParticles.push_back(createParticle(modelTransform, _particleProperties, _shapeType, _geometryResource, _triangleInfo));
+                emitParticle(createParticle(modelTransform, _particleProperties, _shapeType, _geometryResource, _triangleInfo));
                 _timeUntilNextEmit = emitInterval;
                 if (emitInterval < timeRemaining) {
                     timeRemaining -= emitInterval;
@@ -395,40 +414,40 @@ void ParticleEffectEntityRenderer::stepSimulation() {
     }
 
     // Kill any particles that have expired or are over the max size
-    while (_cpuParticles.size() > _particleProperties.maxParticles || (!_cpuParticles.empty() && _cpuParticles.front().expiration == 0)) {
-        _cpuParticles.pop_front();
+    while (_gpuParticles.size() - _firstParticle > _particleProperties.maxParticles ||
+           (_firstParticle < _gpuParticles.size() && _expirations[_firstParticle] <= _simulationTime)) {
+        _firstParticle++;
     }
 
-    const float deltaTime = (float)interval / (float)USECS_PER_SECOND;
-    // update the particles
-    for (auto& particle : _cpuParticles) {
-        if (_prevEmitterShouldTrail != _particleProperties.emission.shouldTrail) {
-            if (_prevEmitterShouldTrail) {
-                particle.relativePosition = particle.relativePosition + particle.basePosition - modelTransform.getTranslation();
-            }
-            particle.basePosition = modelTransform.getTranslation();
+    // Once as many have expired as are left, move the rest to the front, which also keeps the birth times small
+    static const uint64_t MAX_EPOCH_AGE = 60 * 60 * USECS_PER_SECOND;
+    size_t numParticles = _gpuParticles.size() - _firstParticle;
+    if (_firstParticle > numParticles || _simulationTime - _epoch > MAX_EPOCH_AGE) {
+        float epochOffset = (float)(_simulationTime - _epoch) / (float)USECS_PER_SECOND;
+        _gpuParticles.erase(_gpuParticles.begin(), _gpuParticles.begin() + _firstParticle);
+        _expirations.erase(_expirations.begin(), _expirations.begin() + _firstParticle);
+        for (auto& particle : _gpuParticles) {
+            particle.birthAndSeed.x -= epochOffset;
         }
-        particle.expiration = particle.expiration >= interval ? particle.expiration - interval : 0;
-        particle.integrate(deltaTime);
+        _firstParticle = 0;
+        _numUploadedParticles = 0;
+        _epoch = _simulationTime;
     }
-    _prevEmitterShouldTrail = _particleProperties.emission.shouldTrail;
-
-    // Build particle primitives
-    static GpuParticles gpuParticles;
-    gpuParticles.clear();
-    gpuParticles.reserve(_cpuParticles.size()); // Reserve space
-    std::transform(_cpuParticles.begin(), _cpuParticles.end(), std::back_inserter(gpuParticles), [this, &modelTransform] (const CpuParticle& particle) {
-        glm::vec3 position = particle.relativePosition + (_particleProperties.emission.shouldTrail ? particle.basePosition : modelTransform.getTranslation());
-        return GpuParticle(position, glm::vec2(particle.lifetime, particle.seed));
-    });
 
-    // Update particle buffer
+    _simulationTime += interval;
+
+    // Upload the new particles
     auto& particleBuffer = _particleBuffer;
-    size_t numBytes = sizeof(GpuParticle) * gpuParticles.size();
-    particleBuffer->resize(numBytes);
-    if (numBytes != 0) {
-        particleBuffer->setData(numBytes, (const gpu::Byte*)gpuParticles.data());
+    particleBuffer->resize(sizeof(GpuParticle) * _gpuParticles.size());
+    if (_numUploadedParticles < _gpuParticles.size()) {
+        particleBuffer->setSubData(sizeof(GpuParticle) * _numUploadedParticles, sizeof(GpuParticle) * (_gpuParticles.size() - _numUploadedParticles),
+            (const gpu::Byte*)(_gpuParticles.data() + _numUploadedParticles));
+        _numUploadedParticles = _gpuParticles.size();
     }
+
+    auto& uniforms = _uniformBuffer.edit<ParticleUniforms>();
+    uniforms.emitterPosition = _particleProperties.emission.shouldTrail ? glm::vec3(0.0f) : modelTransform.getTranslation();
+    uniforms.time = (float)(_simulationTime - _epoch) / (float)USECS_PER_SECOND;
 }
 
 void ParticleEffectEntityRenderer::doRender(RenderArgs* args) {
@@ -436,7 +455,6 @@ void ParticleEffectEntityRenderer::doRender(RenderArgs* args) {
         return;
     }
 
-    // FIXME migrate simulation to a compute stage
     stepSimulation();
 
     gpu::Batch& batch = *args->_batch;
@@ -459,9 +477,9 @@ void ParticleEffectEntityRenderer::doRender(RenderArgs* args) {
 
     batch.setUniformBuffer(0, _uniformBuffer);
     batch.setInputFormat(_vertexFormat);
-    batch.setInputBuffer(0, _particleBuffer, 0, sizeof(GpuParticle));
+    batch.setInputBuffer(0, _particleBuffer, _firstParticle * sizeof(GpuParticle), sizeof(GpuParticle));
 
-    auto numParticles = _particleBuffer->getSize() / sizeof(GpuParticle);
+    auto numParticles = _gpuParticles.size() - _firstParticle;
     static const size_t VERTEX_PER_PARTICLE = 4;
     batch.drawInstanced((gpu::uint32)numParticles, gpu::TRIANGLE_STRIP, (gpu::uint32)VERTEX_PER_PARTICLE);
 }
@@ -41,25 +41,24 @@ private:
     using Buffer = gpu::Buffer;
     using BufferView = gpu::BufferView;
 
-    // CPU particles
-    // FIXME either switch to GPU compute particles or switch to simd updating of the particles
+    // A particle as it's emitted
     struct CpuParticle {
         float seed { 0.0f };
         uint64_t expiration { 0 };
-        float lifetime { 0.0f };
         glm::vec3 basePosition;
         glm::vec3 relativePosition;
         glm::vec3 velocity;
         glm::vec3 acceleration;
+    };
 
-        void integrate(float deltaTime) {
-            glm::vec3 atSquared = (0.5f * deltaTime * deltaTime) * acceleration;
-            relativePosition += velocity * deltaTime + atSquared;
-            velocity += acceleration * deltaTime;
-            lifetime += deltaTime;
-        }
+    // Particles are moved by the vertex shader, from where they were emitted and how long ago, so each one is only uploaded
+    // once, when it's emitted
+    struct GpuParticle {
+        glm::vec3 origin; // in world space if the emitter trails, relative to the emitter otherwise
+        glm::vec2 birthAndSeed; // the simulation time it was emitted at, in seconds since _epoch
+        glm::vec3 velocity;
+        glm::vec3 acceleration;
     };
-    using CpuParticles = std::deque<CpuParticle>;
 
 
     template<typename T>
@@ -77,6 +76,8 @@ private:
         float lifespan;
         int rotateWithEntity;
         glm::vec2 spare;
+        glm::vec3 emitterPosition; // zero if the emitter trails
+        float time; // in seconds since _epoch
     };
 
     void computeTriangles(const hfm::Model& hfmModel);
@@ -91,12 +92,20 @@ private:
     static CpuParticle createParticle(const Transform& baseTransform, const particle::Properties& particleProperties,
                                       const ShapeType& shapeType, const GeometryResource::Pointer& geometryResource,
                                       const TriangleInfo& triangleInfo);
+    void emitParticle(const CpuParticle& particle);
     void stepSimulation();
 
     particle::Properties _particleProperties;
     bool _prevEmitterShouldTrail;
     bool _prevEmitterShouldTrailInitialized { false };
-    CpuParticles _cpuParticles;
+    // the emitted particles, oldest first, the ones before _firstParticle have expired and the ones from
+    // _numUploadedParticles on are not in the particle buffer yet
+    std::vector<GpuParticle> _gpuParticles;
+    std::vector<uint64_t> _expirations; // in simulation time
+    size_t _firstParticle { 0 };
+    size_t _numUploadedParticles { 0 };
+    uint64_t _simulationTime { 0 }; // the sum of the simulated intervals, in usecs
+    uint64_t _epoch { 0 }; // the simulation time the particle birth times are relative to, kept recent for their precision
     bool _emitting { false };
     uint64_t _timeUntilNextEmit { 0 };
     BufferPointer _particleBuffer { std::make_shared<Buffer>() };
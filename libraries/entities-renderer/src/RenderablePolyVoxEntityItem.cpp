@@ -13,11 +13,13 @@
 #include "RenderablePolyVoxEntityItem.h"
 
 #include <math.h>
+#include <numeric>
 
 #include <glm/gtx/transform.hpp>
 
 #include <QObject>
 #include <QByteArray>
+#include <QtConcurrent/QtConcurrentMap>
 #include <QtConcurrent/QtConcurrentRun>
 
 #include <model-networking/SimpleMeshProxy.h>
@@ -123,6 +125,10 @@ const float MARCHING_CUBE_COLLISION_HULL_OFFSET = 0.5;
   The work for each step is done on temporary worker threads.  The PolyVox entity will update _updateNeeded and
   enable or disable update calls on the entity, depending on if there is more work to do.
 
+  The mesh and the shape are baked in chunks of POLYVOX_CHUNK_SIZE voxels a side, and the chunks are kept.  Changing a
+  voxel marks the mesh chunks around it dirty, baking the mesh only extracts the dirty chunks (in parallel) and marks
+  their shape chunks dirty, and baking the shape only redoes those.
+
   From the 'Ready' state, if we receive an update from the network, _voxelDataDirty will be set true.  We
   uncompress the received data, bake the mesh (for the render-engine's benefit), and then compute the shape
   (for the physics-engine's benefit).  This is the right-hand side of the diagram.
@@ -162,6 +168,41 @@ void loop3(const T& start, const T& end, F f) {
     }
 }
 
+// the surface and the collision hulls are made in chunks of this many voxels a side
+const int POLYVOX_CHUNK_SIZE = 16;
+
+struct RenderablePolyVoxEntityItem::MeshChunk {
+    std::vector<PolyVox::PositionMaterialNormal> vertices; // in voxel coordinates
+    std::vector<uint32_t> indices;
+};
+
+struct RenderablePolyVoxEntityItem::ShapeChunk {
+    ShapeInfo::PointCollection points; // in voxel coordinates
+};
+
+static ivec3 toIvec3(const PolyVox::Vector3DInt32& v) {
+    return ivec3(v.getX(), v.getY(), v.getZ());
+}
+
+static ivec3 getNumChunks(const PolyVox::SimpleVolume<uint8_t>* volData) {
+    if (!volData) {
+        return ivec3(0);
+    }
+    const auto& region = volData->getEnclosingRegion();
+    ivec3 size = toIvec3(region.getUpperCorner()) - toIvec3(region.getLowerCorner());
+    return glm::max((size + POLYVOX_CHUNK_SIZE - 1) / POLYVOX_CHUNK_SIZE, ivec3(1));
+}
+
+// Chunks share the voxels of their faces: the extractors make the surface between the lower corner of a region and its upper
+// corner, the last chunks end at the upper corner of the volume, like when the whole volume is extracted at once
+static PolyVox::Region getChunkRegion(const PolyVox::SimpleVolume<uint8_t>* volData, const ivec3& numChunks, int index) {
+    ivec3 chunk(index % numChunks.x, (index / numChunks.x) % numChunks.y, index / (numChunks.x * numChunks.y));
+    const auto& region = volData->getEnclosingRegion();
+    ivec3 lower = toIvec3(region.getLowerCorner()) + chunk * POLYVOX_CHUNK_SIZE;
+    ivec3 upper = glm::min(lower + POLYVOX_CHUNK_SIZE, toIvec3(region.getUpperCorner()));
+    return PolyVox::Region(PolyVox::Vector3DInt32(lower.x, lower.y, lower.z), PolyVox::Vector3DInt32(upper.x, upper.y, upper.z));
+}
+
 EntityItemPointer RenderablePolyVoxEntityItem::factory(const EntityItemID& entityID, const EntityItemProperties& properties) {
     std::shared_ptr<RenderablePolyVoxEntityItem> entity(new RenderablePolyVoxEntityItem(entityID),
                                                         [](RenderablePolyVoxEntityItem* ptr) { ptr->deleteLater(); });
@@ -226,6 +267,7 @@ void RenderablePolyVoxEntityItem::setVoxelSurfaceStyle(PolyVoxSurfaceStyle voxel
             volSizeChanged = true;
         }
         _voxelSurfaceStyle = voxelSurfaceStyle;
+        resetChunks();
         startUpdates();
     });
 
@@ -896,6 +938,7 @@ void RenderablePolyVoxEntityItem::setVoxelVolumeSize(const glm::vec3& voxelVolum
         _volData.reset(new PolyVox::SimpleVolume<uint8_t>(PolyVox::Region(lowCorner, highCorner)));
         // having the "outside of voxel-space" value be 255 has helped me notice some problems.
         _volData->setBorderValue(255);
+        resetChunks();
     });
 
     tellNeighborsToRecopyEdges(true);
@@ -946,8 +989,32 @@ uint8_t RenderablePolyVoxEntityItem::getVoxelInternal(const ivec3& v) const {
 }
 
 
+void RenderablePolyVoxEntityItem::resetChunks() {
+    // this assumes that the caller has write-locked the entity
+    ivec3 numChunks = getNumChunks(_volData.get());
+    size_t count = numChunks.x * numChunks.y * numChunks.z;
+    _meshChunks.assign(count, nullptr);
+    _shapeChunks.assign(count, nullptr);
+    _meshChunkIsDirty.assign(count, true);
+    _shapeChunkIsDirty.assign(count, true);
+    _chunksVersion++;
+}
+
+void RenderablePolyVoxEntityItem::markChunksDirty(const ivec3& v) {
+    // this assumes that the caller has write-locked the entity.  A voxel is a corner of the cells on either side of it,
+    // and marching cubes normals also sample the voxels next to those corners.
+    ivec3 numChunks = getNumChunks(_volData.get());
+    ivec3 position = v - toIvec3(_volData->getEnclosingRegion().getLowerCorner());
+    ivec3 low = glm::clamp((position - 2) / POLYVOX_CHUNK_SIZE, ivec3(0), numChunks - 1);
+    ivec3 high = glm::clamp((position + 1) / POLYVOX_CHUNK_SIZE, ivec3(0), numChunks - 1);
+    loop3(low, high + 1, [&](const ivec3& chunk) {
+        _meshChunkIsDirty[chunk.x + numChunks.x * (chunk.y + numChunks.y * chunk.z)] = true;
+    });
+}
+
 void RenderablePolyVoxEntityItem::setVoxelMarkNeighbors(int x, int y, int z, uint8_t toValue) {
     _volData->setVoxelAt(x, y, z, toValue);
+    markChunksDirty(ivec3(x, y, z));
     if (x == 0) {
         _neighborXNeedsUpdate = true;
         startUpdates();
@@ -1200,6 +1267,7 @@ void RenderablePolyVoxEntityItem::copyUpperEdgesFromNeighbors() {
                         uint8_t prevValue = _volData->getVoxelAt(x, y, z);
                         if (prevValue != neighborValue) {
                             _volData->setVoxelAt(x, y, z, neighborValue);
+                            markChunksDirty(ivec3(x, y, z));
                             _volDataDirty = true;
                         }
                     }
@@ -1220,6 +1288,7 @@ void RenderablePolyVoxEntityItem::copyUpperEdgesFromNeighbors() {
                         uint8_t prevValue = _volData->getVoxelAt(x, y, z);
                         if (prevValue != neighborValue) {
                             _volData->setVoxelAt(x, y, z, neighborValue);
+                            markChunksDirty(ivec3(x, y, z));
                             _volDataDirty = true;
                         }
                     }
@@ -1240,6 +1309,7 @@ void RenderablePolyVoxEntityItem::copyUpperEdgesFromNeighbors() {
                         uint8_t prevValue = _volData->getVoxelAt(x, y, z);
                         if (prevValue != neighborValue) {
                             _volData->setVoxelAt(x, y, z, neighborValue);
+                            markChunksDirty(ivec3(x, y, z));
                             _volDataDirty = true;
                         }
                     }
@@ -1280,49 +1350,94 @@ void RenderablePolyVoxEntityItem::tellNeighborsToRecopyEdges(bool force) {
 
 
 void RenderablePolyVoxEntityItem::recomputeMesh() {
-    // use _volData to make a renderable mesh
+    // use _volData to make a renderable mesh, only the chunks with changed voxels are extracted again
     PolyVoxSurfaceStyle voxelSurfaceStyle;
-    withReadLock([&] {
+    MeshChunks chunks;
+    std::vector<int> dirtyChunks;
+    int chunksVersion;
+    withWriteLock([&] {
         voxelSurfaceStyle = _voxelSurfaceStyle;
+        chunks = _meshChunks;
+        chunksVersion = _chunksVersion;
+        for (int i = 0; i < (int)_meshChunkIsDirty.size(); i++) {
+            if (_meshChunkIsDirty[i]) {
+                _meshChunkIsDirty[i] = false;
+                dirtyChunks.push_back(i);
+            }
+        }
     });
 
     auto entity = std::static_pointer_cast<RenderablePolyVoxEntityItem>(getThisPointer());
 
-    QtConcurrent::run([entity, voxelSurfaceStyle] {
-        graphics::MeshPointer mesh(std::make_shared<graphics::Mesh>());
-
-        // A mesh object to hold the result of surface extraction
-        PolyVox::SurfaceMesh<PolyVox::PositionMaterialNormal> polyVoxMesh;
-
+    QtConcurrent::run([entity, voxelSurfaceStyle, chunks, dirtyChunks, chunksVersion]() mutable {
         entity->withReadLock([&] {
+            if (entity->_chunksVersion != chunksVersion) {
+                // the chunks were reset since, extract all of the new ones
+                chunksVersion = entity->_chunksVersion;
+                chunks = MeshChunks(entity->_meshChunks.size());
+                dirtyChunks.resize(chunks.size());
+                std::iota(dirtyChunks.begin(), dirtyChunks.end(), 0);
+            }
+
             PolyVox::SimpleVolume<uint8_t>* volData = entity->getVolData();
-            switch (voxelSurfaceStyle) {
-                case PolyVoxEntityItem::SURFACE_EDGED_MARCHING_CUBES:
-                case PolyVoxEntityItem::SURFACE_MARCHING_CUBES: {
-                    PolyVox::MarchingCubesSurfaceExtractor<PolyVox::SimpleVolume<uint8_t>> surfaceExtractor
-                        (volData, volData->getEnclosingRegion(), &polyVoxMesh);
-                    surfaceExtractor.execute();
-                    break;
+            ivec3 numChunks = getNumChunks(volData);
+            QtConcurrent::blockingMap(dirtyChunks, [&](int& index) {
+                PolyVox::Region region = getChunkRegion(volData, numChunks, index);
+
+                // A mesh object to hold the result of surface extraction
+                PolyVox::SurfaceMesh<PolyVox::PositionMaterialNormal> polyVoxMesh;
+                switch (voxelSurfaceStyle) {
+                    case PolyVoxEntityItem::SURFACE_EDGED_MARCHING_CUBES:
+                    case PolyVoxEntityItem::SURFACE_MARCHING_CUBES: {
+                        PolyVox::MarchingCubesSurfaceExtractor<PolyVox::SimpleVolume<uint8_t>> surfaceExtractor
+                            (volData, region, &polyVoxMesh);
+                        surfaceExtractor.execute();
+                        break;
+                    }
+                    case PolyVoxEntityItem::SURFACE_EDGED_CUBIC:
+                    case PolyVoxEntityItem::SURFACE_CUBIC: {
+                        PolyVox::CubicSurfaceExtractorWithNormals<PolyVox::SimpleVolume<uint8_t>> surfaceExtractor
+                            (volData, region, &polyVoxMesh);
+                        surfaceExtractor.execute();
+                        break;
+                    }
                 }
-                case PolyVoxEntityItem::SURFACE_EDGED_CUBIC:
-                case PolyVoxEntityItem::SURFACE_CUBIC: {
-                    PolyVox::CubicSurfaceExtractorWithNormals<PolyVox::SimpleVolume<uint8_t>> surfaceExtractor
-                        (volData, volData->getEnclosingRegion(), &polyVoxMesh);
-                    surfaceExtractor.execute();
-                    break;
+
+                // the extracted vertices are relative to the region
+                auto chunk = std::make_shared<MeshChunk>();
+                chunk->vertices = polyVoxMesh.getRawVertexData();
+                PolyVox::Vector3DFloat regionOffset(region.getLowerCorner().getX(), region.getLowerCorner().getY(),
+                                                    region.getLowerCorner().getZ());
+                for (auto& vertex : chunk->vertices) {
+                    vertex.setPosition(vertex.getPosition() + regionOffset);
                 }
-            }
+                chunk->indices = polyVoxMesh.getIndices();
+                chunks[index] = chunk;
+            });
         });
 
+        // put the chunks together
+        std::vector<PolyVox::PositionMaterialNormal> vecVertices;
+        std::vector<uint32_t> vecIndices;
+        for (const auto& chunk : chunks) {
+            if (!chunk) {
+                continue;
+            }
+            uint32_t baseVertex = (uint32_t)vecVertices.size();
+            vecVertices.insert(vecVertices.end(), chunk->vertices.begin(), chunk->vertices.end());
+            for (uint32_t index : chunk->indices) {
+                vecIndices.push_back(baseVertex + index);
+            }
+        }
+
         // convert PolyVox mesh to a Sam mesh
-        const std::vector<uint32_t>& vecIndices = polyVoxMesh.getIndices();
+        graphics::MeshPointer mesh(std::make_shared<graphics::Mesh>());
         auto indexBuffer = std::make_shared<gpu::Buffer>(vecIndices.size() * sizeof(uint32_t),
                                                          (gpu::Byte*)vecIndices.data());
         auto indexBufferPtr = gpu::BufferPointer(indexBuffer);
         gpu::BufferView indexBufferView(indexBufferPtr, gpu::Element(gpu::SCALAR, gpu::UINT32, gpu::INDEX));
         mesh->setIndexBuffer(indexBufferView);
 
-        const std::vector<PolyVox::PositionMaterialNormal>& vecVertices = polyVoxMesh.getRawVertexData();
         auto vertexBuffer = std::make_shared<gpu::Buffer>(vecVertices.size() * sizeof(PolyVox::PositionMaterialNormal),
                                                           (gpu::Byte*)vecVertices.data());
         auto vertexBufferPtr = gpu::BufferPointer(vertexBuffer);
@@ -1347,13 +1462,20 @@ void RenderablePolyVoxEntityItem::recomputeMesh() {
                                              graphics::Mesh::TRIANGLES)); // topology
         mesh->setPartBuffer(gpu::BufferView(new gpu::Buffer(parts.size() * sizeof(graphics::Mesh::Part), (gpu::Byte*) parts.data()),
                                             gpu::Element::PART_DRAWCALL));
-        entity->setMesh(mesh);
+        entity->setMesh(mesh, chunks, dirtyChunks, chunksVersion);
     });
 }
 
-void RenderablePolyVoxEntityItem::setMesh(graphics::MeshPointer mesh) {
+void RenderablePolyVoxEntityItem::setMesh(graphics::MeshPointer mesh, const MeshChunks& chunks,
+                                          const std::vector<int>& bakedChunks, int chunksVersion) {
     // this catches the payload from recomputeMesh
     withWriteLock([&] {
+        if (chunksVersion == _chunksVersion) {
+            _meshChunks = chunks;
+            for (int index : bakedChunks) {
+                _shapeChunkIsDirty[index] = true;
+            }
+        }
         if (!_collisionless) {
             _flags |= Simulation::DIRTY_SHAPE | Simulation::DIRTY_MASS;
         }
@@ -1369,139 +1491,152 @@ void RenderablePolyVoxEntityItem::setMesh(graphics::MeshPointer mesh) {
 
 void RenderablePolyVoxEntityItem::computeShapeInfoWorker() {
     // this creates a collision-shape for the physics engine.  The shape comes from
-    // _volData for cubic extractors and from _mesh for marching-cube extractors
+    // _volData for cubic extractors and from the mesh for marching-cube extractors,
+    // only the chunks whose mesh has been baked again are redone
 
     EntityItemPointer entity = getThisPointer();
 
     PolyVoxSurfaceStyle voxelSurfaceStyle;
     glm::vec3 voxelVolumeSize;
-    graphics::MeshPointer mesh;
+    MeshChunks meshChunks;
+    ShapeChunks chunks;
+    std::vector<int> dirtyChunks;
+    int chunksVersion;
 
-    withReadLock([&] {
+    withWriteLock([&] {
         voxelSurfaceStyle = _voxelSurfaceStyle;
         voxelVolumeSize = _voxelVolumeSize;
-        mesh = _mesh;
+        meshChunks = _meshChunks;
+        chunks = _shapeChunks;
+        chunksVersion = _chunksVersion;
+        for (int i = 0; i < (int)_shapeChunkIsDirty.size(); i++) {
+            if (_shapeChunkIsDirty[i]) {
+                _shapeChunkIsDirty[i] = false;
+                dirtyChunks.push_back(i);
+            }
+        }
     });
 
-    QtConcurrent::run([entity, voxelSurfaceStyle, voxelVolumeSize, mesh] {
+    QtConcurrent::run([entity, voxelSurfaceStyle, voxelVolumeSize, meshChunks, chunks, dirtyChunks, chunksVersion]() mutable {
         auto polyVoxEntity = std::static_pointer_cast<RenderablePolyVoxEntityItem>(entity);
-        QVector<QVector<glm::vec3>> pointCollection;
-        AABox box;
-        glm::mat4 vtoM = std::static_pointer_cast<RenderablePolyVoxEntityItem>(entity)->voxelToLocalMatrix();
 
-        if (voxelSurfaceStyle == PolyVoxEntityItem::SURFACE_MARCHING_CUBES ||
-            voxelSurfaceStyle == PolyVoxEntityItem::SURFACE_EDGED_MARCHING_CUBES) {
-            // pull each triangle in the mesh into a polyhedron which can be collided with
-            unsigned int i = 0;
-
-            const gpu::BufferView& vertexBufferView = mesh->getVertexBuffer();
-            const gpu::BufferView& indexBufferView = mesh->getIndexBuffer();
-
-            gpu::BufferView::Iterator<const uint32_t> it = indexBufferView.cbegin<uint32_t>();
-            while (it != indexBufferView.cend<uint32_t>()) {
-                uint32_t p0Index = *(it++);
-                uint32_t p1Index = *(it++);
-                uint32_t p2Index = *(it++);
-
-                const glm::vec3& p0 = vertexBufferView.get<const glm::vec3>(p0Index);
-                const glm::vec3& p1 = vertexBufferView.get<const glm::vec3>(p1Index);
-                const glm::vec3& p2 = vertexBufferView.get<const glm::vec3>(p2Index);
-
-                glm::vec3 av = (p0 + p1 + p2) / 3.0f; // center of the triangular face
-                glm::vec3 normal = glm::normalize(glm::cross(p1 - p0, p2 - p0));
-                glm::vec3 p3 = av - normal * MARCHING_CUBE_COLLISION_HULL_OFFSET;
-
-                glm::vec3 p0Model = glm::vec3(vtoM * glm::vec4(p0, 1.0f));
-                glm::vec3 p1Model = glm::vec3(vtoM * glm::vec4(p1, 1.0f));
-                glm::vec3 p2Model = glm::vec3(vtoM * glm::vec4(p2, 1.0f));
-                glm::vec3 p3Model = glm::vec3(vtoM * glm::vec4(p3, 1.0f));
-
-                box += p0Model;
-                box += p1Model;
-                box += p2Model;
-                box += p3Model;
-
-                QVector<glm::vec3> pointsInPart;
-                pointsInPart << p0Model;
-                pointsInPart << p1Model;
-                pointsInPart << p2Model;
-                pointsInPart << p3Model;
-                // add next convex hull
-                QVector<glm::vec3> newMeshPoints;
-                pointCollection << newMeshPoints;
-                // add points to the new convex hull
-                pointCollection[i++] << pointsInPart;
+        polyVoxEntity->withReadLock([&] {
+            if (polyVoxEntity->_chunksVersion != chunksVersion) {
+                // the chunks were reset since, redo all of the new ones
+                chunksVersion = polyVoxEntity->_chunksVersion;
+                meshChunks = polyVoxEntity->_meshChunks;
+                chunks = ShapeChunks(meshChunks.size());
+                dirtyChunks.resize(chunks.size());
+                std::iota(dirtyChunks.begin(), dirtyChunks.end(), 0);
             }
-        } else {
-            unsigned int i = 0;
-            polyVoxEntity->forEachVoxelValue(voxelVolumeSize, [&](const ivec3& v, uint8_t value) {
-                if (value > 0) {
-                    const auto& x = v.x;
-                    const auto& y = v.y;
-                    const auto& z = v.z;
-                    if (glm::all(glm::greaterThan(v, ivec3(0))) &&
-                        glm::all(glm::lessThan(v, ivec3(voxelVolumeSize) - 1)) &&
-                        (polyVoxEntity->getVoxelInternal({ x - 1, y, z }) > 0) &&
-                        (polyVoxEntity->getVoxelInternal({ x, y - 1, z }) > 0) &&
-                        (polyVoxEntity->getVoxelInternal({ x, y, z - 1 }) > 0) &&
-                        (polyVoxEntity->getVoxelInternal({ x + 1, y, z }) > 0) &&
-                        (polyVoxEntity->getVoxelInternal({ x, y + 1, z }) > 0) &&
-                        (polyVoxEntity->getVoxelInternal({ x, y, z + 1 }) > 0)) {
-                        // this voxel has neighbors in every cardinal direction, so there's no need
-                        // to include it in the collision hull.
-                        return;
-                    }
-
-                    QVector<glm::vec3> pointsInPart;
 
-                    float offL = -0.5f;
-                    float offH = 0.5f;
-                    if (voxelSurfaceStyle == PolyVoxEntityItem::SURFACE_EDGED_CUBIC) {
-                        offL += 1.0f;
-                        offH += 1.0f;
+            PolyVox::SimpleVolume<uint8_t>* volData = polyVoxEntity->getVolData();
+            ivec3 numChunks = getNumChunks(volData);
+            QtConcurrent::blockingMap(dirtyChunks, [&](int& index) {
+                auto chunk = std::make_shared<ShapeChunk>();
+
+                if (voxelSurfaceStyle == PolyVoxEntityItem::SURFACE_MARCHING_CUBES ||
+                    voxelSurfaceStyle == PolyVoxEntityItem::SURFACE_EDGED_MARCHING_CUBES) {
+                    // pull each triangle in the mesh into a polyhedron which can be collided with
+                    const auto& meshChunk = meshChunks[index];
+                    for (size_t i = 0; meshChunk && i + 2 < meshChunk->indices.size(); i += 3) {
+                        const auto& v0 = meshChunk->vertices[meshChunk->indices[i]].getPosition();
+                        const auto& v1 = meshChunk->vertices[meshChunk->indices[i + 1]].getPosition();
+                        const auto& v2 = meshChunk->vertices[meshChunk->indices[i + 2]].getPosition();
+                        glm::vec3 p0(v0.getX(), v0.getY(), v0.getZ());
+                        glm::vec3 p1(v1.getX(), v1.getY(), v1.getZ());
+                        glm::vec3 p2(v2.getX(), v2.getY(), v2.getZ());
+
+                        glm::vec3 av = (p0 + p1 + p2) / 3.0f; // center of the triangular face
+                        glm::vec3 normal = glm::normalize(glm::cross(p1 - p0, p2 - p0));
+                        glm::vec3 p3 = av - normal * MARCHING_CUBE_COLLISION_HULL_OFFSET;
+
+                        QVector<glm::vec3> pointsInPart;
+                        pointsInPart << p0;
+                        pointsInPart << p1;
+                        pointsInPart << p2;
+                        pointsInPart << p3;
+                        // add next convex hull
+                        chunk->points << pointsInPart;
                     }
+                } else {
+                    // the voxels of the chunk, in the coordinates of _volData, which has an extra layer around the
+                    // user's voxels if it's edged
+                    PolyVox::Region region = getChunkRegion(volData, numChunks, index);
+                    ivec3 edgeOffset = ivec3(voxelSurfaceStyle == PolyVoxEntityItem::SURFACE_EDGED_CUBIC ? 1 : 0);
+                    loop3(toIvec3(region.getLowerCorner()), toIvec3(region.getUpperCorner()), [&](const ivec3& position) {
+                        ivec3 v = position - edgeOffset;
+                        if (polyVoxEntity->getVoxelInternal(v) == 0) {
+                            return;
+                        }
+                        const auto& x = v.x;
+                        const auto& y = v.y;
+                        const auto& z = v.z;
+                        if (glm::all(glm::greaterThan(v, ivec3(0))) &&
+                            glm::all(glm::lessThan(v, ivec3(voxelVolumeSize) - 1)) &&
+                            (polyVoxEntity->getVoxelInternal({ x - 1, y, z }) > 0) &&
+                            (polyVoxEntity->getVoxelInternal({ x, y - 1, z }) > 0) &&
+                            (polyVoxEntity->getVoxelInternal({ x, y, z - 1 }) > 0) &&
+                            (polyVoxEntity->getVoxelInternal({ x + 1, y, z }) > 0) &&
+                            (polyVoxEntity->getVoxelInternal({ x, y + 1, z }) > 0) &&
+                            (polyVoxEntity->getVoxelInternal({ x, y, z + 1 }) > 0)) {
+                            // this voxel has neighbors in every cardinal direction, so there's no need
+                            // to include it in the collision hull.
+                            return;
+                        }
 
-                    glm::vec3 p000 = glm::vec3(vtoM * glm::vec4(x + offL, y + offL, z + offL, 1.0f));
-                    glm::vec3 p001 = glm::vec3(vtoM * glm::vec4(x + offL, y + offL, z + offH, 1.0f));
-                    glm::vec3 p010 = glm::vec3(vtoM * glm::vec4(x + offL, y + offH, z + offL, 1.0f));
-                    glm::vec3 p011 = glm::vec3(vtoM * glm::vec4(x + offL, y + offH, z + offH, 1.0f));
-                    glm::vec3 p100 = glm::vec3(vtoM * glm::vec4(x + offH, y + offL, z + offL, 1.0f));
-                    glm::vec3 p101 = glm::vec3(vtoM * glm::vec4(x + offH, y + offL, z + offH, 1.0f));
-                    glm::vec3 p110 = glm::vec3(vtoM * glm::vec4(x + offH, y + offH, z + offL, 1.0f));
-                    glm::vec3 p111 = glm::vec3(vtoM * glm::vec4(x + offH, y + offH, z + offH, 1.0f));
-
-                    box += p000;
-                    box += p001;
-                    box += p010;
-                    box += p011;
-                    box += p100;
-                    box += p101;
-                    box += p110;
-                    box += p111;
-
-                    pointsInPart << p000;
-                    pointsInPart << p001;
-                    pointsInPart << p010;
-                    pointsInPart << p011;
-                    pointsInPart << p100;
-                    pointsInPart << p101;
-                    pointsInPart << p110;
-                    pointsInPart << p111;
-
-                    // add next convex hull
-                    QVector<glm::vec3> newMeshPoints;
-                    pointCollection << newMeshPoints;
-                    // add points to the new convex hull
-                    pointCollection[i++] << pointsInPart;
+                        glm::vec3 center(position);
+                        QVector<glm::vec3> pointsInPart;
+                        pointsInPart << center + glm::vec3(-0.5f, -0.5f, -0.5f);
+                        pointsInPart << center + glm::vec3(-0.5f, -0.5f, 0.5f);
+                        pointsInPart << center + glm::vec3(-0.5f, 0.5f, -0.5f);
+                        pointsInPart << center + glm::vec3(-0.5f, 0.5f, 0.5f);
+                        pointsInPart << center + glm::vec3(0.5f, -0.5f, -0.5f);
+                        pointsInPart << center + glm::vec3(0.5f, -0.5f, 0.5f);
+                        pointsInPart << center + glm::vec3(0.5f, 0.5f, -0.5f);
+                        pointsInPart << center + glm::vec3(0.5f, 0.5f, 0.5f);
+
+                        // add next convex hull
+                        chunk->points << pointsInPart;
+                    });
                 }
+
+                chunks[index] = chunk;
             });
+        });
+
+        // put the chunks together, in model space
+        QVector<QVector<glm::vec3>> pointCollection;
+        AABox box;
+        glm::mat4 vtoM = polyVoxEntity->voxelToLocalMatrix();
+        for (const auto& chunk : chunks) {
+            if (!chunk) {
+                continue;
+            }
+            for (const auto& points : chunk->points) {
+                QVector<glm::vec3> pointsInPart;
+                pointsInPart.reserve(points.size());
+                for (const auto& point : points) {
+                    glm::vec3 pointModel = glm::vec3(vtoM * glm::vec4(point, 1.0f));
+                    box += pointModel;
+                    pointsInPart << pointModel;
+                }
+                pointCollection << pointsInPart;
+            }
         }
-        polyVoxEntity->setCollisionPoints(pointCollection, box);
+        polyVoxEntity->setCollisionPoints(pointCollection, box, chunks, chunksVersion);
     });
 }
 
-void RenderablePolyVoxEntityItem::setCollisionPoints(ShapeInfo::PointCollection pointCollection, AABox box) {
+void RenderablePolyVoxEntityItem::setCollisionPoints(ShapeInfo::PointCollection pointCollection, AABox box,
+                                                     const ShapeChunks& chunks, int chunksVersion) {
     // this catches the payload from computeShapeInfoWorker
+    withWriteLock([&] {
+        if (chunksVersion == _chunksVersion) {
+            _shapeChunks = chunks;
+        }
+    });
+
     if (pointCollection.isEmpty()) {
         EntityItem::computeShapeInfo(_shapeInfo);
         withWriteLock([&] {
@@ -119,8 +119,15 @@ public:
     void forEachVoxelValue(const ivec3& voxelSize, std::function<void(const ivec3&, uint8_t)> thunk);
     QByteArray volDataToArray(quint16 voxelXSize, quint16 voxelYSize, quint16 voxelZSize) const;
 
-    void setMesh(graphics::MeshPointer mesh);
-    void setCollisionPoints(ShapeInfo::PointCollection points, AABox box);
+    // The surface and the collision hulls are made of chunks of the volume, kept between bakes so that an edit only
+    // redoes the chunks around the voxels it changed
+    struct MeshChunk;
+    struct ShapeChunk;
+    using MeshChunks = std::vector<std::shared_ptr<const MeshChunk>>;
+    using ShapeChunks = std::vector<std::shared_ptr<const ShapeChunk>>;
+
+    void setMesh(graphics::MeshPointer mesh, const MeshChunks& chunks, const std::vector<int>& bakedChunks, int chunksVersion);
+    void setCollisionPoints(ShapeInfo::PointCollection points, AABox box, const ShapeChunks& chunks, int chunksVersion);
     PolyVox::SimpleVolume<uint8_t>* getVolData() { return _volData.get(); }
 
     uint8_t getVoxelInternal(const ivec3& v) const;
@@ -146,6 +153,9 @@ private:
     void startUpdates();
     void stopUpdates();
 
+    void resetChunks();
+    void markChunksDirty(const ivec3& v);
+
     void recomputeMesh();
     void cacheNeighbors();
     void copyUpperEdgesFromNeighbors();
@@ -170,6 +180,12 @@ private:
 
     ShapeInfo _shapeInfo;
 
+    MeshChunks _meshChunks;
+    ShapeChunks _shapeChunks;
+    std::vector<bool> _meshChunkIsDirty;
+    std::vector<bool> _shapeChunkIsDirty; // set when the mesh chunk it's made from has been baked again
+    int _chunksVersion { 0 }; // incremented when the chunks are reset, so that the bakes started before are dropped
+
     std::shared_ptr<PolyVox::SimpleVolume<uint8_t>> _volData;
     int _onCount; // how many non-zero voxels are in _volData
 
@@ -9,6 +9,8 @@
 
 #include "RenderableWebEntityItem.h"
 #include <atomic>
+#include <mutex>
+#include <unordered_map>
 
 #include <QtCore/QTimer>
 #include <QtGui/QOpenGLContext>
@@ -53,12 +55,29 @@ static uint64_t MAX_NO_RENDER_INTERVAL = 30 * USECS_PER_SECOND;
 
 static uint8_t YOUTUBE_MAX_FPS = 30;
 
+// A web-view that wasn't rendered since the last timeout stops rendering, and keeps showing its last frame
+static uint64_t MAX_NO_RENDER_PAUSE_INTERVAL = USECS_PER_SECOND / 2;
+
+// The frame rates all the visible web-views ask for are scaled down to fit in this budget, a web-view gets its full frame
+// rate when it's at least FULL_FPS_ANGULAR_SIZE across (in meters per meter away), and proportionally less when it's smaller
+static const float WEB_FPS_BUDGET = 180.0f;
+static const float FULL_FPS_ANGULAR_SIZE = 0.5f;
+static const uint8_t MIN_THROTTLED_FPS = 2;
+
+static std::mutex _webFPSDemandsMutex;
+static std::unordered_map<const WebEntityRenderer*, float> _webFPSDemands;
+
 // Don't allow more than 20 concurrent web views
 static std::atomic<uint32_t> _currentWebCount(0);
 static const uint32_t MAX_CONCURRENT_WEB_VIEWS = 20;
 
 static QTouchDevice _touchDevice;
 
+static void removeWebFPSDemand(const WebEntityRenderer* renderer) {
+    std::lock_guard<std::mutex> lock(_webFPSDemandsMutex);
+    _webFPSDemands.erase(renderer);
+}
+
 WebEntityRenderer::ContentType WebEntityRenderer::getContentType(const QString& urlString) {
     if (urlString.isEmpty()) {
         return ContentType::NoContent;
@@ -92,6 +111,7 @@ WebEntityRenderer::WebEntityRenderer(const EntityItemPointer& entity) : Parent(e
 
     _timer.setInterval(MSECS_PER_SECOND);
     connect(&_timer, &QTimer::timeout, this, &WebEntityRenderer::onTimeout);
+    _timer.start();
 }
 
 WebEntityRenderer::~WebEntityRenderer() {
@@ -128,15 +148,72 @@ bool WebEntityRenderer::needsRenderUpdateFromTypedEntity(const TypedEntityPointe
 
 void WebEntityRenderer::onTimeout() {
     uint64_t lastRenderTime;
-    if (!resultWithReadLock<bool>([&] {
+    float angularSize;
+    if (!resultWithWriteLock<bool>([&] {
         lastRenderTime = _lastRenderTime;
+        angularSize = _renderedAngularSize;
+        _renderedAngularSize = 0.0f;
         return (_lastRenderTime != 0 && (bool)_webSurface);
     })) {
+        removeWebFPSDemand(this);
         return;
     }
 
-    if (usecTimestampNow() - lastRenderTime > MAX_NO_RENDER_INTERVAL) {
+    uint64_t noRenderInterval = usecTimestampNow() - lastRenderTime;
+    if (noRenderInterval > MAX_NO_RENDER_INTERVAL && _contentType == ContentType::HtmlContent) {
+        // QML surfaces (e.g. the tablet) hold state that can't be rebuilt, only pages are released, and reloaded once seen again
         destroyWebSurface();
+        withWriteLock([&] {
+            _tryingToBuildURL = QString();
+            _sourceURL = QString();
+            _releasedWhileIdle = true;
+        });
+        return;
+    }
+
+    if (noRenderInterval > MAX_NO_RENDER_PAUSE_INTERVAL) {
+        removeWebFPSDemand(this);
+        if (!_surfacePaused) {
+            _webSurface->pause();
+            _surfacePaused = true;
+        }
+        return;
+    }
+
+    if (_surfacePaused) {
+        _webSurface->resume();
+        _surfacePaused = false;
+    }
+
+    // surfaces that never asked for a frame rate (QML content) keep the one they were acquired with
+    if (_requestedFPS == 0) {
+        return;
+    }
+
+    float demand = _requestedFPS * glm::clamp(angularSize / FULL_FPS_ANGULAR_SIZE, 0.0f, 1.0f);
+    float totalDemand = 0.0f;
+    {
+        std::lock_guard<std::mutex> lock(_webFPSDemandsMutex);
+        _webFPSDemands[this] = demand;
+        for (const auto& webFPSDemand : _webFPSDemands) {
+            totalDemand += webFPSDemand.second;
+        }
+    }
+    if (totalDemand > WEB_FPS_BUDGET) {
+        demand *= WEB_FPS_BUDGET / totalDemand;
+    }
+    _throttledFPS = (uint8_t)glm::clamp(demand, (float)MIN_THROTTLED_FPS, (float)_requestedFPS);
+    updateSurfaceFPS();
+}
+
+void WebEntityRenderer::updateSurfaceFPS() {
+    uint8_t fps = _requestedFPS;
+    if (_throttledFPS != 0 && _throttledFPS < fps) {
+        fps = _throttledFPS;
+    }
+    if (_webSurface && fps != 0 && fps != _surfaceFPS) {
+        _webSurface->setMaxFps(fps);
+        _surfaceFPS = fps;
     }
 }
 
@@ -196,7 +273,8 @@ void WebEntityRenderer::doRenderUpdateSynchronousTyped(const ScenePointer& scene
                     _webSurface->getRootItem()->setProperty(USE_BACKGROUND_PROPERTY, _useBackground);
                     _webSurface->getRootItem()->setProperty(USER_AGENT_PROPERTY, _userAgent);
                     _webSurface->getSurfaceContext()->setContextProperty(GLOBAL_POSITION_PROPERTY, vec3toVariant(_contextPosition));
-                    _webSurface->setMaxFps((QUrl(newSourceURL).host().endsWith("youtube.com", Qt::CaseInsensitive)) ? YOUTUBE_MAX_FPS : _maxFPS);
+                    _requestedFPS = (QUrl(newSourceURL).host().endsWith("youtube.com", Qt::CaseInsensitive)) ? YOUTUBE_MAX_FPS : _maxFPS;
+                    updateSurfaceFPS();
                     ::hifi::scripting::setLocalAccessSafeThread(false);
                     _sourceURL = newSourceURL;
                 } else if (_contentType != ContentType::HtmlContent) {
@@ -217,10 +295,11 @@ void WebEntityRenderer::doRenderUpdateSynchronousTyped(const ScenePointer& scene
                         // We special case YouTube URLs since we know they are videos that we should play with at least 30 FPS.
                         // FIXME this doesn't handle redirects or shortened URLs, consider using a signaling method from the web entity
                         if (QUrl(_sourceURL).host().endsWith("youtube.com", Qt::CaseInsensitive)) {
-                            _webSurface->setMaxFps(YOUTUBE_MAX_FPS);
+                            _requestedFPS = YOUTUBE_MAX_FPS;
                         } else {
-                            _webSurface->setMaxFps(maxFPS);
+                            _requestedFPS = maxFPS;
                         }
+                        updateSurfaceFPS();
                         _maxFPS = maxFPS;
                     }
                 }
@@ -268,10 +347,31 @@ void WebEntityRenderer::doRenderUpdateSynchronousTyped(const ScenePointer& scene
 
 void WebEntityRenderer::doRender(RenderArgs* args) {
     PerformanceTimer perfTimer("WebEntityRenderer::render");
+    bool releasedWhileIdle = false;
     withWriteLock([&] {
         _lastRenderTime = usecTimestampNow();
+        if (args->_renderMode != RenderArgs::RenderMode::SHADOW_RENDER_MODE) {
+            float distance = glm::distance(args->getViewFrustum().getPosition(), _renderTransform.getTranslation());
+            glm::vec3 dimensions = _renderTransform.getScale();
+            float size = glm::max(dimensions.x, dimensions.y);
+            _renderedAngularSize = glm::max(_renderedAngularSize, size / glm::max(distance, EPSILON));
+        }
+        releasedWhileIdle = _releasedWhileIdle;
+        _releasedWhileIdle = false;
     });
 
+    // a paused surface is resumed right away rather than on the next timeout, so that it doesn't show a stale frame
+    if (releasedWhileIdle) {
+        emit requestRenderUpdate();
+    } else if (_surfacePaused) {
+        QMetaObject::invokeMethod(this, [this] {
+            if (_webSurface && _surfacePaused) {
+                _webSurface->resume();
+                _surfacePaused = false;
+            }
+        }, Qt::QueuedConnection);
+    }
+
     // Try to update the texture
     OffscreenQmlSurface::TextureAndFence newTextureAndFence;
     QSize windowSize;
@@ -341,6 +441,9 @@ void WebEntityRenderer::buildWebSurface(const EntityItemPointer& entity, const Q
     WebEntityRenderer::acquireWebSurface(newSourceURL, isHTML, _webSurface, _cachedWebSurface);
     _fadeStartTime = usecTimestampNow();
     _webSurface->resume();
+    _surfacePaused = false;
+    _surfaceFPS = 0;
+    _throttledFPS = 0;
 
     _connections.push_back(QObject::connect(this, &WebEntityRenderer::scriptEventReceived, _webSurface.data(), &OffscreenQmlSurface::emitScriptEvent));
     _connections.push_back(QObject::connect(_webSurface.data(), &OffscreenQmlSurface::webEventReceived, this, &WebEntityRenderer::webEventReceived));
@@ -363,6 +466,7 @@ void WebEntityRenderer::destroyWebSurface() {
             }
             WebEntityRenderer::releaseWebSurface(webSurface, _cachedWebSurface, _connections);
         }
+        removeWebFPSDemand(this);
 
         _contentType = ContentType::NoContent;
     });
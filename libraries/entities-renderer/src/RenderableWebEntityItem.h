@@ -10,6 +10,8 @@
 #ifndef hifi_RenderableWebEntityItem_h
 #define hifi_RenderableWebEntityItem_h
 
+#include <atomic>
+
 #include <QtCore/QSharedPointer>
 #include <WebEntityItem.h>
 #include "RenderableEntityItem.h"
@@ -74,6 +76,7 @@ private:
     void onTimeout();
     void buildWebSurface(const EntityItemPointer& entity, const QString& newSourceURL);
     void destroyWebSurface();
+    void updateSurfaceFPS();
     glm::vec2 getWindowSize(const TypedEntityPointer& entity) const;
 
     int _geometryId{ 0 };
@@ -107,6 +110,14 @@ private:
     QTimer _timer;
     uint64_t _lastRenderTime { 0 };
 
+    // how large the surface appeared since the last timeout, its frame rate is throttled down when it's small or off screen
+    float _renderedAngularSize { 0.0f };
+    uint8_t _requestedFPS { 0 };
+    uint8_t _throttledFPS { 0 };
+    uint8_t _surfaceFPS { 0 };
+    std::atomic<bool> _surfacePaused { false };
+    bool _releasedWhileIdle { false };
+
     std::vector<QMetaObject::Connection> _connections;
 
     static std::function<void(QString, bool, QSharedPointer<OffscreenQmlSurface>&, bool&)> _acquireWebSurfaceOperator;
@@ -14,6 +14,7 @@
 #include <OctreeUtils.h>
 
 #include "EntityPriorityQueue.h"
+#include "EntityTree.h"
 
 DiffTraversal::Waypoint::Waypoint(EntityTreeElementPointer& element) : _nextIndex(0) {
     assert(element);
@@ -34,10 +35,14 @@ void DiffTraversal::Waypoint::getNextVisibleElementFirstTime(DiffTraversal::Visi
     } else if (_nextIndex < NUMBER_OF_CHILDREN) {
         EntityTreeElementPointer element = _weakElement.lock();
         if (element) {
+            if (_nextIndex == 0) {
+                testChildren(*element, view);
+            }
             while (_nextIndex < NUMBER_OF_CHILDREN) {
-                EntityTreeElementPointer nextElement = element->getChildAtIndex(_nextIndex);
+                int childIndex = _nextIndex;
+                EntityTreeElementPointer nextElement = element->getChildAtIndex(childIndex);
                 ++_nextIndex;
-                if (nextElement && view.shouldTraverseElement(*nextElement)) {
+                if (nextElement && shouldTraverseChild(childIndex, *nextElement, view)) {
                     next.element = nextElement;
                     return;
                 }
@@ -88,10 +93,14 @@ void DiffTraversal::Waypoint::getNextVisibleElementDifferential(DiffTraversal::V
     } else if (_nextIndex < NUMBER_OF_CHILDREN) {
         EntityTreeElementPointer element = _weakElement.lock();
         if (element) {
+            if (_nextIndex == 0) {
+                testChildren(*element, view);
+            }
             while (_nextIndex < NUMBER_OF_CHILDREN) {
-                EntityTreeElementPointer nextElement = element->getChildAtIndex(_nextIndex);
+                int childIndex = _nextIndex;
+                EntityTreeElementPointer nextElement = element->getChildAtIndex(childIndex);
                 ++_nextIndex;
-                if (nextElement && view.shouldTraverseElement(*nextElement)) {
+                if (nextElement && shouldTraverseChild(childIndex, *nextElement, view)) {
                     next.element = nextElement;
                     return;
                 }
@@ -101,6 +110,39 @@ void DiffTraversal::Waypoint::getNextVisibleElementDifferential(DiffTraversal::V
     next.element.reset();
 }
 
+void DiffTraversal::Waypoint::testChildren(const EntityTreeElement& element, const DiffTraversal::View& view) {
+    AACube cubes[NUMBER_OF_CHILDREN];
+    int childIndices[NUMBER_OF_CHILDREN];
+    int numChildren = 0;
+    for (int i = 0; i < NUMBER_OF_CHILDREN; ++i) {
+        EntityTreeElementPointer child = element.getChildAtIndex(i);
+        if (child) {
+            cubes[numChildren] = child->getAACube();
+            childIndices[numChildren] = i;
+            ++numChildren;
+        }
+    }
+
+    uint8_t traversable = view.shouldTraverseCubes(cubes, numChildren);
+    _testedChildren = 0;
+    _traversableChildren = 0;
+    for (int i = 0; i < numChildren; ++i) {
+        _testedChildren |= 1 << childIndices[i];
+        if (traversable & (1 << i)) {
+            _traversableChildren |= 1 << childIndices[i];
+        }
+    }
+}
+
+bool DiffTraversal::Waypoint::shouldTraverseChild(int childIndex, const EntityTreeElement& child,
+        const DiffTraversal::View& view) const {
+    // a child's cube only depends on its place in the tree, but a child added since testChildren wasn't tested
+    if (_testedChildren & (1 << childIndex)) {
+        return (_traversableChildren & (1 << childIndex)) != 0;
+    }
+    return view.shouldTraverseElement(child);
+}
+
 bool DiffTraversal::View::usesViewFrustums() const {
     return !viewFrustums.empty();
 }
@@ -136,6 +178,26 @@ float DiffTraversal::View::computePriority(const EntityItemPointer& entity) cons
         return PrioritizedEntity::WHEN_IN_DOUBT_PRIORITY;
     }
 
+    // the children of a LOD proxy are only sent to views near it, the others get the proxy instead
+    auto parent = entity->getParentPointer(success);
+    if (success && parent && parent->getNestableType() == NestableType::Entity) {
+        auto proxy = std::static_pointer_cast<EntityItem>(parent);
+        float proxyDistance = proxy->getLodProxyDistance();
+        if (proxyDistance > 0.0f) {
+            glm::vec3 proxyPosition = proxy->getWorldPosition();
+            bool near = false;
+            for (const auto& frustum : viewFrustums) {
+                if (glm::distance(frustum.getPosition(), proxyPosition) < proxyDistance) {
+                    near = true;
+                    break;
+                }
+            }
+            if (!near) {
+                return PrioritizedEntity::DO_NOT_SEND;
+            }
+        }
+    }
+
     auto center = cube.calcCenter(); // center of bounding sphere
     auto radius = 0.5f * SQRT_THREE * cube.getScale(); // radius of bounding sphere
 
@@ -188,6 +250,18 @@ bool DiffTraversal::View::shouldTraverseElement(const EntityTreeElement& element
     });
 }
 
+uint8_t DiffTraversal::View::shouldTraverseCubes(const AACube* cubes, int count) const {
+    if (!usesViewFrustums()) {
+        return (uint8_t)((1 << count) - 1);
+    }
+
+    uint8_t result = 0;
+    for (const auto& frustum : viewFrustums) {
+        result |= frustum.getCubesInView(cubes, count, lodScaleFactor * MIN_ELEMENT_ANGULAR_DIAMETER);
+    }
+    return result;
+}
+
 DiffTraversal::DiffTraversal() {
     const int32_t MIN_PATH_DEPTH = 16;
     _path.reserve(MIN_PATH_DEPTH);
@@ -211,6 +285,12 @@ DiffTraversal::Type DiffTraversal::prepareNewTraversal(const DiffTraversal::View
     // external code should update the _scanElementCallback after calling prepareNewTraversal
     //
 
+    // read before startTime, changes that land in between are visited twice rather than not at all
+    auto tree = root->getTree();
+    EntityTreeChangeJournal::Sequence journalSequence = tree ? tree->getChangeJournal().getHead() : 0;
+    _journaledElements.clear();
+    _useJournal = false;
+
     Type type;
     // If usesViewFrustum changes, treat it as a First traversal
     if (forceFirstPass || _completedView.startTime == 0 || _currentView.usesViewFrustums() != _completedView.usesViewFrustums()) {
@@ -225,6 +305,13 @@ DiffTraversal::Type DiffTraversal::prepareNewTraversal(const DiffTraversal::View
         _getNextVisibleElementCallback = [this](DiffTraversal::VisibleElement& next) {
             _path.back().getNextVisibleElementRepeat(next, _completedView, _completedView.startTime);
         };
+
+        // the changes since the last complete traversal come straight from the journal when it still goes back that far
+        // (the elements it returns always pass the walk's getLastChanged test, so only the view is left to check)
+        if (tree && tree->getIsServer()) {
+            _useJournal = tree->getChangeJournal().getChangedSince(_completedView.journalSequence, _journaledElements,
+                                                                   journalSequence);
+        }
     } else {
         type = Type::Differential;
         _currentView.viewFrustums = view.viewFrustums;
@@ -235,16 +322,38 @@ DiffTraversal::Type DiffTraversal::prepareNewTraversal(const DiffTraversal::View
     }
 
     _path.clear();
-    _path.push_back(DiffTraversal::Waypoint(root));
-    // set root fork's index such that root element returned at getNextElement()
-    _path.back().initRootNextIndex();
+    if (!_useJournal) {
+        _path.push_back(DiffTraversal::Waypoint(root));
+        // set root fork's index such that root element returned at getNextElement()
+        _path.back().initRootNextIndex();
+    }
 
     _currentView.startTime = usecTimestampNow();
+    _currentView.journalSequence = journalSequence;
 
     return type;
 }
 
+void DiffTraversal::getNextJournaledElement(DiffTraversal::VisibleElement& next) {
+    while (!_journaledElements.empty()) {
+        next.element = std::move(_journaledElements.back());
+        _journaledElements.pop_back();
+        if (_completedView.shouldTraverseElement(*next.element)) {
+            return;
+        }
+    }
+    next.element.reset();
+
+    // we've been through everything that changed
+    _useJournal = false;
+    _completedView = _currentView;
+}
+
 void DiffTraversal::getNextVisibleElement(DiffTraversal::VisibleElement& next) {
+    if (_useJournal) {
+        getNextJournaledElement(next);
+        return;
+    }
     if (_path.empty()) {
         next.element.reset();
         return;
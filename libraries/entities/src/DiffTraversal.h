@@ -14,6 +14,7 @@
 
 #include <shared/ConicalViewFrustum.h>
 
+#include "EntityTreeChangeJournal.h"
 #include "EntityTreeElement.h"
 
 // DiffTraversal traverses the tree and applies _scanElementCallback on elements it finds
@@ -33,10 +34,13 @@ public:
         bool isVerySimilar(const View& view) const;
 
         bool shouldTraverseElement(const EntityTreeElement& element) const;
+        // shouldTraverseElement for up to 8 cubes at once, with bit i of the result set for cubes[i]
+        uint8_t shouldTraverseCubes(const AACube* cubes, int count) const;
         float computePriority(const EntityItemPointer& entity) const;
 
         ConicalViewFrustums viewFrustums;
         uint64_t startTime { 0 };
+        EntityTreeChangeJournal::Sequence journalSequence { 0 }; // the tree's change journal head at startTime
         float lodScaleFactor { 1.0f };
     };
 
@@ -53,8 +57,14 @@ public:
         void initRootNextIndex() { _nextIndex = -1; }
 
     protected:
+        // tests the element's children against view together, before walking them
+        void testChildren(const EntityTreeElement& element, const View& view);
+        bool shouldTraverseChild(int childIndex, const EntityTreeElement& child, const View& view) const;
+
         EntityTreeElementWeakPointer _weakElement;
         int8_t _nextIndex;
+        uint8_t _testedChildren { 0 };
+        uint8_t _traversableChildren { 0 };
     };
 
     typedef enum { First, Repeat, Differential } Type;
@@ -66,19 +76,25 @@ public:
     const View& getCurrentView() const { return _currentView; }
 
     uint64_t getStartOfCompletedTraversal() const { return _completedView.startTime; }
-    bool finished() const { return _path.empty(); }
+    bool finished() const { return _path.empty() && !_useJournal; }
 
     void setScanCallback(std::function<void (VisibleElement&)> cb);
     void traverse(uint64_t timeBudget);
 
-    void reset() { _path.clear(); _completedView.startTime = 0; } // resets our state to force a new "First" traversal
+    // resets our state to force a new "First" traversal
+    void reset() { _path.clear(); _journaledElements.clear(); _useJournal = false; _completedView.startTime = 0; }
 
 private:
     void getNextVisibleElement(VisibleElement& next);
+    void getNextJournaledElement(VisibleElement& next);
 
     View _currentView;
     View _completedView;
     std::vector<Waypoint> _path;
+
+    // a Repeat traversal visits the elements the tree journaled as changed, when it can, instead of walking the path
+    std::vector<EntityTreeElementPointer> _journaledElements;
+    bool _useJournal { false };
     std::function<void (VisibleElement&)> _getNextVisibleElementCallback { nullptr };
     std::function<void (VisibleElement&)> _scanElementCallback { [](VisibleElement& e){} };
 };
@@ -0,0 +1,70 @@
+//
+//  EntityCompressionDictionary.cpp
+//  libraries/entities/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityCompressionDictionary.h"
+
+#include <Gzip.h>
+
+// zlib finds the strings at the end of the dictionary with the shortest back references, so the most common go last
+static const char ENTITY_COMPRESSION_DICTIONARY[] =
+    // procedural shaders and particles
+    "{\"ProceduralEntity\":{\"version\":3,\"shaderUrl\":\"\",\"fragmentShaderURL\":\"\",\"vertexShaderURL\":\"\","
+    "\"uniforms\":{},\"channels\":[]}}"
+    "\"emitterShouldTrail\":false,\"particleRadius\":0.1,"
+    // materials
+    "{\"materialVersion\":1,\"materials\":[{\"name\":\"\",\"model\":\"hifi_pbr\",\"albedo\":[1,1,1],"
+    "\"opacity\":1,\"roughness\":1,\"metallic\":0,\"scattering\":0,\"emissive\":[0,0,0],\"unlit\":false,"
+    "\"albedoMap\":\"\",\"normalMap\":\"\",\"roughnessMap\":\"\",\"metallicMap\":\"\",\"emissiveMap\":\"\","
+    "\"occlusionMap\":\"\",\"opacityMap\":\"\",\"lightMap\":\"\",\"defaultFallthrough\":true}]}"
+    "{\"materialVersion\":1,\"materials\":{\"model\":\"hifi_pbr\",\"albedo\":[1,1,1],\"roughness\":1,\"metallic\":0,"
+    "\"albedoMap\":\"\",\"normalMap\":\""
+    // userData that the stock scripts read
+    "{\"grabbableKey\":{\"grabbable\":true,\"kinematic\":false,\"wantsTrigger\":true,\"ignoreIK\":false},"
+    "\"wearable\":{\"joints\":{\"Head\":[{\"x\":0,\"y\":0,\"z\":0},{\"x\":0,\"y\":0,\"z\":0,\"w\":1}]}},"
+    "\"equipHotspots\":[],\"soundURL\":\"\",\"volume\":1,\"loop\":false,\"triggerable\":true}"
+    "{\"grabbableKey\":{\"grabbable\":false}}"
+    "{\"grabbableKey\":{\"grabbable\":true}}"
+    // script and asset URLs
+    "file:///~/serverless/"
+    "atp:/"
+    "mapping:/"
+    "?v=1"
+    ".json.gz"
+    ".json"
+    ".js"
+    ".ktx"
+    ".jpg"
+    ".png"
+    ".gltf"
+    ".glb"
+    ".obj"
+    ".fst"
+    "/baked/"
+    ".baked.fbx"
+    ".fbx"
+    "/scripts/"
+    "/textures/"
+    "/models/"
+    "https://cdn-1.vircadia.com/us-e-1/"
+    "https://content.vircadia.com/eu-c-1/vircadia-assets/"
+    "http://"
+    "https://";
+
+const QByteArray& getEntityCompressionDictionary() {
+    // without the terminating null
+    static const QByteArray dictionary = QByteArray::fromRawData(ENTITY_COMPRESSION_DICTIONARY,
+                                                                 sizeof(ENTITY_COMPRESSION_DICTIONARY) - 1);
+    return dictionary;
+}
+
+uint32_t getEntityCompressionDictionaryID() {
+    static const uint32_t id = getZlibDictionaryID(getEntityCompressionDictionary());
+    return id;
+}
@@ -0,0 +1,29 @@
+//
+//  EntityCompressionDictionary.h
+//  libraries/entities/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_EntityCompressionDictionary_h
+#define vircadia_EntityCompressionDictionary_h
+
+#include <stdint.h>
+
+#include <QtCore/QByteArray>
+
+// A preset dictionary for compressing the sections of EntityData packets.
+//
+// A section is around a kilobyte of entity properties, compressed on its own, which is too little for zlib to find many
+// repeats in. Most of the bytes are strings that are much the same from one entity to the next though: URLs, and the
+// JSON of userData and materialData. Priming the compressor with those lets the first occurrence in a section be a
+// back reference too.
+//
+// The server only compresses against it for viewers whose EntityQuery sent its id, so it can change as long as the id does.
+const QByteArray& getEntityCompressionDictionary();
+uint32_t getEntityCompressionDictionaryID();
+
+#endif // vircadia_EntityCompressionDictionary_h
@@ -11,11 +11,148 @@
 
 #include "EntityEditFilters.h"
 
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include <QThread>
 #include <QUrl>
 
 #include <ResourceManager.h>
 #include <shared/ScriptInitializerMixin.h>
 
+// Copied from ScriptEngine.cpp. We should make this a class method for reuse.
+// Note: I've deliberately stopped short of using ScriptEngine instead of QScriptEngine, as that is out of project scope at this point.
+static bool hasCorrectSyntax(const QScriptProgram& program) {
+    const auto syntaxCheck = QScriptEngine::checkSyntax(program.sourceCode());
+    if (syntaxCheck.state() != QScriptSyntaxCheckResult::Valid) {
+        const auto error = syntaxCheck.errorMessage();
+        const auto line = QString::number(syntaxCheck.errorLineNumber());
+        const auto column = QString::number(syntaxCheck.errorColumnNumber());
+        const auto message = QString("[SyntaxError] %1 in %2:%3(%4)").arg(error, program.fileName(), line, column);
+        qCritical() << qPrintable(message);
+        return false;
+    }
+    return true;
+}
+static bool hadUncaughtExceptions(QScriptEngine& engine, const QString& fileName) {
+    if (engine.hasUncaughtException()) {
+        const auto backtrace = engine.uncaughtExceptionBacktrace();
+        const auto exception = engine.uncaughtException().toString();
+        const auto line = QString::number(engine.uncaughtExceptionLineNumber());
+        engine.clearExceptions();
+
+        static const QString SCRIPT_EXCEPTION_FORMAT = "[UncaughtException] %1 in %2:%3";
+        auto message = QString(SCRIPT_EXCEPTION_FORMAT).arg(exception, fileName, line);
+        if (!backtrace.empty()) {
+            static const auto lineSeparator = "\n    ";
+            message += QString("\n[Backtrace]%1%2").arg(lineSeparator, backtrace.join(lineSeparator));
+        }
+        qCritical() << qPrintable(message);
+        return true;
+    }
+    return false;
+}
+
+// A filter script loaded into as many engines as there are edits being filtered at once, up to one per core, so that
+// an edit never waits on another for its filter and each engine is only ever used by one edit at a time.
+class EntityEditFilters::FilterEnginePool {
+public:
+    struct FilterEngine {
+        std::unique_ptr<QScriptEngine> engine;
+        QScriptValue filterFn;
+    };
+
+    class Releaser {
+    public:
+        Releaser(FilterEnginePool* pool = nullptr) : _pool(pool) {}
+        void operator()(FilterEngine* engine) const { _pool->release(engine); }
+    private:
+        FilterEnginePool* _pool;
+    };
+    using EnginePointer = std::unique_ptr<FilterEngine, Releaser>;
+
+    FilterEnginePool(const EntityItemID& entityID, const QScriptProgram& program) : _entityID(entityID), _program(program) {}
+
+    QString getFileName() const { return _program.fileName(); }
+
+    // runs the filter script in a new engine, returning nullptr if it throws
+    std::unique_ptr<FilterEngine> createEngine() const;
+
+    void add(std::unique_ptr<FilterEngine> engine) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _free.push_back(engine.get());
+        _engines.push_back(std::move(engine));
+        ++_numEngines;
+    }
+
+    // a free engine, loading the filter into another one if they are all in use
+    EnginePointer acquire() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (_free.empty() && _numEngines < QThread::idealThreadCount()) {
+            ++_numEngines;
+            lock.unlock();
+            auto engine = createEngine();
+            lock.lock();
+            if (engine) {
+                _engines.push_back(std::move(engine));
+                return EnginePointer(_engines.back().get(), Releaser(this));
+            }
+            --_numEngines;
+        }
+        _released.wait(lock, [this] { return !_free.empty(); });
+        FilterEngine* engine = _free.back();
+        _free.pop_back();
+        return EnginePointer(engine, Releaser(this));
+    }
+
+private:
+    void release(FilterEngine* engine) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _free.push_back(engine);
+        }
+        _released.notify_one();
+    }
+
+    EntityItemID _entityID;
+    QScriptProgram _program;
+
+    std::mutex _mutex;
+    std::condition_variable _released;
+    std::vector<std::unique_ptr<FilterEngine>> _engines;
+    std::vector<FilterEngine*> _free;
+    int _numEngines { 0 };
+};
+
+std::unique_ptr<EntityEditFilters::FilterEnginePool::FilterEngine> EntityEditFilters::FilterEnginePool::createEngine() const {
+    const QString urlString = _program.fileName();
+    std::unique_ptr<FilterEngine> filterEngine(new FilterEngine());
+    filterEngine->engine.reset(new QScriptEngine());
+    QScriptEngine* engine = filterEngine->engine.get();
+    engine->setObjectName("filter:" + _entityID.toString());
+    engine->setProperty("type", "edit_filter");
+    engine->setProperty("fileName", urlString);
+    engine->setProperty("entityID", _entityID);
+    engine->globalObject().setProperty("Script", engine->newQObject(engine));
+    DependencyManager::get<ScriptInitializers>()->runScriptInitializers(engine);
+    engine->evaluate(_program);
+    if (hadUncaughtExceptions(*engine, urlString)) {
+        return nullptr;
+    }
+
+    // now get the filter function
+    auto global = engine->globalObject();
+    auto entitiesObject = engine->newObject();
+    entitiesObject.setProperty("ADD_FILTER_TYPE", EntityTree::FilterType::Add);
+    entitiesObject.setProperty("EDIT_FILTER_TYPE", EntityTree::FilterType::Edit);
+    entitiesObject.setProperty("PHYSICS_FILTER_TYPE", EntityTree::FilterType::Physics);
+    entitiesObject.setProperty("DELETE_FILTER_TYPE", EntityTree::FilterType::Delete);
+    global.setProperty("Entities", entitiesObject);
+    filterEngine->filterFn = global.property("filter");
+    return filterEngine;
+}
+
 QList<EntityItemID> EntityEditFilters::getZonesByPosition(glm::vec3& position) {
     QList<EntityItemID> zones;
     QList<EntityItemID> missingZones;
@@ -73,10 +210,17 @@ bool EntityEditFilters::filter(glm::vec3& position, EntityItemProperties& proper
                 return true; // accept the message
             }
 
+            auto filterEngine = filterData.engines->acquire();
+            QScriptEngine* engine = filterEngine->engine.get();
+
             auto oldProperties = propertiesIn.getDesiredProperties();
             auto specifiedProperties = propertiesIn.getChangedProperties();
+            if (!filterData.wantsAllProperties) {
+                // the filter can only change what it is given, so the other properties pass through as they are
+                specifiedProperties &= filterData.includedProperties;
+            }
             propertiesIn.setDesiredProperties(specifiedProperties);
-            QScriptValue inputValues = propertiesIn.copyToScriptValue(filterData.engine, false, true, true);
+            QScriptValue inputValues = propertiesIn.copyToScriptValue(engine, false, true, true);
             propertiesIn.setDesiredProperties(oldProperties);
 
             auto in = QJsonValue::fromVariant(inputValues.toVariant()); // grab json copy now, because the inputValues might be side effected by the filter.
@@ -88,7 +232,7 @@ bool EntityEditFilters::filter(glm::vec3& position, EntityItemProperties& proper
             // get the current properties for then entity and include them for the filter call
             if (existingEntity && filterData.wantsOriginalProperties) {
                 auto currentProperties = existingEntity->getProperties(filterData.includedOriginalProperties);
-                QScriptValue currentValues = currentProperties.copyToScriptValue(filterData.engine, false, true, true);
+                QScriptValue currentValues = currentProperties.copyToScriptValue(engine, false, true, true);
                 args << currentValues;
             }
 
@@ -98,17 +242,17 @@ bool EntityEditFilters::filter(glm::vec3& position, EntityItemProperties& proper
                 auto zoneEntity = _tree->findEntityByEntityItemID(id);
                 if (zoneEntity) {
                     auto zoneProperties = zoneEntity->getProperties(filterData.includedZoneProperties);
-                    QScriptValue zoneValues = zoneProperties.copyToScriptValue(filterData.engine, false, true, true);
+                    QScriptValue zoneValues = zoneProperties.copyToScriptValue(engine, false, true, true);
 
                     if (filterData.wantsZoneBoundingBox) {
                         bool success = true;
                         AABox aaBox = zoneEntity->getAABox(success);
                         if (success) {
-                            QScriptValue boundingBox = filterData.engine->newObject();
-                            QScriptValue bottomRightNear = vec3ToScriptValue(filterData.engine, aaBox.getCorner());
-                            QScriptValue topFarLeft = vec3ToScriptValue(filterData.engine, aaBox.calcTopFarLeft());
-                            QScriptValue center = vec3ToScriptValue(filterData.engine, aaBox.calcCenter());
-                            QScriptValue boundingBoxDimensions = vec3ToScriptValue(filterData.engine, aaBox.getDimensions());
+                            QScriptValue boundingBox = engine->newObject();
+                            QScriptValue bottomRightNear = vec3ToScriptValue(engine, aaBox.getCorner());
+                            QScriptValue topFarLeft = vec3ToScriptValue(engine, aaBox.calcTopFarLeft());
+                            QScriptValue center = vec3ToScriptValue(engine, aaBox.calcCenter());
+                            QScriptValue boundingBoxDimensions = vec3ToScriptValue(engine, aaBox.getDimensions());
                             boundingBox.setProperty("brn", bottomRightNear);
                             boundingBox.setProperty("tfl", topFarLeft);
                             boundingBox.setProperty("center", center);
@@ -129,9 +273,9 @@ bool EntityEditFilters::filter(glm::vec3& position, EntityItemProperties& proper
                 }
             }
 
-            QScriptValue result = filterData.filterFn.call(_nullObjectForFilter, args);
+            QScriptValue result = filterEngine->filterFn.call(_nullObjectForFilter, args);
 
-            if (filterData.uncaughtExceptions()) {
+            if (hadUncaughtExceptions(*engine, filterData.engines->getFileName())) {
                 return false;
             }
 
@@ -165,11 +309,8 @@ bool EntityEditFilters::filter(glm::vec3& position, EntityItemProperties& proper
 }
 
 void EntityEditFilters::removeFilter(EntityItemID entityID) {
+    // the engines go once any edits being filtered by them are done
     QWriteLocker writeLock(&_lock);
-    FilterData filterData = _filterDataMap.value(entityID);
-    if (filterData.valid()) {
-        delete filterData.engine;
-    }
     _filterDataMap.remove(entityID);
 }
 
@@ -215,39 +356,6 @@ void EntityEditFilters::addFilter(EntityItemID entityID, QString filterURL) {
     qDebug() << "script request sent for entity " << entityID;
 }
 
-// Copied from ScriptEngine.cpp. We should make this a class method for reuse.
-// Note: I've deliberately stopped short of using ScriptEngine instead of QScriptEngine, as that is out of project scope at this point.
-static bool hasCorrectSyntax(const QScriptProgram& program) {
-    const auto syntaxCheck = QScriptEngine::checkSyntax(program.sourceCode());
-    if (syntaxCheck.state() != QScriptSyntaxCheckResult::Valid) {
-        const auto error = syntaxCheck.errorMessage();
-        const auto line = QString::number(syntaxCheck.errorLineNumber());
-        const auto column = QString::number(syntaxCheck.errorColumnNumber());
-        const auto message = QString("[SyntaxError] %1 in %2:%3(%4)").arg(error, program.fileName(), line, column);
-        qCritical() << qPrintable(message);
-        return false;
-    }
-    return true;
-}
-static bool hadUncaughtExceptions(QScriptEngine& engine, const QString& fileName) {
-    if (engine.hasUncaughtException()) {
-        const auto backtrace = engine.uncaughtExceptionBacktrace();
-        const auto exception = engine.uncaughtException().toString();
-        const auto line = QString::number(engine.uncaughtExceptionLineNumber());
-        engine.clearExceptions();
-
-        static const QString SCRIPT_EXCEPTION_FORMAT = "[UncaughtException] %1 in %2:%3";
-        auto message = QString(SCRIPT_EXCEPTION_FORMAT).arg(exception, fileName, line);
-        if (!backtrace.empty()) {
-            static const auto lineSeparator = "\n    ";
-            message += QString("\n[Backtrace]%1%2").arg(lineSeparator, backtrace.join(lineSeparator));
-        }
-        qCritical() << qPrintable(message);
-        return true;
-    }
-    return false;
-}
-
 void EntityEditFilters::scriptRequestFinished(EntityItemID entityID) {
     qDebug() << "script request completed for entity " << entityID;
     auto scriptRequest = qobject_cast<ResourceRequest*>(sender());
@@ -257,58 +365,49 @@ void EntityEditFilters::scriptRequestFinished(EntityItemID entityID) {
         qInfo() << "Downloaded script:" << scriptContents;
         QScriptProgram program(scriptContents, urlString);
         if (hasCorrectSyntax(program)) {
-            // create a QScriptEngine for this script
-            QScriptEngine* engine = new QScriptEngine();
-            engine->setObjectName("filter:" + entityID.toString());
-            engine->setProperty("type", "edit_filter");
-            engine->setProperty("fileName", urlString);
-            engine->setProperty("entityID", entityID);
-            engine->globalObject().setProperty("Script", engine->newQObject(engine));
-            DependencyManager::get<ScriptInitializers>()->runScriptInitializers(engine);
-            engine->evaluate(scriptContents, urlString);
-            if (!hadUncaughtExceptions(*engine, urlString)) {
-                // put the engine in the engine map (so we don't leak them, etc...)
+            // the filter's settings are read from the first engine the script is loaded into
+            auto engines = std::make_shared<FilterEnginePool>(entityID, program);
+            auto filterEngine = engines->createEngine();
+            if (filterEngine) {
                 FilterData filterData;
-                filterData.engine = engine;
                 filterData.rejectAll = false;
-                
-                // define the uncaughtException function
-                QScriptEngine& engineRef = *engine;
-                filterData.uncaughtExceptions = [&engineRef, urlString]() { return hadUncaughtExceptions(engineRef, urlString); };
-
-                // now get the filter function
-                auto global = engine->globalObject();
-                auto entitiesObject = engine->newObject();
-                entitiesObject.setProperty("ADD_FILTER_TYPE", EntityTree::FilterType::Add);
-                entitiesObject.setProperty("EDIT_FILTER_TYPE", EntityTree::FilterType::Edit);
-                entitiesObject.setProperty("PHYSICS_FILTER_TYPE", EntityTree::FilterType::Physics);
-                entitiesObject.setProperty("DELETE_FILTER_TYPE", EntityTree::FilterType::Delete);
-                global.setProperty("Entities", entitiesObject);
-                filterData.filterFn = global.property("filter");
-                if (!filterData.filterFn.isFunction()) {
+
+                QScriptValue filterFn = filterEngine->filterFn;
+                if (!filterFn.isFunction()) {
                     qDebug() << "Filter function specified but not found. Will reject all edits for those without lock rights.";
-                    delete engine;
                     filterData.rejectAll=true;
+                } else {
+                    engines->add(std::move(filterEngine));
+                    filterData.engines = engines;
                 }
 
                 // if the wantsToFilterEdit is a boolean evaluate as a boolean, otherwise assume true
-                QScriptValue wantsToFilterAddValue = filterData.filterFn.property("wantsToFilterAdd");
+                QScriptValue wantsToFilterAddValue = filterFn.property("wantsToFilterAdd");
                 filterData.wantsToFilterAdd = wantsToFilterAddValue.isBool() ? wantsToFilterAddValue.toBool() : true;
 
                 // if the wantsToFilterEdit is a boolean evaluate as a boolean, otherwise assume true
-                QScriptValue wantsToFilterEditValue = filterData.filterFn.property("wantsToFilterEdit");
+                QScriptValue wantsToFilterEditValue = filterFn.property("wantsToFilterEdit");
                 filterData.wantsToFilterEdit = wantsToFilterEditValue.isBool() ? wantsToFilterEditValue.toBool() : true;
 
                 // if the wantsToFilterPhysics is a boolean evaluate as a boolean, otherwise assume true
-                QScriptValue wantsToFilterPhysicsValue = filterData.filterFn.property("wantsToFilterPhysics");
+                QScriptValue wantsToFilterPhysicsValue = filterFn.property("wantsToFilterPhysics");
                 filterData.wantsToFilterPhysics = wantsToFilterPhysicsValue.isBool() ? wantsToFilterPhysicsValue.toBool() : true;
 
                 // if the wantsToFilterDelete is a boolean evaluate as a boolean, otherwise assume false
-                QScriptValue wantsToFilterDeleteValue = filterData.filterFn.property("wantsToFilterDelete");
+                QScriptValue wantsToFilterDeleteValue = filterFn.property("wantsToFilterDelete");
                 filterData.wantsToFilterDelete = wantsToFilterDeleteValue.isBool() ? wantsToFilterDeleteValue.toBool() : false;
 
+                // check to see if the filterFn says which of the edited properties it reads
+                QScriptValue wantsPropertiesValue = filterFn.property("wantsProperties");
+                // if the wantsProperties is a string, or list of strings, only those of the edited properties are given
+                // to the filter, otherwise all of them are
+                if (wantsPropertiesValue.isString() || wantsPropertiesValue.isArray()) {
+                    filterData.wantsAllProperties = false;
+                    EntityPropertyFlagsFromScriptValue(wantsPropertiesValue, filterData.includedProperties);
+                }
+
                 // check to see if the filterFn has properties asking for Original props
-                QScriptValue wantsOriginalPropertiesValue = filterData.filterFn.property("wantsOriginalProperties");
+                QScriptValue wantsOriginalPropertiesValue = filterFn.property("wantsOriginalProperties");
                 // if the wantsOriginalProperties is a boolean, or a string, or list of strings, then evaluate as follows:
                 //   - boolean - true  - include all original properties
                 //               false - no properties at all
@@ -329,7 +428,7 @@ void EntityEditFilters::scriptRequestFinished(EntityItemID entityID) {
                 }
 
                 // check to see if the filterFn has properties asking for Zone props
-                QScriptValue wantsZonePropertiesValue = filterData.filterFn.property("wantsZoneProperties");
+                QScriptValue wantsZonePropertiesValue = filterFn.property("wantsZoneProperties");
                 // if the wantsZoneProperties is a boolean, or a string, or list of strings, then evaluate as follows:
                 //   - boolean - true  - include all Zone properties
                 //               false - no properties at all
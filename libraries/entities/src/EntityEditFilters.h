@@ -17,7 +17,7 @@
 #include <QScriptEngine>
 #include <glm/glm.hpp>
 
-#include <functional>
+#include <memory>
 
 #include "EntityItemID.h"
 #include "EntityItemProperties.h"
@@ -26,8 +26,15 @@
 class EntityEditFilters : public QObject, public Dependency {
     Q_OBJECT
 public:
+    class FilterEnginePool;
+
     struct FilterData {
-        QScriptValue filterFn;
+        // the engines the filter is loaded into, one for each edit being filtered at the same time
+        std::shared_ptr<FilterEnginePool> engines;
+
+        // only these of the edited properties are given to the filter, if it says which ones it reads
+        bool wantsAllProperties { true };
+        EntityPropertyFlags includedProperties;
         bool wantsOriginalProperties { false };
         bool wantsZoneProperties { false };
 
@@ -40,12 +47,9 @@ public:
         EntityPropertyFlags includedZoneProperties;
         bool wantsZoneBoundingBox { false };
 
-        std::function<bool()> uncaughtExceptions;
-        QScriptEngine* engine;
-        bool rejectAll;
-        
-        FilterData(): engine(nullptr), rejectAll(false) {};
-        bool valid() { return (rejectAll || (engine != nullptr && filterFn.isFunction() && uncaughtExceptions)); }
+        bool rejectAll { false };
+
+        bool valid() { return (rejectAll || engines); }
     };
 
     EntityEditFilters() {};
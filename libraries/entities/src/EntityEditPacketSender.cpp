@@ -12,6 +12,7 @@
 #include "EntityEditPacketSender.h"
 
 #include <assert.h>
+#include <memory>
 
 #include <QJsonDocument>
 
@@ -106,21 +107,26 @@ void EntityEditPacketSender::queueEditEntityMessage(PacketType type,
     auto nodeList = DependencyManager::get<NodeList>();
 
     EntityPropertyFlags didntFitProperties;
-    EntityItemProperties propertiesCopy = properties;
 
+    // the properties are only copied when the parent has to be rewritten, since this runs for every edit and
+    // copying every property of an entity isn't cheap
+    const EntityItemProperties* propertiesToSend = &properties;
+    std::unique_ptr<EntityItemProperties> propertiesWithSessionParent;
     if (properties.parentIDChanged() && properties.getParentID() == AVATAR_SELF_ID) {
         const QUuid myNodeID = nodeList->getSessionUUID();
-        propertiesCopy.setParentID(myNodeID);
+        propertiesWithSessionParent.reset(new EntityItemProperties(properties));
+        propertiesWithSessionParent->setParentID(myNodeID);
+        propertiesToSend = propertiesWithSessionParent.get();
     }
 
-    EntityPropertyFlags requestedProperties = propertiesCopy.getChangedProperties();
+    EntityPropertyFlags requestedProperties = propertiesToSend->getChangedProperties();
 
     if (!nodeList->getThisNodeCanGetAndSetPrivateUserData() && requestedProperties.getHasProperty(PROP_PRIVATE_USER_DATA)) {
         requestedProperties -= PROP_PRIVATE_USER_DATA;
     }
 
     while (encodeResult == OctreeElement::PARTIAL) {
-        encodeResult = EntityItemProperties::encodeEntityEditPacket(type, entityItemID, propertiesCopy, bufferOut, requestedProperties, didntFitProperties);
+        encodeResult = EntityItemProperties::encodeEntityEditPacket(type, entityItemID, *propertiesToSend, bufferOut, requestedProperties, didntFitProperties);
 
         if (encodeResult == OctreeElement::NONE) {
             // This can happen for two reasons:
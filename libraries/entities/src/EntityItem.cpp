@@ -32,6 +32,7 @@
 #include <RegisteredMetaTypes.h>
 #include <SharedUtil.h> // usecTimestampNow()
 #include <LogHandler.h>
+#include <MemoryAccounting.h>
 #include <Extents.h>
 #include <QVariantGLM.h>
 #include <Grab.h>
@@ -40,6 +41,7 @@
 #include "EntitiesLogging.h"
 #include "EntityTree.h"
 #include "EntitySimulation.h"
+#include "EntityStringTable.h"
 #include "EntityDynamicFactoryInterface.h"
 
 //#define WANT_DEBUG
@@ -57,6 +59,7 @@ EntityItem::EntityItem(const EntityItemID& entityItemID) :
     setLocalVelocity(ENTITY_ITEM_DEFAULT_VELOCITY);
     setLocalAngularVelocity(ENTITY_ITEM_DEFAULT_ANGULAR_VELOCITY);
     setUnscaledDimensions(ENTITY_ITEM_DEFAULT_DIMENSIONS);
+    MemoryAccounting::add(MemoryAccounting::Entities, sizeof(EntityItem));
     // explicitly set transform parts to set dirty flags used by batch rendering
     locationChanged();
     dimensionsChanged();
@@ -71,6 +74,7 @@ EntityItem::~EntityItem() {
     assert(!_simulated || (!_element && !_physicsInfo));
     assert(!_element);
     assert(!_physicsInfo);
+    MemoryAccounting::remove(MemoryAccounting::Entities, sizeof(EntityItem));
 }
 
 EntityPropertyFlags EntityItem::getEntityProperties(EncodeBitstreamParams& params) const {
@@ -105,6 +109,7 @@ EntityPropertyFlags EntityItem::getEntityProperties(EncodeBitstreamParams& param
     requestedProperties += PROP_IGNORE_PICK_INTERSECTION;
     requestedProperties += PROP_RENDER_WITH_ZONES;
     requestedProperties += PROP_BILLBOARD_MODE;
+    requestedProperties += PROP_LOD_PROXY_DISTANCE;
     requestedProperties += _grabProperties.getEntityProperties(params);
 
     // Physics
@@ -156,7 +161,8 @@ EntityPropertyFlags EntityItem::getEntityProperties(EncodeBitstreamParams& param
 
 OctreeElement::AppendState EntityItem::appendEntityData(OctreePacketData* packetData, EncodeBitstreamParams& params,
                                             EntityTreeElementExtraEncodeDataPointer entityTreeElementExtraEncodeData,
-                                            const bool destinationNodeCanGetAndSetPrivateUserData) const {
+                                            const bool destinationNodeCanGetAndSetPrivateUserData,
+                                            const EntityPropertyFlags& excludedProperties) const {
 
     // ALL this fits...
     //    object ID [16 bytes]
@@ -194,6 +200,9 @@ OctreeElement::AppendState EntityItem::appendEntityData(OctreePacketData* packet
     requestedProperties -= PROP_OWNING_AVATAR_ID;
     requestedProperties -= PROP_VISIBLE_IN_SECONDARY_CAMERA;
 
+    // nor are those the destination has asked not to be sent
+    requestedProperties -= excludedProperties;
+
     // If we are being called for a subsequent pass at appendEntityData() that failed to completely encode this item,
     // then our entityTreeElementExtraEncodeData should include data about which properties we need to append.
     if (entityTreeElementExtraEncodeData && entityTreeElementExtraEncodeData->entities.contains(getEntityItemID())) {
@@ -302,6 +311,7 @@ OctreeElement::AppendState EntityItem::appendEntityData(OctreePacketData* packet
         APPEND_ENTITY_PROPERTY(PROP_IGNORE_PICK_INTERSECTION, getIgnorePickIntersection());
         APPEND_ENTITY_PROPERTY(PROP_RENDER_WITH_ZONES, getRenderWithZones());
         APPEND_ENTITY_PROPERTY(PROP_BILLBOARD_MODE, (uint32_t)getBillboardMode());
+        APPEND_ENTITY_PROPERTY(PROP_LOD_PROXY_DISTANCE, getLodProxyDistance());
         withReadLock([&] {
             _grabProperties.appendSubclassData(packetData, params, entityTreeElementExtraEncodeData, requestedProperties,
                 propertyFlags, propertiesDidntFit, propertyCount, appendState);
@@ -875,6 +885,7 @@ int EntityItem::readEntityDataFromBuffer(const unsigned char* data, int bytesLef
     READ_ENTITY_PROPERTY(PROP_IGNORE_PICK_INTERSECTION, bool, setIgnorePickIntersection);
     READ_ENTITY_PROPERTY(PROP_RENDER_WITH_ZONES, QVector<QUuid>, setRenderWithZones);
     READ_ENTITY_PROPERTY(PROP_BILLBOARD_MODE, BillboardMode, setBillboardMode);
+    READ_ENTITY_PROPERTY(PROP_LOD_PROXY_DISTANCE, float, setLodProxyDistance);
     withWriteLock([&] {
         int bytesFromGrab = _grabProperties.readEntitySubclassDataFromBuffer(dataAt, (bytesLeftToRead - bytesRead), args,
             propertyFlags, overwriteLocalData,
@@ -1016,6 +1027,16 @@ void EntityItem::debugDump() const {
     qCDebug(entities) << " dimensions:" << getScaledDimensions();
 }
 
+size_t EntityItem::getApproximateMemoryUsage() const {
+    return resultWithReadLock<size_t>([&] {
+        return sizeof(EntityItem) + getStringMemoryUsage(_script) + getStringMemoryUsage(_loadedScript) +
+            getStringMemoryUsage(_serverScripts) + getStringMemoryUsage(_collisionSoundURL) +
+            getStringMemoryUsage(_userData) + getStringMemoryUsage(_privateUserData) + getStringMemoryUsage(_name) +
+            getStringMemoryUsage(_href) + getStringMemoryUsage(_description) + (size_t)_allActionsDataCache.capacity() +
+            (size_t)(_cloneIDs.capacity() + _renderWithZones.capacity()) * sizeof(QUuid);
+    });
+}
+
 // adjust any internal timestamps to fix clock skew for this server
 void EntityItem::adjustEditPacketForClockSkew(QByteArray& buffer, qint64 clockSkew) {
     unsigned char* dataAt = reinterpret_cast<unsigned char*>(buffer.data());
@@ -1094,7 +1115,7 @@ void EntityItem::setCollisionSoundURL(const QString& value) {
     bool modified = false;
     withWriteLock([&] {
         if (_collisionSoundURL != value) {
-            _collisionSoundURL = value;
+            _collisionSoundURL = EntityStringTable::intern(value);
             modified = true;
         }
     });
@@ -1359,6 +1380,7 @@ EntityItemProperties EntityItem::getProperties(const EntityPropertyFlags& desire
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(ignorePickIntersection, getIgnorePickIntersection);
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(renderWithZones, getRenderWithZones);
     COPY_ENTITY_PROPERTY_TO_PROPERTIES(billboardMode, getBillboardMode);
+    COPY_ENTITY_PROPERTY_TO_PROPERTIES(lodProxyDistance, getLodProxyDistance);
     withReadLock([&] {
         _grabProperties.getProperties(properties);
     });
@@ -1510,6 +1532,7 @@ bool EntityItem::setProperties(const EntityItemProperties& properties) {
     SET_ENTITY_PROPERTY_FROM_PROPERTIES(ignorePickIntersection, setIgnorePickIntersection);
     SET_ENTITY_PROPERTY_FROM_PROPERTIES(renderWithZones, setRenderWithZones);
     SET_ENTITY_PROPERTY_FROM_PROPERTIES(billboardMode, setBillboardMode);
+    SET_ENTITY_PROPERTY_FROM_PROPERTIES(lodProxyDistance, setLodProxyDistance);
     withWriteLock([&] {
         bool grabPropertiesChanged = _grabProperties.setProperties(properties);
         somethingChanged |= grabPropertiesChanged;
@@ -2891,7 +2914,7 @@ QString EntityItem::getScript() const {
 
 void EntityItem::setScript(const QString& value) {
     withWriteLock([&] {
-        _script = value;
+        _script = EntityStringTable::intern(value);
     });
 }
 
@@ -2919,7 +2942,7 @@ QString EntityItem::getServerScripts() const {
 
 void EntityItem::setServerScripts(const QString& serverScripts) {
     withWriteLock([&] {
-        _serverScripts = serverScripts;
+        _serverScripts = EntityStringTable::intern(serverScripts);
         _serverScriptsChangedTimestamp = usecTimestampNow();
     });
 }
@@ -3644,3 +3667,33 @@ void EntityItem::setBillboardMode(BillboardMode value) {
         _billboardMode = value;
     });
 }
+
+float EntityItem::getLodProxyDistance() const {
+    return resultWithReadLock<float>([&] {
+        return _lodProxyDistance;
+    });
+}
+
+void EntityItem::setLodProxyDistance(float value) {
+    withWriteLock([&] {
+        _lodProxyDistance = glm::max(value, 0.0f);
+    });
+}
+
+bool EntityItem::isHiddenByLodProxy() const {
+    return resultWithReadLock<bool>([&] {
+        return _hiddenByLodProxy;
+    });
+}
+
+void EntityItem::setHiddenByLodProxy(bool value) {
+    bool needsRenderUpdate = false;
+    withWriteLock([&] {
+        needsRenderUpdate = _hiddenByLodProxy != value;
+        _needsRenderUpdate |= needsRenderUpdate;
+        _hiddenByLodProxy = value;
+    });
+    if (needsRenderUpdate) {
+        somethingChangedNotification();
+    }
+}
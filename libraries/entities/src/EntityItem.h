@@ -137,7 +137,8 @@ public:
 
     virtual OctreeElement::AppendState appendEntityData(OctreePacketData* packetData, EncodeBitstreamParams& params,
                                                         EntityTreeElementExtraEncodeDataPointer entityTreeElementExtraEncodeData,
-                                                        const bool destinationNodeCanGetAndSetPrivateUserData = false) const;
+                                                        const bool destinationNodeCanGetAndSetPrivateUserData = false,
+                                                        const EntityPropertyFlags& excludedProperties = EntityPropertyFlags()) const;
 
     virtual void appendSubclassData(OctreePacketData* packetData, EncodeBitstreamParams& params,
                                     EntityTreeElementExtraEncodeDataPointer entityTreeElementExtraEncodeData,
@@ -173,6 +174,9 @@ public:
 
     virtual void debugDump() const;
 
+    // the bytes held by this entity's members and the strings and arrays it alone holds, for the memory audit
+    virtual size_t getApproximateMemoryUsage() const;
+
     virtual bool supportsDetailedIntersection() const { return false; }
     virtual bool findDetailedRayIntersection(const glm::vec3& origin, const glm::vec3& direction,
                          const glm::vec3& viewFrustumPos, OctreeElementPointer& element, float& distance,
@@ -586,12 +590,25 @@ public:
 
     void setBillboardMode(BillboardMode value);
     BillboardMode getBillboardMode() const;
+
+    // a proxy stands in for its children for viewers farther away than its distance
+    float getLodProxyDistance() const;
+    void setLodProxyDistance(float value);
+    bool isLodProxy() const { return getLodProxyDistance() > 0.0f; }
+    // set locally on a proxy while the view is near it, and on its children while the view is far from it
+    bool isHiddenByLodProxy() const;
+    void setHiddenByLodProxy(bool value);
     virtual bool getRotateForPicking() const { return false; }
 
 signals:
     void spaceUpdate(std::pair<int32_t, glm::vec4> data);
 
 protected:
+    // strings shared with other entities, or with the EntityStringTable, are left out
+    static size_t getStringMemoryUsage(const QString& value) {
+        return value.isDetached() ? (size_t)value.capacity() * sizeof(QChar) : 0;
+    }
+
     QHash<ChangeHandlerId, ChangeHandlerCallback> _changeHandlers;
 
     void somethingChangedNotification();
@@ -781,6 +798,9 @@ protected:
 
     BillboardMode _billboardMode { BillboardMode::NONE };
 
+    float _lodProxyDistance { ENTITY_ITEM_DEFAULT_LOD_PROXY_DISTANCE };
+    bool _hiddenByLodProxy { false };
+
     bool _cullWithParent { false };
 
     mutable bool _needsRenderUpdate { false };
@@ -450,6 +450,7 @@ EntityPropertyFlags EntityItemProperties::getChangedProperties() const {
     CHECK_PROPERTY_CHANGE(PROP_IGNORE_PICK_INTERSECTION, ignorePickIntersection);
     CHECK_PROPERTY_CHANGE(PROP_RENDER_WITH_ZONES, renderWithZones);
     CHECK_PROPERTY_CHANGE(PROP_BILLBOARD_MODE, billboardMode);
+    CHECK_PROPERTY_CHANGE(PROP_LOD_PROXY_DISTANCE, lodProxyDistance);
     changedProperties += _grab.getChangedProperties();
 
     // Physics
@@ -832,6 +833,9 @@ EntityPropertyFlags EntityItemProperties::getChangedProperties() const {
  *     one of the zones in this list.
  * @property {BillboardMode} billboardMode="none" - Whether the entity is billboarded to face the camera.  Use the rotation
  *     property to control which axis is facing you.
+ * @property {number} lodProxyDistance=0 - If greater than <code>0</code>, the entity is a stand-in for its children when
+ *     seen from farther away than this distance, in meters: the entity server doesn't send the children to clients that are
+ *     farther away, and clients don't render the entity when they are closer.
  *
  * @property {Entities.Grab} grab - The entity's grab-related properties.
  *
@@ -1639,6 +1643,7 @@ QScriptValue EntityItemProperties::copyToScriptValue(QScriptEngine* engine, bool
     COPY_PROPERTY_TO_QSCRIPTVALUE(PROP_IGNORE_PICK_INTERSECTION, ignorePickIntersection);
     COPY_PROPERTY_TO_QSCRIPTVALUE(PROP_RENDER_WITH_ZONES, renderWithZones);
     COPY_PROPERTY_TO_QSCRIPTVALUE_GETTER(PROP_BILLBOARD_MODE, billboardMode, getBillboardModeAsString());
+    COPY_PROPERTY_TO_QSCRIPTVALUE(PROP_LOD_PROXY_DISTANCE, lodProxyDistance);
     _grab.copyToScriptValue(_desiredProperties, properties, engine, skipDefaults, defaultEntityProperties);
 
     // Physics
@@ -2061,6 +2066,7 @@ void EntityItemProperties::copyFromScriptValue(const QScriptValue& object, bool
     COPY_PROPERTY_FROM_QSCRIPTVALUE(ignorePickIntersection, bool, setIgnorePickIntersection);
     COPY_PROPERTY_FROM_QSCRIPTVALUE(renderWithZones, qVectorQUuid, setRenderWithZones);
     COPY_PROPERTY_FROM_QSCRIPTVALUE_ENUM(billboardMode, BillboardMode);
+    COPY_PROPERTY_FROM_QSCRIPTVALUE(lodProxyDistance, float, setLodProxyDistance);
     _grab.copyFromScriptValue(object, _defaultSettings);
 
     // Physics
@@ -2361,6 +2367,7 @@ void EntityItemProperties::merge(const EntityItemProperties& other) {
     COPY_PROPERTY_IF_CHANGED(ignorePickIntersection);
     COPY_PROPERTY_IF_CHANGED(renderWithZones);
     COPY_PROPERTY_IF_CHANGED(billboardMode);
+    COPY_PROPERTY_IF_CHANGED(lodProxyDistance);
     _grab.merge(other._grab);
 
     // Physics
@@ -2660,6 +2667,7 @@ bool EntityItemProperties::getPropertyInfo(const QString& propertyName, EntityPr
         ADD_PROPERTY_TO_MAP(PROP_IGNORE_PICK_INTERSECTION, IgnorePickIntersection, ignorePickIntersection, bool);
         ADD_PROPERTY_TO_MAP(PROP_RENDER_WITH_ZONES, RenderWithZones, renderWithZones, QVector<QUuid>);
         ADD_PROPERTY_TO_MAP(PROP_BILLBOARD_MODE, BillboardMode, billboardMode, BillboardMode);
+        ADD_PROPERTY_TO_MAP(PROP_LOD_PROXY_DISTANCE, LodProxyDistance, lodProxyDistance, float);
         { // Grab
             ADD_GROUP_PROPERTY_TO_MAP(PROP_GRAB_GRABBABLE, Grab, grab, Grabbable, grabbable);
             ADD_GROUP_PROPERTY_TO_MAP(PROP_GRAB_KINEMATIC, Grab, grab, GrabKinematic, grabKinematic);
@@ -3155,6 +3163,7 @@ OctreeElement::AppendState EntityItemProperties::encodeEntityEditPacket(PacketTy
             APPEND_ENTITY_PROPERTY(PROP_IGNORE_PICK_INTERSECTION, properties.getIgnorePickIntersection());
             APPEND_ENTITY_PROPERTY(PROP_RENDER_WITH_ZONES, properties.getRenderWithZones());
             APPEND_ENTITY_PROPERTY(PROP_BILLBOARD_MODE, (uint32_t)properties.getBillboardMode());
+            APPEND_ENTITY_PROPERTY(PROP_LOD_PROXY_DISTANCE, properties.getLodProxyDistance());
             _staticGrab.setProperties(properties);
             _staticGrab.appendToEditPacket(packetData, requestedProperties, propertyFlags,
                                            propertiesDidntFit, propertyCount, appendState);
@@ -3649,6 +3658,7 @@ bool EntityItemProperties::decodeEntityEditPacket(const unsigned char* data, int
     READ_ENTITY_PROPERTY_TO_PROPERTIES(PROP_IGNORE_PICK_INTERSECTION, bool, setIgnorePickIntersection);
     READ_ENTITY_PROPERTY_TO_PROPERTIES(PROP_RENDER_WITH_ZONES, QVector<QUuid>, setRenderWithZones);
     READ_ENTITY_PROPERTY_TO_PROPERTIES(PROP_BILLBOARD_MODE, BillboardMode, setBillboardMode);
+    READ_ENTITY_PROPERTY_TO_PROPERTIES(PROP_LOD_PROXY_DISTANCE, float, setLodProxyDistance);
     properties.getGrab().decodeFromEditPacket(propertyFlags, dataAt, processedBytes);
 
     // Physics
@@ -4071,6 +4081,7 @@ void EntityItemProperties::markAllChanged() {
     _ignorePickIntersectionChanged = true;
     _renderWithZonesChanged = true;
     _billboardModeChanged = true;
+    _lodProxyDistanceChanged = true;
     _grab.markAllChanged();
 
     // Physics
@@ -4484,6 +4495,9 @@ QList<QString> EntityItemProperties::listChangedProperties() {
     if (billboardModeChanged()) {
         out += "billboardMode";
     }
+    if (lodProxyDistanceChanged()) {
+        out += "lodProxyDistance";
+    }
     getGrab().listChangedProperties(out);
 
     // Physics
@@ -160,7 +160,7 @@ public:
 
     void debugDump() const;
     void setLastEdited(quint64 usecTime);
-    EntityPropertyFlags getDesiredProperties() { return _desiredProperties; }
+    EntityPropertyFlags getDesiredProperties() const { return _desiredProperties; }
     void setDesiredProperties(EntityPropertyFlags properties) {  _desiredProperties = properties; }
 
     bool constructFromBuffer(const unsigned char* data, int dataLength);
@@ -199,6 +199,7 @@ public:
     DEFINE_PROPERTY(PROP_IGNORE_PICK_INTERSECTION, IgnorePickIntersection, ignorePickIntersection, bool, false);
     DEFINE_PROPERTY_REF(PROP_RENDER_WITH_ZONES, RenderWithZones, renderWithZones, QVector<QUuid>, QVector<QUuid>());
     DEFINE_PROPERTY_REF_ENUM(PROP_BILLBOARD_MODE, BillboardMode, billboardMode, BillboardMode, BillboardMode::NONE);
+    DEFINE_PROPERTY(PROP_LOD_PROXY_DISTANCE, LodProxyDistance, lodProxyDistance, float, ENTITY_ITEM_DEFAULT_LOD_PROXY_DISTANCE);
     DEFINE_PROPERTY_GROUP(Grab, grab, GrabPropertyGroup);
 
     // Physics
@@ -50,6 +50,7 @@ const float ENTITY_ITEM_DEFAULT_ALPHA = 1.0f;
 const bool ENTITY_ITEM_DEFAULT_VISIBLE = true;
 const bool ENTITY_ITEM_DEFAULT_VISIBLE_IN_SECONDARY_CAMERA = true;
 const bool ENTITY_ITEM_DEFAULT_CAN_CAST_SHADOW { true };
+const float ENTITY_ITEM_DEFAULT_LOD_PROXY_DISTANCE = 0.0f; // not a proxy
 
 const QString ENTITY_ITEM_DEFAULT_SCRIPT = QString("");
 const quint64 ENTITY_ITEM_DEFAULT_SCRIPT_TIMESTAMP = 0;
@@ -11,6 +11,10 @@
 
 #include "EntityNodeData.h"
 
+#include <QtCore/QJsonArray>
+
+#include "EntityItemProperties.h"
+
 bool EntityNodeData::insertFlaggedExtraEntity(const QUuid& filteredEntityID, const QUuid& extraEntityID) {
     _flaggedExtraEntities[filteredEntityID].insert(extraEntityID);
     return !_previousFlaggedExtraEntities[filteredEntityID].contains(extraEntityID);
@@ -28,3 +32,46 @@ bool EntityNodeData::isEntityFlaggedAsExtra(const QUuid& entityID) const {
 
     return false;
 }
+
+bool EntityNodeData::updateExcludedProperties(const QJsonObject& excludedProperties) {
+    if (excludedProperties == _excludedPropertiesJSON) {
+        return false;
+    }
+    _excludedPropertiesJSON = excludedProperties;
+    _excludedFromAllTypes = EntityPropertyFlags();
+    _excludedByType.clear();
+
+    static const QString ALL_TYPES = "*";
+    foreach(const QString& typeName, excludedProperties.keys()) {
+        EntityPropertyFlags excluded;
+        foreach(const QJsonValue& propertyName, excludedProperties[typeName].toArray()) {
+            EntityPropertyInfo propertyInfo;
+            if (EntityItemProperties::getPropertyInfo(propertyName.toString(), propertyInfo)) {
+                excluded += propertyInfo.propertyEnum;
+            }
+        }
+
+        // the client tree needs these to place the entity and to know who is simulating it
+        excluded -= PROP_SIMULATION_OWNER;
+        excluded -= PROP_PARENT_ID;
+        excluded -= PROP_QUERY_AA_CUBE;
+
+        if (typeName == ALL_TYPES) {
+            _excludedFromAllTypes = excluded;
+        } else {
+            auto type = EntityTypes::getEntityTypeFromName(typeName);
+            if (type != EntityTypes::Unknown) {
+                _excludedByType[type] = excluded;
+            }
+        }
+    }
+    return true;
+}
+
+EntityPropertyFlags EntityNodeData::getExcludedProperties(EntityTypes::EntityType type) const {
+    auto itr = _excludedByType.find(type);
+    if (itr == _excludedByType.end()) {
+        return _excludedFromAllTypes;
+    }
+    return _excludedFromAllTypes | itr.value();
+}
@@ -12,15 +12,22 @@
 #ifndef hifi_EntityNodeData_h
 #define hifi_EntityNodeData_h
 
+#include <QtCore/QJsonObject>
+
 #include <udt/PacketHeaders.h>
 
 #include <OctreeQueryNode.h>
 
+#include "EntityPropertyFlags.h"
+#include "EntityTypes.h"
+
 namespace EntityJSONQueryProperties {
     static const QString SERVER_SCRIPTS_PROPERTY = "serverScripts";
     static const QString FLAGS_PROPERTY = "flags";
     static const QString INCLUDE_ANCESTORS_PROPERTY = "includeAncestors";
     static const QString INCLUDE_DESCENDANTS_PROPERTY = "includeDescendants";
+    // an object of entity type names, or "*" for every type, to arrays of property names the viewer doesn't want sent
+    static const QString EXCLUDED_PROPERTIES_PROPERTY = "excludedProperties";
 }
 
 class EntityNodeData : public OctreeQueryNode {
@@ -44,11 +51,23 @@ public:
     bool isEntityFlaggedAsExtra(const QUuid& entityID) const;
     void resetFlaggedExtraEntities() { _previousFlaggedExtraEntities = _flaggedExtraEntities; _flaggedExtraEntities.clear(); }
 
+    // the following excluded properties methods can only be called from the OctreeSendThread for the given Node
+
+    // parses the excludedProperties of the JSON query, returns true if they changed
+    bool updateExcludedProperties(const QJsonObject& excludedProperties);
+    // the properties not to encode for an entity of type
+    EntityPropertyFlags getExcludedProperties(EntityTypes::EntityType type) const;
+    bool hasExcludedProperties() const { return !_excludedPropertiesJSON.isEmpty(); }
+
 private:
     quint64 _lastDeletedEntitiesSentAt { usecTimestampNow() };
     QSet<QUuid> _sentFilteredEntities;
     QHash<QUuid, QSet<QUuid>> _flaggedExtraEntities;
     QHash<QUuid, QSet<QUuid>> _previousFlaggedExtraEntities;
+
+    QJsonObject _excludedPropertiesJSON;
+    EntityPropertyFlags _excludedFromAllTypes;
+    QHash<EntityTypes::EntityType, EntityPropertyFlags> _excludedByType;
 };
 
 #endif // hifi_EntityNodeData_h
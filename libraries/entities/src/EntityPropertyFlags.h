@@ -46,6 +46,7 @@ enum EntityPropertyList {
     PROP_IGNORE_PICK_INTERSECTION,
     PROP_RENDER_WITH_ZONES,
     PROP_BILLBOARD_MODE,
+    PROP_LOD_PROXY_DISTANCE,
     // Grab
     PROP_GRAB_GRABBABLE,
     PROP_GRAB_KINEMATIC,
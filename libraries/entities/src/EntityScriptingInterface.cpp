@@ -794,101 +794,147 @@ QScriptValue EntityScriptingInterface::getMultipleEntityPropertiesInternal(QScri
 QUuid EntityScriptingInterface::editEntity(const QUuid& id, const EntityItemProperties& scriptSideProperties) {
     PROFILE_RANGE(script_entities, __FUNCTION__);
 
-    _activityTracking.editedEntityCount++;
+    std::vector<EntityEdit> edits;
+    edits.emplace_back(id, scriptSideProperties);
+    editEntitiesWorker(edits);
+    return edits[0].result;
+}
 
-    const auto sessionID = DependencyManager::get<NodeList>()->getSessionUUID();
+QVector<QUuid> EntityScriptingInterface::editEntities(const QVector<QUuid>& entityIDs, const QScriptValue& properties) {
+    PROFILE_RANGE(script_entities, __FUNCTION__);
 
-    EntityItemProperties properties = scriptSideProperties;
+    std::vector<EntityEdit> edits;
+    edits.reserve(entityIDs.size());
+    if (properties.isArray()) {
+        int numProperties = std::min(entityIDs.size(), (int)properties.property("length").toUInt32());
+        for (int i = 0; i < numProperties; i++) {
+            edits.emplace_back(entityIDs[i], qscriptvalue_cast<EntityItemProperties>(properties.property(i)));
+        }
+    } else {
+        // the same properties for every entity only need converting once
+        EntityItemProperties sharedProperties = qscriptvalue_cast<EntityItemProperties>(properties);
+        for (const auto& entityID : entityIDs) {
+            edits.emplace_back(entityID, sharedProperties);
+        }
+    }
+    editEntitiesWorker(edits);
+
+    // the IDs without properties weren't edited
+    QVector<QUuid> results(entityIDs.size());
+    for (size_t i = 0; i < edits.size(); i++) {
+        results[(int)i] = edits[i].result;
+    }
+    return results;
+}
+
+void EntityScriptingInterface::editEntitiesWorker(std::vector<EntityEdit>& edits) {
+    _activityTracking.editedEntityCount += (int)edits.size();
+
+    const auto sessionID = DependencyManager::get<NodeList>()->getSessionUUID();
 
-    EntityItemID entityID(id);
     if (!_entityTree) {
-        properties.setLastEditedBy(sessionID);
-        queueEntityMessage(PacketType::EntityEdit, entityID, properties);
-        return id;
+        for (auto& edit : edits) {
+            edit.properties.setLastEditedBy(sessionID);
+            queueEntityMessage(PacketType::EntityEdit, edit.entityID, edit.properties);
+            edit.result = edit.entityID;
+        }
+        return;
     }
 
-    EntityItemPointer entity(nullptr);
-    SimulationOwner simulationOwner;
+    // the tree is locked once for each step of all the edits, rather than for each step of each edit
     _entityTree->withReadLock([&] {
-        // make a copy of entity for local logic outside of tree lock
-        entity = _entityTree->findEntityByEntityItemID(entityID);
-        if (!entity) {
-            return;
-        }
+        for (auto& edit : edits) {
+            // make a copy of entity for local logic outside of tree lock
+            edit.entity = _entityTree->findEntityByEntityItemID(edit.entityID);
+            if (!edit.entity) {
+                continue;
+            }
 
-        if (entity->isAvatarEntity() && !entity->isMyAvatarEntity()) {
-            // don't edit other avatar's avatarEntities
-            properties = EntityItemProperties();
-            return;
+            if (edit.entity->isAvatarEntity() && !edit.entity->isMyAvatarEntity()) {
+                // don't edit other avatar's avatarEntities
+                edit.properties = EntityItemProperties();
+                continue;
+            }
+            // make a copy of simulationOwner for local logic outside of tree lock
+            edit.simulationOwner = edit.entity->getSimulationOwner();
         }
-        // make a copy of simulationOwner for local logic outside of tree lock
-        simulationOwner = entity->getSimulationOwner();
     });
 
-    QString previousUserdata;
-    if (entity) {
-        if (properties.hasTransformOrVelocityChanges() && entity->hasGrabs()) {
-            // if an entity is grabbed, the grab will override any position changes
-            properties.clearTransformOrVelocityChanges();
-        }
-        if (properties.hasSimulationRestrictedChanges()) {
-            if (_bidOnSimulationOwnership) {
-                // flag for simulation ownership, or upgrade existing ownership priority
-                // (actual bids for simulation ownership are sent by the PhysicalEntitySimulation)
-                entity->upgradeScriptSimulationPriority(properties.computeSimulationBidPriority());
-                if (entity->isLocalEntity() || entity->isMyAvatarEntity() || simulationOwner.getID() == sessionID) {
-                    // we own the simulation --> copy ALL restricted properties
-                    properties.copySimulationRestrictedProperties(entity);
-                } else {
-                    // we don't own the simulation but think we would like to
-
-                    uint8_t desiredPriority = entity->getScriptSimulationPriority();
-                    if (desiredPriority < simulationOwner.getPriority()) {
-                        // the priority at which we'd like to own it is not high enough
-                        // --> assume failure and clear all restricted property changes
-                        properties.clearSimulationRestrictedProperties();
-                    } else {
-                        // the priority at which we'd like to own it is high enough to win.
-                        // --> assume success and copy ALL restricted properties
+    for (auto& edit : edits) {
+        EntityItemProperties& properties = edit.properties;
+        const EntityItemPointer& entity = edit.entity;
+        const SimulationOwner& simulationOwner = edit.simulationOwner;
+
+        QString previousUserdata;
+        if (entity) {
+            if (properties.hasTransformOrVelocityChanges() && entity->hasGrabs()) {
+                // if an entity is grabbed, the grab will override any position changes
+                properties.clearTransformOrVelocityChanges();
+            }
+            if (properties.hasSimulationRestrictedChanges()) {
+                if (_bidOnSimulationOwnership) {
+                    // flag for simulation ownership, or upgrade existing ownership priority
+                    // (actual bids for simulation ownership are sent by the PhysicalEntitySimulation)
+                    entity->upgradeScriptSimulationPriority(properties.computeSimulationBidPriority());
+                    if (entity->isLocalEntity() || entity->isMyAvatarEntity() || simulationOwner.getID() == sessionID) {
+                        // we own the simulation --> copy ALL restricted properties
                         properties.copySimulationRestrictedProperties(entity);
+                    } else {
+                        // we don't own the simulation but think we would like to
+
+                        uint8_t desiredPriority = entity->getScriptSimulationPriority();
+                        if (desiredPriority < simulationOwner.getPriority()) {
+                            // the priority at which we'd like to own it is not high enough
+                            // --> assume failure and clear all restricted property changes
+                            properties.clearSimulationRestrictedProperties();
+                        } else {
+                            // the priority at which we'd like to own it is high enough to win.
+                            // --> assume success and copy ALL restricted properties
+                            properties.copySimulationRestrictedProperties(entity);
+                        }
                     }
+                } else if (!simulationOwner.getID().isNull()) {
+                    // someone owns this but not us
+                    // clear restricted properties
+                    properties.clearSimulationRestrictedProperties();
                 }
-            } else if (!simulationOwner.getID().isNull()) {
-                // someone owns this but not us
-                // clear restricted properties
-                properties.clearSimulationRestrictedProperties();
+                // clear the cached simulationPriority level
+                entity->upgradeScriptSimulationPriority(0);
             }
-            // clear the cached simulationPriority level
-            entity->upgradeScriptSimulationPriority(0);
-        }
 
-        // set these to make EntityItemProperties::getScalesWithParent() work correctly
-        entity::HostType entityHostType = entity->getEntityHostType();
-        properties.setEntityHostType(entityHostType);
-        if (entityHostType == entity::HostType::LOCAL) {
-            properties.setCollisionless(true);
-        }
-        properties.setOwningAvatarID(entity->getOwningAvatarID());
+            // set these to make EntityItemProperties::getScalesWithParent() work correctly
+            entity::HostType entityHostType = entity->getEntityHostType();
+            properties.setEntityHostType(entityHostType);
+            if (entityHostType == entity::HostType::LOCAL) {
+                properties.setCollisionless(true);
+            }
+            properties.setOwningAvatarID(entity->getOwningAvatarID());
 
-        // make sure the properties has a type, so that the encode can know which properties to include
-        properties.setType(entity->getType());
+            // make sure the properties has a type, so that the encode can know which properties to include
+            properties.setType(entity->getType());
 
-        previousUserdata = entity->getUserData();
-    } else if (_bidOnSimulationOwnership) {
-        // bail when simulation participants don't know about entity
-        return QUuid();
-    }
-    // TODO: it is possible there is no remaining useful changes in properties and we should bail early.
-    // How to check for this cheaply?
+            previousUserdata = entity->getUserData();
+        } else if (_bidOnSimulationOwnership) {
+            // bail when simulation participants don't know about entity
+            edit.rejected = true;
+            continue;
+        }
+        // TODO: it is possible there is no remaining useful changes in properties and we should bail early.
+        // How to check for this cheaply?
 
-    properties = convertPropertiesFromScriptSemantics(properties, properties.getScalesWithParent());
-    synchronizeEditedGrabProperties(properties, previousUserdata);
-    properties.setLastEditedBy(sessionID);
+        properties = convertPropertiesFromScriptSemantics(properties, properties.getScalesWithParent());
+        synchronizeEditedGrabProperties(properties, previousUserdata);
+        properties.setLastEditedBy(sessionID);
+        edit.hasQueryAACubeRelatedChanges = properties.queryAACubeRelatedPropertyChanged();
+    }
 
     // done reading and modifying properties --> start write
-    bool updatedEntity = false;
     _entityTree->withWriteLock([&] {
-        updatedEntity = _entityTree->updateEntity(entityID, properties);
+        for (auto& edit : edits) {
+            if (!edit.rejected) {
+                _entityTree->updateEntity(edit.entityID, edit.properties);
+            }
+        }
     });
 
     // FIXME: We need to figure out a better way to handle this. Allowing these edits to go through potentially
@@ -900,80 +946,93 @@ QUuid EntityScriptingInterface::editEntity(const QUuid& id, const EntityItemProp
     //     return QUuid();
     // }
 
-    bool hasQueryAACubeRelatedChanges = properties.queryAACubeRelatedPropertyChanged();
     // done writing, send update
     _entityTree->withReadLock([&] {
-        // find the entity again: maybe it was removed since we last found it
-        entity = _entityTree->findEntityByEntityItemID(entityID);
-        if (entity) {
-            uint64_t now = usecTimestampNow();
-            entity->setLastBroadcast(now);
-
-            if (hasQueryAACubeRelatedChanges) {
-                properties.setQueryAACube(entity->getQueryAACube());
-
-                // if we've moved an entity with children, check/update the queryAACube of all descendents and tell the server
-                // if they've changed.
-                entity->forEachDescendant([&](SpatiallyNestablePointer descendant) {
-                    if (descendant->getNestableType() == NestableType::Entity) {
-                        if (descendant->updateQueryAACube()) {
-                            EntityItemPointer entityDescendant = std::static_pointer_cast<EntityItem>(descendant);
-                            EntityItemProperties newQueryCubeProperties;
-                            newQueryCubeProperties.setQueryAACube(descendant->getQueryAACube());
-                            newQueryCubeProperties.setLastEdited(properties.getLastEdited());
-                            queueEntityMessage(PacketType::EntityEdit, descendant->getID(), newQueryCubeProperties);
-                            entityDescendant->setLastBroadcast(now);
+        for (auto& edit : edits) {
+            if (edit.rejected) {
+                continue;
+            }
+
+            // find the entity again: maybe it was removed since we last found it
+            edit.entity = _entityTree->findEntityByEntityItemID(edit.entityID);
+            if (edit.entity) {
+                uint64_t now = usecTimestampNow();
+                edit.entity->setLastBroadcast(now);
+
+                if (edit.hasQueryAACubeRelatedChanges) {
+                    edit.properties.setQueryAACube(edit.entity->getQueryAACube());
+
+                    // if we've moved an entity with children, check/update the queryAACube of all descendents and tell the server
+                    // if they've changed.
+                    edit.entity->forEachDescendant([&](SpatiallyNestablePointer descendant) {
+                        if (descendant->getNestableType() == NestableType::Entity) {
+                            if (descendant->updateQueryAACube()) {
+                                EntityItemPointer entityDescendant = std::static_pointer_cast<EntityItem>(descendant);
+                                EntityItemProperties newQueryCubeProperties;
+                                newQueryCubeProperties.setQueryAACube(descendant->getQueryAACube());
+                                newQueryCubeProperties.setLastEdited(edit.properties.getLastEdited());
+                                queueEntityMessage(PacketType::EntityEdit, descendant->getID(), newQueryCubeProperties);
+                                entityDescendant->setLastBroadcast(now);
+                            }
                         }
-                    }
-                });
+                    });
+                }
             }
         }
     });
-    if (!entity) {
-        if (hasQueryAACubeRelatedChanges) {
-            // Sometimes ESS don't have the entity they are trying to edit in their local tree.  In this case,
-            // convertPropertiesFromScriptSemantics doesn't get called and local* edits will get dropped.
-            // This is because, on the script side, "position" is in world frame, but in the network
-            // protocol and in the internal data-structures, "position" is "relative to parent".
-            // Compensate here.  The local* versions will get ignored during the edit-packet encoding.
-            if (properties.localPositionChanged()) {
-                properties.setPosition(properties.getLocalPosition());
-            }
-            if (properties.localRotationChanged()) {
-                properties.setRotation(properties.getLocalRotation());
-            }
-            if (properties.localVelocityChanged()) {
-                properties.setVelocity(properties.getLocalVelocity());
-            }
-            if (properties.localAngularVelocityChanged()) {
-                properties.setAngularVelocity(properties.getLocalAngularVelocity());
-            }
-            if (properties.localDimensionsChanged()) {
-                properties.setDimensions(properties.getLocalDimensions());
+
+    for (auto& edit : edits) {
+        if (edit.rejected) {
+            continue;
+        }
+
+        EntityItemProperties& properties = edit.properties;
+        if (!edit.entity) {
+            if (edit.hasQueryAACubeRelatedChanges) {
+                // Sometimes ESS don't have the entity they are trying to edit in their local tree.  In this case,
+                // convertPropertiesFromScriptSemantics doesn't get called and local* edits will get dropped.
+                // This is because, on the script side, "position" is in world frame, but in the network
+                // protocol and in the internal data-structures, "position" is "relative to parent".
+                // Compensate here.  The local* versions will get ignored during the edit-packet encoding.
+                if (properties.localPositionChanged()) {
+                    properties.setPosition(properties.getLocalPosition());
+                }
+                if (properties.localRotationChanged()) {
+                    properties.setRotation(properties.getLocalRotation());
+                }
+                if (properties.localVelocityChanged()) {
+                    properties.setVelocity(properties.getLocalVelocity());
+                }
+                if (properties.localAngularVelocityChanged()) {
+                    properties.setAngularVelocity(properties.getLocalAngularVelocity());
+                }
+                if (properties.localDimensionsChanged()) {
+                    properties.setDimensions(properties.getLocalDimensions());
+                }
             }
-        }
-        // we've made an edit to an entity we don't know about, or to a non-entity.  If it's a known non-entity,
-        // print a warning and don't send an edit packet to the entity-server.
-        QSharedPointer<SpatialParentFinder> parentFinder = DependencyManager::get<SpatialParentFinder>();
-        if (parentFinder) {
-            bool success;
-            auto nestableWP = parentFinder->find(id, success, static_cast<SpatialParentTree*>(_entityTree.get()));
-            if (success) {
-                auto nestable = nestableWP.lock();
-                if (nestable) {
-                    NestableType nestableType = nestable->getNestableType();
-                    if (nestableType == NestableType::Avatar) {
-                        qCWarning(entities) << "attempted edit on non-entity: " << id << nestable->getName();
-                        return QUuid(); // null script value to indicate failure
+            // we've made an edit to an entity we don't know about, or to a non-entity.  If it's a known non-entity,
+            // print a warning and don't send an edit packet to the entity-server.
+            QSharedPointer<SpatialParentFinder> parentFinder = DependencyManager::get<SpatialParentFinder>();
+            if (parentFinder) {
+                bool success;
+                auto nestableWP = parentFinder->find(edit.entityID, success, static_cast<SpatialParentTree*>(_entityTree.get()));
+                if (success) {
+                    auto nestable = nestableWP.lock();
+                    if (nestable) {
+                        NestableType nestableType = nestable->getNestableType();
+                        if (nestableType == NestableType::Avatar) {
+                            qCWarning(entities) << "attempted edit on non-entity: " << edit.entityID << nestable->getName();
+                            continue; // null result to indicate failure
+                        }
                     }
                 }
             }
         }
+        // we queue edit packets even if we don't know about the entity.  This is to allow AC agents
+        // to edit entities they know only by ID.
+        queueEntityMessage(PacketType::EntityEdit, edit.entityID, properties);
+        edit.result = edit.entityID;
     }
-    // we queue edit packets even if we don't know about the entity.  This is to allow AC agents
-    // to edit entities they know only by ID.
-    queueEntityMessage(PacketType::EntityEdit, entityID, properties);
-    return id;
 }
 
 void EntityScriptingInterface::deleteEntity(const QUuid& id) {
@@ -435,6 +435,20 @@ public slots:
      */
     Q_INVOKABLE QUuid editEntity(const QUuid& entityID, const EntityItemProperties& properties);
 
+    /*@jsdoc
+     * Edits several entities at once, changing one or more of their property values. This is quicker than editing them one
+     * at a time.
+     * @function Entities.editEntities
+     * @param {Uuid[]} entityIDs - The IDs of the entities to edit.
+     * @param {Entities.EntityProperties|Entities.EntityProperties[]} properties - The new property values: either the same
+     *     values for every entity, or an array of values for the entity at the same index in <code>entityIDs</code>.
+     * @returns {Uuid[]} For each entity, its ID if the edit was successful, otherwise {@link Uuid|Uuid.NULL}.
+     * @example <caption>Turn all the boxes nearby red.</caption>
+     * var entityIDs = Entities.findEntitiesByType("Box", MyAvatar.position, 10);
+     * Entities.editEntities(entityIDs, { color: { red: 255, green: 0, blue: 0 } });
+     */
+    Q_INVOKABLE QVector<QUuid> editEntities(const QVector<QUuid>& entityIDs, const QScriptValue& properties);
+
     /*@jsdoc
      * Deletes an entity.
      * @function Entities.deleteEntity
@@ -2547,6 +2561,20 @@ private:
     bool polyVoxWorker(QUuid entityID, std::function<bool(PolyVoxEntityItem&)> actor);
     bool setPoints(QUuid entityID, std::function<bool(LineEntityItem&)> actor);
     void queueEntityMessage(PacketType packetType, EntityItemID entityID, const EntityItemProperties& properties);
+
+    class EntityEdit {
+    public:
+        EntityEdit(const QUuid& id, const EntityItemProperties& properties) : entityID(id), properties(properties) {}
+
+        EntityItemID entityID;
+        EntityItemProperties properties;
+        EntityItemPointer entity;
+        SimulationOwner simulationOwner;
+        bool hasQueryAACubeRelatedChanges { false };
+        bool rejected { false };
+        QUuid result; // null unless the edit was made
+    };
+    void editEntitiesWorker(std::vector<EntityEdit>& edits);
     bool addLocalEntityCopy(EntityItemProperties& propertiesWithSimID, EntityItemID& id, bool isClone = false);
 
     EntityItemPointer checkForTreeEntityAndTypeMatch(const QUuid& entityID,
@@ -24,7 +24,7 @@ void EntitySimulation::setEntityTree(EntityTreePointer tree) {
         _changedEntities.clear();
         _entitiesToUpdate.clear();
         _mortalEntities.clear();
-        _nextExpiry = std::numeric_limits<uint64_t>::max();
+        _expiries = decltype(_expiries)();
     }
     _entityTree = tree;
 }
@@ -68,30 +68,44 @@ void EntitySimulation::prepareEntityForDelete(EntityItemPointer entity) {
 
 // protected
 void EntitySimulation::expireMortalEntities(uint64_t now) {
-    if (now > _nextExpiry) {
-        PROFILE_RANGE_EX(simulation_physics, "ExpireMortals", 0xffff00ff, (uint64_t)_mortalEntities.size());
-        // only search for expired entities if we expect to find one
-        _nextExpiry = std::numeric_limits<uint64_t>::max();
-        QMutexLocker lock(&_mutex);
-        SetOfEntities::iterator itemItr = _mortalEntities.begin();
-        while (itemItr != _mortalEntities.end()) {
-            EntityItemPointer entity = *itemItr;
-            uint64_t expiry = entity->getExpiry();
-            if (expiry < now) {
-                itemItr = _mortalEntities.erase(itemItr);
-                entity->die();
-                prepareEntityForDelete(entity);
-            } else {
-                if (expiry < _nextExpiry) {
-                    // remember the smallest _nextExpiry so we know when to start the next search
-                    _nextExpiry = expiry;
-                }
-                ++itemItr;
-            }
+    QMutexLocker lock(&_mutex);
+    if (_expiries.empty() || _expiries.top().expiry >= now) {
+        return;
+    }
+    PROFILE_RANGE_EX(simulation_physics, "ExpireMortals", 0xffff00ff, (uint64_t)_mortalEntities.size());
+    while (!_expiries.empty() && _expiries.top().expiry < now) {
+        Expiry due = _expiries.top();
+        _expiries.pop();
+
+        EntityItemPointer entity = due.entity.lock();
+        if (!entity || !_mortalEntities.contains(entity)) {
+            continue; // deleted, or no longer mortal
+        }
+        uint64_t expiry = entity->getExpiry();
+        if (expiry < now) {
+            _mortalEntities.remove(entity);
+            entity->die();
+            prepareEntityForDelete(entity);
+        } else if (expiry != due.expiry) {
+            // its lifetime was extended since it was queued
+            queueExpiry(entity, expiry);
         }
-        if (_mortalEntities.size() < 1) {
-            _nextExpiry = -1;
+    }
+}
+
+void EntitySimulation::queueExpiry(const EntityItemPointer& entity, uint64_t expiry) {
+    // protected: _mutex lock is guaranteed
+    _expiries.push({ expiry, entity });
+
+    // stale entries are normally dropped as they come up, but don't let long lifetimes pile them up
+    const size_t MIN_EXPIRIES_TO_REBUILD = 1024;
+    if (_expiries.size() > MIN_EXPIRIES_TO_REBUILD && _expiries.size() > 2 * (size_t)_mortalEntities.size()) {
+        std::vector<Expiry> expiries;
+        expiries.reserve(_mortalEntities.size());
+        for (const auto& mortalEntity : _mortalEntities) {
+            expiries.push_back({ mortalEntity->getExpiry(), mortalEntity });
         }
+        _expiries = decltype(_expiries)(std::greater<Expiry>(), std::move(expiries));
     }
 }
 
@@ -148,10 +162,7 @@ void EntitySimulation::addEntityToInternalLists(EntityItemPointer entity) {
     // protected: _mutex lock is guaranteed
     if (entity->isMortal()) {
         _mortalEntities.insert(entity);
-        uint64_t expiry = entity->getExpiry();
-        if (expiry < _nextExpiry) {
-            _nextExpiry = expiry;
-        }
+        queueExpiry(entity, entity->getExpiry());
     }
     if (entity->needsToCallUpdate()) {
         _entitiesToUpdate.insert(entity);
@@ -194,10 +205,7 @@ void EntitySimulation::processChangedEntity(const EntityItemPointer& entity) {
         if (dirtyFlags & Simulation::DIRTY_LIFETIME) {
             if (entity->isMortal()) {
                 _mortalEntities.insert(entity);
-                uint64_t expiry = entity->getExpiry();
-                if (expiry < _nextExpiry) {
-                    _nextExpiry = expiry;
-                }
+                queueExpiry(entity, entity->getExpiry());
             } else {
                 _mortalEntities.remove(entity);
             }
@@ -222,7 +230,7 @@ void EntitySimulation::clearEntities() {
     _deadEntitiesToRemoveFromTree.clear();
     _entitiesToUpdate.clear();
     _mortalEntities.clear();
-    _nextExpiry = std::numeric_limits<uint64_t>::max();
+    _expiries = decltype(_expiries)();
 }
 
 void EntitySimulation::moveSimpleKinematics(uint64_t now) {
@@ -13,7 +13,9 @@
 #define hifi_EntitySimulation_h
 
 #include <limits>
+#include <queue>
 #include <unordered_set>
+#include <vector>
 
 #include <QtCore/QObject>
 #include <QVector>
@@ -44,7 +46,7 @@ const int DIRTY_SIMULATION_FLAGS =
 
 class EntitySimulation : public QObject, public std::enable_shared_from_this<EntitySimulation> {
 public:
-    EntitySimulation() : _mutex(), _nextExpiry(std::numeric_limits<uint64_t>::max()), _entityTree(nullptr) { }
+    EntitySimulation() : _mutex(), _entityTree(nullptr) { }
     virtual ~EntitySimulation() { setEntityTree(nullptr); }
 
     inline EntitySimulationPointer getThisPointer() const {
@@ -105,7 +107,18 @@ private:
     SetOfEntities _allEntities; // tracks all entities added the simulation
     SetOfEntities _entitiesToUpdate; // entities that need to call EntityItem::update()
     SetOfEntities _mortalEntities; // entities that have an expiry
-    uint64_t _nextExpiry;
+
+    // The expiries of the mortal entities, soonest first, so that only the ones that are due are looked at.
+    // An entry goes stale when its entity's lifetime changes or it stops being mortal, and is then requeued
+    // or dropped when it comes up.
+    class Expiry {
+    public:
+        uint64_t expiry;
+        EntityItemWeakPointer entity;
+        bool operator>(const Expiry& other) const { return expiry > other.expiry; }
+    };
+    std::priority_queue<Expiry, std::vector<Expiry>, std::greater<Expiry>> _expiries;
+    void queueExpiry(const EntityItemPointer& entity, uint64_t expiry);
 
     // back pointer to EntityTree structure
     EntityTreePointer _entityTree;
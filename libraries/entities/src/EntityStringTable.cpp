@@ -0,0 +1,53 @@
+//
+//  EntityStringTable.cpp
+//  libraries/entities/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityStringTable.h"
+
+QMutex EntityStringTable::_mutex;
+QSet<QString> EntityStringTable::_strings;
+
+QString EntityStringTable::intern(const QString& value) {
+    if (value.isEmpty()) {
+        return QString();
+    }
+    QMutexLocker locker(&_mutex);
+    auto itr = _strings.constFind(value);
+    if (itr != _strings.constEnd()) {
+        return *itr;
+    }
+    _strings.insert(value);
+    return value;
+}
+
+void EntityStringTable::prune() {
+    QMutexLocker locker(&_mutex);
+    auto itr = _strings.begin();
+    while (itr != _strings.end()) {
+        if (itr->isDetached()) {
+            itr = _strings.erase(itr);
+        } else {
+            ++itr;
+        }
+    }
+}
+
+int EntityStringTable::size() {
+    QMutexLocker locker(&_mutex);
+    return _strings.size();
+}
+
+size_t EntityStringTable::getMemoryUsage() {
+    QMutexLocker locker(&_mutex);
+    size_t bytes = 0;
+    for (const auto& string : _strings) {
+        bytes += sizeof(QString) + (size_t)string.capacity() * sizeof(QChar);
+    }
+    return bytes;
+}
@@ -0,0 +1,38 @@
+//
+//  EntityStringTable.h
+//  libraries/entities/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_EntityStringTable_h
+#define vircadia_EntityStringTable_h
+
+#include <QtCore/QMutex>
+#include <QtCore/QSet>
+#include <QtCore/QString>
+
+// Interns the string properties that lots of entities share a value for: model, script, texture and material URLs.
+//
+// Each entity read from a packet or a file gets its own copy of these strings; an entity that keeps the table's copy
+// instead shares it with every other entity with the same value, as QString is implicitly shared.
+class EntityStringTable {
+public:
+    // returns the table's copy of value, adding value to the table if it isn't there yet
+    static QString intern(const QString& value);
+
+    // drops the strings that only the table holds on to
+    static void prune();
+
+    static int size();
+    static size_t getMemoryUsage();
+
+private:
+    static QMutex _mutex;
+    static QSet<QString> _strings;
+};
+
+#endif // vircadia_EntityStringTable_h
@@ -13,6 +13,8 @@
 #include "EntityTree.h"
 #include <QtCore/QDateTime>
 #include <QtCore/QQueue>
+#include <QtCore/QRunnable>
+#include <QtCore/QThreadPool>
 #include <openssl/err.h>
 #include <openssl/pem.h>
 #include <openssl/x509.h>
@@ -26,11 +28,13 @@
 #include <QtScript/QScriptEngine>
 
 #include <Extents.h>
+#include <OctreeElementPool.h>
 #include <PerfStat.h>
 #include <Profile.h>
 #include <AddressManager.h>
 
 #include "EntitySimulation.h"
+#include "EntityStringTable.h"
 #include "VariantMapToScriptValue.h"
 
 #include "AddEntityOperator.h"
@@ -39,6 +43,7 @@
 #include "EntitiesLogging.h"
 #include "RecurseOctreeToMapOperator.h"
 #include "RecurseOctreeToJSONOperator.h"
+#include "EntityTreeSnapshot.h"
 #include "LogHandler.h"
 #include "EntityEditFilters.h"
 #include "EntityDynamicFactoryInterface.h"
@@ -77,7 +82,7 @@ void EntityTree::createRootElement() {
 }
 
 OctreeElementPointer EntityTree::createNewElement(unsigned char* octalCode) {
-    auto newElement = EntityTreeElementPointer(new EntityTreeElement(octalCode));
+    auto newElement = std::allocate_shared<EntityTreeElement>(OctreeElementAllocator<EntityTreeElement>(), octalCode);
     newElement->setTree(std::static_pointer_cast<EntityTree>(shared_from_this()));
     return std::static_pointer_cast<OctreeElement>(newElement);
 }
@@ -287,6 +292,36 @@ bool EntityTree::handlesEditPacketType(PacketType packetType) const {
     }
 }
 
+bool EntityTree::canDecodeEditPacketType(PacketType packetType) const {
+    // clones need the entity they're cloned from and erases are cheap, so only these are decoded ahead of time
+    switch (packetType) {
+        case PacketType::EntityAdd:
+        case PacketType::EntityEdit:
+        case PacketType::EntityPhysics:
+            return true;
+        default:
+            return false;
+    }
+}
+
+Octree::DecodedEditPointer EntityTree::decodeEditPacketData(PacketType packetType, const unsigned char* editData,
+                                                            int maxLength) const {
+    if (!canDecodeEditPacketType(packetType)) {
+        return nullptr;
+    }
+
+    quint64 startDecode = usecTimestampNow();
+    std::unique_ptr<DecodedEntityEdit> edit(new DecodedEntityEdit());
+    edit->isValid = EntityItemProperties::decodeEntityEditPacket(editData, maxLength, edit->processedBytes,
+                                                                 edit->entityItemID, edit->properties);
+    edit->decodeTime = usecTimestampNow() - startDecode;
+    return std::move(edit);
+}
+
+void EntityTree::processDecodedEdit(ReceivedMessage& message, DecodedEdit& edit, const SharedNodePointer& senderNode) {
+    processEdit(message, nullptr, 0, senderNode, static_cast<DecodedEntityEdit*>(&edit));
+}
+
 /// Adds a new entity item to the tree
 void EntityTree::postAddEntity(EntityItemPointer entity) {
     assert(entity);
@@ -408,12 +443,13 @@ bool EntityTree::updateEntity(EntityItemPointer entity, const EntityItemProperti
                         // the sender is trying to steal ownership from another simulator
                         // so we apply the rules for ownership change:
                         // (1) higher priority wins
-                        // (2) equal priority wins if ownership filter has expired
+                        // (2) equal priority wins if the current owner's lockout has expired
                         // (3) VOLUNTEER priority is promoted to RECRUIT
+                        // NOTE: the lockout is the entity's, the submitted owner was decoded without one
                         uint8_t oldPriority = entity->getSimulationPriority();
                         uint8_t newPriority = properties.getSimulationOwner().getPriority();
                         if (newPriority > oldPriority ||
-                             (newPriority == oldPriority && properties.getSimulationOwner().hasExpired())) {
+                             (newPriority == oldPriority && entity->getSimulationOwner().hasExpired())) {
                             simulationBlocked = false;
                             if (properties.getSimulationOwner().getPriority() == VOLUNTEER_SIMULATION_PRIORITY) {
                                 properties.setSimulationPriority(RECRUIT_SIMULATION_PRIORITY);
@@ -769,6 +805,9 @@ void EntityTree::processRemovedEntities(const DeleteEntityOperator& theOperator)
             // set up the deleted entities ID
             QWriteLocker recentlyDeletedEntitiesLocker(&_recentlyDeletedEntitiesLock);
             _recentlyDeletedEntityItemIDs.insert(deletedAt, theEntity->getEntityItemID());
+            if (_isJournaled) {
+                _journalDeletedIDs.push_back(theEntity->getEntityItemID());
+            }
         } else {
             theEntity->forEachDescendant([&](SpatiallyNestablePointer child) {
                 if (child->getNestableType() == NestableType::Avatar) {
@@ -1802,6 +1841,11 @@ void EntityTree::processChallengeOwnershipPacket(ReceivedMessage& message, const
 // NOTE: Caller must lock the tree before calling this.
 int EntityTree::processEditPacketData(ReceivedMessage& message, const unsigned char* editData, int maxLength,
                                      const SharedNodePointer& senderNode) {
+    return processEdit(message, editData, maxLength, senderNode, nullptr);
+}
+
+int EntityTree::processEdit(ReceivedMessage& message, const unsigned char* editData, int maxLength,
+                            const SharedNodePointer& senderNode, DecodedEntityEdit* decodedEdit) {
     if (!getIsServer()) {
         qCWarning(entities) << "EntityTree::processEditPacketData() should only be called on a server tree.";
         return 0;
@@ -1856,11 +1900,16 @@ int EntityTree::processEditPacketData(ReceivedMessage& message, const unsigned c
                         properties = entityToClone->getProperties();
                     }
                 }
+            } else if (decodedEdit) {
+                validEditPacket = decodedEdit->isValid;
+                processedBytes = decodedEdit->processedBytes;
+                entityItemID = decodedEdit->entityItemID;
+                properties = std::move(decodedEdit->properties);
             } else {
                 validEditPacket = EntityItemProperties::decodeEntityEditPacket(editData, maxLength, processedBytes, entityItemID, properties);
             }
 
-            endDecode = usecTimestampNow();
+            endDecode = decodedEdit ? startDecode + decodedEdit->decodeTime : usecTimestampNow();
 
             EntityItemPointer existingEntity;
             if (!isAdd) {
@@ -2335,6 +2384,27 @@ void EntityTree::update(bool simulate) {
             _simulation->updateEntities();
         });
     }
+
+    // let go of the shared strings of entities that have been deleted or edited
+    const quint64 STRING_TABLE_PRUNE_PERIOD = 10 * USECS_PER_SECOND;
+    quint64 now = usecTimestampNow();
+    if (now - _lastStringTablePrune > STRING_TABLE_PRUNE_PERIOD) {
+        _lastStringTablePrune = now;
+        EntityStringTable::prune();
+    }
+}
+
+std::vector<EntityTree::EntityMemoryUsage> EntityTree::getMemoryUsageByType() const {
+    std::vector<EntityMemoryUsage> usage(EntityTypes::NUM_TYPES);
+    QReadLocker locker(&_entityMapLock);
+    for (const auto& entity : _entityMap) {
+        int type = entity->getType();
+        if (type >= 0 && type < EntityTypes::NUM_TYPES) {
+            usage[type].count++;
+            usage[type].bytes += entity->getApproximateMemoryUsage();
+        }
+    }
+    return usage;
 }
 
 quint64 EntityTree::getAdjustedConsiderSince(quint64 sinceTime) {
@@ -3068,9 +3138,52 @@ void convertGrabUserDataToProperties(EntityItemProperties& properties) {
 
 
 bool EntityTree::readFromMap(QVariantMap& map, const bool isImport) {
+    beginReadFromMap(map, isImport);
+
+    // map will have a top-level list keyed as "Entities".  This will be extracted
+    // and iterated over.  Each member of this list is converted to a QVariantMap, then
+    // to a QScriptValue, and then to EntityItemProperties.  These properties are used
+    // to add the new entity to the EntityTree.
+    bool success = readEntitiesBatch(map["Entities"].toList());
+    return endReadFromMap(map) && success;
+}
+
+void EntityTree::beginReadFromMap(const QVariantMap& map, const bool isImport) {
+    _mapRead.reset(new MapRead());
+
     // These are needed to deal with older content (before adding inheritance modes)
-    int contentVersion = map["Version"].toInt();
+    _mapRead->contentVersion = map["Version"].toInt();
+    _mapRead->isImport = isImport;
+
+    _namedPaths.clear();
+    readMapInfo(map);
+}
+
+bool EntityTree::readEntitiesBatch(const QVariantList& entities) {
+    if (!_mapRead) {
+        return false;
+    }
+
+    _mapRead->numEntities += entities.size();
+    return readEntitiesFromList(entities, _mapRead->contentVersion, _mapRead->isImport, _mapRead->cloneIDs);
+}
+
+bool EntityTree::endReadFromMap(const QVariantMap& map) {
+    if (!_mapRead) {
+        return false;
+    }
+
+    // whatever came after the entities
+    readMapInfo(map);
+    updateCloneIDs(_mapRead->cloneIDs);
+
+    // Empty map or invalidly formed file.
+    bool success = _mapRead->numEntities > 0;
+    _mapRead.reset();
+    return success;
+}
 
+void EntityTree::readMapInfo(const QVariantMap& map) {
     if (map.contains("Id")) {
         _persistID = map["Id"].toUuid();
     }
@@ -3079,7 +3192,6 @@ bool EntityTree::readFromMap(QVariantMap& map, const bool isImport) {
         _persistDataVersion = map["DataVersion"].toInt();
     }
 
-    _namedPaths.clear();
     if (map.contains("Paths")) {
         QVariantMap namedPathsMap = map["Paths"].toMap();
         for(QVariantMap::const_iterator iter = namedPathsMap.begin(); iter != namedPathsMap.end(); ++iter) {
@@ -3088,20 +3200,20 @@ bool EntityTree::readFromMap(QVariantMap& map, const bool isImport) {
             _namedPaths[namedPathName] = namedPathViewPoint;
         }
     }
+}
 
-    // map will have a top-level list keyed as "Entities".  This will be extracted
-    // and iterated over.  Each member of this list is converted to a QVariantMap, then
-    // to a QScriptValue, and then to EntityItemProperties.  These properties are used
-    // to add the new entity to the EntityTree.
-    QVariantList entitiesQList = map["Entities"].toList();
-    QScriptEngine scriptEngine;
-
-    if (entitiesQList.length() == 0) {
-        // Empty map or invalidly formed file.
-        return false;
+void EntityTree::updateCloneIDs(const QMap<QUuid, QVector<QUuid>>& cloneIDs) {
+    for (const auto& entityID : cloneIDs.keys()) {
+        auto entity = findEntityByID(entityID);
+        if (entity) {
+            entity->setCloneIDs(cloneIDs.value(entityID));
+        }
     }
+}
 
-    QMap<QUuid, QVector<QUuid>> cloneIDs;
+bool EntityTree::readEntitiesFromList(const QVariantList& entitiesQList, int contentVersion, bool isImport,
+                                      QMap<QUuid, QVector<QUuid>>& cloneIDs) {
+    QScriptEngine scriptEngine;
 
     bool success = true;
     foreach (QVariant entityVariant, entitiesQList) {
@@ -3258,25 +3370,262 @@ bool EntityTree::readFromMap(QVariantMap& map, const bool isImport) {
         }
     }
 
-    for (const auto& entityID : cloneIDs.keys()) {
-        auto entity = findEntityByID(entityID);
-        if (entity) {
-            entity->setCloneIDs(cloneIDs.value(entityID));
+    return success;
+}
+
+bool EntityTree::writeToJSON(const JSONWriter& writer, const OctreeElementPointer& element) {
+    QScriptEngine scriptEngine;
+    RecurseOctreeToJSONOperator theOperator(element, &scriptEngine, writer);
+    withReadLock([&] {
+        recurseTreeWithOperator(&theOperator);
+    });
+
+    return theOperator.flush();
+}
+
+// the properties of every entity, in the order the tree is written out in
+class EntityTreePersistSnapshot : public OctreeSnapshot {
+public:
+    bool writeToJSON(const Octree::JSONWriter& writer) const override {
+        QScriptEngine scriptEngine;
+        RecurseOctreeToJSONOperator jsonOperator(OctreeElementPointer(), &scriptEngine, writer);
+        for (const auto& entity : entities) {
+            jsonOperator.writeProperties(entity.second);
         }
+        return jsonOperator.flush();
     }
 
+    bool writeBinarySnapshot(QIODevice& device) const override {
+        return EntityTreeSnapshot::write(device, entities, namedPaths);
+    }
+
+    std::vector<EntityTreeSnapshot::Entity> entities;
+    std::map<QString, QString> namedPaths;
+};
+
+class RecurseOctreeToSnapshotOperator : public RecurseOctreeOperator {
+public:
+    RecurseOctreeToSnapshotOperator(std::vector<EntityTreeSnapshot::Entity>& entities) : _entities(entities) {}
+    bool preRecursion(const OctreeElementPointer& element) override { return true; }
+    bool postRecursion(const OctreeElementPointer& element) override {
+        std::static_pointer_cast<EntityTreeElement>(element)->forEachEntity([&](const EntityItemPointer& entity) {
+            _entities.emplace_back(entity->getEntityItemID(), entity->getProperties());
+        });
+        return true;
+    }
+private:
+    std::vector<EntityTreeSnapshot::Entity>& _entities;
+};
+
+OctreeSnapshotPointer EntityTree::takeSnapshot() {
+    auto snapshot = std::make_shared<EntityTreePersistSnapshot>();
+    withReadLock([&] {
+        fillSnapshotInfo(*snapshot);
+        snapshot->namedPaths = _namedPaths;
+        {
+            QReadLocker locker(&_entityMapLock);
+            snapshot->entities.reserve(_entityMap.size());
+        }
+
+        // only the properties are copied here, converting them is left to whoever writes the snapshot out
+        RecurseOctreeToSnapshotOperator theOperator(snapshot->entities);
+        recurseTreeWithOperator(&theOperator);
+    });
+    return snapshot;
+}
+
+bool EntityTree::writeBinarySnapshot(QIODevice& device) {
+    return takeSnapshot()->writeBinarySnapshot(device);
+}
+
+bool EntityTree::readBinarySnapshot(const char* data, qint64 size, PacketVersion contentVersion) {
+    // unlike JSON, the edit encoding of older versions isn't converted, those are loaded from the JSON backups
+    if (contentVersion != versionForPacketType(expectedDataPacketType())) {
+        qCWarning(entities) << "Can't read a binary snapshot from entity version" << contentVersion;
+        return false;
+    }
+
+    EntityTreeSnapshot snapshot;
+    if (!snapshot.read(data, size)) {
+        qCWarning(entities) << "Binary snapshot is unreadable";
+        return false;
+    }
+
+    _namedPaths = snapshot.getNamedPaths();
+
+    class DecodeTask : public QRunnable {
+    public:
+        DecodeTask(const EntityTreeSnapshot& snapshot, int section, std::vector<EntityTreeSnapshot::Entity>& entities,
+                   bool& success) :
+            _snapshot(snapshot), _section(section), _entities(entities), _success(success) {}
+        void run() override { _success = _snapshot.decodeSection(_section, _entities); }
+    private:
+        const EntityTreeSnapshot& _snapshot;
+        int _section;
+        std::vector<EntityTreeSnapshot::Entity>& _entities;
+        bool& _success;
+    };
+
+    // the sections are decoded in parallel a batch at a time, so that only a batch's properties are held at once,
+    // then added to the tree in order
+    QThreadPool decodePool;
+    const int numSections = snapshot.getNumSections();
+    const int sectionsPerBatch = std::max(decodePool.maxThreadCount(), 1);
+    QMap<QUuid, QVector<QUuid>> cloneIDs;
+    bool success = true;
+
+    for (int firstSection = 0; firstSection < numSections; firstSection += sectionsPerBatch) {
+        int numBatchSections = std::min(sectionsPerBatch, numSections - firstSection);
+        std::vector<std::vector<EntityTreeSnapshot::Entity>> decodedSections(numBatchSections);
+        std::unique_ptr<bool[]> decoded(new bool[numBatchSections]);
+        for (int i = 0; i < numBatchSections; ++i) {
+            decodePool.start(new DecodeTask(snapshot, firstSection + i, decodedSections[i], decoded[i]));
+        }
+        decodePool.waitForDone();
+
+        for (int i = 0; i < numBatchSections; ++i) {
+            if (!decoded[i]) {
+                qCWarning(entities) << "Binary snapshot section" << firstSection + i << "is unreadable";
+                success = false;
+            }
+
+            for (const auto& decodedEntity : decodedSections[i]) {
+                EntityItemPointer entity = addEntity(decodedEntity.first, decodedEntity.second);
+                if (!entity) {
+                    qCDebug(entities) << "adding Entity failed:" << decodedEntity.first << decodedEntity.second.getType();
+                    success = false;
+                    continue;
+                }
+
+                const QUuid& cloneOriginID = entity->getCloneOriginID();
+                if (!cloneOriginID.isNull()) {
+                    cloneIDs[cloneOriginID].push_back(entity->getEntityItemID());
+                }
+            }
+        }
+    }
+
+    updateCloneIDs(cloneIDs);
     return success;
 }
 
-bool EntityTree::writeToJSON(QString& jsonString, const OctreeElementPointer& element) {
+bool EntityTree::startJournal() {
+    if (!getIsServer()) {
+        return false;
+    }
+
+    QWriteLocker locker(&_recentlyDeletedEntitiesLock);
+    _isJournaled = true;
+    return true;
+}
+
+int EntityTree::writeJournal(QByteArray& journal, quint64 changedSince) {
+    // one compact JSON object per line: {"Erased":id} for an entity that was deleted,
+    // {"Entity":properties} with all of the properties of an entity that was added or changed
+    std::vector<EntityItemID> deletedIDs;
+    {
+        QWriteLocker locker(&_recentlyDeletedEntitiesLock);
+        deletedIDs.swap(_journalDeletedIDs);
+    }
+
+    int numRecords = 0;
+    for (const auto& entityID : deletedIDs) {
+        QJsonObject record;
+        record["Erased"] = entityID.toString();
+        journal += QJsonDocument(record).toJson(QJsonDocument::Compact) + '\n';
+        ++numRecords;
+    }
+
     QScriptEngine scriptEngine;
-    RecurseOctreeToJSONOperator theOperator(element, &scriptEngine, jsonString);
     withReadLock([&] {
-        recurseTreeWithOperator(&theOperator);
+        QReadLocker locker(&_entityMapLock);
+        for (const auto& entity : _entityMap) {
+            // lastChangedOnServer rather than lastEdited, which is in the editor's time and can be behind ours
+            quint64 changedAt = std::max(entity->getLastChangedOnServer(), entity->getLastSimulated());
+            if (changedAt <= changedSince || !entity->isDomainEntity()) {
+                continue;
+            }
+
+            // all of the properties, so that a replayed record also resets what was changed back to its default
+            QScriptValue properties = EntityItemPropertiesToScriptValue(&scriptEngine, entity->getProperties());
+            QJsonObject record;
+            record["Entity"] = QJsonObject::fromVariantMap(properties.toVariant().toMap());
+            journal += QJsonDocument(record).toJson(QJsonDocument::Compact) + '\n';
+            ++numRecords;
+        }
     });
 
-    jsonString = theOperator.getJson();
-    return true;
+    return numRecords;
+}
+
+bool EntityTree::readJournal(const QByteArray& journal) {
+    // only the last record for each entity counts, in the order the entities first appear
+    std::vector<QUuid> entityIDs;
+    QHash<QUuid, QJsonObject> lastRecords;
+    int numUnreadable = 0;
+    for (const QByteArray& line : journal.split('\n')) {
+        if (line.isEmpty()) {
+            continue;
+        }
+
+        QJsonObject record = QJsonDocument::fromJson(line).object();
+        QUuid entityID = record.contains("Erased") ? QUuid(record["Erased"].toString())
+                                                   : QUuid(record["Entity"].toObject()["id"].toString());
+        if (entityID.isNull()) {
+            // e.g. the last line, if we stopped in the middle of writing it
+            ++numUnreadable;
+            continue;
+        }
+
+        if (!lastRecords.contains(entityID)) {
+            entityIDs.push_back(entityID);
+        }
+        lastRecords[entityID] = record;
+    }
+
+    if (numUnreadable > 0) {
+        qCWarning(entities) << "Skipped" << numUnreadable << "unreadable entity journal records";
+    }
+
+    std::vector<EntityItemPointer> replacedEntities;
+    std::vector<EntityItemID> erasedIDs;
+    QVariantList addedEntities;
+    for (const auto& entityID : entityIDs) {
+        const QJsonObject& record = lastRecords[entityID];
+        if (record.contains("Entity")) {
+            EntityItemPointer existingEntity = findEntityByID(entityID);
+            if (existingEntity) {
+                replacedEntities.push_back(existingEntity);
+            }
+            addedEntities.push_back(record["Entity"].toObject().toVariantMap());
+        } else {
+            erasedIDs.push_back(entityID);
+        }
+    }
+
+    bool success = true;
+    withWriteLock([&] {
+        // entities with a newer version in the journal are swapped for it, their children stay where they are
+        if (!replacedEntities.empty()) {
+            deleteEntitiesByPointer(replacedEntities);
+        }
+        deleteEntitiesByID(erasedIDs, true);
+
+        if (!addedEntities.isEmpty()) {
+            QMap<QUuid, QVector<QUuid>> cloneIDs;
+            success = readEntitiesFromList(addedEntities, (int)versionForPacketType(expectedDataPacketType()), false,
+                                           cloneIDs);
+            updateCloneIDs(cloneIDs);
+        }
+
+        // these deletes are already in the journal
+        QWriteLocker locker(&_recentlyDeletedEntitiesLock);
+        _journalDeletedIDs.clear();
+    });
+
+    qCDebug(entities) << "Replayed entity journal:" << addedEntities.size() << "added or changed," << erasedIDs.size()
+                      << "erased";
+    return success;
 }
 
 void EntityTree::resetClientEditStats() {
@@ -19,6 +19,7 @@
 #include <SpatialParentFinder.h>
 
 #include "AddEntityOperator.h"
+#include "EntityTreeChangeJournal.h"
 #include "EntityTreeElement.h"
 #include "DeleteEntityOperator.h"
 #include "MovingEntitiesOperator.h"
@@ -90,6 +91,10 @@ public:
     void fixupTerseEditLogging(EntityItemProperties& properties, QList<QString>& changedProperties);
     virtual int processEditPacketData(ReceivedMessage& message, const unsigned char* editData, int maxLength,
                                       const SharedNodePointer& senderNode) override;
+    virtual bool canDecodeEditPacketType(PacketType packetType) const override;
+    virtual DecodedEditPointer decodeEditPacketData(PacketType packetType, const unsigned char* editData,
+                                                    int maxLength) const override;
+    virtual void processDecodedEdit(ReceivedMessage& message, DecodedEdit& edit, const SharedNodePointer& senderNode) override;
     virtual void processChallengeOwnershipRequestPacket(ReceivedMessage& message, const SharedNodePointer& sourceNode) override;
     virtual void processChallengeOwnershipReplyPacket(ReceivedMessage& message, const SharedNodePointer& sourceNode) override;
     virtual void processChallengeOwnershipPacket(ReceivedMessage& message, const SharedNodePointer& sourceNode) override;
@@ -115,6 +120,13 @@ public:
     void preUpdate() override;
     void update(bool simulate = true) override;
 
+    struct EntityMemoryUsage {
+        int count { 0 };
+        size_t bytes { 0 };
+    };
+    // the number of entities and their approximate memory use, indexed by EntityTypes::EntityType
+    std::vector<EntityMemoryUsage> getMemoryUsageByType() const;
+
     // The newer API...
     void postAddEntity(EntityItemPointer entityItem);
 
@@ -194,10 +206,26 @@ public:
     bool wantTerseEditLogging() const { return _wantTerseEditLogging; }
     void setWantTerseEditLogging(bool value) { _wantTerseEditLogging = value; }
 
+    // when on, an entity that moves a little is left in its element for as long as the element still contains it,
+    // instead of being moved down to the element that fits it best
+    bool getLooseElementFit() const { return _looseElementFit; }
+    void setLooseElementFit(bool value) { _looseElementFit = value; }
+
     virtual bool writeToMap(QVariantMap& entityDescription, OctreeElementPointer element, bool skipDefaultValues,
                             bool skipThoseWithBadParents) override;
     virtual bool readFromMap(QVariantMap& entityDescription, const bool isImport = false) override;
-    virtual bool writeToJSON(QString& jsonString, const OctreeElementPointer& element) override;
+    virtual bool canReadEntitiesBatches() const override { return true; }
+    virtual void beginReadFromMap(const QVariantMap& entityDescription, const bool isImport) override;
+    virtual bool readEntitiesBatch(const QVariantList& entities) override;
+    virtual bool endReadFromMap(const QVariantMap& entityDescription) override;
+    virtual bool writeToJSON(const JSONWriter& writer, const OctreeElementPointer& element) override;
+    virtual OctreeSnapshotPointer takeSnapshot() override;
+    virtual bool writeBinarySnapshot(QIODevice& device) override;
+    virtual bool readBinarySnapshot(const char* data, qint64 size, PacketVersion contentVersion) override;
+
+    virtual bool startJournal() override;
+    virtual int writeJournal(QByteArray& journal, quint64 changedSince) override;
+    virtual bool readJournal(const QByteArray& journal) override;
 
 
     glm::vec3 getContentsDimensions();
@@ -262,6 +290,9 @@ public:
     void setIsServerlessMode(bool value) { _serverlessDomain = value; }
     bool isServerlessMode() const { return _serverlessDomain; }
 
+    // the elements whose content changed, only kept on server trees
+    EntityTreeChangeJournal& getChangeJournal() { return _changeJournal; }
+
     static void setGetEntityObjectOperator(std::function<QObject*(const QUuid&)> getEntityObjectOperator) { _getEntityObjectOperator = getEntityObjectOperator; }
     static QObject* getEntityObject(const QUuid& id);
 
@@ -313,6 +344,8 @@ protected:
 
     mutable QReadWriteLock _recentlyDeletedEntitiesLock; /// lock of server side recent deletes
     QMultiMap<quint64, QUuid> _recentlyDeletedEntityItemIDs; /// server side recent deletes
+    bool _isJournaled { false };
+    std::vector<EntityItemID> _journalDeletedIDs; /// server side deletes not yet in the persist journal
 
     mutable QReadWriteLock _deletedEntitiesLock; /// lock of client side recent deletes
     QSet<QUuid> _deletedEntityItemIDs; /// client side recent deletes
@@ -330,6 +363,8 @@ protected:
     mutable QReadWriteLock _entityMapLock;
     QHash<EntityItemID, EntityItemPointer> _entityMap;
 
+    quint64 _lastStringTablePrune { 0 };
+
     mutable QReadWriteLock _entityCertificateIDMapLock;
     QHash<QString, QList<EntityItemID>> _entityCertificateIDMap;
 
@@ -340,6 +375,7 @@ protected:
 
     bool _wantEditLogging = false;
     bool _wantTerseEditLogging = false;
+    bool _looseElementFit = false;
 
 
     // some performance tracking properties - only used in server trees
@@ -383,6 +419,33 @@ protected:
     Q_INVOKABLE void startChallengeOwnershipTimer(const EntityItemID& entityItemID);
 
 private:
+    class DecodedEntityEdit : public DecodedEdit {
+    public:
+        bool isValid { false };
+        EntityItemID entityItemID;
+        EntityItemProperties properties;
+        quint64 decodeTime { 0 };
+    };
+
+    // what's kept between beginReadFromMap and endReadFromMap
+    struct MapRead {
+        int contentVersion { 0 };
+        bool isImport { false };
+        int numEntities { 0 };
+        QMap<QUuid, QVector<QUuid>> cloneIDs;
+    };
+    std::unique_ptr<MapRead> _mapRead;
+
+    void readMapInfo(const QVariantMap& map);
+    // the clones of each entity are only known once all of them have been read
+    bool readEntitiesFromList(const QVariantList& entitiesQList, int contentVersion, bool isImport,
+                              QMap<QUuid, QVector<QUuid>>& cloneIDs);
+    void updateCloneIDs(const QMap<QUuid, QVector<QUuid>>& cloneIDs);
+
+    // decodedEdit is an edit that decodeEditPacketData() already read from editData, or nullptr to read it here
+    int processEdit(ReceivedMessage& message, const unsigned char* editData, int maxLength,
+                    const SharedNodePointer& senderNode, DecodedEntityEdit* decodedEdit);
+
     void addCertifiedEntityOnServer(EntityItemPointer entity);
     void removeCertifiedEntityOnServer(EntityItemPointer entity);
     void sendChallengeOwnershipPacket(const QString& certID, const QString& ownerKey, const EntityItemID& entityItemID, const SharedNodePointer& senderNode);
@@ -401,6 +464,8 @@ private:
 
     bool _serverlessDomain { false };
 
+    EntityTreeChangeJournal _changeJournal;
+
     std::map<QString, QString> _namedPaths;
 
     // Return an AACube containing object and all its entity descendants
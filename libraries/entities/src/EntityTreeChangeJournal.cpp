@@ -0,0 +1,64 @@
+//
+//  EntityTreeChangeJournal.cpp
+//  libraries/entities/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityTreeChangeJournal.h"
+
+#include <unordered_set>
+
+#include "EntityTreeElement.h"
+
+void EntityTreeChangeJournal::append(const std::shared_ptr<EntityTreeElement>& element) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // an element is usually bumped several times in a row by the same edit
+    if (!_entries.empty() && _entries.back().lock() == element) {
+        return;
+    }
+
+    _entries.push_back(element);
+    ++_head;
+    if (_entries.size() > MAX_ENTRIES) {
+        _entries.pop_front();
+    }
+}
+
+EntityTreeChangeJournal::Sequence EntityTreeChangeJournal::getHead() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _head;
+}
+
+bool EntityTreeChangeJournal::getChangedSince(Sequence sequence,
+                                              std::vector<std::shared_ptr<EntityTreeElement>>& changed,
+                                              Sequence& head) const {
+    changed.clear();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    Sequence oldest = _head - _entries.size();
+    if (sequence < oldest || sequence > _head) {
+        return false;
+    }
+
+    std::unordered_set<EntityTreeElement*> seen;
+    for (auto it = _entries.begin() + (size_t)(sequence - oldest); it != _entries.end(); ++it) {
+        auto element = it->lock();
+        if (element && seen.insert(element.get()).second) {
+            changed.push_back(element);
+        }
+    }
+    head = _head;
+    return true;
+}
+
+void EntityTreeChangeJournal::clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // keep counting from where we were, readers holding an old sequence will find it's gone
+    _entries.clear();
+}
@@ -0,0 +1,51 @@
+//
+//  EntityTreeChangeJournal.h
+//  libraries/entities/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_EntityTreeChangeJournal_h
+#define vircadia_EntityTreeChangeJournal_h
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class EntityTreeElement;
+using EntityTreeElementWeakPointer = std::weak_ptr<EntityTreeElement>;
+
+// The elements of a tree whose content changed, in the order they changed.
+//
+// Readers keep the sequence they last read up to and ask for what changed since, instead of walking the tree to find
+// it. Only the most recent changes are kept; a reader that fell further behind than that has to walk the tree again.
+class EntityTreeChangeJournal {
+public:
+    using Sequence = uint64_t;
+
+    static const size_t MAX_ENTRIES = 4096;
+
+    // thread-safe, called whenever an element's content changes
+    void append(const std::shared_ptr<EntityTreeElement>& element);
+
+    // the sequence the next change will have
+    Sequence getHead() const;
+
+    // fills changed with the distinct elements that changed since sequence (that are still in the tree) and head with
+    // the sequence to ask from next time, or returns false if the journal doesn't go back that far
+    bool getChangedSince(Sequence sequence, std::vector<std::shared_ptr<EntityTreeElement>>& changed, Sequence& head) const;
+
+    void clear();
+
+private:
+    mutable std::mutex _mutex;
+    std::deque<EntityTreeElementWeakPointer> _entries;
+    Sequence _head { 0 };
+};
+
+#endif // vircadia_EntityTreeChangeJournal_h
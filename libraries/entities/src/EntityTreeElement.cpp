@@ -14,6 +14,7 @@
 #include <glm/gtx/transform.hpp>
 
 #include <GeometryUtil.h>
+#include <OctreeElementPool.h>
 #include <OctreeUtils.h>
 #include <Extents.h>
 
@@ -32,7 +33,7 @@ EntityTreeElement::~EntityTreeElement() {
 }
 
 OctreeElementPointer EntityTreeElement::createNewElement(unsigned char* octalCode) {
-    auto newChild = EntityTreeElementPointer(new EntityTreeElement(octalCode));
+    auto newChild = std::allocate_shared<EntityTreeElement>(OctreeElementAllocator<EntityTreeElement>(), octalCode);
     newChild->setTree(_myTree);
     return newChild;
 }
@@ -116,6 +117,20 @@ bool EntityTreeElement::containsBounds(const glm::vec3& minPoint, const glm::vec
     return _cube.contains(clampedMin) && _cube.contains(clampedMax);
 }
 
+// with a loose fit an entity stays in an element up to this many times its size, so it only moves into a child or
+// grandchild once it has gone at least that far from the boundary it was straddling
+static const float LOOSE_FIT_MAX_SCALE_RATIO = 4.0f;
+
+bool EntityTreeElement::canKeepBounds(const AABox& bounds) const {
+    if (bestFitBounds(bounds)) {
+        return true;
+    }
+    if (!_myTree || !_myTree->getLooseElementFit() || !containsBounds(bounds)) {
+        return false;
+    }
+    return _cube.getScale() <= LOOSE_FIT_MAX_SCALE_RATIO * bounds.getLargestDimension();
+}
+
 bool EntityTreeElement::bestFitBounds(const glm::vec3& minPoint, const glm::vec3& maxPoint) const {
     glm::vec3 clampedMin = glm::clamp(minPoint, (float)-HALF_TREE_SCALE, (float)HALF_TREE_SCALE);
     glm::vec3 clampedMax = glm::clamp(maxPoint, (float)-HALF_TREE_SCALE, (float)HALF_TREE_SCALE);
@@ -442,15 +457,15 @@ QUuid EntityTreeElement::evalClosetEntity(const glm::vec3& position, PickFilter
 
 void EntityTreeElement::evalEntitiesInSphere(const glm::vec3& position, float radius, PickFilter searchFilter, QVector<QUuid>& foundEntities) const {
     forEachEntity([&](EntityItemPointer entity) {
-        if (!checkFilterSettings(entity, searchFilter)) {
-            return;
-        }
-
         bool success;
         AABox entityBox = entity->getAABox(success);
         // if the sphere doesn't intersect with our world frame AABox, we don't need to consider the more complex case
         glm::vec3 penetration;
         if (success && entityBox.findSpherePenetration(position, radius, penetration)) {
+            // the filter reads several properties under the entity's lock, so it's only checked for the entities that are close
+            if (!checkFilterSettings(entity, searchFilter)) {
+                return;
+            }
 
             glm::vec3 dimensions = entity->getScaledDimensions();
 
@@ -494,7 +509,7 @@ void EntityTreeElement::evalEntitiesInSphere(const glm::vec3& position, float ra
 
 void EntityTreeElement::evalEntitiesInSphereWithType(const glm::vec3& position, float radius, EntityTypes::EntityType type, PickFilter searchFilter, QVector<QUuid>& foundEntities) const {
     forEachEntity([&](EntityItemPointer entity) {
-        if (!checkFilterSettings(entity, searchFilter) || type != entity->getType()) {
+        if (type != entity->getType()) {
             return;
         }
 
@@ -503,6 +518,9 @@ void EntityTreeElement::evalEntitiesInSphereWithType(const glm::vec3& position,
         // if the sphere doesn't intersect with our world frame AABox, we don't need to consider the more complex case
         glm::vec3 penetration;
         if (success && entityBox.findSpherePenetration(position, radius, penetration)) {
+            if (!checkFilterSettings(entity, searchFilter)) {
+                return;
+            }
 
             glm::vec3 dimensions = entity->getScaledDimensions();
 
@@ -546,21 +564,21 @@ void EntityTreeElement::evalEntitiesInSphereWithType(const glm::vec3& position,
 
 void EntityTreeElement::evalEntitiesInSphereWithName(const glm::vec3& position, float radius, const QString& name, bool caseSensitive, PickFilter searchFilter, QVector<QUuid>& foundEntities) const {
     forEachEntity([&](EntityItemPointer entity) {
-        if (!checkFilterSettings(entity, searchFilter)) {
-            return;
-        }
-
-        QString entityName = entity->getName();
-        if ((caseSensitive && name != entityName) || (!caseSensitive && name.toLower() != entityName.toLower())) {
-            return;
-        }
-
         bool success;
         AABox entityBox = entity->getAABox(success);
 
         // if the sphere doesn't intersect with our world frame AABox, we don't need to consider the more complex case
         glm::vec3 penetration;
         if (success && entityBox.findSpherePenetration(position, radius, penetration)) {
+            // the name and filter are read under the entity's lock, so they're only checked for the entities that are close
+            if (!checkFilterSettings(entity, searchFilter)) {
+                return;
+            }
+
+            QString entityName = entity->getName();
+            if ((caseSensitive && name != entityName) || (!caseSensitive && name.toLower() != entityName.toLower())) {
+                return;
+            }
 
             glm::vec3 dimensions = entity->getScaledDimensions();
 
@@ -604,10 +622,6 @@ void EntityTreeElement::evalEntitiesInSphereWithName(const glm::vec3& position,
 
 void EntityTreeElement::evalEntitiesInCube(const AACube& cube, PickFilter searchFilter, QVector<QUuid>& foundEntities) const {
     forEachEntity([&](EntityItemPointer entity) {
-        if (!checkFilterSettings(entity, searchFilter)) {
-            return;
-        }
-
         bool success;
         AABox entityBox = entity->getAABox(success);
 
@@ -627,7 +641,8 @@ void EntityTreeElement::evalEntitiesInCube(const AACube& cube, PickFilter search
         //
 
         // If the entities AABox touches the search cube then consider it to be found
-        if (success && entityBox.touches(cube)) {
+        // (the filter is checked last, it reads several properties under the entity's lock)
+        if (success && entityBox.touches(cube) && checkFilterSettings(entity, searchFilter)) {
             foundEntities.push_back(entity->getID());
         }
     });
@@ -635,10 +650,6 @@ void EntityTreeElement::evalEntitiesInCube(const AACube& cube, PickFilter search
 
 void EntityTreeElement::evalEntitiesInBox(const AABox& box, PickFilter searchFilter, QVector<QUuid>& foundEntities) const {
     forEachEntity([&](EntityItemPointer entity) {
-        if (!checkFilterSettings(entity, searchFilter)) {
-            return;
-        }
-
         bool success;
         AABox entityBox = entity->getAABox(success);
 
@@ -658,7 +669,7 @@ void EntityTreeElement::evalEntitiesInBox(const AABox& box, PickFilter searchFil
         //
 
         // If the entities AABox touches the search cube then consider it to be found
-        if (success && entityBox.touches(box)) {
+        if (success && entityBox.touches(box) && checkFilterSettings(entity, searchFilter)) {
             foundEntities.push_back(entity->getID());
         }
     });
@@ -666,15 +677,12 @@ void EntityTreeElement::evalEntitiesInBox(const AABox& box, PickFilter searchFil
 
 void EntityTreeElement::evalEntitiesInFrustum(const ViewFrustum& frustum, PickFilter searchFilter, QVector<QUuid>& foundEntities) const {
     forEachEntity([&](EntityItemPointer entity) {
-        if (!checkFilterSettings(entity, searchFilter)) {
-            return;
-        }
-
         bool success;
         AABox entityBox = entity->getAABox(success);
 
         // FIXME - See FIXMEs for similar methods above.
-        if (success && (frustum.boxIntersectsFrustum(entityBox) || frustum.boxIntersectsKeyhole(entityBox))) {
+        if (success && (frustum.boxIntersectsFrustum(entityBox) || frustum.boxIntersectsKeyhole(entityBox)) &&
+            checkFilterSettings(entity, searchFilter)) {
             foundEntities.push_back(entity->getID());
         }
     });
@@ -807,6 +815,13 @@ void EntityTreeElement::expandExtentsToContents(Extents& extents) {
     });
 }
 
+void EntityTreeElement::bumpChangedContent() {
+    OctreeElement::bumpChangedContent();
+    if (_myTree && _myTree->getIsServer()) {
+        _myTree->getChangeJournal().append(getThisPointer());
+    }
+}
+
 uint16_t EntityTreeElement::size() const {
     uint16_t result = 0;
     withReadLock([&] {
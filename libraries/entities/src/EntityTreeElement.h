@@ -209,12 +209,19 @@ public:
     bool containsBounds(const glm::vec3& minPoint, const glm::vec3& maxPoint) const; // NOTE: units in tree units
     bool bestFitBounds(const glm::vec3& minPoint, const glm::vec3& maxPoint) const; // NOTE: units in tree units
 
+    // true if an entity already in this element can stay here with the new bounds: the best fit, or with the tree's loose
+    // fit on, any element that contains them and is no more than a couple of levels bigger than the best fit
+    bool canKeepBounds(const AABox& bounds) const; // NOTE: units in tree units
+
     void debugDump();
 
     bool pruneChildren();
 
     void expandExtentsToContents(Extents& extents);
 
+    // also journals the change on server trees, for the senders
+    virtual void bumpChangedContent() override;
+
     EntityTreeElementPointer getThisPointer() {
         return std::static_pointer_cast<EntityTreeElement>(shared_from_this());
     }
@@ -0,0 +1,156 @@
+//
+//  EntityTreeSnapshot.cpp
+//  libraries/entities/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityTreeSnapshot.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QDataStream>
+#include <QtCore/QIODevice>
+#include <QtCore/QtEndian>
+
+#include "EntitiesLogging.h"
+
+// most entities fit in the first buffer, the buffer is grown for the ones with a lot of data
+static const int INITIAL_ENCODE_BUFFER_SIZE = 16 * 1024;
+static const int MAX_ENCODE_BUFFER_SIZE = 16 * 1024 * 1024;
+
+static bool encodeEntity(const EntityTreeSnapshot::Entity& entity, QByteArray& record) {
+    EntityPropertyFlags requestedProperties = entity.second.getDesiredProperties();
+
+    // who's simulating an entity is only meaningful to the server that's running it
+    requestedProperties -= PROP_SIMULATION_OWNER;
+
+    // all of the properties go in one record, rather than being split up like edits are to fit in packets
+    for (int bufferSize = INITIAL_ENCODE_BUFFER_SIZE; bufferSize <= MAX_ENCODE_BUFFER_SIZE; bufferSize *= 2) {
+        record.resize(bufferSize);
+        EntityPropertyFlags didntFitProperties;
+        OctreeElement::AppendState encodeResult = EntityItemProperties::encodeEntityEditPacket(PacketType::EntityAdd,
+            entity.first, entity.second, record, requestedProperties, didntFitProperties);
+        if (encodeResult == OctreeElement::COMPLETED) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool EntityTreeSnapshot::write(QIODevice& device, const std::vector<Entity>& entityItems,
+                               const std::map<QString, QString>& namedPaths) {
+    QDataStream stream(&device);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    const qint64 bodyStart = device.pos();
+
+    stream << (quint32)namedPaths.size();
+    for (const auto& namedPath : namedPaths) {
+        stream << namedPath.first << namedPath.second;
+    }
+
+    std::vector<Section> sections;
+    QByteArray record;
+    for (const auto& entity : entityItems) {
+        if (sections.empty() || sections.back().numEntities == (quint32)ENTITIES_PER_SECTION) {
+            sections.push_back({ (quint64)(device.pos() - bodyStart), 0, 0 });
+        }
+
+        if (!encodeEntity(entity, record)) {
+            qCWarning(entities) << "Entity is too big to be saved:" << entity.first;
+            continue;
+        }
+
+        stream << (quint32)record.size();
+        stream.writeRawData(record.constData(), record.size());
+        ++sections.back().numEntities;
+    }
+
+    const quint64 indexOffset = device.pos() - bodyStart;
+    for (size_t i = 0; i < sections.size(); ++i) {
+        quint64 end = (i + 1 < sections.size()) ? sections[i + 1].offset : indexOffset;
+        sections[i].size = end - sections[i].offset;
+    }
+
+    stream << (quint32)sections.size();
+    for (const auto& section : sections) {
+        stream << section.offset << section.size << section.numEntities;
+    }
+    stream << indexOffset;
+
+    return stream.status() == QDataStream::Ok;
+}
+
+bool EntityTreeSnapshot::read(const char* data, qint64 size) {
+    _data = data;
+    _size = size;
+    _sections.clear();
+    _namedPaths.clear();
+
+    if (size < (qint64)sizeof(quint64)) {
+        return false;
+    }
+
+    const quint64 indexOffset = qFromLittleEndian<quint64>(reinterpret_cast<const uchar*>(data + size - sizeof(quint64)));
+    if (indexOffset > (quint64)(size - sizeof(quint64))) {
+        return false;
+    }
+
+    QDataStream indexStream(QByteArray::fromRawData(data + indexOffset, size - sizeof(quint64) - indexOffset));
+    indexStream.setByteOrder(QDataStream::LittleEndian);
+    quint32 numSections = 0;
+    indexStream >> numSections;
+    for (quint32 i = 0; i < numSections && indexStream.status() == QDataStream::Ok; ++i) {
+        Section section;
+        indexStream >> section.offset >> section.size >> section.numEntities;
+        if (section.offset > indexOffset || section.size > indexOffset - section.offset) {
+            return false;
+        }
+        _sections.push_back(section);
+    }
+
+    QDataStream pathsStream(QByteArray::fromRawData(data, indexOffset));
+    pathsStream.setByteOrder(QDataStream::LittleEndian);
+    quint32 numNamedPaths = 0;
+    pathsStream >> numNamedPaths;
+    for (quint32 i = 0; i < numNamedPaths && pathsStream.status() == QDataStream::Ok; ++i) {
+        QString name;
+        QString viewpoint;
+        pathsStream >> name >> viewpoint;
+        _namedPaths[name] = viewpoint;
+    }
+
+    return indexStream.status() == QDataStream::Ok && pathsStream.status() == QDataStream::Ok;
+}
+
+bool EntityTreeSnapshot::decodeSection(int sectionIndex, std::vector<Entity>& entities) const {
+    const Section& section = _sections[sectionIndex];
+    const char* dataAt = _data + section.offset;
+    const char* end = dataAt + section.size;
+
+    entities.reserve(entities.size() + section.numEntities);
+    for (quint32 i = 0; i < section.numEntities; ++i) {
+        if (end - dataAt < (qint64)sizeof(quint32)) {
+            return false;
+        }
+        quint32 recordSize = qFromLittleEndian<quint32>(reinterpret_cast<const uchar*>(dataAt));
+        dataAt += sizeof(quint32);
+        if ((quint64)(end - dataAt) < recordSize) {
+            return false;
+        }
+
+        EntityItemID entityID;
+        EntityItemProperties properties;
+        int processedBytes = 0;
+        if (!EntityItemProperties::decodeEntityEditPacket(reinterpret_cast<const unsigned char*>(dataAt), recordSize,
+                                                          processedBytes, entityID, properties)) {
+            return false;
+        }
+        dataAt += recordSize;
+
+        entities.emplace_back(entityID, properties);
+    }
+    return true;
+}
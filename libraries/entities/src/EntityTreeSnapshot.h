@@ -0,0 +1,69 @@
+//
+//  EntityTreeSnapshot.h
+//  libraries/entities/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_EntityTreeSnapshot_h
+#define vircadia_EntityTreeSnapshot_h
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "EntityItemID.h"
+#include "EntityItemProperties.h"
+
+class QIODevice;
+
+// The body of a binary entity persist file.
+//
+// Each entity is stored as the edit packet encoding of all of its properties, and the entities are grouped into
+// sections that are listed in an index at the end of the body, so that a reader can decode the sections in parallel
+// straight out of a mapped file:
+//
+//     quint32 number of named paths, then (QString name, QString viewpoint) for each
+//     sections: (quint32 size, edit packet data) for each entity
+//     index: quint32 number of sections, then (quint64 offset, quint64 size, quint32 number of entities) for each
+//     quint64 offset of the index
+//
+// Offsets are from the start of the body and everything is little endian.
+class EntityTreeSnapshot {
+public:
+    using Entity = std::pair<EntityItemID, EntityItemProperties>;
+
+    static const int ENTITIES_PER_SECTION = 1024;
+
+    // entityItems are the entities' properties, with the desired properties they were got with
+    static bool write(QIODevice& device, const std::vector<Entity>& entityItems,
+                      const std::map<QString, QString>& namedPaths);
+
+    // data has to stay valid for as long as the sections are being decoded
+    bool read(const char* data, qint64 size);
+
+    const std::map<QString, QString>& getNamedPaths() const { return _namedPaths; }
+    int getNumSections() const { return (int)_sections.size(); }
+
+    // thread-safe
+    bool decodeSection(int section, std::vector<Entity>& entities) const;
+
+private:
+    struct Section {
+        quint64 offset;
+        quint64 size;
+        quint32 numEntities;
+    };
+
+    const char* _data { nullptr };
+    qint64 _size { 0 };
+    std::vector<Section> _sections;
+    std::map<QString, QString> _namedPaths;
+};
+
+#endif // vircadia_EntityTreeSnapshot_h
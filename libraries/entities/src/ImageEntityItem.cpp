@@ -9,6 +9,7 @@
 #include "ImageEntityItem.h"
 
 #include "EntityItemProperties.h"
+#include "EntityStringTable.h"
 
 EntityItemPointer ImageEntityItem::factory(const EntityItemID& entityID, const EntityItemProperties& properties) {
     Pointer entity(new ImageEntityItem(entityID), [](ImageEntityItem* ptr) { ptr->deleteLater(); });
@@ -139,7 +140,7 @@ QString ImageEntityItem::getImageURL() const {
 void ImageEntityItem::setImageURL(const QString& url) {
     withWriteLock([&] {
         _needsRenderUpdate |= _imageURL != url;
-        _imageURL = url;
+        _imageURL = EntityStringTable::intern(url);
     });
 }
 
@@ -9,6 +9,7 @@
 #include "MaterialEntityItem.h"
 
 #include "EntityItemProperties.h"
+#include "EntityStringTable.h"
 
 #include "QJsonDocument"
 #include "QJsonArray"
@@ -109,6 +110,15 @@ void MaterialEntityItem::appendSubclassData(OctreePacketData* packetData, Encode
     APPEND_ENTITY_PROPERTY(PROP_MATERIAL_REPEAT, getMaterialRepeat());
 }
 
+size_t MaterialEntityItem::getApproximateMemoryUsage() const {
+    size_t bytes = EntityItem::getApproximateMemoryUsage() + sizeof(MaterialEntityItem) - sizeof(EntityItem);
+    withReadLock([&] {
+        bytes += getStringMemoryUsage(_materialURL) + getStringMemoryUsage(_materialData) +
+            getStringMemoryUsage(_parentMaterialName);
+    });
+    return bytes;
+}
+
 void MaterialEntityItem::debugDump() const {
     quint64 now = usecTimestampNow();
     qCDebug(entities) << " MATERIAL EntityItem id:" << getEntityItemID() << "---------------------------------------------";
@@ -145,7 +155,7 @@ QString MaterialEntityItem::getMaterialURL() const {
 void MaterialEntityItem::setMaterialURL(const QString& materialURL) {
     withWriteLock([&] {
         _needsRenderUpdate |= _materialURL != materialURL;
-        _materialURL = materialURL;
+        _materialURL = EntityStringTable::intern(materialURL);
     });
 }
 
@@ -43,6 +43,7 @@ public:
                                                  bool& somethingChanged) override;
 
     void debugDump() const override;
+    size_t getApproximateMemoryUsage() const override;
 
     virtual void setUnscaledDimensions(const glm::vec3& value) override;
 
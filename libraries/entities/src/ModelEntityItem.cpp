@@ -20,6 +20,7 @@
 
 #include "EntitiesLogging.h"
 #include "EntityItemProperties.h"
+#include "EntityStringTable.h"
 #include "EntityTree.h"
 #include "EntityTreeElement.h"
 #include "ResourceCache.h"
@@ -52,7 +53,7 @@ const QString ModelEntityItem::getTextures() const {
 void ModelEntityItem::setTextures(const QString& textures) {
     withWriteLock([&] {
         _needsRenderUpdate |= _textures != textures;
-        _textures = textures;
+        _textures = EntityStringTable::intern(textures);
     });
 }
 
@@ -248,6 +249,18 @@ void ModelEntityItem::update(const quint64& now) {
     EntityItem::update(now);
 }
 
+size_t ModelEntityItem::getApproximateMemoryUsage() const {
+    size_t bytes = EntityItem::getApproximateMemoryUsage() + sizeof(ModelEntityItem) - sizeof(EntityItem);
+    withReadLock([&] {
+        bytes += getStringMemoryUsage(_modelURL) + getStringMemoryUsage(_textures) +
+            (size_t)_blendshapeCoefficientsVector.capacity() * sizeof(float);
+    });
+    _jointDataLock.withReadLock([&] {
+        bytes += (size_t)_localJointData.capacity() * sizeof(ModelJointData);
+    });
+    return bytes;
+}
+
 void ModelEntityItem::debugDump() const {
     qCDebug(entities) << "ModelEntityItem id:" << getEntityItemID();
     qCDebug(entities) << "    edited ago:" << getEditedAgo();
@@ -299,7 +312,7 @@ ShapeType ModelEntityItem::getShapeType() const {
 void ModelEntityItem::setModelURL(const QString& url) {
     withWriteLock([&] {
         if (_modelURL != url) {
-            _modelURL = url;
+            _modelURL = EntityStringTable::intern(url);
             _needsRenderUpdate = true;
         }
     });
@@ -52,6 +52,7 @@ public:
     bool needsToCallUpdate() const override { return isAnimatingSomething(); }
 
     virtual void debugDump() const override;
+    size_t getApproximateMemoryUsage() const override;
 
     void setShapeType(ShapeType type) override;
     virtual ShapeType getShapeType() const override;
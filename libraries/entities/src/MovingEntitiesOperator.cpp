@@ -63,9 +63,9 @@ void MovingEntitiesOperator::addEntityToMoveList(EntityItemPointer entity, const
         return; // bail without adding.
     }
 
-    // If the original containing element is the best fit for the requested newCube locations then
+    // If the original containing element can keep the entity at the requested newCube locations then
     // we don't actually need to add the entity for moving and we can short circuit all this work
-    if (!oldContainingElement->bestFitBounds(newCubeClamped)) {
+    if (!oldContainingElement->canKeepBounds(newCubeClamped)) {
         // check our tree, to determine if this entity is known
         EntityToMoveDetails details;
         details.oldContainingElement = oldContainingElement;
@@ -203,6 +203,15 @@ void PolyLineEntityItem::appendSubclassData(OctreePacketData* packetData, Encode
     APPEND_ENTITY_PROPERTY(PROP_LINE_FACE_CAMERA, getFaceCamera());
 }
 
+size_t PolyLineEntityItem::getApproximateMemoryUsage() const {
+    size_t bytes = EntityItem::getApproximateMemoryUsage() + sizeof(PolyLineEntityItem) - sizeof(EntityItem);
+    withReadLock([&] {
+        bytes += (size_t)(_points.capacity() + _normals.capacity() + _colors.capacity()) * sizeof(glm::vec3) +
+            (size_t)_widths.capacity() * sizeof(float) + getStringMemoryUsage(_textures);
+    });
+    return bytes;
+}
+
 void PolyLineEntityItem::debugDump() const {
     quint64 now = usecTimestampNow();
     qCDebug(entities) << "   QUAD EntityItem id:" << getEntityItemID() << "---------------------------------------------";
@@ -93,6 +93,7 @@ public:
     void computeTightLocalBoundingBox(AABox& box) const;
 
     virtual void debugDump() const override;
+    size_t getApproximateMemoryUsage() const override;
 private:
     void computeAndUpdateDimensions();
 
@@ -189,6 +189,15 @@ void PolyVoxEntityItem::appendSubclassData(OctreePacketData* packetData, EncodeB
     APPEND_ENTITY_PROPERTY(PROP_Z_P_NEIGHBOR_ID, getZPNeighborID());
 }
 
+size_t PolyVoxEntityItem::getApproximateMemoryUsage() const {
+    size_t bytes = EntityItem::getApproximateMemoryUsage() + sizeof(PolyVoxEntityItem) - sizeof(EntityItem);
+    withReadLock([&] {
+        bytes += (_voxelData.isDetached() ? (size_t)_voxelData.capacity() : 0) + getStringMemoryUsage(_xTextureURL) +
+            getStringMemoryUsage(_yTextureURL) + getStringMemoryUsage(_zTextureURL);
+    });
+    return bytes;
+}
+
 void PolyVoxEntityItem::debugDump() const {
     quint64 now = usecTimestampNow();
     qCDebug(entities) << "   POLYVOX EntityItem id:" << getEntityItemID() << "---------------------------------------------";
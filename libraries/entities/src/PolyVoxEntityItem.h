@@ -53,6 +53,7 @@ class PolyVoxEntityItem : public EntityItem {
                                                   QVariantMap& extraInfo, bool precisionPicking) const override { return false; }
 
     virtual void debugDump() const override;
+    size_t getApproximateMemoryUsage() const override;
 
     virtual void setVoxelVolumeSize(const glm::vec3& voxelVolumeSize);
     virtual glm::vec3 getVoxelVolumeSize() const;
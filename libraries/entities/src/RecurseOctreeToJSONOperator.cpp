@@ -22,6 +22,21 @@ RecurseOctreeToJSONOperator::RecurseOctreeToJSONOperator(const OctreeElementPoin
     _toStringMethod = _engine->evaluate("(function() { return JSON.stringify(this, null, '    ') })");
 }
 
+RecurseOctreeToJSONOperator::RecurseOctreeToJSONOperator(const OctreeElementPointer& top, QScriptEngine* engine,
+    const Octree::JSONWriter& writer, bool skipDefaults, bool skipThoseWithBadParents) :
+    RecurseOctreeToJSONOperator(top, engine, QString(), skipDefaults, skipThoseWithBadParents)
+{
+    _writer = writer;
+}
+
+bool RecurseOctreeToJSONOperator::flush() {
+    if (_writer && !_writeFailed && !_json.isEmpty()) {
+        _writeFailed = !_writer(_json.toUtf8());
+        _json.clear();
+    }
+    return !_writeFailed;
+}
+
 bool RecurseOctreeToJSONOperator::postRecursion(const OctreeElementPointer& element) {
     EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
 
@@ -30,13 +45,25 @@ bool RecurseOctreeToJSONOperator::postRecursion(const OctreeElementPointer& elem
 }
 
 void RecurseOctreeToJSONOperator::processEntity(const EntityItemPointer& entity) {
+    if (_writeFailed) {
+        return;
+    }
+
     if (_skipThoseWithBadParents && !entity->isParentIDValid()) {
         return;  // we weren't able to resolve a parent from _parentID, so don't save this entity.
     }
 
+    writeProperties(entity->getProperties());
+}
+
+void RecurseOctreeToJSONOperator::writeProperties(const EntityItemProperties& properties) {
+    if (_writeFailed) {
+        return;
+    }
+
     QScriptValue qScriptValues = _skipDefaults
-        ? EntityItemNonDefaultPropertiesToScriptValue(_engine, entity->getProperties())
-        : EntityItemPropertiesToScriptValue(_engine, entity->getProperties());
+        ? EntityItemNonDefaultPropertiesToScriptValue(_engine, properties)
+        : EntityItemPropertiesToScriptValue(_engine, properties);
 
     if (_comma) {
         _json += ',';
@@ -47,4 +74,10 @@ void RecurseOctreeToJSONOperator::processEntity(const EntityItemPointer& entity)
     // Override default toString():
     qScriptValues.setProperty("toString", _toStringMethod);
     _json += qScriptValues.toString();
+
+    // a few entities at a time, so that the JSON of the whole tree is never in memory at once
+    static const int MAX_UNWRITTEN_JSON = 64 * 1024;
+    if (_writer && _json.size() > MAX_UNWRITTEN_JSON) {
+        flush();
+    }
 }
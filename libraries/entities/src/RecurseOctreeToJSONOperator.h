@@ -15,14 +15,26 @@ class RecurseOctreeToJSONOperator : public RecurseOctreeOperator {
 public:
     RecurseOctreeToJSONOperator(const OctreeElementPointer&, QScriptEngine* engine, QString jsonPrefix = QString(), bool skipDefaults = true,
         bool skipThoseWithBadParents = false);
+    // hands the JSON to writer whenever enough has built up, instead of keeping all of it
+    RecurseOctreeToJSONOperator(const OctreeElementPointer&, QScriptEngine* engine, const Octree::JSONWriter& writer,
+        bool skipDefaults = true, bool skipThoseWithBadParents = false);
     virtual bool preRecursion(const OctreeElementPointer& element) override { return true; };
     virtual bool postRecursion(const OctreeElementPointer& element) override;
 
     QString getJson() const { return _json; }
 
+    // for JSON of entities that were copied out of the tree
+    void writeProperties(const EntityItemProperties& properties);
+
+    // hands the rest of the JSON to the writer, returns false if the writer failed at any point
+    bool flush();
+
 private:
     void processEntity(const EntityItemPointer& entity);
 
+    Octree::JSONWriter _writer;
+    bool _writeFailed { false };
+
     QScriptEngine* _engine;
     QScriptValue _toStringMethod;
 
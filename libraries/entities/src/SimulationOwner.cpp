@@ -18,6 +18,8 @@
 
 // static
 const int SimulationOwner::NUM_BYTES_ENCODED = NUM_BYTES_RFC4122_UUID + 1;
+const uint64_t SimulationOwner::DEFAULT_OWNERSHIP_LOCKOUT_PERIOD = 200 * USECS_PER_MSEC;
+uint64_t SimulationOwner::_ownershipLockoutPeriod = SimulationOwner::DEFAULT_OWNERSHIP_LOCKOUT_PERIOD;
 
 SimulationOwner::SimulationOwner() :
         _id(),
@@ -84,8 +86,7 @@ bool SimulationOwner::set(const SimulationOwner& owner) {
 }
 
 void SimulationOwner::updateExpiry() {
-    const uint64_t OWNERSHIP_LOCKOUT_EXPIRY = 200 * USECS_PER_MSEC;
-    _expiry = usecTimestampNow() + OWNERSHIP_LOCKOUT_EXPIRY;
+    _expiry = usecTimestampNow() + _ownershipLockoutPeriod;
 }
 
 void SimulationOwner::clearCurrentOwner() {
@@ -37,9 +37,9 @@
 //
 //     (2) A bid at higher priority is accepted
 //
-//     (3) A bid at equal priority is accepted unless it was received shortly after (within 200msec) of the
-//         last ownership change.  This to avoid rapid ownership transitions should multiple participants
-//         bid simultaneously.
+//     (3) A bid at equal priority is accepted unless it was received shortly after (within 200msec, or as
+//         the entity-server is configured) of the last ownership change.  This to avoid rapid ownership
+//         transitions should multiple participants bid simultaneously.
 //
 //     (4) The current owner is the only participant allowed to clear their ownership or adjust priority.
 //
@@ -109,6 +109,11 @@ const uint8_t AVATAR_ENTITY_SIMULATION_PRIORITY = PERSONAL_SIMULATION_PRIORITY;
 class SimulationOwner {
 public:
     static const int NUM_BYTES_ENCODED;
+    static const uint64_t DEFAULT_OWNERSHIP_LOCKOUT_PERIOD;
+
+    // how long after an ownership change a bid at equal priority is refused, see rule (3) above
+    static void setOwnershipLockoutPeriod(uint64_t usecs) { _ownershipLockoutPeriod = usecs; }
+    static uint64_t getOwnershipLockoutPeriod() { return _ownershipLockoutPeriod; }
 
     SimulationOwner();
     SimulationOwner(const QUuid& id, uint8_t priority);
@@ -150,6 +155,8 @@ public:
     static void test();
 
 private:
+    static uint64_t _ownershipLockoutPeriod;
+
     QUuid _id; // owner
     uint64_t _expiry; // time when ownership can transition at equal priority
     uint8_t _priority; // priority of current owner
@@ -46,7 +46,7 @@ UpdateEntityOperator::UpdateEntityOperator(EntityTreePointer tree,
     _newEntityBox = _newEntityCube.clamp((float)-HALF_TREE_SCALE, (float)HALF_TREE_SCALE); // clamp to domain bounds
 
     // set oldElementBestFit true if the entity was in the correct element before this operator was run.
-    bool oldElementBestFit = _containingElement->bestFitBounds(_oldEntityBox);
+    bool oldElementBestFit = _containingElement->canKeepBounds(_oldEntityBox);
 
     // For some reason we've seen a case where the original containing element isn't a best fit for the old properties
     // in this case we want to move it, even if the properties haven't changed.
@@ -200,8 +200,10 @@ bool UpdateEntityOperator::preRecursion(const OctreeElementPointer& element) {
                               << entityTreeElement->bestFitBounds(_newEntityBox);
         }
 
-        // If this element is the best fit for the new entity properties, then add/or update it
-        if (entityTreeElement->bestFitBounds(_newEntityBox)) {
+        // If this element is the best fit for the new entity properties, or it already holds the entity and can
+        // keep it, then add/or update it
+        if (entityTreeElement->bestFitBounds(_newEntityBox) ||
+                (entityTreeElement == _containingElement && entityTreeElement->canKeepBounds(_newEntityBox))) {
 
             if (_wantDebug) {
                 qCDebug(entities) << "    *** THIS ELEMENT IS BEST FIT ***";
@@ -21,6 +21,7 @@
 
 #include "EntitiesLogging.h"
 #include "EntityItemProperties.h"
+#include "EntityStringTable.h"
 #include "EntityTree.h"
 #include "EntityTreeElement.h"
 
@@ -198,7 +199,7 @@ float WebEntityItem::getAlpha() const {
 void WebEntityItem::setSourceUrl(const QString& value) {
     withWriteLock([&] {
         _needsRenderUpdate |= _sourceUrl != value;
-        _sourceUrl = value;
+        _sourceUrl = EntityStringTable::intern(value);
     });
 }
 
@@ -436,14 +436,22 @@ const QString& getShaderCacheFile() {
 static const char* SHADER_JSON_TYPE_KEY = "type";
 static const char* SHADER_JSON_SOURCE_KEY = "source";
 static const char* SHADER_JSON_DATA_KEY = "data";
+static const char* SHADER_JSON_DRIVER_KEY = "driver";
 
-void gl::loadShaderCache(ShaderCache& cache) {
+void gl::loadShaderCache(ShaderCache& cache, const std::string& driver) {
 #if !defined(DISABLE_QML)
     QString shaderCacheFile = getShaderCacheFile();
     if (QFileInfo(shaderCacheFile).exists()) {
         QString json = FileUtils::readFile(shaderCacheFile);
         auto root = QJsonDocument::fromJson(json.toUtf8()).object();
+        if (root[SHADER_JSON_DRIVER_KEY].toString().toStdString() != driver) {
+            qCDebug(glLogging) << "Ignoring the shader cache, it was saved by another driver";
+            return;
+        }
         for (const auto& qhash : root.keys()) {
+            if (!root[qhash].isObject()) {
+                continue;
+            }
             auto programObject = root[qhash].toObject();
             QByteArray qbinary = QByteArray::fromBase64(programObject[SHADER_JSON_DATA_KEY].toString().toUtf8());
             std::string hash = qhash.toStdString();
@@ -457,7 +465,7 @@ void gl::loadShaderCache(ShaderCache& cache) {
 #endif
 }
 
-void gl::saveShaderCache(const ShaderCache& cache) {
+void gl::saveShaderCache(const ShaderCache& cache, const std::string& driver) {
     QByteArray json;
     {
         QVariantMap variantMap;
@@ -471,6 +479,7 @@ void gl::saveShaderCache(const ShaderCache& cache) {
             qentry[SHADER_JSON_DATA_KEY] = QByteArray{ binary.data(), (int)binary.size() }.toBase64();
             variantMap[key.c_str()] = qentry;
         }
+        variantMap[SHADER_JSON_DRIVER_KEY] = QString(driver.c_str());
         json = QJsonDocument::fromVariant(variantMap).toJson(QJsonDocument::Indented);
     }
 
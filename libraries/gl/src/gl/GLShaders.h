@@ -92,8 +92,9 @@ struct CachedShader {
 using ShaderCache = std::unordered_map<std::string, CachedShader>;
 
 std::string getShaderHash(const std::string& shaderSource);
-void loadShaderCache(ShaderCache& cache);
-void saveShaderCache(const ShaderCache& cache);
+// binaries are only valid for the driver that produced them, a cache saved by another driver is not loaded
+void loadShaderCache(ShaderCache& cache, const std::string& driver);
+void saveShaderCache(const ShaderCache& cache, const std::string& driver);
 
 #ifdef SEPARATE_PROGRAM
 bool compileShader(GLenum shaderDomain,
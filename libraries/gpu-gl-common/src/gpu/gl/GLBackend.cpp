@@ -971,6 +971,8 @@ void GLBackend::FrameTrash::cleanup() {
 
 void GLBackend::recycle() const {
     PROFILE_RANGE(render_gpu_gl, __FUNCTION__)
+    finishFramebufferReads();
+
     {
         std::list<std::function<void()>> lamdbasTrash;
         {
@@ -138,6 +138,11 @@ public:
                                      const Vec4i& region,
                                      QImage& destImage) final override;
 
+    // The region is copied to a pixel buffer, which is mapped when recycling from a later frame, once its fence is signaled
+    virtual void readFramebufferAsync(const FramebufferPointer& srcFramebuffer,
+                                      const Vec4i& region,
+                                      const FramebufferReadHandler& handler) final override;
+
     // this is the maximum numeber of available input buffers
     size_t getNumInputBuffers() const { return _input._invalidBuffers.size(); }
 
@@ -332,6 +337,16 @@ protected:
     std::list<std::string> profileRanges;
     mutable std::list<std::function<void()>> _lambdaQueue;
 
+    class FramebufferRead {
+    public:
+        GLuint buffer { 0 };
+        GLsync fence { nullptr };
+        Vec4i region;
+        FramebufferReadHandler handler;
+    };
+    mutable std::list<FramebufferRead> _framebufferReads;
+    void finishFramebufferReads() const;
+
     void renderPassTransfer(const Batch& batch);
     void renderPassDraw(const Batch& batch);
 
@@ -449,6 +464,9 @@ protected:
         List _cameraOffsets;
         mutable List::const_iterator _camerasItr;
         mutable size_t _currentCameraOffset{ INVALID_OFFSET };
+        // where the cameras of the batch were transferred to, when that's not the start of _cameraBuffer
+        mutable GLuint _currentCameraBuffer{ 0 };
+        mutable size_t _currentCameraBufferOffset{ 0 };
 
         void preUpdate(size_t commandIndex, const StereoState& stereo, Vec2u framebufferSize);
         void update(size_t commandIndex, const StereoState& stereo) const;
@@ -590,6 +608,7 @@ protected:
     // the source again
     struct ShaderBinaryCache {
         std::mutex _mutex;
+        std::string _driver;
         std::vector<GLint> _formats;
         std::unordered_map<std::string, ::gl::CachedShader> _binaries;
     } _shaderBinaryCache;
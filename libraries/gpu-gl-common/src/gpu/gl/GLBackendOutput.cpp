@@ -204,3 +204,72 @@ void GLBackend::downloadFramebuffer(const FramebufferPointer& srcFramebuffer, co
 
     (void) CHECK_GL_ERROR();
 }
+
+#if defined(USE_GLES)
+// reading a float color buffer is only guaranteed in rgba
+static const GLenum FRAMEBUFFER_READ_FORMAT = GL_RGBA;
+static const int FRAMEBUFFER_READ_CHANNELS = 4;
+#else
+static const GLenum FRAMEBUFFER_READ_FORMAT = GL_RED;
+static const int FRAMEBUFFER_READ_CHANNELS = 1;
+#endif
+
+void GLBackend::readFramebufferAsync(const FramebufferPointer& srcFramebuffer, const Vec4i& region, const FramebufferReadHandler& handler) {
+    auto readFBO = getFramebufferID(srcFramebuffer);
+    if (!srcFramebuffer || !readFBO) {
+        return;
+    }
+    if ((srcFramebuffer->getWidth() < (region.x + region.z)) || (srcFramebuffer->getHeight() < (region.y + region.w))) {
+        qCWarning(gpugllogging) << "GLBackend::readFramebufferAsync : srcFramebuffer is too small to provide the region queried";
+        return;
+    }
+
+    FramebufferRead read;
+    read.region = region;
+    read.handler = handler;
+    glGenBuffers(1, &read.buffer);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, read.buffer);
+    glBufferData(GL_PIXEL_PACK_BUFFER, region.z * region.w * FRAMEBUFFER_READ_CHANNELS * sizeof(float), nullptr, GL_STREAM_READ);
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, readFBO);
+    glReadPixels(region.x, region.y, region.z, region.w, FRAMEBUFFER_READ_FORMAT, GL_FLOAT, nullptr);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    read.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    _framebufferReads.push_back(read);
+
+    (void) CHECK_GL_ERROR();
+}
+
+void GLBackend::finishFramebufferReads() const {
+    auto it = _framebufferReads.begin();
+    while (it != _framebufferReads.end()) {
+        // reads are done in order, so none after a pending one can be done
+        GLenum status = glClientWaitSync(it->fence, 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+            break;
+        }
+        glDeleteSync(it->fence);
+
+        size_t numTexels = it->region.z * it->region.w;
+        std::vector<float> texels(numTexels);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, it->buffer);
+        auto mapped = (const float*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, numTexels * FRAMEBUFFER_READ_CHANNELS * sizeof(float), GL_MAP_READ_BIT);
+        if (mapped) {
+            for (size_t i = 0; i < numTexels; ++i) {
+                texels[i] = mapped[i * FRAMEBUFFER_READ_CHANNELS];
+            }
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        glDeleteBuffers(1, &it->buffer);
+
+        if (mapped) {
+            it->handler(texels);
+        }
+        it = _framebufferReads.erase(it);
+    }
+
+    (void) CHECK_GL_ERROR();
+}
@@ -294,6 +294,11 @@ void GLBackend::setResourceTexture(unsigned int slot, const TexturePointer& reso
     auto& textureState = _resource._textures[slot];
     // check cache before thinking
     if (compare(textureState._texture, resourceTexture)) {
+        // Still bound, but being drawn with again
+        GLTexture* object = Backend::getGPUObject<GLTexture>(*resourceTexture);
+        if (object) {
+            object->_lastBoundFrame = _textureManagement._transferEngine->getFrame();
+        }
         return;
     }
 
@@ -304,6 +309,7 @@ void GLBackend::setResourceTexture(unsigned int slot, const TexturePointer& reso
     GLTexture* object = syncGPUObject(resourceTexture);
     if (object) {
         assign(textureState._texture, resourceTexture);
+        object->_lastBoundFrame = _textureManagement._transferEngine->getFrame();
         GLuint to = object->_texture;
         textureState._target = object->_target;
         glActiveTexture(GL_TEXTURE0 + slot);
@@ -7,6 +7,7 @@
 //
 #include "GLBackend.h"
 #include "GLShader.h"
+#include <gl/GLHelpers.h>
 #include <gl/GLShaders.h>
 
 using namespace gpu;
@@ -397,10 +398,12 @@ void GLBackend::initShaderBinaryCache() {
         _shaderBinaryCache._formats.resize(numBinFormats);
         glGetIntegerv(GL_PROGRAM_BINARY_FORMATS, _shaderBinaryCache._formats.data());
     }
-    ::gl::loadShaderCache(_shaderBinaryCache._binaries);
+    const auto& contextInfo = ::gl::ContextInfo::get(true);
+    _shaderBinaryCache._driver = contextInfo.vendor + " " + contextInfo.renderer + " " + contextInfo.version;
+    ::gl::loadShaderCache(_shaderBinaryCache._binaries, _shaderBinaryCache._driver);
 }
 
 void GLBackend::killShaderBinaryCache() {
-    ::gl::saveShaderCache(_shaderBinaryCache._binaries);
+    ::gl::saveShaderCache(_shaderBinaryCache._binaries, _shaderBinaryCache._driver);
 }
 
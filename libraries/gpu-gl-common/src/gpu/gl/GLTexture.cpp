@@ -254,7 +254,12 @@ TransferJob::TransferJob(const Texture& texture,
     _bufferingLambda = [=](const TexturePointer& texture) {
         auto mipStorage = texture->accessStoredMipFace(sourceMip, face);
         if (mipStorage) {
-            _mipData = mipStorage->createView(_transferSize, _transferOffset);
+            // The storage is usually a view of a memory mapped KTX file, reading it into memory here means that the
+            // page faults happen on this thread rather than on the render thread when the data is uploaded
+            auto mipView = mipStorage->createView(_transferSize, _transferOffset);
+            if (mipView) {
+                _mipData = mipView->toMemoryStorage();
+            }
         } else {
             qCWarning(gpugllogging) << "Buffering failed because mip could not be retrieved from texture "
                 << texture->source().c_str();
@@ -40,15 +40,24 @@ public:
     /// and incremental transfer
     void addMemoryManagedTexture(const TexturePointer& texturePointer);
 
+    /// The frame that's being rendered, textures are stamped with it when they're bound for drawing so that the
+    /// ones that are actually being used can be given their memory first
+    uint32_t getFrame() const { return _frame; }
+
 protected:
     // Fetch all the currently active textures as strong pointers, while clearing the 
     // empty weak pointers out of _registeredTextures
     std::vector<TexturePointer> getAllTextures();
     void resetFrameTextureCreated() { _frameTexturesCreated = 0;  }
+    void advanceFrame() { ++_frame; }
+    // Whether the texture has been drawn with recently enough that it should keep or gain resolution
+    bool isInDemand(const GLTexture& texture) const;
 
 private:
     static const size_t MAX_RESOURCE_TEXTURES_PER_FRAME{ 2 };
     size_t _frameTexturesCreated{ 0 };
+    // Starts at 1, a texture that's never been bound has a last bound frame of 0
+    uint32_t _frame{ 1 };
     std::list<TextureWeakPointer> _registeredTextures;
 };
 
@@ -156,6 +165,7 @@ public:
     static const std::vector<GLenum>& getFaceTargets(GLenum textureType);
     static uint8_t getFaceCount(GLenum textureType);
     static GLenum getGLTextureType(const Texture& texture);
+    uint32_t getLastBoundFrame() const { return _lastBoundFrame; }
     virtual Size size() const = 0;
     virtual Size copyMipFaceLinesFromTexture(uint16_t mip, uint8_t face, const uvec3& size, uint32_t yOffset, GLenum internalFormat, GLenum format, GLenum type, Size sourceSize, const void* sourcePointer) const = 0;
     virtual Size copyMipFaceFromTexture(uint16_t sourceMip, uint16_t targetMip, uint8_t face) const final;
@@ -172,6 +182,9 @@ protected:
 
     virtual void copyTextureMipsInGPUMem(GLuint srcId, GLuint destId, uint16_t srcMipOffset, uint16_t destMipOffset, uint16_t populatedMips) {} // Only relevant for Variable Allocation textures
 
+    // The GLTextureTransferEngine frame that the texture was last bound in, set by the backend
+    mutable uint32_t _lastBoundFrame { 0 };
+
     GLTexture(const std::weak_ptr<gl::GLBackend>& backend, const Texture& texture, GLuint id);
 };
 
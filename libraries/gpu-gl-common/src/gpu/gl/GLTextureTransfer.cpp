@@ -11,6 +11,7 @@
 #include <QObject>
 #include <QtCore/QThread>
 #include <NumericalConstants.h>
+#include <SharedUtil.h>
 #include <ThreadHelpers.h>
 
 #include "GLBackend.h"
@@ -21,6 +22,10 @@
 #define MAX_RESOURCE_TEXTURES_PER_FRAME 2
 #define NO_BUFFER_WORK_SLEEP_TIME_MS 2
 #define THREADED_TEXTURE_BUFFERING 1
+// Uploads stop for the frame once they've taken this long, at least one is always done so that streaming progresses
+#define MAX_TRANSFER_TIME_PER_FRAME_USECS 2000
+// Textures that haven't been bound for drawing in this many frames aren't promoted, and are the first to be demoted
+#define TEXTURE_DEMAND_FRAMES 120
 #define MAX_AUTO_FRACTION_OF_TOTAL_MEMORY 0.8f
 #define AUTO_RESERVE_TEXTURE_MEMORY MB_TO_BYTES(64)
 
@@ -111,7 +116,8 @@ private:
     Mutex _bufferMutex;
     // The buffering thread which drains the _activeBufferQueue and populates the _activeTransferQueue
     TextureBufferThread* _transferThread{ nullptr };
-    // The amount of buffering work currently represented by the _activeBufferQueue
+    // The amount of buffered data that hasn't been uploaded yet, both the work represented by the _activeBufferQueue and
+    // the mips that have been read into memory and are waiting in the _activeTransferQueue
     std::atomic<size_t> _queuedBufferSize{ 0 };
     // This contains a map of all textures to queues of pending transfer jobs.  While in the transfer state, this map is used to
     // populate the _activeBufferQueue up to the limit specified in GLVariableAllocationTexture::MAX_BUFFER_SIZE
@@ -150,6 +156,14 @@ std::vector<TexturePointer> GLTextureTransferEngine::getAllTextures() {
     return result;
 }
 
+bool GLTextureTransferEngine::isInDemand(const GLTexture& texture) const {
+    if (texture._gpuObject.getImportant()) {
+        return true;
+    }
+    auto lastBoundFrame = texture.getLastBoundFrame();
+    return lastBoundFrame != 0 && (_frame - lastBoundFrame) <= TEXTURE_DEMAND_FRAMES;
+}
+
 void GLTextureTransferEngine::addMemoryManagedTexture(const TexturePointer& texturePointer) {
     ++_frameTexturesCreated;
     _registeredTextures.push_back(texturePointer);
@@ -170,6 +184,7 @@ void GLTextureTransferEngineDefault::manageMemory() {
     PROFILE_RANGE(render_gpu_gl, __FUNCTION__);
     // reset the count used to limit the number of textures created per frame
     resetFrameTextureCreated();
+    advanceFrame();
     // Determine the current memory management state.  It will be either idle (no work to do),
     // undersubscribed (need to do more allocation) or transfer (need to upload content from the
     // backing store to the GPU
@@ -228,7 +243,7 @@ void GLTextureTransferEngineDefault::updateMemoryPressure() {
         if (!gltexture->_gpuObject.getImportant() && vartexture->canDemote()) {
             canDemote |= true;
         }
-        if (vartexture->canPromote()) {
+        if (vartexture->canPromote() && isInDemand(*gltexture)) {
             canPromote |= true;
         }
         if (vartexture->hasPendingTransfers()) {
@@ -289,7 +304,8 @@ void GLTextureTransferEngineDefault::updateMemoryPressure() {
         for (const auto& texture : strongTextures) {
             GLTexture* gltexture = Backend::getGPUObject<GLTexture>(*texture);
             GLVariableAllocationSupport* vargltexture = dynamic_cast<GLVariableAllocationSupport*>(gltexture);
-            if (MemoryPressureState::Undersubscribed == _memoryPressureState && vargltexture->canPromote()) {
+            if (MemoryPressureState::Undersubscribed == _memoryPressureState && vargltexture->canPromote() &&
+                isInDemand(*gltexture)) {
                 // Promote smallest first
                 _promoteQueue.push({ texture, 1.0f / (float)gltexture->size() });
             } else if (MemoryPressureState::Transfer == _memoryPressureState && vargltexture->hasPendingTransfers()) {
@@ -331,6 +347,7 @@ void GLTextureTransferEngineDefault::processTransferQueues() {
             activeTransferQueue.swap(_activeTransferQueue);
         }
 
+        const quint64 transferStart = usecTimestampNow();
         while (!activeTransferQueue.empty()) {
             const auto& activeTransferJob = activeTransferQueue.front();
             const auto& texturePointer = activeTransferJob.first;
@@ -340,9 +357,24 @@ void GLTextureTransferEngineDefault::processTransferQueues() {
             if (tranferJob->sourceMip() < vargltexture->populatedMip()) {
                 tranferJob->transfer(texturePointer);
             }
+            if (tranferJob->bufferingRequired()) {
+                Q_ASSERT(_queuedBufferSize >= tranferJob->size());
+                _queuedBufferSize -= tranferJob->size();
+            }
             // The pop_front MUST be the last call since all of these varaibles in scope are
             // references that will be invalid after the pop
             activeTransferQueue.pop_front();
+
+            if (usecTimestampNow() - transferStart > MAX_TRANSFER_TIME_PER_FRAME_USECS) {
+                break;
+            }
+        }
+
+        // Anything that didn't fit in this frame's budget goes back ahead of what's been buffered since, so that the
+        // jobs of a texture are still done in order
+        if (!activeTransferQueue.empty()) {
+            Lock lock(_bufferMutex);
+            _activeTransferQueue.splice(_activeTransferQueue.begin(), activeTransferQueue);
         }
     }
 
@@ -433,10 +465,8 @@ bool GLTextureTransferEngineDefault::processActiveBufferQueue() {
         if (!transferJob->bufferingRequired()) {
             continue;
         }
-        const auto& transferSize = transferJob->size();
+        // The buffered data is released from _queuedBufferSize once it's been uploaded
         transferJob->buffer(texture);
-        Q_ASSERT(_queuedBufferSize >= transferSize);
-        _queuedBufferSize -= transferSize;
     }
 
     {
@@ -483,7 +513,7 @@ void GLTextureTransferEngineDefault::processPromotes() {
         auto originalSize = gltexture->size();
         vartexture->promote();
         auto allocationDelta = gltexture->size() - originalSize;
-        if (vartexture->canPromote()) {
+        if (vartexture->canPromote() && isInDemand(*gltexture)) {
             // Promote smallest first
             _promoteQueue.push({ texture, 1.0f / (float)gltexture->size() });
         }
@@ -504,13 +534,14 @@ void GLTextureTransferEngineDefault::processPromotes() {
 }
 
 void GLTextureTransferEngineDefault::processDemotes(size_t reliefRequired, const std::vector<TexturePointer>& strongTextures) {
-    // Demote largest first
+    // Demote the textures that aren't being drawn with first, then the ones that are.  Largest first within each.
     ImmediateWorkQueue demoteQueue;
     for (const auto& texture : strongTextures) {
         GLTexture* gltexture = Backend::getGPUObject<GLTexture>(*texture);
         GLVariableAllocationSupport* vargltexture = dynamic_cast<GLVariableAllocationSupport*>(gltexture);
         if (!gltexture->_gpuObject.getImportant() && vargltexture->canDemote()) {
-            demoteQueue.push({ texture, (float)gltexture->size() });
+            float size = (float)gltexture->size();
+            demoteQueue.push({ texture, isInDemand(*gltexture) ? -1.0f / size : size });
         }
     }
 
@@ -46,6 +46,7 @@ public:
         // call resetStages here rather than in ~GLBackend dtor because it will call releaseResourceBuffer
         // which is pure virtual from GLBackend's dtor.
         resetStages();
+        _transformRing.destroy();
     }
 
     static const std::string GL45_VERSION;
@@ -232,6 +233,35 @@ public:
 #endif
 
 protected:
+    // A persistently mapped buffer that the transform data of the batches is streamed into, rather than reallocating
+    // the transform buffers for every batch.  It's split in segments that are fenced once written, the CPU only waits
+    // on a segment when it comes back around to it while the GPU may still be reading from it.
+    class StreamRingBuffer {
+    public:
+        static const size_t NUM_SEGMENTS { 3 };
+
+        void create(size_t segmentSize);
+        void destroy();
+
+        GLuint getBuffer() const { return _buffer; }
+        uint8_t* getData() const { return _data; }
+
+        // the offset of size bytes to write at getData(), INVALID_OFFSET if it doesn't fit in a segment
+        size_t allocate(size_t size, size_t alignment);
+
+    private:
+        GLuint _buffer { 0 };
+        uint8_t* _data { nullptr };
+        size_t _segmentSize { 0 };
+        size_t _segment { 0 };
+        size_t _head { 0 };
+        GLsync _fences[NUM_SEGMENTS] { 0, 0, 0 };
+    };
+
+    mutable StreamRingBuffer _transformRing;
+    mutable GLuint _currentDrawCallInfoBuffer { 0 };
+    mutable GLintptr _currentDrawCallInfoOffset { 0 };
+    GLint _objectBufferAlignment { 1 };
 
     void draw(GLenum mode, uint32 numVertices, uint32 startVertex) override;
     void recycle() const override;
@@ -152,10 +152,12 @@ void GL45Backend::do_blit(const Batch& batch, size_t paramOffset) {
     // Assign dest framebuffer if not bound already
     auto destFbo = getFramebufferID(dstframebuffer);
     auto srcFbo = getFramebufferID(srcframebuffer);
+    // A depth only framebuffer blits its depth, which can't be filtered
+    bool isDepthOnly = srcframebuffer && !srcframebuffer->hasColor() && srcframebuffer->hasDepth();
     glBlitNamedFramebuffer(srcFbo, destFbo,
         srcvp.x, srcvp.y, srcvp.z, srcvp.w,
         dstvp.x, dstvp.y, dstvp.z, dstvp.w,
-        GL_COLOR_BUFFER_BIT, GL_LINEAR);
+        isDepthOnly ? GL_DEPTH_BUFFER_BIT : GL_COLOR_BUFFER_BIT, isDepthOnly ? GL_NEAREST : GL_LINEAR);
     (void) CHECK_GL_ERROR();
 }
 
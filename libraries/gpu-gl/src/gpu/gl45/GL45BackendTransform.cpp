@@ -13,6 +13,69 @@
 using namespace gpu;
 using namespace gpu::gl45;
 
+static const size_t TRANSFORM_RING_SEGMENT_SIZE { 8 * 1024 * 1024 };
+static const size_t DRAW_CALL_INFO_ALIGNMENT { 16 };
+
+void GL45Backend::StreamRingBuffer::create(size_t segmentSize) {
+    _segmentSize = segmentSize;
+    GLsizeiptr size = (GLsizeiptr)(_segmentSize * NUM_SEGMENTS);
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glCreateBuffers(1, &_buffer);
+    glNamedBufferStorage(_buffer, size, nullptr, flags);
+    _data = (uint8_t*)glMapNamedBufferRange(_buffer, 0, size, flags);
+    if (!_data) {
+        // everything goes through the transform buffers as it did before
+        qCWarning(gpugl45logging) << "Unable to map the transform stream buffer";
+        destroy();
+    }
+}
+
+void GL45Backend::StreamRingBuffer::destroy() {
+    for (auto& fence : _fences) {
+        if (fence) {
+            glDeleteSync(fence);
+            fence = 0;
+        }
+    }
+    if (_buffer) {
+        if (_data) {
+            glUnmapNamedBuffer(_buffer);
+            _data = nullptr;
+        }
+        glDeleteBuffers(1, &_buffer);
+        _buffer = 0;
+    }
+}
+
+size_t GL45Backend::StreamRingBuffer::allocate(size_t size, size_t alignment) {
+    if (!_data || size > _segmentSize) {
+        return INVALID_OFFSET;
+    }
+
+    size_t offset = ((_head + alignment - 1) / alignment) * alignment;
+    if (offset + size > (_segment + 1) * _segmentSize) {
+        // the GPU reads the segment that's left with the commands issued so far
+        _fences[_segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        _segment = (_segment + 1) % NUM_SEGMENTS;
+        auto& fence = _fences[_segment];
+        if (fence) {
+            const GLuint64 WAIT_TIMEOUT_NSECS = 1000 * 1000 * 1000;
+            GLenum result;
+            do {
+                result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, WAIT_TIMEOUT_NSECS);
+            } while (result == GL_TIMEOUT_EXPIRED);
+            glDeleteSync(fence);
+            fence = 0;
+        }
+        // the segments are a multiple of any alignment
+        offset = _segment * _segmentSize;
+    }
+
+    _head = offset + size;
+    return offset;
+}
+
 void GL45Backend::initTransform() {
     GLuint transformBuffers[3];
     glCreateBuffers(3, transformBuffers);
@@ -20,48 +83,105 @@ void GL45Backend::initTransform() {
     _transform._cameraBuffer = transformBuffers[1];
     _transform._drawCallInfoBuffer = transformBuffers[2];
 #ifdef GPU_SSBO_TRANSFORM_OBJECT
+    glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &_objectBufferAlignment);
 #else
     glCreateTextures(GL_TEXTURE_BUFFER, 1, &_transform._objectBufferTexture);
+    glGetIntegerv(GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT, &_objectBufferAlignment);
 #endif
     size_t cameraSize = sizeof(TransformStageState::CameraBufferElement);
     while (_transform._cameraUboSize < cameraSize) {
         _transform._cameraUboSize += UNIFORM_BUFFER_OFFSET_ALIGNMENT;
     }
+
+    _transformRing.create(TRANSFORM_RING_SEGMENT_SIZE);
 }
 
 void GL45Backend::transferTransformState(const Batch& batch) const {
+    // The data goes into the stream buffer when it fits, otherwise into the transform buffers that are reallocated for it
+
     // FIXME not thread safe
     static std::vector<uint8_t> bufferData;
     if (!_transform._cameras.empty()) {
-        bufferData.resize(_transform._cameraUboSize * _transform._cameras.size());
+        size_t size = _transform._cameraUboSize * _transform._cameras.size();
+        size_t offset = _transformRing.allocate(size, UNIFORM_BUFFER_OFFSET_ALIGNMENT);
+        uint8_t* data;
+        if (offset != INVALID_OFFSET) {
+            data = _transformRing.getData() + offset;
+            _transform._currentCameraBuffer = _transformRing.getBuffer();
+            _transform._currentCameraBufferOffset = offset;
+        } else {
+            bufferData.resize(size);
+            data = bufferData.data();
+            _transform._currentCameraBuffer = _transform._cameraBuffer;
+            _transform._currentCameraBufferOffset = 0;
+        }
         for (size_t i = 0; i < _transform._cameras.size(); ++i) {
-            memcpy(bufferData.data() + (_transform._cameraUboSize * i), &_transform._cameras[i], sizeof(TransformStageState::CameraBufferElement));
+            memcpy(data + (_transform._cameraUboSize * i), &_transform._cameras[i], sizeof(TransformStageState::CameraBufferElement));
+        }
+        if (offset == INVALID_OFFSET) {
+            glNamedBufferData(_transform._cameraBuffer, size, data, GL_STREAM_DRAW);
         }
-        glNamedBufferData(_transform._cameraBuffer, bufferData.size(), bufferData.data(), GL_STREAM_DRAW);
     }
 
+    GLuint objectBuffer = _transform._objectBuffer;
+    GLintptr objectOffset = 0;
+    GLsizeiptr objectSize = 0;
     if (!batch._objects.empty()) {
-        glNamedBufferData(_transform._objectBuffer, batch._objects.size() * sizeof(Batch::TransformObject), batch._objects.data(), GL_STREAM_DRAW);
+        objectSize = batch._objects.size() * sizeof(Batch::TransformObject);
+        size_t offset = _transformRing.allocate(objectSize, _objectBufferAlignment);
+        if (offset != INVALID_OFFSET) {
+            memcpy(_transformRing.getData() + offset, batch._objects.data(), objectSize);
+            objectBuffer = _transformRing.getBuffer();
+            objectOffset = offset;
+        } else {
+            glNamedBufferData(_transform._objectBuffer, objectSize, batch._objects.data(), GL_STREAM_DRAW);
+        }
     }
 
     if (!batch._namedData.empty()) {
-        bufferData.clear();
+        size_t size = 0;
+        for (auto& data : batch._namedData) {
+            size += data.second.drawCallInfos.size() * sizeof(Batch::DrawCallInfo);
+        }
+        size_t offset = _transformRing.allocate(size, DRAW_CALL_INFO_ALIGNMENT);
+        uint8_t* dest;
+        if (offset != INVALID_OFFSET) {
+            dest = _transformRing.getData() + offset;
+            _currentDrawCallInfoBuffer = _transformRing.getBuffer();
+            _currentDrawCallInfoOffset = offset;
+        } else {
+            bufferData.resize(size);
+            dest = bufferData.data();
+            _currentDrawCallInfoBuffer = _transform._drawCallInfoBuffer;
+            _currentDrawCallInfoOffset = 0;
+        }
+
+        size_t currentSize = 0;
         for (auto& data : batch._namedData) {
-            auto currentSize = bufferData.size();
             auto bytesToCopy = data.second.drawCallInfos.size() * sizeof(Batch::DrawCallInfo);
-            bufferData.resize(currentSize + bytesToCopy);
-            memcpy(bufferData.data() + currentSize, data.second.drawCallInfos.data(), bytesToCopy);
+            memcpy(dest + currentSize, data.second.drawCallInfos.data(), bytesToCopy);
             _transform._drawCallInfoOffsets[data.first] = (GLvoid*)currentSize;
+            currentSize += bytesToCopy;
+        }
+        if (offset == INVALID_OFFSET) {
+            glNamedBufferData(_transform._drawCallInfoBuffer, size, dest, GL_STREAM_DRAW);
         }
-        glNamedBufferData(_transform._drawCallInfoBuffer, bufferData.size(), bufferData.data(), GL_STREAM_DRAW);
     }
 
 #ifdef GPU_SSBO_TRANSFORM_OBJECT
-    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, slot::storage::ObjectTransforms, _transform._objectBuffer);
+    if (objectSize > 0) {
+        glBindBufferRange(GL_SHADER_STORAGE_BUFFER, slot::storage::ObjectTransforms, objectBuffer, objectOffset, objectSize);
+    } else {
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, slot::storage::ObjectTransforms, objectBuffer);
+    }
 #else
     glActiveTexture(GL_TEXTURE0 + slot::texture::ObjectTransforms);
     glBindTexture(GL_TEXTURE_BUFFER, _transform._objectBufferTexture);
-    glTextureBuffer(_transform._objectBufferTexture, GL_RGBA32F, _transform._objectBuffer);
+    if (objectSize > 0) {
+        glTextureBufferRange(_transform._objectBufferTexture, GL_RGBA32F, objectBuffer, objectOffset, objectSize);
+    } else {
+        glTextureBuffer(_transform._objectBufferTexture, GL_RGBA32F, objectBuffer);
+    }
 #endif
 
     CHECK_GL_ERROR();
@@ -97,7 +217,8 @@ void GL45Backend::updateTransform(const Batch& batch) {
         // NOTE: A stride of zero in BindVertexBuffer signifies that all elements are sourced from the same location,
         //       so we must provide a stride.
         //       This is in contrast to VertexAttrib*Pointer, where a zero signifies tightly-packed elements.
-        glBindVertexBuffer(gpu::Stream::DRAW_CALL_INFO, _transform._drawCallInfoBuffer, (GLintptr)_transform._drawCallInfoOffsets[batch._currentNamedCall], 2 * sizeof(GLushort));
+        glBindVertexBuffer(gpu::Stream::DRAW_CALL_INFO, _currentDrawCallInfoBuffer,
+                           _currentDrawCallInfoOffset + (GLintptr)_transform._drawCallInfoOffsets[batch._currentNamedCall], 2 * sizeof(GLushort));
     }
 
     (void)CHECK_GL_ERROR();
@@ -204,10 +204,11 @@ void GLESBackend::do_blit(const Batch& batch, size_t paramOffset) {
     // always bind the read fbo
     glBindFramebuffer(GL_READ_FRAMEBUFFER, getFramebufferID(srcframebuffer));
 
-    // Blit!
+    // Blit! A depth only framebuffer blits its depth, which can't be filtered
+    bool isDepthOnly = srcframebuffer && !srcframebuffer->hasColor() && srcframebuffer->hasDepth();
     glBlitFramebuffer(srcvp.x, srcvp.y, srcvp.z, srcvp.w, 
         dstvp.x, dstvp.y, dstvp.z, dstvp.w,
-        GL_COLOR_BUFFER_BIT, GL_LINEAR);
+        isDepthOnly ? GL_DEPTH_BUFFER_BIT : GL_COLOR_BUFFER_BIT, isDepthOnly ? GL_NEAREST : GL_LINEAR);
 
     // Always clean the read fbo to 0
     glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
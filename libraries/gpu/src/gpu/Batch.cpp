@@ -38,12 +38,12 @@ static const int MAX_NUM_UNIFORM_BUFFERS = 14;
 static const int MAX_NUM_RESOURCE_BUFFERS = 16;
 static const int MAX_NUM_RESOURCE_TEXTURES = 16;
 
-size_t Batch::_commandsMax{ BATCH_PREALLOCATE_MIN };
-size_t Batch::_commandOffsetsMax{ BATCH_PREALLOCATE_MIN };
-size_t Batch::_paramsMax{ BATCH_PREALLOCATE_MIN };
-size_t Batch::_dataMax{ BATCH_PREALLOCATE_MIN };
-size_t Batch::_objectsMax{ BATCH_PREALLOCATE_MIN };
-size_t Batch::_drawCallInfosMax{ BATCH_PREALLOCATE_MIN };
+std::atomic<size_t> Batch::_commandsMax{ BATCH_PREALLOCATE_MIN };
+std::atomic<size_t> Batch::_commandOffsetsMax{ BATCH_PREALLOCATE_MIN };
+std::atomic<size_t> Batch::_paramsMax{ BATCH_PREALLOCATE_MIN };
+std::atomic<size_t> Batch::_dataMax{ BATCH_PREALLOCATE_MIN };
+std::atomic<size_t> Batch::_objectsMax{ BATCH_PREALLOCATE_MIN };
+std::atomic<size_t> Batch::_drawCallInfosMax{ BATCH_PREALLOCATE_MIN };
 
 Batch::Batch(const std::string& name) {
     _name = name;
@@ -56,12 +56,12 @@ Batch::Batch(const std::string& name) {
 }
 
 Batch::~Batch() {
-    _commandsMax = std::max(_commands.size(), _commandsMax);
-    _commandOffsetsMax = std::max(_commandOffsets.size(), _commandOffsetsMax);
-    _paramsMax = std::max(_params.size(), _paramsMax);
-    _dataMax = std::max(_data.size(), _dataMax);
-    _objectsMax = std::max(_objects.size(), _objectsMax);
-    _drawCallInfosMax = std::max(_drawCallInfos.size(), _drawCallInfosMax);
+    updateMax(_commandsMax, _commands.size());
+    updateMax(_commandOffsetsMax, _commandOffsets.size());
+    updateMax(_paramsMax, _params.size());
+    updateMax(_dataMax, _data.size());
+    updateMax(_objectsMax, _objects.size());
+    updateMax(_drawCallInfosMax, _drawCallInfos.size());
 }
 
 void Batch::setName(const std::string& name) {
@@ -69,12 +69,12 @@ void Batch::setName(const std::string& name) {
 }
 
 void Batch::clear() {
-    _commandsMax = std::max(_commands.size(), _commandsMax);
-    _commandOffsetsMax = std::max(_commandOffsets.size(), _commandOffsetsMax);
-    _paramsMax = std::max(_params.size(), _paramsMax);
-    _dataMax = std::max(_data.size(), _dataMax);
-    _objectsMax = std::max(_objects.size(), _objectsMax);
-    _drawCallInfosMax = std::max(_drawCallInfos.size(), _drawCallInfosMax);
+    updateMax(_commandsMax, _commands.size());
+    updateMax(_commandOffsetsMax, _commandOffsets.size());
+    updateMax(_paramsMax, _params.size());
+    updateMax(_dataMax, _data.size());
+    updateMax(_objectsMax, _objects.size());
+    updateMax(_drawCallInfosMax, _drawCallInfos.size());
 
     _commands.clear();
     _commandOffsets.clear();
@@ -98,6 +98,7 @@ void Batch::clear() {
 
     _name.clear();
     _invalidModel = true;
+    resetCurrentInputState();
     _currentModel = Transform();
     _drawcallUniform = 0;
     _drawcallUniformReset = 0;
@@ -183,12 +184,28 @@ void Batch::multiDrawIndexedIndirect(uint32 nbCommands, Primitive primitiveType)
 }
 
 void Batch::setInputFormat(const Stream::FormatPointer& format) {
+    if (format && format == _currentInputFormat) {
+        return;
+    }
+    _currentInputFormat = format;
+
     ADD_COMMAND(setInputFormat);
 
     _params.emplace_back(_streamFormats.cache(format));
 }
 
 void Batch::setInputBuffer(Slot channel, const BufferPointer& buffer, Offset offset, Offset stride) {
+    if (channel >= _currentInputBuffers.size()) {
+        _currentInputBuffers.resize(channel + 1);
+    }
+    auto& current = _currentInputBuffers[channel];
+    if (buffer && buffer == current._buffer && offset == current._offset && stride == current._stride) {
+        return;
+    }
+    current._buffer = buffer;
+    current._offset = offset;
+    current._stride = stride;
+
     ADD_COMMAND(setInputBuffer);
 
     _params.emplace_back(stride);
@@ -213,6 +230,13 @@ void Batch::setInputStream(Slot startChannel, const BufferStream& stream) {
 }
 
 void Batch::setIndexBuffer(Type type, const BufferPointer& buffer, Offset offset) {
+    if (buffer && buffer == _currentIndexBuffer && offset == _currentIndexOffset && type == _currentIndexType) {
+        return;
+    }
+    _currentIndexBuffer = buffer;
+    _currentIndexOffset = offset;
+    _currentIndexType = type;
+
     ADD_COMMAND(setIndexBuffer);
 
     _params.emplace_back(offset);
@@ -454,6 +478,7 @@ void Batch::getQuery(const QueryPointer& query) {
 
 void Batch::resetStages() {
     ADD_COMMAND(resetStages);
+    resetCurrentInputState();
 }
 
 void Batch::disableContextViewCorrection() {
@@ -475,6 +500,7 @@ void Batch::restoreContextStereo() {
 void Batch::runLambda(std::function<void()> f) {
     ADD_COMMAND(runLambda);
     _params.emplace_back(_lambdas.cache(f));
+    resetCurrentInputState();
 }
 
 void Batch::startNamedCall(const std::string& name) {
@@ -482,12 +508,20 @@ void Batch::startNamedCall(const std::string& name) {
     _params.emplace_back(_names.cache(name));
 
     _currentNamedCall = name;
+    resetCurrentInputState();
 }
 
 void Batch::stopNamedCall() {
     ADD_COMMAND(stopNamedCall);
 
     _currentNamedCall.clear();
+    resetCurrentInputState();
+}
+
+void Batch::resetCurrentInputState() {
+    _currentInputFormat.reset();
+    _currentInputBuffers.clear();
+    _currentIndexBuffer.reset();
 }
 
 void Batch::enableStereo(bool enable) {
@@ -515,6 +549,25 @@ void Batch::setupNamedCalls(const std::string& instanceName, NamedBatchData::Fun
     captureNamedDrawCallInfo(instanceName);
 }
 
+void Batch::setupNamedCalls(const std::string& instanceName, size_t count, NamedBatchData::Function function) {
+    if (count == 0) {
+        return;
+    }
+    NamedBatchData& instance = _namedData[instanceName];
+    if (!instance.function) {
+        instance.function = function;
+    }
+
+    captureNamedDrawCallInfo(instanceName);
+    auto drawCallInfo = instance.drawCallInfos.back();
+    instance.drawCallInfos.insert(instance.drawCallInfos.end(), count - 1, drawCallInfo);
+}
+
+bool Batch::hasNamedCallsFunction(const std::string& instanceName) const {
+    auto it = _namedData.find(instanceName);
+    return it != _namedData.end() && it->second.function;
+}
+
 const BufferPointer& Batch::getNamedBuffer(const std::string& instanceName, uint8_t index) {
     NamedBatchData& instance = _namedData[instanceName];
     if (instance.buffers.size() <= index) {
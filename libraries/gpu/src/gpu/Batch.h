@@ -11,6 +11,7 @@
 #ifndef hifi_gpu_Batch_h
 #define hifi_gpu_Batch_h
 
+#include <atomic>
 #include <vector>
 #include <mutex>
 #include <functional>
@@ -79,7 +80,7 @@ public:
     using NamedBatchDataMap = std::map<std::string, NamedBatchData>;
 
     DrawCallInfoBuffer _drawCallInfos;
-    static size_t _drawCallInfosMax;
+    static std::atomic<size_t> _drawCallInfosMax;
 
     mutable std::string _currentNamedCall;
 
@@ -129,6 +130,10 @@ public:
     void multiDrawIndexedIndirect(uint32 numCommands, Primitive primitiveType);
 
     void setupNamedCalls(const std::string& instanceName, NamedBatchData::Function function);
+    // the same as count setupNamedCalls() in a row, count instances with the current model transform
+    void setupNamedCalls(const std::string& instanceName, size_t count, NamedBatchData::Function function);
+    // only the function of the first setupNamedCalls() of a name is kept, this skips making the others
+    bool hasNamedCallsFunction(const std::string& instanceName) const;
     const BufferPointer& getNamedBuffer(const std::string& instanceName, uint8_t index = 0);
 
     // Input Stage
@@ -141,6 +146,8 @@ public:
     void setInputBuffer(Slot channel, const BufferView& buffer); // not a command, just a shortcut from a BufferView
     void setInputStream(Slot startChannel, const BufferStream& stream); // not a command, just unroll into a loop of setInputBuffer
 
+    // Setting the input format, an input buffer or the index buffer to what the batch already set it to is skipped, so
+    // that drawing many parts of the same mesh one after the other doesn't record the same input state for every one.
     void setIndexBuffer(Type type, const BufferPointer& buffer, Offset offset);
     void setIndexBuffer(const BufferView& buffer); // not a command, just a shortcut from a BufferView
 
@@ -222,6 +229,7 @@ public:
     // Blit src framebuffer to destination
     // the srcRect and dstRect are the rect region in source and destination framebuffers expressed in pixel space
     // with xy and zw the bounding corners of the rect region.
+    // If src has a depth buffer and no color, its depth is copied instead, the depth formats must be the same.
     void blit(const FramebufferPointer& src, const Vec4i& srcRect, const FramebufferPointer& dst, const Vec4i& dstRect);
 
     // Generate the mips for a texture
@@ -401,13 +409,20 @@ public:
     // The template cache mechanism for the gpu::Object passed to the gpu::Batch
     // this allow us to have one cache container for each different types and eventually
     // be smarter how we manage them
+    //
+    // The sizes to preallocate are shared by all batches, which can be recorded and released on any thread
+    static void updateMax(std::atomic<size_t>& max, size_t size) {
+        size_t current = max.load();
+        while (size > current && !max.compare_exchange_weak(current, size)) {}
+    }
+
     template <typename T>
     class Cache {
     public:
         typedef T Data;
         Data _data;
         Cache<T>(const Data& data) : _data(data) {}
-        static size_t _max;
+        static std::atomic<size_t> _max;
 
         class Vector {
         public:
@@ -418,7 +433,7 @@ public:
             }
 
             ~Vector() {
-                _max = std::max(_items.size(), _max);
+                updateMax(_max, _items.size());
             }
 
 
@@ -484,16 +499,16 @@ public:
     }
 
     Commands _commands;
-    static size_t _commandsMax;
+    static std::atomic<size_t> _commandsMax;
 
     CommandOffsets _commandOffsets;
-    static size_t _commandOffsetsMax;
+    static std::atomic<size_t> _commandOffsetsMax;
 
     Params _params;
-    static size_t _paramsMax;
+    static std::atomic<size_t> _paramsMax;
 
     Bytes _data;
-    static size_t _dataMax;
+    static std::atomic<size_t> _dataMax;
 
     // SSBO class... layout MUST match the layout in Transform.slh
     class TransformObject {
@@ -506,7 +521,7 @@ public:
     bool _invalidModel { true };
     Transform _currentModel;
     TransformObjects _objects;
-    static size_t _objectsMax;
+    static std::atomic<size_t> _objectsMax;
 
     BufferCaches _buffers;
     TextureCaches _textures;
@@ -526,6 +541,18 @@ public:
     uint16_t _drawcallUniform{ 0 };
     uint16_t _drawcallUniformReset{ 0 };
 
+    // The input state that the commands recorded so far leave the backend in, null where it isn't known
+    struct InputBufferState {
+        BufferPointer _buffer;
+        Offset _offset { 0 };
+        Offset _stride { 0 };
+    };
+    Stream::FormatPointer _currentInputFormat;
+    std::vector<InputBufferState> _currentInputBuffers;
+    BufferPointer _currentIndexBuffer;
+    Offset _currentIndexOffset { 0 };
+    Type _currentIndexType { UINT32 };
+
     glm::vec2 _projectionJitter{ 0.0f, 0.0f };
     bool _enableStereo{ true };
     bool _enableSkybox { false };
@@ -550,11 +577,14 @@ protected:
 
 
 
+    // Forget the input state after a command that could change it on the backend
+    void resetCurrentInputState();
+
     void captureDrawCallInfoImpl();
 };
 
 template <typename T>
-size_t Batch::Cache<T>::_max = BATCH_PREALLOCATE_MIN;
+std::atomic<size_t> Batch::Cache<T>::_max { BATCH_PREALLOCATE_MIN };
 
 }
 
@@ -7,6 +7,9 @@
 //  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
 //
 #include "Buffer.h"
+
+#include <MemoryAccounting.h>
+
 #include "Context.h"
 
 using namespace gpu;
@@ -44,6 +47,7 @@ Buffer& Buffer::operator=(const Buffer& buf) {
 Buffer::~Buffer() {
     _bufferCPUCount.decrement();
     _bufferCPUMemSize.update(_sysmem.getSize(), 0);
+    MemoryAccounting::remove(MemoryAccounting::GPUSysmem, _sysmem.getSize());
 }
 
 Buffer::Size Buffer::resize(Size size) {
@@ -52,6 +56,7 @@ Buffer::Size Buffer::resize(Size size) {
     if (prevSize < size) {
         _sysmem.resize(_pages.accommodate(_end));
         _bufferCPUMemSize.update(prevSize, _sysmem.getSize());
+        MemoryAccounting::update(MemoryAccounting::GPUSysmem, prevSize, _sysmem.getSize());
     }
     return _end;
 }
@@ -191,6 +191,10 @@ void Context::downloadFramebuffer(const FramebufferPointer& srcFramebuffer, cons
     _backend->downloadFramebuffer(srcFramebuffer, region, destImage);
 }
 
+void Context::readFramebufferAsync(const FramebufferPointer& srcFramebuffer, const Vec4i& region, const FramebufferReadHandler& handler) {
+    _backend->readFramebufferAsync(srcFramebuffer, region, handler);
+}
+
 void Context::resetStats() const {
     _backend->resetStats();
 }
@@ -367,9 +371,10 @@ void Context::pushProgramsToSync(const std::vector<uint32_t>& programIDs, std::f
     pushProgramsToSync(programs, callback, rate);
 }
 
-void Context::pushProgramsToSync(const std::vector<gpu::ShaderPointer>& programs, std::function<void()> callback, size_t rate) {
+void Context::pushProgramsToSync(const std::vector<gpu::ShaderPointer>& programs, std::function<void()> callback, size_t rate,
+                                 bool retain) {
     Lock lock(_programsToSyncMutex);
-    _programsToSyncQueue.emplace(programs, callback, rate == 0 ? programs.size() : rate);
+    _programsToSyncQueue.emplace(programs, callback, rate == 0 ? programs.size() : rate, retain);
 }
 
 void Context::processProgramsToSync() {
@@ -380,7 +385,9 @@ void Context::processProgramsToSync() {
         while (_nextProgramToSyncIndex < programsToSync.programs.size() && numSynced < programsToSync.rate) {
             auto nextProgram = programsToSync.programs.at(_nextProgramToSyncIndex);
             _backend->syncProgram(nextProgram);
-            _syncedPrograms.push_back(nextProgram);
+            if (programsToSync.retain) {
+                _syncedPrograms.push_back(nextProgram);
+            }
             _nextProgramToSyncIndex++;
             numSynced++;
         }
@@ -52,6 +52,9 @@ public:
     void evalDelta(const ContextStats& begin, const ContextStats& end);
 };
 
+// Receives the texels of a framebuffer region read asynchronously, row by row from the bottom one
+using FramebufferReadHandler = std::function<void(const std::vector<float>& texels)>;
+
 class Backend {
 public:
     virtual ~Backend(){};
@@ -66,6 +69,7 @@ public:
     virtual void syncProgram(const gpu::ShaderPointer& program) = 0;
     virtual void recycle() const = 0;
     virtual void downloadFramebuffer(const FramebufferPointer& srcFramebuffer, const Vec4i& region, QImage& destImage) = 0;
+    virtual void readFramebufferAsync(const FramebufferPointer& srcFramebuffer, const Vec4i& region, const FramebufferReadHandler& handler) {}
     virtual void setCameraCorrection(const Mat4& correction, const Mat4& prevRenderView, bool reset = false) {}
 
     virtual bool supportedTextureFormat(const gpu::Element& format) = 0;
@@ -220,6 +224,11 @@ public:
     // It s here for convenience to easily capture a snapshot
     void downloadFramebuffer(const FramebufferPointer& srcFramebuffer, const Vec4i& region, QImage& destImage);
 
+    // Reading the first color buffer of a Framebuffer (a single float channel) asynchronously doesn't stall: the copy is
+    // queued with the commands executed so far, and the handler gets it from a later frame once the gpu is done with it.
+    // It has to be called from the render thread, in a Batch::runLambda
+    void readFramebufferAsync(const FramebufferPointer& srcFramebuffer, const Vec4i& region, const FramebufferReadHandler& handler);
+
     // Repporting stats of the context
     void resetStats() const;
     void getStats(ContextStats& stats) const;
@@ -257,16 +266,19 @@ public:
     static Size getTextureResourceIdealGPUMemSize();
 
     struct ProgramsToSync {
-        ProgramsToSync(const std::vector<gpu::ShaderPointer>& programs, std::function<void()> callback, size_t rate) :
-            programs(programs), callback(callback), rate(rate) {}
+        ProgramsToSync(const std::vector<gpu::ShaderPointer>& programs, std::function<void()> callback, size_t rate, bool retain) :
+            programs(programs), callback(callback), rate(rate), retain(retain) {}
 
         std::vector<gpu::ShaderPointer> programs;
         std::function<void()> callback;
         size_t rate;
+        bool retain;
     };
 
     void pushProgramsToSync(const std::vector<uint32_t>& programIDs, std::function<void()> callback, size_t rate = 0);
-    void pushProgramsToSync(const std::vector<gpu::ShaderPointer>& programs, std::function<void()> callback, size_t rate = 0);
+    // retain keeps the programs alive with the context, leave it off for programs whose owner releases them
+    void pushProgramsToSync(const std::vector<gpu::ShaderPointer>& programs, std::function<void()> callback, size_t rate = 0,
+                            bool retain = true);
 
     void processProgramsToSync();
 
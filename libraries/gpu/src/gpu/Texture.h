@@ -355,17 +355,33 @@ public:
 
         void reset() override { }
 
-        // Don't keep files open forever.  We close them at the beginning of each frame (GLBackend::recycle)
+        // Don't keep files open forever.  Called after each pass of the texture buffering thread, this closes the files
+        // that haven't been read from in the last few passes and the files of storages that are gone, along with the least
+        // recently used ones past MAX_OPEN_KTX_FILES.  The others stay mapped, so fetching one of their mips is a view
+        // into the mapping rather than an open and map of the file.
         static void releaseOpenKtxFiles();
 
+        static const size_t MAX_OPEN_KTX_FILES { 64 };
+        static const uint32_t KTX_FILE_IDLE_RELEASES { 16 };
+
     protected:
+        struct OpenKtxFile {
+            std::shared_ptr<storage::FileStorage> file;
+            std::shared_ptr<std::mutex> mutex;
+            std::shared_ptr<std::atomic<uint32_t>> lastUsed;
+        };
+
         std::shared_ptr<storage::FileStorage> maybeOpenFile() const;
+        void addOpenFile(const std::shared_ptr<storage::FileStorage>& file) const;
 
         mutable std::shared_ptr<std::mutex> _cacheFileMutex { std::make_shared<std::mutex>() };
         mutable std::weak_ptr<storage::FileStorage> _cacheFile;
+        // The release pass that the file was last used in, shared with its entry in _cachedKtxFiles
+        mutable std::shared_ptr<std::atomic<uint32_t>> _cacheFileLastUsed { std::make_shared<std::atomic<uint32_t>>(0) };
 
-        static std::vector<std::pair<std::shared_ptr<storage::FileStorage>, std::shared_ptr<std::mutex>>> _cachedKtxFiles;
+        static std::vector<OpenKtxFile> _cachedKtxFiles;
         static std::mutex _cachedKtxFilesMutex;
+        static std::atomic<uint32_t> _ktxFileReleases;
 
         storage::StoragePointer _storage;
         std::string _filename;
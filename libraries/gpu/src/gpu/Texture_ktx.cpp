@@ -12,6 +12,8 @@
 
 #include "Texture.h"
 
+#include <algorithm>
+
 #include <QtCore/QByteArray>
 #include <glm/gtc/type_ptr.hpp>
 
@@ -24,8 +26,9 @@ using namespace gpu;
 using PixelsPointer = Texture::PixelsPointer;
 using KtxStorage = Texture::KtxStorage;
 
-std::vector<std::pair<std::shared_ptr<storage::FileStorage>, std::shared_ptr<std::mutex>>> KtxStorage::_cachedKtxFiles;
+std::vector<KtxStorage::OpenKtxFile> KtxStorage::_cachedKtxFiles;
 std::mutex KtxStorage::_cachedKtxFilesMutex;
+std::atomic<uint32_t> KtxStorage::_ktxFileReleases { 0 };
 
 struct GPUKTXPayload {
     using Version = uint8;
@@ -195,7 +198,8 @@ KtxStorage::KtxStorage(const cache::FilePointer& cacheEntry) : KtxStorage(cacheE
 KtxStorage::KtxStorage(const std::string& filename) : _filename(filename) {
     {
         // We are doing a lot of work here just to get descriptor data
-        ktx::StoragePointer storage{ new storage::FileStorage(_filename.c_str()) };
+        auto file = std::make_shared<storage::FileStorage>(_filename.c_str());
+        ktx::StoragePointer storage { file };
         auto ktxPointer = ktx::KTX::create(storage);
         _ktxDescriptor.reset(new ktx::KTXDescriptor(ktxPointer->toDescriptor()));
         if (_ktxDescriptor->images.size() < _ktxDescriptor->header.numberOfMipmapLevels) {
@@ -210,6 +214,12 @@ KtxStorage::KtxStorage(const std::string& filename) : _filename(filename) {
             // Assume all mip levels are available
             _minMipLevelAvailable = 0;
         }
+
+        // The first mips are usually fetched soon after, keep the mapping rather than opening the file again for them
+        if (*file) {
+            _cacheFile = file;
+            addOpenFile(file);
+        }
     }
 
 
@@ -226,31 +236,56 @@ std::shared_ptr<storage::FileStorage> KtxStorage::maybeOpenFile() const {
     // Try to get the shared_ptr
     std::shared_ptr<storage::FileStorage> file = _cacheFile.lock();
     if (file) {
+        *_cacheFileLastUsed = _ktxFileReleases.load();
         return file;
     }
 
     // If the file isn't open, create it and save a weak_ptr to it
     file = std::make_shared<storage::FileStorage>(_filename.c_str());
     _cacheFile = file;
-
-    {
-        // Add the shared_ptr to the global list of open KTX files, to be released at the beginning of the next present thread frame
-        std::lock_guard<std::mutex> lock(_cachedKtxFilesMutex);
-        _cachedKtxFiles.emplace_back(file, _cacheFileMutex);
-    }
+    addOpenFile(file);
 
     return file;
 }
 
+void KtxStorage::addOpenFile(const std::shared_ptr<storage::FileStorage>& file) const {
+    *_cacheFileLastUsed = _ktxFileReleases.load();
+
+    // Add the shared_ptr to the global list of open KTX files, to be released once it's no longer in use
+    std::lock_guard<std::mutex> lock(_cachedKtxFilesMutex);
+    _cachedKtxFiles.push_back({ file, _cacheFileMutex, _cacheFileLastUsed });
+}
+
 void KtxStorage::releaseOpenKtxFiles() {
-    std::vector<std::pair<std::shared_ptr<storage::FileStorage>, std::shared_ptr<std::mutex>>> localKtxFiles;
+    std::vector<OpenKtxFile> localKtxFiles;
     {
         std::lock_guard<std::mutex> lock(_cachedKtxFilesMutex);
         localKtxFiles.swap(_cachedKtxFiles);
     }
-    for (auto& cacheFileAndMutex : localKtxFiles) {
-        std::lock_guard<std::mutex> lock(*(cacheFileAndMutex.second));
-        cacheFileAndMutex.first.reset();
+    const uint32_t release = ++_ktxFileReleases;
+
+    // Most recently used first
+    std::sort(localKtxFiles.begin(), localKtxFiles.end(), [](const OpenKtxFile& a, const OpenKtxFile& b) {
+        return a.lastUsed->load() > b.lastUsed->load();
+    });
+
+    std::vector<OpenKtxFile> keptKtxFiles;
+    for (auto& openFile : localKtxFiles) {
+        // If the entry holds the only reference to the last used stamp, the storage that opened the file is gone
+        bool isOwned = openFile.lastUsed.use_count() > 1;
+        bool isIdle = (release - openFile.lastUsed->load()) > KTX_FILE_IDLE_RELEASES;
+        if (isOwned && !isIdle && keptKtxFiles.size() < MAX_OPEN_KTX_FILES) {
+            keptKtxFiles.push_back(std::move(openFile));
+        } else {
+            std::lock_guard<std::mutex> lock(*(openFile.mutex));
+            openFile.file.reset();
+        }
+    }
+
+    if (!keptKtxFiles.empty()) {
+        std::lock_guard<std::mutex> lock(_cachedKtxFilesMutex);
+        _cachedKtxFiles.insert(_cachedKtxFiles.end(), std::make_move_iterator(keptKtxFiles.begin()),
+                               std::make_move_iterator(keptKtxFiles.end()));
     }
 }
 
@@ -117,6 +117,20 @@ public:
     const BufferView& getPartBuffer() const { return _partBuffer; }
     size_t getNumParts() const { return _partBuffer.getNumElements(); }
 
+    // Coarser versions of all the parts, which can be drawn instead when the mesh is far enough away that the difference
+    // doesn't show.  They use the same vertices, their indices follow the parts' in the index buffer's data, past the end
+    // of its view.
+    class PartLOD {
+    public:
+        float _error { 0.0f }; // size of the details that were lost, in mesh space
+        std::vector<Part> _parts; // one for each part of the mesh
+    };
+    using PartLODs = std::vector<PartLOD>;
+
+    // finest first
+    void setPartLODs(const PartLODs& partLODs) { _partLODs = partLODs; }
+    const PartLODs& getPartLODs() const { return _partLODs; }
+
     // evaluate the bounding box of A part
     Box evalPartBound(int partNum) const;
     // evaluate the bounding boxes of the parts in the range [start, end]
@@ -153,6 +167,7 @@ protected:
     BufferView _indexBuffer;
 
     BufferView _partBuffer;
+    PartLODs _partLODs;
 
     void evalVertexFormat();
     void evalVertexStream();
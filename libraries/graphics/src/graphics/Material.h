@@ -508,6 +508,9 @@ public:
         }
     }
 
+    // the layers, in no particular order but the same one for the same pushes
+    const std::vector<MaterialLayer>& getLayers() const { return c; }
+
     // Schema to access the attribute values of the material
     class Schema {
     public:
@@ -0,0 +1,491 @@
+//
+//  HFMModelStream.cpp
+//  libraries/hfm/src/hfm
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "HFMModelStream.h"
+
+#include <cstring>
+
+#include <QtCore/QBuffer>
+#include <QtCore/QDataStream>
+
+#include "ModelFormatLogging.h"
+
+using namespace hfm;
+
+const quint32 ModelStream::VERSION;
+
+static const char MAGIC[4] = { 'H', 'F', 'M', 'S' };
+
+// Plain values, and arrays of them, are written as raw bytes. Everything else is written field by field.
+
+template <typename T>
+static void put(QDataStream& out, const T& value) {
+    out.writeRawData(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+static void get(QDataStream& in, T& value) {
+    in.readRawData(reinterpret_cast<char*>(&value), sizeof(T));
+}
+
+static void put(QDataStream& out, const QString& value) { out << value; }
+static void get(QDataStream& in, QString& value) { in >> value; }
+static void put(QDataStream& out, const QByteArray& value) { out << value; }
+static void get(QDataStream& in, QByteArray& value) { in >> value; }
+
+// a corrupt count mustn't make the reader allocate more than the data could hold
+static bool getCount(QDataStream& in, quint32& count, qint64 minElementSize) {
+    get(in, count);
+    if (in.status() == QDataStream::Ok && (qint64)count * minElementSize > in.device()->bytesAvailable()) {
+        in.setStatus(QDataStream::ReadCorruptData);
+    }
+    return in.status() == QDataStream::Ok;
+}
+
+template <typename Array>
+static void putArray(QDataStream& out, const Array& values) {
+    put(out, (quint32)values.size());
+    out.writeRawData(reinterpret_cast<const char*>(values.data()), (int)(values.size() * sizeof(values[0])));
+}
+
+template <typename Array>
+static void getArray(QDataStream& in, Array& values) {
+    quint32 count = 0;
+    if (getCount(in, count, sizeof(values[0]))) {
+        values.resize(count);
+        in.readRawData(reinterpret_cast<char*>(values.data()), (int)(count * sizeof(values[0])));
+    }
+}
+
+// declared ahead of the list templates, which wouldn't otherwise find them
+static void put(QDataStream& out, const ShapeVertices& vertices);
+static void get(QDataStream& in, ShapeVertices& vertices);
+static void put(QDataStream& out, const Blendshape& blendshape);
+static void get(QDataStream& in, Blendshape& blendshape);
+static void put(QDataStream& out, const Joint& joint);
+static void get(QDataStream& in, Joint& joint);
+static void put(QDataStream& out, const Cluster& cluster);
+static void get(QDataStream& in, Cluster& cluster);
+static void put(QDataStream& out, const MeshPart& part);
+static void get(QDataStream& in, MeshPart& part);
+static void put(QDataStream& out, const Mesh& mesh);
+static void get(QDataStream& in, Mesh& mesh);
+static void put(QDataStream& out, const AnimationFrame& frame);
+static void get(QDataStream& in, AnimationFrame& frame);
+
+template <typename List>
+static void putList(QDataStream& out, const List& values) {
+    put(out, (quint32)values.size());
+    for (const auto& value : values) {
+        put(out, value);
+    }
+}
+
+template <typename List>
+static void getList(QDataStream& in, List& values) {
+    quint32 count = 0;
+    if (getCount(in, count, 1)) {
+        values.resize(count);
+        for (auto& value : values) {
+            get(in, value);
+        }
+    }
+}
+
+static void put(QDataStream& out, const Transform& transform) {
+    put(out, transform.getTranslation());
+    put(out, transform.getRotation());
+    put(out, transform.getScale());
+}
+
+static void get(QDataStream& in, Transform& transform) {
+    glm::vec3 translation;
+    glm::quat rotation;
+    glm::vec3 scale;
+    get(in, translation);
+    get(in, rotation);
+    get(in, scale);
+    transform = Transform(rotation, scale, translation);
+}
+
+static void put(QDataStream& out, const Extents& extents) {
+    put(out, extents.minimum);
+    put(out, extents.maximum);
+}
+
+static void get(QDataStream& in, Extents& extents) {
+    get(in, extents.minimum);
+    get(in, extents.maximum);
+}
+
+static void put(QDataStream& out, const ShapeVertices& vertices) { putArray(out, vertices); }
+static void get(QDataStream& in, ShapeVertices& vertices) { getArray(in, vertices); }
+
+static void put(QDataStream& out, const Blendshape& blendshape) {
+    putArray(out, blendshape.indices);
+    putArray(out, blendshape.vertices);
+    putArray(out, blendshape.normals);
+    putArray(out, blendshape.tangents);
+}
+
+static void get(QDataStream& in, Blendshape& blendshape) {
+    getArray(in, blendshape.indices);
+    getArray(in, blendshape.vertices);
+    getArray(in, blendshape.normals);
+    getArray(in, blendshape.tangents);
+}
+
+static void put(QDataStream& out, const Joint& joint) {
+    put(out, joint.shapeInfo.avgPoint);
+    putArray(out, joint.shapeInfo.dots);
+    putArray(out, joint.shapeInfo.points);
+    putArray(out, joint.shapeInfo.debugLines);
+    put(out, joint.parentIndex);
+    put(out, joint.distanceToParent);
+    put(out, joint.translation);
+    put(out, joint.preTransform);
+    put(out, joint.preRotation);
+    put(out, joint.rotation);
+    put(out, joint.postRotation);
+    put(out, joint.postTransform);
+    put(out, joint.transform);
+    put(out, joint.rotationMin);
+    put(out, joint.rotationMax);
+    put(out, joint.inverseDefaultRotation);
+    put(out, joint.inverseBindRotation);
+    put(out, joint.bindTransform);
+    put(out, joint.name);
+    put(out, joint.isSkeletonJoint);
+    put(out, joint.bindTransformFoundInCluster);
+    put(out, joint.hasGeometricOffset);
+    put(out, joint.geometricTranslation);
+    put(out, joint.geometricRotation);
+    put(out, joint.geometricScaling);
+}
+
+static void get(QDataStream& in, Joint& joint) {
+    get(in, joint.shapeInfo.avgPoint);
+    getArray(in, joint.shapeInfo.dots);
+    getArray(in, joint.shapeInfo.points);
+    getArray(in, joint.shapeInfo.debugLines);
+    get(in, joint.parentIndex);
+    get(in, joint.distanceToParent);
+    get(in, joint.translation);
+    get(in, joint.preTransform);
+    get(in, joint.preRotation);
+    get(in, joint.rotation);
+    get(in, joint.postRotation);
+    get(in, joint.postTransform);
+    get(in, joint.transform);
+    get(in, joint.rotationMin);
+    get(in, joint.rotationMax);
+    get(in, joint.inverseDefaultRotation);
+    get(in, joint.inverseBindRotation);
+    get(in, joint.bindTransform);
+    get(in, joint.name);
+    get(in, joint.isSkeletonJoint);
+    get(in, joint.bindTransformFoundInCluster);
+    get(in, joint.hasGeometricOffset);
+    get(in, joint.geometricTranslation);
+    get(in, joint.geometricRotation);
+    get(in, joint.geometricScaling);
+}
+
+static void put(QDataStream& out, const Cluster& cluster) {
+    put(out, cluster.jointIndex);
+    put(out, cluster.inverseBindMatrix);
+    put(out, cluster.inverseBindTransform);
+}
+
+static void get(QDataStream& in, Cluster& cluster) {
+    get(in, cluster.jointIndex);
+    get(in, cluster.inverseBindMatrix);
+    get(in, cluster.inverseBindTransform);
+}
+
+static void put(QDataStream& out, const Texture& texture) {
+    put(out, texture.id);
+    put(out, texture.name);
+    put(out, texture.filename);
+    put(out, texture.content);
+    put(out, texture.sourceChannel);
+    put(out, texture.transform);
+    put(out, texture.maxNumPixels);
+    put(out, texture.texcoordSet);
+    put(out, texture.texcoordSetName);
+    put(out, texture.isBumpmap);
+}
+
+static void get(QDataStream& in, Texture& texture) {
+    get(in, texture.id);
+    get(in, texture.name);
+    get(in, texture.filename);
+    get(in, texture.content);
+    get(in, texture.sourceChannel);
+    get(in, texture.transform);
+    get(in, texture.maxNumPixels);
+    get(in, texture.texcoordSet);
+    get(in, texture.texcoordSetName);
+    get(in, texture.isBumpmap);
+}
+
+static void put(QDataStream& out, const MeshPart& part) {
+    putArray(out, part.quadIndices);
+    putArray(out, part.quadTrianglesIndices);
+    putArray(out, part.triangleIndices);
+    put(out, part.materialID);
+}
+
+static void get(QDataStream& in, MeshPart& part) {
+    getArray(in, part.quadIndices);
+    getArray(in, part.quadTrianglesIndices);
+    getArray(in, part.triangleIndices);
+    get(in, part.materialID);
+}
+
+static void put(QDataStream& out, const Material& material) {
+    put(out, material.diffuseColor);
+    put(out, material.diffuseFactor);
+    put(out, material.specularColor);
+    put(out, material.specularFactor);
+    put(out, material.emissiveColor);
+    put(out, material.emissiveFactor);
+    put(out, material.shininess);
+    put(out, material.opacity);
+    put(out, material.metallic);
+    put(out, material.roughness);
+    put(out, material.emissiveIntensity);
+    put(out, material.ambientFactor);
+    put(out, material.bumpMultiplier);
+    put(out, material.alphaMode);
+    put(out, material.alphaCutoff);
+    put(out, material.materialID);
+    put(out, material.name);
+    put(out, material.shadingModel);
+    put(out, material.normalTexture);
+    put(out, material.albedoTexture);
+    put(out, material.opacityTexture);
+    put(out, material.glossTexture);
+    put(out, material.roughnessTexture);
+    put(out, material.specularTexture);
+    put(out, material.metallicTexture);
+    put(out, material.emissiveTexture);
+    put(out, material.occlusionTexture);
+    put(out, material.scatteringTexture);
+    put(out, material.lightmapTexture);
+    put(out, material.lightmapParams);
+    put(out, material.isPBSMaterial);
+    put(out, material.useNormalMap);
+    put(out, material.useAlbedoMap);
+    put(out, material.useOpacityMap);
+    put(out, material.useRoughnessMap);
+    put(out, material.useSpecularMap);
+    put(out, material.useMetallicMap);
+    put(out, material.useEmissiveMap);
+    put(out, material.useOcclusionMap);
+}
+
+static void get(QDataStream& in, Material& material) {
+    get(in, material.diffuseColor);
+    get(in, material.diffuseFactor);
+    get(in, material.specularColor);
+    get(in, material.specularFactor);
+    get(in, material.emissiveColor);
+    get(in, material.emissiveFactor);
+    get(in, material.shininess);
+    get(in, material.opacity);
+    get(in, material.metallic);
+    get(in, material.roughness);
+    get(in, material.emissiveIntensity);
+    get(in, material.ambientFactor);
+    get(in, material.bumpMultiplier);
+    get(in, material.alphaMode);
+    get(in, material.alphaCutoff);
+    get(in, material.materialID);
+    get(in, material.name);
+    get(in, material.shadingModel);
+    get(in, material.normalTexture);
+    get(in, material.albedoTexture);
+    get(in, material.opacityTexture);
+    get(in, material.glossTexture);
+    get(in, material.roughnessTexture);
+    get(in, material.specularTexture);
+    get(in, material.metallicTexture);
+    get(in, material.emissiveTexture);
+    get(in, material.occlusionTexture);
+    get(in, material.scatteringTexture);
+    get(in, material.lightmapTexture);
+    get(in, material.lightmapParams);
+    get(in, material.isPBSMaterial);
+    get(in, material.useNormalMap);
+    get(in, material.useAlbedoMap);
+    get(in, material.useOpacityMap);
+    get(in, material.useRoughnessMap);
+    get(in, material.useSpecularMap);
+    get(in, material.useMetallicMap);
+    get(in, material.useEmissiveMap);
+    get(in, material.useOcclusionMap);
+}
+
+static void put(QDataStream& out, const Mesh& mesh) {
+    putList(out, mesh.parts);
+    putArray(out, mesh.vertices);
+    putArray(out, mesh.normals);
+    putArray(out, mesh.tangents);
+    putArray(out, mesh.colors);
+    putArray(out, mesh.texCoords);
+    putArray(out, mesh.texCoords1);
+    putArray(out, mesh.clusterIndices);
+    putArray(out, mesh.clusterWeights);
+    putArray(out, mesh.originalIndices);
+    putList(out, mesh.clusters);
+    put(out, mesh.meshExtents);
+    put(out, mesh.modelTransform);
+    putList(out, mesh.blendshapes);
+    put(out, mesh.meshIndex);
+    put(out, mesh.wasCompressed);
+}
+
+static void get(QDataStream& in, Mesh& mesh) {
+    getList(in, mesh.parts);
+    getArray(in, mesh.vertices);
+    getArray(in, mesh.normals);
+    getArray(in, mesh.tangents);
+    getArray(in, mesh.colors);
+    getArray(in, mesh.texCoords);
+    getArray(in, mesh.texCoords1);
+    getArray(in, mesh.clusterIndices);
+    getArray(in, mesh.clusterWeights);
+    getArray(in, mesh.originalIndices);
+    getList(in, mesh.clusters);
+    get(in, mesh.meshExtents);
+    get(in, mesh.modelTransform);
+    getList(in, mesh.blendshapes);
+    get(in, mesh.meshIndex);
+    get(in, mesh.wasCompressed);
+}
+
+static void put(QDataStream& out, const AnimationFrame& frame) {
+    putArray(out, frame.rotations);
+    putArray(out, frame.translations);
+}
+
+static void get(QDataStream& in, AnimationFrame& frame) {
+    getArray(in, frame.rotations);
+    getArray(in, frame.translations);
+}
+
+QByteArray ModelStream::write(const Model& model) {
+    QByteArray data;
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::WriteOnly);
+    QDataStream out(&buffer);
+
+    out.writeRawData(MAGIC, sizeof(MAGIC));
+    put(out, VERSION);
+
+    put(out, model.originalURL);
+    put(out, model.author);
+    put(out, model.applicationName);
+    putList(out, model.joints);
+    out << model.jointIndices;
+    put(out, model.hasSkeletonJoints);
+    putList(out, model.meshes);
+    out << model.scripts;
+
+    put(out, (quint32)model.materials.size());
+    for (auto it = model.materials.cbegin(); it != model.materials.cend(); ++it) {
+        put(out, it.key());
+        put(out, it.value());
+    }
+
+    put(out, model.offset);
+    put(out, model.neckPivot);
+    put(out, model.bindExtents);
+    put(out, model.meshExtents);
+    putList(out, model.animationFrames);
+    out << model.meshIndicesToModelNames;
+    out << model.blendshapeChannelNames;
+
+    put(out, (quint32)model.jointRotationOffsets.size());
+    for (auto it = model.jointRotationOffsets.cbegin(); it != model.jointRotationOffsets.cend(); ++it) {
+        put(out, it.key());
+        put(out, it.value());
+    }
+
+    putList(out, model.shapeVertices);
+    out << model.flowData._physicsConfig << model.flowData._collisionsConfig;
+
+    return data;
+}
+
+Model::Pointer ModelStream::read(const QByteArray& data) {
+    QBuffer buffer;
+    buffer.setData(data);
+    buffer.open(QIODevice::ReadOnly);
+    QDataStream in(&buffer);
+
+    char magic[sizeof(MAGIC)];
+    quint32 version = 0;
+    if (in.readRawData(magic, sizeof(magic)) != sizeof(magic) || memcmp(magic, MAGIC, sizeof(magic)) != 0) {
+        return Model::Pointer();
+    }
+    get(in, version);
+    if (version != VERSION) {
+        return Model::Pointer();
+    }
+
+    auto model = std::make_shared<Model>();
+    get(in, model->originalURL);
+    get(in, model->author);
+    get(in, model->applicationName);
+    getList(in, model->joints);
+    in >> model->jointIndices;
+    get(in, model->hasSkeletonJoints);
+    getList(in, model->meshes);
+    in >> model->scripts;
+
+    quint32 numMaterials = 0;
+    if (getCount(in, numMaterials, 1)) {
+        for (quint32 i = 0; i < numMaterials && in.status() == QDataStream::Ok; ++i) {
+            QString materialID;
+            get(in, materialID);
+            get(in, model->materials[materialID]);
+        }
+    }
+
+    get(in, model->offset);
+    get(in, model->neckPivot);
+    get(in, model->bindExtents);
+    get(in, model->meshExtents);
+    getList(in, model->animationFrames);
+    in >> model->meshIndicesToModelNames;
+    in >> model->blendshapeChannelNames;
+
+    quint32 numJointRotationOffsets = 0;
+    if (getCount(in, numJointRotationOffsets, sizeof(int) + sizeof(glm::quat))) {
+        for (quint32 i = 0; i < numJointRotationOffsets; ++i) {
+            int jointIndex;
+            glm::quat offset;
+            get(in, jointIndex);
+            get(in, offset);
+            model->jointRotationOffsets.insert(jointIndex, offset);
+        }
+    }
+
+    getList(in, model->shapeVertices);
+    in >> model->flowData._physicsConfig >> model->flowData._collisionsConfig;
+
+    if (in.status() != QDataStream::Ok || !in.atEnd()) {
+        qCWarning(modelformat) << "Invalid streamed model" << model->originalURL;
+        return Model::Pointer();
+    }
+    return model;
+}
@@ -0,0 +1,38 @@
+//
+//  HFMModelStream.h
+//  libraries/hfm/src/hfm
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_HFMModelStream_h
+#define vircadia_HFMModelStream_h
+
+#include <QtCore/QByteArray>
+
+#include "HFM.h"
+
+namespace hfm {
+
+// A binary encoding of a model as a serializer outputs it, for caching parsed models locally.
+//
+// Everything but the graphics meshes and materials, which are built from the rest when the model is baked, is
+// written. Arrays of plain values are written as they are in memory, so the encoding is only meant to be read by the
+// machine that wrote it.
+class ModelStream {
+public:
+    // Whenever a change is made to the model or to how it's streamed, this value should be incremented.
+    static const quint32 VERSION = 1;
+
+    static QByteArray write(const Model& model);
+
+    // null if the data isn't a model of the current version
+    static Model::Pointer read(const QByteArray& data);
+};
+
+};
+
+#endif // vircadia_HFMModelStream_h
@@ -13,6 +13,8 @@
 
 #include <glm/gtc/packing.hpp>
 
+#include <mutex>
+
 #include <QtCore/QtGlobal>
 #include <QUrl>
 #include <QRgb>
@@ -23,6 +25,7 @@
 #include <Profile.h>
 #include <StatTracker.h>
 #include <GLMHelpers.h>
+#include <TBBHelpers.h>
 
 #include "TGAReader.h"
 #if !defined(Q_OS_ANDROID)
@@ -51,8 +54,47 @@ std::atomic<size_t> RECTIFIED_TEXTURE_COUNT{ 0 };
 static const auto& GPU_CUBEMAP_DEFAULT_FORMAT = gpu::Element::COLOR_SRGBA_32;
 static const auto& GPU_CUBEMAP_HDR_FORMAT = gpu::Element::COLOR_R11G11B10;
 
+// Limits the threads that compression runs on, null when it can use all of them
+static std::unique_ptr<tbb::task_arena> compressionArena;
+// The mips of the faces of a cube map are compressed concurrently, but a texture's storage can't be assigned concurrently
+static std::mutex assignCompressedMipMutex;
+
 namespace image {
 
+void setCompressionThreadCount(int count) {
+    if (count > 0) {
+        compressionArena.reset(new tbb::task_arena(count));
+    } else {
+        compressionArena.reset();
+    }
+}
+
+int getCompressionThreadCount() {
+    return compressionArena ? compressionArena->max_concurrency() : 0;
+}
+
+static void parallelForCompression(int count, const std::function<void(int)>& task) {
+    auto run = [&] {
+        tbb::parallel_for(0, count, [&](int i) {
+            task(i);
+        });
+    };
+    if (compressionArena) {
+        compressionArena->execute(run);
+    } else {
+        run();
+    }
+}
+
+static void assignCompressedMip(gpu::Texture* texture, int mipLevel, int face, size_t size, const gpu::Byte* data) {
+    std::lock_guard<std::mutex> lock(assignCompressedMipMutex);
+    if (face >= 0) {
+        texture->assignStoredMipFace(mipLevel, face, size, data);
+    } else {
+        texture->assignStoredMip(mipLevel, size, data);
+    }
+}
+
 uint rectifyDimension(const uint& dimension) {
     if (dimension == 0) {
         return 0;
@@ -440,11 +482,7 @@ struct OutputHandler : public nvtt::OutputHandler {
     }
 
     virtual void endImage() override {
-        if (_face >= 0) {
-            _texture->assignStoredMipFace(_miplevel, _face, _size, static_cast<const gpu::Byte*>(_data));
-        } else {
-            _texture->assignStoredMip(_miplevel, _size, static_cast<const gpu::Byte*>(_data));
-        }
+        assignCompressedMip(_texture, _miplevel, _face, _size, static_cast<const gpu::Byte*>(_data));
         free(_data);
         _data = nullptr;
     }
@@ -501,21 +539,20 @@ struct MyErrorHandler : public nvtt::ErrorHandler {
 };
 
 #if defined(NVTT_API)
-class SequentialTaskDispatcher : public nvtt::TaskDispatcher {
+// Runs the blocks of a mip that nvtt compresses across the compression threads
+class ParallelTaskDispatcher : public nvtt::TaskDispatcher {
 public:
-    SequentialTaskDispatcher(const std::atomic<bool>& abortProcessing = false) : _abortProcessing(abortProcessing) {
+    ParallelTaskDispatcher(const std::atomic<bool>& abortProcessing = false) : _abortProcessing(abortProcessing) {
     }
 
     const std::atomic<bool>& _abortProcessing;
 
     void dispatch(nvtt::Task* task, void* context, int count) override {
-        for (int i = 0; i < count; i++) {
+        parallelForCompression(count, [&](int i) {
             if (!_abortProcessing.load()) {
                 task(context, i);
-            } else {
-                break;
             }
-        }
+        });
     }
 };
 #endif
@@ -622,8 +659,7 @@ void convertImageToHDRTexture(gpu::Texture* texture, Image&& image, BackendTarge
     surface.setAlphaMode(nvtt::AlphaMode_None);
     surface.setWrapMode(nvtt::WrapMode_Mirror);
 
-    SequentialTaskDispatcher dispatcher(abortProcessing);
-    nvtt::Compressor compressor;
+    ParallelTaskDispatcher dispatcher(abortProcessing);
     context.setTaskDispatcher(&dispatcher);
 
     context.compress(surface, face, mipLevel++, compressionOptions, outputOptions);
@@ -759,8 +795,9 @@ void convertImageToLDRTexture(gpu::Texture* texture, Image&& image, BackendTarge
         MyErrorHandler errorHandler;
         outputOptions.setErrorHandler(&errorHandler);
 
-        SequentialTaskDispatcher dispatcher(abortProcessing);
+        ParallelTaskDispatcher dispatcher(abortProcessing);
         nvtt::Compressor context;
+        context.setTaskDispatcher(&dispatcher);
 
         context.compress(surface, face, mipLevel++, compressionOptions, outputOptions);
         if (buildMips) {
@@ -824,11 +861,8 @@ void convertImageToLDRTexture(gpu::Texture* texture, Image&& image, BackendTarge
 
         for (int i = 0; i < numMips; i++) {
             if (mipMaps[i].paucEncodingBits.get()) {
-                if (face >= 0) {
-                    texture->assignStoredMipFace(i+baseMipLevel, face, mipMaps[i].uiEncodingBitsBytes, static_cast<const gpu::Byte*>(mipMaps[i].paucEncodingBits.get()));
-                } else {
-                    texture->assignStoredMip(i + baseMipLevel, mipMaps[i].uiEncodingBitsBytes, static_cast<const gpu::Byte*>(mipMaps[i].paucEncodingBits.get()));
-                }
+                assignCompressedMip(texture, i + baseMipLevel, face, mipMaps[i].uiEncodingBitsBytes,
+                                    static_cast<const gpu::Byte*>(mipMaps[i].paucEncodingBits.get()));
             }
         }
 
@@ -1491,11 +1525,13 @@ void convolveForGGX(const std::vector<Image>& faces, gpu::Texture* texture, Back
         output.applyGamma(1.0f/2.2f);
     }
 
-    for (int face = 0; face < 6; face++) {
-        for (gpu::uint16 mipLevel = 0; mipLevel < output.getMipCount(); mipLevel++) {
-            convertToTexture(texture, output.getFaceImage(mipLevel, face), target, abortProcessing, face, mipLevel);
-        }
-    }
+    // Every mip of every face is compressed separately
+    const int mipCount = output.getMipCount();
+    parallelForCompression(6 * mipCount, [&](int index) {
+        int face = index / mipCount;
+        gpu::uint16 mipLevel = (gpu::uint16)(index % mipCount);
+        convertToTexture(texture, output.getFaceImage(mipLevel, face), target, abortProcessing, face, mipLevel);
+    });
 }
 
 gpu::TexturePointer TextureUsage::processCubeTextureColorFromImage(Image&& srcImage, const std::string& srcImageName,
@@ -1600,11 +1636,11 @@ gpu::TexturePointer TextureUsage::processCubeTextureColorFromImage(Image&& srcIm
             // Performs and convolution AND mip map generation
             convolveForGGX(faces, theTexture.get(), target, abortProcessing);
         } else {
-            // Create mip maps and compress to final format in one go
-            for (uint8 face = 0; face < faces.size(); ++face) {
+            // Create mip maps and compress to final format in one go, the faces concurrently
+            parallelForCompression((int)faces.size(), [&](int face) {
                 // Force building the mip maps right now on CPU if we are convolving for GGX later on
                 convertToTextureWithMips(theTexture.get(), std::move(faces[face]), target, abortProcessing, face);
-            }
+            });
         }
     }
 
@@ -126,6 +126,11 @@ std::pair<gpu::TexturePointer, glm::ivec2> processImage(std::shared_ptr<QIODevic
                                                         int maxNumPixels, TextureUsage::Type textureType,
                                                         bool compress, gpu::BackendTarget target, const std::atomic<bool>& abortProcessing = false);
 
+// The number of threads that texture compression can run on, 0 for as many as there are cores.  Not thread-safe, this
+// should be set before any textures are processed.
+void setCompressionThreadCount(int count);
+int getCompressionThreadCount();
+
 void convertToTextureWithMips(gpu::Texture* texture, Image&& image, gpu::BackendTarget target, const std::atomic<bool>& abortProcessing = false, int face = -1);
 void convertToTexture(gpu::Texture* texture, Image&& image, gpu::BackendTarget target, const std::atomic<bool>& abortProcessing = false, int face = -1, int mipLevel = 0);
 
@@ -276,25 +276,61 @@ std::pair<gpu::TexturePointer, glm::ivec2> TextureCache::getTextureByHash(const
     std::pair<gpu::TextureWeakPointer, glm::ivec2> weakPointer;
     {
         std::unique_lock<std::mutex> lock(_texturesByHashesMutex);
-        weakPointer = _texturesByHashes[hash];
+        auto itr = _texturesByHashes.find(hash);
+        if (itr != _texturesByHashes.end()) {
+            weakPointer = itr->second;
+        }
     }
     return { weakPointer.first.lock(), weakPointer.second };
 }
 
 std::pair<gpu::TexturePointer, glm::ivec2> TextureCache::cacheTextureByHash(const std::string& hash, const std::pair<gpu::TexturePointer, glm::ivec2>& textureAndSize) {
+    static const size_t MIN_TEXTURES_BY_HASHES_PRUNE_SIZE = 256;
     std::pair<gpu::TexturePointer, glm::ivec2> result;
     {
         std::unique_lock<std::mutex> lock(_texturesByHashesMutex);
         auto& value = _texturesByHashes[hash];
         result = { value.first.lock(), value.second };
         if (!result.first) {
-            _texturesByHashes[hash] = textureAndSize;
+            value = textureAndSize;
             result = textureAndSize;
         }
+
+        // Drop the hashes of the textures that have since been released, once there have been as many new ones again
+        if (_texturesByHashes.size() > _texturesByHashesPruneSize) {
+            for (auto itr = _texturesByHashes.begin(); itr != _texturesByHashes.end();) {
+                if (itr->second.first.expired()) {
+                    itr = _texturesByHashes.erase(itr);
+                } else {
+                    ++itr;
+                }
+            }
+            _texturesByHashesPruneSize = std::max(MIN_TEXTURES_BY_HASHES_PRUNE_SIZE, 2 * _texturesByHashes.size());
+        }
     }
     return result;
 }
 
+bool TextureCache::startProcessingHash(const std::string& hash) {
+    std::unique_lock<std::mutex> lock(_texturesByHashesMutex);
+    return _hashesInProcessing.insert(hash).second;
+}
+
+void TextureCache::finishProcessingHash(const std::string& hash) {
+    {
+        std::unique_lock<std::mutex> lock(_texturesByHashesMutex);
+        _hashesInProcessing.erase(hash);
+    }
+    _hashProcessedCondition.notify_all();
+}
+
+void TextureCache::waitForProcessedHash(const std::string& hash) {
+    std::unique_lock<std::mutex> lock(_texturesByHashesMutex);
+    _hashProcessedCondition.wait(lock, [&] {
+        return _hashesInProcessing.find(hash) == _hashesInProcessing.end();
+    });
+}
+
 gpu::TexturePointer getFallbackTextureForType(image::TextureUsage::Type type) {
     gpu::TexturePointer result;
     auto textureCache = DependencyManager::get<TextureCache>();
@@ -1237,10 +1273,22 @@ void ImageReader::read() {
 
     // Maybe load from cache
     auto textureCache = DependencyManager::get<TextureCache>();
+    bool isProcessingHash = false;
+    Finally finishProcessingHash([&] {
+        if (isProcessingHash) {
+            textureCache->finishProcessingHash(hash);
+        }
+    });
     if (textureCache) {
         // If we already have a live texture with the same hash, use it
         auto textureAndSize = textureCache->getTextureByHash(hash);
 
+        // If the same image is being processed for another url, wait for it rather than processing it again
+        while (!textureAndSize.first && !(isProcessingHash = textureCache->startProcessingHash(hash))) {
+            textureCache->waitForProcessedHash(hash);
+            textureAndSize = textureCache->getTextureByHash(hash);
+        }
+
         // If there is no live texture, check if there's an existing KTX file
         if (!textureAndSize.first) {
             auto ktxFile = textureCache->_ktxCache->getFile(hash);
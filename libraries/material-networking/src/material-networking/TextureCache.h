@@ -12,6 +12,9 @@
 #ifndef hifi_TextureCache_h
 #define hifi_TextureCache_h
 
+#include <condition_variable>
+#include <unordered_set>
+
 #include <gpu/Texture.h>
 
 #include <QImage>
@@ -192,6 +195,12 @@ public:
     std::pair<gpu::TexturePointer, glm::ivec2> getTextureByHash(const std::string& hash);
     std::pair<gpu::TexturePointer, glm::ivec2> cacheTextureByHash(const std::string& hash, const std::pair<gpu::TexturePointer, glm::ivec2>& textureAndSize);
 
+    // Claims the processing of the image with hash, so that the same image met under other urls is only decoded and
+    // compressed once.  Returns false if another reader has claimed it, whose result waitForProcessedHash waits for.
+    bool startProcessingHash(const std::string& hash);
+    void finishProcessingHash(const std::string& hash);
+    void waitForProcessedHash(const std::string& hash);
+
     NetworkTexturePointer getResourceTexture(const QUrl& resourceTextureUrl);
     const gpu::FramebufferPointer& getHmdPreviewFramebuffer(int width, int height);
     const gpu::FramebufferPointer& getSpectatorCameraFramebuffer();
@@ -235,6 +244,9 @@ private:
 
     // Map from image hashes to texture weak pointers
     std::unordered_map<std::string, std::pair<std::weak_ptr<gpu::Texture>, glm::ivec2>> _texturesByHashes;
+    size_t _texturesByHashesPruneSize { 0 };
+    std::unordered_set<std::string> _hashesInProcessing;
+    std::condition_variable _hashProcessedCondition;
     std::mutex _texturesByHashesMutex;
 
     gpu::TexturePointer _permutationNormalTexture;
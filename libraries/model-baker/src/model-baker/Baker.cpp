@@ -227,4 +227,13 @@ namespace baker {
     std::vector<std::vector<hifi::ByteArray>> Baker::getDracoMaterialLists() const {
         return _engine->getOutput().get<BakerEngineBuilder::Output>().get4();
     }
+
+    std::vector<std::pair<QString, double>> Baker::getStageTimes() const {
+        std::vector<std::pair<QString, double>> stageTimes;
+        auto jobConfigs = _engine->getConfiguration()->findChildren<JobConfig*>(QRegularExpression(".*"), Qt::FindDirectChildrenOnly);
+        for (const auto& jobConfig : jobConfigs) {
+            stageTimes.emplace_back(jobConfig->objectName(), jobConfig->getCPURunTime());
+        }
+        return stageTimes;
+    }
 };
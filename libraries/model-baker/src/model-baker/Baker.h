@@ -37,6 +37,9 @@ namespace baker {
         // This is a ByteArray and not a std::string because the character sequence can contain the null character (particularly for FBX materials)
         std::vector<std::vector<hifi::ByteArray>> getDracoMaterialLists() const;
 
+        // How long each stage took the last time run() was called in milliseconds, in the order they run
+        std::vector<std::pair<QString, double>> getStageTimes() const;
+
     protected:
         EnginePointer _engine;
     };
@@ -14,6 +14,7 @@
 #include <glm/gtc/packing.hpp>
 
 #include <LogHandler.h>
+#include <TBBHelpers.h>
 #include "ModelBakerLogging.h"
 #include "ModelMath.h"
 
@@ -27,6 +28,60 @@ glm::vec3 normalizeDirForPacking(const glm::vec3& dir) {
     return dir;
 }
 
+// Meshes with fewer triangles than this aren't worth simplifying
+static const int MIN_LOD_TRIANGLES = 1024;
+// The LODs are simplified by clustering the vertices on grids this many cells across the mesh's longest side
+static const int LOD_GRID_RESOLUTIONS[] = { 64, 32, 16 };
+// A LOD has to have at most this fraction of the triangles of the previous one, or there are no more
+static const float MAX_LOD_TRIANGLE_RATIO = 0.75f;
+
+// Appends the indices of coarser versions of the parts to the mesh's
+static graphics::Mesh::PartLODs buildPartLODs(const hfm::Mesh& hfmMesh, const std::vector<std::vector<int>>& indicesPerPart,
+                                              std::vector<int>& meshIndices) {
+    graphics::Mesh::PartLODs partLODs;
+
+    size_t previousNumIndices = meshIndices.size();
+    if ((int)previousNumIndices / 3 < MIN_LOD_TRIANGLES) {
+        return partLODs;
+    }
+
+    Extents extents;
+    for (const auto& vertex : hfmMesh.vertices) {
+        extents.addPoint(vertex);
+    }
+    glm::vec3 size = extents.maximum - extents.minimum;
+    float longestSide = glm::max(size.x, glm::max(size.y, size.z));
+    if (longestSide <= 0.0f) {
+        return partLODs;
+    }
+
+    std::vector<int> lodIndices;
+    for (int resolution : LOD_GRID_RESOLUTIONS) {
+        float cellSize = longestSide / resolution;
+        // the cells are shared by all the parts, so that the parts still meet where they did
+        auto vertexMap = baker::clusterVertices(hfmMesh.vertices, extents.minimum, cellSize);
+
+        graphics::Mesh::PartLOD partLOD;
+        partLOD._error = cellSize;
+        lodIndices.clear();
+        for (const auto& partIndices : indicesPerPart) {
+            size_t start = lodIndices.size();
+            baker::remapTriangles(partIndices, vertexMap, lodIndices);
+            baker::optimizeTrianglesForVertexCache(lodIndices.data() + start, (int)(lodIndices.size() - start), hfmMesh.vertices.size());
+            partLOD._parts.emplace_back((graphics::Mesh::Index)(meshIndices.size() + start),
+                                        (graphics::Mesh::Index)(lodIndices.size() - start), 0, graphics::Mesh::TRIANGLES);
+        }
+
+        if (lodIndices.size() > previousNumIndices * MAX_LOD_TRIANGLE_RATIO) {
+            break;
+        }
+        meshIndices.insert(meshIndices.end(), lodIndices.begin(), lodIndices.end());
+        partLODs.push_back(partLOD);
+        previousNumIndices = lodIndices.size();
+    }
+    return partLODs;
+}
+
 void buildGraphicsMesh(const hfm::Mesh& hfmMesh, graphics::MeshPointer& graphicsMeshPointer, const baker::MeshNormals& meshNormals, const baker::MeshTangents& meshTangentsIn) {
     auto graphicsMesh = std::make_shared<graphics::Mesh>();
 
@@ -319,41 +374,39 @@ void buildGraphicsMesh(const hfm::Mesh& hfmMesh, graphics::MeshPointer& graphics
         return;
     }
 
-    auto indexBuffer = std::make_shared<gpu::Buffer>();
-    indexBuffer->resize(totalIndices * sizeof(int));
-
-    int indexNum = 0;
-    int offset = 0;
+    std::vector<int> meshIndices;
+    meshIndices.reserve(totalIndices);
 
     std::vector< graphics::Mesh::Part > parts;
-    if (hfmMesh.parts.size() > 1) {
-        indexNum = 0;
-    }
+    std::vector< std::vector<int> > indicesPerPart;
     foreach(const HFMMeshPart& part, hfmMesh.parts) {
-        graphics::Mesh::Part modelPart(indexNum, 0, 0, graphics::Mesh::TRIANGLES);
-
-        if (part.quadTrianglesIndices.size()) {
-            indexBuffer->setSubData(offset,
-                part.quadTrianglesIndices.size() * sizeof(int),
-                (gpu::Byte*) part.quadTrianglesIndices.constData());
-            offset += part.quadTrianglesIndices.size() * sizeof(int);
-            indexNum += part.quadTrianglesIndices.size();
-            modelPart._numIndices += part.quadTrianglesIndices.size();
-        }
+        graphics::Mesh::Part modelPart((graphics::Mesh::Index)meshIndices.size(), 0, 0, graphics::Mesh::TRIANGLES);
+
+        // The quad and plain triangles of a part are drawn together, so they're ordered for the vertex cache together
+        std::vector<int> partIndices;
+        partIndices.insert(partIndices.end(), part.quadTrianglesIndices.begin(), part.quadTrianglesIndices.end());
+        partIndices.insert(partIndices.end(), part.triangleIndices.begin(), part.triangleIndices.end());
 
-        if (part.triangleIndices.size()) {
-            indexBuffer->setSubData(offset,
-                part.triangleIndices.size() * sizeof(int),
-                (gpu::Byte*) part.triangleIndices.constData());
-            offset += part.triangleIndices.size() * sizeof(int);
-            indexNum += part.triangleIndices.size();
-            modelPart._numIndices += part.triangleIndices.size();
+        if (!partIndices.empty()) {
+            if (!baker::optimizeTrianglesForVertexCache(partIndices.data(), (int)partIndices.size(), numVerts)) {
+                HIFI_FCDEBUG_ID(model_baker(), repeatMessageID, "BuildGraphicsMeshTask -- part has out of range indices");
+            }
+            meshIndices.insert(meshIndices.end(), partIndices.begin(), partIndices.end());
+            modelPart._numIndices += (graphics::Mesh::Index)partIndices.size();
         }
 
         parts.push_back(modelPart);
+        indicesPerPart.push_back(std::move(partIndices));
     }
 
-    gpu::BufferView indexBufferView(indexBuffer, gpu::Element(gpu::SCALAR, gpu::UINT32, gpu::XYZ));
+    // The LODs' indices are in the same buffer, past the end of the view of the parts' ones
+    size_t numPartIndices = meshIndices.size();
+    graphicsMesh->setPartLODs(buildPartLODs(hfmMesh, indicesPerPart, meshIndices));
+
+    auto indexBuffer = std::make_shared<gpu::Buffer>();
+    indexBuffer->setData(meshIndices.size() * sizeof(int), (const gpu::Byte*)meshIndices.data());
+
+    gpu::BufferView indexBufferView(indexBuffer, 0, numPartIndices * sizeof(int), gpu::Element(gpu::SCALAR, gpu::UINT32, gpu::XYZ));
     graphicsMesh->setIndexBuffer(indexBufferView);
 
     if (parts.size()) {
@@ -380,11 +433,12 @@ void BuildGraphicsMeshTask::run(const baker::BakeContextPointer& context, const
 
     auto& graphicsMeshes = output;
 
+    // The meshes are independent of each other, so they're built concurrently
     int n = (int)meshes.size();
-    for (int i = 0; i < n; i++) {
-        graphicsMeshes.emplace_back();
+    graphicsMeshes.resize(n);
+    tbb::parallel_for(0, n, [&](int i) {
         auto& graphicsMesh = graphicsMeshes[i];
-        
+
         // Try to create the graphics::Mesh
         buildGraphicsMesh(meshes[i], graphicsMesh, baker::safeGet(normalsPerMesh, i), baker::safeGet(tangentsPerMesh, i));
 
@@ -395,5 +449,5 @@ void BuildGraphicsMeshTask::run(const baker::BakeContextPointer& context, const
                 graphicsMesh->modelName = meshIndicesToModelNames[i].toStdString();
             }
         }
-    }
+    });
 }
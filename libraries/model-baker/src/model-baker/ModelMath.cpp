@@ -11,6 +11,10 @@
 
 #include "ModelMath.h"
 
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
 #include <LogHandler.h>
 #include "ModelBakerLogging.h"
 
@@ -117,5 +121,209 @@ namespace baker {
             }
         }
     }
-}
 
+    // Vertex cache sizes vary by GPU, the ordering doesn't suffer much for being optimized for a larger cache than the actual one
+    static const int VERTEX_CACHE_SIZE = 32;
+
+    static float vertexCacheScore(int cachePosition, int remainingTriangles) {
+        if (remainingTriangles == 0) {
+            return -1.0f;
+        }
+
+        float score = 0.0f;
+        if (cachePosition >= 0) {
+            if (cachePosition < 3) {
+                // The vertices of the triangle that was just added all get the same score, so that which of them was
+                // listed first doesn't matter
+                score = 0.75f;
+            } else {
+                const float scaler = 1.0f / (VERTEX_CACHE_SIZE - 3);
+                score = powf(1.0f - (float)(cachePosition - 3) * scaler, 1.5f);
+            }
+        }
+
+        // Favor the vertices with few triangles left, so that they're finished off rather than left to be transformed again
+        score += 2.0f * powf((float)remainingTriangles, -0.5f);
+        return score;
+    }
+
+    bool optimizeTrianglesForVertexCache(int* indices, int numIndices, int numVertices) {
+        const int numTriangles = numIndices / 3;
+        const int numTriangleIndices = numTriangles * 3;
+        for (int i = 0; i < numTriangleIndices; ++i) {
+            if (indices[i] < 0 || indices[i] >= numVertices) {
+                return false;
+            }
+        }
+        if (numTriangles < 2) {
+            return true;
+        }
+
+        // The triangles that use each vertex.  The ones that haven't been added yet are kept at the front of each vertex's
+        // range, remainingTriangles of them.
+        std::vector<int> vertexTrianglesStart(numVertices + 1, 0);
+        for (int i = 0; i < numTriangleIndices; ++i) {
+            ++vertexTrianglesStart[indices[i] + 1];
+        }
+        for (int v = 0; v < numVertices; ++v) {
+            vertexTrianglesStart[v + 1] += vertexTrianglesStart[v];
+        }
+        std::vector<int> vertexTriangles(numTriangleIndices);
+        std::vector<int> remainingTriangles(numVertices, 0);
+        for (int i = 0; i < numTriangleIndices; ++i) {
+            int vertex = indices[i];
+            vertexTriangles[vertexTrianglesStart[vertex] + remainingTriangles[vertex]++] = i / 3;
+        }
+
+        std::vector<int> cachePositions(numVertices, -1);
+        std::vector<float> vertexScores(numVertices);
+        for (int v = 0; v < numVertices; ++v) {
+            vertexScores[v] = vertexCacheScore(-1, remainingTriangles[v]);
+        }
+
+        std::vector<float> triangleScores(numTriangles);
+        std::vector<bool> isTriangleAdded(numTriangles, false);
+        int bestTriangle = 0;
+        for (int t = 0; t < numTriangles; ++t) {
+            const int* triangle = indices + 3 * t;
+            triangleScores[t] = vertexScores[triangle[0]] + vertexScores[triangle[1]] + vertexScores[triangle[2]];
+            if (triangleScores[t] > triangleScores[bestTriangle]) {
+                bestTriangle = t;
+            }
+        }
+
+        std::vector<int> optimizedIndices;
+        optimizedIndices.reserve(numTriangleIndices);
+        int cache[VERTEX_CACHE_SIZE + 3];
+        int cacheSize = 0;
+        int nextUnaddedTriangle = 0;
+
+        while (bestTriangle >= 0) {
+            const int* triangle = indices + 3 * bestTriangle;
+            isTriangleAdded[bestTriangle] = true;
+
+            int newCache[VERTEX_CACHE_SIZE + 3];
+            int newCacheSize = 0;
+            for (int k = 0; k < 3; ++k) {
+                int vertex = triangle[k];
+                optimizedIndices.push_back(vertex);
+
+                // Move the triangle out of the vertex's triangles that are still to be added
+                int* trianglesBegin = vertexTriangles.data() + vertexTrianglesStart[vertex];
+                int* trianglesEnd = trianglesBegin + remainingTriangles[vertex];
+                std::swap(*std::find(trianglesBegin, trianglesEnd, bestTriangle), *(trianglesEnd - 1));
+                --remainingTriangles[vertex];
+
+                // The same vertex can appear more than once in a degenerate triangle
+                if (std::find(newCache, newCache + newCacheSize, vertex) == newCache + newCacheSize) {
+                    newCache[newCacheSize++] = vertex;
+                }
+            }
+            // The triangle's vertices go to the front of the cache, and the rest move back
+            for (int i = 0; i < cacheSize; ++i) {
+                int vertex = cache[i];
+                if (vertex != triangle[0] && vertex != triangle[1] && vertex != triangle[2]) {
+                    newCache[newCacheSize++] = vertex;
+                }
+            }
+
+            // Rescore the vertices that are or were in the cache, and the triangles they're in
+            for (int i = 0; i < newCacheSize; ++i) {
+                int vertex = newCache[i];
+                cachePositions[vertex] = (i < VERTEX_CACHE_SIZE) ? i : -1;
+                float score = vertexCacheScore(cachePositions[vertex], remainingTriangles[vertex]);
+                float scoreDelta = score - vertexScores[vertex];
+                vertexScores[vertex] = score;
+
+                const int* trianglesBegin = vertexTriangles.data() + vertexTrianglesStart[vertex];
+                for (int j = 0; j < remainingTriangles[vertex]; ++j) {
+                    triangleScores[trianglesBegin[j]] += scoreDelta;
+                }
+            }
+
+            cacheSize = std::min(newCacheSize, VERTEX_CACHE_SIZE);
+            for (int i = 0; i < cacheSize; ++i) {
+                cache[i] = newCache[i];
+            }
+
+            // The next triangle is the best of the ones that use a vertex in the cache
+            bestTriangle = -1;
+            float bestScore = 0.0f;
+            for (int i = 0; i < cacheSize; ++i) {
+                int vertex = cache[i];
+                const int* trianglesBegin = vertexTriangles.data() + vertexTrianglesStart[vertex];
+                for (int j = 0; j < remainingTriangles[vertex]; ++j) {
+                    int t = trianglesBegin[j];
+                    if (bestTriangle < 0 || triangleScores[t] > bestScore) {
+                        bestTriangle = t;
+                        bestScore = triangleScores[t];
+                    }
+                }
+            }
+
+            // Or if none of them do, the next one that hasn't been added in the original order
+            if (bestTriangle < 0) {
+                while (nextUnaddedTriangle < numTriangles && isTriangleAdded[nextUnaddedTriangle]) {
+                    ++nextUnaddedTriangle;
+                }
+                if (nextUnaddedTriangle < numTriangles) {
+                    bestTriangle = nextUnaddedTriangle;
+                }
+            }
+        }
+
+        std::copy(optimizedIndices.begin(), optimizedIndices.end(), indices);
+        return true;
+    }
+
+    std::vector<int> clusterVertices(const QVector<glm::vec3>& positions, const glm::vec3& origin, float cellSize) {
+        const int numVertices = positions.size();
+        std::vector<int> vertexMap(numVertices);
+
+        // the cells are keyed by their coordinates, 21 bits each
+        const uint64_t CELL_COORD_MASK = (1 << 21) - 1;
+        std::unordered_map<uint64_t, int> representatives;
+        std::vector<uint64_t> cellKeys(numVertices);
+        std::vector<float> centreDistances(numVertices);
+        for (int i = 0; i < numVertices; ++i) {
+            glm::vec3 cellPosition = glm::max((positions[i] - origin) / cellSize, glm::vec3(0.0f));
+            glm::vec3 cell = glm::floor(cellPosition);
+            uint64_t key = ((uint64_t)cell.x & CELL_COORD_MASK) | (((uint64_t)cell.y & CELL_COORD_MASK) << 21) |
+                (((uint64_t)cell.z & CELL_COORD_MASK) << 42);
+            cellKeys[i] = key;
+            centreDistances[i] = glm::distance(cellPosition, cell + glm::vec3(0.5f));
+
+            auto inserted = representatives.emplace(key, i);
+            int& representative = inserted.first->second;
+            if (!inserted.second && centreDistances[i] < centreDistances[representative]) {
+                representative = i;
+            }
+        }
+
+        for (int i = 0; i < numVertices; ++i) {
+            vertexMap[i] = representatives[cellKeys[i]];
+        }
+        return vertexMap;
+    }
+
+    void remapTriangles(const std::vector<int>& indices, const std::vector<int>& vertexMap, std::vector<int>& remappedIndices) {
+        const int numVertices = (int)vertexMap.size();
+        const size_t numTriangleIndices = indices.size() - indices.size() % 3;
+        for (size_t i = 0; i < numTriangleIndices; i += 3) {
+            int a = indices[i];
+            int b = indices[i + 1];
+            int c = indices[i + 2];
+            if (a < 0 || a >= numVertices || b < 0 || b >= numVertices || c < 0 || c >= numVertices) {
+                continue;
+            }
+            a = vertexMap[a];
+            b = vertexMap[b];
+            c = vertexMap[c];
+            if (a != b && b != c && c != a) {
+                remappedIndices.push_back(a);
+                remappedIndices.push_back(b);
+                remappedIndices.push_back(c);
+            }
+        }
+    }
+}
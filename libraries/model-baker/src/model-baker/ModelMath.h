@@ -53,4 +53,18 @@ namespace baker {
     using IndexAccessor = std::function<glm::vec3*(int firstIndex, int secondIndex, glm::vec3* outVertices, glm::vec2* outTexCoords, glm::vec3& outNormal)>;
 
     void calculateTangents(const hfm::Mesh& mesh, IndexAccessor accessor);
+
+    // Reorders the triangles of a triangle list so that each one reuses as many vertices as possible that are still in the
+    // GPU's post-transform cache (Forsyth's linear-speed vertex cache optimisation).  The triangles themselves and their
+    // winding are unchanged.
+    // Return value: false, with the indices left alone, if any of them isn't a vertex of the mesh
+    bool optimizeTrianglesForVertexCache(int* indices, int numIndices, int numVertices);
+
+    // Maps each vertex to a representative of the cube of the grid it falls in, the one closest to the cube's centre, for
+    // simplifying a mesh by vertex clustering.  The grid starts at origin and its cubes are cellSize wide.
+    std::vector<int> clusterVertices(const QVector<glm::vec3>& positions, const glm::vec3& origin, float cellSize);
+
+    // Appends the triangles of a triangle list with their vertices remapped, leaving out the ones that collapse.
+    // Any trailing indices that don't form a triangle are dropped.
+    void remapTriangles(const std::vector<int>& indices, const std::vector<int>& vertexMap, std::vector<int>& remappedIndices);
 };
@@ -0,0 +1,31 @@
+//
+//  HFMCache.cpp
+//  libraries/model-networking/src/model-networking
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "HFMCache.h"
+
+#include <SettingHandle.h>
+#include <hfm/HFMModelStream.h>
+
+const int HFMCache::CURRENT_VERSION = (int)hfm::ModelStream::VERSION;
+const int HFMCache::INVALID_VERSION = 0x00;
+const char* HFMCache::SETTING_VERSION_NAME = "hifi.hfm.cache_version";
+
+HFMCache::HFMCache(const std::string& dir, const std::string& ext) :
+    FileCache(dir, ext) { }
+
+void HFMCache::initialize() {
+    FileCache::initialize();
+    Setting::Handle<int> cacheVersionHandle(SETTING_VERSION_NAME, INVALID_VERSION);
+    auto cacheVersion = cacheVersionHandle.get();
+    if (cacheVersion != CURRENT_VERSION) {
+        wipe();
+        cacheVersionHandle.set(CURRENT_VERSION);
+    }
+}
@@ -0,0 +1,32 @@
+//
+//  HFMCache.h
+//  libraries/model-networking/src/model-networking
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_HFMCache_h
+#define vircadia_HFMCache_h
+
+#include <shared/FileCache.h>
+
+// A disk cache of parsed models, keyed by a hash of the model's content and everything else it was parsed with, so
+// that models that were loaded before are neither downloaded nor parsed again.
+class HFMCache : public cache::FileCache {
+    Q_OBJECT
+
+public:
+    // The cache is wiped whenever this differs from the setting, which happens when the streamed model format changes
+    static const int CURRENT_VERSION;
+    static const int INVALID_VERSION;
+    static const char* SETTING_VERSION_NAME;
+
+    HFMCache(const std::string& dir, const std::string& ext);
+
+    void initialize() override;
+};
+
+#endif // vircadia_HFMCache_h
@@ -10,12 +10,19 @@
 //
 
 #include "ModelCache.h"
+
+#include <algorithm>
+
 #include <Finally.h>
 #include <FSTReader.h>
 
 #include <gpu/Batch.h>
 #include <gpu/Stream.h>
 
+#include <QCryptographicHash>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
 #include <QThreadPool>
 
 #include <Gzip.h>
@@ -23,6 +30,7 @@
 #include "ModelNetworkingLogging.h"
 #include <Trace.h>
 #include <StatTracker.h>
+#include <hfm/HFMModelStream.h>
 #include <hfm/ModelFormatRegistry.h>
 #include <FBXSerializer.h>
 #include <OBJSerializer.h>
@@ -40,6 +48,9 @@ public:
 
 int geometryMappingPairTypeId = qRegisterMetaType<GeometryMappingPair>("GeometryMappingPair");
 
+const std::string ModelCache::HFM_DIRNAME { "hfm_cache" };
+const std::string ModelCache::HFM_EXT { "hfm" };
+
 // From: https://stackoverflow.com/questions/41145012/how-to-hash-qvariant
 class QVariantHasher {
 public:
@@ -97,6 +108,9 @@ public:
     virtual void run() override;
 
 private:
+    std::string getCacheKey(const QMultiHash<QString, QVariant>& serializerMapping) const;
+    HFMModel::Pointer loadCachedModel(ModelCache& modelCache, const std::string& cacheKey) const;
+
     ModelLoader _modelLoader;
     QWeakPointer<Resource> _resource;
     QUrl _url;
@@ -106,6 +120,41 @@ private:
     QString _webMediaType;
 };
 
+std::string GeometryReader::getCacheKey(const QMultiHash<QString, QVariant>& serializerMapping) const {
+    QCryptographicHash hasher(QCryptographicHash::Md5);
+    hasher.addData(_data);
+    hasher.addData(_url.toEncoded());
+
+    // The order of a hash's entries differs between runs, so the mapping is added in the order of its keys, and its
+    // values (which can be hashes too) as JSON, whose objects are ordered.
+    auto keys = serializerMapping.uniqueKeys();
+    std::sort(keys.begin(), keys.end());
+    for (const auto& key : keys) {
+        hasher.addData(key.toUtf8());
+        for (const auto& value : serializerMapping.values(key)) {
+            hasher.addData(QJsonDocument(QJsonArray({ QJsonValue::fromVariant(value) })).toJson(QJsonDocument::Compact));
+        }
+    }
+    return hasher.result().toHex().toStdString();
+}
+
+HFMModel::Pointer GeometryReader::loadCachedModel(ModelCache& modelCache, const std::string& cacheKey) const {
+    auto file = modelCache._hfmCache->getFile(cacheKey);
+    if (!file) {
+        return HFMModel::Pointer();
+    }
+
+    QFile cachedFile(QString::fromStdString(file->getFilepath()));
+    HFMModel::Pointer hfmModel;
+    if (cachedFile.open(QIODevice::ReadOnly)) {
+        hfmModel = hfm::ModelStream::read(cachedFile.readAll());
+    }
+    if (!hfmModel) {
+        qCWarning(modelnetworking) << "Invalid cached model" << _url << "under hash" << cacheKey.c_str() << ", reloading...";
+    }
+    return hfmModel;
+}
+
 void GeometryReader::run() {
     DependencyManager::get<StatTracker>()->decrementStat("PendingProcessing");
     CounterStat counter("Processing");
@@ -144,18 +193,33 @@ void GeometryReader::run() {
         serializerMapping.replace("combineParts",_combineParts);
         serializerMapping.replace("deduplicateIndices", true);
 
-        if (_url.path().toLower().endsWith(".gz")) {
-            QByteArray uncompressedData;
-            if (!gunzip(_data, uncompressedData)) {
-                throw QString("failed to decompress .gz model");
-            }
-            // Strip the compression extension from the path, so the loader can infer the file type from what remains.
-            // This is okay because we don't expect the serializer to be able to read the contents of a compressed model file.
-            auto strippedUrl = _url;
+        bool isCompressed = _url.path().toLower().endsWith(".gz");
+        // Strip the compression extension from the path, so the loader can infer the file type from what remains.
+        // This is okay because we don't expect the serializer to be able to read the contents of a compressed model file.
+        auto strippedUrl = _url;
+        if (isCompressed) {
             strippedUrl.setPath(_url.path().left(_url.path().size() - 3));
-            hfmModel = _modelLoader.load(uncompressedData, serializerMapping, strippedUrl, "");
-        } else {
-            hfmModel = _modelLoader.load(_data, serializerMapping, _url, _webMediaType.toStdString());
+        }
+
+        // Only FBX files are cached, the other formats can refer to files at other URLs that may change independently
+        auto modelCache = DependencyManager::get<ModelCache>();
+        std::string cacheKey;
+        if (modelCache && strippedUrl.path().toLower().endsWith(".fbx")) {
+            cacheKey = getCacheKey(serializerMapping);
+            hfmModel = loadCachedModel(*modelCache, cacheKey);
+        }
+        bool wasCached = (bool)hfmModel;
+
+        if (!hfmModel) {
+            if (isCompressed) {
+                QByteArray uncompressedData;
+                if (!gunzip(_data, uncompressedData)) {
+                    throw QString("failed to decompress .gz model");
+                }
+                hfmModel = _modelLoader.load(uncompressedData, serializerMapping, strippedUrl, "");
+            } else {
+                hfmModel = _modelLoader.load(_data, serializerMapping, _url, _webMediaType.toStdString());
+            }
         }
 
         if (!hfmModel) {
@@ -166,6 +230,12 @@ void GeometryReader::run() {
             throw QString("empty geometry, possibly due to an unsupported model version");
         }
 
+        if (!wasCached && !cacheKey.empty()) {
+            // Written before the scripts are added, they come from the mapping. Replaces any invalid cached model.
+            auto data = hfm::ModelStream::write(*hfmModel);
+            modelCache->_hfmCache->writeFile(data.constData(), HFMCache::Metadata(cacheKey, data.size()), true);
+        }
+
         // Add scripts to hfmModel
         if (!serializerMapping.value(SCRIPT_FIELD).isNull()) {
             QVariantList scripts = serializerMapping.values(SCRIPT_FIELD);
@@ -370,6 +440,8 @@ ModelCache::ModelCache() {
     setUnusedResourceCacheSize(GEOMETRY_DEFAULT_UNUSED_MAX_SIZE);
     setObjectName("ModelCache");
 
+    _hfmCache->initialize();
+
     auto modelFormatRegistry = DependencyManager::get<ModelFormatRegistry>();
     modelFormatRegistry->addFormat(FBXSerializer());
     modelFormatRegistry->addFormat(OBJSerializer());
@@ -23,6 +23,7 @@
 #include <procedural/ProceduralMaterialCache.h>
 #include <material-networking/TextureCache.h>
 #include "ModelLoader.h"
+#include "HFMCache.h"
 
 class MeshPart;
 
@@ -177,9 +178,16 @@ protected:
     QSharedPointer<Resource> createResourceCopy(const QSharedPointer<Resource>& resource) override;
 
 private:
+    friend class GeometryReader;
+
     ModelCache();
     virtual ~ModelCache() = default;
+
+    static const std::string HFM_DIRNAME;
+    static const std::string HFM_EXT;
+
     ModelLoader _modelLoader;
+    std::shared_ptr<cache::FileCache> _hfmCache { std::make_shared<HFMCache>(HFM_DIRNAME, HFM_EXT) };
 };
 
 class MeshPart {
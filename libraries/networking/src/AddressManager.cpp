@@ -24,6 +24,7 @@
 #include <GLMHelpers.h>
 #include <NumericalConstants.h>
 #include <SettingHandle.h>
+#include <SharedUtil.h>
 #include <UUID.h>
 
 #include "NodeList.h"
@@ -450,6 +451,14 @@ void AddressManager::handleLookupString(const QString& lookupString, bool fromSu
 
 const QString DATA_OBJECT_DOMAIN_KEY = "domain";
 
+const char OVERRIDE_PATH_KEY[] = "override_path";
+const char LOOKUP_TRIGGER_KEY[] = "lookup_trigger";
+const char LOOKUP_PLACE_NAME_KEY[] = "place_name";
+
+// a place's domain rarely moves, and if it has the failed connection's refresh goes back to the API
+const quint64 PLACE_LOOKUP_CACHE_AGE = 10 * 60 * USECS_PER_SECOND;
+const int MAX_CACHED_PLACE_LOOKUPS = 64;
+
 
 void AddressManager::handleAPIResponse(QNetworkReply* requestReply) {
     QJsonObject responseObject = QJsonDocument::fromJson(requestReply->readAll()).object();
@@ -458,19 +467,20 @@ void AddressManager::handleAPIResponse(QNetworkReply* requestReply) {
     // Lookup succeeded, don't keep re-trying it (especially on server restarts)
     _previousAPILookup.clear();
 
+    QString overridePath = requestReply->property(OVERRIDE_PATH_KEY).toString();
+    LookupTrigger trigger = (LookupTrigger) requestReply->property(LOOKUP_TRIGGER_KEY).toInt();
+
     if (!dataObject.isEmpty()) {
-        goToAddressFromObject(dataObject.toVariantMap(), requestReply);
+        cachePlaceLookup(requestReply->property(LOOKUP_PLACE_NAME_KEY).toString(), dataObject.toVariantMap());
+        goToAddressFromObject(dataObject.toVariantMap(), overridePath, trigger);
     } else if (responseObject.contains(DATA_OBJECT_DOMAIN_KEY)) {
-        goToAddressFromObject(responseObject.toVariantMap(), requestReply);
+        goToAddressFromObject(responseObject.toVariantMap(), overridePath, trigger);
     }
 
     emit lookupResultsFinished();
 }
 
-const char OVERRIDE_PATH_KEY[] = "override_path";
-const char LOOKUP_TRIGGER_KEY[] = "lookup_trigger";
-
-void AddressManager::goToAddressFromObject(const QVariantMap& dataObject, const QNetworkReply* reply) {
+void AddressManager::goToAddressFromObject(const QVariantMap& dataObject, const QString& overridePath, LookupTrigger trigger) {
 
     const QString DATA_OBJECT_PLACE_KEY = "place";
     const QString DATA_OBJECT_USER_LOCATION_KEY = "location";
@@ -535,9 +545,6 @@ void AddressManager::goToAddressFromObject(const QVariantMap& dataObject, const
                     emit possibleDomainChangeRequiredViaICEForID(iceServerAddress, domainID);
                 }
 
-                LookupTrigger trigger = (LookupTrigger) reply->property(LOOKUP_TRIGGER_KEY).toInt();
-
-
                 // set our current root place id to the ID that came back
                 const QString PLACE_ID_KEY = "id";
                 _rootPlaceID = rootMap[PLACE_ID_KEY].toUuid();
@@ -569,8 +576,6 @@ void AddressManager::goToAddressFromObject(const QVariantMap& dataObject, const
                 }
 
                 // check if we had a path to override the path returned
-                QString overridePath = reply->property(OVERRIDE_PATH_KEY).toString();
-
                 if (!overridePath.isEmpty() && overridePath != "/") {
                     // make sure we don't re-handle an overriden path if this was a refresh of info from API
                     if (trigger != LookupTrigger::AttemptedRefresh) {
@@ -631,8 +636,16 @@ void AddressManager::handleAPIError(QNetworkReply* errorReply) {
 }
 
 void AddressManager::attemptPlaceNameLookup(const QString& lookupString, const QString& overridePath, LookupTrigger trigger) {
+    // a refresh is asked for because connecting failed, so it mustn't use what we have cached
+    if (trigger == LookupTrigger::AttemptedRefresh) {
+        _placeLookupCache.remove(lookupString.toLower());
+    } else if (goToCachedPlace(lookupString, overridePath, trigger)) {
+        return;
+    }
+
     // assume this is a place name and see if we can get any info on it
     QVariantMap requestParams;
+    requestParams.insert(LOOKUP_PLACE_NAME_KEY, lookupString);
 
     // if the user asked for a specific path with this lookup then keep it with the request so we can use it later
     if (!overridePath.isEmpty()) {
@@ -649,6 +662,99 @@ void AddressManager::attemptPlaceNameLookup(const QString& lookupString, const Q
                                               QByteArray(), NULL, requestParams);
 }
 
+bool AddressManager::goToCachedPlace(const QString& placeName, const QString& overridePath, LookupTrigger trigger) {
+    auto cached = _placeLookupCache.find(placeName.toLower());
+    if (cached == _placeLookupCache.end()) {
+        return false;
+    }
+    if (usecTimestampNow() - cached->fetchedAt > PLACE_LOOKUP_CACHE_AGE) {
+        _placeLookupCache.erase(cached);
+        return false;
+    }
+
+    qCDebug(networking) << "Using the cached lookup for place" << placeName;
+    QVariantMap dataObject = cached->dataObject;
+    goToAddressFromObject(dataObject, overridePath, trigger);
+    emit lookupResultsFinished();
+    return true;
+}
+
+void AddressManager::cachePlaceLookup(const QString& placeName, const QVariantMap& dataObject) {
+    if (placeName.isEmpty()) {
+        return;
+    }
+    if (_placeLookupCache.size() >= MAX_CACHED_PLACE_LOOKUPS) {
+        auto oldest = _placeLookupCache.begin();
+        for (auto itr = _placeLookupCache.begin(); itr != _placeLookupCache.end(); ++itr) {
+            if (itr->fetchedAt < oldest->fetchedAt) {
+                oldest = itr;
+            }
+        }
+        _placeLookupCache.erase(oldest);
+    }
+    _placeLookupCache[placeName.toLower()] = { dataObject, usecTimestampNow() };
+}
+
+void AddressManager::prefetchPlace(const QString& address) {
+    if (QThread::currentThread() != thread()) {
+        QMetaObject::invokeMethod(this, "prefetchPlace", Q_ARG(const QString&, address));
+        return;
+    }
+
+    QString placeName = address.trimmed();
+    for (const auto& prefix : { URL_SCHEME_VIRCADIA + "://", URL_SCHEME_VIRCADIA + ":/", URL_SCHEME_VIRCADIA + ":" }) {
+        if (placeName.startsWith(prefix, Qt::CaseInsensitive)) {
+            placeName = placeName.mid(prefix.length());
+            break;
+        }
+    }
+    int index = placeName.indexOf('/');
+    if (index != -1) {
+        placeName = placeName.left(index);
+    }
+
+    // network addresses, users, paths and domain IDs don't need a place lookup
+    if (placeName.isEmpty() || placeName.contains('.') || placeName.contains(':') || placeName.startsWith('@') ||
+            !QUuid(placeName).isNull()) {
+        return;
+    }
+
+    QString placeKey = placeName.toLower();
+    auto cached = _placeLookupCache.find(placeKey);
+    if ((cached != _placeLookupCache.end() && usecTimestampNow() - cached->fetchedAt < PLACE_LOOKUP_CACHE_AGE / 2) ||
+            _pendingPlacePrefetches.contains(placeKey)) {
+        return;
+    }
+    _pendingPlacePrefetches.insert(placeKey);
+
+    JSONCallbackParameters callbackParams;
+    callbackParams.callbackReceiver = this;
+    callbackParams.jsonCallbackMethod = "handlePlacePrefetchResponse";
+    callbackParams.errorCallbackMethod = "handlePlacePrefetchError";
+
+    QVariantMap requestParams;
+    requestParams.insert(LOOKUP_PLACE_NAME_KEY, placeName);
+
+    DependencyManager::get<AccountManager>()->sendRequest(GET_PLACE.arg(placeName),
+                                                          AccountManagerAuth::None,
+                                                          QNetworkAccessManager::GetOperation,
+                                                          callbackParams, QByteArray(), NULL, requestParams);
+}
+
+void AddressManager::handlePlacePrefetchResponse(QNetworkReply* requestReply) {
+    QString placeName = requestReply->property(LOOKUP_PLACE_NAME_KEY).toString();
+    _pendingPlacePrefetches.remove(placeName.toLower());
+
+    QJsonObject dataObject = QJsonDocument::fromJson(requestReply->readAll()).object()["data"].toObject();
+    if (!dataObject.isEmpty()) {
+        cachePlaceLookup(placeName, dataObject.toVariantMap());
+    }
+}
+
+void AddressManager::handlePlacePrefetchError(QNetworkReply* errorReply) {
+    _pendingPlacePrefetches.remove(errorReply->property(LOOKUP_PLACE_NAME_KEY).toString().toLower());
+}
+
 const QString GET_DOMAIN_ID = "/api/v1/domains/%1";
 
 void AddressManager::attemptDomainIDLookup(const QString& lookupString, const QString& overridePath, LookupTrigger trigger) {
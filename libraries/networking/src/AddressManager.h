@@ -13,7 +13,9 @@
 #ifndef hifi_AddressManager_h
 #define hifi_AddressManager_h
 
+#include <QtCore/QHash>
 #include <QtCore/QObject>
+#include <QtCore/QSet>
 #include <QtCore/QStack>
 
 #include <glm/glm.hpp>
@@ -258,6 +260,16 @@ public slots:
      */
     void handleLookupString(const QString& lookupString, bool fromSuggestions = false);
 
+    /*@jsdoc
+     * Looks up a place name on the metaverse API ahead of going there, so that a later visit within a few minutes can
+     * connect without waiting for the lookup. For example, call it for the places that the portals near you lead to.
+     * Addresses that aren't place names are ignored.
+     * @function location.prefetchPlace
+     * @param {string} address - The address that may be visited: a place name, optionally with a <code>"hifi://"</code>
+     *     scheme and a path.
+     */
+    void prefetchPlace(const QString& address);
+
     /*@jsdoc
      * Takes you to a position and orientation resulting from a lookup for a named path in the domain (set in the domain
      * server's settings).
@@ -503,8 +515,13 @@ private slots:
 
     void handleShareableNameAPIResponse(QNetworkReply* requestReply);
 
+    void handlePlacePrefetchResponse(QNetworkReply* requestReply);
+    void handlePlacePrefetchError(QNetworkReply* errorReply);
+
 private:
-    void goToAddressFromObject(const QVariantMap& addressMap, const QNetworkReply* reply);
+    void goToAddressFromObject(const QVariantMap& addressMap, const QString& overridePath, LookupTrigger trigger);
+    bool goToCachedPlace(const QString& placeName, const QString& overridePath, LookupTrigger trigger);
+    void cachePlaceLookup(const QString& placeName, const QVariantMap& dataObject);
 
     // Set host and port, and return `true` if it was changed.
     bool setHost(const QString& host, LookupTrigger trigger, quint16 port = 0);
@@ -544,6 +561,14 @@ private:
     QString _newHostLookupPath;
 
     QUrl _previousAPILookup;
+
+    // the API responses for recently looked up or prefetched place names, keyed by lower case place name
+    struct CachedPlaceLookup {
+        QVariantMap dataObject;
+        quint64 fetchedAt;
+    };
+    QHash<QString, CachedPlaceLookup> _placeLookupCache;
+    QSet<QString> _pendingPlacePrefetches;
 };
 
 #endif  // hifi_AddressManager_h
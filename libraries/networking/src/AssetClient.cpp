@@ -55,6 +55,31 @@ AssetClient::AssetClient() {
     connect(nodeList.data(), &LimitedNodeList::nodeKilled, this, &AssetClient::handleNodeKilled);
     connect(nodeList.data(), &LimitedNodeList::clientConnectionToNodeReset,
             this, &AssetClient::handleNodeClientConnectionReset);
+
+    if (DependencyManager::isSet<NodeList>()) {
+        auto& domainHandler = DependencyManager::get<NodeList>()->getDomainHandler();
+        connect(&domainHandler, &DomainHandler::settingsReceived, this, &AssetClient::handleDomainSettings);
+        connect(&domainHandler, &DomainHandler::disconnectedFromDomain, this, &AssetClient::clearMirrorURL);
+    }
+}
+
+void AssetClient::handleDomainSettings(const QJsonObject& domainSettings) {
+    static const QString ASSET_SERVER_SETTINGS_KEY = "asset_server";
+    static const QString MIRROR_URL_KEY = "mirror_url";
+
+    QUrl mirrorURL { domainSettings[ASSET_SERVER_SETTINGS_KEY].toObject()[MIRROR_URL_KEY].toString() };
+    if (mirrorURL.isValid() && (mirrorURL.scheme() == "http" || mirrorURL.scheme() == "https")) {
+        if (mirrorURL != _mirrorURL) {
+            qCDebug(asset_client) << "Getting assets from the mirror at" << mirrorURL;
+        }
+        _mirrorURL = mirrorURL;
+    } else {
+        clearMirrorURL();
+    }
+}
+
+void AssetClient::clearMirrorURL() {
+    _mirrorURL = QUrl();
 }
 
 void AssetClient::initCaching() {
@@ -701,7 +726,8 @@ MessageID AssetClient::getAssetMapping(const AssetUtils::AssetPath& path, Mappin
     return INVALID_MESSAGE_ID;
 }
 
-MessageID AssetClient::getAllAssetMappings(MappingOperationCallback callback) {
+MessageID AssetClient::getAllAssetMappings(const AssetUtils::AssetPath& startAfter, uint32_t maxMappings,
+                                           MappingOperationCallback callback) {
     Q_ASSERT(QThread::currentThread() == thread());
 
     auto nodeList = DependencyManager::get<LimitedNodeList>();
@@ -715,6 +741,10 @@ MessageID AssetClient::getAllAssetMappings(MappingOperationCallback callback) {
 
         packetList->writePrimitive(AssetUtils::AssetMappingOperationType::GetAll);
 
+        // the mappings come back a page at a time, starting after the last one of the previous page
+        packetList->writeString(startAfter);
+        packetList->writePrimitive(maxMappings);
+
         if (nodeList->sendPacketList(std::move(packetList), *assetServer) != -1) {
             _pendingMappingRequests[assetServer][messageID] = callback;
 
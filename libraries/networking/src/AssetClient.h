@@ -15,7 +15,9 @@
 #include <QStandardItemModel>
 #include <QtQml/QJSEngine>
 #include <QString>
+#include <QtCore/QJsonObject>
 #include <QtCore/QSharedPointer>
+#include <QtCore/QUrl>
 
 #include <map>
 
@@ -64,6 +66,10 @@ public:
     Q_INVOKABLE AssetUpload* createUpload(const QString& filename);
     Q_INVOKABLE AssetUpload* createUpload(const QByteArray& data);
 
+    /// The HTTP(S) mirror the domain serves its assets from, if it has one. Asset hashes are appended to it.
+    /// Only to be used from the AssetClient's thread.
+    QUrl getMirrorURL() const { return _mirrorURL; }
+
 public slots:
     void initCaching();
 
@@ -75,6 +81,9 @@ public slots:
     void clearCache();
 
 private slots:
+    void handleDomainSettings(const QJsonObject& domainSettings);
+    void clearMirrorURL();
+
     void handleAssetMappingOperationReply(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
     void handleAssetGetInfoReply(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
     void handleAssetGetReply(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
@@ -85,7 +94,7 @@ private slots:
 
 private:
     MessageID getAssetMapping(const AssetUtils::AssetHash& hash, MappingOperationCallback callback);
-    MessageID getAllAssetMappings(MappingOperationCallback callback);
+    MessageID getAllAssetMappings(const AssetUtils::AssetPath& startAfter, uint32_t maxMappings, MappingOperationCallback callback);
     MessageID setAssetMapping(const QString& path, const AssetUtils::AssetHash& hash, MappingOperationCallback callback);
     MessageID deleteAssetMappings(const AssetUtils::AssetPathList& paths, MappingOperationCallback callback);
     MessageID renameAssetMapping(const AssetUtils::AssetPath& oldPath, const AssetUtils::AssetPath& newPath, MappingOperationCallback callback);
@@ -120,6 +129,8 @@ private:
 
     QString _cacheDir;
 
+    QUrl _mirrorURL;
+
     friend class AssetRequest;
     friend class AssetUpload;
     friend class MappingRequest;
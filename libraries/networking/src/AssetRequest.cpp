@@ -14,11 +14,13 @@
 #include <algorithm>
 
 #include <QtCore/QThread>
+#include <QtNetwork/QNetworkReply>
 
 #include <StatTracker.h>
 #include <Trace.h>
 
 #include "AssetClient.h"
+#include "NetworkAccessManager.h"
 #include "NetworkLogging.h"
 #include "NodeList.h"
 #include "ResourceCache.h"
@@ -38,6 +40,11 @@ AssetRequest::~AssetRequest() {
     if (_assetRequestID) {
         assetClient->cancelGetAssetRequest(_assetRequestID);
     }
+    for (auto& reply : _mirrorReplies) {
+        if (reply) {
+            reply->abort();
+        }
+    }
 }
 
 void AssetRequest::start() {
@@ -75,6 +82,153 @@ void AssetRequest::start() {
 
     _state = WaitingForData;
 
+    // the domain can have assets served from an HTTP mirror, a CDN say, rather than from the asset server
+    auto mirrorURL = DependencyManager::get<AssetClient>()->getMirrorURL();
+    if (mirrorURL.isValid()) {
+        requestFromMirror(mirrorURL);
+    } else {
+        requestFromAssetServer();
+    }
+}
+
+// assets bigger than this are got from the mirror as several ranges at once
+static const qint64 MIN_MIRROR_RANGE_SIZE = 4 * 1024 * 1024;
+static const int MAX_MIRROR_RANGES = 4;
+
+void AssetRequest::requestFromMirror(const QUrl& mirrorURL) {
+    QUrl assetURL = mirrorURL;
+    assetURL.setPath(mirrorURL.path() + (mirrorURL.path().endsWith('/') ? "" : "/") + _hash);
+
+    auto& networkAccessManager = NetworkAccessManager::getInstance();
+    QNetworkRequest request(assetURL);
+    request.setAttribute(QNetworkRequest::FollowRedirectsAttribute, true);
+
+    if (_byteRange.isSet()) {
+        // a range of the asset can't be checked against its hash, but it can still come from the mirror
+        QString range = _byteRange.fromInclusive < 0
+            ? QString("bytes=%1").arg(_byteRange.fromInclusive)
+            : QString("bytes=%1-%2").arg(_byteRange.fromInclusive).arg(_byteRange.toExclusive - 1);
+        request.setRawHeader("Range", range.toUtf8());
+        _mirrorRanges.resize(1);
+        _numPendingMirrorRanges = 1;
+
+        QNetworkReply* reply = networkAccessManager.get(request);
+        _mirrorReplies.push_back(reply);
+        connect(reply, &QNetworkReply::finished, this, [this, reply] {
+            reply->deleteLater();
+            int status = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+            if (reply->error() != QNetworkReply::NoError || status != 206) {
+                qCDebug(asset_client) << "Failed to get a range of" << _hash << "from the mirror:" << reply->errorString();
+                requestFromAssetServer();
+                return;
+            }
+            handleMirrorData(reply->readAll());
+        });
+        return;
+    }
+
+    // find out how big the asset is first, so that big ones can be got in parallel ranges
+    QNetworkReply* reply = networkAccessManager.head(request);
+    _mirrorReplies.push_back(reply);
+    connect(reply, &QNetworkReply::finished, this, [this, reply, assetURL] {
+        reply->deleteLater();
+        if (reply->error() != QNetworkReply::NoError) {
+            qCDebug(asset_client) << "Couldn't find" << _hash << "on the mirror:" << reply->errorString();
+            requestFromAssetServer();
+            return;
+        }
+
+        qint64 size = reply->header(QNetworkRequest::ContentLengthHeader).toLongLong();
+        bool acceptsRanges = reply->rawHeader("Accept-Ranges").toLower() == "bytes";
+        int numRanges = 1;
+        if (acceptsRanges && size > MIN_MIRROR_RANGE_SIZE) {
+            numRanges = (int)std::min<qint64>(MAX_MIRROR_RANGES, (size + MIN_MIRROR_RANGE_SIZE - 1) / MIN_MIRROR_RANGE_SIZE);
+        }
+        requestMirrorRanges(assetURL, size, numRanges);
+    });
+}
+
+void AssetRequest::requestMirrorRanges(const QUrl& assetURL, qint64 size, int numRanges) {
+    auto& networkAccessManager = NetworkAccessManager::getInstance();
+    _mirrorRanges.assign(numRanges, QByteArray());
+    _numPendingMirrorRanges = numRanges;
+
+    qint64 rangeSize = (size + numRanges - 1) / numRanges;
+    for (int i = 0; i < numRanges; ++i) {
+        QNetworkRequest request(assetURL);
+        request.setAttribute(QNetworkRequest::FollowRedirectsAttribute, true);
+        if (numRanges > 1) {
+            qint64 from = i * rangeSize;
+            qint64 to = std::min(from + rangeSize, size) - 1;
+            request.setRawHeader("Range", QString("bytes=%1-%2").arg(from).arg(to).toUtf8());
+        }
+
+        QNetworkReply* reply = networkAccessManager.get(request);
+        _mirrorReplies.push_back(reply);
+        connect(reply, &QNetworkReply::finished, this, [this, reply, i, numRanges, size] {
+            reply->deleteLater();
+            if (_state != WaitingForData || _numPendingMirrorRanges == 0) {
+                // another range failed, and the asset server was asked instead
+                return;
+            }
+
+            int status = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+            if (reply->error() != QNetworkReply::NoError || (numRanges > 1 && status != 206)) {
+                qCDebug(asset_client) << "Failed to get" << _hash << "from the mirror:" << reply->errorString();
+                _numPendingMirrorRanges = 0;
+                for (auto& otherReply : _mirrorReplies) {
+                    if (otherReply && otherReply != reply) {
+                        otherReply->abort();
+                    }
+                }
+                requestFromAssetServer();
+                return;
+            }
+
+            _mirrorRanges[i] = reply->readAll();
+            _totalReceived += _mirrorRanges[i].size();
+            emit progress(_totalReceived, size);
+
+            if (--_numPendingMirrorRanges == 0) {
+                QByteArray data;
+                data.reserve(size);
+                for (const auto& range : _mirrorRanges) {
+                    data.append(range);
+                }
+                _mirrorRanges.clear();
+                handleMirrorData(data);
+            }
+        });
+    }
+}
+
+void AssetRequest::handleMirrorData(const QByteArray& data) {
+    _mirrorReplies.clear();
+
+    // the mirror isn't trusted any more than the asset server is, what's served has to match its hash
+    if (!_byteRange.isSet() && AssetUtils::hashData(data).toHex() != _hash) {
+        qCWarning(asset_client) << "Asset" << _hash << "from the mirror doesn't match its hash";
+        _totalReceived = 0;
+        requestFromAssetServer();
+        return;
+    }
+
+    _data = data;
+    _totalReceived = data.size();
+    emit progress(_totalReceived, data.size());
+
+    if (!_byteRange.isSet()) {
+        AssetUtils::saveToCache(getUrl(), data);
+    }
+
+    _state = Finished;
+    emit finished(this);
+}
+
+void AssetRequest::requestFromAssetServer() {
+    _mirrorReplies.clear();
+    _totalReceived = 0;
+
     auto assetClient = DependencyManager::get<AssetClient>();
     auto that = QPointer<AssetRequest>(this); // Used to track the request's lifetime
     auto hash = _hash;
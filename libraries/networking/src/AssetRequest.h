@@ -12,15 +12,21 @@
 #ifndef hifi_AssetRequest_h
 #define hifi_AssetRequest_h
 
+#include <vector>
+
 #include <QByteArray>
 #include <QObject>
+#include <QPointer>
 #include <QString>
+#include <QUrl>
 
 #include "AssetClient.h"
 #include "AssetUtils.h"
 
 #include "ByteRange.h"
 
+class QNetworkReply;
+
 const QString ATP_SCHEME { "atp:" };
 
 class AssetRequest : public QObject {
@@ -62,6 +68,11 @@ signals:
     void progress(qint64 totalReceived, qint64 total);
 
 private:
+    void requestFromMirror(const QUrl& mirrorURL);
+    void requestMirrorRanges(const QUrl& assetURL, qint64 size, int numRanges);
+    void handleMirrorData(const QByteArray& data);
+    void requestFromAssetServer();
+
     int _requestID;
     State _state = NotStarted;
     Error _error = NoError;
@@ -72,6 +83,10 @@ private:
     MessageID _assetRequestID { INVALID_MESSAGE_ID };
     const ByteRange _byteRange;
     bool _loadedFromCache { false };
+
+    std::vector<QPointer<QNetworkReply>> _mirrorReplies;
+    std::vector<QByteArray> _mirrorRanges;
+    int _numPendingMirrorRanges { 0 };
 };
 
 #endif
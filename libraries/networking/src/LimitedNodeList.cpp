@@ -19,6 +19,7 @@
 #include <QtCore/QDataStream>
 #include <QtCore/QDebug>
 #include <QtCore/QJsonDocument>
+#include <QtCore/QMutex>
 #include <QtCore/QThread>
 #include <QtCore/QUrl>
 #include <QtNetwork/QTcpSocket>
@@ -36,8 +37,9 @@
 #include "Assignment.h"
 #include "SockAddr.h"
 #include "NetworkLogging.h"
+#include "udt/BBRCC.h"
 #include "udt/Packet.h"
-#include "HMACAuth.h"
+#include "SipHash.h"
 
 #if defined(Q_OS_WIN)
 #include <winsock.h>
@@ -263,6 +265,9 @@ bool LimitedNodeList::packetVersionMatch(const udt::Packet& packet) {
 
         static QMultiHash<QUuid, PacketType> sourcedVersionDebugSuppressMap;
         static QMultiHash<SockAddr, PacketType> versionDebugSuppressMap;
+        // packets may be verified on receive shard threads as well as the NodeList thread
+        static QMutex versionDebugSuppressMutex;
+        QMutexLocker versionDebugSuppressLocker(&versionDebugSuppressMutex);
 
         bool hasBeenOutput = false;
         QString senderString;
@@ -365,18 +370,23 @@ bool LimitedNodeList::packetSourceAndHashMatchAndTrackBandwidth(const udt::Packe
 
             if (verifiedPacket && verificationEnabled) {
 
-                QByteArray packetHeaderHash = NLPacket::verificationHashInHeader(packet);
-                QByteArray expectedHash;
-                auto sourceNodeHMACAuth = sourceNode->getAuthenticateHash();
-                if (sourceNode->getAuthenticateHash()) {
-                    expectedHash = NLPacket::hashForPacketAndHMAC(packet, *sourceNodeHMACAuth);
-                }
+                auto sourceNodeHash = sourceNode->getAuthenticateHash();
 
-                // check if the HMAC-md5 hash in the header matches the hash we would expect
-                if (!sourceNodeHMACAuth || packetHeaderHash != expectedHash) {
+                // check if the SipHash in the header matches the hash we would expect
+                if (!sourceNodeHash || !NLPacket::verificationHashMatches(packet, *sourceNodeHash)) {
                     static QMultiMap<QUuid, PacketType> hashDebugSuppressMap;
+                    static QMutex hashDebugSuppressMutex;
+                    QMutexLocker hashDebugSuppressLocker(&hashDebugSuppressMutex);
 
                     if (!hashDebugSuppressMap.contains(sourceID, headerType)) {
+                        QByteArray packetHeaderHash = NLPacket::verificationHashInHeader(packet);
+                        QByteArray expectedHash;
+                        if (sourceNodeHash) {
+                            SipHash::Hash hashResult;
+                            NLPacket::hashForPacket(packet, *sourceNodeHash, hashResult);
+                            expectedHash = QByteArray((const char*)hashResult.data(), (int)hashResult.size());
+                        }
+
                         qCDebug(networking) << "Packet hash mismatch on" << headerType << "- Sender" << sourceID;
                         qCDebug(networking) << "Packet len:" << packet.getDataSize() << "Expected hash:" <<
                             expectedHash.toHex() << "Actual:" << packetHeaderHash.toHex();
@@ -403,15 +413,37 @@ bool LimitedNodeList::packetSourceAndHashMatchAndTrackBandwidth(const udt::Packe
     return false;
 }
 
-void LimitedNodeList::fillPacketHeader(const NLPacket& packet, HMACAuth* hmacAuth) {
+bool LimitedNodeList::setCongestionControl(const QString& name) {
+    bool isBBR = name.compare("bbr", Qt::CaseInsensitive) == 0;
+    if (!isBBR && name.compare("vegas", Qt::CaseInsensitive) != 0) {
+        qCWarning(networking) << "Unknown congestion control" << name;
+        return false;
+    }
+
+    // the socket reads its factory on our thread when it creates connections
+    QMetaObject::invokeMethod(this, [this, isBBR] {
+        std::unique_ptr<udt::CongestionControlVirtualFactory> factory;
+        if (isBBR) {
+            factory.reset(new udt::CongestionControlFactory<udt::BBRCC>());
+        } else {
+            factory.reset(new udt::CongestionControlFactory<udt::TCPVegasCC>());
+        }
+        _nodeSocket.setCongestionControlFactory(std::move(factory));
+    });
+
+    qCInfo(networking) << "Using" << name << "congestion control for new connections";
+    return true;
+}
+
+void LimitedNodeList::fillPacketHeader(const NLPacket& packet, const SipHash* authHash) {
     if (!PacketTypeEnum::getNonSourcedPackets().contains(packet.getType())) {
         packet.writeSourceID(getSessionLocalID());
     }
 
-    if (_useAuthentication && hmacAuth
+    if (_useAuthentication && authHash
         && !PacketTypeEnum::getNonSourcedPackets().contains(packet.getType())
         && !PacketTypeEnum::getNonVerifiedPackets().contains(packet.getType())) {
-        packet.writeVerificationHash(*hmacAuth);
+        packet.writeVerificationHash(*authHash);
     }
 }
 
@@ -428,7 +460,7 @@ qint64 LimitedNodeList::sendUnreliablePacket(const NLPacket& packet, const Node&
 }
 
 qint64 LimitedNodeList::sendUnreliablePacket(const NLPacket& packet, const SockAddr& sockAddr,
-        HMACAuth* hmacAuth) {
+        const SipHash* authHash) {
     Q_ASSERT(!packet.isPartOfMessage());
     Q_ASSERT_X(!packet.isReliable(), "LimitedNodeList::sendUnreliablePacket",
                "Trying to send a reliable packet unreliably.");
@@ -443,7 +475,7 @@ qint64 LimitedNodeList::sendUnreliablePacket(const NLPacket& packet, const SockA
         }
     }
 
-    fillPacketHeader(packet, hmacAuth);
+    fillPacketHeader(packet, authHash);
 
     return _nodeSocket.writePacket(packet, sockAddr);
 }
@@ -461,17 +493,17 @@ qint64 LimitedNodeList::sendPacket(std::unique_ptr<NLPacket> packet, const Node&
 }
 
 qint64 LimitedNodeList::sendPacket(std::unique_ptr<NLPacket> packet, const SockAddr& sockAddr,
-                                   HMACAuth* hmacAuth) {
+                                   const SipHash* authHash) {
     Q_ASSERT(!packet->isPartOfMessage());
     if (packet->isReliable()) {
-        fillPacketHeader(*packet, hmacAuth);
+        fillPacketHeader(*packet, authHash);
 
         auto size = packet->getDataSize();
         _nodeSocket.writePacket(std::move(packet), sockAddr);
 
         return size;
     } else {
-        auto size = sendUnreliablePacket(*packet, sockAddr, hmacAuth);
+        auto size = sendUnreliablePacket(*packet, sockAddr, authHash);
         if (size < 0) {
             auto now = usecTimestampNow();
             if (now - _sendErrorStatsTime > ERROR_STATS_PERIOD_US) {
@@ -512,14 +544,14 @@ qint64 LimitedNodeList::sendUnreliableUnorderedPacketList(NLPacketList& packetLi
 }
 
 qint64 LimitedNodeList::sendUnreliableUnorderedPacketList(NLPacketList& packetList, const SockAddr& sockAddr,
-                                                          HMACAuth* hmacAuth) {
+                                                          const SipHash* authHash) {
     qint64 bytesSent = 0;
 
     // close the last packet in the list
     packetList.closeCurrentPacket();
 
     while (!packetList._packets.empty()) {
-        bytesSent += sendPacket(packetList.takeFront<NLPacket>(), sockAddr, hmacAuth);
+        bytesSent += sendPacket(packetList.takeFront<NLPacket>(), sockAddr, authHash);
     }
 
     return bytesSent;
@@ -594,6 +626,22 @@ NodeData* LimitedNodeList::getOrCreateLinkedData(SharedNodePointer node) {
     return node->getLinkedData();
 }
 
+void LimitedNodeList::publishNodeSnapshot() {
+    // builders are serialized so that an older snapshot can't be published over a newer one
+    std::lock_guard<std::mutex> lock(_nodeSnapshotMutex);
+
+    auto nodes = std::make_shared<NodeVector>();
+    {
+        QReadLocker readLocker(&_nodeMutex);
+        nodes->reserve(_nodeHash.size());
+        for (const auto& pair : _nodeHash) {
+            nodes->push_back(pair.second);
+        }
+    }
+
+    std::atomic_store(&_nodeSnapshot, NodeSnapshot(std::move(nodes)));
+}
+
 SharedNodePointer LimitedNodeList::nodeWithUUID(const QUuid& nodeUUID) {
     QReadLocker readLocker(&_nodeMutex);
 
@@ -627,6 +675,7 @@ void LimitedNodeList::eraseAllNodes(QString reason) {
         _localIDMap.clear();
         _nodeHash.clear();
     }
+    publishNodeSnapshot();
 
     foreach(const SharedNodePointer& killedNode, killedNodes) {
         handleNodeKill(killedNode);
@@ -652,6 +701,7 @@ bool LimitedNodeList::killNodeWithUUID(const QUuid& nodeUUID, ConnectionID newCo
             _localIDMap.unsafe_erase(matchingNode->getLocalID());
             _nodeHash.unsafe_erase(matchingNode->getUUID());
         }
+        publishNodeSnapshot();
 
         handleNodeKill(matchingNode, newConnectionID);
         return true;
@@ -712,6 +762,7 @@ SharedNodePointer LimitedNodeList::addOrUpdateNode(const QUuid& uuid, NodeType_t
                 _localIDMap.unsafe_erase(node->getLocalID());
                 _nodeHash.unsafe_erase(node->getUUID());
             }
+            publishNodeSnapshot();
             handleNodeKill(node);
         }
     };
@@ -756,6 +807,7 @@ SharedNodePointer LimitedNodeList::addOrUpdateNode(const QUuid& uuid, NodeType_t
         _nodeHash.insert({ newNode->getUUID(), newNodePointer });
         _localIDMap.insert({ localID, newNodePointer });
     }
+    publishNodeSnapshot();
 
     qCDebug(networking) << "Added" << *newNode;
 
@@ -931,6 +983,10 @@ void LimitedNodeList::removeSilentNodes() {
         node->getMutex().unlock();
     });
 
+    if (!killedNodes.isEmpty()) {
+        publishNodeSnapshot();
+    }
+
     foreach(const SharedNodePointer& killedNode, killedNodes) {
         auto now = usecTimestampNow();
         qCDebug(networking_ice) << "Removing silent node" << *killedNode << "\n"
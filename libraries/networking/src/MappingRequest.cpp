@@ -104,9 +104,17 @@ void GetMappingRequest::doStart() {
     });
 };
 
+// large sets of mappings are got a page at a time, so that no one reply has to hold all of them
+static const uint32_t MAPPINGS_PER_PAGE = 10000;
+
 void GetAllMappingsRequest::doStart() {
+    _mappings.clear();
+    requestPage(AssetUtils::AssetPath());
+};
+
+void GetAllMappingsRequest::requestPage(const AssetUtils::AssetPath& startAfter) {
     auto assetClient = DependencyManager::get<AssetClient>();
-    _mappingRequestID = assetClient->getAllAssetMappings(
+    _mappingRequestID = assetClient->getAllAssetMappings(startAfter, MAPPINGS_PER_PAGE,
             [this, assetClient](bool responseReceived, AssetUtils::AssetServerError error, QSharedPointer<ReceivedMessage> message) {
 
         _mappingRequestID = INVALID_MESSAGE_ID;
@@ -128,6 +136,7 @@ void GetAllMappingsRequest::doStart() {
         if (!_error) {
             uint32_t numberOfMappings;
             message->readPrimitive(&numberOfMappings);
+            AssetUtils::AssetPath lastPath;
             for (uint32_t i = 0; i < numberOfMappings; ++i) {
                 auto path = message->readString();
                 auto hash = message->read(AssetUtils::SHA256_HASH_LENGTH).toHex();
@@ -138,11 +147,19 @@ void GetAllMappingsRequest::doStart() {
                     lastBakeErrors = message->readString();
                 }
                 _mappings[path] = { hash, status, lastBakeErrors };
+                lastPath = path;
+            }
+
+            uint8_t hasMoreMappings { false };
+            message->readPrimitive(&hasMoreMappings);
+            if (hasMoreMappings && !lastPath.isEmpty()) {
+                requestPage(lastPath);
+                return;
             }
         }
         emit finished(this);
     });
-};
+}
 
 SetMappingRequest::SetMappingRequest(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash) :
     _path(path.trimmed()),
@@ -127,6 +127,7 @@ signals:
 
 private:
     virtual void doStart() override;
+    void requestPage(const AssetUtils::AssetPath& startAfter);
 
     AssetUtils::AssetMappings _mappings;
 };
@@ -168,6 +168,11 @@ public:
     static std::unique_ptr<NLPacketList> encodeMessagesPacket(QString channel, QString message, QUuid senderID);
     static std::unique_ptr<NLPacketList> encodeMessagesDataPacket(QString channel, QByteArray data, QUuid senderID);
 
+    // the payload of a MessagesData packet list, for sending the same message to many nodes without encoding it again
+    static QByteArray encodeMessagesPayload(const QString& channel, bool isText, const QByteArray& messageOrData,
+                                            const QUuid& senderID);
+    static std::unique_ptr<NLPacketList> createMessagesPacketList(const QByteArray& payload);
+
 signals:
     /*@jsdoc
      * Triggered when a text message is received.
@@ -12,8 +12,6 @@
 
 #include "NLPacket.h"
 
-#include "HMACAuth.h"
-
 int NLPacket::localHeaderSize(PacketType type) {
     bool nonSourced = PacketTypeEnum::getNonSourcedPackets().contains(type);
     bool nonVerified = PacketTypeEnum::getNonVerifiedPackets().contains(type);
@@ -35,7 +33,7 @@ std::unique_ptr<NLPacket> NLPacket::create(PacketType type, qint64 size, bool is
     return packet;
 }
 
-std::unique_ptr<NLPacket> NLPacket::fromReceivedPacket(std::unique_ptr<char[]> data, qint64 size,
+std::unique_ptr<NLPacket> NLPacket::fromReceivedPacket(udt::PacketBuffer data, qint64 size,
                                                        const SockAddr& senderSockAddr) {
     // Fail with null data
     Q_ASSERT(data);
@@ -90,7 +88,7 @@ NLPacket::NLPacket(const NLPacket& other) : Packet(other) {
     _sourceID = other._sourceID;
 }
 
-NLPacket::NLPacket(std::unique_ptr<char[]> data, qint64 size, const SockAddr& senderSockAddr) :
+NLPacket::NLPacket(udt::PacketBuffer data, qint64 size, const SockAddr& senderSockAddr) :
     Packet(std::move(data), size, senderSockAddr)
 {    
     // sanity check before we decrease the payloadSize with the payloadCapacity
@@ -153,16 +151,29 @@ QByteArray NLPacket::verificationHashInHeader(const udt::Packet& packet) {
     return QByteArray(packet.getData() + offset, NUM_BYTES_MD5_HASH);
 }
 
-QByteArray NLPacket::hashForPacketAndHMAC(const udt::Packet& packet, HMACAuth& hash) {
+void NLPacket::hashForPacket(const udt::Packet& packet, const SipHash& hash, SipHash::Hash& hashResult) {
     int offset = Packet::totalHeaderSize(packet.isPartOfMessage()) + sizeof(PacketType) + sizeof(PacketVersion)
         + NUM_BYTES_LOCALID + NUM_BYTES_MD5_HASH;
-    
-    // add the packet payload and the connection UUID
-    HMACAuth::HMACHash hashResult;
-    if (!hash.calculateHash(hashResult, packet.getData() + offset, packet.getDataSize() - offset)) {
-        return QByteArray();
+
+    // hash the packet payload with the connection secret as the key
+    hash.calculateHash(hashResult, packet.getData() + offset, packet.getDataSize() - offset);
+}
+
+bool NLPacket::verificationHashMatches(const udt::Packet& packet, const SipHash& hash) {
+    static_assert(SipHash::HASH_SIZE == NUM_BYTES_MD5_HASH, "the verification hash must fill its header field");
+    int offset = Packet::totalHeaderSize(packet.isPartOfMessage()) + sizeof(PacketType) +
+        sizeof(PacketVersion) + NUM_BYTES_LOCALID;
+
+    SipHash::Hash expectedHash;
+    hashForPacket(packet, hash, expectedHash);
+
+    // compare every byte, so that how long this takes doesn't tell a forger how much of the hash they have right
+    const uint8_t* headerHash = reinterpret_cast<const uint8_t*>(packet.getData() + offset);
+    uint8_t difference = 0;
+    for (int i = 0; i < SipHash::HASH_SIZE; ++i) {
+        difference |= headerHash[i] ^ expectedHash[i];
     }
-    return QByteArray((const char*) hashResult.data(), (int) hashResult.size());
+    return difference == 0;
 }
 
 void NLPacket::writeTypeAndVersion() {
@@ -217,14 +228,15 @@ void NLPacket::writeSourceID(LocalID sourceID) const {
     _sourceID = sourceID;
 }
 
-void NLPacket::writeVerificationHash(HMACAuth& hmacAuth) const {
+void NLPacket::writeVerificationHash(const SipHash& hash) const {
     Q_ASSERT(!PacketTypeEnum::getNonSourcedPackets().contains(_type) &&
              !PacketTypeEnum::getNonVerifiedPackets().contains(_type));
     
     auto offset = Packet::totalHeaderSize(isPartOfMessage()) + sizeof(PacketType) + sizeof(PacketVersion)
                 + NUM_BYTES_LOCALID;
 
-    QByteArray verificationHash = hashForPacketAndHMAC(*this, hmacAuth);
-    
+    SipHash::Hash verificationHash;
+    hashForPacket(*this, hash, verificationHash);
+
     memcpy(_packet.get() + offset, verificationHash.data(), verificationHash.size());
 }
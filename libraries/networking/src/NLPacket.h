@@ -15,10 +15,9 @@
 
 #include <UUID.h>
 
+#include "SipHash.h"
 #include "udt/Packet.h"
 
-class HMACAuth;
-
 class NLPacket : public udt::Packet {
     Q_OBJECT
 public:
@@ -32,7 +31,7 @@ public:
     //    |  Packet Type  |    Version    | Local Node ID - sourced only  |
     //    +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
     //    |                                                               |
-    //    |                 MD5 Verification - 16 bytes                   |
+    //    |               SipHash Verification - 16 bytes                 |
     //    |                 (ONLY FOR VERIFIED PACKETS)                   |
     //    |                                                               |
     //    +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
@@ -50,7 +49,7 @@ public:
     static std::unique_ptr<NLPacket> create(PacketType type, qint64 size = -1,
                     bool isReliable = false, bool isPartOfMessage = false, PacketVersion version = 0);
     
-    static std::unique_ptr<NLPacket> fromReceivedPacket(std::unique_ptr<char[]> data, qint64 size,
+    static std::unique_ptr<NLPacket> fromReceivedPacket(udt::PacketBuffer data, qint64 size,
                                                         const SockAddr& senderSockAddr);
 
     static std::unique_ptr<NLPacket> fromBase(std::unique_ptr<Packet> packet);
@@ -70,7 +69,8 @@ public:
     
     static LocalID sourceIDInHeader(const udt::Packet& packet);
     static QByteArray verificationHashInHeader(const udt::Packet& packet);
-    static QByteArray hashForPacketAndHMAC(const udt::Packet& packet, HMACAuth& hash);
+    static void hashForPacket(const udt::Packet& packet, const SipHash& hash, SipHash::Hash& hashResult);
+    static bool verificationHashMatches(const udt::Packet& packet, const SipHash& hash);
     
     PacketType getType() const { return _type; }
     void setType(PacketType type);
@@ -81,12 +81,12 @@ public:
     LocalID getSourceID() const { return _sourceID; }
     
     void writeSourceID(LocalID sourceID) const;
-    void writeVerificationHash(HMACAuth& hmacAuth) const;
+    void writeVerificationHash(const SipHash& hash) const;
 
 protected:
     
     NLPacket(PacketType type, qint64 size = -1, bool forceReliable = false, bool isPartOfMessage = false, PacketVersion version = 0);
-    NLPacket(std::unique_ptr<char[]> data, qint64 size, const SockAddr& senderSockAddr);
+    NLPacket(udt::PacketBuffer data, qint64 size, const SockAddr& senderSockAddr);
     
     NLPacket(const NLPacket& other);
     NLPacket(NLPacket&& other);
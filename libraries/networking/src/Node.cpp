@@ -240,7 +240,7 @@ void Node::setConnectionSecret(const QUuid& connectionSecret) {
     }
 
     if (!_authenticateHash) {
-        _authenticateHash.reset(new HMACAuth());
+        _authenticateHash.reset(new SipHash());
     }
 
     _connectionSecret = connectionSecret;
@@ -318,6 +318,10 @@ void NodeList::reset(QString reason, bool skipDomainHandlerReset) {
     setSessionUUID(QUuid());
     setSessionLocalID(Node::NULL_LOCAL_ID);
 
+    // the next domain list will be a full one
+    _domainListVersion = 0;
+    _pendingDomainListVersion = 0;
+
     // if we setup the DTLS socket, also disconnect from the DTLS socket readyRead() so it can handle handshaking
     if (_dtlsSocket) {
         disconnect(_dtlsSocket, 0, this, 0);
@@ -500,6 +504,10 @@ void NodeList::sendDomainServerCheckIn() {
             << localSockAddr << _nodeTypesOfInterest.toList();
         packetStream << DependencyManager::get<AddressManager>()->getPlaceName();
 
+        if (domainPacketType == PacketType::DomainListRequest) {
+            packetStream << _domainListVersion.load();
+        }
+
         if (!domainIsConnected) {
 
             // Metaverse account.
@@ -761,6 +769,17 @@ void NodeList::processDomainList(QSharedPointer<ReceivedMessage> message) {
     bool newConnection;
     packetStream >> newConnection;
 
+    // the version of the list, whether it only has what changed since the version we last checked in with,
+    // and how many entries it has over all its packets
+    quint32 domainListVersion;
+    packetStream >> domainListVersion;
+
+    bool isDelta;
+    packetStream >> isDelta;
+
+    quint32 numDomainListEntries;
+    packetStream >> numDomainListEntries;
+
     if (newConnection) {
         _nodeConnectTimestamp = usecTimestampNow();
         _connectReason = Connect;
@@ -857,8 +876,37 @@ void NodeList::processDomainList(QSharedPointer<ReceivedMessage> message) {
     setPermissions(newPermissions);
     setAuthenticatePackets(isAuthenticated);
 
+    // the packets of the same list share their header
+    if (domainListVersion != _pendingDomainListVersion || isDelta != _pendingDomainListIsDelta
+            || numDomainListEntries != _pendingDomainListEntries) {
+        _pendingDomainListVersion = domainListVersion;
+        _pendingDomainListIsDelta = isDelta;
+        _pendingDomainListEntries = numDomainListEntries;
+        _receivedDomainListEntries = 0;
+    }
+
     // pull each node in the packet
     while (packetStream.device()->pos() < message->getSize()) {
+        parseDomainListEntry(packetStream);
+        ++_receivedDomainListEntries;
+    }
+
+    // only ask for the changes since this version once all of it has been received
+    if (_receivedDomainListEntries >= _pendingDomainListEntries) {
+        _domainListVersion = domainListVersion;
+    }
+}
+
+void NodeList::parseDomainListEntry(QDataStream& packetStream) {
+    bool isRemovedNode;
+    packetStream >> isRemovedNode;
+
+    if (isRemovedNode) {
+        QUuid nodeUUID;
+        packetStream >> nodeUUID;
+        killNodeWithUUID(nodeUUID);
+        removeDelayedAdd(nodeUUID);
+    } else {
         parseNodeFromPacketStream(packetStream);
     }
 }
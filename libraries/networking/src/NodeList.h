@@ -170,6 +170,7 @@ private:
     void sendDSPathQuery(const QString& newPath);
 
     void parseNodeFromPacketStream(QDataStream& packetStream);
+    void parseDomainListEntry(QDataStream& packetStream);
 
     void pingPunchForInactiveNode(const SharedNodePointer& node);
 
@@ -183,6 +184,14 @@ private:
     QTimer _keepAlivePingTimer;
     bool _requestsDomainListData { false };
 
+    // The version of the last domain list fully received, sent with each check-in so that the domain-server only sends
+    // what changed since. The list is counted as it arrives, it can be split over packets that are lost.
+    std::atomic<quint32> _domainListVersion { 0 };
+    quint32 _pendingDomainListVersion { 0 };
+    bool _pendingDomainListIsDelta { false };
+    quint32 _pendingDomainListEntries { 0 };
+    quint32 _receivedDomainListEntries { 0 };
+
     bool _sendDomainServerCheckInEnabled { true };
     bool _domainPortAutoDiscovery { true };
 
@@ -15,6 +15,7 @@
 
 #include <QtCore/QMetaObject>
 #include <QtCore/QMutexLocker>
+#include <QtCore/QThread>
 
 #include "DependencyManager.h"
 #include "NetworkLogging.h"
@@ -27,10 +28,21 @@ PacketReceiver::PacketReceiver(QObject* parent) : QObject(parent) {
     qRegisterMetaType<QSharedPointer<ReceivedMessage>>();
 }
 
-bool PacketReceiver::ListenerReference::invokeWithQt(const QSharedPointer<ReceivedMessage>& receivedMessagePointer, const QSharedPointer<Node>& sourceNode) {
+void PacketReceiver::DispatchCounters::record(uint64_t usecs) {
+    _count.fetch_add(1, std::memory_order_relaxed);
+    _totalUsecs.fetch_add(usecs, std::memory_order_relaxed);
+    uint64_t max = _maxUsecs.load(std::memory_order_relaxed);
+    while (usecs > max && !_maxUsecs.compare_exchange_weak(max, usecs, std::memory_order_relaxed)) {
+    }
+}
+
+bool PacketReceiver::ListenerReference::invokeWithQt(const QSharedPointer<ReceivedMessage>& receivedMessagePointer, const QSharedPointer<Node>& sourceNode,
+                                                     DispatchCounters& counters, quint64 receivedAt) {
     ListenerReferencePointer thisPointer = sharedFromThis();
+    DispatchCounters* countersPointer = &counters;
     return QMetaObject::invokeMethod(getObject(), [=]() {
         thisPointer->invokeDirectly(receivedMessagePointer, sourceNode);
+        countersPointer->record(usecTimestampNow() - receivedAt);
     });
 }
 
@@ -48,25 +60,21 @@ bool PacketReceiver::registerListenerForTypes(PacketTypeList types, const Listen
 void PacketReceiver::registerDirectListener(PacketType type, const ListenerReferencePointer& listener) {
     Q_ASSERT_X(listener, "PacketReceiver::registerDirectListener", "No listener to register");
     
-    bool success = registerListener(type, listener);
-    if (success) {
-        QMutexLocker locker(&_directConnectSetMutex);
-        
-        // if we successfully registered, add this object to the set of objects that are directly connected
-        _directlyConnectedObjects.insert(listener->getObject());
+    if (matchingMethodForListener(type, listener)) {
+        qCDebug(networking) << "Registering a direct packet listener for packet list type" << type;
+        registerVerifiedListener(type, listener, false, true);
+    } else {
+        qCWarning(networking) << "FAILED to Register a direct packet listener for packet list type" << type;
     }
 }
 
 void PacketReceiver::registerDirectListenerForTypes(PacketTypeList types, const ListenerReferencePointer& listener) {
     Q_ASSERT_X(listener, "PacketReceiver::registerDirectListenerForTypes", "No listener to register");
     
-    // just call register listener for types to start
-    bool success = registerListenerForTypes(std::move(types), listener);
-    if (success) {
-        QMutexLocker locker(&_directConnectSetMutex);
-        
-        // if we successfully registered, add this object to the set of objects that are directly connected
-        _directlyConnectedObjects.insert(listener->getObject());
+    Q_ASSERT_X(!types.empty(), "PacketReceiver::registerDirectListenerForTypes", "No types to register");
+
+    for (PacketType type : types) {
+        registerVerifiedListener(type, listener, false, true);
     }
 }
 
@@ -100,39 +108,34 @@ bool PacketReceiver::matchingMethodForListener(PacketType type, const ListenerRe
     return true;
 }
 
-void PacketReceiver::registerVerifiedListener(PacketType type, const ListenerReferencePointer& listener, bool deliverPending) {
+void PacketReceiver::registerVerifiedListener(PacketType type, const ListenerReferencePointer& listener, bool deliverPending,
+                                              bool isDirect) {
     Q_ASSERT_X(listener, "PacketReceiver::registerVerifiedListener", "No listener to register");
     QMutexLocker locker(&_packetListenerLock);
 
-    if (_messageListenerMap.contains(type)) {
+    auto& entry = _messageListeners[(size_t)type];
+    if (entry.listener) {
         qCWarning(networking) << "Registering a packet listener for packet type" << type
             << "that will remove a previously registered listener";
     }
     
     // add the mapping
-    _messageListenerMap[type] = { listener, deliverPending };
+    entry.listener = listener;
+    entry.deliverPending = deliverPending;
+    entry.isDirect = isDirect;
 }
 
 void PacketReceiver::unregisterListener(QObject* listener) {
     Q_ASSERT_X(listener, "PacketReceiver::unregisterListener", "No listener to unregister");
     
-    {
-        QMutexLocker packetListenerLocker(&_packetListenerLock);
-        
-        // clear any registrations for this listener in _messageListenerMap
-        auto it = _messageListenerMap.begin();
-        
-        while (it != _messageListenerMap.end()) {
-            if (it.value().listener->getObject() == listener) {
-                it = _messageListenerMap.erase(it);
-            } else {
-                ++it;
-            }
+    QMutexLocker packetListenerLocker(&_packetListenerLock);
+
+    // clear any registrations for this listener
+    for (auto& entry : _messageListeners) {
+        if (entry.listener && entry.listener->getObject() == listener) {
+            entry = Listener();
         }
     }
-    
-    QMutexLocker directConnectSetLocker(&_directConnectSetMutex);
-    _directlyConnectedObjects.remove(listener);
 }
 
 void PacketReceiver::handleVerifiedPacket(std::unique_ptr<udt::Packet> packet) {
@@ -143,7 +146,7 @@ void PacketReceiver::handleVerifiedPacket(std::unique_ptr<udt::Packet> packet) {
 
     // setup an NLPacket from the packet we were passed
     auto nlPacket = NLPacket::fromBase(std::move(packet));
-    auto receivedMessage = QSharedPointer<ReceivedMessage>::create(*nlPacket);
+    auto receivedMessage = QSharedPointer<ReceivedMessage>::create(std::move(nlPacket));
 
     handleVerifiedMessage(receivedMessage, true);
 }
@@ -157,14 +160,14 @@ void PacketReceiver::handleVerifiedMessagePacket(std::unique_ptr<udt::Packet> pa
 
     if (it == _pendingMessages.end()) {
         // Create message
-        message = QSharedPointer<ReceivedMessage>::create(*nlPacket);
+        message = QSharedPointer<ReceivedMessage>::create(std::move(nlPacket));
         if (!message->isComplete()) {
             _pendingMessages[key] = message;
         }
         handleVerifiedMessage(message, true);  // Handler may handle first message packet immediately when it arrives.
     } else {
         message = it->second;
-        message->appendPacket(*nlPacket);
+        message->appendPacket(std::move(nlPacket));
 
         if (message->isComplete()) {
             _pendingMessages.erase(it);
@@ -184,61 +187,76 @@ void PacketReceiver::handleMessageFailure(SockAddr from, udt::Packet::MessageNum
 }
 
 void PacketReceiver::handleVerifiedMessage(QSharedPointer<ReceivedMessage> receivedMessage, bool justReceived) {
+    quint64 receivedAt = usecTimestampNow();
+    auto type = receivedMessage->getType();
+    if ((size_t)type >= NUM_PACKET_TYPES) {
+        return;
+    }
+
+    Listener listener;
+    {
+        QMutexLocker packetListenerLocker(&_packetListenerLock);
+        auto& entry = _messageListeners[(size_t)type];
+        if (!entry.listener) {
+            if (!entry.hasWarned) {
+                // only print this once for each type
+                qCWarning(networking) << "No listener found for packet type" << type;
+                entry.hasWarned = true;
+            }
+            return;
+        }
+
+        if (!entry.listener->getObject()) {
+            qCDebug(networking).nospace() << "Listener for packet " << type
+                << " has been destroyed. Removing from listener map.";
+            entry = Listener();
+            return;
+        }
+        listener = entry;
+    }
+
+    if ((listener.deliverPending && !justReceived) || (!listener.deliverPending && !receivedMessage->isComplete())) {
+        return;
+    }
+
     auto nodeList = DependencyManager::get<LimitedNodeList>();
-    
     SharedNodePointer matchingNode;
-    
     if (receivedMessage->getSourceID() != Node::NULL_LOCAL_ID) {
         matchingNode = nodeList->nodeWithLocalID(receivedMessage->getSourceID());
     }
-    QMutexLocker packetListenerLocker(&_packetListenerLock);
-    
-    auto it = _messageListenerMap.find(receivedMessage->getType());
-    if (it != _messageListenerMap.end() && !it->listener.isNull()) {
-         
-        auto listener = it.value();
 
-        if ((listener.deliverPending && !justReceived) || (!listener.deliverPending && !receivedMessage->isComplete())) {
-            return;
-        }
-            
-        bool success = false;
-
-        bool isDirectConnect = false;
-        // check if this is a directly connected listener
-        {
-            QMutexLocker directConnectLocker(&_directConnectSetMutex);
-            isDirectConnect = _directlyConnectedObjects.contains(listener.listener->getObject());
-        }
+    auto& counters = _dispatchCounters[(size_t)type];
+    bool success = false;
 
-        // one final check on the QPointer before we go to invoke
-        if (listener.listener->getObject()) {
-            if (isDirectConnect) {
-                success = listener.listener->invokeDirectly(receivedMessage, matchingNode);
-            } else {
-                success = listener.listener->invokeWithQt(receivedMessage, matchingNode);
-            }
-        } else {
-            qCDebug(networking).nospace() << "Listener for packet " << receivedMessage->getType()
-                << " has been destroyed. Removing from listener map.";
-            it = _messageListenerMap.erase(it);
+    // listeners that live in this thread are called directly, rather than through a queued event
+    QObject* object = listener.listener->getObject();
+    if (listener.isDirect || (object && object->thread() == QThread::currentThread())) {
+        success = listener.listener->invokeDirectly(receivedMessage, matchingNode);
+        counters.record(usecTimestampNow() - receivedAt);
+    } else if (object) {
+        success = listener.listener->invokeWithQt(receivedMessage, matchingNode, counters, receivedAt);
+    }
 
-            // if it exists, remove the listener from _directlyConnectedObjects
-            {
-                QMutexLocker directConnectLocker(&_directConnectSetMutex);
-                _directlyConnectedObjects.remove(listener.listener->getObject());
-            }
-        }
+    if (!success) {
+        qCDebug(networking).nospace() << "Error delivering packet " << type << " to listener " << object;
+    }
+}
 
-        if (!success) {
-            qCDebug(networking).nospace() << "Error delivering packet " << receivedMessage->getType() << " to listener "
-                << listener.listener->getObject();
+PacketReceiver::DispatchStatsVector PacketReceiver::sampleDispatchStats() {
+    DispatchStatsVector stats;
+    for (size_t i = 0; i < NUM_PACKET_TYPES; ++i) {
+        auto& counters = _dispatchCounters[i];
+        uint64_t count = counters._count.exchange(0, std::memory_order_relaxed);
+        uint64_t totalUsecs = counters._totalUsecs.exchange(0, std::memory_order_relaxed);
+        uint64_t maxUsecs = counters._maxUsecs.exchange(0, std::memory_order_relaxed);
+        if (count > 0) {
+            DispatchStats typeStats;
+            typeStats.type = (PacketType)i;
+            typeStats.count = count;
+            typeStats.totalUsecs = totalUsecs;
+            typeStats.maxUsecs = maxUsecs;
+            stats.push_back(typeStats);
         }
-
-    } else if (it == _messageListenerMap.end()) {
-        qCWarning(networking) << "No listener found for packet type" << receivedMessage->getType();
-        
-        // insert a dummy listener so we don't print this again
-        _messageListenerMap.insert(receivedMessage->getType(), { ListenerReferencePointer(), false });
     }
+    return stats;
 }
@@ -14,6 +14,8 @@
 #ifndef hifi_PacketReceiver_h
 #define hifi_PacketReceiver_h
 
+#include <array>
+#include <atomic>
 #include <vector>
 #include <unordered_map>
 
@@ -45,10 +47,32 @@ namespace std {
 class PacketReceiver : public QObject {
     Q_OBJECT
 public:
+    // How many messages of a type were delivered to its listener, and how long they took from arriving to being handled.
+    struct DispatchStats {
+        PacketType type;
+        uint64_t count { 0 };
+        uint64_t totalUsecs { 0 };
+        uint64_t maxUsecs { 0 };
+    };
+    using DispatchStatsVector = std::vector<DispatchStats>;
+
+    class DispatchCounters {
+    public:
+        void record(uint64_t usecs);
+
+    private:
+        friend class PacketReceiver;
+        std::atomic<uint64_t> _count { 0 };
+        std::atomic<uint64_t> _totalUsecs { 0 };
+        std::atomic<uint64_t> _maxUsecs { 0 };
+    };
+
     class ListenerReference : public QEnableSharedFromThis<ListenerReference> {
     public:
         virtual bool invokeDirectly(const QSharedPointer<ReceivedMessage>& receivedMessagePointer, const QSharedPointer<Node>& sourceNode) = 0;
-        bool invokeWithQt(const QSharedPointer<ReceivedMessage>& receivedMessagePointer, const QSharedPointer<Node>& sourceNode);
+        // queues the call to the listener's thread, recording the time from receivedAt to its return in counters
+        bool invokeWithQt(const QSharedPointer<ReceivedMessage>& receivedMessagePointer, const QSharedPointer<Node>& sourceNode,
+                          DispatchCounters& counters, quint64 receivedAt);
         virtual bool isSourced() const = 0;
         virtual QObject* getObject() const = 0;
     };
@@ -80,6 +104,9 @@ public:
     void handleVerifiedPacket(std::unique_ptr<udt::Packet> packet);
     void handleVerifiedMessagePacket(std::unique_ptr<udt::Packet> message);
     void handleMessageFailure(SockAddr from, udt::Packet::MessageNumber messageNumber);
+
+    // the dispatch stats of the types delivered since the last sample, resetting them
+    DispatchStatsVector sampleDispatchStats();
     
 private:
     template <class T>
@@ -110,7 +137,9 @@ private:
 
     struct Listener {
         ListenerReferencePointer listener;
-        bool deliverPending;
+        bool deliverPending { false };
+        bool isDirect { false }; // always invoked on the receiving thread, whatever thread the listener lives in
+        bool hasWarned { false }; // that there is no listener for the type
     };
 
     void handleVerifiedMessage(QSharedPointer<ReceivedMessage> message, bool justReceived);
@@ -121,14 +150,19 @@ private:
     void registerDirectListener(PacketType type, const ListenerReferencePointer& listener);
 
     bool matchingMethodForListener(PacketType type, const ListenerReferencePointer& listener) const;
-    void registerVerifiedListener(PacketType type, const ListenerReferencePointer& listener, bool deliverPending = false);
+    void registerVerifiedListener(PacketType type, const ListenerReferencePointer& listener, bool deliverPending = false,
+                                  bool isDirect = false);
 
+    static const size_t NUM_PACKET_TYPES = (size_t)PacketType::NUM_PACKET_TYPE;
+
+    // indexed by packet type, guarded by _packetListenerLock
     QMutex _packetListenerLock;
-    QHash<PacketType, Listener> _messageListenerMap;
+    std::array<Listener, NUM_PACKET_TYPES> _messageListeners;
+
+    // indexed by packet type, updated without a lock from whichever thread handles the message
+    std::array<DispatchCounters, NUM_PACKET_TYPES> _dispatchCounters;
 
     bool _shouldDropPackets = false;
-    QMutex _directConnectSetMutex;
-    QSet<QObject*> _directlyConnectedObjects;
 
     std::unordered_map<std::pair<SockAddr, udt::Packet::MessageNumber>, QSharedPointer<ReceivedMessage>> _pendingMessages;
     
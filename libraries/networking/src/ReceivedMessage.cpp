@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstring>
 
 int receivedMessageMetaTypeId = qRegisterMetaType<ReceivedMessage*>("ReceivedMessage*");
 int sharedPtrReceivedMessageMetaTypeId = qRegisterMetaType<QSharedPointer<ReceivedMessage>>("QSharedPointer<ReceivedMessage>");
@@ -23,34 +24,45 @@ static const int HEAD_DATA_SIZE = 512;
 using namespace std::chrono;
 
 ReceivedMessage::ReceivedMessage(const NLPacketList& packetList)
-    : _data(packetList.getMessage()),
-      _headData(_data.mid(0, HEAD_DATA_SIZE)),
-      _numPackets(packetList.getNumPackets()),
+    : _numPackets(packetList.getNumPackets()),
       _sourceID(packetList.getSourceID()),
       _packetType(packetList.getType()),
       _packetVersion(packetList.getVersion()),
-      _senderSockAddr(packetList.getSenderSockAddr())
+      _senderSockAddr(packetList.getSenderSockAddr()),
+      _isReliable(packetList.isReliable())
 {
     _firstPacketReceiveTime = duration_cast<microseconds>(packetList.getFirstPacketReceiveTime().time_since_epoch()).count();
+    appendSegment(bytesSegment(packetList.getMessage()));
 }
 
 ReceivedMessage::ReceivedMessage(NLPacket& packet)
-    : _data(packet.readAll()),
-      _headData(_data.mid(0, HEAD_DATA_SIZE)),
-      _numPackets(1),
+    : _numPackets(1),
       _sourceID(packet.getSourceID()),
       _packetType(packet.getType()),
       _packetVersion(packet.getVersion()),
       _senderSockAddr(packet.getSenderSockAddr()),
+      _isReliable(packet.isReliable()),
       _isComplete(packet.getPacketPosition() == NLPacket::ONLY)
 {
     _firstPacketReceiveTime = duration_cast<microseconds>(packet.getReceiveTime().time_since_epoch()).count();
+    appendSegment(bytesSegment(packet.readAll()));
+}
+
+ReceivedMessage::ReceivedMessage(std::unique_ptr<NLPacket> packet)
+    : _numPackets(1),
+      _sourceID(packet->getSourceID()),
+      _packetType(packet->getType()),
+      _packetVersion(packet->getVersion()),
+      _senderSockAddr(packet->getSenderSockAddr()),
+      _isReliable(packet->isReliable()),
+      _isComplete(packet->getPacketPosition() == NLPacket::ONLY)
+{
+    _firstPacketReceiveTime = duration_cast<microseconds>(packet->getReceiveTime().time_since_epoch()).count();
+    appendSegment(packetSegment(std::move(packet)));
 }
 
 ReceivedMessage::ReceivedMessage(QByteArray byteArray, PacketType packetType, PacketVersion packetVersion,
                 const SockAddr& senderSockAddr, NLPacket::LocalID sourceID) :
-    _data(byteArray),
-    _headData(_data.mid(0, HEAD_DATA_SIZE)),
     _numPackets(1),
     _firstPacketReceiveTime(0),
     _sourceID(sourceID),
@@ -59,6 +71,103 @@ ReceivedMessage::ReceivedMessage(QByteArray byteArray, PacketType packetType, Pa
     _senderSockAddr(senderSockAddr),
     _isComplete(true)
 {
+    appendSegment(bytesSegment(byteArray));
+}
+
+ReceivedMessage::Segment ReceivedMessage::bytesSegment(QByteArray bytes) {
+    Segment segment;
+    segment.data = bytes.constData();
+    segment.size = bytes.size();
+    segment.bytes = std::move(bytes);
+    return segment;
+}
+
+ReceivedMessage::Segment ReceivedMessage::packetSegment(std::unique_ptr<NLPacket> packet) {
+    // the message is the part of the payload that hasn't been read yet
+    Segment segment;
+    segment.data = packet->getPayload() + packet->pos();
+    segment.size = packet->bytesLeftToRead();
+    segment.packet = std::move(packet);
+    return segment;
+}
+
+void ReceivedMessage::appendSegment(Segment segment) {
+    std::lock_guard<std::mutex> lock(_segmentsMutex);
+    segment.offset = _size;
+    _size += segment.size;
+    _segments.push_back(std::move(segment));
+}
+
+std::unique_lock<std::mutex> ReceivedMessage::lockSegmentsIfIncomplete() const {
+    std::unique_lock<std::mutex> lock(_segmentsMutex, std::defer_lock);
+    if (!_isComplete) {
+        lock.lock();
+    }
+    return lock;
+}
+
+size_t ReceivedMessage::segmentIndexAt(qint64 position) const {
+    // the last segment starting at or before position
+    auto it = std::upper_bound(_segments.begin(), _segments.end(), position, [](qint64 position, const Segment& segment) {
+        return position < segment.offset;
+    });
+    return it == _segments.begin() ? 0 : (it - _segments.begin()) - 1;
+}
+
+qint64 ReceivedMessage::copyOut(qint64 position, char* data, qint64 size) const {
+    qint64 copied = 0;
+    for (auto i = segmentIndexAt(position); i < _segments.size() && copied < size; ++i) {
+        const auto& segment = _segments[i];
+        auto segmentPosition = position + copied - segment.offset;
+        auto count = std::min(size - copied, segment.size - segmentPosition);
+        if (count > 0) {
+            memcpy(data + copied, segment.data + segmentPosition, count);
+            copied += count;
+        }
+    }
+    return copied;
+}
+
+const char* ReceivedMessage::contiguousData(qint64 position, qint64 size) const {
+    {
+        auto lock = lockSegmentsIfIncomplete();
+        const auto& segment = _segments[segmentIndexAt(position)];
+        if (position + size <= segment.offset + segment.size) {
+            return segment.data + (position - segment.offset);
+        }
+    }
+
+    return flatten().constData() + position;
+}
+
+QByteArray ReceivedMessage::flatten() const {
+    std::lock_guard<std::mutex> lock(_segmentsMutex);
+
+    if (_flattenedSize < _size) {
+        if (_flattenedSize == 0 && _segments.size() == 1 && !_segments.front().packet) {
+            // already in one byte array, share it
+            _data = _segments.front().bytes;
+        } else {
+            _data.reserve(_size);
+            for (auto i = segmentIndexAt(_flattenedSize); i < _segments.size(); ++i) {
+                const auto& segment = _segments[i];
+                auto segmentPosition = std::max(_flattenedSize - segment.offset, (qint64)0);
+                _data.append(segment.data + segmentPosition, segment.size - segmentPosition);
+            }
+        }
+        _flattenedSize = _size;
+    }
+
+    return _data;
+}
+
+QByteArray ReceivedMessage::getMessage() const {
+    return flatten();
+}
+
+const char* ReceivedMessage::getRawMessage() const {
+    // _data keeps the flattened message alive after the copy returned here is gone
+    return flatten().constData();
 }
 
 void ReceivedMessage::setFailed() {
@@ -68,6 +177,19 @@ void ReceivedMessage::setFailed() {
 }
 
 void ReceivedMessage::appendPacket(NLPacket& packet) {
+    appendPacket(packet, bytesSegment(QByteArray(packet.getPayload(), packet.getPayloadSize())));
+}
+
+void ReceivedMessage::appendPacket(std::unique_ptr<NLPacket> packet) {
+    auto& packetRef = *packet;
+    Segment segment;
+    segment.data = packet->getPayload();
+    segment.size = packet->getPayloadSize();
+    segment.packet = std::move(packet);
+    appendPacket(packetRef, std::move(segment));
+}
+
+void ReceivedMessage::appendPacket(const NLPacket& packet, Segment segment) {
     Q_ASSERT_X(!_isComplete, "ReceivedMessage::appendPacket", 
                "We should not be appending to a complete message");
 
@@ -76,18 +198,19 @@ void ReceivedMessage::appendPacket(NLPacket& packet) {
 
     ++_numPackets;
 
-    _data.append(packet.getPayload(), packet.getPayloadSize());
-
-    if (_numPackets % EMIT_PROGRESS_EVERY_X_PACKETS == 0) {
-        emit progress(getSize());
-    }
-
     auto packetPosition = packet.getPacketPosition();
     if ((packetPosition == NLPacket::PacketPosition::FIRST) ||
         (packetPosition == NLPacket::PacketPosition::ONLY)) {
         _firstPacketReceiveTime = duration_cast<microseconds>(packet.getReceiveTime().time_since_epoch()).count();
     }
 
+    // the segment owns the packet from here on
+    appendSegment(std::move(segment));
+
+    if (_numPackets % EMIT_PROGRESS_EVERY_X_PACKETS == 0) {
+        emit progress(getSize());
+    }
+
     if (packetPosition == NLPacket::PacketPosition::LAST) {
         _isComplete = true;
         emit completed();
@@ -95,40 +218,56 @@ void ReceivedMessage::appendPacket(NLPacket& packet) {
 }
 
 qint64 ReceivedMessage::peek(char* data, qint64 size) {
-    size_t bytesLeft = _data.size() - _position;
-    size_t sizeRead = std::min((size_t)size, bytesLeft);
-    memcpy(data, _data.constData() + _position, sizeRead);
-    return sizeRead;
+    auto lock = lockSegmentsIfIncomplete();
+    qint64 bytesLeft = std::max(_size - _position, (qint64)0);
+    return copyOut(_position, data, std::min(size, bytesLeft));
 }
 
 qint64 ReceivedMessage::read(char* data, qint64 size) {
-    size_t bytesLeft = _data.size() - _position;
-    size_t sizeRead = std::min((size_t)size, bytesLeft);
-    memcpy(data, _data.constData() + _position, sizeRead);
+    auto sizeRead = peek(data, size);
     _position += sizeRead;
     return sizeRead;
 }
 
 qint64 ReceivedMessage::readHead(char* data, qint64 size) {
-    size_t bytesLeft = _headData.size() - _position;
-    size_t sizeRead = std::min((size_t)size, bytesLeft);
-    memcpy(data, _headData.constData() + _position, sizeRead);
+    auto lock = lockSegmentsIfIncomplete();
+    qint64 bytesLeft = std::max(std::min(_size.load(), (qint64)HEAD_DATA_SIZE) - _position, (qint64)0);
+    auto sizeRead = copyOut(_position, data, std::min(size, bytesLeft));
     _position += sizeRead;
     return sizeRead;
 }
 
 QByteArray ReceivedMessage::peek(qint64 size) {
-    return _data.mid(_position, size);
+    auto lock = lockSegmentsIfIncomplete();
+    qint64 bytesLeft = std::max(_size - _position, (qint64)0);
+    size = (size < 0) ? bytesLeft : std::min(size, bytesLeft);
+
+    const auto& segment = _segments[segmentIndexAt(_position)];
+    if (!segment.packet && _position == segment.offset && size == segment.size) {
+        // the whole of a byte array segment, share it
+        return segment.bytes;
+    }
+
+    QByteArray data(size, Qt::Uninitialized);
+    copyOut(_position, data.data(), size);
+    return data;
 }
 
 QByteArray ReceivedMessage::read(qint64 size) {
-    auto data = _data.mid(_position, size);
+    auto data = peek(size);
     _position += size;
     return data;
 }
 
 QByteArray ReceivedMessage::readHead(qint64 size) {
-    auto data = _headData.mid(_position, size);
+    QByteArray data;
+    {
+        auto lock = lockSegmentsIfIncomplete();
+        qint64 bytesLeft = std::max(std::min(_size.load(), (qint64)HEAD_DATA_SIZE) - _position, (qint64)0);
+        size = (size < 0) ? bytesLeft : size;
+        data.resize(std::min(size, bytesLeft));
+        copyOut(_position, data.data(), data.size());
+    }
     _position += size;
     return data;
 }
@@ -141,13 +280,15 @@ QString ReceivedMessage::readString() {
     uint32_t size;
     readPrimitive(&size);
     //Q_ASSERT(size <= _size - _position);
-    auto string = QString::fromUtf8(_data.constData() + _position, size);
+    qint64 sizeRead = std::min((qint64)size, std::max(_size - _position, (qint64)0));
+    auto string = QString::fromUtf8(contiguousData(_position, sizeRead), sizeRead);
     _position += size;
     return string;
 }
 
 QByteArray ReceivedMessage::readWithoutCopy(qint64 size) {
-    QByteArray data { QByteArray::fromRawData(_data.constData() + _position, size) };
+    qint64 sizeRead = std::min(size, std::max(_size - _position, (qint64)0));
+    QByteArray data { QByteArray::fromRawData(contiguousData(_position, sizeRead), sizeRead) };
     _position += size;
     return data;
 }
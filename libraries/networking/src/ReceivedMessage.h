@@ -18,19 +18,26 @@
 #include <QtCore/QSharedPointer>
 
 #include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "NLPacketList.h"
 
+// The payload of a message is kept as a list of segments - the packets it arrived in, or a single byte array - so that
+// assembling a multi-packet message doesn't copy it. Reads walk the segments; getMessage, getRawMessage and reads that
+// need contiguous memory spanning several segments flatten the message into one buffer the first time they need it.
 class ReceivedMessage : public QObject {
     Q_OBJECT
 public:
     ReceivedMessage(const NLPacketList& packetList);
     ReceivedMessage(NLPacket& packet);
+    ReceivedMessage(std::unique_ptr<NLPacket> packet);
     ReceivedMessage(QByteArray byteArray, PacketType packetType, PacketVersion packetVersion,
                     const SockAddr& senderSockAddr, NLPacket::LocalID sourceID = NLPacket::NULL_LOCAL_ID);
 
-    QByteArray getMessage() const { return _data; }
-    const char* getRawMessage() const { return _data.constData(); }
+    QByteArray getMessage() const;
+    const char* getRawMessage() const;
 
     PacketType getType() const { return _packetType; }
     PacketVersion getVersion() const { return _packetVersion; }
@@ -38,9 +45,12 @@ public:
     void setFailed();
 
     void appendPacket(NLPacket& packet);
+    void appendPacket(std::unique_ptr<NLPacket> packet);
 
     bool failed() const { return _failed; }
     bool isComplete() const { return _isComplete; }
+    // whether this came over the reliable protocol, which has already acknowledged it and won't send it again
+    bool isReliable() const { return _isReliable; }
 
     NLPacket::LocalID getSourceID() const { return _sourceID; }
     const SockAddr& getSenderSockAddr() { return _senderSockAddr; }
@@ -52,9 +62,9 @@ public:
 
     qint64 getFirstPacketReceiveTime() const { return _firstPacketReceiveTime; }
 
-    qint64 getSize() const { return _data.size(); }
+    qint64 getSize() const { return _size; }
 
-    qint64 getBytesLeftToRead() const { return _data.size() -  _position; }
+    qint64 getBytesLeftToRead() const { return _size -  _position; }
 
     void seek(qint64 position) { _position = position; }
 
@@ -76,6 +86,7 @@ public:
     // This will return a QByteArray referencing the underlying data _without_ refcounting that data.
     // Be careful when using this method, only use it when the lifetime of the returned QByteArray will not
     // exceed that of the ReceivedMessage.
+    // Reads within a single packet of the message reference that packet, reads spanning packets flatten the message.
     QByteArray readWithoutCopy(qint64 size);
 
     template<typename T> qint64 peekPrimitive(T* data);
@@ -91,8 +102,38 @@ private slots:
     void onComplete();
 
 private:
-    QByteArray _data;
-    QByteArray _headData;
+    struct Segment {
+        std::unique_ptr<NLPacket> packet;   // owns the data if the segment is a received packet
+        QByteArray bytes;                   // owns the data otherwise
+        const char* data { nullptr };
+        qint64 size { 0 };
+        qint64 offset { 0 };                // of the segment's first byte in the message
+    };
+
+    static Segment bytesSegment(QByteArray bytes);
+    static Segment packetSegment(std::unique_ptr<NLPacket> packet);
+    void appendSegment(Segment segment);
+    void appendPacket(const NLPacket& packet, Segment segment);
+
+    // segments only change until the message is complete, so until then they are read under _segmentsMutex
+    std::unique_lock<std::mutex> lockSegmentsIfIncomplete() const;
+
+    // returns the index of the segment holding the byte at position (or the last segment, past the end)
+    size_t segmentIndexAt(qint64 position) const;
+    qint64 copyOut(qint64 position, char* data, qint64 size) const;
+
+    // returns a pointer to size contiguous bytes at position, flattening the message if they span segments
+    const char* contiguousData(qint64 position, qint64 size) const;
+    // returns the whole message in one buffer, flattening what has arrived since the last call
+    QByteArray flatten() const;
+
+    mutable std::mutex _segmentsMutex;
+    std::vector<Segment> _segments;
+    std::atomic<qint64> _size { 0 };
+
+    // the message flattened into one buffer, up to _flattenedSize
+    mutable QByteArray _data;
+    mutable qint64 _flattenedSize { 0 };
 
     std::atomic<qint64> _position { 0 };
     std::atomic<qint64> _numPackets { 0 };
@@ -103,6 +144,7 @@ private:
     PacketVersion _packetVersion;
     SockAddr _senderSockAddr;
 
+    bool _isReliable { false };
     std::atomic<bool> _isComplete { true };  
     std::atomic<bool> _failed { false };
 };
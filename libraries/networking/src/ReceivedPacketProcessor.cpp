@@ -11,12 +11,18 @@
 
 #include "ReceivedPacketProcessor.h"
 
+#include <algorithm>
+
+#include <QtCore/QThread>
+
 #include <NumericalConstants.h>
 
 #include "NodeList.h"
 #include "SharedUtil.h"
 
-ReceivedPacketProcessor::ReceivedPacketProcessor() {
+ReceivedPacketProcessor::ReceivedPacketProcessor(size_t queueCapacity) :
+    _packets(queueCapacity)
+{
     _lastWindowAt = usecTimestampNow();
 }
 
@@ -25,15 +31,59 @@ void ReceivedPacketProcessor::terminating() {
     _hasPackets.wakeAll();
 }
 
-void ReceivedPacketProcessor::queueReceivedPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode) {
-    lock();
-    _packets.push_back({ sendingNode, message });
-    _nodePacketCounts[sendingNode->getUUID()]++;
+ReceivedPacketProcessor::NodeQueuePointer ReceivedPacketProcessor::getNodeQueue(const QUuid& nodeUUID) {
+    QReadLocker locker(&_nodeQueuesLock);
+    auto it = _nodeQueues.find(nodeUUID);
+    if (it != _nodeQueues.end()) {
+        return it->second;
+    }
+    // if another thread inserted this node first, insert returns its queue
+    return _nodeQueues.insert({ nodeUUID, std::make_shared<NodeQueue>() }).first->second;
+}
+
+bool ReceivedPacketProcessor::queueReceivedPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode) {
+    auto nodeQueue = getNodeQueue(sendingNode->getUUID());
     _lastWindowIncomingPackets++;
-    unlock();
+
+    auto drop = [&] {
+        nodeQueue->dropped++;
+        _droppedPackets++;
+        return false;
+    };
+
+    bool isReliable = message->isReliable();
+    size_t capacity = _packets.capacity();
+    if (!isReliable && _packets.size() > capacity / 2) {
+        int fairShare = (int)(capacity / std::max(_numQueuingNodes.load(), 1));
+        if (nodeQueue->queued >= fairShare) {
+            return drop();
+        }
+    }
+
+    if (nodeQueue->queued++ == 0) {
+        _numQueuingNodes++;
+    }
+
+    QueuedPacket queuedPacket { { sendingNode, message }, nodeQueue };
+    while (!_packets.push(std::move(queuedPacket))) {
+        if (!isReliable || !isStillRunning()) {
+            if (--nodeQueue->queued == 0) {
+                _numQueuingNodes--;
+            }
+            return drop();
+        }
+        // a reliable packet can't be dropped, so wait for the processor thread to make room
+        QThread::yieldCurrentThread();
+    }
 
     // Make sure to wake our actual processing thread because we now have packets for it to process.
-    _hasPackets.wakeAll();
+    // It only needs waking if it is waiting; the fences make sure it either sees the packet or we see it waiting.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_isWaitingOnPackets) {
+        QMutexLocker locker(&_waitingOnPacketsMutex);
+        _hasPackets.wakeAll();
+    }
+    return true;
 }
 
 bool ReceivedPacketProcessor::process() {
@@ -41,54 +91,62 @@ bool ReceivedPacketProcessor::process() {
     quint64 sinceLastWindow = now - _lastWindowAt;
 
     if (sinceLastWindow > USECS_PER_SECOND) {
-        lock();
         float secondsSinceLastWindow = sinceLastWindow / USECS_PER_SECOND;
-        float incomingPacketsPerSecondInWindow = (float)_lastWindowIncomingPackets / secondsSinceLastWindow;
+        float incomingPacketsPerSecondInWindow = (float)_lastWindowIncomingPackets.exchange(0) / secondsSinceLastWindow;
         _incomingPPS.updateAverage(incomingPacketsPerSecondInWindow);
 
         float processedPacketsPerSecondInWindow = (float)_lastWindowProcessedPackets / secondsSinceLastWindow;
         _processedPPS.updateAverage(processedPacketsPerSecondInWindow);
 
         _lastWindowAt = now;
-        _lastWindowIncomingPackets = 0;
         _lastWindowProcessedPackets = 0;
-        unlock();
     }
 
-    if (_packets.size() == 0) {
+    if (_packets.empty()) {
         _waitingOnPacketsMutex.lock();
-        _hasPackets.wait(&_waitingOnPacketsMutex, getMaxWait());
+        _isWaitingOnPackets = true;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_packets.empty()) {
+            _hasPackets.wait(&_waitingOnPacketsMutex, getMaxWait());
+        }
+        _isWaitingOnPackets = false;
         _waitingOnPacketsMutex.unlock();
     }
 
     preProcess();
-    if (!_packets.size()) {
+    if (_packets.empty()) {
         return isStillRunning();
     }
 
-    lock();
-    std::list<NodeSharedReceivedMessagePair> currentPackets;
-    currentPackets.swap(_packets);
-    unlock();
-
-    for(auto& packetPair : currentPackets) {
-        processPacket(packetPair.second, packetPair.first);
-        _lastWindowProcessedPackets++;
-        midProcess();
+    _packets.popBatch(_queuedBatch, _packets.capacity());
+    _currentPackets.reserve(_queuedBatch.size());
+    for (auto& queuedPacket : _queuedBatch) {
+        _currentPackets.push_back(queuedPacket.packet);
     }
 
-    lock();
-    for(auto& packetPair : currentPackets) {
-        _nodePacketCounts[packetPair.first->getUUID()]--;
+    processPackets(_currentPackets);
+
+    for (auto& queuedPacket : _queuedBatch) {
+        if (--queuedPacket.nodeQueue->queued == 0) {
+            _numQueuingNodes--;
+        }
     }
-    unlock();
+    _queuedBatch.clear();
+    _currentPackets.clear();
 
     postProcess();
     return isStillRunning();  // keep running till they terminate us
 }
 
+void ReceivedPacketProcessor::processPackets(std::vector<NodeSharedReceivedMessagePair>& packets) {
+    for(auto& packetPair : packets) {
+        processPacket(packetPair.second, packetPair.first);
+        _lastWindowProcessedPackets++;
+        midProcess();
+    }
+}
+
 void ReceivedPacketProcessor::nodeKilled(SharedNodePointer node) {
-    lock();
-    _nodePacketCounts.remove(node->getUUID());
-    unlock();
+    QWriteLocker locker(&_nodeQueuesLock);
+    _nodeQueues.unsafe_erase(node->getUUID());
 }
@@ -12,9 +12,18 @@
 #ifndef hifi_ReceivedPacketProcessor_h
 #define hifi_ReceivedPacketProcessor_h
 
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <QtCore/QReadWriteLock>
 #include <QtCore/QSharedPointer>
 #include <QWaitCondition>
 
+#include <MPSCRingBuffer.h>
+#include <TBBHelpers.h>
+#include <UUIDHasher.h>
+
 #include "NodeList.h"
 
 #include "GenericThread.h"
@@ -22,22 +31,30 @@
 class ReceivedMessage;
 
 /// Generalized threaded processor for handling received inbound packets.
+///
+/// Packets are queued from the network threads into a bounded lock-free ring, and taken off it in batches by the
+/// processor thread. When the ring is more than half full, an unreliable packet from a node that already has more
+/// than its share of the ring queued is dropped, so that one node flooding us can't hold up everyone else's packets.
+/// Reliable packets have already been acknowledged and are never dropped.
 class ReceivedPacketProcessor : public GenericThread {
     Q_OBJECT
 public:
     static const uint64_t MAX_WAIT_TIME { 100 }; // Max wait time in ms
+    static const size_t DEFAULT_QUEUE_CAPACITY { 4096 }; // packets
 
-    ReceivedPacketProcessor();
+    ReceivedPacketProcessor(size_t queueCapacity = DEFAULT_QUEUE_CAPACITY);
 
     /// Add packet from network receive thread to the processing queue.
-    void queueReceivedPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode);
+    /// Returns false if the packet was dropped.
+    bool queueReceivedPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode);
 
     /// Are there received packets waiting to be processed
-    bool hasPacketsToProcess() const { return _packets.size() > 0; }
+    bool hasPacketsToProcess() const { return !_packets.empty(); }
 
     /// Is a specified node still alive?
     bool isAlive(const QUuid& nodeUUID) const {
-        return _nodePacketCounts.contains(nodeUUID);
+        QReadLocker locker(&_nodeQueuesLock);
+        return _nodeQueues.find(nodeUUID) != _nodeQueues.end();
     }
 
     /// Are there received packets waiting to be processed from a specified node
@@ -47,11 +64,22 @@ public:
 
     /// Are there received packets waiting to be processed from a specified node
     bool hasPacketsToProcessFrom(const QUuid& nodeUUID) const {
-        return _nodePacketCounts[nodeUUID] > 0;
+        QReadLocker locker(&_nodeQueuesLock);
+        auto it = _nodeQueues.find(nodeUUID);
+        return it != _nodeQueues.end() && it->second->queued > 0;
     }
 
     /// How many received packets waiting are to be processed
     int packetsToProcessCount() const { return (int)_packets.size(); }
+    int getQueueCapacity() const { return (int)_packets.capacity(); }
+
+    /// How many packets have been dropped, in total and from a specified node
+    uint64_t getDroppedPacketCount() const { return _droppedPackets; }
+    uint64_t getDroppedPacketCountFrom(const QUuid& nodeUUID) const {
+        QReadLocker locker(&_nodeQueuesLock);
+        auto it = _nodeQueues.find(nodeUUID);
+        return it != _nodeQueues.end() ? (uint64_t)it->second->dropped : 0;
+    }
 
     float getIncomingPPS() const { return _incomingPPS.getAverage(); }
     float getProcessedPPS() const { return _processedPPS.getAverage(); }
@@ -67,6 +95,10 @@ protected:
     /// \param QByteArray& the packet to be processed
     virtual void processPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode) = 0;
 
+    /// Processes the packets taken off the queue together, in the order they were received. The default calls
+    /// processPacket() and midProcess() for each of them; override to work on several packets at a time.
+    virtual void processPackets(std::vector<NodeSharedReceivedMessagePair>& packets);
+
     /// Implements generic processing behavior for this thread.
     virtual bool process() override;
 
@@ -83,14 +115,37 @@ protected:
     virtual void postProcess() { }
 
 protected:
-    std::list<NodeSharedReceivedMessagePair> _packets;
-    QHash<QUuid, int> _nodePacketCounts;
+    struct NodeQueue {
+        std::atomic<int> queued { 0 };
+        std::atomic<uint64_t> dropped { 0 };
+    };
+    using NodeQueuePointer = std::shared_ptr<NodeQueue>;
+
+    struct QueuedPacket {
+        NodeSharedReceivedMessagePair packet;
+        NodeQueuePointer nodeQueue;
+    };
+
+    NodeQueuePointer getNodeQueue(const QUuid& nodeUUID);
+
+    MPSCRingBuffer<QueuedPacket> _packets;
+
+    // inserted into under a read lock, like LimitedNodeList's node hash, and only erased from under the write lock
+    tbb::concurrent_unordered_map<QUuid, NodeQueuePointer, UUIDHasher> _nodeQueues;
+    mutable QReadWriteLock _nodeQueuesLock;
+    std::atomic<int> _numQueuingNodes { 0 }; // nodes with packets in the ring
+    std::atomic<uint64_t> _droppedPackets { 0 };
+
+    // reused by the processor thread from one batch to the next
+    std::vector<QueuedPacket> _queuedBatch;
+    std::vector<NodeSharedReceivedMessagePair> _currentPackets;
 
     QWaitCondition _hasPackets;
     QMutex _waitingOnPacketsMutex;
+    std::atomic<bool> _isWaitingOnPackets { false };
 
     quint64 _lastWindowAt = 0;
-    int _lastWindowIncomingPackets = 0;
+    std::atomic<int> _lastWindowIncomingPackets { 0 };
     int _lastWindowProcessedPackets = 0;
     SimpleMovingAverage _incomingPPS;
     SimpleMovingAverage _processedPPS;
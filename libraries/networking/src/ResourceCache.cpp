@@ -12,14 +12,17 @@
 #include "ResourceCache.h"
 #include "ResourceRequestObserver.h"
 
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
+#include <vector>
 #include <assert.h>
 
 #include <QtCore/QMetaMethod>
 #include <QtCore/QThread>
 #include <QtCore/QTimer>
 
+#include <MemoryAccounting.h>
 #include <SharedUtil.h>
 #include <shared/QtHelpers.h>
 #include <Trace.h>
@@ -29,10 +32,28 @@
 #include "NetworkLogging.h"
 #include "NodeList.h"
 
+QString ResourceCacheSharedItems::getLimitedHost(const Resource& resource) {
+    auto url = resource.getURL();
+    if (url.scheme() == HIFI_URL_SCHEME_HTTP || url.scheme() == HIFI_URL_SCHEME_HTTPS) {
+        return url.host().toLower();
+    }
+    return QString();
+}
+
+bool ResourceCacheSharedItems::isHostAtLimit(const QString& host,
+                                             const QHash<QString, uint32_t>& loadingRequestsPerHost) const {
+    return _requestLimitPerHost > 0 && !host.isEmpty() && loadingRequestsPerHost.value(host) >= _requestLimitPerHost;
+}
+
 bool ResourceCacheSharedItems::appendRequest(QWeakPointer<Resource> resource) {
     Lock lock(_mutex);
-    if ((uint32_t)_loadingRequests.size() < _requestLimit) {
-        _loadingRequests.append(resource);
+    auto strongResource = resource.lock();
+    QString host = strongResource ? getLimitedHost(*strongResource) : QString();
+    if ((uint32_t)_loadingRequests.size() < _requestLimit && !isHostAtLimit(host, _loadingRequestsPerHost)) {
+        _loadingRequests.append({ resource, host });
+        if (!host.isEmpty()) {
+            ++_loadingRequestsPerHost[host];
+        }
         return true;
     } else {
         _pendingRequests.append(resource);
@@ -50,6 +71,16 @@ uint32_t ResourceCacheSharedItems::getRequestLimit() const {
     return _requestLimit;
 }
 
+void ResourceCacheSharedItems::setRequestLimitPerHost(uint32_t limit) {
+    Lock lock(_mutex);
+    _requestLimitPerHost = limit;
+}
+
+uint32_t ResourceCacheSharedItems::getRequestLimitPerHost() const {
+    Lock lock(_mutex);
+    return _requestLimitPerHost;
+}
+
 QList<QSharedPointer<Resource>> ResourceCacheSharedItems::getPendingRequests() const {
     QList<QSharedPointer<Resource>> result;
     Lock lock(_mutex);
@@ -73,8 +104,8 @@ QList<QSharedPointer<Resource>> ResourceCacheSharedItems::getLoadingRequests() c
     QList<QSharedPointer<Resource>> result;
     Lock lock(_mutex);
 
-    foreach(QWeakPointer<Resource> resource, _loadingRequests) {
-        auto locked = resource.lock();
+    foreach(const LoadingRequest& request, _loadingRequests) {
+        auto locked = request.resource.lock();
         if (locked) {
             result.append(locked);
         }
@@ -95,9 +126,15 @@ void ResourceCacheSharedItems::removeRequest(QWeakPointer<Resource> resource) {
     // QWeakPointer has no operator== implementation for two weak ptrs, so
     // manually loop in case resource has been freed.
     for (int i = 0; i < _loadingRequests.size();) {
-        auto request = _loadingRequests.at(i);
+        const auto& request = _loadingRequests.at(i);
         // Clear our resource and any freed resources
-        if (!request || request.data() == resource.data()) {
+        if (!request.resource || request.resource.data() == resource.data()) {
+            if (!request.host.isEmpty()) {
+                auto it = _loadingRequestsPerHost.find(request.host);
+                if (it != _loadingRequestsPerHost.end() && --it.value() == 0) {
+                    _loadingRequestsPerHost.erase(it);
+                }
+            }
             _loadingRequests.removeAt(i);
             continue;
         }
@@ -122,6 +159,12 @@ QSharedPointer<Resource> ResourceCacheSharedItems::getHighestPendingRequest() {
             continue;
         }
 
+        // Skip requests that would have to wait for their host anyway
+        if (isHostAtLimit(getLimitedHost(*resource), _loadingRequestsPerHost)) {
+            i++;
+            continue;
+        }
+
         // Check load priority
         float priority = resource->getLoadPriority();
         bool isFile = resource->getURL().scheme() == HIFI_URL_SCHEME_FILE;
@@ -141,12 +184,88 @@ QSharedPointer<Resource> ResourceCacheSharedItems::getHighestPendingRequest() {
     return highestResource;
 }
 
+QList<QSharedPointer<Resource>> ResourceCacheSharedItems::takeHighestPendingRequests() {
+    QList<QSharedPointer<Resource>> result;
+    Lock lock(_mutex);
+
+    if ((uint32_t)_loadingRequests.size() >= _requestLimit || _pendingRequests.empty()) {
+        return result;
+    }
+    uint32_t numFreeRequests = _requestLimit - (uint32_t)_loadingRequests.size();
+
+    struct Candidate {
+        bool isFile;
+        float priority;
+        int index;
+        QSharedPointer<Resource> resource;
+        QString host;
+    };
+
+    // The priorities are only worked out once for all of the free spots, rather than by scanning all pending requests
+    // for each of them. Files go first, then the highest priority, then the most recently requested.
+    std::vector<Candidate> candidates;
+    candidates.reserve(_pendingRequests.size());
+    QList<QWeakPointer<Resource>> pendingRequests;
+    pendingRequests.reserve(_pendingRequests.size());
+    for (const auto& request : _pendingRequests) {
+        // Clear any freed resources
+        auto resource = request.lock();
+        if (!resource) {
+            continue;
+        }
+        bool isFile = resource->getURL().scheme() == HIFI_URL_SCHEME_FILE;
+        candidates.push_back({ isFile, resource->getLoadPriority(), pendingRequests.size(), resource,
+                               getLimitedHost(*resource) });
+        pendingRequests.append(request);
+    }
+
+    auto isLowerPriority = [](const Candidate& a, const Candidate& b) {
+        if (a.isFile != b.isFile) {
+            return b.isFile;
+        }
+        if (a.priority != b.priority) {
+            return a.priority < b.priority;
+        }
+        return a.index < b.index;
+    };
+    std::make_heap(candidates.begin(), candidates.end(), isLowerPriority);
+
+    auto loadingRequestsPerHost = _loadingRequestsPerHost;
+    std::vector<bool> taken(pendingRequests.size(), false);
+    while (!candidates.empty() && (uint32_t)result.size() < numFreeRequests) {
+        std::pop_heap(candidates.begin(), candidates.end(), isLowerPriority);
+        auto& candidate = candidates.back();
+        if (!isHostAtLimit(candidate.host, loadingRequestsPerHost)) {
+            if (!candidate.host.isEmpty()) {
+                ++loadingRequestsPerHost[candidate.host];
+            }
+            taken[candidate.index] = true;
+            result.append(candidate.resource);
+        }
+        candidates.pop_back();
+    }
+
+    _pendingRequests.clear();
+    for (int i = 0; i < pendingRequests.size(); ++i) {
+        if (!taken[i]) {
+            _pendingRequests.append(pendingRequests.at(i));
+        }
+    }
+
+    return result;
+}
+
 void ResourceCacheSharedItems::clear() {
     Lock lock(_mutex);
     _pendingRequests.clear();
     _loadingRequests.clear();
 }
 
+void ResourceCacheSharedItems::resourceEvicted(qint64 bytes) {
+    ++_numEvictedResources;
+    _evictedResourcesSize += bytes;
+}
+
 ScriptableResourceCache::ScriptableResourceCache(QSharedPointer<ResourceCache> resourceCache) {
     _resourceCache = resourceCache;
     connect(&(*_resourceCache), &ResourceCache::dirty,
@@ -268,28 +387,34 @@ ResourceCache::~ResourceCache() {
 void ResourceCache::clearATPAssets() {
     {
         QWriteLocker locker(&_resourcesLock);
-        QList<QUrl> urls = _resources.keys();
+        auto urls = _resources.keys();
         for (auto& url : urls) {
             // If this is an ATP resource
-            if (url.scheme() == URL_SCHEME_ATP) {
+            if (url.url.scheme() == URL_SCHEME_ATP) {
                 auto resourcesWithExtraHash = _resources.take(url);
                 for (auto& resource : resourcesWithExtraHash) {
                     if (auto strongRef = resource.lock()) {
                         // Make sure the resource won't reinsert itself
                         strongRef->setCache(nullptr);
                         _totalResourcesSize -= strongRef->getBytes();
+                        MemoryAccounting::remove(MemoryAccounting::Resources, strongRef->getBytes());
                     }
                 }
             }
         }
     }
     {
-        QWriteLocker locker(&_unusedResourcesLock);
-        for (auto& resource : _unusedResources.values()) {
-            if (resource->getURL().scheme() == URL_SCHEME_ATP) {
-                _unusedResources.remove(resource->getLRUKey());
-                _unusedResourcesSize -= resource->getBytes();
+        // declared ahead of the lock, so that the removed resources are released after it
+        UnusedResources removedResources;
+        UnusedResourcesLock lock(_unusedResourcesMutex);
+        for (auto it = _unusedResources.begin(); it != _unusedResources.end();) {
+            auto next = std::next(it);
+            if ((*it)->getURL().scheme() == URL_SCHEME_ATP) {
+                (*it)->_isUnused = false;
+                _unusedResourcesSize -= (*it)->getBytes();
+                removedResources.splice(removedResources.end(), _unusedResources, it);
             }
+            it = next;
         }
     }
 
@@ -301,7 +426,7 @@ void ResourceCache::refreshAll() {
     clearUnusedResources();
     resetUnusedResourceCounter();
 
-    QHash<QUrl, QMultiHash<size_t, QWeakPointer<Resource>>> allResources;
+    Resources allResources;
     {
         QReadLocker locker(&_resourcesLock);
         allResources = _resources;
@@ -326,14 +451,14 @@ QVariantList ResourceCache::getResourceList() {
         BLOCKING_INVOKE_METHOD(this, "getResourceList",
             Q_RETURN_ARG(QVariantList, list));
     } else {
-        QList<QUrl> resources;
+        QList<URLKey> resources;
         {
             QReadLocker locker(&_resourcesLock);
             resources = _resources.keys();
         }
         list.reserve(resources.size());
         for (auto& resource : resources) {
-            list << resource;
+            list << resource.url;
         }
     }
 
@@ -345,16 +470,22 @@ void ResourceCache::setRequestLimit(uint32_t limit) {
     sharedItems->setRequestLimit(limit);
 
     // Now go fill any new request spots
-    while (sharedItems->getLoadingRequestsCount() < limit && sharedItems->getPendingRequestsCount() > 0) {
-        attemptHighestPriorityRequest();
-    }
+    attemptHighestPriorityRequests();
+}
+
+void ResourceCache::setRequestLimitPerHost(uint32_t limit) {
+    DependencyManager::get<ResourceCacheSharedItems>()->setRequestLimitPerHost(limit);
+
+    // Raising the limit can let waiting requests start
+    attemptHighestPriorityRequests();
 }
 
 QSharedPointer<Resource> ResourceCache::getResource(const QUrl& url, const QUrl& fallback, void* extra, size_t extraHash) {
     QSharedPointer<Resource> resource;
+    URLKey urlKey(url);
     {
         QWriteLocker locker(&_resourcesLock);
-        auto& resourcesWithExtraHash = _resources[url];
+        auto& resourcesWithExtraHash = _resources[urlKey];
         auto resourcesWithExtraHashIter = resourcesWithExtraHash.find(extraHash);
         if (resourcesWithExtraHashIter != resourcesWithExtraHash.end()) {
             // We've seen this extra info before
@@ -393,7 +524,7 @@ QSharedPointer<Resource> ResourceCache::getResource(const QUrl& url, const QUrl&
         connect(resource.data(), &Resource::updateSize, this, &ResourceCache::updateTotalSize);
         {
             QWriteLocker locker(&_resourcesLock);
-            _resources[url].insert(extraHash, resource);
+            _resources[urlKey].insert(extraHash, resource);
         }
         removeUnusedResource(resource);
         resource->ensureLoading();
@@ -419,56 +550,70 @@ void ResourceCache::addUnusedResource(const QSharedPointer<Resource>& resource)
     }
     reserveUnusedResource(resource->getBytes());
 
-    resource->setLRUKey(++_lastLRUKey);
-
     {
-        QWriteLocker locker(&_unusedResourcesLock);
-        _unusedResources.insert(resource->getLRUKey(), resource);
-        _unusedResourcesSize += resource->getBytes();
+        UnusedResourcesLock lock(_unusedResourcesMutex);
+        if (!resource->_isUnused) {
+            resource->_unusedResourcesPosition = _unusedResources.insert(_unusedResources.end(), resource);
+            resource->_isUnused = true;
+            _unusedResourcesSize += resource->getBytes();
+        }
     }
 
     resetUnusedResourceCounter();
 }
 
 void ResourceCache::removeUnusedResource(const QSharedPointer<Resource>& resource) {
-    QWriteLocker locker(&_unusedResourcesLock);
-    if (_unusedResources.contains(resource->getLRUKey())) {
-        _unusedResources.remove(resource->getLRUKey());
+    {
+        // the caller holds on to the resource, so it isn't released here
+        UnusedResourcesLock lock(_unusedResourcesMutex);
+        if (!resource->_isUnused) {
+            return;
+        }
+        _unusedResources.erase(resource->_unusedResourcesPosition);
+        resource->_isUnused = false;
         _unusedResourcesSize -= resource->getBytes();
-
-        locker.unlock();
-        resetUnusedResourceCounter();
     }
+
+    DependencyManager::get<ResourceCacheSharedItems>()->unusedResourceReused();
+    resetUnusedResourceCounter();
 }
 
 void ResourceCache::reserveUnusedResource(qint64 resourceSize) {
-    QWriteLocker locker(&_unusedResourcesLock);
+    UnusedResourcesLock lock(_unusedResourcesMutex);
     while (!_unusedResources.empty() &&
            _unusedResourcesSize + resourceSize > _unusedResourcesMaxSize) {
         // unload the oldest resource
-        QMap<int, QSharedPointer<Resource> >::iterator it = _unusedResources.begin();
-
-        it.value()->setCache(nullptr);
-        auto size = it.value()->getBytes();
-
-        locker.unlock();
-        removeResource(it.value()->getURL(), it.value()->getExtraHash(), size);
-        locker.relock();
-
+        auto resource = std::move(_unusedResources.front());
+        _unusedResources.pop_front();
+        resource->_isUnused = false;
+        resource->setCache(nullptr);
+        auto size = resource->getBytes();
         _unusedResourcesSize -= size;
-        _unusedResources.erase(it);
+
+        lock.unlock();
+        removeResource(resource->getURL(), resource->getExtraHash(), size);
+        DependencyManager::get<ResourceCacheSharedItems>()->resourceEvicted(size);
+        resource.reset();
+        lock.lock();
     }
 }
 
 void ResourceCache::clearUnusedResources() {
     // the unused resources may themselves reference resources that will be added to the unused
     // list on destruction, so keep clearing until there are no references left
-    QWriteLocker locker(&_unusedResourcesLock);
-    while (!_unusedResources.isEmpty()) {
-        foreach (const QSharedPointer<Resource>& resource, _unusedResources) {
+    UnusedResourcesLock lock(_unusedResourcesMutex);
+    while (!_unusedResources.empty()) {
+        UnusedResources resources;
+        resources.swap(_unusedResources);
+        for (auto& resource : resources) {
+            resource->_isUnused = false;
             resource->setCache(nullptr);
         }
-        _unusedResources.clear();
+        _unusedResourcesSize = 0;
+
+        lock.unlock();
+        resources.clear();
+        lock.lock();
     }
     _unusedResourcesSize = 0;
 }
@@ -484,7 +629,7 @@ void ResourceCache::resetTotalResourceCounter() {
 
 void ResourceCache::resetUnusedResourceCounter() {
     {
-        QReadLocker locker(&_unusedResourcesLock);
+        UnusedResourcesLock lock(_unusedResourcesMutex);
         _numUnusedResources = _unusedResources.size();
     }
 
@@ -499,17 +644,20 @@ void ResourceCache::resetResourceCounters() {
 }
 
 void ResourceCache::removeResource(const QUrl& url, size_t extraHash, qint64 size) {
+    URLKey urlKey(url);
     QWriteLocker locker(&_resourcesLock);
-    auto& resources = _resources[url];
+    auto& resources = _resources[urlKey];
     resources.remove(extraHash);
     if (resources.size() == 0) {
-        _resources.remove(url);
+        _resources.remove(urlKey);
     }
     _totalResourcesSize -= size;
+    MemoryAccounting::remove(MemoryAccounting::Resources, size);
 }
 
 void ResourceCache::updateTotalSize(const qint64& deltaSize) {
     _totalResourcesSize += deltaSize;
+    MemoryAccounting::update(MemoryAccounting::Resources, 0, deltaSize);
 
     // Sanity checks
     assert(_totalResourcesSize >= 0);
@@ -530,6 +678,18 @@ uint32_t ResourceCache::getLoadingRequestCount() {
     return DependencyManager::get<ResourceCacheSharedItems>()->getLoadingRequestsCount();
 }
 
+uint64_t ResourceCache::getNumEvictedResources() {
+    return DependencyManager::get<ResourceCacheSharedItems>()->getNumEvictedResources();
+}
+
+uint64_t ResourceCache::getEvictedResourcesSize() {
+    return DependencyManager::get<ResourceCacheSharedItems>()->getEvictedResourcesSize();
+}
+
+uint64_t ResourceCache::getNumReusedResources() {
+    return DependencyManager::get<ResourceCacheSharedItems>()->getNumReusedResources();
+}
+
 bool ResourceCache::attemptRequest(QSharedPointer<Resource> resource) {
     Q_ASSERT(!resource.isNull());
 
@@ -547,9 +707,7 @@ void ResourceCache::requestCompleted(QWeakPointer<Resource> resource) {
     sharedItems->removeRequest(resource);
 
     // Now go fill any new request spots
-    while (sharedItems->getLoadingRequestsCount() < sharedItems->getRequestLimit() && sharedItems->getPendingRequestsCount() > 0) {
-        attemptHighestPriorityRequest();
-    }
+    attemptHighestPriorityRequests();
 }
 
 bool ResourceCache::attemptHighestPriorityRequest() {
@@ -558,6 +716,13 @@ bool ResourceCache::attemptHighestPriorityRequest() {
     return (resource && attemptRequest(resource));
 }
 
+void ResourceCache::attemptHighestPriorityRequests() {
+    auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+    for (auto& resource : sharedItems->takeHighestPendingRequests()) {
+        attemptRequest(resource);
+    }
+}
+
 static int requestID = 0;
 
 Resource::Resource(const Resource& other) :
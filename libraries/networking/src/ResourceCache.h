@@ -13,6 +13,7 @@
 #define hifi_ResourceCache_h
 
 #include <atomic>
+#include <list>
 #include <mutex>
 
 #include <QtCore/QHash>
@@ -66,25 +67,60 @@ class ResourceCacheSharedItems : public Dependency  {
     using Lock = std::unique_lock<Mutex>;
 
 public:
+    static const uint32_t DEFAULT_REQUEST_LIMIT_PER_HOST = 6;
+
     bool appendRequest(QWeakPointer<Resource> newRequest);
     void removeRequest(QWeakPointer<Resource> doneRequest);
     void setRequestLimit(uint32_t limit);
     uint32_t getRequestLimit() const;
+
+    // The most requests that can be loading at once from each HTTP host, so that one slow host can't take up all of the
+    // requests. 0 for no limit.
+    void setRequestLimitPerHost(uint32_t limit);
+    uint32_t getRequestLimitPerHost() const;
+
     QList<QSharedPointer<Resource>> getPendingRequests() const;
     QSharedPointer<Resource> getHighestPendingRequest();
+
+    // Takes up to as many of the highest priority pending requests as there are free request spots, skipping those
+    // whose host is at its limit
+    QList<QSharedPointer<Resource>> takeHighestPendingRequests();
     uint32_t getPendingRequestsCount() const;
     QList<QSharedPointer<Resource>> getLoadingRequests() const;
     uint32_t getLoadingRequestsCount() const;
     void clear();
 
+    // Unused resources that were taken out of a cache to make room for others, across all caches
+    void resourceEvicted(qint64 bytes);
+    uint64_t getNumEvictedResources() const { return _numEvictedResources; }
+    uint64_t getEvictedResourcesSize() const { return _evictedResourcesSize; }
+
+    // Unused resources that were used again before being evicted, across all caches
+    void unusedResourceReused() { ++_numReusedResources; }
+    uint64_t getNumReusedResources() const { return _numReusedResources; }
+
 private:
     ResourceCacheSharedItems() = default;
 
+    std::atomic<uint64_t> _numEvictedResources { 0 };
+    std::atomic<uint64_t> _evictedResourcesSize { 0 };
+    std::atomic<uint64_t> _numReusedResources { 0 };
+
+    struct LoadingRequest {
+        QWeakPointer<Resource> resource;
+        QString host; // empty if requests to it aren't limited
+    };
+
+    static QString getLimitedHost(const Resource& resource);
+    bool isHostAtLimit(const QString& host, const QHash<QString, uint32_t>& loadingRequestsPerHost) const;
+
     mutable Mutex _mutex;
     QList<QWeakPointer<Resource>> _pendingRequests;
-    QList<QWeakPointer<Resource>> _loadingRequests;
+    QList<LoadingRequest> _loadingRequests;
+    QHash<QString, uint32_t> _loadingRequestsPerHost;
     const uint32_t DEFAULT_REQUEST_LIMIT = 10;
     uint32_t _requestLimit { DEFAULT_REQUEST_LIMIT };
+    uint32_t _requestLimitPerHost { DEFAULT_REQUEST_LIMIT_PER_HOST };
 };
 
 /// Wrapper to expose resources to JS/QML
@@ -213,6 +249,11 @@ public:
     static void setRequestLimit(uint32_t limit);
     static uint32_t getRequestLimit() { return DependencyManager::get<ResourceCacheSharedItems>()->getRequestLimit(); }
 
+    static void setRequestLimitPerHost(uint32_t limit);
+    static uint32_t getRequestLimitPerHost() {
+        return DependencyManager::get<ResourceCacheSharedItems>()->getRequestLimitPerHost();
+    }
+
     void setUnusedResourceCacheSize(qint64 unusedResourcesMaxSize);
     qint64 getUnusedResourceCacheSize() const { return _unusedResourcesMaxSize; }
 
@@ -220,6 +261,10 @@ public:
     static uint32_t getPendingRequestCount();
     static uint32_t getLoadingRequestCount();
 
+    static uint64_t getNumEvictedResources();
+    static uint64_t getEvictedResourcesSize();
+    static uint64_t getNumReusedResources();
+
     ResourceCache(QObject* parent = nullptr);
     virtual ~ResourceCache();
 
@@ -271,6 +316,7 @@ protected:
     static bool attemptRequest(QSharedPointer<Resource> resource);
     static void requestCompleted(QWeakPointer<Resource> resource);
     static bool attemptHighestPriorityRequest();
+    static void attemptHighestPriorityRequests();
 
 private:
     friend class Resource;
@@ -283,17 +329,34 @@ private:
     void resetUnusedResourceCounter();
     void resetResourceCounters();
 
+    // A resource's URL along with its hash, so that it's only hashed once per lookup
+    class URLKey {
+    public:
+        URLKey(const QUrl& url) : url(url), hash(qHash(url)) {}
+        bool operator==(const URLKey& other) const { return hash == other.hash && url == other.url; }
+
+        QUrl url;
+        uint hash;
+    };
+    friend uint qHash(const URLKey& key, uint seed) { return key.hash ^ seed; }
+
+    using Resources = QHash<URLKey, QMultiHash<size_t, QWeakPointer<Resource>>>;
+
+    // Least recently used first. Each resource in it holds its own position, so that it's added and removed in constant
+    // time.
+    using UnusedResources = std::list<QSharedPointer<Resource>>;
+    using UnusedResourcesLock = std::unique_lock<std::mutex>;
+
     // Resources
-    QHash<QUrl, QMultiHash<size_t, QWeakPointer<Resource>>> _resources;
+    Resources _resources;
     QReadWriteLock _resourcesLock { QReadWriteLock::Recursive };
-    int _lastLRUKey = 0;
 
     std::atomic<size_t> _numTotalResources { 0 };
     std::atomic<qint64> _totalResourcesSize { 0 };
 
-    // Cached resources
-    QMap<int, QSharedPointer<Resource>> _unusedResources;
-    QReadWriteLock _unusedResourcesLock { QReadWriteLock::Recursive };
+    // Cached resources. Resources mustn't be released while the mutex is held, releasing one can add others.
+    UnusedResources _unusedResources;
+    std::mutex _unusedResourcesMutex;
     qint64 _unusedResourcesMaxSize = DEFAULT_UNUSED_MAX_SIZE;
 
     std::atomic<size_t> _numUnusedResources { 0 };
@@ -417,9 +480,6 @@ public:
 
     virtual QString getType() const { return "Resource"; }
 
-    /// Returns the key last used to identify this resource in the unused map.
-    int getLRUKey() const { return _lruKey; }
-
     /// Makes sure that the resource has started loading.
     void ensureLoading();
 
@@ -558,15 +618,16 @@ private:
     friend class ResourceCache;
     friend class ScriptableResource;
 
-    void setLRUKey(int lruKey) { _lruKey = lruKey; }
-
     void retry();
     void reinsert();
 
     bool isInScript() const { return _isInScript; }
     void setInScript(bool isInScript) { _isInScript = isInScript; }
 
-    int _lruKey{ 0 };
+    // where the resource is in its cache's unused resources, if it's in them
+    std::list<QSharedPointer<Resource>>::iterator _unusedResourcesPosition;
+    bool _isUnused { false };
+
     QTimer* _replyTimer{ nullptr };
     unsigned int _attempts{ 0 };
     static const int MAX_ATTEMPTS = 8;
@@ -0,0 +1,98 @@
+//
+//  SipHash.cpp
+//  libraries/networking/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SipHash.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QUuid>
+
+static inline uint64_t rotl(uint64_t x, int b) {
+    return (x << b) | (x >> (64 - b));
+}
+
+static inline uint64_t readLittleEndian(const uint8_t* p) {
+    return (uint64_t)p[0] | ((uint64_t)p[1] << 8) | ((uint64_t)p[2] << 16) | ((uint64_t)p[3] << 24) |
+        ((uint64_t)p[4] << 32) | ((uint64_t)p[5] << 40) | ((uint64_t)p[6] << 48) | ((uint64_t)p[7] << 56);
+}
+
+static inline void writeLittleEndian(uint8_t* p, uint64_t v) {
+    for (int i = 0; i < 8; ++i) {
+        p[i] = (uint8_t)(v >> (8 * i));
+    }
+}
+
+static inline void sipRound(uint64_t& v0, uint64_t& v1, uint64_t& v2, uint64_t& v3) {
+    v0 += v1;
+    v1 = rotl(v1, 13);
+    v1 ^= v0;
+    v0 = rotl(v0, 32);
+    v2 += v3;
+    v3 = rotl(v3, 16);
+    v3 ^= v2;
+    v0 += v3;
+    v3 = rotl(v3, 21);
+    v3 ^= v0;
+    v2 += v1;
+    v1 = rotl(v1, 17);
+    v1 ^= v2;
+    v2 = rotl(v2, 32);
+}
+
+void SipHash::setKey(const uint8_t key[KEY_SIZE]) {
+    _k0.store(readLittleEndian(key), std::memory_order_relaxed);
+    _k1.store(readLittleEndian(key + 8), std::memory_order_relaxed);
+}
+
+void SipHash::setKey(const QUuid& uidKey) {
+    const QByteArray rfcBytes(uidKey.toRfc4122());
+    setKey(reinterpret_cast<const uint8_t*>(rfcBytes.constData()));
+}
+
+void SipHash::calculateHash(Hash& hashResult, const char* data, int dataLen) const {
+    calculateHash(hashResult, _k0.load(std::memory_order_relaxed), _k1.load(std::memory_order_relaxed), data, dataLen);
+}
+
+void SipHash::calculateHash(Hash& hashResult, uint64_t k0, uint64_t k1, const char* data, int dataLen) {
+    uint64_t v0 = k0 ^ 0x736f6d6570736575ULL;
+    uint64_t v1 = k1 ^ 0x646f72616e646f6dULL ^ 0xee;
+    uint64_t v2 = k0 ^ 0x6c7967656e657261ULL;
+    uint64_t v3 = k1 ^ 0x7465646279746573ULL;
+
+    const uint8_t* in = reinterpret_cast<const uint8_t*>(data);
+    const uint8_t* end = in + (dataLen & ~7);
+    for (; in != end; in += 8) {
+        uint64_t m = readLittleEndian(in);
+        v3 ^= m;
+        sipRound(v0, v1, v2, v3);
+        sipRound(v0, v1, v2, v3);
+        v0 ^= m;
+    }
+
+    uint64_t b = (uint64_t)dataLen << 56;
+    for (int i = (dataLen & 7) - 1; i >= 0; --i) {
+        b |= (uint64_t)in[i] << (8 * i);
+    }
+    v3 ^= b;
+    sipRound(v0, v1, v2, v3);
+    sipRound(v0, v1, v2, v3);
+    v0 ^= b;
+
+    v2 ^= 0xee;
+    for (int i = 0; i < 4; ++i) {
+        sipRound(v0, v1, v2, v3);
+    }
+    writeLittleEndian(hashResult.data(), v0 ^ v1 ^ v2 ^ v3);
+
+    v1 ^= 0xdd;
+    for (int i = 0; i < 4; ++i) {
+        sipRound(v0, v1, v2, v3);
+    }
+    writeLittleEndian(hashResult.data() + 8, v0 ^ v1 ^ v2 ^ v3);
+}
@@ -0,0 +1,46 @@
+//
+//  SipHash.h
+//  libraries/networking/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_SipHash_h
+#define vircadia_SipHash_h
+
+#include <array>
+#include <atomic>
+#include <stdint.h>
+
+class QUuid;
+
+// A keyed SipHash-2-4 with a 128 bit result, used to authenticate packets between nodes.
+//
+// Unlike HMACAuth this keeps no hashing state between calls, so any number of threads can hash with it at once
+// without taking a lock. The key is stored in atomics so that it can be changed while other threads are hashing,
+// which at worst gets the packets hashed during the change rejected.
+class SipHash {
+public:
+    static const int HASH_SIZE = 16;
+    static const int KEY_SIZE = 16;
+    using Hash = std::array<uint8_t, HASH_SIZE>;
+
+    SipHash() {}
+    explicit SipHash(const QUuid& uidKey) { setKey(uidKey); }
+
+    void setKey(const uint8_t key[KEY_SIZE]);
+    void setKey(const QUuid& uidKey);
+
+    void calculateHash(Hash& hashResult, const char* data, int dataLen) const;
+
+    static void calculateHash(Hash& hashResult, uint64_t k0, uint64_t k1, const char* data, int dataLen);
+
+private:
+    std::atomic<uint64_t> _k0 { 0 };
+    std::atomic<uint64_t> _k1 { 0 };
+};
+
+#endif // vircadia_SipHash_h
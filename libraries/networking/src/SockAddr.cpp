@@ -152,6 +152,28 @@ QDataStream& operator>>(QDataStream& dataStream, SockAddr& sockAddr) {
     return dataStream;
 }
 
+SockAddrKey::SockAddrKey(const SockAddr& sockAddr) {
+    memset(this, 0, sizeof(SockAddrKey));
+    const QHostAddress& hostAddress = sockAddr.getAddress();
+    auto protocol = hostAddress.protocol();
+    if (protocol == QAbstractSocket::IPv4Protocol) {
+        quint32 ipv4 = hostAddress.toIPv4Address();
+        address[10] = 0xff;
+        address[11] = 0xff;
+        address[12] = (uint8_t)(ipv4 >> 24);
+        address[13] = (uint8_t)(ipv4 >> 16);
+        address[14] = (uint8_t)(ipv4 >> 8);
+        address[15] = (uint8_t)ipv4;
+        family = 4;
+    } else if (protocol == QAbstractSocket::IPv6Protocol) {
+        Q_IPV6ADDR ipv6 = hostAddress.toIPv6Address();
+        memcpy(address, ipv6.c, sizeof(address));
+        family = 6;
+    }
+    port = sockAddr.getPort();
+    socketType = (uint8_t)sockAddr.getType();
+}
+
 uint qHash(const SockAddr& key, uint seed) {
     // use the existing QHostAddress and quint16 hash functions to get our hash
     return qHash(key.getAddress(), seed) ^ qHash(key.getPort(), seed);
@@ -14,7 +14,9 @@
 #define hifi_SockAddr_h
 
 #include <cstdint>
+#include <cstring>
 #include <string>
+#include <type_traits>
 
 struct sockaddr;
 
@@ -77,26 +79,48 @@ private:
 
 uint qHash(const SockAddr& key, uint seed);
 
+// A SockAddr flattened into plain bytes, for keying the maps that are looked up for every packet.
+// It is trivially copyable, compares with memcmp and hashes without touching the QHostAddress, which is heap backed.
+// IPv4 addresses are held in their IPv4-mapped IPv6 form; the family is kept so that they still compare as the
+// QHostAddress would.
+struct SockAddrKey {
+    uint8_t address[16];
+    uint16_t port;
+    uint8_t socketType;
+    uint8_t family; // 0 for none, 4 or 6
+
+    SockAddrKey() { memset(this, 0, sizeof(SockAddrKey)); }
+    SockAddrKey(const SockAddr& sockAddr);
+
+    bool operator==(const SockAddrKey& other) const { return memcmp(this, &other, sizeof(SockAddrKey)) == 0; }
+    bool operator!=(const SockAddrKey& other) const { return !(*this == other); }
+
+    size_t hash() const {
+        uint64_t high, low;
+        uint32_t rest;
+        memcpy(&high, address, sizeof(high));
+        memcpy(&low, address + sizeof(high), sizeof(low));
+        memcpy(&rest, &port, sizeof(rest));
+        uint64_t hash = (high * 0x9E3779B97F4A7C15ULL) ^ (low * 0xC2B2AE3D27D4EB4FULL) ^ rest;
+        hash ^= hash >> 29;
+        return (size_t)(hash * 0xBF58476D1CE4E5B9ULL);
+    }
+};
+static_assert(sizeof(SockAddrKey) == 20 && std::is_trivially_copyable<SockAddrKey>::value,
+              "SockAddrKey must be packed plain data");
+
 namespace std {
     template <>
     struct hash<SockAddr> {
-        // NOTE: this hashing specifically ignores IPv6 addresses - if we begin to support those we will need
-        // to conditionally hash the bytes that represent an IPv6 address
         size_t operator()(const SockAddr& sockAddr) const {
-            // use XOR of implemented std::hash templates for new hash
-            // depending on the type of address we're looking at
-            
-            if (sockAddr.getAddress().protocol() == QAbstractSocket::IPv4Protocol) {
-                return hash<uint32_t>()((uint32_t) sockAddr.getAddress().toIPv4Address())
-                    ^ hash<uint16_t>()((uint16_t) sockAddr.getPort());
-            } else {
-                // NOTE: if we start to use IPv6 addresses, it's possible their hashing
-                // can be faster by XORing the hash for each 64 bits in the address
-                return hash<string>()(sockAddr.getAddress().toString().toStdString())
-                    ^ hash<uint16_t>()((uint16_t) sockAddr.getPort());
-            }
+            return SockAddrKey(sockAddr).hash();
         }
     };
+
+    template <>
+    struct hash<SockAddrKey> {
+        size_t operator()(const SockAddrKey& key) const { return key.hash(); }
+    };
 }
 
 Q_DECLARE_METATYPE(SockAddr);
@@ -14,14 +14,18 @@
 #include <QtCore/QCoreApplication>
 #include <QtCore/QJsonArray>
 #include <QtCore/QJsonObject>
+#include <QtCore/QMetaEnum>
 #include <QtCore/QThread>
 #include <QtCore/QTimer>
 
 #include <LogHandler.h>
+#include <MemoryAccounting.h>
+#include <MetricsRegistry.h>
 #include <shared/QtHelpers.h>
 
 #include <platform/Platform.h>
 #include "NetworkLogging.h"
+#include "udt/PacketBufferPool.h"
 
 ThreadedAssignment::ThreadedAssignment(ReceivedMessage& message) :
     Assignment(message),
@@ -104,6 +108,20 @@ void ThreadedAssignment::commonInit(const QString& targetName, NodeType_t nodeTy
 
     // stop sending stats if we disconnect
     connect(&nodeList->getDomainHandler(), &DomainHandler::disconnectedFromDomain, &_statsTimer, &QTimer::stop);
+
+    // pick up the congestion control for our assignment type from the domain settings
+    connect(&nodeList->getDomainHandler(), &DomainHandler::settingsReceived,
+            this, &ThreadedAssignment::applyCongestionControlSettings);
+}
+
+void ThreadedAssignment::applyCongestionControlSettings(const QJsonObject& domainSettingsObject) {
+    // e.g. "congestion_control": { "asset-server": "bbr", "entity-server": "bbr" }
+    static const QString CONGESTION_CONTROL_SETTINGS_KEY = "congestion_control";
+
+    auto congestionControl = domainSettingsObject[CONGESTION_CONTROL_SETTINGS_KEY].toObject()[QString(getTypeName())].toString();
+    if (!congestionControl.isEmpty()) {
+        DependencyManager::get<NodeList>()->setCongestionControl(congestionControl);
+    }
 }
 
 void ThreadedAssignment::addPacketStatsAndSendStatsPacket(QJsonObject statsObject) {
@@ -119,8 +137,53 @@ void ThreadedAssignment::addPacketStatsAndSendStatsPacket(QJsonObject statsObjec
     ioStats["outbound_kbps"] = nodeList->getOutboundKbps();
     ioStats["outbound_pps"] = nodeList->getOutboundPPS();
 
+    auto readStats = nodeList->sampleSocketReadStats();
+    ioStats["datagrams_per_wakeup"] = readStats.wakeups > 0 ? (double)readStats.datagrams / readStats.wakeups : 0.0;
+    ioStats["datagrams_per_read"] = readStats.reads > 0 ? (double)readStats.datagrams / readStats.reads : 0.0;
+
+    auto connectionMapStats = nodeList->sampleConnectionMapStats();
+    ioStats["connection_lookups"] = (double)connectionMapStats.lookups;
+    ioStats["connection_lock_contentions"] = (double)connectionMapStats.contendedLocks;
+
+    // how often each packet type was handled, and how long it took from arriving to its listener returning
+    QJsonObject dispatchStats;
+    QMetaEnum packetTypeEnum = PacketTypeEnum::staticMetaObject.enumerator(PacketTypeEnum::staticMetaObject.enumeratorOffset());
+    for (const auto& typeStats : nodeList->getPacketReceiver().sampleDispatchStats()) {
+        QJsonObject typeObject;
+        typeObject["count"] = (double)typeStats.count;
+        typeObject["avg_usecs"] = (double)typeStats.totalUsecs / typeStats.count;
+        typeObject["max_usecs"] = (double)typeStats.maxUsecs;
+        dispatchStats[packetTypeEnum.valueToKey((int)typeStats.type)] = typeObject;
+    }
+    ioStats["packet_dispatch"] = dispatchStats;
+
+    auto bufferStats = udt::PacketBufferPool::sampleStats();
+    QJsonObject bufferPoolStats;
+    bufferPoolStats["hits"] = (double)bufferStats.hits;
+    bufferPoolStats["misses"] = (double)bufferStats.misses;
+    bufferPoolStats["oversized"] = (double)bufferStats.oversized;
+    bufferPoolStats["shared_free"] = (double)bufferStats.shared;
+    ioStats["packet_buffer_pool"] = bufferPoolStats;
+
     statsObject["io_stats"] = ioStats;
 
+    statsObject["memory"] = MemoryAccounting::sampleStats();
+
+    // the same totals, for the metrics endpoint
+    auto& metrics = MetricsRegistry::getInstance();
+    static auto& inboundKbps = metrics.gauge("assignment_inbound_kbps", "Kilobits per second received.");
+    static auto& inboundPPS = metrics.gauge("assignment_inbound_pps", "Packets per second received.");
+    static auto& outboundKbps = metrics.gauge("assignment_outbound_kbps", "Kilobits per second sent.");
+    static auto& outboundPPS = metrics.gauge("assignment_outbound_pps", "Packets per second sent.");
+    static auto& queuedCheckIns = metrics.gauge("assignment_queued_check_ins",
+                                                "Domain-server check-ins sent without a reply.");
+    inboundKbps.set(nodeList->getInboundKbps());
+    inboundPPS.set(nodeList->getInboundPPS());
+    outboundKbps.set(nodeList->getOutboundKbps());
+    outboundPPS.set(nodeList->getOutboundPPS());
+    queuedCheckIns.set(_numQueuedCheckIns);
+    MemoryAccounting::updateMetrics();
+
     QJsonObject assignmentStats;
     assignmentStats["numQueuedCheckIns"] = _numQueuedCheckIns;
 
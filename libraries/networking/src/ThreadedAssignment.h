@@ -12,6 +12,8 @@
 #ifndef hifi_ThreadedAssignment_h
 #define hifi_ThreadedAssignment_h
 
+#include <atomic>
+
 #include <QtCore/QSharedPointer>
 
 #include "ReceivedMessage.h"
@@ -27,6 +29,9 @@ public:
     virtual void aboutToFinish() { };
     void addPacketStatsAndSendStatsPacket(QJsonObject statsObject);
 
+    // how much of its time the assignment spends working, from 0 to 1, from any thread
+    float getLoad() const { return _load.load(std::memory_order_relaxed); }
+
 public slots:
     /// threaded run of assignment
     virtual void run() = 0;
@@ -43,6 +48,7 @@ signals:
 protected:
     void commonInit(const QString& targetName, NodeType_t nodeType);
     void setFinished(bool isFinished);
+    void setLoad(float load) { _load.store(load, std::memory_order_relaxed); }
 
     bool _isFinished;
     QTimer _domainServerTimer;
@@ -54,6 +60,10 @@ protected slots:
 
 private slots:
     void checkInWithDomainServerOrExit();
+    void applyCongestionControlSettings(const QJsonObject& domainSettingsObject);
+
+private:
+    std::atomic<float> _load { 0.0f };
 };
 
 typedef QSharedPointer<ThreadedAssignment> SharedAssignmentPointer;
@@ -0,0 +1,258 @@
+//
+//  BBRCC.cpp
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BBRCC.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+
+using namespace udt;
+using namespace std::chrono;
+
+// 2/ln(2), the smallest gain that doubles the sending rate every round
+static const double STARTUP_GAIN = 2.885;
+static const double PROBE_BW_CONGESTION_WINDOW_GAIN = 2.0;
+static const double PROBE_BW_PACING_GAINS[] = { 1.25, 0.75, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+static const int NUM_PROBE_BW_PHASES = sizeof(PROBE_BW_PACING_GAINS) / sizeof(PROBE_BW_PACING_GAINS[0]);
+
+static const uint64_t BANDWIDTH_WINDOW_ROUNDS = 10;
+static const double FULL_BANDWIDTH_GROWTH = 1.25;
+static const int FULL_BANDWIDTH_ROUNDS = 3;
+
+static const auto MIN_RTT_WINDOW = seconds(10);
+static const auto PROBE_RTT_DURATION = milliseconds(200);
+
+static const int MIN_CONGESTION_WINDOW_PACKETS = 4;
+static const int MAX_RTT_SAMPLE_MICROSECONDS = 10000000;
+static const double USECS_PER_SECOND = 1000000.0;
+
+BBRCC::BBRCC() :
+    _pacingGain(STARTUP_GAIN),
+    _congestionWindowGain(STARTUP_GAIN)
+{
+    // unpaced and window limited until we have a bandwidth sample
+    _packetSendPeriod = 0.0;
+}
+
+void BBRCC::onPacketSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) {
+    if (_sentPackets.empty()) {
+        // nothing in flight, so the delivery rate of this flight starts now rather than at the last ACK
+        _deliveredTime = timePoint;
+    }
+
+    _sentPackets.push_back({ seqNum, timePoint, wireSize, _delivered, _deliveredTime, false });
+}
+
+void BBRCC::onPacketReSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) {
+    // a re-sent packet's ACK can't be matched to either send, so it gives no RTT sample
+    auto it = std::find_if(_sentPackets.begin(), _sentPackets.end(), [seqNum](const SentPacket& packet) {
+        return packet.sequenceNumber == seqNum;
+    });
+
+    if (it != _sentPackets.end()) {
+        it->wasResent = true;
+    }
+}
+
+bool BBRCC::onACK(SequenceNumber ack, p_high_resolution_clock::time_point receiveTime) {
+    if (ack == _lastACK) {
+        // fall back to Reno's fast re-transmit on the 3rd duplicate ACK, as TCPVegasCC does
+        static const int FAST_RETRANSMIT_DUPLICATE_COUNT = 3;
+        if (++_duplicateACKCount == FAST_RETRANSMIT_DUPLICATE_COUNT) {
+            _duplicateACKCount = 0;
+            return true;
+        }
+        return false;
+    }
+
+    _lastACK = ack;
+    _duplicateACKCount = 0;
+
+    // everything up to and including the ACK has been delivered
+    bool hasNewest = false;
+    SentPacket newest;
+    while (!_sentPackets.empty() && _sentPackets.front().sequenceNumber <= ack) {
+        newest = _sentPackets.front();
+        hasNewest = true;
+        _delivered += newest.wireSize;
+        _sentPackets.pop_front();
+    }
+
+    if (!hasNewest) {
+        return false;
+    }
+
+    _deliveredTime = receiveTime;
+
+    // a new round starts with the ACK of the first packet sent after the previous round started
+    _isRoundStart = newest.deliveredAtSend >= _nextRoundDelivered;
+    if (_isRoundStart) {
+        _nextRoundDelivered = _delivered;
+        ++_roundCount;
+    }
+
+    if (!newest.wasResent) {
+        auto rtt = duration_cast<microseconds>(receiveTime - newest.sendTime).count();
+        if (rtt >= 0) {
+            updateRTT((int)std::min(std::max(rtt, (decltype(rtt))1), (decltype(rtt))MAX_RTT_SAMPLE_MICROSECONDS),
+                      receiveTime);
+        }
+    }
+
+    // the delivery rate over the time it took to deliver what was in flight when the newest packet went out
+    auto interval = duration_cast<microseconds>(receiveTime - newest.deliveredTimeAtSend).count();
+    if (interval > 0) {
+        updateBandwidth((_delivered - newest.deliveredAtSend) * USECS_PER_SECOND / interval);
+    }
+
+    updateMode(receiveTime);
+    applyModel();
+
+    return false;
+}
+
+void BBRCC::updateRTT(int rtt, TimePoint now) {
+    if (_minRTT == -1 || rtt <= _minRTT || now - _minRTTTime > MIN_RTT_WINDOW) {
+        _minRTT = rtt;
+        _minRTTTime = now;
+    }
+
+    // the same smoothing as TCPVegasCC, for the re-transmit timeout
+    if (_ewmaRTT == -1) {
+        _ewmaRTT = rtt;
+        _rttVariance = rtt / 2;
+    } else {
+        static const int RTT_ESTIMATION_ALPHA = 8;
+        static const int RTT_ESTIMATION_VARIANCE_ALPHA = 4;
+
+        _ewmaRTT = (_ewmaRTT * (RTT_ESTIMATION_ALPHA - 1) + rtt) / RTT_ESTIMATION_ALPHA;
+        _rttVariance = (_rttVariance * (RTT_ESTIMATION_VARIANCE_ALPHA - 1)
+                        + abs(rtt - _ewmaRTT)) / RTT_ESTIMATION_VARIANCE_ALPHA;
+    }
+}
+
+void BBRCC::updateBandwidth(double bytesPerSecond) {
+    // sliding window max - drop samples this one beats, and samples that have aged out
+    while (!_bandwidthSamples.empty() && _bandwidthSamples.back().bytesPerSecond <= bytesPerSecond) {
+        _bandwidthSamples.pop_back();
+    }
+    _bandwidthSamples.push_back({ _roundCount, bytesPerSecond });
+
+    while (_bandwidthSamples.front().round + BANDWIDTH_WINDOW_ROUNDS <= _roundCount) {
+        _bandwidthSamples.pop_front();
+    }
+}
+
+double BBRCC::getBDPInPackets() const {
+    if (_minRTT == -1) {
+        return 0.0;
+    }
+    return getBandwidth() * _minRTT / USECS_PER_SECOND / getMaxSegmentSize();
+}
+
+void BBRCC::enterProbeBW(TimePoint now) {
+    _mode = Mode::ProbeBW;
+    _congestionWindowGain = PROBE_BW_CONGESTION_WINDOW_GAIN;
+
+    // start at a random phase, other than the one that drains, so that flows sharing a bottleneck don't probe in step
+    thread_local std::default_random_engine engine { std::random_device()() };
+    std::uniform_int_distribution<int> distribution(0, NUM_PROBE_BW_PHASES - 2);
+    _cycleIndex = distribution(engine);
+    if (_cycleIndex >= 1) {
+        ++_cycleIndex;
+    }
+
+    _pacingGain = PROBE_BW_PACING_GAINS[_cycleIndex];
+    _cycleStartTime = now;
+}
+
+void BBRCC::updateMode(TimePoint now) {
+    if (!_isPipeFull && _isRoundStart) {
+        if (getBandwidth() >= _fullBandwidth * FULL_BANDWIDTH_GROWTH) {
+            _fullBandwidth = getBandwidth();
+            _fullBandwidthCount = 0;
+        } else if (++_fullBandwidthCount >= FULL_BANDWIDTH_ROUNDS) {
+            _isPipeFull = true;
+        }
+    }
+
+    int packetsInFlight = (int)_sentPackets.size();
+
+    switch (_mode) {
+        case Mode::Startup:
+            if (_isPipeFull) {
+                _mode = Mode::Drain;
+                _pacingGain = 1.0 / STARTUP_GAIN;
+                _congestionWindowGain = STARTUP_GAIN;
+            }
+            break;
+        case Mode::Drain:
+            if (packetsInFlight <= getBDPInPackets()) {
+                enterProbeBW(now);
+            }
+            break;
+        case Mode::ProbeBW:
+            // each phase lasts one min RTT
+            if (_minRTT != -1 && duration_cast<microseconds>(now - _cycleStartTime).count() > _minRTT) {
+                _cycleIndex = (_cycleIndex + 1) % NUM_PROBE_BW_PHASES;
+                _pacingGain = PROBE_BW_PACING_GAINS[_cycleIndex];
+                _cycleStartTime = now;
+            }
+            break;
+        case Mode::ProbeRTT:
+            if (_probeRTTDoneTime == TimePoint() && packetsInFlight <= MIN_CONGESTION_WINDOW_PACKETS) {
+                // the window is down, hold it there for a while and at least a round
+                _probeRTTDoneTime = now + PROBE_RTT_DURATION;
+                _probeRTTRound = _roundCount;
+            } else if (_probeRTTDoneTime != TimePoint() && now >= _probeRTTDoneTime && _roundCount > _probeRTTRound) {
+                _minRTTTime = now;
+                if (_isPipeFull) {
+                    enterProbeBW(now);
+                } else {
+                    _mode = Mode::Startup;
+                    _pacingGain = STARTUP_GAIN;
+                    _congestionWindowGain = STARTUP_GAIN;
+                }
+            }
+            break;
+    }
+
+    if (_mode != Mode::ProbeRTT && _minRTT != -1 && now - _minRTTTime > MIN_RTT_WINDOW) {
+        // the min RTT hasn't been seen in a while, it may be out of date
+        _mode = Mode::ProbeRTT;
+        _pacingGain = 1.0;
+        _probeRTTDoneTime = TimePoint();
+    }
+}
+
+void BBRCC::applyModel() {
+    auto bandwidth = getBandwidth();
+    if (bandwidth <= 0.0) {
+        return;
+    }
+
+    setPacketSendPeriod(getMaxSegmentSize() * USECS_PER_SECOND / (_pacingGain * bandwidth));
+
+    int congestionWindow;
+    if (_mode == Mode::ProbeRTT) {
+        congestionWindow = MIN_CONGESTION_WINDOW_PACKETS;
+    } else {
+        congestionWindow = (int)std::ceil(_congestionWindowGain * getBDPInPackets());
+    }
+
+    _congestionWindowSize = std::min(std::max(congestionWindow, MIN_CONGESTION_WINDOW_PACKETS),
+                                     udt::MAX_PACKETS_IN_FLIGHT);
+}
+
+int BBRCC::estimatedTimeout() const {
+    return _ewmaRTT == -1 ? DEFAULT_SYN_INTERVAL : _ewmaRTT + _rttVariance * 4;
+}
@@ -0,0 +1,115 @@
+//
+//  BBRCC.h
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_BBRCC_h
+#define vircadia_BBRCC_h
+
+#include <algorithm>
+#include <deque>
+
+#include "CongestionControl.h"
+#include "Constants.h"
+
+namespace udt {
+
+// Congestion control modelled on BBR (https://queue.acm.org/detail.cfm?id=3022184).
+// Rather than reacting to delay like TCPVegasCC, it estimates the bottleneck bandwidth (the windowed max of the
+// delivery rate seen by ACKs) and the round-trip propagation time (the windowed min RTT) and paces packets out at that
+// bandwidth, with a congestion window of a couple of bandwidth-delay products. This keeps bulk transfers on long, fat
+// links at full rate where Vegas backs off as soon as queueing adds to the RTT.
+class BBRCC : public CongestionControl {
+public:
+    BBRCC();
+
+    virtual bool onACK(SequenceNumber ackNum, p_high_resolution_clock::time_point receiveTime) override;
+
+    virtual void onPacketSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) override;
+    virtual void onPacketReSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) override;
+
+    virtual int estimatedTimeout() const override;
+
+    virtual int getRTT() const override { return std::max(_ewmaRTT, 0); }
+
+protected:
+    virtual void setInitialSendSequenceNumber(SequenceNumber seqNum) override { _lastACK = seqNum - 1; }
+
+private:
+    enum class Mode {
+        Startup,    // ramp up exponentially until the bandwidth stops growing
+        Drain,      // drain the queue that startup built
+        ProbeBW,    // cycle the pacing rate around the bandwidth estimate to probe for more
+        ProbeRTT    // briefly cut the window to see the propagation delay without queueing
+    };
+
+    using TimePoint = p_high_resolution_clock::time_point;
+
+    struct SentPacket {
+        SequenceNumber sequenceNumber;
+        TimePoint sendTime;
+        int wireSize;
+        int64_t deliveredAtSend;        // bytes ACKed when the packet was sent
+        TimePoint deliveredTimeAtSend;  // time of the last ACK before the packet was sent
+        bool wasResent;
+    };
+
+    struct BandwidthSample {
+        uint64_t round;
+        double bytesPerSecond;
+    };
+
+    void updateRTT(int rtt, TimePoint now);
+    void updateBandwidth(double bytesPerSecond);
+    void updateMode(TimePoint now);
+    void enterProbeBW(TimePoint now);
+    void applyModel();
+
+    double getBandwidth() const { return _bandwidthSamples.empty() ? 0.0 : _bandwidthSamples.front().bytesPerSecond; }
+    int getMaxSegmentSize() const { return _mss > 0 ? _mss : MAX_PACKET_SIZE; }
+    double getBDPInPackets() const;
+
+    Mode _mode { Mode::Startup };
+    double _pacingGain;
+    double _congestionWindowGain;
+
+    std::deque<SentPacket> _sentPackets; // not yet ACKed, in send order
+    SequenceNumber _lastACK;
+    int _duplicateACKCount { 0 };
+
+    int64_t _delivered { 0 };   // bytes ACKed over the connection
+    TimePoint _deliveredTime;   // time of the last ACK
+
+    // round trips are counted by ACKs for packets sent after the previous round started
+    uint64_t _roundCount { 0 };
+    int64_t _nextRoundDelivered { 0 };
+    bool _isRoundStart { false };
+
+    // windowed max of the delivery rate over the last few rounds, in decreasing order
+    std::deque<BandwidthSample> _bandwidthSamples;
+
+    // startup ends once the bandwidth estimate stops growing for a few rounds
+    double _fullBandwidth { 0.0 };
+    int _fullBandwidthCount { 0 };
+    bool _isPipeFull { false };
+
+    int _minRTT { -1 };         // in microseconds
+    TimePoint _minRTTTime;
+    TimePoint _probeRTTDoneTime;
+    uint64_t _probeRTTRound { 0 };
+
+    int _cycleIndex { 0 };
+    TimePoint _cycleStartTime;
+
+    int _ewmaRTT { -1 };        // in microseconds, for the timeout
+    int _rttVariance { 0 };
+};
+
+}
+
+#endif // vircadia_BBRCC_h
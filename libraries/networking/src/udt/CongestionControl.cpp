@@ -11,8 +11,11 @@
 
 #include "CongestionControl.h"
 
+#include <algorithm>
+#include <limits>
 #include <random>
 
+#include "Constants.h"
 #include "Packet.h"
 
 using namespace udt;
@@ -26,6 +29,16 @@ void CongestionControl::setMaxBandwidth(int maxBandwidth) {
     setPacketSendPeriod(_packetSendPeriod);
 }
 
+int CongestionControl::getPacingRate() const {
+    if (_packetSendPeriod <= 0.0) {
+        return 0;
+    }
+
+    auto packetSize = _mss > 0 ? _mss : MAX_PACKET_SIZE;
+    return (int)std::min(BITS_PER_BYTE * packetSize * USECS_PER_SECOND / _packetSendPeriod,
+                         (double)std::numeric_limits<int>::max());
+}
+
 void CongestionControl::setPacketSendPeriod(double newSendPeriod) {
     Q_ASSERT_X(newSendPeriod >= 0, "CongestionControl::setPacketPeriod", "Can not set a negative packet send period");
 
@@ -49,6 +49,12 @@ public:
 
     virtual int estimatedTimeout() const = 0;
 
+    // the rate implied by the packet send period, in bits per second - 0 if packets aren't paced
+    int getPacingRate() const;
+
+    // the smoothed round trip time, in microseconds - 0 until it has been measured
+    virtual int getRTT() const { return 0; }
+
 protected:
     void setMSS(int mss) { _mss = mss; }
     virtual void setInitialSendSequenceNumber(SequenceNumber seqNum) = 0;
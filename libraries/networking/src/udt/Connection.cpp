@@ -26,6 +26,7 @@
 #include "Packet.h"
 #include "PacketList.h"
 #include "Socket.h"
+#include "SendQueuePool.h"
 #include <Trace.h>
 
 using namespace udt;
@@ -42,7 +43,7 @@ Connection::Connection(Socket* parentSocket, SockAddr destination, std::unique_p
     _congestionControl->init();
 
     // Setup packets
-    static const int ACK_PACKET_PAYLOAD_BYTES = sizeof(SequenceNumber);
+    static const int ACK_PACKET_PAYLOAD_BYTES = ControlPacket::MAX_ACK_PAYLOAD_BYTES;
     static const int HANDSHAKE_ACK_PAYLOAD_BYTES = sizeof(SequenceNumber);
 
     _ackPacket = ControlPacket::create(ControlPacket::ACK, ACK_PACKET_PAYLOAD_BYTES);
@@ -68,6 +69,16 @@ Connection::~Connection() {
 }
 
 void Connection::stopSendQueue() {
+    if (_sendQueue && _sendQueue->isPooled()) {
+        // make sure none of the pool's workers are still sending for it before it goes away
+        _sendQueue->stop();
+        SendQueuePool::getInstance().remove(_sendQueue.get());
+
+        _lastMessageNumber = _sendQueue->getCurrentMessageNumber();
+        _sendQueue.reset();
+        return;
+    }
+
     if (auto sendQueue = _sendQueue.release()) {
         // grab the send queue thread so we can wait on it
         QThread* sendQueueThread = sendQueue->thread();
@@ -220,6 +231,13 @@ void Connection::sendACK() {
     // pack in the ACK number
     _ackPacket->writePrimitive(nextACKNumber);
 
+    if (_lossList.getLength() > 0) {
+        // tell the sender what we have past the hole so it only re-sends what we're missing
+        SelectiveACK selectiveACK;
+        _lossList.fillSelectiveACK(nextACKNumber, _lastReceivedSequenceNumber, selectiveACK);
+        _ackPacket->writeSelectiveACK(selectiveACK);
+    }
+
     // have the socket send off our packet
     _parentSocket->writeBasePacket(*_ackPacket, _destination);
     
@@ -338,12 +356,17 @@ void Connection::processACK(ControlPacketPointer controlPacket) {
         return;
     }
 
-    if (ack > _lastReceivedACK) {
-        // this is not a repeated ACK, so update our member and tell the send queue
+    // older receivers don't send a selective ACK, in which case it is left empty
+    SelectiveACK selectiveACK;
+    controlPacket->readSelectiveACK(selectiveACK);
+
+    if (ack > _lastReceivedACK || selectiveACK.numWords > 0) {
+        // this is not a repeated ACK or it tells us about packets past the ACK, so update our member and tell the
+        // send queue
         _lastReceivedACK = ack;
 
         // ACK the send queue so it knows what was received
-        getSendQueue().ack(ack);
+        getSendQueue().ack(ack, selectiveACK);
     }
 
     // give this ACK to the congestion control and update the send queue parameters
@@ -438,6 +461,8 @@ void Connection::updateCongestionControlAndSendQueue(std::function<void ()> cong
     // record connection stats
     _stats.recordPacketSendPeriod(_congestionControl->_packetSendPeriod);
     _stats.recordCongestionWindowSize(_congestionControl->_congestionWindowSize);
+    _stats.recordPacingRate(_congestionControl->getPacingRate());
+    _stats.recordRTT(_congestionControl->getRTT());
 }
 
 void PendingReceivedMessage::enqueuePacket(std::unique_ptr<Packet> packet) {
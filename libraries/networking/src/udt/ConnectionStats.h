@@ -68,6 +68,11 @@ public:
         int rtt { 0 };
         int congestionWindowSize { 0 };
         int packetSendPeriod { 0 };
+        int pacingRate { 0 }; // bits per second, 0 if unpaced
+
+        // queue depths of the WebRTC data channel a connection is over, filled in by Socket - 0 for UDP connections
+        int webrtcBufferedBytes { 0 };      // bytes waiting in the data channel's send buffer
+        int webrtcReceiveQueueDepth { 0 };  // messages received on the data channels but not yet read by the socket
         
         // TODO: Remove once Win build supports brace initialization: `Events events {{ 0 }};`
         Stats() { events.fill(0); }
@@ -93,6 +98,8 @@ public:
 
     void recordCongestionWindowSize(int sample);
     void recordPacketSendPeriod(int sample);
+    void recordPacingRate(int sample);
+    void recordRTT(int sample);
     
 private:
     Stats _currentSample;
@@ -12,6 +12,8 @@
 
 #include "ControlPacket.h"
 
+#include <algorithm>
+
 #include "Constants.h"
 
 using namespace udt;
@@ -26,7 +28,7 @@ int ControlPacket::maxPayloadSize() {
     return BasePacket::maxPayloadSize() - ControlPacket::localHeaderSize();
 }
 
-std::unique_ptr<ControlPacket> ControlPacket::fromReceivedPacket(std::unique_ptr<char[]> data, qint64 size,
+std::unique_ptr<ControlPacket> ControlPacket::fromReceivedPacket(PacketBuffer data, qint64 size,
                                                                  const SockAddr &senderSockAddr) {
     // Fail with null data
     Q_ASSERT(data);
@@ -57,7 +59,7 @@ ControlPacket::ControlPacket(Type type, qint64 size) :
     writeType();
 }
 
-ControlPacket::ControlPacket(std::unique_ptr<char[]> data, qint64 size, const SockAddr& senderSockAddr) :
+ControlPacket::ControlPacket(PacketBuffer data, qint64 size, const SockAddr& senderSockAddr) :
     BasePacket(std::move(data), size, senderSockAddr)
 {
     // sanity check before we decrease the payloadSize with the payloadCapacity
@@ -88,6 +90,31 @@ void ControlPacket::setType(udt::ControlPacket::Type type) {
     writeType();
 }
 
+void ControlPacket::writeSelectiveACK(const SelectiveACK& selectiveACK) {
+    if (selectiveACK.numWords == 0) {
+        return;
+    }
+
+    uint8_t numWords = selectiveACK.numWords;
+    writePrimitive(numWords);
+    write(reinterpret_cast<const char*>(selectiveACK.words.data()), numWords * sizeof(uint32_t));
+}
+
+void ControlPacket::readSelectiveACK(SelectiveACK& selectiveACK) {
+    selectiveACK.numWords = 0;
+
+    uint8_t numWords;
+    if (bytesLeftToRead() < (qint64)sizeof(numWords)) {
+        return;
+    }
+    readPrimitive(&numWords);
+
+    numWords = std::min(numWords, (uint8_t)SelectiveACK::MAX_WORDS);
+    numWords = (uint8_t)std::min((qint64)numWords, bytesLeftToRead() / (qint64)sizeof(uint32_t));
+    read(reinterpret_cast<char*>(selectiveACK.words.data()), numWords * sizeof(uint32_t));
+    selectiveACK.numWords = numWords;
+}
+
 void ControlPacket::writeType() {
     ControlBitAndType* bitAndType = reinterpret_cast<ControlBitAndType*>(_packet.get());
     
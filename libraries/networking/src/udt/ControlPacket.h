@@ -15,12 +15,26 @@
 #ifndef hifi_ControlPacket_h
 #define hifi_ControlPacket_h
 
+#include <array>
 #include <vector>
 
 #include "BasePacket.h"
 #include "Packet.h"
 
 namespace udt {
+
+// The packets a receiver has beyond its cumulative ACK, sent after the ACK number so that the sender neither re-sends
+// them nor waits for a timeout to re-send the ones in between. Bit i of the bitmap is set if ACK + 2 + i was received
+// (ACK + 1 is missing, otherwise it would have been ACKed).
+struct SelectiveACK {
+    static const int MAX_WORDS = 16;
+
+    std::array<uint32_t, MAX_WORDS> words;
+    int numWords { 0 };
+
+    int numBits() const { return numWords * 32; }
+    bool isSet(int bit) const { return (words[bit / 32] >> (bit % 32)) & 1; }
+};
     
 class ControlPacket : public BasePacket {
     Q_OBJECT
@@ -35,7 +49,7 @@ public:
     };
     
     static std::unique_ptr<ControlPacket> create(Type type, qint64 size = -1);
-    static std::unique_ptr<ControlPacket> fromReceivedPacket(std::unique_ptr<char[]> data, qint64 size,
+    static std::unique_ptr<ControlPacket> fromReceivedPacket(PacketBuffer data, qint64 size,
                                                              const SockAddr& senderSockAddr);
     // Current level's header size
     static int localHeaderSize();
@@ -46,11 +60,19 @@ public:
     
     Type getType() const { return _type; }
     void setType(Type type);
+
+    // an ACK's selective ACK follows its sequence number - ACKs from older peers have none, which reads as empty
+    void writeSelectiveACK(const SelectiveACK& selectiveACK);
+    void readSelectiveACK(SelectiveACK& selectiveACK);
+
+    // the most an ACK packet can hold
+    static const int MAX_ACK_PAYLOAD_BYTES = sizeof(SequenceNumber) + sizeof(uint8_t)
+        + SelectiveACK::MAX_WORDS * sizeof(uint32_t);
     
 private:
     Q_DISABLE_COPY(ControlPacket)
     ControlPacket(Type type, qint64 size = -1);
-    ControlPacket(std::unique_ptr<char[]> data, qint64 size, const SockAddr& senderSockAddr);
+    ControlPacket(PacketBuffer data, qint64 size, const SockAddr& senderSockAddr);
     ControlPacket(ControlPacket&& other);
     
     ControlPacket& operator=(ControlPacket&& other);
@@ -11,6 +11,8 @@
 
 #include "LossList.h"
 
+#include <algorithm>
+
 #include "ControlPacket.h"
 
 using namespace udt;
@@ -167,6 +169,39 @@ SequenceNumber LossList::popFirstSequenceNumber() {
     return front;
 }
 
+void LossList::fillSelectiveACK(SequenceNumber ack, SequenceNumber lastReceived, SelectiveACK& selectiveACK) const {
+    // bit 0 is ack + 2
+    auto first = ack + 2;
+    int numBits = std::min(seqoff(first, lastReceived) + 1, SelectiveACK::MAX_WORDS * 32);
+    if (numBits <= 0) {
+        selectiveACK.numWords = 0;
+        return;
+    }
+
+    // start with everything up to lastReceived received, then clear what's missing
+    selectiveACK.numWords = (numBits + 31) / 32;
+    for (int i = 0; i < selectiveACK.numWords; ++i) {
+        selectiveACK.words[i] = 0xFFFFFFFF;
+    }
+    if (numBits % 32 != 0) {
+        selectiveACK.words[selectiveACK.numWords - 1] = (uint32_t(1) << (numBits % 32)) - 1;
+    }
+
+    for (const auto& range : _lossList) {
+        int start = std::max(seqoff(first, range.first), 0);
+        int end = std::min(seqoff(first, range.second), numBits - 1);
+        if (end < 0) {
+            continue;
+        } else if (start >= numBits) {
+            break;
+        }
+
+        for (int bit = start; bit <= end; ++bit) {
+            selectiveACK.words[bit / 32] &= ~(uint32_t(1) << (bit % 32));
+        }
+    }
+}
+
 void LossList::write(ControlPacket& packet, int maxPairs) {
     int writtenPairs = 0;
     
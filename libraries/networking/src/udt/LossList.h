@@ -19,6 +19,7 @@
 namespace udt {
 
 class ControlPacket;
+struct SelectiveACK;
     
 class LossList {
 public:
@@ -42,6 +43,9 @@ public:
     SequenceNumber popFirstSequenceNumber();
     
     void write(ControlPacket& packet, int maxPairs = -1);
+
+    // fills in which packets after ack + 1 were received, up to lastReceived - everything not in the list
+    void fillSelectiveACK(SequenceNumber ack, SequenceNumber lastReceived, SelectiveACK& selectiveACK) const;
     
 private:
     std::list<std::pair<SequenceNumber, SequenceNumber>> _lossList;
@@ -8,7 +8,18 @@
 
 #include "NetworkSocket.h"
 
+#include <algorithm>
+#include <cstring>
+
+#if defined(Q_OS_LINUX)
+#include <errno.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <unistd.h>
+#endif
+
 #include "../NetworkLogging.h"
+#include "Constants.h"
 
 
 NetworkSocket::NetworkSocket(QObject* parent) :
@@ -67,6 +78,12 @@ QVariant NetworkSocket::socketOption(SocketType socketType, QAbstractSocket::Soc
 void NetworkSocket::bind(SocketType socketType, const QHostAddress& address, quint16 port) {
     switch (socketType) {
     case SocketType::UDP:
+#if defined(Q_OS_LINUX)
+        if (_shouldReusePort) {
+            bindReusingPort(address, port);
+            break;
+        }
+#endif
         _udpSocket.bind(address, port);
         break;
 #if defined(WEBRTC_DATA_CHANNELS)
@@ -223,6 +240,147 @@ qint64 NetworkSocket::readDatagram(char* data, qint64 maxSize, SockAddr* sockAdd
 }
 
 
+int NetworkSocket::readDatagrams(std::vector<ReceivedDatagram>& datagrams, int maxDatagrams) {
+    datagrams.clear();
+
+    // Read the first datagram the regular way: this keeps UDP and WebRTC reads alternating and, because QUdpSocket
+    // disables its read notifier until the application reads from it, keeps readyRead() coming.
+    qint64 size = pendingDatagramSize();
+    if (size == -1) {
+        return -1;
+    }
+
+    datagrams.emplace_back();
+    auto& first = datagrams.back();
+    first.data = udt::PacketBufferPool::allocate(size);
+    first.size = readDatagram(first.data.get(), size, &first.sockAddr);
+
+    if (maxDatagrams > 1 && _udpSocket.hasPendingDatagrams()) {
+        readUDPDatagramBatch(datagrams, maxDatagrams - 1);
+    }
+
+#if defined(WEBRTC_DATA_CHANNELS)
+    // WebRTC messages are already in pooled buffers, so the rest of them are handed over rather than copied.
+    int remaining = maxDatagrams - (int)datagrams.size();
+    if (remaining > 0) {
+        _webrtcSocket.readDatagrams(datagrams, remaining);
+    }
+#endif
+
+    return (int)datagrams.size();
+}
+
+int NetworkSocket::readUDPDatagramBatch(std::vector<ReceivedDatagram>& datagrams, int maxDatagrams) {
+#if defined(Q_OS_LINUX)
+    auto sd = _udpSocket.socketDescriptor();
+    if (sd == -1) {
+        return 0;
+    }
+
+    return readDatagramBatch(sd, _receiveBuffers, datagrams, maxDatagrams, MSG_DONTWAIT);
+#else
+    Q_UNUSED(datagrams);
+    Q_UNUSED(maxDatagrams);
+    return 0;
+#endif
+}
+
+#if defined(Q_OS_LINUX)
+int NetworkSocket::readDatagramBatch(qintptr sd, ReceiveBuffers& buffers, std::vector<ReceivedDatagram>& datagrams,
+                                     int maxDatagrams, int flags) {
+    int numBuffers = std::min(maxDatagrams, MAX_DATAGRAMS_PER_BATCH);
+
+    std::array<mmsghdr, MAX_DATAGRAMS_PER_BATCH> messages;
+    std::array<iovec, MAX_DATAGRAMS_PER_BATCH> ioVectors;
+    std::array<sockaddr_storage, MAX_DATAGRAMS_PER_BATCH> addresses;
+
+    for (int i = 0; i < numBuffers; ++i) {
+        // replace any buffers that were handed off by the previous batch
+        if (!buffers[i]) {
+            buffers[i] = udt::PacketBufferPool::allocate(udt::MAX_PACKET_SIZE);
+        }
+
+        ioVectors[i].iov_base = buffers[i].get();
+        ioVectors[i].iov_len = udt::MAX_PACKET_SIZE;
+
+        memset(&messages[i], 0, sizeof(mmsghdr));
+        messages[i].msg_hdr.msg_iov = &ioVectors[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+        messages[i].msg_hdr.msg_name = &addresses[i];
+        messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+    }
+
+    int numRead = recvmmsg((int)sd, messages.data(), numBuffers, flags, nullptr);
+    if (numRead <= 0) {
+        return 0;
+    }
+
+    int numAdded = 0;
+    for (int i = 0; i < numRead; ++i) {
+        if (messages[i].msg_hdr.msg_flags & MSG_TRUNC) {
+            // larger than any packet we could have sent - drop it and keep the buffer for the next batch
+            continue;
+        }
+
+        datagrams.emplace_back();
+        auto& datagram = datagrams.back();
+        datagram.data = std::move(buffers[i]);
+        datagram.size = messages[i].msg_len;
+
+        const auto address = reinterpret_cast<const sockaddr*>(&addresses[i]);
+        quint16 port = 0;
+        if (address->sa_family == AF_INET) {
+            port = ntohs(reinterpret_cast<const sockaddr_in*>(address)->sin_port);
+        } else if (address->sa_family == AF_INET6) {
+            port = ntohs(reinterpret_cast<const sockaddr_in6*>(address)->sin6_port);
+        }
+        datagram.sockAddr = SockAddr(SocketType::UDP, QHostAddress(address), port);
+        ++numAdded;
+    }
+
+    return numAdded;
+}
+
+qintptr NetworkSocket::openReusingPort(const QHostAddress& address, quint16 port) {
+    int sd = ::socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+    if (sd == -1) {
+        qCWarning(networking) << "Could not create UDP socket to share port" << port << "-" << strerror(errno);
+        return -1;
+    }
+
+    int reusePort = 1;
+    if (setsockopt(sd, SOL_SOCKET, SO_REUSEPORT, &reusePort, sizeof(reusePort)) == -1) {
+        qCWarning(networking) << "Could not set SO_REUSEPORT on UDP socket -" << strerror(errno);
+    }
+
+    sockaddr_in bindAddress;
+    memset(&bindAddress, 0, sizeof(sockaddr_in));
+    bindAddress.sin_family = AF_INET;
+    bindAddress.sin_addr.s_addr = htonl(address.toIPv4Address());
+    bindAddress.sin_port = htons(port);
+
+    if (::bind(sd, reinterpret_cast<sockaddr*>(&bindAddress), sizeof(sockaddr_in)) == -1) {
+        qCWarning(networking) << "Could not bind UDP socket to" << address << port << "-" << strerror(errno);
+        ::close(sd);
+        return -1;
+    }
+
+    return sd;
+}
+
+void NetworkSocket::bindReusingPort(const QHostAddress& address, quint16 port) {
+    auto sd = openReusingPort(address, port);
+    if (sd == -1 || !_udpSocket.setSocketDescriptor(sd, QAbstractSocket::BoundState)) {
+        if (sd != -1) {
+            ::close((int)sd);
+        }
+        qCWarning(networking) << "Falling back to a UDP socket that does not share its port";
+        _udpSocket.bind(address, port);
+    }
+}
+#endif
+
+
 QAbstractSocket::SocketState NetworkSocket::state(SocketType socketType) const {
     switch (socketType) {
     case SocketType::UDP:
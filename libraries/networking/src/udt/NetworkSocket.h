@@ -9,6 +9,10 @@
 #ifndef vircadia_NetworkSocket_h
 #define vircadia_NetworkSocket_h
 
+#include <array>
+#include <memory>
+#include <vector>
+
 #include <QObject>
 #include <QUdpSocket>
 
@@ -17,6 +21,8 @@
 #include "../SockAddr.h"
 #include "../NodeType.h"
 #include "../SocketType.h"
+#include "PacketBufferPool.h"
+#include "ReceivedDatagram.h"
 #if defined(WEBRTC_DATA_CHANNELS)
 #include "../webrtc/WebRTCSocket.h"
 #endif
@@ -102,6 +108,46 @@ public:
     /// @return The number of bytes if successfully read, otherwise <code>-1</code>.
     qint64 readDatagram(char* data, qint64 maxSize, SockAddr* sockAddr = nullptr);
 
+    /// @brief Reads a batch of pending datagrams, using as few system calls as possible.
+    /// @details The first datagram is read per readDatagram so that socket types continue to alternate and so that Qt's
+    /// read notifier is re-armed. On Linux, further UDP datagrams are then drained with a single <code>recvmmsg</code>
+    /// call into a ring of MTU-sized buffers from the PacketBufferPool; elsewhere only the one UDP datagram is read.
+    /// Pending WebRTC datagrams, which are received into PacketBufferPool buffers, are then handed over without a copy.
+    /// @param datagrams The vector to write the datagrams read into. It is cleared first, releasing any buffers that
+    /// weren't taken by the caller.
+    /// @param maxDatagrams The maximum number of datagrams to read.
+    /// @return The number of datagrams read if successful, <code>-1</code> if there was no pending datagram to read.
+    int readDatagrams(std::vector<ReceivedDatagram>& datagrams, int maxDatagrams);
+
+    /// @brief The maximum number of datagrams that readDatagrams reads with a single system call.
+    static const int MAX_DATAGRAMS_PER_BATCH = 64;
+
+    /// @brief Sets whether the UDP socket is bound with <code>SO_REUSEPORT</code> so that further sockets can share its
+    /// port, the kernel spreading received datagrams across them by sender. Linux only; must be set before binding.
+    /// @param shouldReusePort <code>true</code> to share the UDP port, <code>false</code> to bind it exclusively.
+    void setShouldReusePort(bool shouldReusePort) { _shouldReusePort = shouldReusePort; }
+
+#if defined(Q_OS_LINUX)
+    using ReceiveBuffers = std::array<udt::PacketBuffer, MAX_DATAGRAMS_PER_BATCH>;
+
+    /// @brief Reads a batch of UDP datagrams from a native socket with a single <code>recvmmsg</code> call.
+    /// @param socketDescriptor The native socket to read from.
+    /// @param buffers The ring of buffers to read into. Buffers handed out in <code>datagrams</code> are replaced on
+    /// the next read.
+    /// @param datagrams The vector to append the datagrams read to.
+    /// @param maxDatagrams The maximum number of datagrams to read.
+    /// @param flags The <code>recvmmsg</code> flags, e.g., <code>MSG_DONTWAIT</code>.
+    /// @return The number of datagrams appended.
+    static int readDatagramBatch(qintptr socketDescriptor, ReceiveBuffers& buffers, std::vector<ReceivedDatagram>& datagrams,
+                                 int maxDatagrams, int flags);
+
+    /// @brief Opens a non-blocking UDP socket bound with <code>SO_REUSEPORT</code>.
+    /// @param address The address to bind to.
+    /// @param port The port to bind to.
+    /// @return The native socket descriptor if successful, otherwise <code>-1</code>.
+    static qintptr openReusingPort(const QHostAddress& address, quint16 port);
+#endif
+
     
     /// @brief Gets the state of the UDP or WebRTC socket.
     /// @param socketType The type of socket for which to get the state.
@@ -151,6 +197,11 @@ private slots:
 
 private:
 
+    int readUDPDatagramBatch(std::vector<ReceivedDatagram>& datagrams, int maxDatagrams);
+#if defined(Q_OS_LINUX)
+    void bindReusingPort(const QHostAddress& address, quint16 port);
+#endif
+
     QObject* _parent;
 
     QUdpSocket _udpSocket;
@@ -162,6 +213,9 @@ private:
     SocketType _pendingDatagramSizeSocketType { SocketType::Unknown };
     SocketType _lastSocketTypeRead { SocketType::Unknown };
 #endif
+
+    std::array<udt::PacketBuffer, MAX_DATAGRAMS_PER_BATCH> _receiveBuffers;
+    bool _shouldReusePort { false };
 };
 
 
@@ -0,0 +1,153 @@
+//
+//  PacketBufferPool.cpp
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PacketBufferPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#include <MemoryAccounting.h>
+
+#include "Constants.h"
+
+using namespace udt;
+
+const int PacketBufferPool::BUFFER_SIZE = MAX_PACKET_SIZE;
+
+namespace {
+
+// buffers a thread keeps for itself before it hands some to the shared list
+const size_t MAX_THREAD_FREE_BUFFERS = 128;
+// buffers moved between a thread's list and the shared list in one go
+const size_t TRANSFER_BATCH_SIZE = MAX_THREAD_FREE_BUFFERS / 2;
+// beyond this the shared list gives memory back to the heap (roughly 6 MB of buffers)
+const size_t MAX_SHARED_FREE_BUFFERS = 4096;
+
+std::atomic<uint64_t> numHits { 0 };
+std::atomic<uint64_t> numMisses { 0 };
+std::atomic<uint64_t> numOversized { 0 };
+
+struct SharedFreeList {
+    std::mutex mutex;
+    std::vector<char*> buffers;
+};
+
+SharedFreeList& sharedFreeList() {
+    // never destroyed, threads may still return buffers while static objects are torn down
+    static SharedFreeList* list = new SharedFreeList();
+    return *list;
+}
+
+struct ThreadFreeList {
+    std::vector<char*> buffers;
+
+    ThreadFreeList() { buffers.reserve(MAX_THREAD_FREE_BUFFERS); }
+
+    ~ThreadFreeList() {
+        // give what we have to the threads that are still around
+        auto& shared = sharedFreeList();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        for (auto buffer : buffers) {
+            if (shared.buffers.size() < MAX_SHARED_FREE_BUFFERS) {
+                shared.buffers.push_back(buffer);
+            } else {
+                delete[] buffer;
+                MemoryAccounting::remove(MemoryAccounting::PacketBuffers, PacketBufferPool::BUFFER_SIZE);
+            }
+        }
+    }
+};
+
+ThreadFreeList& threadFreeList() {
+    thread_local ThreadFreeList list;
+    return list;
+}
+
+}
+
+void PacketBufferDeleter::operator()(char* buffer) const {
+    if (isPooled) {
+        PacketBufferPool::release(buffer);
+    } else {
+        delete[] buffer;
+    }
+}
+
+PacketBuffer PacketBufferPool::allocate(qint64 size, bool zeroed) {
+    if (size > BUFFER_SIZE) {
+        ++numOversized;
+        return PacketBuffer(zeroed ? new char[size]() : new char[size]);
+    }
+
+    auto& local = threadFreeList().buffers;
+
+    if (local.empty()) {
+        // top up from the buffers other threads have freed
+        auto& shared = sharedFreeList();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        auto count = std::min(TRANSFER_BATCH_SIZE, shared.buffers.size());
+        local.insert(local.end(), shared.buffers.end() - count, shared.buffers.end());
+        shared.buffers.resize(shared.buffers.size() - count);
+    }
+
+    char* buffer;
+    if (!local.empty()) {
+        ++numHits;
+        buffer = local.back();
+        local.pop_back();
+    } else {
+        ++numMisses;
+        buffer = new char[BUFFER_SIZE];
+        MemoryAccounting::add(MemoryAccounting::PacketBuffers, BUFFER_SIZE);
+    }
+
+    if (zeroed) {
+        memset(buffer, 0, size);
+    }
+
+    return PacketBuffer(buffer, PacketBufferDeleter { true });
+}
+
+void PacketBufferPool::release(char* buffer) {
+    auto& local = threadFreeList().buffers;
+
+    if (local.size() >= MAX_THREAD_FREE_BUFFERS) {
+        // this thread frees more than it allocates, hand half to the shared list
+        auto& shared = sharedFreeList();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        for (size_t i = 0; i < TRANSFER_BATCH_SIZE; ++i) {
+            if (shared.buffers.size() < MAX_SHARED_FREE_BUFFERS) {
+                shared.buffers.push_back(local.back());
+            } else {
+                delete[] local.back();
+                MemoryAccounting::remove(MemoryAccounting::PacketBuffers, BUFFER_SIZE);
+            }
+            local.pop_back();
+        }
+    }
+
+    local.push_back(buffer);
+}
+
+PacketBufferPool::Stats PacketBufferPool::sampleStats() {
+    Stats stats;
+    stats.hits = numHits.exchange(0);
+    stats.misses = numMisses.exchange(0);
+    stats.oversized = numOversized.exchange(0);
+    {
+        auto& shared = sharedFreeList();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        stats.shared = shared.buffers.size();
+    }
+    return stats;
+}
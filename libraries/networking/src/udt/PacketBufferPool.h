@@ -0,0 +1,63 @@
+//
+//  PacketBufferPool.h
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_PacketBufferPool_h
+#define vircadia_PacketBufferPool_h
+
+#include <cstdint>
+#include <memory>
+
+#include <QtCore/QtGlobal>
+
+namespace udt {
+
+// Returns a buffer to the PacketBufferPool if it came from there, otherwise deletes it.
+struct PacketBufferDeleter {
+    bool isPooled { false };
+
+    void operator()(char* buffer) const;
+};
+
+// The memory behind a BasePacket.
+using PacketBuffer = std::unique_ptr<char[], PacketBufferDeleter>;
+
+// Recycles MTU-sized packet buffers so that creating and receiving packets does not hit the heap.
+// Each thread keeps a small free list of its own; buffers freed on a different thread than the one that allocated them
+// (the usual case for received packets) overflow to a shared free list that other threads refill from in batches.
+class PacketBufferPool {
+public:
+    struct Stats {
+        uint64_t hits { 0 };      // allocations served from a free list
+        uint64_t misses { 0 };    // allocations that had to go to the heap
+        uint64_t oversized { 0 }; // allocations too large for a pooled buffer
+        uint64_t shared { 0 };    // buffers currently waiting in the shared free list
+    };
+
+    // the size of every pooled buffer - enough for any packet we send or receive
+    static const int BUFFER_SIZE;
+
+    // allocates a buffer of at least size bytes, from the pool when size fits in BUFFER_SIZE
+    // the contents are uninitialized unless zeroed is set
+    static PacketBuffer allocate(qint64 size, bool zeroed = false);
+
+    // wraps a buffer allocated with new[] so that it can be handed to a packet
+    static PacketBuffer adopt(std::unique_ptr<char[]> buffer) { return PacketBuffer(buffer.release()); }
+
+    // counts since the last call, except for shared which is the current count
+    static Stats sampleStats();
+
+private:
+    friend PacketBufferDeleter;
+    static void release(char* buffer);
+};
+
+}
+
+#endif // vircadia_PacketBufferPool_h
@@ -140,6 +140,8 @@ public:
         StopInjector,
         AvatarZonePresence,
         WebRTCSignaling,
+        AudioForwardErrorCorrection,
+        MixedAudioWithSources,
         NUM_PACKET_TYPE
     };
 
@@ -290,6 +292,7 @@ enum class EntityVersion : PacketVersion {
     UserAgent,
     AllBillboardMode,
     TextAlignment,
+    LodProxyDistance,
 
     // Add new versions above here
     NUM_PACKET_TYPE,
@@ -307,14 +310,16 @@ enum class EntityQueryPacketVersion: PacketVersion {
     ConnectionIdentifier = 20,
     RemovedJurisdictions = 21,
     MultiFrustumQuery = 22,
-    ConicalFrustums = 23
+    ConicalFrustums = 23,
+    CompressionDictionary = 24
 };
 
 enum class AssetServerPacketVersion: PacketVersion {
     VegasCongestionControl = 19,
     RangeRequestSupport,
     RedirectedMappings,
-    BakingTextureMeta
+    BakingTextureMeta,
+    MappingPages
 };
 
 enum class AvatarMixerPacketVersion : PacketVersion {
@@ -355,7 +360,8 @@ enum class AvatarMixerPacketVersion : PacketVersion {
     FBXJointOrderChange,
     HandControllerSection,
     SendVerificationFailed,
-    ARKitBlendshapes
+    ARKitBlendshapes,
+    JointRotationDeltas
 };
 
 enum class DomainConnectRequestVersion : PacketVersion {
@@ -374,7 +380,8 @@ enum class DomainConnectRequestVersion : PacketVersion {
 
 enum class DomainListRequestVersion : PacketVersion {
     PreSocketTypes = 22,
-    SocketTypes
+    SocketTypes,
+    HasDomainListVersion
 };
 
 enum class DomainConnectionDeniedVersion : PacketVersion {
@@ -397,7 +404,9 @@ enum class DomainListVersion : PacketVersion {
     AuthenticationOptional,
     HasTimestamp,
     HasConnectReason,
-    SocketTypes
+    SocketTypes,
+    DeltaUpdates,
+    SipHashVerification
 };
 
 enum class AudioVersion : PacketVersion {
@@ -408,7 +417,9 @@ enum class AudioVersion : PacketVersion {
     SpaceBubbleChanges,
     HasPersonalMute,
     HighDynamicRangeVolume,
-    StopInjectors
+    StopInjectors,
+    ForwardErrorCorrection,
+    OffloadedSources
 };
 
 enum class MessageDataVersion : PacketVersion {
@@ -428,4 +439,8 @@ enum class AvatarQueryVersion : PacketVersion {
     ConicalFrustums = 22
 };
 
+enum class AssignmentClientStatusVersion : PacketVersion {
+    HasLoad = 23
+};
+
 #endif // hifi_PacketHeaders_h
@@ -0,0 +1,110 @@
+//
+//  ReceiveShard.cpp
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ReceiveShard.h"
+
+#include <algorithm>
+
+#include <QtCore/QProcessEnvironment>
+
+#include <ThreadHelpers.h>
+
+#include "../NetworkLogging.h"
+#include "Constants.h"
+
+#if defined(Q_OS_LINUX)
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+using namespace udt;
+
+static const QString RECEIVE_SHARDS_ENV = "VIRCADIA_UDT_RECEIVE_SHARDS";
+
+// how long a shard waits for datagrams before checking whether it should stop
+static const int SHARD_POLL_TIMEOUT_MSECS = 100;
+
+int ReceiveShard::getNumShards() {
+#if defined(Q_OS_LINUX)
+    static const int numShards = std::max(1, QProcessEnvironment::systemEnvironment().value(RECEIVE_SHARDS_ENV).toInt());
+    return numShards;
+#else
+    return 1;
+#endif
+}
+
+ReceiveShard::ReceiveShard(int index, const QHostAddress& address, quint16 port, DatagramsHandler handler) :
+    _index(index),
+    _handler(handler)
+{
+#if defined(Q_OS_LINUX)
+    _socketDescriptor = NetworkSocket::openReusingPort(address, port);
+    if (_socketDescriptor == -1) {
+        qCWarning(networking) << "Receive shard" << _index << "could not share port" << port;
+        return;
+    }
+
+    // shards only receive, so only their receive buffers need to match the Socket's
+    int receiveBufferSize = udt::UDP_RECEIVE_BUFFER_SIZE_BYTES;
+    setsockopt((int)_socketDescriptor, SOL_SOCKET, SO_RCVBUF, &receiveBufferSize, sizeof(receiveBufferSize));
+
+    _thread = std::thread([this] {
+        setThreadName("Networking: ReceiveShard " + std::to_string(_index));
+        run();
+    });
+#else
+    Q_UNUSED(address);
+    Q_UNUSED(port);
+#endif
+}
+
+ReceiveShard::~ReceiveShard() {
+    _isStopping = true;
+
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+
+#if defined(Q_OS_LINUX)
+    if (_socketDescriptor != -1) {
+        ::close((int)_socketDescriptor);
+    }
+#endif
+}
+
+void ReceiveShard::run() {
+#if defined(Q_OS_LINUX)
+    NetworkSocket::ReceiveBuffers buffers;
+    std::vector<ReceivedDatagram> datagrams;
+    datagrams.reserve(NetworkSocket::MAX_DATAGRAMS_PER_BATCH);
+
+    pollfd pollDescriptor;
+    pollDescriptor.fd = (int)_socketDescriptor;
+    pollDescriptor.events = POLLIN;
+
+    while (!_isStopping) {
+        pollDescriptor.revents = 0;
+        if (poll(&pollDescriptor, 1, SHARD_POLL_TIMEOUT_MSECS) <= 0) {
+            continue;
+        }
+
+        // drain the socket before going back to poll
+        do {
+            datagrams.clear();
+            NetworkSocket::readDatagramBatch(_socketDescriptor, buffers, datagrams,
+                                             NetworkSocket::MAX_DATAGRAMS_PER_BATCH, MSG_DONTWAIT);
+            if (!datagrams.empty()) {
+                _handler(datagrams);
+            }
+        } while ((int)datagrams.size() == NetworkSocket::MAX_DATAGRAMS_PER_BATCH && !_isStopping);
+    }
+#endif
+}
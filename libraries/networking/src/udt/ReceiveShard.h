@@ -0,0 +1,56 @@
+//
+//  ReceiveShard.h
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_ReceiveShard_h
+#define vircadia_ReceiveShard_h
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include <QtNetwork/QHostAddress>
+
+#include "NetworkSocket.h"
+
+namespace udt {
+
+// An extra UDP socket bound to the same port as a Socket's own (with SO_REUSEPORT) and the thread that reads it.
+// The kernel hashes each sender to one of the sockets sharing the port, so a sender's datagrams always arrive on the
+// same shard and stay in order. Each batch of datagrams read is handed to the handler on the shard's thread.
+class ReceiveShard {
+public:
+    using DatagramsHandler = std::function<void(std::vector<ReceivedDatagram>& datagrams)>;
+
+    // returns the number of sockets, including the Socket's own, to spread receives across - set with the
+    // VIRCADIA_UDT_RECEIVE_SHARDS environment variable, 1 (no sharding) if unset or unsupported on this platform
+    static int getNumShards();
+
+    ReceiveShard(int index, const QHostAddress& address, quint16 port, DatagramsHandler handler);
+    ~ReceiveShard();
+
+    bool isBound() const { return _socketDescriptor != -1; }
+
+private:
+    Q_DISABLE_COPY(ReceiveShard)
+
+    void run();
+
+    int _index;
+    qintptr _socketDescriptor { -1 };
+    DatagramsHandler _handler;
+
+    std::atomic<bool> _isStopping { false };
+    std::thread _thread;
+};
+
+}
+
+#endif // vircadia_ReceiveShard_h
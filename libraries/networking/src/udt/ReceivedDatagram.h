@@ -0,0 +1,33 @@
+//
+//  ReceivedDatagram.h
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_ReceivedDatagram_h
+#define vircadia_ReceivedDatagram_h
+
+#include <QtGlobal>
+
+#include "../SockAddr.h"
+#include "PacketBufferPool.h"
+
+/// @addtogroup Networking
+/// @{
+
+
+/// @brief A datagram read from a NetworkSocket by NetworkSocket::readDatagrams, or received on a WebRTC data channel.
+struct ReceivedDatagram {
+    udt::PacketBuffer data;        ///< The datagram's data. Ownership may be taken by the reader.
+    qint64 size { -1 };            ///< The number of bytes read, or <code>-1</code> if the datagram could not be read.
+    SockAddr sockAddr;             ///< The network address the datagram was received from.
+};
+
+
+/// @}
+
+#endif // vircadia_ReceivedDatagram_h
@@ -30,6 +30,7 @@
 #include "PacketList.h"
 #include "../UserActivityLogger.h"
 #include "Socket.h"
+#include "SendQueuePool.h"
 #include <Trace.h>
 #include <Profile.h>
 #include <ThreadHelpers.h>
@@ -73,6 +74,13 @@ std::unique_ptr<SendQueue> SendQueue::create(Socket* socket, SockAddr destinatio
     auto queue = std::unique_ptr<SendQueue>(new SendQueue(socket, destination, currentSequenceNumber,
                                                           currentMessageNumber, hasReceivedHandshakeACK));
 
+    if (SendQueuePool::isEnabled()) {
+        // the queue stays on the connection's thread and the pool's workers do the sending
+        queue->_isPooled = true;
+        SendQueuePool::getInstance().add(queue.get());
+        return queue;
+    }
+
     // Setup queue private thread
     QThread* thread = new QThread();
     QString name = "Networking: SendQueue " + destination.objectName();
@@ -114,8 +122,9 @@ void SendQueue::queuePacket(std::unique_ptr<Packet> packet) {
     
     // call notify_one on the condition_variable_any in case the send thread is sleeping waiting for packets
     _emptyCondition.notify_one();
+    wakePool();
     
-    if (!thread()->isRunning() && _state == State::NotStarted) {
+    if (!_isPooled && !thread()->isRunning() && _state == State::NotStarted) {
         thread()->start();
     }
 }
@@ -125,8 +134,9 @@ void SendQueue::queuePacketList(std::unique_ptr<PacketList> packetList) {
     
     // call notify_one on the condition_variable_any in case the send thread is sleeping waiting for packets
     _emptyCondition.notify_one();
+    wakePool();
     
-    if (!thread()->isRunning() && _state == State::NotStarted) {
+    if (!_isPooled && !thread()->isRunning() && _state == State::NotStarted) {
         thread()->start();
     }
 }
@@ -138,38 +148,110 @@ void SendQueue::stop() {
     // Notify all conditions in case we're waiting somewhere
     _handshakeACKCondition.notify_one();
     _emptyCondition.notify_one();
+    wakePool();
+}
+
+void SendQueue::wakePool() {
+    if (_isPooled) {
+        SendQueuePool::getInstance().wake(this);
+    }
 }
     
 int SendQueue::sendPacket(const Packet& packet) {
     _lastPacketSentAt = std::chrono::high_resolution_clock::now();
+    std::lock_guard<std::mutex> destinationLock(_destinationMutex);
     return _socket->writeDatagram(packet.getData(), packet.getDataSize(), _destination);
 }
     
-void SendQueue::ack(SequenceNumber ack) {
-    if (_lastACKSequenceNumber == (uint32_t) ack) {
+// a gap is taken as a loss once this many packets sent after it have been selectively ACKed
+static const int SELECTIVE_ACK_LOSS_THRESHOLD = 3;
+
+void SendQueue::ack(SequenceNumber ack, const SelectiveACK& selectiveACK) {
+    bool isNewACK = _lastACKSequenceNumber != (uint32_t) ack;
+
+    if (!isNewACK && selectiveACK.numWords == 0) {
         return;
     }
-    
+
+    _selectivelyACKed.clear();
+    _inferredLosses.clear();
+
     {
-        // remove any ACKed packets from the map of sent packets
         QWriteLocker locker(&_sentLock);
-        for (auto seq = SequenceNumber { (uint32_t) _lastACKSequenceNumber }; seq <= ack; ++seq) {
-            _sentPackets.erase(seq);
+
+        if (isNewACK) {
+            // remove any ACKed packets from the list of sent packets
+            _sentPackets.removeUpTo(ack);
+        }
+
+        // drop the packets the receiver already has beyond the ACK so that they aren't re-sent
+        int highestSelectiveACK = -1;
+        for (int bit = 0; bit < selectiveACK.numBits(); ++bit) {
+            if (selectiveACK.isSet(bit)) {
+                auto sequenceNumber = ack + 2 + bit;
+                auto entry = _sentPackets.find(sequenceNumber);
+                if (entry && !entry->isSelectivelyACKed) {
+                    entry->isSelectivelyACKed = true;
+                    entry->packet.reset();
+                    _selectivelyACKed.push_back(sequenceNumber);
+                }
+                highestSelectiveACK = bit;
+            }
+        }
+
+        // anything still missing with enough selectively ACKed packets after it was lost, rather than re-ordered
+        // ACK + 1 is bit -1, it is always missing
+        int receivedAfter = 0;
+        for (int bit = highestSelectiveACK; bit >= -1; --bit) {
+            if (bit >= 0 && selectiveACK.isSet(bit)) {
+                ++receivedAfter;
+            } else if (receivedAfter >= SELECTIVE_ACK_LOSS_THRESHOLD) {
+                auto sequenceNumber = ack + 2 + bit;
+                auto entry = _sentPackets.find(sequenceNumber);
+                if (entry && entry->packet && !entry->isQueuedForResend) {
+                    entry->isQueuedForResend = true;
+                    _inferredLosses.push_back(sequenceNumber);
+                }
+            }
         }
     }
-    
+
     {   // remove any sequence numbers equal to or lower than this ACK in the loss list
         std::lock_guard<std::mutex> nakLocker(_naksLock);
         
         if (!_naks.isEmpty() && _naks.getFirstSequenceNumber() <= ack) {
             _naks.remove(_naks.getFirstSequenceNumber(), ack);
         }
+
+        for (auto sequenceNumber : _selectivelyACKed) {
+            _naks.remove(sequenceNumber);
+        }
+
+        for (auto sequenceNumber : _inferredLosses) {
+            _naks.insert(sequenceNumber, sequenceNumber);
+        }
     }
     
     _lastACKSequenceNumber = (uint32_t) ack;
 
     // call notify_one on the condition_variable_any in case the send thread is sleeping with a full congestion window
     _emptyCondition.notify_one();
+    wakePool();
+}
+
+void SendQueue::queueUnacknowledgedForResend() {
+    Q_ASSERT_X(_naks.isEmpty(), "SendQueue::queueUnacknowledgedForResend()", "Loss list should be empty on timeout");
+
+    QWriteLocker locker(&_sentLock);
+
+    auto end = _currentSequenceNumber + 1;
+    for (auto sequenceNumber = SequenceNumber(_lastACKSequenceNumber) + 1; sequenceNumber != end; ++sequenceNumber) {
+        auto entry = _sentPackets.find(sequenceNumber);
+        if (entry && entry->packet) {
+            entry->isQueuedForResend = true;
+            _naks.append(sequenceNumber);
+        }
+    }
 }
 
 void SendQueue::fastRetransmit(udt::SequenceNumber ack) {
@@ -180,18 +262,25 @@ void SendQueue::fastRetransmit(udt::SequenceNumber ack) {
 
     // call notify_one on the condition_variable_any in case the send thread is sleeping waiting for losses to re-send
     _emptyCondition.notify_one();
+    wakePool();
+}
+
+void SendQueue::sendHandshakeRequest() {
+    // if the handshake hasn't been completed, then the initial sequence number
+    // should be the current sequence number + 1
+    SequenceNumber initialSequenceNumber = _currentSequenceNumber + 1;
+    auto handshakePacket = ControlPacket::create(ControlPacket::Handshake, sizeof(SequenceNumber));
+    handshakePacket->writePrimitive(initialSequenceNumber);
+
+    std::lock_guard<std::mutex> destinationLock(_destinationMutex);
+    _socket->writeBasePacket(*handshakePacket, _destination);
 }
 
 void SendQueue::sendHandshake() {
     std::unique_lock<std::mutex> handshakeLock { _handshakeMutex };
     if (!_hasReceivedHandshakeACK) {
         // we haven't received a handshake ACK from the client, send another now
-        // if the handshake hasn't been completed, then the initial sequence number
-        // should be the current sequence number + 1
-        SequenceNumber initialSequenceNumber = _currentSequenceNumber + 1;
-        auto handshakePacket = ControlPacket::create(ControlPacket::Handshake, sizeof(SequenceNumber));
-        handshakePacket->writePrimitive(initialSequenceNumber);
-        _socket->writeBasePacket(*handshakePacket, _destination);
+        sendHandshakeRequest();
         
         // we wait for the ACK or the re-send interval to expire
         static const auto HANDSHAKE_RESEND_INTERVAL = std::chrono::milliseconds(100);
@@ -207,6 +296,7 @@ void SendQueue::handshakeACK() {
 
     // Notify on the handshake ACK condition
     _handshakeACKCondition.notify_one();
+    wakePool();
 }
 
 SequenceNumber SendQueue::getNextSequenceNumber() {
@@ -229,11 +319,8 @@ bool SendQueue::sendNewPacketAndAddToSentList(std::unique_ptr<Packet> newPacket,
     {
         // Insert the packet we have just sent in the sent list
         QWriteLocker locker(&_sentLock);
-        auto& entry = _sentPackets[newPacket->getSequenceNumber()];
-        entry.first = 0; // No resend
-        entry.second.swap(newPacket);
+        _sentPackets.append(sequenceNumber, std::move(newPacket));
     }
-    Q_ASSERT_X(!newPacket, "SendQueue::sendNewPacketAndAddToSentList()", "Overriden packet in sent list");
 
     if (bytesWritten < 0) {
         // this is a short-circuit loss - we failed to put this packet on the wire
@@ -359,6 +446,137 @@ void SendQueue::run() {
     }
 }
 
+bool SendQueue::service(p_high_resolution_clock::time_point& nextServiceTime) {
+    auto now = p_high_resolution_clock::now();
+
+    if (_state == State::NotStarted) {
+        _state = State::Running;
+    }
+
+    if (_state != State::Running) {
+        return false;
+    }
+
+    if (!_hasReceivedHandshakeACK) {
+        if (now >= _nextHandshakeTimestamp) {
+            sendHandshakeRequest();
+
+            static const auto HANDSHAKE_RESEND_INTERVAL = std::chrono::milliseconds(100);
+            _nextHandshakeTimestamp = now + HANDSHAKE_RESEND_INTERVAL;
+        }
+
+        // handshakeACK() will wake us before the re-send if the ACK comes in
+        nextServiceTime = _nextHandshakeTimestamp;
+        _nextPacketTimestamp = now;
+        return true;
+    }
+
+    bool attemptedToSendPacket = maybeResendPacket();
+
+    auto newPacketCount = 0;
+    if (!attemptedToSendPacket) {
+        newPacketCount = maybeSendNewPacket();
+        attemptedToSendPacket = (newPacketCount > 0);
+    }
+
+    if (_state != State::Running) {
+        return false;
+    }
+
+    if (!attemptedToSendPacket) {
+        return checkInactivity(now, nextServiceTime);
+    }
+
+    _idleSince = p_high_resolution_clock::time_point();
+
+    if (_packetSendPeriod > 0) {
+        // pace the same way run() does, without letting nextPacketTimestamp push us out by more than one delta
+        auto nextPacketDelta = std::chrono::microseconds((newPacketCount == 2 ? 2 : 1) * _packetSendPeriod);
+        _nextPacketTimestamp += nextPacketDelta;
+
+        if (_nextPacketTimestamp - now > nextPacketDelta) {
+            _nextPacketTimestamp = now + nextPacketDelta;
+        }
+
+        nextServiceTime = _nextPacketTimestamp;
+    } else {
+        _nextPacketTimestamp = now;
+        nextServiceTime = now;
+    }
+
+    return true;
+}
+
+bool SendQueue::checkInactivity(p_high_resolution_clock::time_point now,
+                                p_high_resolution_clock::time_point& nextServiceTime) {
+    // the non-blocking equivalent of isInactive(), waking is left to the pool
+
+    std::unique_lock<std::recursive_mutex> packetsLocker(_packets.getLock(), std::defer_lock);
+    std::unique_lock<std::mutex> naksLocker(_naksLock, std::defer_lock);
+    std::lock(packetsLocker, naksLocker);
+
+    if (!((_packets.isEmpty() || isFlowWindowFull()) && _naks.isEmpty())) {
+        // there is something to send, come straight back
+        _idleSince = p_high_resolution_clock::time_point();
+        nextServiceTime = now;
+        return true;
+    }
+
+    if (_idleSince == p_high_resolution_clock::time_point()) {
+        _idleSince = now;
+    }
+
+    if (uint32_t(_lastACKSequenceNumber) == uint32_t(_currentSequenceNumber)) {
+        // we've sent the client as much data as we have (and they've ACKed it)
+        // either wait for new data to send or 5 seconds before cleaning up the queue
+        static const auto EMPTY_QUEUES_INACTIVE_TIMEOUT = std::chrono::seconds(5);
+
+        if (now - _idleSince >= EMPTY_QUEUES_INACTIVE_TIMEOUT) {
+#ifdef UDT_CONNECTION_DEBUG
+            qCDebug(networking) << "SendQueue to" << _destination << "has been empty for"
+                << EMPTY_QUEUES_INACTIVE_TIMEOUT.count()
+                << "seconds and receiver has ACKed all packets."
+                << "The queue is now inactive and will be stopped.";
+#endif
+            packetsLocker.unlock();
+            naksLocker.unlock();
+
+            deactivate();
+            return false;
+        }
+
+        nextServiceTime = _idleSince + EMPTY_QUEUES_INACTIVE_TIMEOUT;
+        return true;
+    }
+
+    // We think the client is still waiting for data (based on the sequence number gap)
+    // Wait either for a response from the client or until the estimated timeout has elapsed
+    auto estimatedTimeout = std::chrono::microseconds(_estimatedTimeout);
+
+    // Clamp timeout beween 10 ms and 5 s
+    estimatedTimeout = std::min(MAXIMUM_ESTIMATED_TIMEOUT, std::max(MINIMUM_ESTIMATED_TIMEOUT, estimatedTimeout));
+
+    auto sinceLastPacketSent = std::chrono::high_resolution_clock::now() - _lastPacketSentAt;
+
+    if ((now - _idleSince >= estimatedTimeout || sinceLastPacketSent > estimatedTimeout)
+        && SequenceNumber(_lastACKSequenceNumber) < _currentSequenceNumber) {
+        // we still have sent packets that the client hasn't ACKed, add them to the loss list
+        queueUnacknowledgedForResend();
+
+        packetsLocker.unlock();
+        naksLocker.unlock();
+
+        emit timeout();
+
+        _idleSince = p_high_resolution_clock::time_point();
+        nextServiceTime = now;
+        return true;
+    }
+
+    nextServiceTime = _idleSince + estimatedTimeout;
+    return true;
+}
+
 int SendQueue::maybeSendNewPacket() {
     if (!isFlowWindowFull()) {
         // we didn't re-send a packet, so time to send a new one
@@ -399,20 +617,19 @@ bool SendQueue::maybeResendPacket() {
             QReadLocker sentLocker(&_sentLock);
             
             // see if we can find the packet to re-send
-            auto it = _sentPackets.find(resendNumber);
-
-            if (it != _sentPackets.end()) {
+            auto entry = _sentPackets.find(resendNumber);
 
-                auto& entry = it->second;
+            if (entry && entry->packet) {
                 // we found the packet - grab it
-                auto& resendPacket = *(entry.second);
-                ++entry.first; // Add 1 resend
+                auto& resendPacket = *(entry->packet);
+                ++entry->resendCount; // Add 1 resend
 
-                Packet::ObfuscationLevel level = (Packet::ObfuscationLevel)(entry.first < 2 ? 0 : (entry.first - 2) % 4);
+                Packet::ObfuscationLevel level =
+                    (Packet::ObfuscationLevel)(entry->resendCount < 2 ? 0 : (entry->resendCount - 2) % 4);
 
                 auto wireSize = resendPacket.getWireSize();
                 auto payloadSize = resendPacket.getPayloadSize();
-                auto sequenceNumber = it->first;
+                auto sequenceNumber = resendNumber;
 
                 if (level != Packet::NoObfuscation) {
 #ifdef UDT_CONNECTION_DEBUG
@@ -453,7 +670,7 @@ bool SendQueue::maybeResendPacket() {
                 // Signal that we did resend a packet
                 return true;
             } else {
-                // we didn't find this packet in the sentPackets queue - assume this means it was ACKed
+                // we didn't find this packet in the sentPackets queue - assume this means it was (selectively) ACKed
                 // we'll fire the loop again to see if there is another to re-send
                 continue;
             }
@@ -537,7 +754,7 @@ bool SendQueue::isInactive(bool attemptedToSendPacket) {
                     // add them to the loss list
                     
                     // Note that thanks to the DoubleLock we have the _naksLock right now
-                    _naks.append(SequenceNumber(_lastACKSequenceNumber) + 1, _currentSequenceNumber);
+                    queueUnacknowledgedForResend();
 
                     // we have the lock again - time to unlock it
                     locker.unlock();
@@ -563,5 +780,6 @@ bool SendQueue::isFlowWindowFull() const {
 }
 
 void SendQueue::updateDestinationAddress(SockAddr newAddress) {
+    std::lock_guard<std::mutex> destinationLock(_destinationMutex);
     _destination = newAddress;
 }
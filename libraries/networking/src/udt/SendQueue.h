@@ -20,6 +20,7 @@
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include <QtCore/QObject>
 #include <QtCore/QReadWriteLock>
@@ -29,9 +30,11 @@
 #include "../SockAddr.h"
 
 #include "Constants.h"
+#include "ControlPacket.h"
 #include "PacketQueue.h"
 #include "SequenceNumber.h"
 #include "LossList.h"
+#include "SentPacketRing.h"
 
 namespace udt {
     
@@ -40,6 +43,7 @@ class ControlPacket;
 class Packet;
 class PacketList;
 class Socket;
+class SendQueuePool;
     
 class SendQueue : public QObject {
     Q_OBJECT
@@ -69,11 +73,14 @@ public:
     void setPacketSendPeriod(int newPeriod) { _packetSendPeriod = newPeriod; }
     
     void setEstimatedTimeout(int estimatedTimeout) { _estimatedTimeout = estimatedTimeout; }
+
+    // true if this queue is serviced by the SendQueuePool rather than by its own thread
+    bool isPooled() const { return _isPooled; }
     
 public slots:
     void stop();
     
-    void ack(SequenceNumber ack);
+    void ack(SequenceNumber ack, const SelectiveACK& selectiveACK = SelectiveACK());
     void fastRetransmit(SequenceNumber ack);
     void handshakeACK();
     void updateDestinationAddress(SockAddr newAddress);
@@ -95,6 +102,13 @@ private:
               MessageNumber currentMessageNumber, bool hasReceivedHandshakeACK);
     
     void sendHandshake();
+    void sendHandshakeRequest();
+
+    // one pass of run() that never blocks, for the SendQueuePool
+    // returns false once the queue has stopped, otherwise sets when it next wants to be serviced
+    bool service(p_high_resolution_clock::time_point& nextServiceTime);
+    bool checkInactivity(p_high_resolution_clock::time_point now, p_high_resolution_clock::time_point& nextServiceTime);
+    void wakePool();
     
     int sendPacket(const Packet& packet);
     bool sendNewPacketAndAddToSentList(std::unique_ptr<Packet> newPacket, SequenceNumber sequenceNumber);
@@ -102,6 +116,9 @@ private:
     int maybeSendNewPacket(); // Figures out what packet to send next
     bool maybeResendPacket(); // Determines whether to resend a packet and which one
     
+    // adds every sent packet the receiver doesn't have to the empty loss list, expects _naksLock to be held
+    void queueUnacknowledgedForResend();
+
     bool isInactive(bool attemptedToSendPacket);
     void deactivate(); // makes the queue inactive and cleans it up
 
@@ -113,6 +130,7 @@ private:
     PacketQueue _packets;
     
     Socket* _socket { nullptr }; // Socket to send packet on
+    std::mutex _destinationMutex; // Protects the destination addr, which can change from the connection's thread
     SockAddr _destination; // Destination addr
     
     std::atomic<uint32_t> _lastACKSequenceNumber { 0 }; // Last ACKed sequence number
@@ -131,8 +149,11 @@ private:
     LossList _naks; // Sequence numbers of packets to resend
     
     mutable QReadWriteLock _sentLock; // Protects the sent packet list
-    using PacketResendPair = std::pair<uint8_t, std::unique_ptr<Packet>>; // Number of resend + packet ptr
-    std::unordered_map<SequenceNumber, PacketResendPair> _sentPackets; // Packets waiting for ACK.
+    SentPacketRing _sentPackets; // Packets waiting for ACK.
+
+    // scratch space for ack(), only touched from the connection's thread
+    std::vector<SequenceNumber> _selectivelyACKed;
+    std::vector<SequenceNumber> _inferredLosses;
     
     std::mutex _handshakeMutex; // Protects the handshake ACK condition_variable
     std::atomic<bool> _hasReceivedHandshakeACK { false }; // flag for receipt of handshake ACK from client
@@ -142,6 +163,13 @@ private:
 
     std::chrono::high_resolution_clock::time_point _lastPacketSentAt;
 
+    bool _isPooled { false };
+    p_high_resolution_clock::time_point _nextPacketTimestamp; // pooled only, when the next packet should go out
+    p_high_resolution_clock::time_point _nextHandshakeTimestamp; // pooled only, when to re-send the handshake
+    p_high_resolution_clock::time_point _idleSince; // pooled only, when we last found nothing to send
+
+    friend SendQueuePool;
+
     static const std::chrono::microseconds MAXIMUM_ESTIMATED_TIMEOUT;
     static const std::chrono::microseconds MINIMUM_ESTIMATED_TIMEOUT;
 };
@@ -0,0 +1,202 @@
+//
+//  SendQueuePool.cpp
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SendQueuePool.h"
+
+#include <algorithm>
+
+#include <QtCore/QProcessEnvironment>
+#include <QtCore/QThread>
+
+#include <ThreadHelpers.h>
+
+#include "../NetworkLogging.h"
+#include "SendQueue.h"
+#include "Socket.h"
+
+using namespace udt;
+
+static const QString SEND_QUEUE_POOL_ENV = "VIRCADIA_UDT_SEND_QUEUE_POOL";
+
+// the most queues a worker takes in one go, so that one worker doesn't sit on everything that's due
+static const size_t MAX_QUEUES_PER_PASS = 32;
+
+bool SendQueuePool::isEnabled() {
+    static const bool enabled = QProcessEnvironment::systemEnvironment().contains(SEND_QUEUE_POOL_ENV);
+    return enabled;
+}
+
+SendQueuePool& SendQueuePool::getInstance() {
+    static SendQueuePool instance([] {
+        int numThreads = QProcessEnvironment::systemEnvironment().value(SEND_QUEUE_POOL_ENV).toInt();
+        if (numThreads <= 0) {
+            numThreads = std::max(1, QThread::idealThreadCount() / 2);
+        }
+        return numThreads;
+    }());
+    return instance;
+}
+
+SendQueuePool::SendQueuePool(int numThreads) {
+    qCDebug(networking) << "Servicing send queues with a pool of" << numThreads << "threads";
+
+    for (int i = 0; i < numThreads; ++i) {
+        _threads.emplace_back([this, i] {
+            setThreadName("Networking: SendQueuePool " + std::to_string(i));
+            run();
+        });
+    }
+}
+
+SendQueuePool::~SendQueuePool() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _isStopping = true;
+    }
+    _workCondition.notify_all();
+
+    for (auto& thread : _threads) {
+        thread.join();
+    }
+}
+
+void SendQueuePool::add(SendQueue* queue) {
+    auto now = Clock::now();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto& entry = _entries[queue];
+        entry.nextService = now;
+        _schedule.push({ now, queue });
+    }
+    _workCondition.notify_one();
+}
+
+void SendQueuePool::wake(SendQueue* queue) {
+    auto now = Clock::now();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _entries.find(queue);
+        if (it == _entries.end()) {
+            return;
+        }
+
+        auto& entry = it->second;
+        if (entry.inService) {
+            // the worker servicing it will re-schedule it for now once it's done
+            entry.wakeRequested = true;
+            return;
+        } else if (entry.nextService <= now) {
+            // already due
+            return;
+        }
+
+        entry.nextService = now;
+        _schedule.push({ now, queue });
+    }
+    _workCondition.notify_one();
+}
+
+void SendQueuePool::remove(SendQueue* queue) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    auto it = _entries.find(queue);
+    if (it == _entries.end()) {
+        return;
+    }
+
+    _serviceCompleteCondition.wait(lock, [&] {
+        it = _entries.find(queue);
+        return it == _entries.end() || !it->second.inService;
+    });
+
+    if (it != _entries.end()) {
+        _entries.erase(it);
+    }
+}
+
+void SendQueuePool::run() {
+    std::vector<SendQueue*> dueQueues;
+    std::vector<std::pair<bool, Clock::time_point>> results;
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (!_isStopping) {
+        if (_schedule.empty()) {
+            _workCondition.wait(lock);
+            continue;
+        }
+
+        auto now = Clock::now();
+        auto top = _schedule.top();
+        auto it = _entries.find(top.queue);
+        if (it == _entries.end() || it->second.inService || it->second.nextService != top.time) {
+            // stale - the queue was removed, is with another worker or has been re-scheduled
+            _schedule.pop();
+            continue;
+        }
+
+        if (top.time > now) {
+            _workCondition.wait_until(lock, top.time);
+            continue;
+        }
+
+        // take everything that is due
+        dueQueues.clear();
+        while (!_schedule.empty() && _schedule.top().time <= now && dueQueues.size() < MAX_QUEUES_PER_PASS) {
+            auto scheduled = _schedule.top();
+            _schedule.pop();
+
+            auto entryIt = _entries.find(scheduled.queue);
+            if (entryIt != _entries.end() && !entryIt->second.inService && entryIt->second.nextService == scheduled.time) {
+                entryIt->second.inService = true;
+                dueQueues.push_back(scheduled.queue);
+            }
+        }
+
+        // there may be more due than we took, let another worker have them
+        if (!_schedule.empty()) {
+            _workCondition.notify_one();
+        }
+
+        lock.unlock();
+
+        results.resize(dueQueues.size());
+        {
+            // datagrams for all of these queues go out together
+            Socket::BatchedWrites batchedWrites(*dueQueues.front()->_socket);
+
+            for (size_t i = 0; i < dueQueues.size(); ++i) {
+                results[i].first = dueQueues[i]->service(results[i].second);
+            }
+        }
+
+        lock.lock();
+
+        for (size_t i = 0; i < dueQueues.size(); ++i) {
+            auto entryIt = _entries.find(dueQueues[i]);
+            if (entryIt == _entries.end()) {
+                continue;
+            }
+
+            auto& entry = entryIt->second;
+            entry.inService = false;
+
+            if (!results[i].first) {
+                // the queue has stopped, it will be removed by its connection
+                _entries.erase(entryIt);
+                continue;
+            }
+
+            entry.nextService = entry.wakeRequested ? Clock::now() : results[i].second;
+            entry.wakeRequested = false;
+            _schedule.push({ entry.nextService, dueQueues[i] });
+        }
+
+        _serviceCompleteCondition.notify_all();
+    }
+}
@@ -0,0 +1,90 @@
+//
+//  SendQueuePool.h
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_SendQueuePool_h
+#define vircadia_SendQueuePool_h
+
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <QtCore/QtGlobal>
+
+#include <PortableHighResolutionClock.h>
+
+namespace udt {
+
+class SendQueue;
+
+// Services many SendQueues from a small, fixed set of worker threads instead of one thread per queue.
+// Queues are kept in a schedule ordered by the next time each one wants to send; a worker takes every queue that is
+// due, services them together (so their datagrams go out in one Socket::BatchedWrites) and puts them back in the
+// schedule at the time they ask for.
+//
+// Enabled with the VIRCADIA_UDT_SEND_QUEUE_POOL environment variable, set to the number of worker threads or to 0 to
+// use half the available cores.
+class SendQueuePool {
+public:
+    using Clock = p_high_resolution_clock;
+
+    static bool isEnabled();
+    static SendQueuePool& getInstance();
+
+    ~SendQueuePool();
+
+    // starts servicing the queue as soon as a worker is free
+    void add(SendQueue* queue);
+
+    // brings the queue's next service forward to now, e.g. because it has new packets, ACKs or NAKs
+    void wake(SendQueue* queue);
+
+    // stops servicing the queue - blocks while a worker is in the middle of servicing it
+    void remove(SendQueue* queue);
+
+    int getNumThreads() const { return (int)_threads.size(); }
+
+private:
+    SendQueuePool(int numThreads);
+    Q_DISABLE_COPY(SendQueuePool)
+
+    void run();
+
+    struct Entry {
+        Clock::time_point nextService;
+        bool inService { false };
+        bool wakeRequested { false };
+    };
+
+    struct Scheduled {
+        Clock::time_point time;
+        SendQueue* queue;
+
+        bool operator>(const Scheduled& other) const { return time > other.time; }
+    };
+
+    std::mutex _mutex;
+    std::condition_variable _workCondition;
+    std::condition_variable _serviceCompleteCondition;
+
+    std::unordered_map<SendQueue*, Entry> _entries;
+
+    // may hold stale items for queues that were woken or removed, they are skipped when they reach the top
+    std::priority_queue<Scheduled, std::vector<Scheduled>, std::greater<Scheduled>> _schedule;
+
+    std::vector<std::thread> _threads;
+    bool _isStopping { false };
+};
+
+}
+
+#endif // vircadia_SendQueuePool_h
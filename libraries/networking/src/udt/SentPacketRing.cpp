@@ -0,0 +1,81 @@
+//
+//  SentPacketRing.cpp
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SentPacketRing.h"
+
+using namespace udt;
+
+// enough for typical windows without growing, the ring is per connection
+static const size_t INITIAL_CAPACITY = 64;
+
+// sequence numbers wrap at MAX + 1, a power of two, so masking them stays consistent across the wrap
+static_assert(((SequenceNumber::UType)SequenceNumber::MAX & ((SequenceNumber::UType)SequenceNumber::MAX + 1)) == 0,
+              "SequenceNumber::MAX + 1 must be a power of two");
+
+SentPacketRing::SentPacketRing() :
+    _entries(INITIAL_CAPACITY)
+{
+}
+
+SentPacketRing::Entry& SentPacketRing::append(SequenceNumber sequenceNumber, std::unique_ptr<Packet> packet) {
+    if (_count == 0) {
+        _first = sequenceNumber;
+    } else {
+        Q_ASSERT_X(sequenceNumber == _first + _count, "SentPacketRing::append",
+                   "Packets must be appended in sequence number order");
+
+        if (_count == (int)_entries.size()) {
+            grow();
+        }
+    }
+
+    ++_count;
+
+    auto& entry = at(sequenceNumber);
+    entry.packet = std::move(packet);
+    entry.resendCount = 0;
+    entry.isSelectivelyACKed = false;
+    entry.isQueuedForResend = false;
+    return entry;
+}
+
+SentPacketRing::Entry* SentPacketRing::find(SequenceNumber sequenceNumber) {
+    if (_count == 0) {
+        return nullptr;
+    }
+
+    auto offset = seqoff(_first, sequenceNumber);
+    if (offset < 0 || offset >= _count) {
+        return nullptr;
+    }
+
+    return &at(sequenceNumber);
+}
+
+void SentPacketRing::removeUpTo(SequenceNumber sequenceNumber) {
+    while (_count > 0 && _first <= sequenceNumber) {
+        auto& entry = at(_first);
+        entry.packet.reset();
+        ++_first;
+        --_count;
+    }
+}
+
+void SentPacketRing::grow() {
+    std::vector<Entry> entries(_entries.size() * 2);
+    auto mask = entries.size() - 1;
+
+    auto sequenceNumber = _first;
+    for (int i = 0; i < _count; ++i, ++sequenceNumber) {
+        entries[(SequenceNumber::UType)sequenceNumber & mask] = std::move(at(sequenceNumber));
+    }
+
+    _entries.swap(entries);
+}
@@ -0,0 +1,60 @@
+//
+//  SentPacketRing.h
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_SentPacketRing_h
+#define vircadia_SentPacketRing_h
+
+#include <memory>
+#include <vector>
+
+#include "Packet.h"
+#include "SequenceNumber.h"
+
+namespace udt {
+
+// The packets a SendQueue has sent and is waiting on an ACK for. They are sent with consecutive sequence numbers and
+// ACKed from the oldest, so they are kept in a ring indexed by sequence number that grows (in powers of two) to fit
+// whatever is in flight - finding the packet to re-send is a mask rather than a hash lookup.
+class SentPacketRing {
+public:
+    struct Entry {
+        std::unique_ptr<Packet> packet;     // released once the packet is selectively ACKed
+        uint8_t resendCount { 0 };
+        bool isSelectivelyACKed { false };  // the receiver has it, but not everything before it
+        bool isQueuedForResend { false };   // in the loss list, or re-sent since it was last found lost
+    };
+
+    SentPacketRing();
+
+    bool isEmpty() const { return _count == 0; }
+    int getCount() const { return _count; }
+    SequenceNumber getFirstSequenceNumber() const { return _first; }
+
+    // adds a packet sent with the sequence number following the last one added
+    Entry& append(SequenceNumber sequenceNumber, std::unique_ptr<Packet> packet);
+
+    // returns the entry for the sequence number, or nullptr if it isn't waiting on an ACK
+    Entry* find(SequenceNumber sequenceNumber);
+
+    // drops every packet up to and including the sequence number
+    void removeUpTo(SequenceNumber sequenceNumber);
+
+private:
+    Entry& at(SequenceNumber sequenceNumber) { return _entries[(SequenceNumber::UType)sequenceNumber & (_entries.size() - 1)]; }
+    void grow();
+
+    std::vector<Entry> _entries; // size is always a power of two
+    SequenceNumber _first;
+    int _count { 0 };
+};
+
+}
+
+#endif // vircadia_SentPacketRing_h
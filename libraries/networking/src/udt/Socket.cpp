@@ -12,10 +12,14 @@
 
 #include "Socket.h"
 
-#ifdef Q_OS_ANDROID
+#if defined(Q_OS_ANDROID) || defined(Q_OS_LINUX)
 #include <sys/socket.h>
 #endif
 
+#include <array>
+#include <cstring>
+#include <iterator>
+
 #include <QtCore/QThread>
 
 #include <shared/QtHelpers.h>
@@ -39,6 +43,59 @@ using namespace udt;
 #include <netinet/in.h>
 #endif
 
+#if defined(Q_OS_LINUX)
+namespace {
+
+const int MAX_BATCHED_WRITES = 64;
+
+// datagrams gathered by an active Socket::BatchedWrites, waiting for a single sendmmsg
+struct PendingWrites {
+    Socket* socket { nullptr };
+    int count { 0 };
+
+    std::array<std::array<char, udt::MAX_PACKET_SIZE>, MAX_BATCHED_WRITES> buffers;
+    std::array<sockaddr_in, MAX_BATCHED_WRITES> addresses;
+    std::array<iovec, MAX_BATCHED_WRITES> ioVectors;
+    std::array<mmsghdr, MAX_BATCHED_WRITES> messages;
+};
+
+// allocated the first time a thread batches its writes, so threads that never do don't pay for the buffers
+thread_local std::unique_ptr<PendingWrites> pendingWrites;
+
+}
+#endif
+
+Socket::BatchedWrites::BatchedWrites(Socket& socket) :
+    _socket(socket)
+{
+#if defined(Q_OS_LINUX)
+    if (!pendingWrites) {
+        pendingWrites.reset(new PendingWrites());
+    }
+
+    // nested batches on the same thread simply join the outer one
+    if (!pendingWrites->socket) {
+        pendingWrites->socket = &socket;
+        _ownsBatch = true;
+    }
+#endif
+}
+
+Socket::BatchedWrites::~BatchedWrites() {
+    if (_ownsBatch) {
+        flush();
+#if defined(Q_OS_LINUX)
+        pendingWrites->socket = nullptr;
+#endif
+    }
+}
+
+void Socket::BatchedWrites::flush() {
+    if (_ownsBatch) {
+        _socket.flushBatchedWrites();
+    }
+}
+
 
 Socket::Socket(QObject* parent, bool shouldChangeSocketOptions) :
     QObject(parent),
@@ -48,6 +105,9 @@ Socket::Socket(QObject* parent, bool shouldChangeSocketOptions) :
 {
     connect(&_networkSocket, &NetworkSocket::readyRead, this, &Socket::readPendingDatagrams);
 
+    // the UDP socket has to share its port from the start if receive shards are to join it
+    _networkSocket.setShouldReusePort(ReceiveShard::getNumShards() > 1);
+
     // make sure we hear about errors and state changes from the underlying socket
     connect(&_networkSocket, &NetworkSocket::socketError, this, &Socket::handleSocketError);
     connect(&_networkSocket, &NetworkSocket::stateChanged, this, &Socket::handleStateChanged);
@@ -61,6 +121,10 @@ Socket::Socket(QObject* parent, bool shouldChangeSocketOptions) :
 void Socket::bind(SocketType socketType, const QHostAddress& address, quint16 port) {
     _networkSocket.bind(socketType, address, port);
 
+    if (socketType == SocketType::UDP) {
+        startReceiveShards(address, _networkSocket.localPort(socketType));
+    }
+
     if (_shouldChangeSocketOptions) {
         setSystemBufferSizes(socketType);
         if (socketType == SocketType::WebRTC) {
@@ -87,6 +151,9 @@ void Socket::rebind(SocketType socketType) {
 }
 
 void Socket::rebind(SocketType socketType, quint16 localPort) {
+    if (socketType == SocketType::UDP) {
+        _receiveShards.clear();
+    }
     _networkSocket.abort(socketType);
     bind(socketType, QHostAddress::AnyIPv4, localPort);
 }
@@ -146,13 +213,14 @@ qint64 Socket::writeBasePacket(const udt::BasePacket& packet, const SockAddr &so
 qint64 Socket::writePacket(const Packet& packet, const SockAddr& sockAddr) {
     Q_ASSERT_X(!packet.isReliable(), "Socket::writePacket", "Cannot send a reliable packet unreliably");
 
+    SockAddrKey key(sockAddr);
     SequenceNumber sequenceNumber;
     {
         Lock lock(_unreliableSequenceNumbersMutex);
-        sequenceNumber = ++_unreliableSequenceNumbers[sockAddr];
+        sequenceNumber = ++_unreliableSequenceNumbers[key];
     }
 
-    auto connection = findOrCreateConnection(sockAddr, true);
+    auto connection = findOrCreateConnection(sockAddr, key, true);
     if (connection) {
         connection->recordSentUnreliablePackets(packet.getWireSize(),
                                                 packet.getPayloadSize());
@@ -245,6 +313,84 @@ qint64 Socket::writeDatagram(const char* data, qint64 size, const SockAddr& sock
 }
 
 qint64 Socket::writeDatagram(const QByteArray& datagram, const SockAddr& sockAddr) {
+    if (queueBatchedWrite(datagram, sockAddr)) {
+        return datagram.size();
+    }
+
+    return writeDatagramImmediately(datagram, sockAddr);
+}
+
+bool Socket::queueBatchedWrite(const QByteArray& datagram, const SockAddr& sockAddr) {
+#if defined(Q_OS_LINUX)
+    if (!pendingWrites || pendingWrites->socket != this || sockAddr.getType() != SocketType::UDP
+        || sockAddr.getAddress().protocol() != QAbstractSocket::IPv4Protocol || datagram.size() > udt::MAX_PACKET_SIZE
+        || _networkSocket.state(SocketType::UDP) != QAbstractSocket::BoundState) {
+        return false;
+    }
+
+    auto& pending = *pendingWrites;
+    if (pending.count == MAX_BATCHED_WRITES) {
+        flushBatchedWrites();
+    }
+
+    auto index = pending.count++;
+    memcpy(pending.buffers[index].data(), datagram.constData(), datagram.size());
+
+    auto& address = pending.addresses[index];
+    memset(&address, 0, sizeof(sockaddr_in));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(sockAddr.getAddress().toIPv4Address());
+    address.sin_port = htons(sockAddr.getPort());
+
+    pending.ioVectors[index].iov_base = pending.buffers[index].data();
+    pending.ioVectors[index].iov_len = datagram.size();
+
+    auto& message = pending.messages[index];
+    memset(&message, 0, sizeof(mmsghdr));
+    message.msg_hdr.msg_name = &address;
+    message.msg_hdr.msg_namelen = sizeof(sockaddr_in);
+    message.msg_hdr.msg_iov = &pending.ioVectors[index];
+    message.msg_hdr.msg_iovlen = 1;
+
+    return true;
+#else
+    Q_UNUSED(datagram);
+    Q_UNUSED(sockAddr);
+    return false;
+#endif
+}
+
+void Socket::flushBatchedWrites() {
+#if defined(Q_OS_LINUX)
+    if (!pendingWrites || pendingWrites->count == 0) {
+        return;
+    }
+
+    auto& pending = *pendingWrites;
+    auto sd = _networkSocket.socketDescriptor(SocketType::UDP);
+
+    int numSent = 0;
+    while (numSent < pending.count) {
+        int result = sendmmsg((int)sd, &pending.messages[numSent], pending.count - numSent, 0);
+        if (result <= 0) {
+            break;
+        }
+        numSent += result;
+    }
+
+    // anything sendmmsg could not take goes out one at a time, so that errors are reported the usual way
+    for (int i = numSent; i < pending.count; ++i) {
+        const auto& address = pending.addresses[i];
+        SockAddr sockAddr(SocketType::UDP, QHostAddress(ntohl(address.sin_addr.s_addr)), ntohs(address.sin_port));
+        writeDatagramImmediately(QByteArray::fromRawData(pending.buffers[i].data(), (int)pending.ioVectors[i].iov_len),
+                                 sockAddr);
+    }
+
+    pending.count = 0;
+#endif
+}
+
+qint64 Socket::writeDatagramImmediately(const QByteArray& datagram, const SockAddr& sockAddr) {
     auto socketType = sockAddr.getType();
 
     // don't attempt to write the datagram if we're unbound.  Just drop it.
@@ -282,9 +428,47 @@ qint64 Socket::writeDatagram(const QByteArray& datagram, const SockAddr& sockAdd
     return bytesWritten;
 }
 
+std::shared_ptr<const Socket::ConnectionsSnapshot> Socket::getConnectionsSnapshot() const {
+    return std::atomic_load(&_connectionsSnapshot);
+}
+
+void Socket::publishConnectionsSnapshot() {
+    // must be called with _connectionsHashMutex held
+    auto snapshot = std::make_shared<ConnectionsSnapshot>();
+    snapshot->reserve(_connectionsHash.size());
+    for (const auto& connectionPair : _connectionsHash) {
+        snapshot->emplace(connectionPair.first, connectionPair.second.get());
+    }
+    std::atomic_store(&_connectionsSnapshot, std::shared_ptr<const ConnectionsSnapshot>(std::move(snapshot)));
+}
+
+Socket::Lock Socket::lockConnections() {
+    Lock connectionsLock(_connectionsHashMutex, std::try_to_lock);
+    if (!connectionsLock.owns_lock()) {
+        ++_numContendedConnectionLocks;
+        connectionsLock.lock();
+    }
+    return connectionsLock;
+}
+
 Connection* Socket::findOrCreateConnection(const SockAddr& sockAddr, bool filterCreate) {
-    Lock connectionsLock(_connectionsHashMutex);
-    auto it = _connectionsHash.find(sockAddr);
+    return findOrCreateConnection(sockAddr, SockAddrKey(sockAddr), filterCreate);
+}
+
+Connection* Socket::findOrCreateConnection(const SockAddr& sockAddr, const SockAddrKey& key, bool filterCreate) {
+    ++_numConnectionLookups;
+    {
+        auto snapshot = getConnectionsSnapshot();
+        auto it = snapshot->find(key);
+        if (it != snapshot->end()) {
+            return it->second;
+        }
+    }
+
+    auto connectionsLock = lockConnections();
+
+    // someone may have created it since we looked
+    auto it = _connectionsHash.find(key);
 
     if (it == _connectionsHash.end()) {
         // we did not have a matching connection, time to see if we should make one
@@ -310,7 +494,8 @@ Connection* Socket::findOrCreateConnection(const SockAddr& sockAddr, bool filter
 
             qCDebug(networking) << "Creating new Connection class for" << sockAddr;
 
-            it = _connectionsHash.insert(it, std::make_pair(sockAddr, std::move(connection)));
+            it = _connectionsHash.insert(it, std::make_pair(key, std::move(connection)));
+            publishConnectionsSnapshot();
         }
     }
 
@@ -323,19 +508,28 @@ void Socket::clearConnections() {
         return;
     }
 
-    Lock connectionsLock(_connectionsHashMutex);
+    auto connectionsLock = lockConnections();
     if (_connectionsHash.size() > 0) {
         // clear all of the current connections in the socket
         qCDebug(networking) << "Clearing all remaining connections in Socket.";
+
+        // stop handing out the connections before they are destroyed
+        std::atomic_store(&_connectionsSnapshot, std::shared_ptr<const ConnectionsSnapshot>(std::make_shared<ConnectionsSnapshot>()));
         _connectionsHash.clear();
     }
 }
 
 void Socket::cleanupConnection(SockAddr sockAddr) {
-    Lock connectionsLock(_connectionsHashMutex);
-    auto numErased = _connectionsHash.erase(sockAddr);
+    auto connectionsLock = lockConnections();
+    auto it = _connectionsHash.find(SockAddrKey(sockAddr));
+
+    if (it != _connectionsHash.end()) {
+        // stop handing out the connection before it is destroyed
+        auto connection = std::move(it->second);
+        _connectionsHash.erase(it);
+        publishConnectionsSnapshot();
+        connection.reset();
 
-    if (numErased > 0) {
 #ifdef UDT_CONNECTION_DEBUG
         qCDebug(networking) << "Socket::cleanupConnection called for UDT connection to" << sockAddr;
 #endif
@@ -381,10 +575,10 @@ void Socket::readPendingDatagrams() {
     using namespace std::chrono;
     static const auto MAX_PROCESS_TIME { 100ms };
     const auto abortTime = system_clock::now() + MAX_PROCESS_TIME;
-    int packetSizeWithHeader = -1;
 
-    while (_networkSocket.hasPendingDatagrams() &&
-           (packetSizeWithHeader = _networkSocket.pendingDatagramSize()) != -1) {
+    ++_numReadWakeups;
+
+    while (_networkSocket.hasPendingDatagrams()) {
         if (system_clock::now() > abortTime) {
             // We've been running for too long, stop processing packets for now
             // Once we've processed the event queue, we'll come back to packet processing
@@ -396,108 +590,231 @@ void Socket::readPendingDatagrams() {
             break;
         }
 
-        // we're reading a packet so re-start the readyRead backup timer
+        // pull as many datagrams as we can in one go
+        if (_networkSocket.readDatagrams(_receivedDatagrams, NetworkSocket::MAX_DATAGRAMS_PER_BATCH) == -1) {
+            break;
+        }
+
+        // we're reading packets so re-start the readyRead backup timer
         _readyReadBackupTimer->start();
 
-        // grab a time point we can mark as the receive time of this packet
+        // grab a time point we can mark as the receive time of these packets
         auto receiveTime = p_high_resolution_clock::now();
 
-        // setup a SockAddr to read into
-        SockAddr senderSockAddr;
+        ++_numDatagramReads;
 
-        // setup a buffer to read the packet into
-        auto buffer = std::unique_ptr<char[]>(new char[packetSizeWithHeader]);
+        for (auto& datagram : _receivedDatagrams) {
+            // save information for this packet, in case it is the one that sticks readyRead
+            _lastPacketSizeRead = datagram.size;
+            _lastPacketSockAddr = datagram.sockAddr;
 
-        // pull the datagram
-        auto sizeRead = _networkSocket.readDatagram(buffer.get(), packetSizeWithHeader, &senderSockAddr);
+            if (datagram.size <= 0) {
+                // we either didn't pull anything for this packet or there was an error reading (this seems to trigger
+                // on windows even if there's not a packet available)
+                continue;
+            }
 
-        // save information for this packet, in case it is the one that sticks readyRead
-        _lastPacketSizeRead = sizeRead;
-        _lastPacketSockAddr = senderSockAddr;
+            ++_numDatagramsRead;
 
-        if (sizeRead <= 0) {
-            // we either didn't pull anything for this packet or there was an error reading (this seems to trigger
-            // on windows even if there's not a packet available)
-            continue;
+            processReceivedDatagram(std::move(datagram.data), datagram.size, datagram.sockAddr, receiveTime);
         }
+    }
+}
 
-        auto it = _unfilteredHandlers.find(senderSockAddr);
-
-        if (it != _unfilteredHandlers.end()) {
-            // we have a registered unfiltered handler for this SockAddr - call that and return
-            if (it->second) {
-                auto basePacket = BasePacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-                basePacket->setReceiveTime(receiveTime);
-                it->second(std::move(basePacket));
-            }
-
-            continue;
+void Socket::processReceivedDatagram(PacketBuffer buffer, qint64 packetSizeWithHeader,
+                                     const SockAddr& senderSockAddr, p_high_resolution_clock::time_point receiveTime) {
+    SockAddrKey senderKey(senderSockAddr);
+    auto it = _unfilteredHandlers.find(senderKey);
+
+    if (it != _unfilteredHandlers.end()) {
+        // we have a registered unfiltered handler for this SockAddr - call that and return
+        if (it->second) {
+            auto basePacket = BasePacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
+            basePacket->setReceiveTime(receiveTime);
+            it->second(std::move(basePacket));
         }
 
-        // check if this was a control packet or a data packet
-        bool isControlPacket = *reinterpret_cast<uint32_t*>(buffer.get()) & CONTROL_BIT_MASK;
+        return;
+    }
 
-        if (isControlPacket) {
-            // setup a control packet from the data we just read
-            auto controlPacket = ControlPacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-            controlPacket->setReceiveTime(receiveTime);
+    // check if this was a control packet or a data packet
+    bool isControlPacket = *reinterpret_cast<uint32_t*>(buffer.get()) & CONTROL_BIT_MASK;
 
-            // move this control packet to the matching connection, if there is one
-            auto connection = findOrCreateConnection(senderSockAddr, true);
+    if (isControlPacket) {
+        // setup a control packet from the data we just read
+        auto controlPacket = ControlPacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
+        controlPacket->setReceiveTime(receiveTime);
 
-            if (connection) {
-                connection->processControl(move(controlPacket));
-            }
+        // move this control packet to the matching connection, if there is one
+        auto connection = findOrCreateConnection(senderSockAddr, senderKey, true);
 
-        } else {
-            // setup a Packet from the data we just read
-            auto packet = Packet::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-            packet->setReceiveTime(receiveTime);
+        if (connection) {
+            connection->processControl(move(controlPacket));
+        }
 
-            // save the sequence number in case this is the packet that sticks readyRead
-            _lastReceivedSequenceNumber = packet->getSequenceNumber();
+    } else {
+        // setup a Packet from the data we just read
+        auto packet = Packet::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
+        packet->setReceiveTime(receiveTime);
 
-            // call our verification operator to see if this packet is verified
-            if (!_packetFilterOperator || _packetFilterOperator(*packet)) {
-                auto connection = findOrCreateConnection(senderSockAddr, true);
+        // save the sequence number in case this is the packet that sticks readyRead
+        _lastReceivedSequenceNumber = packet->getSequenceNumber();
 
-                if (packet->isReliable()) {
-                    // if this was a reliable packet then signal the matching connection with the sequence number
+        // call our verification operator to see if this packet is verified
+        if (!_packetFilterOperator || _packetFilterOperator(*packet)) {
+            auto connection = findOrCreateConnection(senderSockAddr, senderKey, true);
 
-                    if (!connection || !connection->processReceivedSequenceNumber(packet->getSequenceNumber(),
-                                                                                  packet->getDataSize(),
-                                                                                  packet->getPayloadSize())) {
-                        // the connection could not be created or indicated that we should not continue processing this packet
+            if (packet->isReliable()) {
+                // if this was a reliable packet then signal the matching connection with the sequence number
+
+                if (!connection || !connection->processReceivedSequenceNumber(packet->getSequenceNumber(),
+                                                                              packet->getDataSize(),
+                                                                              packet->getPayloadSize())) {
+                    // the connection could not be created or indicated that we should not continue processing this packet
 #ifdef UDT_CONNECTION_DEBUG
-                        qCDebug(networking) << "Can't process packet: version" << (unsigned int)NLPacket::versionInHeader(*packet)
-                            << ", type" << NLPacket::typeInHeader(*packet);
+                    qCDebug(networking) << "Can't process packet: version" << (unsigned int)NLPacket::versionInHeader(*packet)
+                        << ", type" << NLPacket::typeInHeader(*packet);
 #endif
-                        continue;
-                    }
-                } else if (connection) {
-                    connection->recordReceivedUnreliablePackets(packet->getWireSize(),
-                                                                packet->getPayloadSize());
+                    return;
                 }
+            } else if (connection) {
+                connection->recordReceivedUnreliablePackets(packet->getWireSize(),
+                                                            packet->getPayloadSize());
+            }
 
-                if (packet->isPartOfMessage()) {
-                    auto connection = findOrCreateConnection(senderSockAddr, true);
-                    if (connection) {
-                        connection->queueReceivedMessagePacket(std::move(packet));
-                    }
-                } else if (_packetHandler) {
-                    // call the verified packet callback to let it handle this packet
-                    _packetHandler(std::move(packet));
+            if (packet->isPartOfMessage()) {
+                auto connection = findOrCreateConnection(senderSockAddr, senderKey, true);
+                if (connection) {
+                    connection->queueReceivedMessagePacket(std::move(packet));
                 }
+            } else if (_packetHandler) {
+                // call the verified packet callback to let it handle this packet
+                _packetHandler(std::move(packet));
             }
         }
     }
 }
 
+void Socket::startReceiveShards(const QHostAddress& address, quint16 port) {
+    _receiveShards.clear();
+
+    // our own socket is the first shard
+    int numShards = ReceiveShard::getNumShards();
+    if (numShards <= 1 || port == 0) {
+        return;
+    }
+
+    for (int i = 1; i < numShards; ++i) {
+        std::unique_ptr<ReceiveShard> shard(new ReceiveShard(i, address, port,
+            [this](std::vector<ReceivedDatagram>& datagrams) { handleShardDatagrams(datagrams); }));
+        if (!shard->isBound()) {
+            break;
+        }
+        _receiveShards.push_back(std::move(shard));
+    }
+
+    qCDebug(networking) << "Receiving on port" << port << "with" << _receiveShards.size() + 1 << "shards";
+}
+
+void Socket::handleShardDatagrams(std::vector<ReceivedDatagram>& datagrams) {
+    // runs on a shard thread
+    auto receiveTime = p_high_resolution_clock::now();
+
+    ++_numDatagramReads;
+    _numDatagramsRead += datagrams.size();
+
+    auto snapshot = getConnectionsSnapshot();
+
+    std::vector<ShardedDatagram> forwarded;
+    std::vector<ShardedUnreliableReceipt> receipts;
+
+    for (auto& datagram : datagrams) {
+        if (datagram.size <= 0) {
+            continue;
+        }
+
+        // only unreliable, single-packet data from a sender we already have a connection for is handled here;
+        // control packets, reliable packets, messages, unfiltered handlers and new senders need the Socket thread
+        auto bitField = *reinterpret_cast<uint32_t*>(datagram.data.get());
+        SockAddrKey key;
+        bool isHandledHere = false;
+        if (!(bitField & (CONTROL_BIT_MASK | RELIABILITY_BIT_MASK | MESSAGE_BIT_MASK))) {
+            key = SockAddrKey(datagram.sockAddr);
+            isHandledHere = snapshot->find(key) != snapshot->end();
+        }
+
+        if (!isHandledHere) {
+            forwarded.push_back({ std::move(datagram), receiveTime });
+            continue;
+        }
+
+        auto packet = Packet::fromReceivedPacket(std::move(datagram.data), datagram.size, datagram.sockAddr);
+        packet->setReceiveTime(receiveTime);
+
+        if (!_packetFilterOperator || _packetFilterOperator(*packet)) {
+            // connection stats are only touched on the Socket thread
+            receipts.push_back({ datagram.sockAddr, key, (int)packet->getWireSize(), (int)packet->getPayloadSize() });
+
+            if (_packetHandler) {
+                _packetHandler(std::move(packet));
+            }
+        }
+    }
+
+    if (forwarded.empty() && receipts.empty()) {
+        return;
+    }
+
+    bool shouldScheduleDrain;
+    {
+        Lock lock(_shardedDatagramsMutex);
+        std::move(forwarded.begin(), forwarded.end(), std::back_inserter(_shardedDatagrams));
+        _shardedUnreliableReceipts.insert(_shardedUnreliableReceipts.end(), receipts.begin(), receipts.end());
+        shouldScheduleDrain = !_isShardedDrainPending;
+        _isShardedDrainPending = true;
+    }
+
+    if (shouldScheduleDrain) {
+        QMetaObject::invokeMethod(this, "processShardedDatagrams", Qt::QueuedConnection);
+    }
+}
+
+void Socket::processShardedDatagrams() {
+    std::vector<ShardedDatagram> datagrams;
+    std::vector<ShardedUnreliableReceipt> receipts;
+    {
+        Lock lock(_shardedDatagramsMutex);
+        datagrams.swap(_shardedDatagrams);
+        receipts.swap(_shardedUnreliableReceipts);
+        _isShardedDrainPending = false;
+    }
+
+    for (auto& receipt : receipts) {
+        auto connection = findOrCreateConnection(receipt.sockAddr, receipt.key, true);
+        if (connection) {
+            connection->recordReceivedUnreliablePackets(receipt.wireSize, receipt.payloadSize);
+        }
+    }
+
+    for (auto& sharded : datagrams) {
+        processReceivedDatagram(std::move(sharded.datagram.data), sharded.datagram.size, sharded.datagram.sockAddr,
+                                sharded.receiveTime);
+    }
+}
+
+Socket::ReadStats Socket::sampleReadStats() {
+    ReadStats stats;
+    stats.wakeups = _numReadWakeups.exchange(0);
+    stats.reads = _numDatagramReads.exchange(0);
+    stats.datagrams = _numDatagramsRead.exchange(0);
+    return stats;
+}
+
 void Socket::connectToSendSignal(const SockAddr& destinationAddr, QObject* receiver, const char* slot) {
-    Lock connectionsLock(_connectionsHashMutex);
-    auto it = _connectionsHash.find(destinationAddr);
-    if (it != _connectionsHash.end()) {
-        connect(it->second.get(), SIGNAL(packetSent()), receiver, slot);
+    auto snapshot = getConnectionsSnapshot();
+    auto it = snapshot->find(SockAddrKey(destinationAddr));
+    if (it != snapshot->end()) {
+        connect(it->second, SIGNAL(packetSent()), receiver, slot);
     }
 }
 
@@ -508,20 +825,22 @@ void Socket::setCongestionControlFactory(std::unique_ptr<CongestionControlVirtua
 
 
 void Socket::setConnectionMaxBandwidth(int maxBandwidth) {
+    auto snapshot = getConnectionsSnapshot();
     qInfo() << "Setting socket's maximum bandwith to" << maxBandwidth << "bps. ("
-            << _connectionsHash.size() << "live connections)";
+            << snapshot->size() << "live connections)";
     _maxBandwidth = maxBandwidth;
-    Lock connectionsLock(_connectionsHashMutex);
-    for (auto& pair : _connectionsHash) {
-        auto& connection = pair.second;
-        connection->setMaxBandwidth(_maxBandwidth);
+    for (auto& pair : *snapshot) {
+        pair.second->setMaxBandwidth(_maxBandwidth);
     }
 }
 
 ConnectionStats::Stats Socket::sampleStatsForConnection(const SockAddr& destination) {
-    auto it = _connectionsHash.find(destination);
-    if (it != _connectionsHash.end()) {
-        return it->second->sampleStats();
+    auto snapshot = getConnectionsSnapshot();
+    auto it = snapshot->find(SockAddrKey(destination));
+    if (it != snapshot->end()) {
+        auto stats = it->second->sampleStats();
+        addWebRTCStats(destination, stats);
+        return stats;
     } else {
         return ConnectionStats::Stats();
     }
@@ -529,24 +848,44 @@ ConnectionStats::Stats Socket::sampleStatsForConnection(const SockAddr& destinat
 
 Socket::StatsVector Socket::sampleStatsForAllConnections() {
     StatsVector result;
-    Lock connectionsLock(_connectionsHashMutex);
+    auto snapshot = getConnectionsSnapshot();
 
-    result.reserve(_connectionsHash.size());
-    for (const auto& connectionPair : _connectionsHash) {
-        result.emplace_back(connectionPair.first, connectionPair.second->sampleStats());
+    result.reserve(snapshot->size());
+    for (const auto& connectionPair : *snapshot) {
+        const auto& destination = connectionPair.second->getDestination();
+        result.emplace_back(destination, connectionPair.second->sampleStats());
+        addWebRTCStats(destination, result.back().second);
     }
     return result;
 }
 
+void Socket::addWebRTCStats(const SockAddr& destination, ConnectionStats::Stats& stats) {
+#if defined(WEBRTC_DATA_CHANNELS)
+    if (destination.getType() == SocketType::WebRTC) {
+        stats.webrtcBufferedBytes = (int)_networkSocket.bytesToWrite(SocketType::WebRTC, destination);
+        stats.webrtcReceiveQueueDepth = _networkSocket.getWebRTCSocket()->getReceiveQueueDepth();
+    }
+#else
+    Q_UNUSED(destination);
+    Q_UNUSED(stats);
+#endif
+}
+
+Socket::ConnectionMapStats Socket::sampleConnectionMapStats() {
+    ConnectionMapStats stats;
+    stats.lookups = _numConnectionLookups.exchange(0);
+    stats.contendedLocks = _numContendedConnectionLocks.exchange(0);
+    return stats;
+}
 
 std::vector<SockAddr> Socket::getConnectionSockAddrs() {
     std::vector<SockAddr> addr;
-    Lock connectionsLock(_connectionsHashMutex);
+    auto snapshot = getConnectionsSnapshot();
 
-    addr.reserve(_connectionsHash.size());
+    addr.reserve(snapshot->size());
 
-    for (const auto& connectionPair : _connectionsHash) {
-        addr.push_back(connectionPair.first);
+    for (const auto& connectionPair : *snapshot) {
+        addr.push_back(connectionPair.second->getDestination());
     }
     return addr;
 }
@@ -582,24 +921,27 @@ void Socket::handleStateChanged(SocketType socketType, QAbstractSocket::SocketSt
 
 void Socket::handleRemoteAddressChange(SockAddr previousAddress, SockAddr currentAddress) {
     {
-        Lock connectionsLock(_connectionsHashMutex);
+        auto connectionsLock = lockConnections();
 
-        const auto connectionIter = _connectionsHash.find(previousAddress);
+        SockAddrKey previousKey(previousAddress);
+        SockAddrKey currentKey(currentAddress);
+        const auto connectionIter = _connectionsHash.find(previousKey);
         // Don't move classes that are unused so far.
         if (connectionIter != _connectionsHash.end() && connectionIter->second->hasReceivedHandshake()) {
             auto connection = move(connectionIter->second);
             _connectionsHash.erase(connectionIter);
             connection->setDestinationAddress(currentAddress);
-            _connectionsHash[currentAddress] = move(connection);
+            _connectionsHash[currentKey] = move(connection);
+            publishConnectionsSnapshot();
             connectionsLock.unlock();
             qCDebug(networking) << "Moved Connection class from" << previousAddress << "to" << currentAddress;
 
             Lock sequenceNumbersLock(_unreliableSequenceNumbersMutex);
-            const auto sequenceNumbersIter = _unreliableSequenceNumbers.find(previousAddress);
+            const auto sequenceNumbersIter = _unreliableSequenceNumbers.find(previousKey);
             if (sequenceNumbersIter != _unreliableSequenceNumbers.end()) {
                 auto sequenceNumbers = sequenceNumbersIter->second;
                 _unreliableSequenceNumbers.erase(sequenceNumbersIter);
-                _unreliableSequenceNumbers[currentAddress] = sequenceNumbers;
+                _unreliableSequenceNumbers[currentKey] = sequenceNumbers;
             }
 
         }
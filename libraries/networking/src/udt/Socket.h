@@ -15,10 +15,12 @@
 #ifndef hifi_Socket_h
 #define hifi_Socket_h
 
+#include <atomic>
 #include <functional>
 #include <unordered_map>
 #include <mutex>
 #include <list>
+#include <memory>
 
 #include <QtCore/QObject>
 #include <QtCore/QTimer>
@@ -27,6 +29,7 @@
 #include "TCPVegasCC.h"
 #include "Connection.h"
 #include "NetworkSocket.h"
+#include "ReceiveShard.h"
 
 //#define UDT_CONNECTION_DEBUG
 
@@ -55,7 +58,32 @@ class Socket : public QObject {
 
 public:
     using StatsVector = std::vector<std::pair<SockAddr, ConnectionStats::Stats>>;
+
+    // counts of datagram reads since the last sample, used to see how well reads are being batched
+    struct ReadStats {
+        uint64_t wakeups { 0 };     // number of readyRead notifications handled
+        uint64_t reads { 0 };       // number of batched reads from the network socket
+        uint64_t datagrams { 0 };   // number of datagrams read
+    };
  
+    // While a BatchedWrites exists, unreliable UDP datagrams that its thread writes through the socket are gathered
+    // (across any number of destinations) and flushed together with one sendmmsg call when the batch fills or the
+    // BatchedWrites is destroyed. Platforms without sendmmsg write each datagram immediately, as they would without one.
+    // Send errors for batched datagrams are logged but not returned to the writer.
+    class BatchedWrites {
+    public:
+        BatchedWrites(Socket& socket);
+        ~BatchedWrites();
+
+        void flush();
+
+    private:
+        Q_DISABLE_COPY(BatchedWrites)
+
+        Socket& _socket;
+        bool _ownsBatch { false };
+    };
+
     Socket(QObject* object = 0, bool shouldChangeSocketOptions = true);
     
     quint16 localPort(SocketType socketType) const { return _networkSocket.localPort(socketType); }
@@ -80,7 +108,7 @@ public:
         { _connectionCreationFilterOperator = filterOperator; }
     
     void addUnfilteredHandler(const SockAddr& senderSockAddr, BasePacketHandler handler)
-        { _unfilteredHandlers[senderSockAddr] = handler; }
+        { _unfilteredHandlers[SockAddrKey(senderSockAddr)] = handler; }
     
     void setCongestionControlFactory(std::unique_ptr<CongestionControlVirtualFactory> ccFactory);
     void setConnectionMaxBandwidth(int maxBandwidth);
@@ -90,6 +118,16 @@ public:
     
     StatsVector sampleStatsForAllConnections();
 
+    // returns the read counts accumulated since the previous call, safe to call from any thread
+    ReadStats sampleReadStats();
+
+    // counts of connection map use since the last sample
+    struct ConnectionMapStats {
+        uint64_t lookups { 0 };          // lookups served from the published snapshot, without locking
+        uint64_t contendedLocks { 0 };   // times a writer had to wait for the connections mutex
+    };
+    ConnectionMapStats sampleConnectionMapStats();
+
 #if defined(WEBRTC_DATA_CHANNELS)
     const WebRTCSocket* getWebRTCSocket();
 #endif
@@ -108,6 +146,7 @@ public slots:
 
 private slots:
     void readPendingDatagrams();
+    void processShardedDatagrams();
     void checkForReadyReadBackup();
 
     void handleSocketError(SocketType socketType, QAbstractSocket::SocketError socketError);
@@ -115,10 +154,29 @@ private slots:
 
 private:
     void setSystemBufferSizes(SocketType socketType);
+    qint64 writeDatagramImmediately(const QByteArray& datagram, const SockAddr& sockAddr);
+    bool queueBatchedWrite(const QByteArray& datagram, const SockAddr& sockAddr);
+    void flushBatchedWrites();
+    void processReceivedDatagram(PacketBuffer buffer, qint64 packetSizeWithHeader,
+                                 const SockAddr& senderSockAddr, p_high_resolution_clock::time_point receiveTime);
     Connection* findOrCreateConnection(const SockAddr& sockAddr, bool filterCreation = false);
+    Connection* findOrCreateConnection(const SockAddr& sockAddr, const SockAddrKey& key, bool filterCreation);
+
+    // datagrams read by the extra receive shards; unreliable data packets from connected senders are verified and
+    // handled on the shard's thread, everything else is handed to the Socket thread
+    void startReceiveShards(const QHostAddress& address, quint16 port);
+    void handleShardDatagrams(std::vector<ReceivedDatagram>& datagrams);
+
+    // readers look connections up in an immutable snapshot of _connectionsHash that writers re-publish, under
+    // _connectionsHashMutex, each time they change the hash - so the receive path never waits on a writer
+    using ConnectionsSnapshot = std::unordered_map<SockAddrKey, Connection*>;
+    std::shared_ptr<const ConnectionsSnapshot> getConnectionsSnapshot() const;
+    void publishConnectionsSnapshot();
+    Lock lockConnections();
    
     // privatized methods used by UDTTest - they are private since they must be called on the Socket thread
     ConnectionStats::Stats sampleStatsForConnection(const SockAddr& destination);
+    void addWebRTCStats(const SockAddr& destination, ConnectionStats::Stats& stats);
     
     std::vector<SockAddr> getConnectionSockAddrs();
     void connectToSendSignal(const SockAddr& destinationAddr, QObject* receiver, const char* slot);
@@ -136,9 +194,13 @@ private:
     Mutex _unreliableSequenceNumbersMutex;
     Mutex _connectionsHashMutex;
 
-    std::unordered_map<SockAddr, BasePacketHandler> _unfilteredHandlers;
-    std::unordered_map<SockAddr, SequenceNumber> _unreliableSequenceNumbers;
-    std::unordered_map<SockAddr, std::unique_ptr<Connection>> _connectionsHash;
+    // keyed by SockAddrKey rather than SockAddr so that the per-packet lookups don't hash or compare QHostAddresses
+    std::unordered_map<SockAddrKey, BasePacketHandler> _unfilteredHandlers;
+    std::unordered_map<SockAddrKey, SequenceNumber> _unreliableSequenceNumbers;
+    std::unordered_map<SockAddrKey, std::unique_ptr<Connection>> _connectionsHash;
+    std::shared_ptr<const ConnectionsSnapshot> _connectionsSnapshot { std::make_shared<ConnectionsSnapshot>() };
+    std::atomic<uint64_t> _numConnectionLookups { 0 };
+    std::atomic<uint64_t> _numContendedConnectionLocks { 0 };
 
     QTimer* _readyReadBackupTimer { nullptr };
 
@@ -151,6 +213,31 @@ private:
     int _lastPacketSizeRead { 0 };
     SequenceNumber _lastReceivedSequenceNumber;
     SockAddr _lastPacketSockAddr;
+
+    std::vector<ReceivedDatagram> _receivedDatagrams;
+    std::atomic<uint64_t> _numReadWakeups { 0 };
+    std::atomic<uint64_t> _numDatagramReads { 0 };
+    std::atomic<uint64_t> _numDatagramsRead { 0 };
+
+    struct ShardedDatagram {
+        ReceivedDatagram datagram;
+        p_high_resolution_clock::time_point receiveTime;
+    };
+
+    struct ShardedUnreliableReceipt {
+        SockAddr sockAddr;
+        SockAddrKey key;
+        int wireSize;
+        int payloadSize;
+    };
+
+    Mutex _shardedDatagramsMutex;
+    std::vector<ShardedDatagram> _shardedDatagrams;
+    std::vector<ShardedUnreliableReceipt> _shardedUnreliableReceipts;
+    bool _isShardedDrainPending { false };
+
+    // declared last so that shard threads are stopped before anything they use is destroyed
+    std::vector<std::unique_ptr<ReceiveShard>> _receiveShards;
     
     friend UDTTest;
 };
@@ -14,6 +14,7 @@
 #ifndef hifi_TCPVegasCC_h
 #define hifi_TCPVegasCC_h
 
+#include <algorithm>
 #include <map>
 
 #include "CongestionControl.h"
@@ -33,6 +34,8 @@ public:
     virtual void onPacketReSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) override;
 
     virtual int estimatedTimeout() const override;
+
+    virtual int getRTT() const override { return std::max(_ewmaRTT, 0); }
     
 protected:
     virtual void performCongestionAvoidance(SequenceNumber ack);
@@ -10,6 +10,9 @@
 
 #if defined(WEBRTC_DATA_CHANNELS)
 
+#include <cstring>
+#include <iterator>
+
 #include <QJsonDocument>
 #include <QJsonObject>
 
@@ -191,6 +194,14 @@ WDCConnection::WDCConnection(WebRTCDataChannels* parent, const QString& dataChan
     qCDebug(networking_webrtc) << "WDCConnection::WDCConnection() :" << dataChannelID;
 #endif
 
+    // The ID is validated as "n.n.n.n:n" before a connection is created.
+    auto addressParts = _dataChannelID.split(":");
+    if (addressParts.length() == 2) {
+        _address = SockAddr(SocketType::WebRTC, QHostAddress(addressParts[0]), addressParts[1].toInt());
+    } else {
+        qCWarning(networking_webrtc) << "Invalid dataChannelID:" << _dataChannelID;
+    }
+
     // Create observers.
     _setSessionDescriptionObserver = new rtc::RefCountedObject<WDCSetSessionDescriptionObserver>();
     _createSessionDescriptionObserver = new rtc::RefCountedObject<WDCCreateSessionDescriptionObserver>(this);
@@ -370,24 +381,22 @@ void WDCConnection::onDataChannelMessageReceived(const DataBuffer& buffer) {
     qCDebug(networking_webrtc) << "WDCConnection::onDataChannelMessageReceived()";
 #endif
 
-    auto byteArray = QByteArray(buffer.data.data<char>(), (int)buffer.data.size());
+    auto data = buffer.data.data<char>();
+    auto size = (qint64)buffer.data.size();
 
     // Echo message back to sender.
-    if (byteArray.startsWith("echo:")) {
+    static const char ECHO_PREFIX[] = "echo:";
+    static const qint64 ECHO_PREFIX_LENGTH = sizeof(ECHO_PREFIX) - 1;
+    if (size >= ECHO_PREFIX_LENGTH && memcmp(data, ECHO_PREFIX, ECHO_PREFIX_LENGTH) == 0) {
 #ifdef WEBRTC_DEBUG
     qCDebug(networking_webrtc) << "Echo message back";
 #endif
-        auto addressParts = _dataChannelID.split(":");
-        if (addressParts.length() != 2) {
-            qCWarning(networking_webrtc) << "Invalid dataChannelID:" << _dataChannelID;
-            return;
-        }
-        auto address = SockAddr(SocketType::WebRTC, QHostAddress(addressParts[0]), addressParts[1].toInt());
-        _parent->sendDataMessage(address, byteArray);  // Use parent method to exercise the code stack.
+        // Use parent method to exercise the code stack.
+        _parent->sendDataMessage(_address, QByteArray::fromRawData(data, (int)size));
         return;
     }
 
-    _parent->emitDataMessage(_dataChannelID, byteArray);
+    _parent->queueDataMessage(_address, data, size);
 }
 
 qint64 WDCConnection::getBufferedAmount() const {
@@ -488,6 +497,10 @@ void WebRTCDataChannels::reset() {
         delete i.value();
     }
     _connectionsByID.clear();
+    _connectionsByAddress.clear();
+
+    std::lock_guard<std::mutex> lock(_receivedMessagesMutex);
+    _receivedMessages.clear();
 }
 
 void WebRTCDataChannels::onDataChannelOpened(WDCConnection* connection, const QString& dataChannelID) {
@@ -495,6 +508,7 @@ void WebRTCDataChannels::onDataChannelOpened(WDCConnection* connection, const QS
     qCDebug(networking_webrtc) << "WebRTCDataChannels::onDataChannelOpened() :" << dataChannelID;
 #endif
     _connectionsByID.insert(dataChannelID, connection);
+    _connectionsByAddress[SockAddrKey(connection->getAddress())] = connection;
 }
 
 void WebRTCDataChannels::onSignalingMessage(const QJsonObject& message) {
@@ -525,6 +539,7 @@ void WebRTCDataChannels::onSignalingMessage(const QJsonObject& message) {
     } else {
         connection = new WDCConnection(this, from);
         _connectionsByID.insert(from, connection);
+        _connectionsByAddress[SockAddrKey(connection->getAddress())] = connection;
     }
 
     // Set the remote description and reply with an answer.
@@ -554,45 +569,75 @@ void WebRTCDataChannels::sendSignalingMessage(const QJsonObject& message) {
     emit signalingMessage(message);
 }
 
-void WebRTCDataChannels::emitDataMessage(const QString& dataChannelID, const QByteArray& byteArray) {
+void WebRTCDataChannels::queueDataMessage(const SockAddr& address, const char* data, qint64 size) {
 #ifdef WEBRTC_DEBUG
-    qCDebug(networking_webrtc) << "WebRTCDataChannels::emitDataMessage() :" << dataChannelID << byteArray.toHex()
-        << byteArray.length();
+    qCDebug(networking_webrtc) << "WebRTCDataChannels::queueDataMessage() :" << address << size;
 #endif
-    auto addressParts = dataChannelID.split(":");
-    if (addressParts.length() != 2) {
-        qCWarning(networking_webrtc) << "Invalid dataChannelID:" << dataChannelID;
-        return;
+    ReceivedDatagram datagram;
+    datagram.data = udt::PacketBufferPool::allocate(size);
+    memcpy(datagram.data.get(), data, size);
+    datagram.size = size;
+    datagram.sockAddr = address;
+
+    bool wasEmpty;
+    {
+        std::lock_guard<std::mutex> lock(_receivedMessagesMutex);
+        wasEmpty = _receivedMessages.empty();
+        _receivedMessages.push_back(std::move(datagram));
+    }
+
+    if (wasEmpty) {
+        emit dataMessagesReady();
     }
-    auto address = SockAddr(SocketType::WebRTC, QHostAddress(addressParts[0]), addressParts[1].toInt());
-    emit dataMessage(address, byteArray);
+}
+
+int WebRTCDataChannels::takeDataMessages(std::vector<ReceivedDatagram>& datagrams) {
+    std::lock_guard<std::mutex> lock(_receivedMessagesMutex);
+    int count = (int)_receivedMessages.size();
+    if (datagrams.empty()) {
+        // Swap so that the vector we hand back keeps its capacity for the next batch.
+        datagrams.swap(_receivedMessages);
+    } else {
+        std::move(_receivedMessages.begin(), _receivedMessages.end(), std::back_inserter(datagrams));
+        _receivedMessages.clear();
+    }
+    return count;
+}
+
+int WebRTCDataChannels::getPendingDataMessageCount() const {
+    std::lock_guard<std::mutex> lock(_receivedMessagesMutex);
+    return (int)_receivedMessages.size();
+}
+
+WDCConnection* WebRTCDataChannels::findConnection(const SockAddr& address) const {
+    auto it = _connectionsByAddress.find(SockAddrKey(address));
+    return it != _connectionsByAddress.end() ? it->second : nullptr;
 }
 
 bool WebRTCDataChannels::sendDataMessage(const SockAddr& destination, const QByteArray& byteArray) {
-    auto dataChannelID = destination.toShortString();
 #ifdef WEBRTC_DEBUG
-    qCDebug(networking_webrtc) << "WebRTCDataChannels::sendDataMessage() :" << dataChannelID;
+    qCDebug(networking_webrtc) << "WebRTCDataChannels::sendDataMessage() :" << destination;
 #endif
 
-    if (!_connectionsByID.contains(dataChannelID)) {
+    auto connection = findConnection(destination);
+    if (!connection) {
         qCWarning(networking_webrtc) << "Could not find WebRTC data channel to send message on!";
         return false;
     }
 
-    auto connection = _connectionsByID.value(dataChannelID);
-    DataBuffer buffer(byteArray.toStdString(), true);
+    // Copy the message into the data channel's buffer once, rather than through an intermediate std::string.
+    DataBuffer buffer(rtc::CopyOnWriteBuffer(byteArray.constData(), byteArray.size()), true);
     return connection->sendDataMessage(buffer);
 }
 
 qint64 WebRTCDataChannels::getBufferedAmount(const SockAddr& address) const {
-    auto dataChannelID = address.toShortString();
-    if (!_connectionsByID.contains(dataChannelID)) {
+    auto connection = findConnection(address);
+    if (!connection) {
 #ifdef WEBRTC_DEBUG
-        qCDebug(networking_webrtc) << "WebRTCDataChannels::getBufferedAmount() : Channel doesn't exist:" << dataChannelID;
+        qCDebug(networking_webrtc) << "WebRTCDataChannels::getBufferedAmount() : Channel doesn't exist:" << address;
 #endif
         return 0;
     }
-    auto connection = _connectionsByID.value(dataChannelID);
     return connection->getBufferedAmount();
 }
 
@@ -644,6 +689,10 @@ void WebRTCDataChannels::closePeerConnectionNow(WDCConnection* connection) {
     qCDebug(networking_webrtc) << "Dispose of connection for channel:" << connection->getDataChannelID();
 #endif
     _connectionsByID.remove(connection->getDataChannelID());
+    auto it = _connectionsByAddress.find(SockAddrKey(connection->getAddress()));
+    if (it != _connectionsByAddress.end() && it->second == connection) {
+        _connectionsByAddress.erase(it);
+    }
     delete connection;
 #ifdef WEBRTC_DEBUG
     qCDebug(networking_webrtc) << "Disposed of connection";
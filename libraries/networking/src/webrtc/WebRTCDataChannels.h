@@ -14,6 +14,10 @@
 #if defined(WEBRTC_DATA_CHANNELS)
 
 
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 #include <QObject>
 #include <QHash>
 
@@ -23,6 +27,7 @@
 
 #include "../NodeType.h"
 #include "../SockAddr.h"
+#include "../udt/ReceivedDatagram.h"
 
 class WebRTCDataChannels;
 class WDCConnection;
@@ -144,6 +149,10 @@ public:
     /// @return The data channel ID.
     QString getDataChannelID() const { return _dataChannelID; }
 
+    /// @brief Gets the data channel's address, parsed once from its ID.
+    /// @return The address of the signaling WebSocket that the client used to connect.
+    const SockAddr& getAddress() const { return _address; }
+
 
     /// @brief Sets the remote session description received from the remote client via the signaling channel.
     /// @param description The remote session description.
@@ -200,6 +209,7 @@ public:
 private:
     WebRTCDataChannels* _parent;
     QString _dataChannelID;
+    SockAddr _address;
 
     rtc::scoped_refptr<WDCSetSessionDescriptionObserver> _setSessionDescriptionObserver { nullptr };
     rtc::scoped_refptr<WDCCreateSessionDescriptionObserver> _createSessionDescriptionObserver { nullptr };
@@ -257,10 +267,23 @@ public:
     /// @param message The WebRTC signaling message to send.
     void sendSignalingMessage(const QJsonObject& message);
 
-    /// @brief Emits a dataMessage received from the Interface client.
-    /// @param dataChannelID The IP address and port of the signaling WebSocket that the client used to connect, `"n.n.n.n:n"`.
-    /// @param byteArray The data message received.
-    void emitDataMessage(const QString& dataChannelID, const QByteArray& byteArray);
+    /// @brief Queues a data message received from the Interface client for reading with takeDataMessages.
+    /// @details Called on the WebRTC signaling thread. The message is copied straight into a pooled packet buffer, and
+    /// {@link WebRTCDataChannels.dataMessagesReady} is only emitted if the queue was empty, so that a burst of messages
+    /// costs one queued signal rather than one per message.
+    /// @param address The address of the signaling WebSocket that the client used to connect.
+    /// @param data The data message received.
+    /// @param size The size of the data message.
+    void queueDataMessage(const SockAddr& address, const char* data, qint64 size);
+
+    /// @brief Takes the data messages received since the last call.
+    /// @param datagrams The vector to append the messages to.
+    /// @return The number of messages taken.
+    int takeDataMessages(std::vector<ReceivedDatagram>& datagrams);
+
+    /// @brief Gets the number of data messages received but not yet taken.
+    /// @return The number of data messages waiting to be taken.
+    int getPendingDataMessageCount() const;
 
     /// @brief Sends a data message to an Interface client.
     /// @param dataChannelID The IP address and port of the signaling WebSocket that the client used to connect, `"n.n.n.n:n"`.
@@ -304,11 +327,10 @@ signals:
     /// @param message The WebRTC signaling message to send.
     void signalingMessage(const QJsonObject& message);
 
-    /// @brief A WebRTC data message received from the Interface client.
-    /// @details This message is for handling at a higher level in the Vircadia protocol.
-    /// @param address The address of the signaling WebSocket that the client used to connect.
-    /// @param byteArray The Vircadia protocol message.
-    void dataMessage(const SockAddr& address, const QByteArray& byteArray);
+    /// @brief WebRTC data messages have been received from Interface clients and can be taken with takeDataMessages.
+    /// @details These messages are for handling at a higher level in the Vircadia protocol. Not emitted again until the
+    /// pending messages have been taken.
+    void dataMessagesReady();
 
     /// @brief Signals that the peer connection for a WebRTC data channel should be closed.
     /// @details Used by {@link WebRTCDataChannels.closePeerConnection}.
@@ -317,6 +339,8 @@ signals:
 
 private:
 
+    WDCConnection* findConnection(const SockAddr& address) const;
+
     QObject* _parent;
 
     NodeType_t _nodeType { NodeType::Unassigned };
@@ -330,6 +354,10 @@ private:
     QHash<QString, WDCConnection*> _connectionsByID;  // <client data channel ID, WDCConnection>
     // The client's WebSocket IP and port is used as the data channel ID to uniquely identify each.
     // The WebSocket IP address and port is formatted as "n.n.n.n:n", the same as used in WebRTCSignalingServer.
+    std::unordered_map<SockAddrKey, WDCConnection*> _connectionsByAddress;  // The same connections, for sending.
+
+    mutable std::mutex _receivedMessagesMutex;
+    std::vector<ReceivedDatagram> _receivedMessages;
 };
 
 
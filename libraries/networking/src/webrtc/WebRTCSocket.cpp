@@ -25,7 +25,7 @@ WebRTCSocket::WebRTCSocket(QObject* parent) :
     connect(&_dataChannels, &WebRTCDataChannels::signalingMessage, this, &WebRTCSocket::sendSignalingMessage);
 
     // Route received data channel messages.
-    connect(&_dataChannels, &WebRTCDataChannels::dataMessage, this, &WebRTCSocket::onDataChannelReceivedMessage);
+    connect(&_dataChannels, &WebRTCDataChannels::dataMessagesReady, this, &WebRTCSocket::onDataChannelReceivedMessages);
 }
 
 void WebRTCSocket::setSocketOption(QAbstractSocket::SocketOption option, const QVariant& value) {
@@ -93,40 +93,56 @@ qint64 WebRTCSocket::bytesToWrite(const SockAddr& destination) const {
 
 
 bool WebRTCSocket::hasPendingDatagrams() const {
-    return _receivedQueue.length() > 0;
+    return !_receivedQueue.empty();
 }
 
 qint64 WebRTCSocket::pendingDatagramSize() const {
-    if (_receivedQueue.length() > 0) {
-        return _receivedQueue.head().second.length();
+    if (!_receivedQueue.empty()) {
+        return _receivedQueue.front().size;
     }
     return -1;
 }
 
 qint64 WebRTCSocket::readDatagram(char* data, qint64 maxSize, QHostAddress* address, quint16* port) {
     clearError();
-    if (_receivedQueue.length() > 0) {
-        auto datagram = _receivedQueue.dequeue();
-        auto length = std::min((qint64)datagram.second.length(), maxSize);
+    if (!_receivedQueue.empty()) {
+        auto& datagram = _receivedQueue.front();
+        auto length = std::min(datagram.size, maxSize);
 
         if (data) {
-            memcpy(data, datagram.second.constData(), length);
+            memcpy(data, datagram.data.get(), length);
         }
 
         if (address) {
-            *address = datagram.first.getAddress();
+            *address = datagram.sockAddr.getAddress();
         }
 
         if (port) {
-            *port = datagram.first.getPort();
+            *port = datagram.sockAddr.getPort();
         }
 
+        _receivedQueue.pop_front();
         return length;
     }
     setError(QAbstractSocket::SocketError::UnknownSocketError, "Failed to read datagram");
     return -1;
 }
 
+int WebRTCSocket::readDatagrams(std::vector<ReceivedDatagram>& datagrams, int maxDatagrams) {
+    clearError();
+    int count = 0;
+    while (count < maxDatagrams && !_receivedQueue.empty()) {
+        datagrams.push_back(std::move(_receivedQueue.front()));
+        _receivedQueue.pop_front();
+        ++count;
+    }
+    return count;
+}
+
+int WebRTCSocket::getReceiveQueueDepth() const {
+    return (int)_receivedQueue.size() + _dataChannels.getPendingDataMessageCount();
+}
+
 
 QAbstractSocket::SocketError WebRTCSocket::error() const {
     return _lastErrorType;
@@ -147,9 +163,15 @@ void WebRTCSocket::clearError() {
 }
 
 
-void WebRTCSocket::onDataChannelReceivedMessage(const SockAddr& source, const QByteArray& message) {
-    _receivedQueue.enqueue(QPair<SockAddr, QByteArray>(source, message));
-    emit readyRead();
+void WebRTCSocket::onDataChannelReceivedMessages() {
+    _receivedBatch.clear();
+    if (_dataChannels.takeDataMessages(_receivedBatch) > 0) {
+        for (auto& datagram : _receivedBatch) {
+            _receivedQueue.push_back(std::move(datagram));
+        }
+        _receivedBatch.clear();
+        emit readyRead();
+    }
 }
 
 #endif // WEBRTC_DATA_CHANNELS
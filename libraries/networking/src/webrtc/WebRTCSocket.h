@@ -13,9 +13,11 @@
 
 #if defined(WEBRTC_DATA_CHANNELS)
 
+#include <deque>
+#include <vector>
+
 #include <QAbstractSocket>
 #include <QObject>
-#include <QQueue>
 
 #include "WebRTCDataChannels.h"
 
@@ -113,6 +115,16 @@ public:
     /// @return The number of bytes read on success; <code>-1</code> if reading unsuccessful.
     qint64 readDatagram(char* data, qint64 maxSize, QHostAddress* address = nullptr, quint16* port = nullptr);
 
+    /// @brief Reads pending datagrams without copying them, handing over the packet buffers they were received into.
+    /// @param datagrams The vector to append the datagrams read to.
+    /// @param maxDatagrams The maximum number of datagrams to read.
+    /// @return The number of datagrams read.
+    int readDatagrams(std::vector<ReceivedDatagram>& datagrams, int maxDatagrams);
+
+    /// @brief Gets the number of datagrams received on the WebRTC data channels that haven't been read yet.
+    /// @return The number of datagrams waiting to be read, including those not yet taken from the data channels.
+    int getReceiveQueueDepth() const;
+
 
     /// @brief Gets the type of error that last occurred.
     /// @return The type of error that last occurred.
@@ -124,11 +136,9 @@ public:
 
 public slots:
 
-    /// @brief Handles the WebRTC data channel receiving a message.
-    /// @details Queues the message to be read via readDatagram.
-    /// @param source The WebRTC data channel that the message was received on.
-    /// @param message The message that was received.
-    void onDataChannelReceivedMessage(const SockAddr& source, const QByteArray& message);
+    /// @brief Handles the WebRTC data channels receiving messages.
+    /// @details Takes the batch of messages received and queues them to be read via readDatagram or readDatagrams.
+    void onDataChannelReceivedMessages();
 
 signals:
 
@@ -157,7 +167,8 @@ private:
 
     bool _isBound { false };
 
-    QQueue<QPair<SockAddr, QByteArray>> _receivedQueue;  // Messages received are queued for reading from the "socket".
+    std::deque<ReceivedDatagram> _receivedQueue;  // Messages received are queued for reading from the "socket".
+    std::vector<ReceivedDatagram> _receivedBatch;  // Reused to take messages from the data channels.
 
     QAbstractSocket::SocketError _lastErrorType { QAbstractSocket::UnknownSocketError };
     QString _lastErrorString;
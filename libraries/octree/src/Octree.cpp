@@ -11,11 +11,13 @@
 
 #include "Octree.h"
 
+#include <algorithm>
 #include <cstring>
 #include <cstdio>
 #include <cmath>
 #include <fstream> // to load voxels from file
 
+#include <QBuffer>
 #include <QDataStream>
 #include <QDebug>
 #include <QEventLoop>
@@ -31,6 +33,7 @@
 #include <QJsonArray>
 #include <QFileInfo>
 #include <QSaveFile>
+#include <QtEndian>
 #include <QString>
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
@@ -43,6 +46,7 @@
 #include <udt/PacketHeaders.h>
 #include <ResourceManager.h>
 #include <SharedUtil.h>
+#include <UUID.h>
 #include <PathUtils.h>
 #include <ViewFrustum.h>
 
@@ -52,7 +56,30 @@
 #include "OctreeUtils.h"
 #include "OctreeEntitiesFileParser.h"
 
-QVector<QString> PERSIST_EXTENSIONS = {"json", "json.gz"};
+QVector<QString> PERSIST_EXTENSIONS = {"json", "json.gz", "bin"};
+
+static const char BINARY_SNAPSHOT_MAGIC[] = { 'V', 'O', 'C', 'T' };
+static const quint32 BINARY_SNAPSHOT_FORMAT_VERSION = 1;
+static const int BINARY_SNAPSHOT_HEADER_SIZE = sizeof(BINARY_SNAPSHOT_MAGIC) + 2 * sizeof(quint32) + sizeof(qint64) +
+    NUM_BYTES_RFC4122_UUID;
+
+// writes out the tree itself, under its read lock, for trees that don't take snapshots or for parts of a tree
+class LiveOctreeSnapshot : public OctreeSnapshot {
+public:
+    LiveOctreeSnapshot(Octree& tree, const OctreeElementPointer& element) :
+        _tree(tree),
+        _element(element ? element : tree.getRoot())
+    {
+        tree.fillSnapshotInfo(*this);
+    }
+
+    bool writeToJSON(const Octree::JSONWriter& writer) const override { return _tree.writeToJSON(writer, _element); }
+    bool writeBinarySnapshot(QIODevice& device) const override { return _tree.writeBinarySnapshot(device); }
+
+private:
+    Octree& _tree;
+    OctreeElementPointer _element;
+};
 
 Octree::Octree(bool shouldReaverage) :
     _rootElement(NULL),
@@ -676,6 +703,10 @@ bool Octree::readFromFile(const char* fileName) {
         return readJSONFromGzippedFile(qFileName);
     }
 
+    if (qFileName.endsWith(".bin")) {
+        return readBinaryFile(qFileName);
+    }
+
     QFile file(qFileName);
 
     if (!file.open(QIODevice::ReadOnly)) {
@@ -694,6 +725,83 @@ bool Octree::readFromFile(const char* fileName) {
     return success;
 }
 
+bool Octree::readBinaryFile(QString qFileName) {
+    QFile file(qFileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCritical() << "Cannot open binary file for reading: " << qFileName;
+        return false;
+    }
+
+    // decoded straight out of the page cache, rather than out of a copy of the whole file
+    qint64 size = file.size();
+    const uchar* mapped = file.map(0, size);
+    if (mapped) {
+        QByteArray header = QByteArray::fromRawData(reinterpret_cast<const char*>(mapped), std::min(size, (qint64)BINARY_SNAPSHOT_HEADER_SIZE));
+        if (isBinarySnapshot(header)) {
+            bool success = readFromBinarySnapshot(reinterpret_cast<const char*>(mapped), size);
+            file.unmap(const_cast<uchar*>(mapped));
+            return success;
+        }
+        file.unmap(const_cast<uchar*>(mapped));
+    }
+
+    // e.g. JSON the domain server sent us to replace our data with
+    QByteArray data = file.readAll();
+    QByteArray jsonData;
+    if (!gunzip(data, jsonData)) {
+        jsonData = data;
+    }
+    QDataStream jsonStream(jsonData);
+    QUrl relativeURL = QUrl::fromLocalFile(qFileName).adjusted(QUrl::RemoveFilename);
+    return readFromStream(jsonData.size(), jsonStream, "", false, relativeURL);
+}
+
+bool Octree::isBinarySnapshot(const QByteArray& data) {
+    return data.startsWith(QByteArray::fromRawData(BINARY_SNAPSHOT_MAGIC, sizeof(BINARY_SNAPSHOT_MAGIC)));
+}
+
+bool Octree::readBinarySnapshotInfo(const QByteArray& data, QUuid& id, int64_t& dataVersion) {
+    if (!isBinarySnapshot(data) || data.size() < BINARY_SNAPSHOT_HEADER_SIZE) {
+        return false;
+    }
+
+    QDataStream stream(data);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    stream.skipRawData(sizeof(BINARY_SNAPSHOT_MAGIC));
+
+    quint32 formatVersion, contentVersion;
+    qint64 persistDataVersion;
+    stream >> formatVersion >> contentVersion >> persistDataVersion;
+    if (formatVersion != BINARY_SNAPSHOT_FORMAT_VERSION) {
+        return false;
+    }
+
+    QByteArray encodedID(NUM_BYTES_RFC4122_UUID, 0);
+    stream.readRawData(encodedID.data(), NUM_BYTES_RFC4122_UUID);
+    id = QUuid::fromRfc4122(encodedID);
+    dataVersion = persistDataVersion;
+    return true;
+}
+
+bool Octree::readFromBinarySnapshot(const char* data, qint64 size) {
+    QByteArray header = QByteArray::fromRawData(data, std::min(size, (qint64)BINARY_SNAPSHOT_HEADER_SIZE));
+    QUuid id;
+    int64_t dataVersion;
+    if (!readBinarySnapshotInfo(header, id, dataVersion)) {
+        qCritical() << "Unsupported binary octree snapshot";
+        return false;
+    }
+
+    quint32 contentVersion;
+    memcpy(&contentVersion, data + sizeof(BINARY_SNAPSHOT_MAGIC) + sizeof(quint32), sizeof(contentVersion));
+    contentVersion = qFromLittleEndian(contentVersion);
+
+    qCDebug(octree) << "Reading from binary snapshot, size:" << size;
+    setOctreeVersionInfo(id, dataVersion);
+    return readBinarySnapshot(data + BINARY_SNAPSHOT_HEADER_SIZE, size - BINARY_SNAPSHOT_HEADER_SIZE,
+                              (PacketVersion)contentVersion);
+}
+
 bool Octree::readJSONFromGzippedFile(QString qFileName) {
     QFile file(qFileName);
     if (!file.open(QIODevice::ReadOnly)) {
@@ -812,6 +920,9 @@ bool Octree::readFromStream(
     if (firstChar == (char) PacketType::EntityData) {
         qCWarning(octree) << "Reading from binary SVO no longer supported";
         return false;
+    } else if (!isImport && isBinarySnapshot(device->peek(sizeof(BINARY_SNAPSHOT_MAGIC)))) {
+        QByteArray data = device->readAll();
+        return readFromBinarySnapshot(data.constData(), data.size());
     } else {
         qCDebug(octree) << "Reading from JSON SVO Stream length:" << streamLength;
         return readJSONFromStream(streamLength, inputStream, marketplaceID, isImport, relativeURL);
@@ -822,24 +933,28 @@ bool Octree::readFromStream(
 namespace {
 // hack to get the marketplace id into the entities.  We will create a way to get this from a hash of
 // the entity later, but this helps us move things along for now
+QVariantList addMarketplaceIDToEntities(const QVariantList& entitiesArray, const QString& marketplaceID) {
+    QVariantList newEntitiesArray;
+
+    // build a new entities array
+    for (auto it = entitiesArray.begin(); it != entitiesArray.end(); it++) {
+        auto entity = (*it).toMap();
+        entity["marketplaceID"] = marketplaceID;
+        newEntitiesArray.append(entity);
+    }
+    return newEntitiesArray;
+}
+
 QVariantMap addMarketplaceIDToDocumentEntities(QVariantMap& doc, const QString& marketplaceID) {
     if (!marketplaceID.isEmpty()) {
-        QVariantList newEntitiesArray;
-
-        // build a new entities array
-        auto entitiesArray = doc["Entities"].toList();
-        for (auto it = entitiesArray.begin(); it != entitiesArray.end(); it++) {
-            auto entity = (*it).toMap();
-            entity["marketplaceID"] = marketplaceID;
-            newEntitiesArray.append(entity);
-        }
-        doc["Entities"] = newEntitiesArray;
+        doc["Entities"] = addMarketplaceIDToEntities(doc["Entities"].toList(), marketplaceID);
     }
     return doc;
 }
 
 }  // Unnamed namepsace
 const int READ_JSON_BUFFER_SIZE = 2048;
+const int READ_JSON_ENTITIES_BATCH_SIZE = 256;
 
 bool Octree::readJSONFromStream(
     uint64_t streamLength,
@@ -870,12 +985,40 @@ bool Octree::readJSONFromStream(
     octreeParser.setRelativeURL(relativeURL);
     octreeParser.setEntitiesString(jsonBuffer);
 
+    // if we can, the entities are added as they're parsed rather than all being held until the end
+    bool begun = false;
+    bool batchesSucceeded = true;
+    if (canReadEntitiesBatches()) {
+        octreeParser.setEntitiesHandler([&](const QVariantMap& map, const QVariantList& entities) {
+            if (!begun) {
+                beginReadFromMap(map, isImport);
+                begun = true;
+            }
+            if (marketplaceID.isEmpty()) {
+                batchesSucceeded &= readEntitiesBatch(entities);
+            } else {
+                batchesSucceeded &= readEntitiesBatch(addMarketplaceIDToEntities(entities, marketplaceID));
+            }
+            return true;
+        }, READ_JSON_ENTITIES_BATCH_SIZE);
+    }
+
     QVariantMap asMap;
     if (!octreeParser.parseEntities(asMap)) {
         qCritical() << "Couldn't parse Entities JSON:" << octreeParser.getErrorString().c_str();
+        if (begun) {
+            endReadFromMap(asMap);
+        }
+        delete[] rawData;
         return false;
     }
 
+    if (begun) {
+        bool success = endReadFromMap(asMap) && batchesSucceeded;
+        delete[] rawData;
+        return success;
+    }
+
     if (!marketplaceID.isEmpty()) {
         addMarketplaceIDToDocumentEntities(asMap, marketplaceID);
     }
@@ -886,6 +1029,16 @@ bool Octree::readJSONFromStream(
 }
 
 bool Octree::writeToFile(const char* fileName, const OctreeElementPointer& element, QString persistAsFileType) {
+    if (element && persistAsFileType == "bin") {
+        qCDebug(octree) << "unable to write part of an octree to file of type" << persistAsFileType;
+        return false;
+    }
+
+    LiveOctreeSnapshot snapshot(*this, element);
+    return writeToFile(fileName, snapshot, persistAsFileType);
+}
+
+bool Octree::writeToFile(const char* fileName, const OctreeSnapshot& snapshot, QString persistAsFileType) {
     // make the sure file extension makes sense
     QString qFileName = fileNameWithoutExtension(QString(fileName), PERSIST_EXTENSIONS) + "." + persistAsFileType;
     QByteArray byteArray = qFileName.toUtf8();
@@ -893,15 +1046,48 @@ bool Octree::writeToFile(const char* fileName, const OctreeElementPointer& eleme
 
     bool success = false;
     if (persistAsFileType == "json") {
-        success = writeToJSONFile(cFileName, element);
+        success = writeToJSONFile(cFileName, snapshot);
     } else if (persistAsFileType == "json.gz") {
-        success = writeToJSONFile(cFileName, element, true);
+        success = writeToJSONFile(cFileName, snapshot, true);
+    } else if (persistAsFileType == "bin") {
+        success = writeToBinaryFile(cFileName, snapshot);
     } else {
         qCDebug(octree) << "unable to write octree to file of type" << persistAsFileType;
     }
     return success;
 }
 
+bool Octree::writeToBinaryFile(const char* fileName, const OctreeSnapshot& snapshot) {
+    qCDebug(octree, "Saving binary snapshot to file %s...", fileName);
+
+    QSaveFile persistFile(fileName);
+    if (!persistFile.open(QIODevice::WriteOnly)) {
+        qCritical("Failed to open binary snapshot file for writing.");
+        return false;
+    }
+
+    QDataStream stream(&persistFile);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    stream.writeRawData(BINARY_SNAPSHOT_MAGIC, sizeof(BINARY_SNAPSHOT_MAGIC));
+    stream << BINARY_SNAPSHOT_FORMAT_VERSION;
+    stream << (quint32)snapshot.contentVersion;
+    stream << (qint64)snapshot.persistDataVersion;
+    QByteArray encodedID = snapshot.persistID.toRfc4122();
+    stream.writeRawData(encodedID.constData(), encodedID.size());
+
+    if (!snapshot.writeBinarySnapshot(persistFile)) {
+        qCritical("Failed to write binary snapshot.");
+        persistFile.cancelWriting();
+        return false;
+    }
+
+    bool success = persistFile.commit();
+    if (!success) {
+        qCritical() << "Failed to commit to binary snapshot file:" << persistFile.errorString();
+    }
+    return success;
+}
+
 bool Octree::toJSONDocument(QJsonDocument* doc, const OctreeElementPointer& element) {
     QVariantMap entityDescription;
 
@@ -939,60 +1125,71 @@ bool Octree::toJSONDocument(QJsonDocument* doc, const OctreeElementPointer& elem
 }
 
 bool Octree::toJSONString(QString& jsonString, const OctreeElementPointer& element) {
-    OctreeElementPointer top;
-    if (element) {
-        top = element;
-    } else {
-        top = _rootElement;
-    }
-
-    jsonString += QString("{\n  \"DataVersion\": %1,\n  \"Entities\": [").arg(_persistDataVersion);
+    LiveOctreeSnapshot snapshot(*this, element);
+    return toJSONStream([&](const QByteArray& json) {
+        jsonString += QString::fromUtf8(json);
+        return true;
+    }, snapshot);
+}
 
-    writeToJSON(jsonString, top);
+bool Octree::toJSONStream(const JSONWriter& writer, const OctreeSnapshot& snapshot) {
+    // the versions go before the entities, so that readers can add the entities while they're still parsing
+    QString header = QString("{\n  \"DataVersion\": %1,\n  \"Id\": \"%2\",\n  \"Version\": %3,\n  \"Entities\": [")
+        .arg(snapshot.persistDataVersion).arg(snapshot.persistID.toString()).arg((int)snapshot.contentVersion);
 
-    // include the "bitstream" version
-    PacketType expectedType = expectedDataPacketType();
-    PacketVersion expectedVersion = versionForPacketType(expectedType);
+    return writer(header.toUtf8()) && snapshot.writeToJSON(writer) && writer(QByteArray("\n    ]\n}\n"));
+}
 
-    jsonString += QString("\n    ],\n  \"Id\": \"%1\",\n  \"Version\": %2\n}\n").arg(_persistID.toString()).arg((int)expectedVersion);
+bool Octree::writeToJSONDevice(QIODevice& device, const OctreeSnapshot& snapshot, bool doGzip) {
+    if (!doGzip) {
+        return toJSONStream([&](const QByteArray& json) {
+            return device.write(json) == json.size();
+        }, snapshot);
+    }
 
-    return true;
+    GzipWriter gzipWriter(device);
+    bool success = toJSONStream([&](const QByteArray& json) {
+        return gzipWriter.write(json);
+    }, snapshot);
+    return gzipWriter.finish() && success;
 }
 
 bool Octree::toJSON(QByteArray* data, const OctreeElementPointer& element, bool doGzip) {
-    QString jsonString;
-    toJSONString(jsonString);
+    LiveOctreeSnapshot snapshot(*this, element);
+    return toJSON(data, snapshot, doGzip);
+}
 
-    if (doGzip) {
-        if (!gzip(jsonString.toUtf8(), *data, -1)) {
-            qCritical("Unable to gzip data while saving to json.");
-            return false;
-        }
-    } else {
-        *data = jsonString.toUtf8();
+bool Octree::toJSON(QByteArray* data, const OctreeSnapshot& snapshot, bool doGzip) {
+    data->clear();
+    QBuffer buffer(data);
+    buffer.open(QIODevice::WriteOnly);
+    if (!writeToJSONDevice(buffer, snapshot, doGzip)) {
+        qCritical("Unable to convert entities to json.");
+        return false;
     }
 
     return true;
 }
 
 bool Octree::writeToJSONFile(const char* fileName, const OctreeElementPointer& element, bool doGzip) {
-    qCDebug(octree, "Saving JSON SVO to file %s...", fileName);
+    LiveOctreeSnapshot snapshot(*this, element);
+    return writeToJSONFile(fileName, snapshot, doGzip);
+}
 
-    QByteArray jsonDataForFile;
-    if (!toJSON(&jsonDataForFile, element, doGzip)) {
-        return false;
-    }
+bool Octree::writeToJSONFile(const char* fileName, const OctreeSnapshot& snapshot, bool doGzip) {
+    qCDebug(octree, "Saving JSON SVO to file %s...", fileName);
 
     QSaveFile persistFile(fileName);
     bool success = false;
     if (persistFile.open(QIODevice::WriteOnly)) {
-        if (persistFile.write(jsonDataForFile) != -1) {
+        if (writeToJSONDevice(persistFile, snapshot, doGzip)) {
             success = persistFile.commit();
             if (!success) {
                 qCritical() << "Failed to commit to JSON save file:" << persistFile.errorString();
             }
         } else {
             qCritical("Failed to write to JSON file.");
+            persistFile.cancelWriting();
         }
     } else {
         qCritical("Failed to open JSON file for writing.");
@@ -1001,6 +1198,12 @@ bool Octree::writeToJSONFile(const char* fileName, const OctreeElementPointer& e
     return success;
 }
 
+void Octree::fillSnapshotInfo(OctreeSnapshot& snapshot) const {
+    snapshot.persistID = _persistID;
+    snapshot.persistDataVersion = _persistDataVersion;
+    snapshot.contentVersion = versionForPacketType(expectedDataPacketType());
+}
+
 uint64_t Octree::getOctreeElementsCount() {
     uint64_t nodeCount = 0;
     recurseTreeWithOperation(countOctreeElementsOperation, &nodeCount);
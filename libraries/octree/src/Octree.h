@@ -12,6 +12,7 @@
 #ifndef hifi_Octree_h
 #define hifi_Octree_h
 
+#include <functional>
 #include <memory>
 #include <set>
 #include <stdint.h>
@@ -30,12 +31,15 @@
 #include "OctreeSceneStats.h"
 #include "OctreeUtils.h"
 
+class QIODevice;
 class ReadBitstreamToTreeParams;
 class Octree;
+class OctreeSnapshot;
 class OctreeElement;
 class OctreePacketData;
 class Shape;
 using OctreePointer = std::shared_ptr<Octree>;
+using OctreeSnapshotPointer = std::shared_ptr<const OctreeSnapshot>;
 
 extern QVector<QString> PERSIST_EXTENSIONS;
 
@@ -138,6 +142,21 @@ public:
     virtual bool handlesEditPacketType(PacketType packetType) const { return false; }
     virtual int processEditPacketData(ReceivedMessage& message, const unsigned char* editData, int maxLength,
                                       const SharedNodePointer& sourceNode) { return 0; }
+
+    // Edit packet types that canDecodeEditPacketType() can be decoded by decodeEditPacketData() without the tree, and so
+    // without its lock and in parallel, and then applied with processDecodedEdit() under the write lock.
+    class DecodedEdit {
+    public:
+        virtual ~DecodedEdit() {}
+        int processedBytes { 0 };
+    };
+    using DecodedEditPointer = std::unique_ptr<DecodedEdit>;
+
+    virtual bool canDecodeEditPacketType(PacketType packetType) const { return false; }
+    virtual DecodedEditPointer decodeEditPacketData(PacketType packetType, const unsigned char* editData, int maxLength) const {
+        return nullptr;
+    }
+    virtual void processDecodedEdit(ReceivedMessage& message, DecodedEdit& edit, const SharedNodePointer& sourceNode) { }
     virtual void processChallengeOwnershipRequestPacket(ReceivedMessage& message, const SharedNodePointer& sourceNode) { return; }
     virtual void processChallengeOwnershipReplyPacket(ReceivedMessage& message, const SharedNodePointer& sourceNode) { return; }
     virtual void processChallengeOwnershipPacket(ReceivedMessage& message, const SharedNodePointer& sourceNode) { return; }
@@ -205,14 +224,32 @@ public:
     void loadOctreeFile(const char* fileName);
 
     // Octree exporters
+    /// returns false to stop writing
+    using JSONWriter = std::function<bool(const QByteArray& json)>;
     bool toJSONDocument(QJsonDocument* doc, const OctreeElementPointer& element = nullptr);
     bool toJSONString(QString& jsonString, const OctreeElementPointer& element = nullptr);
     bool toJSON(QByteArray* data, const OctreeElementPointer& element = nullptr, bool doGzip = false);
     bool writeToFile(const char* filename, const OctreeElementPointer& element = nullptr, QString persistAsFileType = "json.gz");
     bool writeToJSONFile(const char* filename, const OctreeElementPointer& element = nullptr, bool doGzip = false);
+
+    // the same for a snapshot, these don't touch the tree
+    static bool toJSON(QByteArray* data, const OctreeSnapshot& snapshot, bool doGzip = false);
+    static bool toJSONStream(const JSONWriter& writer, const OctreeSnapshot& snapshot);
+    static bool writeToFile(const char* filename, const OctreeSnapshot& snapshot, QString persistAsFileType = "json.gz");
+    static bool writeToJSONFile(const char* filename, const OctreeSnapshot& snapshot, bool doGzip = false);
+    static bool writeToBinaryFile(const char* filename, const OctreeSnapshot& snapshot);
+    /// writes the JSON into device as it's generated, rather than building all of it first
+    static bool writeToJSONDevice(QIODevice& device, const OctreeSnapshot& snapshot, bool doGzip = false);
+
+    /// a copy of what's persisted, taken under the read lock so that it can be written out without holding it,
+    /// or null if the tree doesn't take them
+    virtual OctreeSnapshotPointer takeSnapshot() { return OctreeSnapshotPointer(); }
+    void fillSnapshotInfo(OctreeSnapshot& snapshot) const;
+
     virtual bool writeToMap(QVariantMap& entityDescription, OctreeElementPointer element, bool skipDefaultValues,
                             bool skipThoseWithBadParents) = 0;
-    virtual bool writeToJSON(QString& jsonString, const OctreeElementPointer& element) = 0;
+    /// hands the JSON of the entities to writer a piece at a time
+    virtual bool writeToJSON(const JSONWriter& writer, const OctreeElementPointer& element) = 0;
 
     // Octree importers
     bool readFromFile(const char* filename);
@@ -221,8 +258,35 @@ public:
     bool readFromStream(uint64_t streamLength, QDataStream& inputStream, const QString& marketplaceID="", const bool isImport = false, const QUrl& urlString = QUrl());
     bool readJSONFromStream(uint64_t streamLength, QDataStream& inputStream, const QString& marketplaceID="", const bool isImport = false, const QUrl& urlString = QUrl());
     bool readJSONFromGzippedFile(QString qFileName);
+    bool readBinaryFile(QString qFileName);
     virtual bool readFromMap(QVariantMap& entityDescription, const bool isImport = false) = 0;
 
+    // Streamed JSON reads, for trees that can take the entities a batch at a time while the JSON is still being parsed,
+    // rather than all at once in readFromMap: beginReadFromMap gets the keys that came before the entities,
+    // readEntitiesBatch each batch in order, and endReadFromMap all of the keys but the entities.
+    virtual bool canReadEntitiesBatches() const { return false; }
+    virtual void beginReadFromMap(const QVariantMap& entityDescription, const bool isImport) { }
+    virtual bool readEntitiesBatch(const QVariantList& entities) { return false; }
+    virtual bool endReadFromMap(const QVariantMap& entityDescription) { return false; }
+
+    // Binary persist files: a header with the persist ID and versions, then a body that the tree subclass writes and
+    // reads. JSON is still what's exported and sent to the domain server.
+    bool readFromBinarySnapshot(const char* data, qint64 size);
+    static bool isBinarySnapshot(const QByteArray& data);
+    static bool readBinarySnapshotInfo(const QByteArray& data, QUuid& id, int64_t& dataVersion);
+    virtual bool writeBinarySnapshot(QIODevice& device) { return false; }
+    /// contentVersion is the data packet version of the tree that wrote it
+    virtual bool readBinarySnapshot(const char* data, qint64 size, PacketVersion contentVersion) { return false; }
+
+    // Journaled persistence: trees that implement these let the persist thread append only what changed between persists
+    // to a journal next to the persist file, and only rewrite the whole file now and then.
+    /// starts tracking what writeJournal needs, returns false if the tree can't be journaled
+    virtual bool startJournal() { return false; }
+    /// appends a line to journal for each piece of data changed or deleted since changedSince, returns how many
+    virtual int writeJournal(QByteArray& journal, quint64 changedSince) { return 0; }
+    /// applies a journal on top of the data read from the persist file, the tree must be write locked
+    virtual bool readJournal(const QByteArray& journal) { return false; }
+
     uint64_t getOctreeElementsCount();
 
     bool getShouldReaverage() const { return _shouldReaverage; }
@@ -284,4 +348,19 @@ protected:
     bool _isServer;
 };
 
+// What a tree persists, copied out of it so that it can be serialized without the tree's lock. The copy is cheap since
+// the property data is implicitly shared.
+class OctreeSnapshot {
+public:
+    virtual ~OctreeSnapshot() = default;
+
+    /// the JSON of the entities, a piece at a time
+    virtual bool writeToJSON(const Octree::JSONWriter& writer) const = 0;
+    virtual bool writeBinarySnapshot(QIODevice& device) const { return false; }
+
+    QUuid persistID;
+    int persistDataVersion { 0 };
+    PacketVersion contentVersion { 0 };
+};
+
 #endif // hifi_Octree_h
@@ -63,11 +63,17 @@ bool OctreeUtils::RawOctreeData::readOctreeDataInfoFromFile(QString path) {
 QByteArray OctreeUtils::RawOctreeData::toByteArray() {
     QByteArray jsonString;
 
-    jsonString += QString("{\n  \"DataVersion\": %1,\n").arg(dataVersion);
-
-    writeSubclassData(jsonString);
+    // the versions go first, so that the octree server can add the entities while it's still parsing them
+    jsonString += QString("{\n  \"DataVersion\": %1,\n  \"Id\": \"%2\",\n  \"Version\": %3")
+        .arg(dataVersion).arg(id.toString()).arg(version);
+
+    QByteArray subclassData;
+    writeSubclassData(subclassData);
+    if (!subclassData.isEmpty()) {
+        jsonString += ",\n" + subclassData;
+    }
 
-    jsonString += QString(",\n  \"Id\": \"%1\",\n  \"Version\": %2\n}").arg(id.toString()).arg(version);
+    jsonString += "\n}";
 
     return jsonString;
 }
@@ -206,7 +206,7 @@ public:
     int getMyChildContaining(const AABox& box) const;
     int getMyChildContainingPoint(const glm::vec3& point) const;
 
-    void bumpChangedContent() { _lastChangedContent = usecTimestampNow(); }
+    virtual void bumpChangedContent() { _lastChangedContent = usecTimestampNow(); }
     uint64_t getLastChangedContent() const { return _lastChangedContent; }
 
 protected:
@@ -0,0 +1,112 @@
+//
+//  OctreeElementPool.h
+//  libraries/octree/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_OctreeElementPool_h
+#define vircadia_OctreeElementPool_h
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include <MemoryAccounting.h>
+
+// Hands out blocks of BlockSize bytes carved from large slabs, so that the elements of a tree sit next to each other
+// rather than all over the heap.
+//
+// Freed blocks go on a free list for the next element; the slabs are kept for the life of the process, so a tree that
+// is cleared leaves its memory for the next one to be built.
+template <size_t BlockSize>
+class OctreeElementPool {
+public:
+    static void* allocate() {
+        OctreeElementPool& pool = instance();
+        std::lock_guard<std::mutex> lock(pool._mutex);
+        if (!pool._freeList) {
+            pool.addSlab();
+        }
+        FreeBlock* block = pool._freeList;
+        pool._freeList = block->next;
+        return block;
+    }
+
+    static void release(void* pointer) {
+        OctreeElementPool& pool = instance();
+        std::lock_guard<std::mutex> lock(pool._mutex);
+        FreeBlock* block = static_cast<FreeBlock*>(pointer);
+        block->next = pool._freeList;
+        pool._freeList = block;
+    }
+
+private:
+    static const size_t BLOCKS_PER_SLAB = 1024;
+
+    union FreeBlock {
+        FreeBlock* next;
+        alignas(std::max_align_t) char storage[BlockSize];
+    };
+
+    // never destroyed, as trees held by singletons can release their elements after static destruction
+    static OctreeElementPool& instance() {
+        static OctreeElementPool* pool = new OctreeElementPool();
+        return *pool;
+    }
+
+    void addSlab() {
+        _slabs.emplace_back(new FreeBlock[BLOCKS_PER_SLAB]);
+        MemoryAccounting::add(MemoryAccounting::OctreeElements, sizeof(FreeBlock) * BLOCKS_PER_SLAB);
+        FreeBlock* slab = _slabs.back().get();
+        // link the blocks in address order, so that elements made one after another are next to each other
+        for (size_t i = BLOCKS_PER_SLAB; i > 0; --i) {
+            slab[i - 1].next = _freeList;
+            _freeList = &slab[i - 1];
+        }
+    }
+
+    std::mutex _mutex;
+    FreeBlock* _freeList { nullptr };
+    std::vector<std::unique_ptr<FreeBlock[]>> _slabs;
+};
+
+// An allocator for std::allocate_shared, which puts an element and its shared_ptr control block in one pooled block:
+//
+//     auto element = std::allocate_shared<EntityTreeElement>(OctreeElementAllocator<EntityTreeElement>(), octalCode);
+template <typename T>
+class OctreeElementAllocator {
+public:
+    using value_type = T;
+
+    OctreeElementAllocator() = default;
+    template <typename U>
+    OctreeElementAllocator(const OctreeElementAllocator<U>&) {}
+
+    T* allocate(size_t count) {
+        if (count != 1) {
+            return static_cast<T*>(::operator new(count * sizeof(T)));
+        }
+        return static_cast<T*>(OctreeElementPool<sizeof(T)>::allocate());
+    }
+
+    void deallocate(T* pointer, size_t count) {
+        if (count != 1) {
+            ::operator delete(pointer);
+            return;
+        }
+        OctreeElementPool<sizeof(T)>::release(pointer);
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const OctreeElementAllocator<T>&, const OctreeElementAllocator<U>&) { return true; }
+template <typename T, typename U>
+bool operator!=(const OctreeElementAllocator<T>&, const OctreeElementAllocator<U>&) { return false; }
+
+#endif // vircadia_OctreeElementPool_h
@@ -12,6 +12,7 @@
 
 #include "OctreeEntitiesFileParser.h"
 
+#include <algorithm>
 #include <sstream>
 #include <cctype>
 
@@ -38,6 +39,11 @@ void OctreeEntitiesFileParser::setEntitiesString(const QByteArray& entitiesConte
     _line = 1;
 }
 
+void OctreeEntitiesFileParser::setEntitiesHandler(const EntitiesHandler& handler, int batchSize) {
+    _entitiesHandler = handler;
+    _batchSize = std::max(batchSize, 1);
+}
+
 bool OctreeEntitiesFileParser::parseEntities(QVariantMap& parsedEntities) {
     if (nextToken() != '{') {
         _errorString = "Text before start of object";
@@ -86,12 +92,17 @@ bool OctreeEntitiesFileParser::parseEntities(QVariantMap& parsedEntities) {
                 return false;
             }
 
+            // the content version is needed to read the entities
+            bool handleEntities = _entitiesHandler && gotVersion;
+
             QVariantList entitiesValue;
-            if (!readEntitiesArray(entitiesValue)) {
+            if (!readEntitiesArray(entitiesValue, handleEntities ? &parsedEntities : nullptr)) {
                 return false;
             }
 
-            parsedEntities["Entities"] = std::move(entitiesValue);
+            if (!handleEntities) {
+                parsedEntities["Entities"] = std::move(entitiesValue);
+            }
             gotEntities = true;
         } else if (key == "Id") {
             if (gotId) {
@@ -214,7 +225,7 @@ int OctreeEntitiesFileParser::readInteger() {
     return i;
 }
 
-bool OctreeEntitiesFileParser::readEntitiesArray(QVariantList& entitiesArray) {
+bool OctreeEntitiesFileParser::readEntitiesArray(QVariantList& entitiesArray, const QVariantMap* handledEntities) {
     if (nextToken() != '[') {
         _errorString = "Entities entry is not an array";
         return false;
@@ -329,6 +340,15 @@ bool OctreeEntitiesFileParser::readEntitiesArray(QVariantList& entitiesArray) {
         entitiesArray.append(entityObject);
         _position = matchingBrace;
         char c = nextToken();
+
+        if (handledEntities && (entitiesArray.size() >= _batchSize || c == ']')) {
+            if (!_entitiesHandler(*handledEntities, entitiesArray)) {
+                _errorString = "Entities handler failed";
+                return false;
+            }
+            entitiesArray.clear();
+        }
+
         if (c == ']') {
             return true;
         } else if (c != ',') {
@@ -14,14 +14,24 @@
 #ifndef hifi_OctreeEntitiesFileParser_h
 #define hifi_OctreeEntitiesFileParser_h
 
+#include <functional>
+
 #include <QByteArray>
 #include <QUrl>
 #include <QVariant>
 
 class OctreeEntitiesFileParser {
 public:
+    // gets the keys parsed so far and the next batch of entities, returns false to stop parsing
+    using EntitiesHandler = std::function<bool(const QVariantMap& parsedEntities, const QVariantList& entities)>;
+
     void setEntitiesString(const QByteArray& entitiesContents);
     void setRelativeURL(const QUrl& relativeURL) { _relativeURL = relativeURL; }
+
+    // if the Version comes before the Entities, the entities are handed to handler a batch at a time as they're
+    // parsed, and aren't put in parsedEntities
+    void setEntitiesHandler(const EntitiesHandler& handler, int batchSize);
+
     bool parseEntities(QVariantMap& parsedEntities);
     std::string getErrorString() const;
 
@@ -29,9 +39,12 @@ private:
     int nextToken();
     std::string readString();
     int readInteger();
-    bool readEntitiesArray(QVariantList& entitiesArray);
+    bool readEntitiesArray(QVariantList& entitiesArray, const QVariantMap* handledEntities);
     int findMatchingBrace() const;
 
+    EntitiesHandler _entitiesHandler;
+    int _batchSize { 0 };
+
     QByteArray _entitiesContents;
     QUrl _relativeURL;
     int _position { 0 };
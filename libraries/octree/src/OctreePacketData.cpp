@@ -12,6 +12,7 @@
 #include "OctreePacketData.h"
 
 #include <GLMHelpers.h>
+#include <Gzip.h>
 #include <PerfStat.h>
 
 #include "OctreeLogging.h"
@@ -619,9 +620,15 @@ bool OctreePacketData::compressContent() {
     const uchar* uncompressedData = &_uncompressed[0];
     int uncompressedSize = _bytesInUse;
 
-    QByteArray compressedData = qCompress(uncompressedData, uncompressedSize, MAX_COMPRESSION);
+    QByteArray compressedData;
+    if (_compressionDictionary.isEmpty()) {
+        compressedData = qCompress(uncompressedData, uncompressedSize, MAX_COMPRESSION);
+    } else {
+        zlibCompressWithDictionary(QByteArray::fromRawData((const char*)uncompressedData, uncompressedSize), compressedData,
+                                   _compressionDictionary, MAX_COMPRESSION);
+    }
 
-    if (compressedData.size() < _compressedByteArray.size()) {
+    if (!compressedData.isEmpty() && compressedData.size() < _compressedByteArray.size()) {
         _compressedBytes = compressedData.size();
         memcpy(_compressed, compressedData.constData(), _compressedBytes);
         _dirty = false;
@@ -647,7 +654,12 @@ void OctreePacketData::loadFinalizedContent(const unsigned char* data, int lengt
             compressedData.resize(_compressedBytes);
             memcpy(compressedData.data(), data, _compressedBytes);
 
-            QByteArray uncompressedData = qUncompress(compressedData);
+            QByteArray uncompressedData;
+            if (_compressionDictionary.isEmpty()) {
+                uncompressedData = qUncompress(compressedData);
+            } else if (!zlibUncompressWithDictionary(compressedData, uncompressedData, _compressionDictionary)) {
+                qCWarning(octree) << "OctreePacketData::loadFinalizedContent -- could not uncompress with dictionary";
+            }
             if (uncompressedData.size() > _bytesAvailable) {
                 int moreNeeded = uncompressedData.size() - _bytesAvailable;
                 _uncompressedByteArray.resize(_uncompressedByteArray.size() + moreNeeded);
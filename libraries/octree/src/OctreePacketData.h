@@ -68,6 +68,7 @@ const int REASONABLE_NUMBER_OF_PACKING_ATTEMPTS = 5;
 
 const int PACKET_IS_COLOR_BIT = 0;
 const int PACKET_IS_COMPRESSED_BIT = 1;
+const int PACKET_USES_COMPRESSION_DICTIONARY_BIT = 2; // the sections were compressed against the negotiated dictionary
 
 /// An opaque key used when starting, ending, and discarding encoding/packing levels of OctreePacketData
 class LevelDetails {
@@ -244,6 +245,9 @@ public:
     
     /// returns whether or not zlib compression enabled on finalization
     bool isCompressed() const { return _enableCompression; }
+
+    /// compress against a preset dictionary, which must also be set to load the content; empty for none
+    void setCompressionDictionary(const QByteArray& dictionary) { _compressionDictionary = dictionary; }
     
     /// returns the target uncompressed size
     unsigned int getTargetSize() const { return _targetSize; }
@@ -317,6 +321,7 @@ private:
     QByteArray _compressedByteArray;
     unsigned char* _compressed { nullptr };
     int _compressedBytes;
+    QByteArray _compressionDictionary;
     int _bytesInUseLastCheck;
     bool _dirty;
 
@@ -40,11 +40,14 @@
 constexpr std::chrono::seconds OctreePersistThread::DEFAULT_PERSIST_INTERVAL { 30 };
 constexpr std::chrono::milliseconds TIME_BETWEEN_PROCESSING { 10 };
 
+// with a journal, the persist file is rewritten once the journal is bigger than it or this long after it was last written
+constexpr std::chrono::hours MAX_TIME_BETWEEN_SNAPSHOTS { 1 };
+
 constexpr int MAX_OCTREE_REPLACEMENT_BACKUP_FILES_COUNT { 20 };
 constexpr int64_t MAX_OCTREE_REPLACEMENT_BACKUP_FILES_SIZE_BYTES { 50 * 1000 * 1000 };
 
 OctreePersistThread::OctreePersistThread(OctreePointer tree, const QString& filename, std::chrono::milliseconds persistInterval,
-                                         bool debugTimestampNow, QString persistAsFileType) :
+                                         bool debugTimestampNow, QString persistAsFileType, bool wantJournal) :
     _tree(tree),
     _filename(filename),
     _persistInterval(persistInterval),
@@ -53,11 +56,14 @@ OctreePersistThread::OctreePersistThread(OctreePointer tree, const QString& file
     _loadTimeUSecs(0),
     _debugTimestampNow(debugTimestampNow),
     _lastTimeDebug(0),
-    _persistAsFileType(persistAsFileType)
+    _persistAsFileType(persistAsFileType),
+    _wantJournal(wantJournal),
+    _lastSnapshot(std::chrono::steady_clock::now())
 {
     // in case the persist filename has an extension that doesn't match the file type
     QString sansExt = fileNameWithoutExtension(_filename, PERSIST_EXTENSIONS);
     _filename = sansExt + "." + _persistAsFileType;
+    _journalFilename = _filename + ".journal";
 }
 
 void OctreePersistThread::start() {
@@ -78,11 +84,17 @@ void OctreePersistThread::start() {
     if (file.open(QIODevice::ReadOnly)) {
         QByteArray jsonData(file.readAll());
         file.close();
-        if (!gunzip(jsonData, _cachedJSONData)) {
+        if (Octree::isBinarySnapshot(jsonData)) {
+            // binary snapshots are loaded straight from the file
+            if (!Octree::readBinarySnapshotInfo(jsonData, data.id, data.dataVersion)) {
+                qCWarning(octree) << "Unsupported binary snapshot" << _filename;
+                data.id = QUuid();
+            }
+        } else if (!gunzip(jsonData, _cachedJSONData)) {
             _cachedJSONData = jsonData;
         }
 
-        if (data.readOctreeDataInfoFromData(_cachedJSONData)) {
+        if (!_cachedJSONData.isEmpty() ? data.readOctreeDataInfoFromData(_cachedJSONData) : !data.id.isNull()) {
             qCDebug(octree) << "Current octree data: ID(" << data.id << ") DataVersion(" << data.dataVersion << ")";
             packet->writePrimitive(true);
             auto id = data.id.toRfc4122();
@@ -151,6 +163,8 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
 
     bool persistentFileRead;
 
+    bool journalRead = false;
+
     _tree->withWriteLock([&] {
         PerformanceWarning warn(true, "Loading Octree File", true);
 
@@ -160,6 +174,17 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
             QDataStream jsonStream(_cachedJSONData);
             persistentFileRead = _tree->readFromStream(-1, jsonStream);
         }
+
+        // the journal has what changed since the persist file was written, unless the persist file was just replaced
+        QFile journalFile(_journalFilename);
+        if (!replacementData.isNull()) {
+            removeJournal();
+        } else if (journalFile.open(QIODevice::ReadOnly)) {
+            qCDebug(octree) << "Replaying octree journal" << _journalFilename;
+            journalRead = _tree->readJournal(journalFile.readAll());
+            journalFile.close();
+        }
+
         _tree->pruneTree();
     });
 
@@ -169,6 +194,19 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
 
     _tree->clearDirtyBit(); // the tree is clean since we just loaded it
 
+    if (_wantJournal) {
+        _isJournaled = _tree->startJournal();
+        if (!_isJournaled) {
+            qCWarning(octree) << "Octree can't be journaled, persisting all of it every time";
+        }
+    }
+    _lastJournaledAt = usecTimestampNow();
+
+    if (journalRead && !_isJournaled) {
+        // we're not journaling any more, fold what was in the journal into the persist file
+        _tree->setDirtyBit();
+    }
+
     unsigned long nodeCount = OctreeElement::getNodeCount();
     unsigned long internalNodeCount = OctreeElement::getInternalNodeCount();
     unsigned long leafNodeCount = OctreeElement::getLeafNodeCount();
@@ -205,7 +243,7 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
 QString OctreePersistThread::getPersistFileMimeType() const {
     if (_persistAsFileType == "json") {
         return "application/json";
-    } if (_persistAsFileType == "json.gz") {
+    } if (_persistAsFileType == "json.gz" || _persistAsFileType == "bin") {
         return "application/zip";
     }
     return "";
@@ -259,12 +297,25 @@ void OctreePersistThread::process() {
 
 void OctreePersistThread::aboutToFinish() {
     qCDebug(octree) << "Persist thread about to finish...";
-    persist();
+    persist(true);
     qCDebug(octree) << "Persist thread done with about to finish...";
 }
 
 QByteArray OctreePersistThread::getPersistFileContents() const {
     QByteArray fileContents;
+    if (_persistAsFileType == "bin") {
+        // binary snapshots are internal to the server, what's downloaded is the same as what goes to the DS
+        auto snapshot = _tree->takeSnapshot();
+        if (snapshot) {
+            Octree::toJSON(&fileContents, *snapshot, true);
+        } else {
+            _tree->withReadLock([&] {
+                _tree->toJSON(&fileContents, nullptr, true);
+            });
+        }
+        return fileContents;
+    }
+
     QFile file(_filename);
     if (file.open(QIODevice::ReadOnly)) {
         fileContents = file.readAll();
@@ -302,8 +353,50 @@ void OctreePersistThread::cleanupOldReplacementBackups() {
     qDebug() << "Found" << count << "backups";
 }
 
-void OctreePersistThread::persist() {
-    if (_tree->isDirty() && _initialLoadComplete) {
+bool OctreePersistThread::shouldCompactJournal() const {
+    if (std::chrono::steady_clock::now() - _lastSnapshot > MAX_TIME_BETWEEN_SNAPSHOTS) {
+        return true;
+    }
+
+    QFileInfo journalInfo(_journalFilename);
+    return journalInfo.exists() && journalInfo.size() > QFileInfo(_filename).size();
+}
+
+bool OctreePersistThread::appendToJournal() {
+    // anything that changes while we're writing is dirty again, and in the next append
+    quint64 journaledAt = usecTimestampNow();
+    _tree->clearDirtyBit();
+
+    QByteArray journal;
+    int numRecords = _tree->writeJournal(journal, _lastJournaledAt);
+
+    QFile journalFile(_journalFilename);
+    if (!journalFile.open(QIODevice::WriteOnly | QIODevice::Append) || journalFile.write(journal) != journal.size()) {
+        qCWarning(octree) << "Failed to append to octree journal" << _journalFilename << journalFile.errorString();
+        _tree->setDirtyBit();
+        return false;
+    }
+    journalFile.close();
+
+    _lastJournaledAt = journaledAt;
+    qCDebug(octree) << "Appended" << numRecords << "records to octree journal" << _journalFilename;
+    return true;
+}
+
+void OctreePersistThread::removeJournal() {
+    QFile journalFile(_journalFilename);
+    if (journalFile.exists() && !journalFile.remove()) {
+        qCWarning(octree) << "Failed to remove octree journal" << _journalFilename << journalFile.errorString();
+    }
+}
+
+void OctreePersistThread::persist(bool forceSnapshot) {
+    if (_tree->isDirty() && _initialLoadComplete && _isJournaled && !forceSnapshot && !shouldCompactJournal()) {
+        // the persist file and the domain server's copy are only updated when the journal is compacted
+        appendToJournal();
+    } else if (_tree->isDirty() && _initialLoadComplete) {
+        // a snapshot has everything in the journal from before it, later changes are journaled from here on
+        quint64 snapshotAt = usecTimestampNow();
 
         _tree->withWriteLock([&] {
             qCDebug(octree) << "pruning Octree before saving...";
@@ -313,25 +406,47 @@ void OctreePersistThread::persist() {
 
         _tree->incrementPersistDataVersion();
 
+        // the tree is only locked while its contents are copied, edits carry on while the copy is written out
+        OctreeSnapshotPointer snapshot;
+        _tree->withReadLock([&] {
+            snapshot = _tree->takeSnapshot();
+            if (snapshot) {
+                _tree->clearDirtyBit();
+            }
+        });
+
         qCDebug(octree) << "Saving Octree data to:" << _filename;
-        if (_tree->writeToFile(_filename.toLocal8Bit().constData(), nullptr, _persistAsFileType)) {
-            _tree->clearDirtyBit(); // tree is clean after saving
+        bool persisted = snapshot ? Octree::writeToFile(_filename.toLocal8Bit().constData(), *snapshot, _persistAsFileType)
+                                  : _tree->writeToFile(_filename.toLocal8Bit().constData(), nullptr, _persistAsFileType);
+        if (persisted) {
+            if (!snapshot) {
+                _tree->clearDirtyBit(); // tree is clean after saving
+            }
             qCDebug(octree) << "DONE persisting Octree data to" << _filename;
+
+            removeJournal();
+            _lastJournaledAt = snapshotAt;
+            _lastSnapshot = std::chrono::steady_clock::now();
         } else {
+            if (snapshot) {
+                // what was copied still needs saving
+                _tree->setDirtyBit();
+            }
             qCWarning(octree) << "Failed to persist Octree data to" << _filename;
         }
 
-        sendLatestEntityDataToDS();
+        sendLatestEntityDataToDS(snapshot);
     }
 }
 
-void OctreePersistThread::sendLatestEntityDataToDS() {
+void OctreePersistThread::sendLatestEntityDataToDS(const OctreeSnapshotPointer& snapshot) {
     qDebug() << "Sending latest entity data to DS";
     auto nodeList = DependencyManager::get<NodeList>();
     const DomainHandler& domainHandler = nodeList->getDomainHandler();
 
     QByteArray data;
-    if (_tree->toJSON(&data, nullptr, true)) {
+    bool converted = snapshot ? Octree::toJSON(&data, *snapshot, true) : _tree->toJSON(&data, nullptr, true);
+    if (converted) {
         auto message = NLPacketList::create(PacketType::OctreeDataPersist, QByteArray(), true, true);
         message->write(data);
         nodeList->sendPacketList(std::move(message), domainHandler.getSockAddr());
@@ -37,7 +37,8 @@ public:
                         const QString& filename,
                         std::chrono::milliseconds persistInterval = DEFAULT_PERSIST_INTERVAL,
                         bool debugTimestampNow = false,
-                        QString persistAsFileType = "json.gz");
+                        QString persistAsFileType = "json.gz",
+                        bool wantJournal = false);
 
     bool isInitialLoadComplete() const { return _initialLoadComplete; }
     quint64 getLoadElapsedTime() const { return _loadTimeUSecs; }
@@ -59,12 +60,15 @@ protected slots:
     void handleOctreeDataFileReply(QSharedPointer<ReceivedMessage> message);
 
 protected:
-    void persist();
+    void persist(bool forceSnapshot = false);
+    bool appendToJournal();
+    bool shouldCompactJournal() const;
+    void removeJournal();
     bool backupCurrentFile();
     void cleanupOldReplacementBackups();
 
     void replaceData(QByteArray data);
-    void sendLatestEntityDataToDS();
+    void sendLatestEntityDataToDS(const OctreeSnapshotPointer& snapshot = OctreeSnapshotPointer());
 
 private:
     OctreePointer _tree;
@@ -80,6 +84,12 @@ private:
 
     QString _persistAsFileType;
     QByteArray _cachedJSONData;
+
+    bool _wantJournal;
+    bool _isJournaled { false };
+    QString _journalFilename;
+    quint64 _lastJournaledAt { 0 };
+    std::chrono::steady_clock::time_point _lastSnapshot;
 };
 
 #endif // hifi_OctreePersistThread_h
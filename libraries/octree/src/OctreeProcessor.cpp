@@ -11,6 +11,7 @@
 #include "OctreeProcessor.h"
 
 #include <stdint.h>
+#include <vector>
 
 #include <glm/glm.hpp>
 
@@ -68,6 +69,7 @@ void OctreeProcessor::processDatagram(ReceivedMessage& message, SharedNodePointe
 
         bool packetIsColored = oneAtBit(flags, PACKET_IS_COLOR_BIT);
         bool packetIsCompressed = oneAtBit(flags, PACKET_IS_COMPRESSED_BIT);
+        bool packetUsesDictionary = oneAtBit(flags, PACKET_USES_COMPRESSION_DICTIONARY_BIT);
 
         OCTREE_PACKET_SENT_TIME arrivedAt = usecTimestampNow();
         qint64 clockSkew = sourceNode ? sourceNode->getClockSkewUsec() : 0;
@@ -100,6 +102,9 @@ void OctreeProcessor::processDatagram(ReceivedMessage& message, SharedNodePointe
 
         bool error = false;
 
+        // uncompress the sections before taking the lock, so that the tree is only locked for reading them in
+        quint64 startUncompress = usecTimestampNow();
+        std::vector<QByteArray> sections;
         while (message.getBytesLeftToRead() > 0 && !error) {
             if (packetIsCompressed) {
                 if (message.getBytesLeftToRead() > (qint64) sizeof(OCTREE_PACKET_INTERNAL_SECTION_SIZE)) {
@@ -113,58 +118,62 @@ void OctreeProcessor::processDatagram(ReceivedMessage& message, SharedNodePointe
             }
 
             if (sectionLength) {
-                // ask the VoxelTree to read the bitstream into the tree
-                ReadBitstreamToTreeParams args(WANT_EXISTS_BITS, NULL,
-                                               sourceUUID, sourceNode);
-                quint64 startUncompress, startLock = usecTimestampNow();
-                quint64 startReadBitsteam, endReadBitsteam;
-                // FIXME STUTTER - there may be an opportunity to bump this lock outside of the
-                // loop to reduce the amount of locking/unlocking we're doing
-                _tree->withWriteLock([&] {
-                    startUncompress = usecTimestampNow();
-
-                    OctreePacketData packetData(packetIsCompressed);
-                    packetData.loadFinalizedContent(reinterpret_cast<const unsigned char*>(message.getRawMessage() + message.getPosition()),
-                        sectionLength);
-                    if (extraDebugging) {
-                        qCDebug(octree) << "OctreeProcessor::processDatagram() ... "
-                            "Got Packet Section color:" << packetIsColored <<
-                            "compressed:" << packetIsCompressed <<
-                            "sequence: " << sequence <<
-                            "flight: " << flightTime << " usec" <<
-                            "size:" << message.getSize() <<
-                            "data:" << message.getBytesLeftToRead() <<
-                            "subsection:" << subsection <<
-                            "sectionLength:" << sectionLength <<
-                            "uncompressed:" << packetData.getUncompressedSize();
-                    }
+                OctreePacketData packetData(packetIsCompressed);
+                if (packetUsesDictionary) {
+                    packetData.setCompressionDictionary(_compressionDictionary);
+                }
+                packetData.loadFinalizedContent(reinterpret_cast<const unsigned char*>(message.getRawMessage() + message.getPosition()),
+                    sectionLength);
+                if (extraDebugging) {
+                    qCDebug(octree) << "OctreeProcessor::processDatagram() ... "
+                        "Got Packet Section color:" << packetIsColored <<
+                        "compressed:" << packetIsCompressed <<
+                        "sequence: " << sequence <<
+                        "flight: " << flightTime << " usec" <<
+                        "size:" << message.getSize() <<
+                        "data:" << message.getBytesLeftToRead() <<
+                        "subsection:" << subsection <<
+                        "sectionLength:" << sectionLength <<
+                        "uncompressed:" << packetData.getUncompressedSize();
+                }
+                sections.emplace_back(reinterpret_cast<const char*>(packetData.getUncompressedData()),
+                                      packetData.getUncompressedSize());
 
+                // seek forwards in packet
+                message.seek(message.getPosition() + sectionLength);
+            }
+            subsection++;
+        }
+
+        if (!sections.empty()) {
+            quint64 startLock = usecTimestampNow();
+            quint64 startReadBitsteam, endReadBitsteam;
+            _tree->withWriteLock([&] {
+                startReadBitsteam = usecTimestampNow();
+                for (const auto& section : sections) {
+                    // ask the VoxelTree to read the bitstream into the tree
+                    ReadBitstreamToTreeParams args(WANT_EXISTS_BITS, NULL,
+                                                   sourceUUID, sourceNode);
                     if (extraDebugging) {
                         qCDebug(octree) << "OctreeProcessor::processDatagram() ******* START _tree->readBitstreamToTree()...";
                     }
-                    startReadBitsteam = usecTimestampNow();
-                    _tree->readBitstreamToTree(packetData.getUncompressedData(), packetData.getUncompressedSize(), args);
-                    endReadBitsteam = usecTimestampNow();
+                    _tree->readBitstreamToTree(reinterpret_cast<const unsigned char*>(section.constData()), section.size(), args);
                     if (extraDebugging) {
                         qCDebug(octree) << "OctreeProcessor::processDatagram() ******* END _tree->readBitstreamToTree()...";
                     }
-                });
-
-                // seek forwards in packet
-                message.seek(message.getPosition() + sectionLength);
 
-                elementsPerPacket += args.elementsPerPacket;
-                entitiesPerPacket += args.entitiesPerPacket;
+                    elementsPerPacket += args.elementsPerPacket;
+                    entitiesPerPacket += args.entitiesPerPacket;
 
-                _elementsInLastWindow += args.elementsPerPacket;
-                _entitiesInLastWindow += args.entitiesPerPacket;
-
-                totalWaitingForLock += (startUncompress - startLock);
-                totalUncompress += (startReadBitsteam - startUncompress);
-                totalReadBitsteam += (endReadBitsteam - startReadBitsteam);
+                    _elementsInLastWindow += args.elementsPerPacket;
+                    _entitiesInLastWindow += args.entitiesPerPacket;
+                }
+                endReadBitsteam = usecTimestampNow();
+            });
 
-            }
-            subsection++;
+            totalUncompress += (startLock - startUncompress);
+            totalWaitingForLock += (startReadBitsteam - startLock);
+            totalReadBitsteam += (endReadBitsteam - startReadBitsteam);
         }
         _elementsPerPacket.updateAverage(elementsPerPacket);
         _entitiesPerPacket.updateAverage(entitiesPerPacket);
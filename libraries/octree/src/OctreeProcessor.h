@@ -59,6 +59,10 @@ public:
 
     OCTREE_PACKET_SEQUENCE getLastOctreeMessageSequence() const { return _lastOctreeMessageSequence; }
 
+    // the dictionary the server may compress packets against, once the query has told it this viewer has it
+    const QByteArray& getCompressionDictionary() const { return _compressionDictionary; }
+    void setCompressionDictionary(const QByteArray& compressionDictionary) { _compressionDictionary = compressionDictionary; }
+
 protected:
     virtual OctreePointer createTree() = 0;
 
@@ -82,6 +86,8 @@ protected:
     int _entitiesInLastWindow = 0;
     std::atomic<OCTREE_PACKET_SEQUENCE> _lastOctreeMessageSequence;
 
+    QByteArray _compressionDictionary;
+
 };
 
 #endif // hifi_OctreeProcessor_h
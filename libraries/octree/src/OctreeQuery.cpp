@@ -86,6 +86,9 @@ int OctreeQuery::getBroadcastData(unsigned char* destinationBuffer) {
     memcpy(destinationBuffer, &queryFlags, sizeof(queryFlags));
     destinationBuffer += sizeof(queryFlags);
 
+    memcpy(destinationBuffer, &_compressionDictionaryID, sizeof(_compressionDictionaryID));
+    destinationBuffer += sizeof(_compressionDictionaryID);
+
     return destinationBuffer - bufferStart;
 }
 
@@ -166,5 +169,8 @@ int OctreeQuery::parseData(ReceivedMessage& message) {
 
     _reportInitialCompletion = bool(queryFlags & OctreeQueryFlags::WantInitialCompletion);
 
+    memcpy(&_compressionDictionaryID, sourceBuffer, sizeof(_compressionDictionaryID));
+    sourceBuffer += sizeof(_compressionDictionaryID);
+
     return sourceBuffer - startPosition;
 }
@@ -48,6 +48,10 @@ public:
     float getOctreeSizeScale() const { return _octreeElementSizeScale; }
     int getBoundaryLevelAdjust() const { return _boundaryLevelAdjust; }
 
+    // the id of the dictionary this viewer can uncompress octree data with, 0 if none
+    uint32_t getCompressionDictionaryID() const { return _compressionDictionaryID; }
+    void setCompressionDictionaryID(uint32_t compressionDictionaryID) { _compressionDictionaryID = compressionDictionaryID; }
+
     void incrementConnectionID() { ++_connectionID; }
 
     bool hasReceivedFirstQuery() const  { return _hasReceivedFirstQuery; }
@@ -72,6 +76,7 @@ protected:
     int _maxQueryPPS = DEFAULT_MAX_OCTREE_PPS;
     float _octreeElementSizeScale = DEFAULT_OCTREE_SIZE_SCALE; /// used for LOD calculations
     int _boundaryLevelAdjust = 0; /// used for LOD calculations
+    uint32_t _compressionDictionaryID { 0 };
 
     uint16_t _connectionID; // query connection ID, randomized to start, increments with each new connection to server
     
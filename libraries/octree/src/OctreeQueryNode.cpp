@@ -106,6 +106,9 @@ void OctreeQueryNode::resetOctreePacket() {
     OCTREE_PACKET_FLAGS flags = 0;
     setAtBit(flags, PACKET_IS_COLOR_BIT); // always color
     setAtBit(flags, PACKET_IS_COMPRESSED_BIT); // always compressed
+    if (_usesCompressionDictionary) {
+        setAtBit(flags, PACKET_USES_COMPRESSION_DICTIONARY_BIT);
+    }
 
     _octreePacket->reset();
 
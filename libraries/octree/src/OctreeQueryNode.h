@@ -86,6 +86,10 @@ public:
     bool shouldForceFullScene() const { return _shouldForceFullScene; }
     void setShouldForceFullScene(bool shouldForceFullScene) { _shouldForceFullScene = shouldForceFullScene; }
 
+    // whether the sections of packets from the next reset on are compressed against the negotiated dictionary
+    bool usesCompressionDictionary() const { return _usesCompressionDictionary; }
+    void setUsesCompressionDictionary(bool usesCompressionDictionary) { _usesCompressionDictionary = usesCompressionDictionary; }
+
 private:
     bool _viewSent { false };
     std::unique_ptr<NLPacket> _octreePacket;
@@ -118,6 +122,7 @@ private:
     QJsonObject _lastCheckJSONParameters;
 
     bool _shouldForceFullScene { false };
+    bool _usesCompressionDictionary { false };
 };
 
 #endif // hifi_OctreeQueryNode_h
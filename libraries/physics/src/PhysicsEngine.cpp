@@ -11,6 +11,7 @@
 
 #include "PhysicsEngine.h"
 
+#include <algorithm>
 #include <functional>
 
 #include <QFile>
@@ -19,6 +20,10 @@
 #include <PhysicsCollisionGroups.h>
 #include <Profile.h>
 #include <BulletCollision/CollisionShapes/btTriangleShape.h>
+#ifdef BT_THREADSAFE
+#include <BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h>
+#include <LinearMath/btThreads.h>
+#endif
 
 #include "CharacterController.h"
 #include "ObjectMotionState.h"
@@ -39,16 +44,49 @@ PhysicsEngine::~PhysicsEngine() {
     delete _broadphaseFilter;
     delete _constraintSolver;
     delete _dynamicsWorld;
+#ifdef BT_THREADSAFE
+    delete _constraintSolverPool;
+#endif
     delete _ghostPairCallback;
 }
 
 void PhysicsEngine::init() {
     if (!_dynamicsWorld) {
         _collisionConfig = new btDefaultCollisionConfiguration();
+        // The narrowphase stays on this thread even when the solver is multithreaded: the contact added callback
+        // (see setContactAddedCallback()) isn't thread safe.
         _collisionDispatcher = new btCollisionDispatcher(_collisionConfig);
         _broadphaseFilter = new btDbvtBroadphase();
+#ifdef BT_THREADSAFE
+        // the sequential scheduler runs everything on this thread, just as the single threaded world would
+        btITaskScheduler* taskScheduler = btGetSequentialTaskScheduler();
+        if (_numThreads > 1) {
+            btITaskScheduler* parallelScheduler = btGetTBBTaskScheduler();
+            if (!parallelScheduler) {
+                parallelScheduler = btCreateDefaultTaskScheduler();
+            }
+            if (parallelScheduler) {
+                taskScheduler = parallelScheduler;
+                taskScheduler->setNumThreads(std::min(_numThreads, taskScheduler->getMaxNumThreads()));
+            } else {
+                qCWarning(physics) << "No multithreaded task scheduler is available, stepping the simulation on one thread";
+            }
+        }
+        btSetTaskScheduler(taskScheduler);
+        qCDebug(physics) << "Stepping the simulation with" << taskScheduler->getNumThreads() << "threads using the"
+                         << taskScheduler->getName() << "task scheduler";
+
+        _constraintSolverPool = new btConstraintSolverPoolMt(taskScheduler->getNumThreads());
+        _constraintSolver = new btSequentialImpulseConstraintSolverMt;
+        _dynamicsWorld = new ThreadSafeDynamicsWorld(_collisionDispatcher, _broadphaseFilter, _constraintSolverPool,
+                                                     _constraintSolver, _collisionConfig);
+#else
+        if (_numThreads > 1) {
+            qCWarning(physics) << "Bullet wasn't built thread safe, stepping the simulation on one thread";
+        }
         _constraintSolver = new btSequentialImpulseConstraintSolver;
         _dynamicsWorld = new ThreadSafeDynamicsWorld(_collisionDispatcher, _broadphaseFilter, _constraintSolver, _collisionConfig);
+#endif
         _physicsDebugDraw.reset(new PhysicsDebugDraw());
 
         // hook up debug draw renderer
@@ -310,17 +348,25 @@ void PhysicsEngine::stepSimulation() {
     // (3) synchronize outgoing motion states
     // (4) send outgoing packets
 
-    const float MAX_TIMESTEP = (float)PHYSICS_ENGINE_MAX_NUM_SUBSTEPS * PHYSICS_ENGINE_FIXED_SUBSTEP;
+    int maxSubsteps = PHYSICS_ENGINE_MAX_NUM_SUBSTEPS;
+    float averageSubstepUsecs = _dynamicsWorld->getAverageSubstepUsecs();
+    if (_stepBudgetUsecs > 0 && averageSubstepUsecs > 0.0f) {
+        // always at least one substep, or a simulation that's over budget would stop altogether
+        int affordableSubsteps = (int)((float)_stepBudgetUsecs / averageSubstepUsecs);
+        maxSubsteps = std::max(1, std::min(affordableSubsteps, maxSubsteps));
+    }
+
+    const float maxTimeStep = (float)maxSubsteps * PHYSICS_ENGINE_FIXED_SUBSTEP;
     float dt = 1.0e-6f * (float)(_clock.getTimeMicroseconds());
     _clock.reset();
-    float timeStep = btMin(dt, MAX_TIMESTEP);
+    float timeStep = btMin(dt, maxTimeStep);
 
     auto onSubStep = [this]() {
         this->updateContactMap();
         this->doOwnershipInfectionForConstraints();
     };
 
-    int numSubsteps = _dynamicsWorld->stepSimulationWithSubstepCallback(timeStep, PHYSICS_ENGINE_MAX_NUM_SUBSTEPS,
+    int numSubsteps = _dynamicsWorld->stepSimulationWithSubstepCallback(timeStep, maxSubsteps,
                                                                         PHYSICS_ENGINE_FIXED_SUBSTEP, onSubStep);
     if (numSubsteps > 0) {
         _hasOutgoingChanges = true;
@@ -415,6 +461,14 @@ void PhysicsEngine::harvestPerformanceStats() {
             itr->Next();
         }
     }
+
+    if (_dynamicsWorld) {
+        auto substepTimes = _dynamicsWorld->takeSubstepTimes();
+        if (substepTimes.numSubsteps > 0) {
+            PerformanceTimer::addTimerRecord("physics/substep", substepTimes.totalUsecs / substepTimes.numSubsteps);
+            PerformanceTimer::addTimerRecord("physics/substepMax", substepTimes.maxUsecs);
+        }
+    }
 }
 
 void PhysicsEngine::printPerformanceStatsToFile(const QString& filename) {
@@ -20,6 +20,8 @@
 #include <btBulletDynamicsCommon.h>
 #include <BulletCollision/CollisionDispatch/btGhostObject.h>
 
+#include <NumericalConstants.h>
+
 #include "BulletUtil.h"
 #include "ContactInfo.h"
 #include "ObjectMotionState.h"
@@ -92,8 +94,23 @@ public:
         std::vector<ObjectMotionState*> activeStaticObjects;
     };
 
+    static const uint64_t DEFAULT_STEP_BUDGET_USECS = 8 * USECS_PER_MSEC;
+
     PhysicsEngine(const glm::vec3& offset);
     ~PhysicsEngine();
+
+    // Opt-in: solves the simulation's islands on up to this many threads. Only has an effect when Bullet was built
+    // thread safe (BT_THREADSAFE), and has to be set before init().
+    void setNumThreads(int numThreads) { _numThreads = numThreads; }
+    int getNumThreads() const { return _numThreads; }
+
+    // How much of a frame the substeps of one stepSimulation() may take. When the substeps it would take to catch up
+    // with real time don't fit, this many are stepped and the rest of the time is dropped, so that a slow simulation
+    // slows down rather than stalling the frame and falling further behind. 0 leaves the number of substeps unlimited
+    // by time.
+    void setStepBudget(uint64_t usecs) { _stepBudgetUsecs = usecs; }
+    uint64_t getStepBudget() const { return _stepBudgetUsecs; }
+
     void init();
 
     uint32_t getNumSubsteps() const;
@@ -173,10 +190,16 @@ private:
     btCollisionDispatcher* _collisionDispatcher = NULL;
     btBroadphaseInterface* _broadphaseFilter = NULL;
     btSequentialImpulseConstraintSolver* _constraintSolver = NULL;
+#ifdef BT_THREADSAFE
+    btConstraintSolverPoolMt* _constraintSolverPool = NULL;
+#endif
     ThreadSafeDynamicsWorld* _dynamicsWorld = NULL;
     btGhostPairCallback* _ghostPairCallback = NULL;
     std::unique_ptr<PhysicsDebugDraw> _physicsDebugDraw;
 
+    int _numThreads { 1 };
+    uint64_t _stepBudgetUsecs { DEFAULT_STEP_BUDGET_USECS };
+
     ContactMap _contactMap;
     CollisionEvents _collisionEvents;
     QHash<QUuid, EntityDynamicPointer> _objectDynamics;
@@ -483,6 +483,45 @@ void ShapeFactory::deleteShape(const btCollisionShape* shape) {
     delete nonConstShape;
 }
 
+size_t ShapeFactory::getShapeSize(const btCollisionShape* shape) {
+    assert(shape);
+    switch (shape->getShapeType()) {
+        case COMPOUND_SHAPE_PROXYTYPE: {
+            const btCompoundShape* compoundShape = static_cast<const btCompoundShape*>(shape);
+            const int numChildShapes = compoundShape->getNumChildShapes();
+            size_t size = sizeof(btCompoundShape) + numChildShapes * sizeof(btCompoundShapeChild);
+            for (int i = 0; i < numChildShapes; ++i) {
+                size += getShapeSize(compoundShape->getChildShape(i));
+            }
+            return size;
+        }
+        case CONVEX_HULL_SHAPE_PROXYTYPE: {
+            const btConvexHullShape* hull = static_cast<const btConvexHullShape*>(shape);
+            return sizeof(btConvexHullShape) + hull->getNumPoints() * sizeof(btVector3);
+        }
+        case TRIANGLE_MESH_SHAPE_PROXYTYPE: {
+            // the only triangle meshes we make are StaticMeshShapes, whose data is in a btTriangleIndexVertexArray
+            const StaticMeshShape* meshShape = static_cast<const StaticMeshShape*>(shape);
+            size_t size = sizeof(StaticMeshShape) + sizeof(btTriangleIndexVertexArray);
+            const btTriangleIndexVertexArray* dataArray =
+                static_cast<const btTriangleIndexVertexArray*>(meshShape->getMeshInterface());
+            const IndexedMeshArray& meshes = dataArray->getIndexedMeshArray();
+            for (int32_t i = 0; i < meshes.size(); ++i) {
+                size += (size_t)meshes[i].m_numVertices * meshes[i].m_vertexStride +
+                    (size_t)meshes[i].m_numTriangles * meshes[i].m_triangleIndexStride;
+            }
+            const btOptimizedBvh* bvh = const_cast<StaticMeshShape*>(meshShape)->getOptimizedBvh();
+            if (bvh) {
+                size += bvh->calculateSerializeBufferSize();
+            }
+            return size;
+        }
+        default:
+            // primitives are small and all about the same size
+            return sizeof(btConvexInternalShape);
+    }
+}
+
 void ShapeFactory::Worker::run() {
     shape = ShapeFactory::createShapeFromInfo(shapeInfo);
     emit submitWork(this);
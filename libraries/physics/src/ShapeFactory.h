@@ -25,6 +25,9 @@ namespace ShapeFactory {
     const btCollisionShape* createShapeFromInfo(const ShapeInfo& info);
     void deleteShape(const btCollisionShape* shape);
 
+    // roughly how much memory the shape takes, for stats
+    size_t getShapeSize(const btCollisionShape* shape);
+
     class Worker : public QObject, public QRunnable {
         Q_OBJECT
     public:
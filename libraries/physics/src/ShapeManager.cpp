@@ -18,6 +18,9 @@
 
 const int MAX_RING_SIZE = 256;
 
+// fewer points than this are quicker to make hulls of than to hand to a worker
+const int MIN_OFF_THREAD_HULL_POINTS = 1024;
+
 ShapeManager::ShapeManager() {
     _garbageRing.reserve(MAX_RING_SIZE);
     _nextOrphanExpiry = std::chrono::steady_clock::now();
@@ -47,7 +50,7 @@ const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
         return shapeRef->shape;
     }
     const btCollisionShape* shape = nullptr;
-    if (info.getType() == SHAPE_TYPE_STATIC_MESH) {
+    if (isBuiltOffThread(info)) {
         uint64_t hash = info.getHash();
 
         // bump the request count to the caller knows we're 
@@ -75,11 +78,7 @@ const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
     } else {
         shape = ShapeFactory::createShapeFromInfo(info);
         if (shape) {
-            ShapeReference newRef;
-            newRef.refCount = 1;
-            newRef.shape = shape;
-            newRef.key = info.getHash();
-            _shapeMap.insert(hashKey, newRef);
+            addShape(info.getHash(), shape, 1);
         }
     }
     return shape;
@@ -95,18 +94,58 @@ const btCollisionShape* ShapeManager::getShapeByKey(uint64_t key) {
     return nullptr;
 }
 
+bool ShapeManager::mayBuildOffThread(ShapeType type) {
+    return type == SHAPE_TYPE_STATIC_MESH || type == SHAPE_TYPE_COMPOUND || type == SHAPE_TYPE_SIMPLE_COMPOUND;
+}
+
+bool ShapeManager::isBuiltOffThread(const ShapeInfo& info) {
+    ShapeType type = info.getType();
+    if (type == SHAPE_TYPE_STATIC_MESH) {
+        return true;
+    }
+    if (mayBuildOffThread(type)) {
+        int numPoints = 0;
+        for (const auto& points : info.getPointCollection()) {
+            numPoints += points.size();
+            if (numPoints >= MIN_OFF_THREAD_HULL_POINTS) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 bool ShapeManager::hasShapeWithKey(uint64_t key) const {
     HashKey hashKey(key);
     const ShapeReference* shapeRef = _shapeMap.find(hashKey);
     return (bool)shapeRef;
 }
 
+void ShapeManager::addShape(uint64_t key, const btCollisionShape* shape, int refCount) {
+    ShapeReference newRef;
+    newRef.refCount = refCount;
+    newRef.shape = shape;
+    newRef.key = key;
+    newRef.size = ShapeFactory::getShapeSize(shape);
+    _shapeMap.insert(HashKey(key), newRef);
+    _shapeKeys[shape] = key;
+    _shapesSize += newRef.size;
+}
+
+void ShapeManager::deleteShape(const HashKey& key, const btCollisionShape* shape) {
+    ShapeReference* shapeRef = _shapeMap.find(key);
+    assert(shapeRef && shapeRef->shape == shape);
+    _shapesSize -= shapeRef->size;
+    _shapeKeys.erase(shape);
+    _shapeMap.remove(key);
+    ShapeFactory::deleteShape(shape);
+}
+
 void ShapeManager::addToGarbage(uint64_t key) {
     // look for existing entry in _garbageRing
     int32_t ringSize = (int32_t)(_garbageRing.size());
     for (int32_t i = 0; i < ringSize; ++i) {
-        int32_t j = (_ringIndex + ringSize) % ringSize;
-        if (_garbageRing[j] == key) {
+        if (_garbageRing[i] == key) {
             // already on the list, don't add it again
             return;
         }
@@ -116,8 +155,7 @@ void ShapeManager::addToGarbage(uint64_t key) {
         HashKey hashKeyToRemove(_garbageRing[_ringIndex]);
         ShapeReference* shapeRef = _shapeMap.find(hashKeyToRemove);
         if (shapeRef && shapeRef->refCount == 0) {
-            ShapeFactory::deleteShape(shapeRef->shape);
-            _shapeMap.remove(hashKeyToRemove);
+            deleteShape(hashKeyToRemove, shapeRef->shape);
         }
         // replace at _ringIndex and advance
         _garbageRing[_ringIndex] = key;
@@ -151,12 +189,9 @@ bool ShapeManager::releaseShapeByKey(uint64_t key) {
 }
 
 bool ShapeManager::releaseShape(const btCollisionShape* shape) {
-    int numShapes = _shapeMap.size();
-    for (int i = 0; i < numShapes; ++i) {
-        ShapeReference* shapeRef = _shapeMap.getAtIndex(i);
-        if (shape == shapeRef->shape) {
-            return releaseShapeByKey(shapeRef->key);
-        }
+    auto itr = _shapeKeys.find(shape);
+    if (itr != _shapeKeys.end()) {
+        return releaseShapeByKey(itr->second);
     }
     return false;
 }
@@ -167,8 +202,7 @@ void ShapeManager::collectGarbage() {
         HashKey key(_garbageRing[i]);
         ShapeReference* shapeRef = _shapeMap.find(key);
         if (shapeRef && shapeRef->refCount == 0) {
-            ShapeFactory::deleteShape(shapeRef->shape);
-            _shapeMap.remove(key);
+            deleteShape(key, shapeRef->shape);
         }
     }
     _ringIndex = 0;
@@ -185,10 +219,10 @@ int ShapeManager::getNumReferences(const ShapeInfo& info) const {
 }
 
 int ShapeManager::getNumReferences(const btCollisionShape* shape) const {
-    int numShapes = _shapeMap.size();
-    for (int i = 0; i < numShapes; ++i) {
-        const ShapeReference* shapeRef = _shapeMap.getAtIndex(i);
-        if (shape == shapeRef->shape) {
+    auto itr = _shapeKeys.find(shape);
+    if (itr != _shapeKeys.end()) {
+        const ShapeReference* shapeRef = _shapeMap.find(HashKey(itr->second));
+        if (shapeRef) {
             return shapeRef->refCount;
         }
     }
@@ -196,14 +230,7 @@ int ShapeManager::getNumReferences(const btCollisionShape* shape) const {
 }
 
 bool ShapeManager::hasShape(const btCollisionShape* shape) const {
-    int numShapes = _shapeMap.size();
-    for (int i = 0; i < numShapes; ++i) {
-        const ShapeReference* shapeRef = _shapeMap.getAtIndex(i);
-        if (shape == shapeRef->shape) {
-            return true;
-        }
-    }
-    return false;
+    return _shapeKeys.find(shape) != _shapeKeys.end();
 }
 
 // slot: called when ShapeFactory::Worker is done building shape
@@ -222,13 +249,9 @@ void ShapeManager::acceptWork(ShapeFactory::Worker* worker) {
 
         // cache the new shape
         if (worker->shape) {
-            ShapeReference newRef;
+            uint64_t newKey = worker->shapeInfo.getHash();
             // refCount is zero because nothing is using the shape yet
-            newRef.refCount = 0;
-            newRef.shape = worker->shape;
-            newRef.key = worker->shapeInfo.getHash();
-            HashKey hashKey(newRef.key);
-            _shapeMap.insert(hashKey, newRef);
+            addShape(newKey, worker->shape, 0);
 
             // This shape's refCount is zero because an object requested it but is not yet using it.  We expect it to be
             // used later but there is a possibility it will never be used (e.g. the object that wanted it was removed
@@ -265,7 +288,7 @@ void ShapeManager::acceptWork(ShapeFactory::Worker* worker) {
                     }
                 }
             }
-            _orphans.push_back(KeyExpiry(newRef.key, newExpiry));
+            _orphans.push_back(KeyExpiry(newKey, newExpiry));
         }
     }
     disconnect(worker, &ShapeFactory::Worker::submitWork, this, &ShapeManager::acceptWork);
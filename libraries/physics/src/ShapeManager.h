@@ -14,6 +14,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <unordered_map>
 #include <vector>
 
 #include <QObject>
@@ -55,7 +56,7 @@ public:
     ShapeManager();
     ~ShapeManager();
 
-    /// \return pointer to shape
+    /// \return pointer to shape, or null while a shape that's built off thread is still being built
     const btCollisionShape* getShape(const ShapeInfo& info);
     const btCollisionShape* getShapeByKey(uint64_t key);
     bool hasShapeWithKey(uint64_t key) const;
@@ -68,16 +69,24 @@ public:
 
     // validation methods
     int getNumShapes() const { return _shapeMap.size(); }
+    size_t getShapesSize() const { return _shapesSize; } // bytes, roughly
     int getNumReferences(const ShapeInfo& info) const;
     int getNumReferences(const btCollisionShape* shape) const;
     bool hasShape(const btCollisionShape* shape) const;
     uint32_t getWorkRequestCount() const { return _workRequestCount; }
     uint32_t getWorkDeliveryCount() const { return _workDeliveryCount; }
 
+    // Static meshes and compounds of many hull points take long enough to build that they're built on a worker
+    // thread, see the work request and delivery counts. Objects that need them join the simulation once they arrive.
+    static bool isBuiltOffThread(const ShapeInfo& info);
+    static bool mayBuildOffThread(ShapeType type);
+
 protected slots:
     void acceptWork(ShapeFactory::Worker* worker);
 
 private:
+    void addShape(uint64_t key, const btCollisionShape* shape, int refCount);
+    void deleteShape(const HashKey& key, const btCollisionShape* shape);
     void addToGarbage(uint64_t key);
     bool releaseShapeByKey(uint64_t key);
 
@@ -86,6 +95,7 @@ private:
         int refCount;
         const btCollisionShape* shape;
         uint64_t key { 0 };
+        size_t size { 0 };
         ShapeReference() : refCount(0), shape(nullptr) {}
     };
 
@@ -99,6 +109,9 @@ private:
 
     // btHashMap is required because it supports memory alignment of the btCollisionShapes
     btHashMap<HashKey, ShapeReference> _shapeMap;
+    // so that shapes can be released by pointer without searching the map
+    std::unordered_map<const btCollisionShape*, uint64_t> _shapeKeys;
+    size_t _shapesSize { 0 };
     std::vector<uint64_t> _garbageRing;
     std::vector<uint64_t> _pendingMeshShapes;
     std::vector<KeyExpiry> _orphans;
@@ -17,10 +17,24 @@
 
 #include "ThreadSafeDynamicsWorld.h"
 
+#include <algorithm>
+
 #include <LinearMath/btQuickprof.h>
 
+#include <SharedUtil.h>
+
 #include "Profile.h"
 
+#ifdef BT_THREADSAFE
+ThreadSafeDynamicsWorld::ThreadSafeDynamicsWorld(
+        btDispatcher* dispatcher,
+        btBroadphaseInterface* pairCache,
+        btConstraintSolverPoolMt* solverPool,
+        btConstraintSolver* constraintSolverMt,
+        btCollisionConfiguration* collisionConfiguration)
+    :   btDiscreteDynamicsWorldMt(dispatcher, pairCache, solverPool, constraintSolverMt, collisionConfiguration) {
+}
+#else
 ThreadSafeDynamicsWorld::ThreadSafeDynamicsWorld(
         btDispatcher* dispatcher,
         btBroadphaseInterface* pairCache,
@@ -28,6 +42,13 @@ ThreadSafeDynamicsWorld::ThreadSafeDynamicsWorld(
         btCollisionConfiguration* collisionConfiguration)
     :   btDiscreteDynamicsWorld(dispatcher, pairCache, constraintSolver, collisionConfiguration) {
 }
+#endif
+
+ThreadSafeDynamicsWorld::SubstepTimes ThreadSafeDynamicsWorld::takeSubstepTimes() {
+    SubstepTimes times = _substepTimes;
+    _substepTimes = SubstepTimes();
+    return times;
+}
 
 int ThreadSafeDynamicsWorld::stepSimulationWithSubstepCallback(btScalar timeStep, int maxSubSteps,
                                                                btScalar fixedTimeStep, SubStepCallback onSubStep) {
@@ -75,7 +96,14 @@ int ThreadSafeDynamicsWorld::stepSimulationWithSubstepCallback(btScalar timeStep
 
         for (int i=0;i<clampedSimulationSteps;i++) {
             DETAILED_PROFILE_RANGE(simulation_physics, "substep");
+            uint64_t start = usecTimestampNow();
             internalSingleStepSimulation(fixedTimeStep);
+            uint64_t elapsed = usecTimestampNow() - start;
+            _substepTimes.totalUsecs += elapsed;
+            _substepTimes.maxUsecs = std::max(_substepTimes.maxUsecs, elapsed);
+            ++_substepTimes.numSubsteps;
+            const float SUBSTEP_TIME_TIMESCALE = 0.1f;
+            _averageSubstepUsecs += SUBSTEP_TIME_TIMESCALE * ((float)elapsed - _averageSubstepUsecs);
             onSubStep();
         }
     }
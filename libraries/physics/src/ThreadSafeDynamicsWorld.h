@@ -21,21 +21,50 @@
 #include <BulletDynamics/Dynamics/btRigidBody.h>
 #include <BulletDynamics/Dynamics/btDiscreteDynamicsWorld.h>
 
+// When Bullet is built thread safe the world can solve its simulation islands, integrate and predict motion in
+// parallel, see PhysicsEngine::setNumThreads()
+#ifdef BT_THREADSAFE
+#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
+using DynamicsWorldBase = btDiscreteDynamicsWorldMt;
+#else
+using DynamicsWorldBase = btDiscreteDynamicsWorld;
+#endif
+
 #include "ObjectMotionState.h"
 
 #include <functional>
 
 using SubStepCallback = std::function<void()>;
 
-ATTRIBUTE_ALIGNED16(class) ThreadSafeDynamicsWorld : public btDiscreteDynamicsWorld {
+ATTRIBUTE_ALIGNED16(class) ThreadSafeDynamicsWorld : public DynamicsWorldBase {
 public:
     BT_DECLARE_ALIGNED_ALLOCATOR();
 
+#ifdef BT_THREADSAFE
+    ThreadSafeDynamicsWorld(
+            btDispatcher* dispatcher,
+            btBroadphaseInterface* pairCache,
+            btConstraintSolverPoolMt* solverPool,
+            btConstraintSolver* constraintSolverMt,
+            btCollisionConfiguration* collisionConfiguration);
+#else
     ThreadSafeDynamicsWorld(
             btDispatcher* dispatcher,
             btBroadphaseInterface* pairCache,
             btConstraintSolver* constraintSolver,
             btCollisionConfiguration* collisionConfiguration);
+#endif
+
+    // the time taken by the substeps since the last call, for PhysicsEngine::harvestPerformanceStats()
+    struct SubstepTimes {
+        uint64_t totalUsecs { 0 };
+        uint64_t maxUsecs { 0 };
+        uint32_t numSubsteps { 0 };
+    };
+    SubstepTimes takeSubstepTimes();
+
+    // a running average of how long a substep takes, for PhysicsEngine to keep within its step budget
+    float getAverageSubstepUsecs() const { return _averageSubstepUsecs; }
 
     int getNumSubsteps() const { return _numSubsteps; }
     int stepSimulationWithSubstepCallback(btScalar timeStep, int maxSubSteps = 1,
@@ -66,6 +95,8 @@ private:
     SetOfMotionStates _activeStates;
     SetOfMotionStates _lastActiveStates;
     int _numSubsteps { 0 };
+    SubstepTimes _substepTimes;
+    float _averageSubstepUsecs { 0.0f };
 };
 
 #endif // hifi_ThreadSafeDynamicsWorld_h
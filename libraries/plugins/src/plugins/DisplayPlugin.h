@@ -215,6 +215,10 @@ public:
     virtual StencilMaskMode getStencilMaskMode() const { return StencilMaskMode::NONE; }
     using StencilMaskMeshOperator = std::function<void(gpu::Batch&)>;
     virtual StencilMaskMeshOperator getStencilMaskMeshOperator() { return nullptr; }
+    // Beyond this radius around the foveation center of each eye, in the eye's normalized device coordinates, only part of
+    // the pixels are shaded and the rest filled in from them.  0 shades them all
+    virtual float getFoveationRadius() const { return 0.0f; }
+    virtual glm::vec2 getFoveationCenter(Eye eye) const { return glm::vec2(0.0f); }
     virtual void updateParameters(float visionSqueezeX, float visionSqueezeY, float visionSqueezeTransition,
                                   int visionSqueezePerEye, float visionSqueezeGroundPlaneY,
                                   float visionSqueezeSpotlightSize) {}
@@ -21,6 +21,7 @@
 #endif
 
 #include <DependencyManager.h>
+#include <Profile.h>
 #include <UserActivityLogger.h>
 #include <QThreadPool>
 
@@ -163,6 +164,14 @@ int PluginManager::instantiate() {
     return loadedPlugins;
 }
 
+void PluginManager::preloadPlugins() {
+    // only the libraries are loaded, the plugin objects are still created on the thread that first asks for them
+    _preloadedPlugins = std::async(std::launch::async, [this] {
+        PROFILE_RANGE(startup, "preloadPlugins");
+        getLoadedPlugins();
+    });
+}
+
 const CodecPluginList& PluginManager::getCodecPlugins() {
     static CodecPluginList codecPlugins;
     static std::once_flag once;
@@ -7,6 +7,8 @@
 //
 #pragma once
 
+#include <future>
+
 #include <QObject>
 #include <QtCore/QSharedPointer>
 
@@ -43,6 +45,9 @@ public:
     int instantiate();
     void shutdown();
 
+    // starts loading the plugin libraries on a thread of their own, whatever needs them first waits for them to be loaded
+    void preloadPlugins();
+
     // Application that have statically linked plugins can expose them to the plugin manager with these function
     void setDisplayPluginProvider(const DisplayPluginProvider& provider);
     void setInputPluginProvider(const InputPluginProvider& provider);
@@ -76,6 +81,8 @@ private:
     Setting::Handle<bool> _enableScriptingPlugins {
         "private/enableScriptingPlugins", (bool)qgetenv("enableScriptingPlugins").toInt()
     };
+
+    std::future<void> _preloadedPlugins; // last, so that it is waited for before the rest is destroyed
 };
 
 // TODO: we should define this value in CMake, and then use CMake
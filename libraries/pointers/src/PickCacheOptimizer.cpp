@@ -0,0 +1,19 @@
+//
+//  PickCacheOptimizer.cpp
+//  libraries/pointers/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PickCacheOptimizer.h"
+
+#include <tbb/parallel_for.h>
+
+void forEachPickConcurrently(size_t count, const std::function<void(size_t)>& work) {
+    tbb::parallel_for(size_t(0), count, [&](size_t i) {
+        work(i);
+    });
+}
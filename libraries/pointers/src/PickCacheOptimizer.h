@@ -8,6 +8,7 @@
 #ifndef hifi_PickCacheOptimizer_h
 #define hifi_PickCacheOptimizer_h
 
+#include <functional>
 #include <unordered_map>
 
 #include "Pick.h"
@@ -31,17 +32,40 @@ namespace std {
     };
 }
 
+// runs work(0) to work(count - 1) on the worker threads, returns once they are all done
+void forEachPickConcurrently(size_t count, const std::function<void(size_t)>& work);
+
 // T is a mathematical representation of a Pick (a MathPick)
 // For example: RayPicks use T = PickRay
 template<typename T>
 class PickCacheOptimizer {
 
 public:
+    // Entity intersections only take the entity tree's read lock, so when findEntityIntersectionsConcurrently is set the
+    // picks are updated in batches, each batch's entity intersections found on worker threads.  Avatar and HUD intersections,
+    // and publishing the results, stay on the calling thread.
+    PickCacheOptimizer(bool findEntityIntersectionsConcurrently = false) :
+        _findEntityIntersectionsConcurrently(findEntityIntersectionsConcurrently) {}
+
     QVector3D update(std::unordered_map<uint32_t, std::shared_ptr<PickQuery>>& picks, uint32_t& nextToUpdate, uint64_t expiry, bool shouldPickHUD);
 
 protected:
     typedef std::unordered_map<T, std::unordered_map<PickCacheKey, PickResultPointer>> PickCache;
 
+    class PickUpdate {
+    public:
+        std::shared_ptr<Pick<T>> pick;
+        T mathematicalPick;
+        PickResultPointer res;
+        PickCacheKey entityKey;
+        int entityIntersection { -1 }; // index of the entity intersection found for this pick, or for an identical one
+        bool isEntityIntersectionOwner { false };
+    };
+
+    static const size_t CONCURRENT_BATCH_SIZE { 16 };
+
+    const bool _findEntityIntersectionsConcurrently;
+
     // Returns true if this pick exists in the cache, and if it does, update res if the cached result is closer
     bool checkAndCompareCachedResults(T& pick, PickCache& cache, PickResultPointer& res, const PickCacheKey& key);
     void cacheResult(const bool intersects, const PickResultPointer& resTemp, const PickCacheKey& key, PickResultPointer& res, T& mathPick, PickCache& cache, const std::shared_ptr<Pick<T>> pick);
@@ -79,23 +103,86 @@ QVector3D PickCacheOptimizer<T>::update(std::unordered_map<uint32_t, std::shared
             itr = picks.begin();
         }
     }
+    const size_t batchSize = _findEntityIntersectionsConcurrently ? CONCURRENT_BATCH_SIZE : 1;
+    std::vector<PickUpdate> batch;
+    std::vector<size_t> entityIntersectionPicks;
+    std::vector<PickResultPointer> entityIntersections;
+    std::unordered_map<T, std::unordered_map<PickCacheKey, int>> pendingEntityIntersections;
     uint32_t numUpdates = 0;
     while(numUpdates < picks.size()) {
-        std::shared_ptr<Pick<T>> pick = std::static_pointer_cast<Pick<T>>(itr->second);
-        T mathematicalPick = pick->getMathematicalPick();
-        PickResultPointer res = pick->getDefaultResult(mathematicalPick.toVariantMap());
+        batch.clear();
+        entityIntersectionPicks.clear();
+        pendingEntityIntersections.clear();
+        while (batch.size() < batchSize && numUpdates < picks.size()) {
+            PickUpdate pickUpdate;
+            pickUpdate.pick = std::static_pointer_cast<Pick<T>>(itr->second);
+            pickUpdate.mathematicalPick = pickUpdate.pick->getMathematicalPick();
+            pickUpdate.res = pickUpdate.pick->getDefaultResult(pickUpdate.mathematicalPick.toVariantMap());
+            batch.push_back(pickUpdate);
+
+            ++itr;
+            if (itr == picks.end()) {
+                itr = picks.begin();
+            }
+            nextToUpdate = itr->first;
+            ++numUpdates;
+        }
 
-        if (!pick->isEnabled() || pick->getMaxDistance() < 0.0f || !mathematicalPick) {
-            pick->setPickResult(res);
-        } else {
+        // the entity intersections not already cached, each one found once however many picks of the batch share it
+        for (size_t i = 0; i < batch.size(); ++i) {
+            PickUpdate& pickUpdate = batch[i];
+            auto& pick = pickUpdate.pick;
+            if (!pick->isEnabled() || pick->getMaxDistance() < 0.0f || !pickUpdate.mathematicalPick) {
+                continue;
+            }
             if (pick->getFilter().doesPickDomainEntities() || pick->getFilter().doesPickAvatarEntities() || pick->getFilter().doesPickLocalEntities()) {
-                PickCacheKey entityKey = { pick->getFilter().getEntityFlags(), pick->getIncludeItems(), pick->getIgnoreItems() };
-                if (!checkAndCompareCachedResults(mathematicalPick, results, res, entityKey)) {
-                    PickResultPointer entityRes = pick->getEntityIntersection(mathematicalPick);
+                pickUpdate.entityKey = { pick->getFilter().getEntityFlags(), pick->getIncludeItems(), pick->getIgnoreItems() };
+                if (!checkAndCompareCachedResults(pickUpdate.mathematicalPick, results, pickUpdate.res, pickUpdate.entityKey)) {
+                    auto& pending = pendingEntityIntersections[pickUpdate.mathematicalPick];
+                    auto pendingItr = pending.find(pickUpdate.entityKey);
+                    if (pendingItr != pending.end()) {
+                        pickUpdate.entityIntersection = pendingItr->second;
+                    } else {
+                        pickUpdate.entityIntersection = (int)entityIntersectionPicks.size();
+                        pickUpdate.isEntityIntersectionOwner = true;
+                        pending[pickUpdate.entityKey] = pickUpdate.entityIntersection;
+                        entityIntersectionPicks.push_back(i);
+                    }
+                }
+            }
+        }
+
+        entityIntersections.assign(entityIntersectionPicks.size(), PickResultPointer());
+        auto findEntityIntersection = [&](size_t i) {
+            PickUpdate& pickUpdate = batch[entityIntersectionPicks[i]];
+            entityIntersections[i] = pickUpdate.pick->getEntityIntersection(pickUpdate.mathematicalPick);
+        };
+        if (entityIntersectionPicks.size() > 1) {
+            forEachPickConcurrently(entityIntersectionPicks.size(), findEntityIntersection);
+        } else if (entityIntersectionPicks.size() == 1) {
+            findEntityIntersection(0);
+        }
+
+        for (auto& pickUpdate : batch) {
+            auto& pick = pickUpdate.pick;
+            T& mathematicalPick = pickUpdate.mathematicalPick;
+            PickResultPointer& res = pickUpdate.res;
+
+            if (!pick->isEnabled() || pick->getMaxDistance() < 0.0f || !mathematicalPick) {
+                pick->setPickResult(res);
+                continue;
+            }
+
+            if (pickUpdate.entityIntersection >= 0) {
+                if (pickUpdate.isEntityIntersectionOwner) {
+                    PickResultPointer entityRes = entityIntersections[pickUpdate.entityIntersection];
                     numIntersectionsComputed[0]++;
                     if (entityRes) {
-                        cacheResult(entityRes->doesIntersect(), entityRes, entityKey, res, mathematicalPick, results, pick);
+                        cacheResult(entityRes->doesIntersect(), entityRes, pickUpdate.entityKey, res, mathematicalPick, results, pick);
                     }
+                } else {
+                    // cached by the pick that owns the intersection, which comes earlier in the batch
+                    checkAndCompareCachedResults(mathematicalPick, results, res, pickUpdate.entityKey);
                 }
             }
 
@@ -129,12 +216,6 @@ QVector3D PickCacheOptimizer<T>::update(std::unordered_map<uint32_t, std::shared
             }
         }
 
-        ++itr;
-        if (itr == picks.end()) {
-            itr = picks.begin();
-        }
-        nextToUpdate = itr->first;
-        ++numUpdates;
         if (usecTimestampNow() > expiry) {
             break;
         }
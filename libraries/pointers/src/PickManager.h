@@ -87,9 +87,9 @@ protected:
     std::unordered_map<unsigned int, PickQuery::PickType> _typeMap;
     unsigned int _nextPickID { INVALID_PICK_ID + 1 };
 
-    PickCacheOptimizer<PickRay> _rayPickCacheOptimizer;
+    PickCacheOptimizer<PickRay> _rayPickCacheOptimizer { true };
     PickCacheOptimizer<StylusTip> _stylusPickCacheOptimizer;
-    PickCacheOptimizer<PickParabola> _parabolaPickCacheOptimizer;
+    PickCacheOptimizer<PickParabola> _parabolaPickCacheOptimizer { true };
     PickCacheOptimizer<CollisionRegion> _collisionPickCacheOptimizer;
 
     static const unsigned int DEFAULT_PER_FRAME_TIME_BUDGET = 3 * USECS_PER_MSEC;
@@ -115,6 +115,7 @@ void ProceduralData::parse(const QJsonObject& proceduralData) {
 
 std::function<void(gpu::StatePointer)> Procedural::opaqueStencil = [](gpu::StatePointer state) {};
 std::function<void(gpu::StatePointer)> Procedural::transparentStencil = [](gpu::StatePointer state) {};
+std::function<void(const gpu::ShaderPointer&, std::function<void()>)> Procedural::compileProgram;
 
 Procedural::Procedural() {
     _opaqueState->setCullMode(gpu::State::CULL_NONE);
@@ -229,7 +230,7 @@ void Procedural::setProceduralData(const ProceduralData& proceduralData) {
     _enabled = true;
 }
 
-bool Procedural::isReady() const {
+bool Procedural::isReady() {
 #if defined(USE_GLES)
     return false;
 #endif
@@ -260,6 +261,15 @@ bool Procedural::isReady() const {
         }
     }
 
+    // When programs are compiled in the background, the entity is drawn without the shader until it has compiled
+    if (compileProgram) {
+        updateShaderSources();
+        bool created;
+        if (!getPipeline(_prevKey, created).compiled->load() && _previousPipelines.count(_prevKey) == 0) {
+            return false;
+        }
+    }
+
     if (!_hasStartedFade) {
         _hasStartedFade = true;
         _isFading = true;
@@ -279,6 +289,55 @@ void Procedural::prepare(gpu::Batch& batch,
     _entityPosition = position;
     _entityOrientation = glm::mat3_cast(orientation);
     _entityCreated = created;
+    updateShaderSources();
+
+    bool recompiledShader = false;
+    auto& entry = getPipeline(key, recompiledShader);
+
+    // FIXME: need to handle forward rendering
+    gpu::PipelinePointer pipeline = entry.pipeline;
+    if (entry.compiled->load()) {
+        _previousPipelines.erase(key);
+    } else {
+        // keep drawing with the shader we had while the new one compiles
+        auto previous = _previousPipelines.find(key);
+        if (previous != _previousPipelines.end()) {
+            pipeline = previous->second;
+        }
+    }
+    batch.setPipeline(pipeline);
+
+    bool recreateUniforms = _uniformsDirty || recompiledShader || _prevKey != key;
+    if (recreateUniforms) {
+        setupUniforms();
+    }
+
+    _prevKey = key;
+    _uniformsDirty = false;
+
+    for (auto lambda : _uniforms) {
+        lambda(batch);
+    }
+
+    static gpu::Sampler sampler;
+    static std::once_flag once;
+    std::call_once(once, [&] {
+        sampler = gpu::Sampler(gpu::Sampler::FILTER_MIN_MAG_MIP_LINEAR);
+    });
+
+    for (size_t i = 0; i < MAX_PROCEDURAL_TEXTURE_CHANNELS; ++i) {
+        if (_channels[i] && _channels[i]->isLoaded()) {
+            auto gpuTexture = _channels[i]->getGPUTexture();
+            if (gpuTexture) {
+                gpuTexture->setSampler(sampler);
+                gpuTexture->setAutoGenerateMips(true);
+            }
+            batch.setResourceTexture((gpu::uint32)(procedural::slot::texture::Channel0 + i), gpuTexture);
+        }
+    }
+}
+
+void Procedural::updateShaderSources() {
     if (!_fragmentShaderPath.isEmpty()) {
         auto lastModified = (uint64_t)QFileInfo(_fragmentShaderPath).lastModified().toMSecsSinceEpoch();
         if (lastModified > _fragmentShaderModified) {
@@ -306,119 +365,108 @@ void Procedural::prepare(gpu::Batch& batch,
         _vertexShaderSource = _networkVertexShader->_source;
         _shaderDirty = true;
     }
+}
 
+Procedural::ProceduralPipeline& Procedural::getPipeline(const ProceduralProgramKey& key, bool& created) {
     if (_shaderDirty) {
+        // the compiled pipelines stay around to be drawn with until their replacements have compiled
+        for (const auto& entry : _proceduralPipelines) {
+            if (entry.second.compiled->load()) {
+                _previousPipelines[entry.first] = entry.second.pipeline;
+            }
+        }
         _proceduralPipelines.clear();
+        _shaderDirty = false;
+        _uniformsDirty = true;
     }
 
     auto pipeline = _proceduralPipelines.find(key);
-    bool recompiledShader = false;
-    if (pipeline == _proceduralPipelines.end()) {
-        gpu::Shader::Source vertexSource;
-        if (key.isSkinnedDQ()) {
-            vertexSource = _vertexSourceSkinnedDQ;
-        } else if (key.isSkinned()) {
-            vertexSource = _vertexSourceSkinned;
-        } else {
-            vertexSource = _vertexSource;
-        }
+    if (pipeline != _proceduralPipelines.end()) {
+        created = false;
+        return pipeline->second;
+    }
 
-        gpu::Shader::Source& fragmentSource = (key.isTransparent() && _transparentFragmentSource.valid()) ? _transparentFragmentSource : _opaqueFragmentSource;
+    gpu::Shader::Source vertexSource;
+    if (key.isSkinnedDQ()) {
+        vertexSource = _vertexSourceSkinnedDQ;
+    } else if (key.isSkinned()) {
+        vertexSource = _vertexSourceSkinned;
+    } else {
+        vertexSource = _vertexSource;
+    }
 
-        // Build the fragment and vertex shaders
-        auto versionDefine = "#define PROCEDURAL_V" + std::to_string(_data.version);
-        fragmentSource.replacements.clear();
-        fragmentSource.replacements[PROCEDURAL_VERSION] = versionDefine;
-        if (!_fragmentShaderSource.isEmpty()) {
-            fragmentSource.replacements[PROCEDURAL_BLOCK] = _fragmentShaderSource.toStdString();
-        }
-        vertexSource.replacements.clear();
-        vertexSource.replacements[PROCEDURAL_VERSION] = versionDefine;
-        if (!_vertexShaderSource.isEmpty()) {
-            vertexSource.replacements[PROCEDURAL_BLOCK] = _vertexShaderSource.toStdString();
-        }
+    gpu::Shader::Source fragmentSource = (key.isTransparent() && _transparentFragmentSource.valid()) ? _transparentFragmentSource : _opaqueFragmentSource;
 
-        // Set any userdata specified uniforms (if any)
-        if (!_data.uniforms.empty()) {
-            // First grab all the possible dialect/variant/reflections
-            std::vector<shader::Reflection*> allFragmentReflections;
-            for (auto dialectIt = fragmentSource.dialectSources.begin(); dialectIt != fragmentSource.dialectSources.end(); ++dialectIt) {
-                for (auto variantIt = (*dialectIt).second.variantSources.begin(); variantIt != (*dialectIt).second.variantSources.end(); ++variantIt) {
-                    allFragmentReflections.push_back(&(*variantIt).second.reflection);
-                }
-            }
-            std::vector<shader::Reflection*> allVertexReflections;
-            for (auto dialectIt = vertexSource.dialectSources.begin(); dialectIt != vertexSource.dialectSources.end(); ++dialectIt) {
-                for (auto variantIt = (*dialectIt).second.variantSources.begin(); variantIt != (*dialectIt).second.variantSources.end(); ++variantIt) {
-                    allVertexReflections.push_back(&(*variantIt).second.reflection);
-                }
+    // Build the fragment and vertex shaders
+    auto versionDefine = "#define PROCEDURAL_V" + std::to_string(_data.version);
+    fragmentSource.replacements.clear();
+    fragmentSource.replacements[PROCEDURAL_VERSION] = versionDefine;
+    if (!_fragmentShaderSource.isEmpty()) {
+        fragmentSource.replacements[PROCEDURAL_BLOCK] = _fragmentShaderSource.toStdString();
+    }
+    vertexSource.replacements.clear();
+    vertexSource.replacements[PROCEDURAL_VERSION] = versionDefine;
+    if (!_vertexShaderSource.isEmpty()) {
+        vertexSource.replacements[PROCEDURAL_BLOCK] = _vertexShaderSource.toStdString();
+    }
+
+    // Set any userdata specified uniforms (if any)
+    if (!_data.uniforms.empty()) {
+        // First grab all the possible dialect/variant/reflections
+        std::vector<shader::Reflection*> allFragmentReflections;
+        for (auto dialectIt = fragmentSource.dialectSources.begin(); dialectIt != fragmentSource.dialectSources.end(); ++dialectIt) {
+            for (auto variantIt = (*dialectIt).second.variantSources.begin(); variantIt != (*dialectIt).second.variantSources.end(); ++variantIt) {
+                allFragmentReflections.push_back(&(*variantIt).second.reflection);
             }
-            // Then fill in every reflections the new custom bindings
-            int customSlot = procedural::slot::uniform::Custom;
-            for (const auto& key : _data.uniforms.keys()) {
-                std::string uniformName = key.toLocal8Bit().data();
-                for (auto reflection : allFragmentReflections) {
-                    reflection->uniforms[uniformName] = customSlot;
-                }
-                for (auto reflection : allVertexReflections) {
-                    reflection->uniforms[uniformName] = customSlot;
-                }
-                ++customSlot;
+        }
+        std::vector<shader::Reflection*> allVertexReflections;
+        for (auto dialectIt = vertexSource.dialectSources.begin(); dialectIt != vertexSource.dialectSources.end(); ++dialectIt) {
+            for (auto variantIt = (*dialectIt).second.variantSources.begin(); variantIt != (*dialectIt).second.variantSources.end(); ++variantIt) {
+                allVertexReflections.push_back(&(*variantIt).second.reflection);
             }
         }
-
-        // Leave this here for debugging
-        //qCDebug(proceduralLog) << "FragmentShader:\n" << fragmentSource.getSource(shader::Dialect::glsl450, shader::Variant::Mono).c_str();
-        //qCDebug(proceduralLog) << "VertexShader:\n" << vertexSource.getSource(shader::Dialect::glsl450, shader::Variant::Mono).c_str();
-
-        gpu::ShaderPointer vertexShader = gpu::Shader::createVertex(vertexSource);
-        gpu::ShaderPointer fragmentShader = gpu::Shader::createPixel(fragmentSource);
-        gpu::ShaderPointer program = gpu::Shader::createProgram(vertexShader, fragmentShader);
-
-        _proceduralPipelines[key] = gpu::Pipeline::create(program, key.isTransparent() ? _transparentState : _opaqueState);
-
-        _lastCompile = usecTimestampNow();
-        if (_firstCompile == 0) {
-            _firstCompile = _lastCompile;
+        // Then fill in every reflections the new custom bindings
+        int customSlot = procedural::slot::uniform::Custom;
+        for (const auto& key : _data.uniforms.keys()) {
+            std::string uniformName = key.toLocal8Bit().data();
+            for (auto reflection : allFragmentReflections) {
+                reflection->uniforms[uniformName] = customSlot;
+            }
+            for (auto reflection : allVertexReflections) {
+                reflection->uniforms[uniformName] = customSlot;
+            }
+            ++customSlot;
         }
-        _frameCount = 0;
-        recompiledShader = true;
     }
 
-    // FIXME: need to handle forward rendering
-    batch.setPipeline(recompiledShader ? _proceduralPipelines[key] : pipeline->second);
-
-    bool recreateUniforms = _shaderDirty || _uniformsDirty || recompiledShader || _prevKey != key;
-    if (recreateUniforms) {
-        setupUniforms();
+    // Leave this here for debugging
+    //qCDebug(proceduralLog) << "FragmentShader:\n" << fragmentSource.getSource(shader::Dialect::glsl450, shader::Variant::Mono).c_str();
+    //qCDebug(proceduralLog) << "VertexShader:\n" << vertexSource.getSource(shader::Dialect::glsl450, shader::Variant::Mono).c_str();
+
+    gpu::ShaderPointer vertexShader = gpu::Shader::createVertex(vertexSource);
+    gpu::ShaderPointer fragmentShader = gpu::Shader::createPixel(fragmentSource);
+    gpu::ShaderPointer program = gpu::Shader::createProgram(vertexShader, fragmentShader);
+
+    ProceduralPipeline& entry = _proceduralPipelines[key];
+    entry.pipeline = gpu::Pipeline::create(program, key.isTransparent() ? _transparentState : _opaqueState);
+    entry.compiled = std::make_shared<std::atomic<bool>>(false);
+    if (compileProgram) {
+        auto compiled = entry.compiled;
+        compileProgram(program, [compiled] { compiled->store(true); });
+    } else {
+        // the backend compiles it when it is first drawn
+        entry.compiled->store(true);
     }
 
-    _prevKey = key;
-    _shaderDirty = _uniformsDirty = false;
-
-    for (auto lambda : _uniforms) {
-        lambda(batch);
-    }
-
-    static gpu::Sampler sampler;
-    static std::once_flag once;
-    std::call_once(once, [&] {
-        sampler = gpu::Sampler(gpu::Sampler::FILTER_MIN_MAG_MIP_LINEAR);
-    });
-
-    for (size_t i = 0; i < MAX_PROCEDURAL_TEXTURE_CHANNELS; ++i) {
-        if (_channels[i] && _channels[i]->isLoaded()) {
-            auto gpuTexture = _channels[i]->getGPUTexture();
-            if (gpuTexture) {
-                gpuTexture->setSampler(sampler);
-                gpuTexture->setAutoGenerateMips(true);
-            }
-            batch.setResourceTexture((gpu::uint32)(procedural::slot::texture::Channel0 + i), gpuTexture);
-        }
+    _lastCompile = usecTimestampNow();
+    if (_firstCompile == 0) {
+        _firstCompile = _lastCompile;
     }
+    _frameCount = 0;
+    created = true;
+    return entry;
 }
 
-
 void Procedural::setupUniforms() {
     _uniforms.clear();
     // Set any userdata specified uniforms
@@ -102,7 +102,7 @@ public:
     Procedural();
     void setProceduralData(const ProceduralData& proceduralData);
 
-    bool isReady() const;
+    bool isReady();
     bool isEnabled() const { return _enabled; }
     void prepare(gpu::Batch& batch, const glm::vec3& position, const glm::vec3& size, const glm::quat& orientation,
                  const uint64_t& created, const ProceduralProgramKey key = ProceduralProgramKey());
@@ -129,6 +129,8 @@ public:
 
     static std::function<void(gpu::StatePointer)> opaqueStencil;
     static std::function<void(gpu::StatePointer)> transparentStencil;
+    // When set, new programs are handed to this to be compiled off the draw path, calling back once they are compiled
+    static std::function<void(const gpu::ShaderPointer&, std::function<void()>)> compileProgram;
 
 protected:
     // DO NOT TOUCH
@@ -180,7 +182,13 @@ protected:
     UniformLambdas _uniforms;
     NetworkTexturePointer _channels[MAX_PROCEDURAL_TEXTURE_CHANNELS];
 
-    std::unordered_map<ProceduralProgramKey, gpu::PipelinePointer> _proceduralPipelines;
+    struct ProceduralPipeline {
+        gpu::PipelinePointer pipeline;
+        std::shared_ptr<std::atomic<bool>> compiled;
+    };
+    std::unordered_map<ProceduralProgramKey, ProceduralPipeline> _proceduralPipelines;
+    // The pipelines of the previous shader source, drawn with until the ones for the new source have compiled
+    std::unordered_map<ProceduralProgramKey, gpu::PipelinePointer> _previousPipelines;
 
     StandardInputs _standardInputs;
     gpu::BufferPointer _standardInputsBuffer;
@@ -192,6 +200,8 @@ protected:
     uint64_t _entityCreated;
 
 private:
+    void updateShaderSources();
+    ProceduralPipeline& getPipeline(const ProceduralProgramKey& key, bool& created);
     void setupUniforms();
 
     mutable uint64_t _fadeStartTime { 0 };
@@ -239,7 +249,7 @@ public:
 
 private:
     QString _proceduralString;
-    Procedural _procedural;
+    mutable Procedural _procedural;
 };
 typedef std::shared_ptr<ProceduralMaterial> ProceduralMaterialPointer;
 
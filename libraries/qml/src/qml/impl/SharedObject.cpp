@@ -8,6 +8,8 @@
 
 #include "SharedObject.h"
 
+#include <algorithm>
+
 #include <QtCore/qlogging.h>
 #include <QtQuick/QQuickWindow>
 #include <QtQuick/QQuickItem>
@@ -35,6 +37,8 @@
 // the render.  Could possibly be increased depending on the framerate we expect to
 // achieve.
 // This has the effect of capping the framerate at 200
+// The timer only runs while a render is pending, so a surface whose content isn't changing, or that is paused, costs
+// nothing between frames.
 static const int MIN_TIMER_MS = 5;
 
 using namespace hifi::qml;
@@ -344,8 +348,13 @@ void SharedObject::setSize(const QSize& size) {
 }
 
 void SharedObject::setMaxFps(uint8_t maxFps) {
-    QMutexLocker locker(&_mutex);
-    _maxFps = maxFps;
+    {
+        QMutexLocker locker(&_mutex);
+        _maxFps = maxFps;
+    }
+    if (_renderRequested) {
+        startRenderTimer();
+    }
 }
 
 bool SharedObject::preRender(bool sceneGraphSync) {
@@ -398,6 +407,7 @@ void SharedObject::requestRender() {
         return;
     }
     _renderRequested = true;
+    startRenderTimer();
 }
 
 void SharedObject::requestRenderSync() {
@@ -406,6 +416,19 @@ void SharedObject::requestRenderSync() {
     }
     _renderRequested = true;
     _syncRequested = true;
+    startRenderTimer();
+}
+
+void SharedObject::startRenderTimer() {
+#ifndef DISABLE_QML
+    if (QThread::currentThread() != thread()) {
+        QMetaObject::invokeMethod(this, [this] { startRenderTimer(); }, Qt::QueuedConnection);
+        return;
+    }
+    if (_renderTimer && !_quit && !_paused && !_renderTimer->isActive()) {
+        _renderTimer->start(MIN_TIMER_MS);
+    }
+#endif
 }
 
 bool SharedObject::fetchTexture(TextureAndFence& textureAndFence) {
@@ -446,15 +469,14 @@ void SharedObject::onInitialize() {
     // Set up the render thread
     QCoreApplication::postEvent(_renderObject, new OffscreenEvent(OffscreenEvent::Initialize));
 
-    requestRender();
-
-    // Set up timer to trigger renders
+    // Set up timer to trigger renders, it is started by render requests
     _renderTimer = new QTimer(this);
     QObject::connect(_renderTimer, &QTimer::timeout, this, &SharedObject::onTimer);
 
     _renderTimer->setTimerType(Qt::PreciseTimer);
     _renderTimer->setInterval(MIN_TIMER_MS);  // 5ms, Qt::PreciseTimer required
-    _renderTimer->start();
+
+    requestRender();
 #endif
 }
 
@@ -481,7 +503,10 @@ void SharedObject::onRender() {
 
 void SharedObject::onTimer() {
     getTextureCache().report();
-    if (!_renderRequested) {
+#ifndef DISABLE_QML
+    // the pending request is kept while paused, so that resuming renders it
+    if (!_renderRequested || _paused) {
+        _renderTimer->stop();
         return;
     }
 
@@ -493,17 +518,19 @@ void SharedObject::onTimer() {
         }
 
         if (!_maxFps) {
+            _renderTimer->stop();
             return;
         }
         auto minRenderInterval = USECS_PER_SECOND / _maxFps;
         auto lastInterval = usecTimestampNow() - _lastRenderTime;
-        // Don't exceed the framerate limit
+        // Don't exceed the framerate limit, waking up again once it allows a frame
         if (lastInterval < minRenderInterval) {
+            _renderTimer->setInterval(std::max(MIN_TIMER_MS, (int)((minRenderInterval - lastInterval) / USECS_PER_MSEC)));
             return;
         }
     }
 
-#ifndef DISABLE_QML
+    _renderTimer->setInterval(MIN_TIMER_MS);
     QCoreApplication::postEvent(this, new OffscreenEvent(OffscreenEvent::Render));
 #endif
 }
@@ -80,6 +80,7 @@ private:
 
     void requestRender();
     void requestRenderSync();
+    void startRenderTimer();
     void wait();
     void wake();
     void onInitialize();
@@ -11,6 +11,8 @@
 
 using namespace hifi::qml::impl;
 
+const size_t TextureCache::MAX_IDLE_TEXTURE_MEMORY = 32 * 1024 * 1024;
+
 uint64_t uvec2ToUint64(const QSize& size) {
     uint64_t result = size.width();
     result <<= 32;
@@ -18,6 +20,10 @@ uint64_t uvec2ToUint64(const QSize& size) {
     return result;
 }
 
+static QSize uint64ToSize(uint64_t sizeKey) {
+    return QSize((int)(sizeKey >> 32), (int)(sizeKey & 0xFFFFFFFF));
+}
+
 void TextureCache::acquireSize(const QSize& size) {
     auto sizeKey = uvec2ToUint64(size);
     Lock lock(_mutex);
@@ -32,10 +38,7 @@ void TextureCache::releaseSize(const QSize& size) {
         assert(_textures.count(sizeKey));
         auto& textureSet = _textures[sizeKey];
         if (0 == --textureSet.clientCount) {
-            for (const auto& textureAndFence : textureSet.returnedTextures) {
-                destroy(textureAndFence);
-            }
-            _textures.erase(sizeKey);
+            trimIdle();
         }
     }
 }
@@ -141,12 +144,43 @@ void TextureCache::recycle() {
         GLuint texture = textureAndFence.first;
         QSize size = _textureSizes[texture];
         auto sizeKey = uvec2ToUint64(size);
-        // Textures can be returned after all surfaces of the given size have been destroyed,
-        // in which case we just destroy the texture
+        // Textures can be returned after all surfaces of the given size have been destroyed and the idle textures
+        // of that size trimmed, in which case we just destroy the texture
         if (!_textures.count(sizeKey)) {
             destroy(textureAndFence);
             continue;
         }
         _textures[sizeKey].returnedTextures.push_back(textureAndFence);
     }
+    if (!returnedTextures.empty()) {
+        trimIdle();
+    }
+}
+
+void TextureCache::trimIdle() {
+    size_t idleMemory = 0;
+    for (const auto& entry : _textures) {
+        if (entry.second.clientCount == 0) {
+            idleMemory += getMemoryForSize(uint64ToSize(entry.first)) * entry.second.returnedTextures.size();
+        }
+    }
+
+    for (auto itr = _textures.begin(); itr != _textures.end();) {
+        auto& textureSet = itr->second;
+        if (textureSet.clientCount != 0) {
+            ++itr;
+            continue;
+        }
+        size_t textureMemory = getMemoryForSize(uint64ToSize(itr->first));
+        while (idleMemory > MAX_IDLE_TEXTURE_MEMORY && !textureSet.returnedTextures.empty()) {
+            destroy(textureSet.returnedTextures.front());
+            textureSet.returnedTextures.pop_front();
+            idleMemory -= textureMemory;
+        }
+        if (textureSet.returnedTextures.empty()) {
+            itr = _textures.erase(itr);
+        } else {
+            ++itr;
+        }
+    }
 }
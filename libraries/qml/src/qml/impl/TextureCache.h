@@ -34,8 +34,12 @@ public:
     using ValueList = std::list<Value>;
     using Size = uint64_t;
 
+    // Textures of a size no surface uses any more are kept, up to this much memory, for the next surface of that size
+    // (a tablet or web entity being reopened) rather than deleted and created again
+    static const size_t MAX_IDLE_TEXTURE_MEMORY;
+
     struct TextureSet {
-        // The number of surfaces with this size
+        // The number of surfaces with this size, the set is idle while there are none
         size_t clientCount { 0 };
         ValueList returnedTextures;
     };
@@ -56,6 +60,7 @@ private:
 
     void destroy(const Value& textureAndFence);
     void recycle();
+    void trimIdle();
 
     using Mutex = std::mutex;
     using Lock = std::unique_lock<Mutex>;
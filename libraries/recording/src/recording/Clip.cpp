@@ -92,6 +92,12 @@ bool writeFrame(QIODevice& output, const Frame& frame, bool compressed = true) {
 
 const QString Clip::FRAME_TYPE_MAP = QStringLiteral("frameTypes");
 const QString Clip::FRAME_COMREPSSION_FLAG = QStringLiteral("compressed");
+const QString Clip::FRAME_KEY_FRAME_INTERVAL = QStringLiteral("keyFrameInterval");
+
+// Consecutive frames of a type mostly hold the same bytes, an avatar's JSON keeps its layout from one frame to the next, so
+// all but every KEY_FRAME_INTERVAL'th frame of a type are written xor'ed with the previous one, which compresses far better.
+// The interval bounds how many frames have to be decoded to seek.
+static const int KEY_FRAME_INTERVAL = 64;
 
 bool Clip::write(QIODevice& output) {
     auto frameTypes = Frame::getFrameTypes();
@@ -104,6 +110,7 @@ bool Clip::write(QIODevice& output) {
     rootObject.insert(FRAME_TYPE_MAP, frameTypeObj);
     // Always mark new files as compressed
     rootObject.insert(FRAME_COMREPSSION_FLAG, true);
+    rootObject.insert(FRAME_KEY_FRAME_INTERVAL, KEY_FRAME_INTERVAL);
     QByteArray headerFrameData = QJsonDocument(rootObject).toBinaryData();
     // Never compress the header frame
     if (!writeFrame(output, Frame({ Frame::TYPE_HEADER, 0, headerFrameData }), false)) {
@@ -112,10 +119,27 @@ bool Clip::write(QIODevice& output) {
 
     seek(0);
 
+    QMap<FrameType, int> typeIndices;
+    QMap<FrameType, QByteArray> previousData;
     for (auto frame = nextFrame(); frame; frame = nextFrame()) {
-        if (!writeFrame(output, *frame)) {
-            return false;
+        if (frame->type == Frame::TYPE_INVALID) {
+            qWarning() << "Attempting to write invalid frame";
+            continue;
+        }
+        int& typeIndex = typeIndices[frame->type];
+        QByteArray& previous = previousData[frame->type];
+        if ((typeIndex++ % KEY_FRAME_INTERVAL) == 0) {
+            if (!writeFrame(output, *frame)) {
+                return false;
+            }
+        } else {
+            Frame delta = *frame;
+            delta.data = Frame::xorData(frame->data, previous);
+            if (!writeFrame(output, delta)) {
+                return false;
+            }
         }
+        previous = frame->data;
     }
     return true;
 }
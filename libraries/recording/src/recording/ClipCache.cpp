@@ -26,11 +26,25 @@ NetworkClipLoader::NetworkClipLoader(const QUrl& url) :
     }
 }
 
+NetworkClip::NetworkClip(const NetworkClip& other) :
+    _clipData(other._clipData),
+    _url(other._url) {
+    // the data is never written, so the copy shares it rather than detaching
+    initFrom(other, (uchar*)_clipData.constData());
+}
+
 void NetworkClip::init(const QByteArray& clipData) {
     _clipData = clipData;
     PointerClip::init((uchar*)_clipData.data(), _clipData.size());
 }
 
+ClipPointer NetworkClipLoader::getClip() {
+    if (!isLoaded()) {
+        return _clip;
+    }
+    return std::make_shared<NetworkClip>(*_clip);
+}
+
 void NetworkClipLoader::downloadFinished(const QByteArray& data) {
     _clip->init(data);
     finishedLoading(true);
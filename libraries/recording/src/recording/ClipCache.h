@@ -23,6 +23,8 @@ public:
     using Pointer = std::shared_ptr<NetworkClip>;
 
     NetworkClip(const QUrl& url) : _url(url) {}
+    // a clip with a position of its own, over the same downloaded data and parsed frames
+    NetworkClip(const NetworkClip& other);
     virtual void init(const QByteArray& clipData);
     virtual QString getName() const override { return _url.toString(); }
 
@@ -38,7 +40,8 @@ public:
     NetworkClipLoader(const NetworkClipLoader& other) : Resource(other), _clip(other._clip) {}
 
     virtual void downloadFinished(const QByteArray& data) override;
-    ClipPointer getClip() { return _clip; }
+    // every caller gets a clip of its own once loaded, so several decks can play the same recording at different times
+    ClipPointer getClip();
     bool completed() { return _failedToLoad || isLoaded(); }
 
 signals:
@@ -8,6 +8,7 @@
 
 #include "Frame.h"
 
+#include <algorithm>
 #include <mutex>
 
 #include <QtCore/QMap>
@@ -162,3 +163,14 @@ void Frame::handleFrame(const Frame::ConstPointer& frame) {
     }
     handler(frame);
 }
+
+QByteArray Frame::xorData(const QByteArray& data, const QByteArray& reference) {
+    QByteArray result = data;
+    char* resultData = result.data();
+    const char* referenceData = reference.constData();
+    int size = std::min(result.size(), reference.size());
+    for (int i = 0; i < size; ++i) {
+        resultData[i] ^= referenceData[i];
+    }
+    return result;
+}
@@ -73,6 +73,9 @@ public:
     static QMap<QString, FrameType> getFrameTypes();
     static QMap<FrameType, QString> getFrameTypeNames();
     static void handleFrame(const ConstPointer& frame);
+
+    // data xor'ed with the start of reference, xor'ing the result with the same reference gives data back
+    static QByteArray xorData(const QByteArray& data, const QByteArray& reference);
 };
 
 }
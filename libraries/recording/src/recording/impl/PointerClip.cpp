@@ -79,6 +79,8 @@ void PointerClip::reset() {
     _data = nullptr;
     _size = 0;
     _header = QJsonDocument();
+    _keyFrameInterval = 0;
+    _lastDecodedFrames.clear();
 }
 
 void PointerClip::init(uchar* data, size_t size) {
@@ -112,6 +114,7 @@ void PointerClip::init(uchar* data, size_t size) {
     // Check for compression
     {
         _compressed = _header.object()[FRAME_COMREPSSION_FLAG].toBool();
+        _keyFrameInterval = std::max(_header.object()[FRAME_KEY_FRAME_INTERVAL].toInt(), 0);
     }
 
     // Find the type enum translation map and fix up the frame headers
@@ -125,17 +128,33 @@ void PointerClip::init(uchar* data, size_t size) {
 
         // Update the loaded headers with the frame data
         _frames.reserve(parsedFrameHeaders.size());
+        QMap<FrameType, int> typeCounts;
+        QMap<FrameType, int> lastOfType;
         for (auto& frameHeader : parsedFrameHeaders) {
             if (!translationMap.contains(frameHeader.type)) {
                 continue;
             }
             frameHeader.type = translationMap[frameHeader.type];
+            frameHeader.typeIndex = typeCounts[frameHeader.type]++;
+            frameHeader.previousOfType = lastOfType.value(frameHeader.type, -1);
+            lastOfType[frameHeader.type] = (int)_frames.size();
             _frames.push_back(frameHeader);
         }
     }
 
 }
 
+void PointerClip::initFrom(const PointerClip& other, uchar* data) {
+    Locker lock(other._mutex);
+    reset();
+    _data = data;
+    _size = other._size;
+    _header = other._header;
+    _compressed = other._compressed;
+    _keyFrameInterval = other._keyFrameInterval;
+    _frames = other._frames;
+}
+
 // Internal only function, needs no locking
 FrameConstPointer PointerClip::readFrame(size_t frameIndex) const {
     FramePointer result;
@@ -144,16 +163,35 @@ FrameConstPointer PointerClip::readFrame(size_t frameIndex) const {
         const auto& header = _frames[frameIndex];
         result->type = header.type;
         result->timeOffset = header.timeOffset;
-        if (header.size) {
-            result->data.insert(0, reinterpret_cast<char*>(_data)+header.fileOffset, header.size);
-            if (_compressed) {
-                result->data = qUncompress(result->data);
-            }
-        }
+        result->data = readFrameData(frameIndex);
     }
     return result;
 }
 
+QByteArray PointerClip::readFrameData(size_t frameIndex) const {
+    const auto& header = _frames[frameIndex];
+    QByteArray data;
+    if (header.size) {
+        data.insert(0, reinterpret_cast<char*>(_data) + header.fileOffset, header.size);
+        if (_compressed) {
+            data = qUncompress(data);
+        }
+    }
+
+    if (_keyFrameInterval > 0 && header.previousOfType >= 0 && (header.typeIndex % _keyFrameInterval) != 0) {
+        // a delta from the previous frame of its type, which is the last one decoded unless the clip was seeked
+        auto decodedItr = _lastDecodedFrames.find(header.type);
+        if (decodedItr != _lastDecodedFrames.end() && decodedItr->index == (size_t)header.previousOfType) {
+            data = Frame::xorData(data, decodedItr->data);
+        } else {
+            data = Frame::xorData(data, readFrameData(header.previousOfType));
+        }
+    }
+
+    _lastDecodedFrames[header.type] = { frameIndex, data };
+    return data;
+}
+
 void PointerClip::addFrame(FrameConstPointer) {
     throw std::runtime_error("Pointer clips are read only, use duplicate to create a read/write clip");
 }
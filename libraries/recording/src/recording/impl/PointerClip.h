@@ -25,6 +25,8 @@ struct PointerFrameHeader : public FrameHeader {
     Frame::Time timeOffset;
     uint16_t size;
     quint64 fileOffset;
+    int typeIndex; // among the frames of its type
+    int previousOfType; // -1 for the first frame of its type
 };
 
 using PointerFrameHeaderList = std::list<PointerFrameHeader>;
@@ -46,11 +48,23 @@ public:
     static const qint64 MINIMUM_FRAME_SIZE = sizeof(FrameType) + sizeof(Frame::Time) + sizeof(FrameSize);
 protected:
     void reset() override;
+    // the same frames as other, whose data has to be at data for as long as this clip is used
+    void initFrom(const PointerClip& other, uchar* data);
     virtual FrameConstPointer readFrame(size_t index) const override;
+    QByteArray readFrameData(size_t index) const;
     QJsonDocument _header;
     uchar* _data { nullptr };
     size_t _size { 0 };
     bool _compressed { true };
+    int _keyFrameInterval { 0 }; // 0 when no frame is stored as a delta
+
+    // the last frame of each type read, that the next one of that type is decoded from when playing
+    class DecodedFrame {
+    public:
+        size_t index;
+        QByteArray data;
+    };
+    mutable QMap<FrameType, DecodedFrame> _lastDecodedFrames;
 };
 
 }
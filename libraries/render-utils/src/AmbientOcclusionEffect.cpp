@@ -36,6 +36,12 @@ gpu::PipelinePointer AmbientOcclusionEffect::_bilateralBlurPipeline;
 gpu::PipelinePointer AmbientOcclusionEffect::_mipCreationPipeline;
 gpu::PipelinePointer AmbientOcclusionEffect::_gatherPipeline;
 gpu::PipelinePointer AmbientOcclusionEffect::_buildNormalsPipeline;
+gpu::PipelinePointer AmbientOcclusionEffect::_temporalPipeline;
+
+// with the temporal mode, each frame takes this many times fewer samples and the accumulation makes up the rest
+static const int TEMPORAL_SAMPLE_DIVISOR = 4;
+// the relative change in depth past which a pixel is taken to show another surface than last frame
+static const float TEMPORAL_DEPTH_REJECTION_THRESHOLD = 0.05f;
 
 AmbientOcclusionFramebuffer::AmbientOcclusionFramebuffer() {
 }
@@ -75,6 +81,10 @@ void AmbientOcclusionFramebuffer::clear() {
     _occlusionBlurredTexture.reset();
     _normalFramebuffer.reset();
     _normalTexture.reset();
+    for (int i = 0; i < 2; i++) {
+        _occlusionHistoryFramebuffers[i].reset();
+        _occlusionHistoryTextures[i].reset();
+    }
 }
 
 gpu::TexturePointer AmbientOcclusionFramebuffer::getLinearDepthTexture() {
@@ -101,6 +111,14 @@ void AmbientOcclusionFramebuffer::allocate() {
         _occlusionBlurredTexture = gpu::Texture::createRenderBuffer(occlusionformat, width, height, gpu::Texture::SINGLE_MIP, sampler);
         _occlusionBlurredFramebuffer = gpu::FramebufferPointer(gpu::Framebuffer::create("occlusionBlurred"));
         _occlusionBlurredFramebuffer->setRenderBuffer(0, _occlusionBlurredTexture);
+
+        // The history is accumulated in half floats, as 8 bits would lose the small steps of a slow blend
+        auto historyFormat = gpu::Element{ gpu::VEC4, gpu::HALF, gpu::RGBA };
+        for (int i = 0; i < 2; i++) {
+            _occlusionHistoryTextures[i] = gpu::Texture::createRenderBuffer(historyFormat, width, height, gpu::Texture::SINGLE_MIP, sampler);
+            _occlusionHistoryFramebuffers[i] = gpu::FramebufferPointer(gpu::Framebuffer::create("occlusionHistory"));
+            _occlusionHistoryFramebuffers[i]->setRenderBuffer(0, _occlusionHistoryTextures[i]);
+        }
     }
 
     // Lower res frame
@@ -204,6 +222,22 @@ gpu::TexturePointer AmbientOcclusionFramebuffer::getNormalTexture() {
     return _normalTexture;
 }
 
+gpu::FramebufferPointer AmbientOcclusionFramebuffer::getOcclusionHistoryFramebuffer(int index) {
+    assert(index < 2);
+    if (!_occlusionHistoryFramebuffers[index]) {
+        allocate();
+    }
+    return _occlusionHistoryFramebuffers[index];
+}
+
+gpu::TexturePointer AmbientOcclusionFramebuffer::getOcclusionHistoryTexture(int index) {
+    assert(index < 2);
+    if (!_occlusionHistoryTextures[index]) {
+        allocate();
+    }
+    return _occlusionHistoryTextures[index];
+}
+
 AmbientOcclusionEffectConfig::AmbientOcclusionEffectConfig() :
     render::GPUJobConfig::Persistent(QStringList() << "Render" << "Engine" << "Ambient Occlusion"),
     perspectiveScale{ 1.0f },
@@ -226,7 +260,9 @@ AmbientOcclusionEffectConfig::AmbientOcclusionEffectConfig() :
     ditheringEnabled{ true },
     borderingEnabled{ true },
     fetchMipsEnabled{ true },
-    jitterEnabled{ false }{
+    jitterEnabled{ false },
+    temporalEnabled{ false },
+    temporalFeedback{ 0.9f }{
 }
 
 void AmbientOcclusionEffectConfig::setSSAORadius(float newRadius) {
@@ -287,6 +323,12 @@ void AmbientOcclusionEffectConfig::setBlurRadius(int radius) {
     emit dirty(); 
 }
 
+void AmbientOcclusionEffectConfig::setTemporalFeedback(float feedback) {
+    const float MAX_TEMPORAL_FEEDBACK = 0.98f;
+    temporalFeedback = std::max(0.0f, std::min(MAX_TEMPORAL_FEEDBACK, feedback));
+    emit dirty();
+}
+
 AmbientOcclusionEffect::AOParameters::AOParameters() {
     _resolutionInfo = glm::vec4{ 0.0f };
     _radiusInfo = glm::vec4{ 0.0f };
@@ -306,7 +348,14 @@ void AmbientOcclusionEffect::configure(const Config& config) {
     bool shouldUpdateBlurs = false;
     bool shouldUpdateTechnique = false;
 
-    _isJitterEnabled = config.jitterEnabled;
+    // The accumulation only converges if the samples turn from one frame to the next
+    _isJitterEnabled = config.jitterEnabled || config.temporalEnabled;
+    if (config.temporalEnabled != _isTemporalEnabled) {
+        _isTemporalEnabled = config.temporalEnabled;
+        _isHistoryValid = false;
+    }
+    _temporalFeedback = config.temporalFeedback;
+    const int sampleDivisor = config.temporalEnabled ? TEMPORAL_SAMPLE_DIVISOR : 1;
 
     if (!_framebuffer) {
         _framebuffer = std::make_shared<AmbientOcclusionFramebuffer>();
@@ -392,10 +441,11 @@ void AmbientOcclusionEffect::configure(const Config& config) {
             current.w = 1.0f / current.z;
         }
 
-        if (shouldUpdateTechnique || config.hbaoNumSamples != _aoParametersBuffer->getNumSamples()) {
+        const int numSamples = std::max(1, config.hbaoNumSamples / sampleDivisor);
+        if (shouldUpdateTechnique || numSamples != _aoParametersBuffer->getNumSamples()) {
             auto& current = _aoParametersBuffer.edit()._sampleInfo;
-            current.x = config.hbaoNumSamples;
-            current.y = 1.0f / config.hbaoNumSamples;
+            current.x = numSamples;
+            current.y = 1.0f / numSamples;
             updateRandomSamples();
             updateJitterSamples();
         }
@@ -425,10 +475,11 @@ void AmbientOcclusionEffect::configure(const Config& config) {
             current.z = config.ssaoNumSpiralTurns;
         }
 
-        if (shouldUpdateTechnique || config.ssaoNumSamples != _aoParametersBuffer->getNumSamples()) {
+        const int numSamples = std::max(1, config.ssaoNumSamples / sampleDivisor);
+        if (shouldUpdateTechnique || numSamples != _aoParametersBuffer->getNumSamples()) {
             auto& current = _aoParametersBuffer.edit()._sampleInfo;
-            current.x = config.ssaoNumSamples;
-            current.y = 1.0f / config.ssaoNumSamples;
+            current.x = numSamples;
+            current.y = 1.0f / numSamples;
             updateRandomSamples();
             updateJitterSamples();
         }
@@ -577,6 +628,19 @@ const gpu::PipelinePointer& AmbientOcclusionEffect::getBuildNormalsPipeline() {
     return _buildNormalsPipeline;
 }
 
+const gpu::PipelinePointer& AmbientOcclusionEffect::getTemporalPipeline() {
+    if (!_temporalPipeline) {
+        gpu::ShaderPointer program = gpu::Shader::createProgram(shader::render_utils::program::ssao_temporal);
+        gpu::StatePointer state = std::make_shared<gpu::State>();
+
+        state->setColorWriteMask(true, true, true, true);
+
+        // Good to go add the brand new pipeline
+        _temporalPipeline = gpu::Pipeline::create(program, state);
+    }
+    return _temporalPipeline;
+}
+
 int AmbientOcclusionEffect::getDepthResolutionLevel() const {
     return std::min(1, _aoParametersBuffer->getResolutionLevel());
 }
@@ -608,6 +672,7 @@ void AmbientOcclusionEffect::run(const render::RenderContextPointer& renderConte
 
     const auto& frameTransform = input.get1();
     const auto& linearDepthFramebuffer = input.get3();
+    const auto& velocityFramebuffer = input.get4();
     
     const int resolutionLevel = _aoParametersBuffer->getResolutionLevel();
     const auto depthResolutionLevel = getDepthResolutionLevel();
@@ -635,6 +700,24 @@ void AmbientOcclusionEffect::run(const render::RenderContextPointer& renderConte
     if (_framebuffer->update(fullResDepthTexture, resolutionLevel, depthResolutionLevel, args->isStereo())) {
         updateBlurParameters();
         updateFramebufferSizes();
+        _isHistoryValid = false;
+    }
+
+    // The velocity buffer holds the motion of the camera within the frame, which doesn't fit the two eyes of a stereo frame
+    const bool isTemporal = _isTemporalEnabled && velocityFramebuffer && !args->isStereo();
+    gpu::FramebufferPointer occlusionHistoryFBO;
+    gpu::TexturePointer previousHistoryTexture;
+    gpu::TexturePointer velocityTexture;
+    if (isTemporal) {
+        occlusionHistoryFBO = _framebuffer->getOcclusionHistoryFramebuffer(_historyIndex);
+        previousHistoryTexture = _framebuffer->getOcclusionHistoryTexture(1 - _historyIndex);
+        velocityTexture = velocityFramebuffer->getVelocityTexture();
+
+        auto& temporal = _temporalParametersBuffer.edit()._temporalInfo;
+        temporal.x = _isHistoryValid ? _temporalFeedback : 0.0f;
+        temporal.y = TEMPORAL_DEPTH_REJECTION_THRESHOLD;
+        temporal.z = occlusionViewport.z / float(sourceViewport.z);
+        temporal.w = occlusionViewport.w / float(sourceViewport.w);
     }
     
     auto occlusionFBO = _framebuffer->getOcclusionFramebuffer();
@@ -646,6 +729,7 @@ void AmbientOcclusionEffect::run(const render::RenderContextPointer& renderConte
     auto occlusionPipeline = getOcclusionPipeline();
     auto bilateralBlurPipeline = getBilateralBlurPipeline();
     auto mipCreationPipeline = getMipCreationPipeline();
+    auto temporalPipeline = getTemporalPipeline();
 #if SSAO_USE_QUAD_SPLIT
     auto gatherPipeline = getGatherPipeline();
     auto buildNormalsPipeline = getBuildNormalsPipeline();
@@ -771,6 +855,34 @@ void AmbientOcclusionEffect::run(const render::RenderContextPointer& renderConte
         }
 #endif
 
+        // Blend this frame's occlusion into what was seen at the same spot on the previous frames
+        auto blurSourceTexture = occlusionFBO->getRenderBuffer(0);
+        if (isTemporal) {
+            batch.pushProfileRange("Temporal");
+            {
+                const auto uvScale = glm::vec3(
+                    occlusionViewport.z / float(sourceViewport.z),
+                    occlusionViewport.w / float(sourceViewport.w),
+                    1.0f);
+                Transform model;
+                model.setScale(uvScale);
+                batch.setModelTransform(model);
+            }
+            batch.setViewportTransform(occlusionViewport);
+            batch.setFramebuffer(occlusionHistoryFBO);
+            batch.setPipeline(temporalPipeline);
+            batch.setUniformBuffer(render_utils::slot::buffer::SsaoTemporalParams, _temporalParametersBuffer);
+            batch.setResourceTexture(render_utils::slot::texture::SsaoOcclusion, occlusionFBO->getRenderBuffer(0));
+            batch.setResourceTexture(render_utils::slot::texture::SsaoHistory, previousHistoryTexture);
+            batch.setResourceTexture(render_utils::slot::texture::SsaoVelocity, velocityTexture);
+            batch.draw(gpu::TRIANGLE_STRIP, 4);
+            batch.setResourceTexture(render_utils::slot::texture::SsaoHistory, nullptr);
+            batch.setResourceTexture(render_utils::slot::texture::SsaoVelocity, nullptr);
+            batch.popProfileRange();
+
+            blurSourceTexture = occlusionHistoryFBO->getRenderBuffer(0);
+        }
+
         {
             PROFILE_RANGE_BATCH(batch, "Bilateral Blur");
             // Blur 1st pass
@@ -795,7 +907,7 @@ void AmbientOcclusionEffect::run(const render::RenderContextPointer& renderConte
             batch.setViewportTransform(firstBlurViewport);
             batch.setFramebuffer(occlusionBlurredFBO);
             batch.setUniformBuffer(render_utils::slot::buffer::SsaoBlurParams, _hblurParametersBuffer);
-            batch.setResourceTexture(render_utils::slot::texture::SsaoOcclusion, occlusionFBO->getRenderBuffer(0));
+            batch.setResourceTexture(render_utils::slot::texture::SsaoOcclusion, blurSourceTexture);
             batch.draw(gpu::TRIANGLE_STRIP, 4);
             batch.popProfileRange();
 
@@ -826,6 +938,13 @@ void AmbientOcclusionEffect::run(const render::RenderContextPointer& renderConte
         _gpuTimer->end(batch);
     });
 
+    if (isTemporal) {
+        _historyIndex = 1 - _historyIndex;
+        _isHistoryValid = true;
+    } else {
+        _isHistoryValid = false;
+    }
+
     // Update the timer
     auto config = std::static_pointer_cast<Config>(renderContext->jobConfig);
     config->setGPUBatchRunTime(_gpuTimer->getGPUAverage(), _gpuTimer->getBatchAverage());
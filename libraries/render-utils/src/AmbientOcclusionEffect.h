@@ -21,6 +21,7 @@
 #include "DeferredFrameTransform.h"
 #include "DeferredFramebuffer.h"
 #include "SurfaceGeometryPass.h"
+#include "VelocityBufferPass.h"
 
 #include "ssao_shared.h"
 
@@ -37,6 +38,10 @@ public:
     gpu::FramebufferPointer getNormalFramebuffer();
     gpu::TexturePointer getNormalTexture();
 
+    // The occlusion accumulated over frames, one being written while the other holds the previous frame's
+    gpu::FramebufferPointer getOcclusionHistoryFramebuffer(int index);
+    gpu::TexturePointer getOcclusionHistoryTexture(int index);
+
 #if SSAO_USE_QUAD_SPLIT
     gpu::FramebufferPointer getOcclusionSplitFramebuffer(int index);
     gpu::TexturePointer getOcclusionSplitTexture();
@@ -64,6 +69,9 @@ protected:
     gpu::FramebufferPointer _normalFramebuffer;
     gpu::TexturePointer _normalTexture;
 
+    gpu::FramebufferPointer _occlusionHistoryFramebuffers[2];
+    gpu::TexturePointer _occlusionHistoryTextures[2];
+
 #if SSAO_USE_QUAD_SPLIT
     gpu::FramebufferPointer _occlusionSplitFramebuffers[SSAO_SPLIT_COUNT*SSAO_SPLIT_COUNT];
     gpu::TexturePointer _occlusionSplitTexture;
@@ -84,6 +92,8 @@ class AmbientOcclusionEffectConfig : public render::GPUJobConfig::Persistent {
     Q_PROPERTY(bool borderingEnabled MEMBER borderingEnabled NOTIFY dirty)
     Q_PROPERTY(bool fetchMipsEnabled MEMBER fetchMipsEnabled NOTIFY dirty)
     Q_PROPERTY(bool jitterEnabled MEMBER jitterEnabled NOTIFY dirty)
+    Q_PROPERTY(bool temporalEnabled MEMBER temporalEnabled NOTIFY dirty)
+    Q_PROPERTY(float temporalFeedback MEMBER temporalFeedback WRITE setTemporalFeedback)
 
     Q_PROPERTY(int resolutionLevel MEMBER resolutionLevel WRITE setResolutionLevel)
     Q_PROPERTY(float edgeSharpness MEMBER edgeSharpness WRITE setEdgeSharpness)
@@ -111,6 +121,7 @@ public:
     void setEdgeSharpness(float sharpness);
     void setResolutionLevel(int level);
     void setBlurRadius(int radius);
+    void setTemporalFeedback(float feedback);
 
     void setSSAORadius(float newRadius);
     void setSSAOObscuranceLevel(float level);
@@ -144,6 +155,8 @@ public:
     bool borderingEnabled; // avoid evaluating information from non existing pixels out of the frame, should always be true
     bool fetchMipsEnabled; // fetch taps in sub mips to otpimize cache, should always be true
     bool jitterEnabled; // Add small jittering to AO samples at each frame
+    bool temporalEnabled; // accumulate the occlusion over frames, taking a quarter of the samples in each
+    float temporalFeedback; // how much of the accumulated occlusion is kept on each frame
 
 signals:
     void dirty();
@@ -153,7 +166,7 @@ signals:
 
 class AmbientOcclusionEffect {
 public:
-    using Input = render::VaryingSet4<LightingModelPointer, DeferredFrameTransformPointer, DeferredFramebufferPointer, LinearDepthFramebufferPointer>;
+    using Input = render::VaryingSet5<LightingModelPointer, DeferredFrameTransformPointer, DeferredFramebufferPointer, LinearDepthFramebufferPointer, VelocityFramebufferPointer>;
     using Output = render::VaryingSet2<AmbientOcclusionFramebufferPointer, gpu::BufferView>;
     using Config = AmbientOcclusionEffectConfig;
     using JobModel = render::Job::ModelIO<AmbientOcclusionEffect, Input, Output, Config>;
@@ -201,6 +214,7 @@ private:
     using BlurParametersBuffer = gpu::StructBuffer<BlurParameters>;
 
     using FrameParametersBuffer = gpu::StructBuffer< AmbientOcclusionFrameParams>;
+    using TemporalParametersBuffer = gpu::StructBuffer<AmbientOcclusionTemporalParams>;
 
     void updateBlurParameters();
     void updateFramebufferSizes();
@@ -213,6 +227,7 @@ private:
     FrameParametersBuffer _aoFrameParametersBuffer[SSAO_SPLIT_COUNT*SSAO_SPLIT_COUNT];
     BlurParametersBuffer _vblurParametersBuffer;
     BlurParametersBuffer _hblurParametersBuffer;
+    TemporalParametersBuffer _temporalParametersBuffer;
     float _blurEdgeSharpness{ 0.0f };
 
     static const gpu::PipelinePointer& getOcclusionPipeline();
@@ -220,17 +235,23 @@ private:
     static const gpu::PipelinePointer& getMipCreationPipeline();
     static const gpu::PipelinePointer& getGatherPipeline();
     static const gpu::PipelinePointer& getBuildNormalsPipeline();
+    static const gpu::PipelinePointer& getTemporalPipeline();
 
     static gpu::PipelinePointer _occlusionPipeline;
     static gpu::PipelinePointer _bilateralBlurPipeline;
     static gpu::PipelinePointer _mipCreationPipeline;
     static gpu::PipelinePointer _gatherPipeline;
     static gpu::PipelinePointer _buildNormalsPipeline;
+    static gpu::PipelinePointer _temporalPipeline;
 
     AmbientOcclusionFramebufferPointer _framebuffer;
     std::array<float, SSAO_RANDOM_SAMPLE_COUNT * SSAO_SPLIT_COUNT*SSAO_SPLIT_COUNT> _randomSamples;
     int _frameId{ 0 };
     bool _isJitterEnabled{ true };
+    bool _isTemporalEnabled{ false };
+    float _temporalFeedback{ 0.0f };
+    int _historyIndex{ 0 };
+    bool _isHistoryValid{ false };
     
     gpu::RangeTimerPointer _gpuTimer;
 
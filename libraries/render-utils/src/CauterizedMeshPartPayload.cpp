@@ -22,34 +22,10 @@ CauterizedMeshPartPayload::CauterizedMeshPartPayload(ModelPointer model, int mes
                                                      const Transform& transform, const uint64_t& created)
     : ModelMeshPartPayload(model, meshIndex, partIndex, shapeIndex, transform, created) {}
 
-void CauterizedMeshPartPayload::updateClusterBuffer(const std::vector<glm::mat4>& clusterMatrices,
-                                                    const std::vector<glm::mat4>& cauterizedClusterMatrices) {
-    ModelMeshPartPayload::updateClusterBuffer(clusterMatrices);
-
-    if (cauterizedClusterMatrices.size() > 1) {
-        if (!_cauterizedClusterBuffer) {
-            _cauterizedClusterBuffer = std::make_shared<gpu::Buffer>(cauterizedClusterMatrices.size() * sizeof(glm::mat4),
-                (const gpu::Byte*) cauterizedClusterMatrices.data());
-        } else {
-            _cauterizedClusterBuffer->setSubData(0, cauterizedClusterMatrices.size() * sizeof(glm::mat4),
-                (const gpu::Byte*) cauterizedClusterMatrices.data());
-        }
-    }
-}
-
-void CauterizedMeshPartPayload::updateClusterBuffer(const std::vector<Model::TransformDualQuaternion>& clusterDualQuaternions,
-                                                    const std::vector<Model::TransformDualQuaternion>& cauterizedClusterDualQuaternions) {
-    ModelMeshPartPayload::updateClusterBuffer(clusterDualQuaternions);
-
-    if (cauterizedClusterDualQuaternions.size() > 1) {
-        if (!_cauterizedClusterBuffer) {
-            _cauterizedClusterBuffer = std::make_shared<gpu::Buffer>(cauterizedClusterDualQuaternions.size() * sizeof(Model::TransformDualQuaternion),
-                (const gpu::Byte*) cauterizedClusterDualQuaternions.data());
-        } else {
-            _cauterizedClusterBuffer->setSubData(0, cauterizedClusterDualQuaternions.size() * sizeof(Model::TransformDualQuaternion),
-                (const gpu::Byte*) cauterizedClusterDualQuaternions.data());
-        }
-    }
+void CauterizedMeshPartPayload::setClusterRanges(const SkinningBuffer::RangePointer& clusterRange,
+                                                 const SkinningBuffer::RangePointer& cauterizedClusterRange) {
+    setClusterRange(clusterRange);
+    _cauterizedClusterRange = cauterizedClusterRange;
 }
 
 void CauterizedMeshPartPayload::updateTransformForCauterizedMesh(const Transform& modelTransform, const Model::MeshState& meshState, bool useDualQuaternionSkinning) {
@@ -74,8 +50,8 @@ void CauterizedMeshPartPayload::updateTransformForCauterizedMesh(const Transform
 void CauterizedMeshPartPayload::bindTransform(gpu::Batch& batch, const Transform& transform, RenderArgs::RenderMode renderMode) const {
     bool useCauterizedMesh = (renderMode != RenderArgs::RenderMode::SHADOW_RENDER_MODE && renderMode != RenderArgs::RenderMode::SECONDARY_CAMERA_RENDER_MODE) && _enableCauterization;
     if (useCauterizedMesh) {
-        if (_cauterizedClusterBuffer) {
-            batch.setUniformBuffer(graphics::slot::buffer::Skinning, _cauterizedClusterBuffer);
+        if (_cauterizedClusterRange) {
+            _cauterizedClusterRange->bind(batch, graphics::slot::buffer::Skinning);
         }
         batch.setModelTransform(_cauterizedTransform);
     } else {
@@ -15,13 +15,8 @@ class CauterizedMeshPartPayload : public ModelMeshPartPayload {
 public:
     CauterizedMeshPartPayload(ModelPointer model, int meshIndex, int partIndex, int shapeIndex, const Transform& transform, const uint64_t& created);
 
-    // matrix palette skinning
-    void updateClusterBuffer(const std::vector<glm::mat4>& clusterMatrices,
-                             const std::vector<glm::mat4>& cauterizedClusterMatrices);
-
-    // dual quaternion skinning
-    void updateClusterBuffer(const std::vector<Model::TransformDualQuaternion>& clusterDualQuaternions,
-                             const std::vector<Model::TransformDualQuaternion>& cauterizedClusterQuaternions);
+    void setClusterRanges(const SkinningBuffer::RangePointer& clusterRange,
+                          const SkinningBuffer::RangePointer& cauterizedClusterRange);
 
     void updateTransformForCauterizedMesh(const Transform& modelTransform, const Model::MeshState& meshState, bool useDualQuaternionSkinning);
 
@@ -30,7 +25,7 @@ public:
     void setEnableCauterization(bool enableCauterization) { _enableCauterization = enableCauterization; }
 
 private:
-    gpu::BufferPointer _cauterizedClusterBuffer;
+    SkinningBuffer::RangePointer _cauterizedClusterRange;
     Transform _cauterizedTransform;
     bool _enableCauterization { false };
 };
@@ -196,6 +196,15 @@ void CauterizedModel::updateRenderItems() {
             // lazy update of cluster matrices used for rendering.  We need to update them here, so we can correctly update the bounding box.
             self->updateClusterMatrices();
 
+            self->_clusterRanges.resize(self->_meshStates.size());
+            self->_cauterizeClusterRanges.resize(self->_cauterizeMeshStates.size());
+            for (size_t i = 0; i < self->_meshStates.size(); i++) {
+                self->updateClusterRange(self->_meshStates[i], self->_clusterRanges[i]);
+            }
+            for (int i = 0; i < self->_cauterizeMeshStates.size(); i++) {
+                self->updateClusterRange(self->_cauterizeMeshStates[i], self->_cauterizeClusterRanges[i]);
+            }
+
             render::ScenePointer scene = AbstractViewStateInterface::instance()->getMain3DScene();
 
             Transform modelTransform;
@@ -214,20 +223,19 @@ void CauterizedModel::updateRenderItems() {
 
                 const auto& meshState = self->getMeshState(meshIndex);
                 const auto& cauterizedMeshState = self->getCauterizeMeshState(meshIndex);
+                const auto& clusterRange = self->_clusterRanges[meshIndex];
+                const auto& cauterizedClusterRange = self->_cauterizeClusterRanges[meshIndex];
 
                 bool invalidatePayloadShapeKey = self->shouldInvalidatePayloadShapeKey(meshIndex);
                 bool useDualQuaternionSkinning = self->getUseDualQuaternionSkinning();
 
                 transaction.updateItem<ModelMeshPartPayload>(itemID, [modelTransform, meshState, useDualQuaternionSkinning, cauterizedMeshState, invalidatePayloadShapeKey,
-                        primitiveMode, renderItemKeyGlobalFlags, enableCauterization](ModelMeshPartPayload& mmppData) {
+                        clusterRange, cauterizedClusterRange, primitiveMode, renderItemKeyGlobalFlags, enableCauterization](ModelMeshPartPayload& mmppData) {
                     CauterizedMeshPartPayload& data = static_cast<CauterizedMeshPartPayload&>(mmppData);
+                    data.setClusterRanges(clusterRange, cauterizedClusterRange);
                     if (useDualQuaternionSkinning) {
-                        data.updateClusterBuffer(meshState.clusterDualQuaternions,
-                                                 cauterizedMeshState.clusterDualQuaternions);
                         data.computeAdjustedLocalBound(meshState.clusterDualQuaternions);
                     } else {
-                        data.updateClusterBuffer(meshState.clusterMatrices,
-                                                 cauterizedMeshState.clusterMatrices);
                         data.computeAdjustedLocalBound(meshState.clusterMatrices);
                     }
 
@@ -41,6 +41,7 @@ public:
 protected:
     std::unordered_set<int> _cauterizeBoneSet;
     QVector<Model::MeshState> _cauterizeMeshStates;
+    std::vector<SkinningBuffer::RangePointer> _cauterizeClusterRanges;
     bool _isCauterized { false };
     bool _enableCauterization { false };
 };
@@ -0,0 +1,63 @@
+//
+//  FoveationFill.cpp
+//  libraries/render-utils/src/
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "FoveationFill.h"
+
+#include <gpu/Context.h>
+#include <shaders/Shaders.h>
+
+#include "render-utils/ShaderConstants.h"
+#include "StencilMaskPass.h"
+
+namespace ru {
+    using render_utils::slot::texture::Texture;
+}
+
+const gpu::PipelinePointer& FoveationFill::getPipeline() {
+    if (!_pipeline) {
+        gpu::ShaderPointer program = gpu::Shader::createProgram(shader::render_utils::program::foveation_fill);
+
+        gpu::StatePointer state = std::make_shared<gpu::State>();
+        PrepareStencil::testMasked(*state);
+
+        _pipeline = gpu::Pipeline::create(program, state);
+    }
+    return _pipeline;
+}
+
+void FoveationFill::run(const render::RenderContextPointer& renderContext, const Inputs& lightingFramebuffer) {
+    assert(renderContext->args);
+    RenderArgs* args = renderContext->args;
+
+    if (!lightingFramebuffer || !PrepareStencil::isFoveated(args)) {
+        return;
+    }
+
+    auto colorTexture = lightingFramebuffer->getRenderBuffer(0);
+    if (!_colorFramebuffer || _colorFramebuffer->getSize() != lightingFramebuffer->getSize() ||
+        _colorFramebuffer->getRenderBuffer(0)->getTexelFormat() != colorTexture->getTexelFormat()) {
+        _colorFramebuffer = gpu::FramebufferPointer(gpu::Framebuffer::create("foveationColor", colorTexture->getTexelFormat(),
+            lightingFramebuffer->getWidth(), lightingFramebuffer->getHeight()));
+    }
+
+    gpu::doInBatch("FoveationFill::run", args->_context, [&](gpu::Batch& batch) {
+        PROFILE_RANGE_BATCH(batch, "FoveationFill");
+        batch.enableStereo(false);
+
+        batch.blit(lightingFramebuffer, args->_viewport, _colorFramebuffer, args->_viewport);
+
+        batch.setViewportTransform(args->_viewport);
+        batch.setFramebuffer(lightingFramebuffer);
+        batch.setPipeline(getPipeline());
+        batch.setResourceTexture(ru::Texture::FoveationColor, _colorFramebuffer->getRenderBuffer(0));
+        batch.draw(gpu::TRIANGLE_STRIP, 4);
+        batch.setResourceTexture(ru::Texture::FoveationColor, nullptr);
+    });
+}
@@ -0,0 +1,34 @@
+//
+//  FoveationFill.h
+//  libraries/render-utils/src/
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_FoveationFill_h
+#define vircadia_FoveationFill_h
+
+#include <render/Engine.h>
+#include <gpu/Pipeline.h>
+
+// Fills the blocks that PrepareStencil masked out of the periphery of the stereo views with the average of the shaded
+// blocks beside them, once all that's lit has been drawn to the lighting framebuffer
+class FoveationFill {
+public:
+    using Inputs = gpu::FramebufferPointer;
+    using JobModel = render::Job::ModelI<FoveationFill, Inputs>;
+
+    void run(const render::RenderContextPointer& renderContext, const Inputs& lightingFramebuffer);
+
+private:
+    const gpu::PipelinePointer& getPipeline();
+
+    gpu::PipelinePointer _pipeline;
+    // a copy of the lighting, that the fill reads from as it writes to the lighting framebuffer
+    gpu::FramebufferPointer _colorFramebuffer;
+};
+
+#endif // vircadia_FoveationFill_h
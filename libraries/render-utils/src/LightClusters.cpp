@@ -220,42 +220,38 @@ bool reduceSphereToPlane(const glm::vec4& sphere, const glm::vec4& plane, glm::v
 }
 
 
-uint32_t scanLightVolumeBoxSlice(FrustumGrid& grid, const FrustumGrid::Planes planes[3], int zSlice, int yMin, int yMax, int xMin, int xMax, LightClusters::LightID lightId, const glm::vec4& eyePosRadius,
-    std::vector< std::vector<LightClusters::LightIndex>>& clusterGrid) {
+uint32_t scanLightVolumeBoxSlice(FrustumGrid& grid, const FrustumGrid::Planes planes[3], int zSlice, int yMin, int yMax, int xMin, int xMax, LightClusters::LightID lightId, bool isSpot, const glm::vec4& eyePosRadius,
+    std::vector<LightClusters::ClusterSpan>& clusterSpans) {
     glm::ivec3 gridPosToOffset(1, grid.dims.x, grid.dims.x * grid.dims.y);
     uint32_t numClustersTouched = 0;
 
     for (auto y = yMin; (y <= yMax); y++) {
-        for (auto x = xMin; (x <= xMax); x++) {
-            auto index = x + gridPosToOffset.y * y + gridPosToOffset.z * zSlice;
-            clusterGrid[index].emplace_back(lightId);
-            numClustersTouched++;
-        }
+        auto index = xMin + gridPosToOffset.y * y + gridPosToOffset.z * zSlice;
+        clusterSpans.push_back({ (uint32_t)index, (uint32_t)(index + xMax + 1 - xMin), (LightClusters::LightIndex)lightId, isSpot });
+        numClustersTouched += xMax + 1 - xMin;
     }
 
     return numClustersTouched;
 }
 
-uint32_t scanLightVolumeBox(FrustumGrid& grid, const FrustumGrid::Planes planes[3], int zMin, int zMax, int yMin, int yMax, int xMin, int xMax, LightClusters::LightID lightId, const glm::vec4& eyePosRadius,
-    std::vector< std::vector<LightClusters::LightIndex>>& clusterGrid) {
+uint32_t scanLightVolumeBox(FrustumGrid& grid, const FrustumGrid::Planes planes[3], int zMin, int zMax, int yMin, int yMax, int xMin, int xMax, LightClusters::LightID lightId, bool isSpot, const glm::vec4& eyePosRadius,
+    std::vector<LightClusters::ClusterSpan>& clusterSpans) {
     glm::ivec3 gridPosToOffset(1, grid.dims.x, grid.dims.x * grid.dims.y);
     uint32_t numClustersTouched = 0;
 
     for (auto z = zMin; (z <= zMax); z++) {
         for (auto y = yMin; (y <= yMax); y++) {
-            for (auto x = xMin; (x <= xMax); x++) {
-                auto index = x + gridPosToOffset.y * y + gridPosToOffset.z * z;
-                clusterGrid[index].emplace_back(lightId);
-                numClustersTouched++;
-            }
+            auto index = xMin + gridPosToOffset.y * y + gridPosToOffset.z * z;
+            clusterSpans.push_back({ (uint32_t)index, (uint32_t)(index + xMax + 1 - xMin), (LightClusters::LightIndex)lightId, isSpot });
+            numClustersTouched += xMax + 1 - xMin;
         }
     }
 
     return numClustersTouched;
 }
 
-uint32_t scanLightVolumeSphere(FrustumGrid& grid, const FrustumGrid::Planes planes[3], int zMin, int zMax, int yMin, int yMax, int xMin, int xMax, LightClusters::LightID lightId, const glm::vec4& eyePosRadius,
-    std::vector< std::vector<LightClusters::LightIndex>>& clusterGrid) {
+uint32_t scanLightVolumeSphere(FrustumGrid& grid, const FrustumGrid::Planes planes[3], int zMin, int zMax, int yMin, int yMax, int xMin, int xMax, LightClusters::LightID lightId, bool isSpot, const glm::vec4& eyePosRadius,
+    std::vector<LightClusters::ClusterSpan>& clusterSpans) {
     glm::ivec3 gridPosToOffset(1, grid.dims.x, grid.dims.x * grid.dims.y);
     uint32_t numClustersTouched = 0;
     const auto& xPlanes = planes[0];
@@ -306,13 +302,14 @@ uint32_t scanLightVolumeSphere(FrustumGrid& grid, const FrustumGrid::Planes plan
                 }
             }
 
-            for (; (x <= xs); x++) {
+            if (x <= xs) {
                 auto index = grid.frustumGrid_clusterToIndex(ivec3(x, y, z));
-                if (index < (int)clusterGrid.size()) {
-                    clusterGrid[index].emplace_back(lightId);
-                    numClustersTouched++;
+                auto endIndex = grid.frustumGrid_clusterToIndex(ivec3(xs, y, z)) + 1;
+                if (endIndex <= grid.frustumGrid_numClusters()) {
+                    clusterSpans.push_back({ (uint32_t)index, (uint32_t)endIndex, (LightClusters::LightIndex)lightId, isSpot });
+                    numClustersTouched += endIndex - index;
                 } else {
-                    qCDebug(renderutils) << "WARNING: LightClusters::scanLightVolumeSphere invalid index found ? numClusters = " << clusterGrid.size() << " index = " << index << " found from cluster xyz = " << x << " " << y << " " << z;
+                    qCDebug(renderutils) << "WARNING: LightClusters::scanLightVolumeSphere invalid index found ? numClusters = " << grid.frustumGrid_numClusters() << " index = " << endIndex - 1 << " found from cluster xyz = " << xs << " " << y << " " << z;
                 }
             }
         }
@@ -328,8 +325,7 @@ glm::ivec3 LightClusters::updateClusters() {
     // Clean up last info
     uint32_t numClusters = (uint32_t)_clusterGrid.size();
 
-    std::vector< std::vector< LightIndex > > clusterGridPoint(numClusters);
-    std::vector< std::vector< LightIndex > > clusterGridSpot(numClusters);
+    _clusterSpans.clear();
 
     _clusterGrid.clear();
     _clusterGrid.resize(numClusters, EMPTY_CLUSTER);
@@ -473,35 +469,46 @@ glm::ivec3 LightClusters::updateClusters() {
         }
 
         // now voxelize
-        auto& clusterGrid = (isSpot ? clusterGridSpot : clusterGridPoint);
         if (beyondFar) {
-            numClusterTouched += scanLightVolumeBoxSlice(theFrustumGrid, _gridPlanes, zMin, yMin, yMax, xMin, xMax, lightId, glm::vec4(glm::vec3(eyeOri), radius), clusterGrid);
+            numClusterTouched += scanLightVolumeBoxSlice(theFrustumGrid, _gridPlanes, zMin, yMin, yMax, xMin, xMax, lightId, isSpot, glm::vec4(glm::vec3(eyeOri), radius), _clusterSpans);
         } else {
-            numClusterTouched += scanLightVolumeSphere(theFrustumGrid, _gridPlanes, zMin, zMax, yMin, yMax, xMin, xMax, lightId, glm::vec4(glm::vec3(eyeOri), radius), clusterGrid);
+            numClusterTouched += scanLightVolumeSphere(theFrustumGrid, _gridPlanes, zMin, zMax, yMin, yMax, xMin, xMax, lightId, isSpot, glm::vec4(glm::vec3(eyeOri), radius), _clusterSpans);
         }
 
         numClusteredLights++;
     }
 
+    // Count the lights of each cluster
+    _clusterNumPointLights.assign(numClusters, 0);
+    _clusterNumSpotLights.assign(numClusters, 0);
+    for (const auto& span : _clusterSpans) {
+        auto& numLights = (span.isSpot ? _clusterNumSpotLights : _clusterNumPointLights);
+        for (uint32_t i = span.begin; i < span.end; i++) {
+            numLights[i]++;
+        }
+    }
+
     // Lights have been gathered now reexpress in terms of 2 sequential buffers
     // Start filling from near to far and stops if it overflows
     bool checkBudget = false;
     if (numClusterTouched > maxNumIndices) {
         checkBudget = true;
     }
+    _clusterPointLightsOffset.resize(numClusters);
+    _clusterSpotLightsOffset.resize(numClusters);
+    uint32_t numFilledClusters = numClusters;
     uint16_t indexOffset = 0;
-    for (int i = 0; i < (int) clusterGridPoint.size(); i++) {
-        auto& clusterPoint = clusterGridPoint[i];
-        auto& clusterSpot = clusterGridSpot[i];
-
-        uint8_t numLightsPoint = ((uint8_t)clusterPoint.size());
-        uint8_t numLightsSpot = ((uint8_t)clusterSpot.size());
+    for (uint32_t i = 0; i < numClusters; i++) {
+        // The grid only has 8 bits per count, the lights past that are dropped
+        uint8_t numLightsPoint = (uint8_t)std::min<uint32_t>(_clusterNumPointLights[i], 0xFF);
+        uint8_t numLightsSpot = (uint8_t)std::min<uint32_t>(_clusterNumSpotLights[i], 0xFF);
         uint16_t numLights = numLightsPoint + numLightsSpot;
         uint16_t offset = indexOffset;
 
         // Check for overflow
         if (checkBudget) {
             if ((indexOffset + numLights) > (uint16_t) maxNumIndices) {
+                numFilledClusters = i;
                 break;
             }
         }
@@ -509,14 +516,22 @@ glm::ivec3 LightClusters::updateClusters() {
         // Encode the cluster grid: [ ContentOffset - 16bits, Num Point LIghts - 8bits, Num Spot Lights - 8bits] 
         _clusterGrid[i] = (uint32_t)((0xFF000000 & (numLightsSpot << 24)) | (0x00FF0000 & (numLightsPoint << 16)) | (0x0000FFFF & offset));
 
+        _clusterPointLightsOffset[i] = offset;
+        _clusterSpotLightsOffset[i] = offset + numLightsPoint;
+        _clusterNumPointLights[i] = offset + numLightsPoint;
+        _clusterNumSpotLights[i] = offset + numLights;
+        indexOffset += numLights;
+    }
 
-        if (numLightsPoint) {
-            memcpy(_clusterContent.data() + indexOffset, clusterPoint.data(), numLightsPoint * sizeof(LightIndex));
-            indexOffset += numLightsPoint;
-        }
-        if (numLightsSpot) {
-            memcpy(_clusterContent.data() + indexOffset, clusterSpot.data(), numLightsSpot * sizeof(LightIndex));
-            indexOffset += numLightsSpot;
+    // The counts are now the ends of the cluster lists, fill them in the order the lights were scanned
+    for (const auto& span : _clusterSpans) {
+        auto& cursors = (span.isSpot ? _clusterSpotLightsOffset : _clusterPointLightsOffset);
+        const auto& ends = (span.isSpot ? _clusterNumSpotLights : _clusterNumPointLights);
+        uint32_t spanEnd = std::min(span.end, numFilledClusters);
+        for (uint32_t i = span.begin; i < spanEnd; i++) {
+            if (cursors[i] < ends[i]) {
+                _clusterContent[cursors[i]++] = span.lightId;
+            }
         }
     }
 
@@ -105,6 +105,21 @@ public:
 
     std::vector<uint32_t> _clusterGrid;
     std::vector<LightIndex> _clusterContent;
+
+    // A run of consecutive clusters a light touches, the lights are first scanned into spans, then the spans are counted
+    // and copied into the cluster content, so that nothing is allocated per cluster
+    struct ClusterSpan {
+        uint32_t begin;
+        uint32_t end;
+        LightIndex lightId;
+        bool isSpot;
+    };
+    std::vector<ClusterSpan> _clusterSpans;
+    std::vector<uint32_t> _clusterNumPointLights;
+    std::vector<uint32_t> _clusterNumSpotLights;
+    std::vector<uint32_t> _clusterPointLightsOffset;
+    std::vector<uint32_t> _clusterSpotLightsOffset;
+
     gpu::BufferView _clusterGridBuffer;
     gpu::BufferView _clusterContentBuffer;
     uint32_t _clusterContentBudget { 0 };
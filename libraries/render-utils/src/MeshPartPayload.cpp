@@ -25,6 +25,11 @@
 using namespace render;
 
 bool ModelMeshPartPayload::enableMaterialProceduralShaders = false;
+bool ModelMeshPartPayload::enableInstancing = true;
+bool ModelMeshPartPayload::enableLODs = true;
+
+// A LOD is drawn when the details it lost would look smaller than this from the view, about a pixel of a 1080p 60 degree view
+static const float MAX_LOD_ERROR_ANGLE = 0.001f;
 
 ModelMeshPartPayload::ModelMeshPartPayload(ModelPointer model, int meshIndex, int partIndex, int shapeIndex,
                                            const Transform& transform, const uint64_t& created) :
@@ -60,6 +65,8 @@ ModelMeshPartPayload::ModelMeshPartPayload(ModelPointer model, int meshIndex, in
     } else if (_isSkinned) {
         BlendshapeOffset data;
         _meshBlendshapeBuffer = std::make_shared<gpu::Buffer>(sizeof(BlendshapeOffset), reinterpret_cast<const gpu::Byte*>(&data), sizeof(BlendshapeOffset));
+        glm::vec4 coefficients(0.0f);
+        _blendshapeCoefficientsBuffer = std::make_shared<gpu::Buffer>(sizeof(glm::vec4), reinterpret_cast<const gpu::Byte*>(&coefficients), sizeof(glm::vec4));
     }
 #endif
 }
@@ -74,6 +81,13 @@ void ModelMeshPartPayload::initCache(const ModelPointer& model, int shapeID) {
 
         _isBlendShaped = !mesh.blendshapes.isEmpty();
         _hasTangents = !mesh.tangents.isEmpty();
+
+        if (_isBlendShaped) {
+            // the coefficients are read four at a time
+            std::vector<float> coefficients(((mesh.blendshapes.size() + 3) / 4) * 4, 0.0f);
+            const auto coefficientsSize = coefficients.size() * sizeof(float);
+            _blendshapeCoefficientsBuffer = std::make_shared<gpu::Buffer>(coefficientsSize, reinterpret_cast<const gpu::Byte*>(coefficients.data()), coefficientsSize);
+        }
     }
 
     auto networkMaterial = model->getGeometry()->getShapeMaterial(shapeID);
@@ -84,6 +98,7 @@ void ModelMeshPartPayload::initCache(const ModelPointer& model, int shapeID) {
 
 void ModelMeshPartPayload::updateMeshPart(const std::shared_ptr<const graphics::Mesh>& drawMesh, int partIndex) {
     _drawMesh = drawMesh;
+    _partIndex = partIndex;
     if (_drawMesh) {
         auto vertexFormat = _drawMesh->getVertexFormat();
         _drawPart = _drawMesh->getPartBuffer().get<graphics::Mesh::Part>(partIndex);
@@ -91,44 +106,6 @@ void ModelMeshPartPayload::updateMeshPart(const std::shared_ptr<const graphics::
     }
 }
 
-void ModelMeshPartPayload::updateClusterBuffer(const std::vector<glm::mat4>& clusterMatrices) {
-    // reset cluster buffer if we change the cluster buffer type
-    if (_clusterBufferType != ClusterBufferType::Matrices) {
-        _clusterBuffer.reset();
-    }
-    _clusterBufferType = ClusterBufferType::Matrices;
-
-    // Once computed the cluster matrices, update the buffer(s)
-    if (clusterMatrices.size() > 1) {
-        if (!_clusterBuffer) {
-            _clusterBuffer = std::make_shared<gpu::Buffer>(clusterMatrices.size() * sizeof(glm::mat4),
-                (const gpu::Byte*) clusterMatrices.data());
-        } else {
-            _clusterBuffer->setSubData(0, clusterMatrices.size() * sizeof(glm::mat4),
-                (const gpu::Byte*) clusterMatrices.data());
-        }
-    }
-}
-
-void ModelMeshPartPayload::updateClusterBuffer(const std::vector<Model::TransformDualQuaternion>& clusterDualQuaternions) {
-    // reset cluster buffer if we change the cluster buffer type
-    if (_clusterBufferType != ClusterBufferType::DualQuaternions) {
-        _clusterBuffer.reset();
-    }
-    _clusterBufferType = ClusterBufferType::DualQuaternions;
-
-    // Once computed the cluster matrices, update the buffer(s)
-    if (clusterDualQuaternions.size() > 1) {
-        if (!_clusterBuffer) {
-            _clusterBuffer = std::make_shared<gpu::Buffer>(clusterDualQuaternions.size() * sizeof(Model::TransformDualQuaternion),
-                (const gpu::Byte*) clusterDualQuaternions.data());
-        } else {
-            _clusterBuffer->setSubData(0, clusterDualQuaternions.size() * sizeof(Model::TransformDualQuaternion),
-                (const gpu::Byte*) clusterDualQuaternions.data());
-        }
-    }
-}
-
 void ModelMeshPartPayload::computeAdjustedLocalBound(const std::vector<glm::mat4>& clusterMatrices) {
     _adjustedLocalBound = _localBound;
     if (clusterMatrices.size() > 0) {
@@ -185,18 +162,92 @@ void ModelMeshPartPayload::bindMesh(gpu::Batch& batch) {
     if (_meshBlendshapeBuffer) {
         batch.setResourceBuffer(0, _meshBlendshapeBuffer);
     }
+    if (_blendshapeCoefficientsBuffer) {
+        batch.setResourceBuffer(1, _blendshapeCoefficientsBuffer);
+    }
     batch.setInputStream(0, _drawMesh->getVertexStream());
 }
 
 void ModelMeshPartPayload::bindTransform(gpu::Batch& batch, const Transform& transform, RenderArgs::RenderMode renderMode) const {
-    if (_clusterBuffer) {
-        batch.setUniformBuffer(graphics::slot::buffer::Skinning, _clusterBuffer);
+    if (_clusterRange) {
+        _clusterRange->bind(batch, graphics::slot::buffer::Skinning);
     }
     batch.setModelTransform(transform);
 }
 
-void ModelMeshPartPayload::drawCall(gpu::Batch& batch) const {
-    batch.drawIndexed(gpu::TRIANGLES, _drawPart._numIndices, _drawPart._startIndex);
+void ModelMeshPartPayload::drawCall(gpu::Batch& batch, const graphics::Mesh::Part& drawPart) const {
+    batch.drawIndexed(gpu::TRIANGLES, drawPart._numIndices, drawPart._startIndex);
+}
+
+const graphics::Mesh::Part& ModelMeshPartPayload::selectDrawPart(RenderArgs* args, const Transform& parentTransform,
+                                                                 const Transform& modelTransform) const {
+    if (!enableLODs || !_drawMesh || _drawMesh->getPartLODs().empty()) {
+        return _drawPart;
+    }
+
+    // shadows are cast by what's seen, so they use the same LODs as the main view
+    glm::vec3 viewPosition = args->_renderMode == RenderArgs::RenderMode::SHADOW_RENDER_MODE ?
+        BillboardModeHelpers::getPrimaryViewFrustumPosition() : args->getViewFrustum().getPosition();
+
+    auto worldBound = _adjustedLocalBound;
+    worldBound.transform(parentTransform);
+    float distance = glm::distance(viewPosition, glm::clamp(viewPosition, worldBound.getMinimumPoint(), worldBound.getMaximumPoint()));
+
+    glm::vec3 scale = glm::abs(modelTransform.getScale());
+    float maxError = MAX_LOD_ERROR_ANGLE * distance / glm::max(scale.x, glm::max(scale.y, scale.z));
+
+    const graphics::Mesh::Part* drawPart = &_drawPart;
+    for (const auto& partLOD : _drawMesh->getPartLODs()) {
+        if (partLOD._error > maxError || _partIndex >= (int)partLOD._parts.size()) {
+            break;
+        }
+        drawPart = &partLOD._parts[_partIndex];
+    }
+    return *drawPart;
+}
+
+bool ModelMeshPartPayload::canBeInstanced(RenderArgs* args) const {
+    // the instances only differ by their transforms: anything set per item, deformed meshes, and transparent parts that
+    // have to be drawn in order are drawn one by one
+    return enableInstancing && args->_shapePipeline && !args->_shapePipeline->hasItemSetter() && !_shapeKey.hasOwnPipeline() &&
+        !_isSkinned && !_isBlendShaped && !_itemKey.isTransparent();
+}
+
+void ModelMeshPartPayload::drawInstance(RenderArgs* args, const Transform& modelTransform, const graphics::Mesh::Part& drawPart) {
+    gpu::Batch& batch = *(args->_batch);
+
+    // each LOD of a part is instanced separately
+    std::string instanceName = "model_part_" + std::to_string((uintptr_t)_drawMesh.get()) + "_" +
+        std::to_string(drawPart._startIndex) + "_" + std::to_string(drawPart._numIndices) + "_" +
+        std::to_string(std::hash<render::ShapePipelinePointer>()(args->_shapePipeline));
+    for (const auto& layer : _drawMaterials.getLayers()) {
+        instanceName += "_" + std::to_string((uintptr_t)layer.material.get()) + ":" + std::to_string(layer.priority);
+    }
+
+    batch.setModelTransform(modelTransform);
+    if (batch.hasNamedCallsFunction(instanceName)) {
+        batch.setupNamedCalls(instanceName, nullptr);
+    } else {
+        // everything but the transforms is the first instance's
+        auto pipeline = args->_shapePipeline;
+        auto drawMesh = _drawMesh;
+        auto instancePart = drawPart;
+        auto drawMaterials = _drawMaterials;
+        auto renderMode = args->_renderMode;
+        bool enableTexturing = args->_enableTexturing;
+        batch.setupNamedCalls(instanceName, [args, pipeline, drawMesh, instancePart, drawMaterials, renderMode, enableTexturing]
+                                            (gpu::Batch& batch, gpu::Batch::NamedBatchData& data) mutable {
+            batch.setPipeline(pipeline->pipeline);
+            pipeline->prepare(batch, args);
+
+            batch.setIndexBuffer(gpu::UINT32, (drawMesh->getIndexBuffer()._buffer), 0);
+            batch.setInputFormat((drawMesh->getVertexFormat()));
+            batch.setInputStream(0, drawMesh->getVertexStream());
+            RenderPipelines::bindMaterials(drawMaterials, batch, renderMode, enableTexturing);
+
+            batch.drawIndexedInstanced((gpu::uint32)data.count(), gpu::TRIANGLES, instancePart._numIndices, instancePart._startIndex);
+        });
+    }
 }
 
 void ModelMeshPartPayload::updateKey(const render::ItemKey& key) {
@@ -310,6 +361,11 @@ ShapeKey ModelMeshPartPayload::getShapeKey() const {
     return _shapeKey;
 }
 
+uint64_t ModelMeshPartPayload::getMaterialSortKey() const {
+    // the parts of a model, and the copies of a model, whose top material is the same one bind the same textures
+    return _drawMaterials.empty() ? 0 : (uint64_t)(uintptr_t)_drawMaterials.top().material.get();
+}
+
 void ModelMeshPartPayload::render(RenderArgs* args) {
     PerformanceTimer perfTimer("ModelMeshPartPayload::render");
 
@@ -324,6 +380,16 @@ void ModelMeshPartPayload::render(RenderArgs* args) {
         args->_renderMode == RenderArgs::RenderMode::SHADOW_RENDER_MODE ? BillboardModeHelpers::getPrimaryViewFrustumPosition() : args->getViewFrustum().getPosition()));
 
     Transform modelTransform = transform.worldTransform(_localTransform);
+
+    const graphics::Mesh::Part& drawPart = selectDrawPart(args, transform, modelTransform);
+
+    const int INDICES_PER_TRIANGLE = 3;
+    if (canBeInstanced(args)) {
+        drawInstance(args, modelTransform, drawPart);
+        args->_details._trianglesRendered += drawPart._numIndices / INDICES_PER_TRIANGLE;
+        return;
+    }
+
     bindTransform(batch, modelTransform, args->_renderMode);
 
     //Bind the index buffer and vertex buffer and Blend shapes if needed
@@ -356,11 +422,10 @@ void ModelMeshPartPayload::render(RenderArgs* args) {
     // Draw!
     {
         PerformanceTimer perfTimer("batch.drawIndexed()");
-        drawCall(batch);
+        drawCall(batch, drawPart);
     }
 
-    const int INDICES_PER_TRIANGLE = 3;
-    args->_details._trianglesRendered += _drawPart._numIndices / INDICES_PER_TRIANGLE;
+    args->_details._trianglesRendered += drawPart._numIndices / INDICES_PER_TRIANGLE;
 }
 
 bool ModelMeshPartPayload::passesZoneOcclusionTest(const std::unordered_set<QUuid>& containingZones) const {
@@ -378,7 +443,8 @@ bool ModelMeshPartPayload::passesZoneOcclusionTest(const std::unordered_set<QUui
 }
 
 void ModelMeshPartPayload::setBlendshapeBuffer(const std::unordered_map<int, gpu::BufferPointer>& blendshapeBuffers, const QVector<int>& blendedMeshSizes) {
-    if (_meshIndex < blendedMeshSizes.length() && blendedMeshSizes.at(_meshIndex) == _meshNumVertices) {
+    // the offsets start with where each vertex's are
+    if (_meshIndex < blendedMeshSizes.length() && blendedMeshSizes.at(_meshIndex) >= _meshNumVertices) {
         auto blendshapeBuffer = blendshapeBuffers.find(_meshIndex);
         if (blendshapeBuffer != blendshapeBuffers.end()) {
             _meshBlendshapeBuffer = blendshapeBuffer->second;
@@ -394,6 +460,21 @@ void ModelMeshPartPayload::setBlendshapeBuffer(const std::unordered_map<int, gpu
     }
 }
 
+void ModelMeshPartPayload::updateBlendshapeCoefficients(const QVector<float>& blendshapeCoefficients) {
+    if (!_blendshapeCoefficientsBuffer) {
+        return;
+    }
+
+    // blendshapes with negative or negligible coefficients aren't applied
+    const float EPSILON = 0.0001f;
+    std::vector<float> coefficients(_blendshapeCoefficientsBuffer->getSize() / sizeof(float), 0.0f);
+    for (int i = 0, n = std::min(blendshapeCoefficients.size(), (int)coefficients.size()); i < n; i++) {
+        float coefficient = blendshapeCoefficients.at(i);
+        coefficients[i] = coefficient < EPSILON ? 0.0f : coefficient;
+    }
+    _blendshapeCoefficientsBuffer->setSubData(0, coefficients.size() * sizeof(float), reinterpret_cast<const gpu::Byte*>(coefficients.data()));
+}
+
 namespace render {
 template <> const ItemKey payloadGetKey(const ModelMeshPartPayload::Pointer& payload) {
     if (payload) {
@@ -416,6 +497,13 @@ template <> const ShapeKey shapeGetShapeKey(const ModelMeshPartPayload::Pointer&
     return ShapeKey::Builder::invalid();
 }
 
+template <> uint64_t shapeGetMaterialSortKey(const ModelMeshPartPayload::Pointer& payload) {
+    if (payload) {
+        return payload->getMaterialSortKey();
+    }
+    return 0;
+}
+
 template <> void payloadRender(const ModelMeshPartPayload::Pointer& payload, RenderArgs* args) {
     return payload->render(args);
 }
@@ -27,8 +27,8 @@ public:
 
     virtual void updateMeshPart(const std::shared_ptr<const graphics::Mesh>& drawMesh, int partIndex);
 
-    void updateClusterBuffer(const std::vector<glm::mat4>& clusterMatrices); // matrix palette skinning
-    void updateClusterBuffer(const std::vector<Model::TransformDualQuaternion>& clusterDualQuaternions); // dual quaternion skinning
+    // the mesh's range of the skinning buffer, null if it isn't skinned
+    void setClusterRange(const SkinningBuffer::RangePointer& clusterRange) { _clusterRange = clusterRange; }
 
     void computeAdjustedLocalBound(const std::vector<glm::mat4>& clusterMatrices); // matrix palette skinning
     void computeAdjustedLocalBound(const std::vector<Model::TransformDualQuaternion>& clusterDualQuaternions); // dual quaternion skinning
@@ -38,7 +38,15 @@ public:
     // ModelMeshPartPayload functions to perform render
     void bindMesh(gpu::Batch& batch);
     virtual void bindTransform(gpu::Batch& batch, const Transform& transform, RenderArgs::RenderMode renderMode) const;
-    void drawCall(gpu::Batch& batch) const;
+    void drawCall(gpu::Batch& batch, const graphics::Mesh::Part& drawPart) const;
+
+    // the coarsest LOD of the part whose lost details are too small to see from the view, or the part itself
+    const graphics::Mesh::Part& selectDrawPart(RenderArgs* args, const Transform& parentTransform, const Transform& modelTransform) const;
+
+    // parts of the same mesh, with the same materials and pipeline, are drawn in one instanced draw at the end of the
+    // batch rather than one by one
+    bool canBeInstanced(RenderArgs* args) const;
+    void drawInstance(RenderArgs* args, const Transform& modelTransform, const graphics::Mesh::Part& drawPart);
 
     void updateKey(const render::ItemKey& key);
     void setShapeKey(bool invalidateShapeKey, PrimitiveMode primitiveMode, bool useDualQuaternionSkinning);
@@ -47,6 +55,7 @@ public:
     render::ItemKey getKey() const;
     render::Item::Bound getBound(RenderArgs* args) const;
     render::ShapeKey getShapeKey() const;
+    uint64_t getMaterialSortKey() const;
     void render(RenderArgs* args);
 
     size_t getVerticesCount() const { return _drawMesh ? _drawMesh->getNumVertices() : 0; }
@@ -64,22 +73,25 @@ public:
     void removeMaterial(graphics::MaterialPointer material) { _drawMaterials.remove(material); }
 
     void setBlendshapeBuffer(const std::unordered_map<int, gpu::BufferPointer>& blendshapeBuffers, const QVector<int>& blendedMeshSizes);
+    void updateBlendshapeCoefficients(const QVector<float>& blendshapeCoefficients);
 
     static bool enableMaterialProceduralShaders;
+    static bool enableInstancing;
+    static bool enableLODs;
 
 private:
     void initCache(const ModelPointer& model, int shapeID);
 
     int _meshIndex;
+    int _partIndex { 0 };
     std::shared_ptr<const graphics::Mesh> _drawMesh;
     graphics::Mesh::Part _drawPart;
     graphics::MultiMaterial _drawMaterials;
 
-    gpu::BufferPointer _clusterBuffer;
-    enum class ClusterBufferType { Matrices, DualQuaternions };
-    ClusterBufferType _clusterBufferType { ClusterBufferType::Matrices };
+    SkinningBuffer::RangePointer _clusterRange;
 
     gpu::BufferPointer _meshBlendshapeBuffer;
+    gpu::BufferPointer _blendshapeCoefficientsBuffer;
     int _meshNumVertices;
 
     render::ItemKey _itemKey { render::ItemKey::Builder::opaqueShape().build() };
@@ -105,6 +117,7 @@ namespace render {
     template <> const ItemKey payloadGetKey(const ModelMeshPartPayload::Pointer& payload);
     template <> const Item::Bound payloadGetBound(const ModelMeshPartPayload::Pointer& payload, RenderArgs* args);
     template <> const ShapeKey shapeGetShapeKey(const ModelMeshPartPayload::Pointer& payload);
+    template <> uint64_t shapeGetMaterialSortKey(const ModelMeshPartPayload::Pointer& payload);
     template <> void payloadRender(const ModelMeshPartPayload::Pointer& payload, RenderArgs* args);
     template <> bool payloadPassesZoneOcclusionTest(const ModelMeshPartPayload::Pointer& payload, const std::unordered_set<QUuid>& containingZones);
 }
@@ -26,23 +26,23 @@ void MetaModelPayload::setBlendedVertices(int blendNumber, const QVector<Blendsh
 
     int index = 0;
     for (int i = 0; i < blendedMeshSizes.size(); i++) {
-        int numVertices = blendedMeshSizes.at(i);
+        int numOffsets = blendedMeshSizes.at(i);
 
         // This mesh isn't blendshaped
-        if (numVertices == 0) {
+        if (numOffsets == 0) {
             _blendshapeBuffers.erase(i);
             continue;
         }
 
         const auto& buffer = _blendshapeBuffers.find(i);
-        const auto blendShapeBufferSize = numVertices * sizeof(BlendshapeOffset);
+        const auto blendShapeBufferSize = numOffsets * sizeof(BlendshapeOffset);
         if (buffer == _blendshapeBuffers.end()) {
             _blendshapeBuffers[i] = std::make_shared<gpu::Buffer>(blendShapeBufferSize, (gpu::Byte*) blendshapeOffsets.constData() + index * sizeof(BlendshapeOffset), blendShapeBufferSize);
         } else {
             buffer->second->setData(blendShapeBufferSize, (gpu::Byte*) blendshapeOffsets.constData() + index * sizeof(BlendshapeOffset));
         }
 
-        index += numVertices;
+        index += numOffsets;
     }
 
     render::Transaction transaction;
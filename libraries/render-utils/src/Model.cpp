@@ -24,6 +24,7 @@
 #include <PerfStat.h>
 #include <ViewFrustum.h>
 #include <GLMHelpers.h>
+#include <LogHandler.h>
 #include <TBBHelpers.h>
 
 #include <model-networking/SimpleMeshProxy.h>
@@ -224,6 +225,11 @@ void Model::updateRenderItems() {
         // We need to update them here so we can correctly update the bounding box.
         self->updateClusterMatrices();
 
+        self->_clusterRanges.resize(self->_meshStates.size());
+        for (size_t i = 0; i < self->_meshStates.size(); i++) {
+            self->updateClusterRange(self->_meshStates[i], self->_clusterRanges[i]);
+        }
+
         Transform modelTransform = self->getTransform();
         modelTransform.setScale(glm::vec3(1.0f));
 
@@ -240,18 +246,18 @@ void Model::updateRenderItems() {
             auto meshIndex = self->_modelMeshRenderItemShapes[i].meshIndex;
 
             const auto& meshState = self->getMeshState(meshIndex);
+            const auto& clusterRange = self->_clusterRanges[meshIndex];
 
             bool invalidatePayloadShapeKey = self->shouldInvalidatePayloadShapeKey(meshIndex);
             bool useDualQuaternionSkinning = self->getUseDualQuaternionSkinning();
 
-            transaction.updateItem<ModelMeshPartPayload>(itemID, [modelTransform, meshState, useDualQuaternionSkinning,
+            transaction.updateItem<ModelMeshPartPayload>(itemID, [modelTransform, meshState, clusterRange, useDualQuaternionSkinning,
                                                                   invalidatePayloadShapeKey, primitiveMode, billboardMode, renderItemKeyGlobalFlags,
                                                                   cauterized, renderWithZones](ModelMeshPartPayload& data) {
+                data.setClusterRange(clusterRange);
                 if (useDualQuaternionSkinning) {
-                    data.updateClusterBuffer(meshState.clusterDualQuaternions);
                     data.computeAdjustedLocalBound(meshState.clusterDualQuaternions);
                 } else {
-                    data.updateClusterBuffer(meshState.clusterMatrices);
                     data.computeAdjustedLocalBound(meshState.clusterMatrices);
                 }
 
@@ -1129,6 +1135,10 @@ void Model::removeFromScene(const render::ScenePointer& scene, render::Transacti
     _modelMeshRenderItemShapes.clear();
     _priorityMap.clear();
 
+    // new render items will need the blendshapes again
+    _blendedBlendshapeCoefficients.clear();
+    _blendshapeOffsetsRequested = false;
+
     _addedToScene = false;
 
     _renderInfoVertexCount = 0;
@@ -1521,19 +1531,56 @@ void Model::updateClusterMatrices() {
     updateBlendshapes();
 }
 
+void Model::updateClusterRange(const MeshState& state, SkinningBuffer::RangePointer& range) const {
+    size_t numClusters = _useDualQuaternionSkinning ? state.clusterDualQuaternions.size() : state.clusterMatrices.size();
+    // a mesh with a single cluster is drawn with it as its model transform instead
+    if (numClusters <= 1) {
+        range.reset();
+        return;
+    }
+
+    SkinningBuffer::Size size = _useDualQuaternionSkinning ? numClusters * sizeof(TransformDualQuaternion) :
+        numClusters * sizeof(glm::mat4);
+    if (!range || range->getSize() != size) {
+        range = SkinningBuffer::allocate(size);
+    }
+    range->setData(_useDualQuaternionSkinning ? (const gpu::Byte*)state.clusterDualQuaternions.data() :
+        (const gpu::Byte*)state.clusterMatrices.data());
+}
+
 void Model::updateBlendshapes() {
-    // post the blender if we're not currently waiting for one to finish
     auto modelBlender = DependencyManager::get<ModelBlender>();
-    if (modelBlender->shouldComputeBlendshapes() && getHFMModel().hasBlendedMeshes() && _blendshapeCoefficients != _blendedBlendshapeCoefficients) {
-        _blendedBlendshapeCoefficients = _blendshapeCoefficients;
+    if (!_addedToScene || !modelBlender->shouldComputeBlendshapes() || !getHFMModel().hasBlendedMeshes()) {
+        return;
+    }
+
+    // the blendshapes' offsets are packed for the GPU once, by the blender
+    if (!_blendshapeOffsetsRequested) {
+        _blendshapeOffsetsRequested = true;
         modelBlender->noteRequiresBlend(getThisPointer());
     }
+
+    // after that, the vertex shaders only need the coefficients that weigh them
+    if (_blendshapeCoefficients != _blendedBlendshapeCoefficients) {
+        _blendedBlendshapeCoefficients = _blendshapeCoefficients;
+
+        auto coefficients = _blendshapeCoefficients;
+        render::Transaction transaction;
+        for (auto itemID : _modelMeshRenderItemIDs) {
+            transaction.updateItem<ModelMeshPartPayload>(itemID, [coefficients](ModelMeshPartPayload& data) {
+                data.updateBlendshapeCoefficients(coefficients);
+            });
+        }
+        AbstractViewStateInterface::instance()->getMain3DScene()->enqueueTransaction(transaction);
+    }
 }
 
 void Model::deleteGeometry() {
     _meshStates.clear();
+    _clusterRanges.clear();
     _rig.destroyAnimGraph();
     _blendedBlendshapeCoefficients.clear();
+    _blendshapeOffsetsRequested = false;
     _renderGeometry.reset();
 }
 
@@ -1817,41 +1864,16 @@ static void packBlendshapeOffsetTo_Pos_F32_3xSN10_Nor_3xSN10_Tan_3xSN10(glm::uve
     );
 }
 
-static void packBlendshapeOffsets_ref(BlendshapeOffsetUnpacked* unpacked, BlendshapeOffsetPacked* packed, int size) {
-    for (int i = 0; i < size; ++i) {
-        packBlendshapeOffsetTo_Pos_F32_3xSN10_Nor_3xSN10_Tan_3xSN10((*packed).packedPosNorTan, (*unpacked));
-        ++unpacked;
-        ++packed;
-    }
-}
-
-#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
-//
-// Runtime CPU dispatch
-//
-#include <CPUDetect.h>
-
-void packBlendshapeOffsets_AVX2(float (*unpacked)[9], uint32_t (*packed)[4], int size);
-
-static void packBlendshapeOffsets(BlendshapeOffsetUnpacked* unpacked, BlendshapeOffsetPacked* packed, int size) {
-    static bool _cpuSupportsAVX2 = cpuSupportsAVX2();
-    if (_cpuSupportsAVX2) {
-        static_assert(sizeof(BlendshapeOffsetUnpacked) == 9 * sizeof(float), "struct BlendshapeOffsetUnpacked size doesn't match.");
-        static_assert(sizeof(BlendshapeOffsetPacked) == 4 * sizeof(uint32_t), "struct BlendshapeOffsetPacked size doesn't match.");
-        packBlendshapeOffsets_AVX2((float(*)[9])unpacked, (uint32_t(*)[4])packed, size);
-    } else {
-        packBlendshapeOffsets_ref(unpacked, packed, size);
-    }
-}
-
-#else   // portable reference code
-static auto& packBlendshapeOffsets = packBlendshapeOffsets_ref;
-#endif
+// The low bits of the position scale of a packed offset are the index of its blendshape, the vertex shader weighs it by
+// that blendshape's coefficient
+static const uint32_t BLENDSHAPE_INDEX_MASK = 0xFF;
 
+// Packs the offsets of all the blendshapes of a model's meshes for the GPU.  This is only done once per model, the
+// coefficients are all that's updated when the blendshapes change.
 class Blender : public QRunnable {
 public:
 
-    Blender(ModelPointer model, HFMModel::ConstPointer hfmModel, int blendNumber, const QVector<float>& blendshapeCoefficients);
+    Blender(ModelPointer model, HFMModel::ConstPointer hfmModel, int blendNumber);
 
     virtual void run() override;
 
@@ -1859,84 +1881,76 @@ private:
     ModelPointer _model;
     HFMModel::ConstPointer _hfmModel;
     int _blendNumber;
-    QVector<float> _blendshapeCoefficients;
 };
 
-Blender::Blender(ModelPointer model, HFMModel::ConstPointer hfmModel, int blendNumber, const QVector<float>& blendshapeCoefficients) :
+Blender::Blender(ModelPointer model, HFMModel::ConstPointer hfmModel, int blendNumber) :
     _model(model),
     _hfmModel(hfmModel),
-    _blendNumber(blendNumber),
-    _blendshapeCoefficients(blendshapeCoefficients) {
+    _blendNumber(blendNumber) {
 }
 
 void Blender::run() {
     DETAILED_PROFILE_RANGE_EX(simulation_animation, __FUNCTION__, 0xFFFF0000, 0, { { "url", _model->getURL().toString() } });
-    int numBlendshapeOffsets = 0;  // number of offsets required for all meshes.
-    int maxBlendshapeOffsets = 0;  // number of offsets in the largest mesh.
-    int numMeshes = 0;  // number of meshes in this model.
-    for (auto meshIter = _hfmModel->meshes.cbegin(); meshIter != _hfmModel->meshes.cend(); ++meshIter) {
-        numMeshes++;
-        if (meshIter->blendshapes.isEmpty()) {
-            continue;
-        }
-        int numVertsInMesh = meshIter->vertices.size();
-        numBlendshapeOffsets += numVertsInMesh;
-        maxBlendshapeOffsets = std::max(maxBlendshapeOffsets, numVertsInMesh);
-    }
-
-    // allocate the required sizes
-    QVector<int> blendedMeshSizes;
-    blendedMeshSizes.reserve(numMeshes);
-
+    QVector<int> blendedMeshSizes;  // number of packed offsets of each mesh
+    blendedMeshSizes.reserve(_hfmModel->meshes.size());
     QVector<BlendshapeOffset> packedBlendshapeOffsets;
-    packedBlendshapeOffsets.resize(numBlendshapeOffsets);
 
-    QVector<BlendshapeOffsetUnpacked> unpackedBlendshapeOffsets;
-    unpackedBlendshapeOffsets.resize(maxBlendshapeOffsets);    // reuse for all meshes
+    static int repeatMessageID = LogHandler::getInstance().newRepeatedMessageID();
 
-    int offset = 0;
     for (auto meshIter = _hfmModel->meshes.cbegin(); meshIter != _hfmModel->meshes.cend(); ++meshIter) {
         if (meshIter->blendshapes.isEmpty()) {
             blendedMeshSizes.push_back(0);
             continue;
         }
         int numVertsInMesh = meshIter->vertices.size();
-        blendedMeshSizes.push_back(numVertsInMesh);
-
-        // initialize offsets to zero
-        memset(unpackedBlendshapeOffsets.data(), 0, numVertsInMesh * sizeof(BlendshapeOffsetUnpacked));
-
-        // for each blendshape in this mesh, accumulate the offsets into unpackedBlendshapeOffsets.
-        const float NORMAL_COEFFICIENT_SCALE = 0.01f;
-        for (int i = 0, n = qMin(_blendshapeCoefficients.size(), meshIter->blendshapes.size()); i < n; i++) {
-            float vertexCoefficient = _blendshapeCoefficients.at(i);
-            const float EPSILON = 0.0001f;
-            if (vertexCoefficient < EPSILON) {
-                continue;
+        int numBlendshapes = std::min(meshIter->blendshapes.size(), (int)BLENDSHAPE_INDEX_MASK + 1);
+        if (numBlendshapes < meshIter->blendshapes.size()) {
+            HIFI_FCDEBUG_ID(renderutils(), repeatMessageID, "Model has more blendshapes than can be drawn:" << meshIter->blendshapes.size());
+        }
+
+        // the offsets of each vertex are together, following where they are and how many there are for every vertex
+        std::vector<int> nextVertexOffset(numVertsInMesh, 0);
+        for (int i = 0; i < numBlendshapes; i++) {
+            for (int index : meshIter->blendshapes.at(i).indices) {
+                if (index >= 0 && index < numVertsInMesh) {
+                    nextVertexOffset[index]++;
+                }
             }
+        }
 
-            float normalCoefficient = vertexCoefficient * NORMAL_COEFFICIENT_SCALE;
+        int meshStart = packedBlendshapeOffsets.size();
+        int meshSize = numVertsInMesh;
+        packedBlendshapeOffsets.resize(meshStart + numVertsInMesh);
+        for (int i = 0; i < numVertsInMesh; i++) {
+            int numVertexOffsets = nextVertexOffset[i];
+            packedBlendshapeOffsets[meshStart + i].packedPosNorTan = glm::uvec4(meshSize, numVertexOffsets, 0, 0);
+            nextVertexOffset[i] = meshSize;
+            meshSize += numVertexOffsets;
+        }
+        packedBlendshapeOffsets.resize(meshStart + meshSize);
+
+        auto meshOffsets = packedBlendshapeOffsets.data() + meshStart;
+        for (int i = 0; i < numBlendshapes; i++) {
             const HFMBlendshape& blendshape = meshIter->blendshapes.at(i);
             for (int j = 0; j < blendshape.indices.size(); ++j) {
                 int index = blendshape.indices.at(j);
-
-                auto& currentBlendshapeOffset = unpackedBlendshapeOffsets[index];
-                currentBlendshapeOffset.positionOffset += blendshape.vertices.at(j) * vertexCoefficient;
-                currentBlendshapeOffset.normalOffset += blendshape.normals.at(j) * normalCoefficient;
-                if (j < blendshape.tangents.size()) {
-                    currentBlendshapeOffset.tangentOffset += blendshape.tangents.at(j) * normalCoefficient;
+                if (index < 0 || index >= numVertsInMesh) {
+                    continue;
                 }
+
+                BlendshapeOffsetUnpacked unpacked;
+                unpacked.positionOffset = blendshape.vertices.at(j);
+                unpacked.normalOffset = j < blendshape.normals.size() ? blendshape.normals.at(j) : glm::vec3(0.0f);
+                unpacked.tangentOffset = j < blendshape.tangents.size() ? blendshape.tangents.at(j) : glm::vec3(0.0f);
+
+                auto& packed = meshOffsets[nextVertexOffset[index]++].packedPosNorTan;
+                packBlendshapeOffsetTo_Pos_F32_3xSN10_Nor_3xSN10_Tan_3xSN10(packed, unpacked);
+                packed.x = (packed.x & ~BLENDSHAPE_INDEX_MASK) | (uint32_t)i;
             }
         }
 
-        // convert unpackedBlendshapeOffsets into packedBlendshapeOffsets for the gpu.
-        auto unpacked = unpackedBlendshapeOffsets.data();
-        auto packed = packedBlendshapeOffsets.data() + offset;
-        packBlendshapeOffsets(unpacked, packed, numVertsInMesh);
-
-        offset += numVertsInMesh;
+        blendedMeshSizes.push_back(meshSize);
     }
-    Q_ASSERT(offset == numBlendshapeOffsets);
 
     // post the result to the ModelBlender, which will dispatch to the model if still alive
     QMetaObject::invokeMethod(DependencyManager::get<ModelBlender>().data(), "setBlendedVertices",
@@ -1948,7 +1962,7 @@ void Blender::run() {
 bool Model::maybeStartBlender() {
     if (isLoaded()) {
         QThreadPool::globalInstance()->start(new Blender(getThisPointer(), getGeometry()->getConstHFMModelPointer(),
-                                                         ++_blendNumber, _blendshapeCoefficients));
+                                                         ++_blendNumber));
         return true;
     }
     return false;
@@ -39,6 +39,7 @@
 #include "Rig.h"
 #include "PrimitiveMode.h"
 #include "BillboardMode.h"
+#include "SkinningBuffer.h"
 
 // Use dual quaternion skinning!
 // Must match define in Skinning.slh
@@ -420,6 +421,10 @@ protected:
     bool _forceOffset { false };
 
     std::vector<MeshState> _meshStates;
+    std::vector<SkinningBuffer::RangePointer> _clusterRanges; // by mesh, null for meshes that aren't skinned
+
+    // copies the clusters of the mesh state that the vertex shaders read to its range of the skinning buffer
+    void updateClusterRange(const MeshState& state, SkinningBuffer::RangePointer& range) const;
 
     virtual void initJointStates();
 
@@ -442,6 +447,7 @@ protected:
     BlendShapeOperator _modelBlendshapeOperator { nullptr };
     QVector<float> _blendshapeCoefficients;
     QVector<float> _blendedBlendshapeCoefficients;
+    bool _blendshapeOffsetsRequested { false };
     int _blendNumber { 0 };
 
     mutable QRecursiveMutex _mutex;
@@ -0,0 +1,100 @@
+//
+//  OcclusionDepthPass.cpp
+//  libraries/render-utils/src/
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "OcclusionDepthPass.h"
+
+#include <gpu/Context.h>
+#include <render/OcclusionStage.h>
+#include <shaders/Shaders.h>
+
+#include "render-utils/ShaderConstants.h"
+#include "OcclusionDepth_shared.slh"
+
+namespace ru {
+    using render_utils::slot::texture::Texture;
+}
+
+static const int MAX_FRAMES_READING = 30;
+
+const gpu::PipelinePointer& OcclusionDepthPass::getPipeline() {
+    if (!_pipeline) {
+        gpu::ShaderPointer program = gpu::Shader::createProgram(shader::render_utils::program::occlusion_makeDepth);
+
+        gpu::StatePointer state = std::make_shared<gpu::State>();
+        state->setColorWriteMask(true, false, false, false);
+
+        _pipeline = gpu::Pipeline::create(program, state);
+    }
+    return _pipeline;
+}
+
+void OcclusionDepthPass::run(const render::RenderContextPointer& renderContext, const Inputs& linearDepthFramebuffer) {
+    assert(renderContext->args);
+    RenderArgs* args = renderContext->args;
+
+    // the other views, and the stereo ones, aren't culled against it
+    auto occlusionStage = renderContext->_scene->getStage<render::OcclusionStage>();
+    if (!occlusionStage || !linearDepthFramebuffer || args->_renderMode != RenderArgs::DEFAULT_RENDER_MODE || args->isStereo()) {
+        return;
+    }
+
+    if (_isReading->load()) {
+        if (++_numFramesReading < MAX_FRAMES_READING) {
+            return;
+        }
+        _isReading->store(false);
+    }
+    _numFramesReading = 0;
+
+    static const glm::ivec2 OCCLUSION_DEPTH_SIZE(OCCLUSION_DEPTH_WIDTH, OCCLUSION_DEPTH_HEIGHT);
+    if (!_framebuffer) {
+        auto texture = gpu::Texture::createRenderBuffer(gpu::Element(gpu::SCALAR, gpu::FLOAT, gpu::RED),
+            OCCLUSION_DEPTH_SIZE.x, OCCLUSION_DEPTH_SIZE.y, gpu::Texture::SINGLE_MIP, gpu::Sampler(gpu::Sampler::FILTER_MIN_MAG_POINT));
+        _framebuffer = gpu::FramebufferPointer(gpu::Framebuffer::create("occlusionDepth"));
+        _framebuffer->setRenderBuffer(0, texture);
+    }
+
+    auto linearDepthTexture = linearDepthFramebuffer->getLinearDepthTexture();
+    auto pipeline = getPipeline();
+    auto framebuffer = _framebuffer;
+    auto context = args->_context;
+    auto isReading = _isReading;
+    std::weak_ptr<render::OcclusionStage> weakOcclusionStage = occlusionStage;
+    glm::mat4 view = glm::inverse(args->getViewFrustum().getView());
+    glm::mat4 projection = args->getViewFrustum().getProjection();
+    isReading->store(true);
+
+    gpu::doInBatch("OcclusionDepthPass::run", args->_context, [=](gpu::Batch& batch) {
+        PROFILE_RANGE_BATCH(batch, "OcclusionDepthPass");
+        batch.enableStereo(false);
+
+        batch.setViewportTransform(glm::ivec4(0, 0, OCCLUSION_DEPTH_SIZE.x, OCCLUSION_DEPTH_SIZE.y));
+        batch.setProjectionTransform(glm::mat4());
+        batch.resetViewTransform();
+        batch.setModelTransform(Transform());
+
+        batch.setFramebuffer(framebuffer);
+        batch.setPipeline(pipeline);
+        batch.setResourceTexture(ru::Texture::SurfaceGeometryDepth, linearDepthTexture);
+        batch.draw(gpu::TRIANGLE_STRIP, 4);
+        batch.setResourceTexture(ru::Texture::SurfaceGeometryDepth, nullptr);
+
+        batch.runLambda([=] {
+            context->readFramebufferAsync(framebuffer, glm::ivec4(0, 0, OCCLUSION_DEPTH_SIZE.x, OCCLUSION_DEPTH_SIZE.y),
+                [=](const std::vector<float>& depths) {
+                auto occlusionStage = weakOcclusionStage.lock();
+                if (occlusionStage) {
+                    occlusionStage->setDepth(std::make_shared<render::OcclusionDepth>(OCCLUSION_DEPTH_SIZE, depths, view, projection));
+                }
+                isReading->store(false);
+            });
+        });
+    });
+}
@@ -0,0 +1,40 @@
+//
+//  OcclusionDepthPass.h
+//  libraries/render-utils/src/
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_OcclusionDepthPass_h
+#define vircadia_OcclusionDepthPass_h
+
+#include <atomic>
+
+#include <render/Engine.h>
+
+#include "SurfaceGeometryPass.h"
+
+// Reduces the linear depth of the main view to a coarse grid of farthest depths, and reads it back without waiting on the
+// gpu, into the render::OcclusionStage that CullOccludedItems tests the items of the next frames against
+class OcclusionDepthPass {
+public:
+    using Inputs = LinearDepthFramebufferPointer;
+    using JobModel = render::Job::ModelI<OcclusionDepthPass, Inputs>;
+
+    void run(const render::RenderContextPointer& renderContext, const Inputs& linearDepthFramebuffer);
+
+private:
+    const gpu::PipelinePointer& getPipeline();
+
+    gpu::PipelinePointer _pipeline;
+    gpu::FramebufferPointer _framebuffer;
+
+    // only one read is in flight, it's given up on if a frame never got to it
+    std::shared_ptr<std::atomic<bool>> _isReading { std::make_shared<std::atomic<bool>>(false) };
+    int _numFramesReading { 0 };
+};
+
+#endif // vircadia_OcclusionDepthPass_h
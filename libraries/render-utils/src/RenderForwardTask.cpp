@@ -20,6 +20,7 @@
 #include <graphics/ShaderConstants.h>
 #include <render/ShapePipeline.h>
 
+#include <render/DrawTask.h>
 #include <render/FilterTask.h>
 
 #include "RenderHifi.h"
@@ -73,6 +74,7 @@ void RenderForwardTask::build(JobModel& task, const render::Varying& input, rend
     auto fadeEffect = DependencyManager::get<FadeEffect>();
     ShapePlumberPointer shapePlumber = std::make_shared<ShapePlumber>();
     initForwardPipelines(*shapePlumber);
+    task.addJob<WarmUpShapePipelines>("WarmUpShapePipelines", shapePlumber);
 
     // Unpack inputs
     const auto& inputs = input.get<Input>();
@@ -11,6 +11,8 @@
 
 #include "RenderShadowTask.h"
 
+#include <algorithm>
+
 #include <gpu/Context.h>
 
 #include <ViewFrustum.h>
@@ -55,6 +57,7 @@ void RenderShadowTask::build(JobModel& task, const render::Varying& input, rende
         auto fadeEffect = DependencyManager::get<FadeEffect>();
         initZPassPipelines(*shapePlumber, state, fadeEffect->getBatchSetter(), fadeEffect->getItemUniformSetter());
     }
+    task.addJob<WarmUpShapePipelines>("WarmUpShapePipelines", shapePlumber);
     const auto setupOutput = task.addJob<RenderShadowSetup>("ShadowSetup", input);
     const auto queryResolution = setupOutput.getN<RenderShadowSetup::Output>(1);
     const auto shadowFrame = setupOutput.getN<RenderShadowSetup::Output>(3);
@@ -203,6 +206,76 @@ static void adjustNearFar(const AABox& inShapeBounds, ViewFrustum& shadowFrustum
     }
 }
 
+void RenderShadowMap::configure(const Config& config) {
+    _cacheStatic = config.cacheStatic;
+    if (!_cacheStatic) {
+        _staticFramebuffer.reset();
+        _staticItems.clear();
+        _staticShapes.clear();
+        _dynamicShapes.clear();
+    }
+}
+
+void RenderShadowMap::drawShapes(const render::RenderContextPointer& renderContext, const render::ShapeBounds& inShapes) {
+    RenderArgs* args = renderContext->args;
+
+    const std::vector<ShapeKey::Builder> keys = {
+        ShapeKey::Builder(), ShapeKey::Builder().withFade(),
+        ShapeKey::Builder().withDeformed(), ShapeKey::Builder().withDeformed().withFade(),
+        ShapeKey::Builder().withDeformed().withDualQuatSkinned(), ShapeKey::Builder().withDeformed().withDualQuatSkinned().withFade(),
+        ShapeKey::Builder().withOwnPipeline(), ShapeKey::Builder().withOwnPipeline().withFade(),
+        ShapeKey::Builder().withDeformed().withOwnPipeline(), ShapeKey::Builder().withDeformed().withOwnPipeline().withFade(),
+        ShapeKey::Builder().withDeformed().withDualQuatSkinned().withOwnPipeline(), ShapeKey::Builder().withDeformed().withDualQuatSkinned().withOwnPipeline().withFade(),
+    };
+    std::vector<std::vector<ShapeKey>> sortedShapeKeys(keys.size());
+
+    const int OWN_PIPELINE_INDEX = 6;
+    for (const auto& items : inShapes) {
+        if (items.second.empty()) {
+            continue;
+        }
+        int index = items.first.hasOwnPipeline() ? OWN_PIPELINE_INDEX : 0;
+        if (items.first.isDeformed()) {
+            index += 2;
+            if (items.first.isDualQuatSkinned()) {
+                index += 2;
+            }
+        }
+
+        if (items.first.isFaded()) {
+            index += 1;
+        }
+
+        sortedShapeKeys[index].push_back(items.first);
+    }
+
+    // Render non-withOwnPipeline things
+    for (size_t i = 0; i < OWN_PIPELINE_INDEX; i++) {
+        auto& shapeKeys = sortedShapeKeys[i];
+        if (shapeKeys.size() > 0) {
+            const auto& shapePipeline = _shapePlumber->pickPipeline(args, keys[i]);
+            args->_shapePipeline = shapePipeline;
+            for (const auto& key : shapeKeys) {
+                renderShapes(renderContext, _shapePlumber, inShapes.at(key));
+            }
+        }
+    }
+
+    // Render withOwnPipeline things
+    for (size_t i = OWN_PIPELINE_INDEX; i < keys.size(); i++) {
+        auto& shapeKeys = sortedShapeKeys[i];
+        if (shapeKeys.size() > 0) {
+            args->_shapePipeline = nullptr;
+            for (const auto& key : shapeKeys) {
+                args->_itemShapeKey = key._flags.to_ulong();
+                renderShapes(renderContext, _shapePlumber, inShapes.at(key));
+            }
+        }
+    }
+
+    args->_shapePipeline = nullptr;
+}
+
 void RenderShadowMap::run(const render::RenderContextPointer& renderContext, const Inputs& inputs) {
     assert(renderContext->args);
     assert(renderContext->args->hasViewFrustum());
@@ -233,78 +306,109 @@ void RenderShadowMap::run(const render::RenderContextPointer& renderContext, con
     args->popViewFrustum();
     args->pushViewFrustum(adjustedShadowFrustum);
 
-    gpu::doInBatch("RenderShadowMap::run", args->_context, [&](gpu::Batch& batch) {
+    glm::mat4 projMat;
+    Transform viewMat;
+    args->getViewFrustum().evalProjectionMatrix(projMat);
+    args->getViewFrustum().evalViewTransform(viewMat);
+
+    // Split the casters between the cached ones and the ones rendered every frame
+    bool useStaticMap = _cacheStatic && !inShapeBounds.isNull();
+    bool isStaticMapValid = false;
+    if (useStaticMap) {
+        if (!_staticFramebuffer) {
+            auto depthFormat = gpu::Element(gpu::SCALAR, gpu::FLOAT, gpu::DEPTH);
+            auto depthTexture = gpu::Texture::createRenderBuffer(depthFormat, fbo->getWidth(), fbo->getHeight());
+            _staticFramebuffer = gpu::FramebufferPointer(gpu::Framebuffer::create("Shadowmap Static Cascade"));
+            _staticFramebuffer->setDepthBuffer(depthTexture, depthFormat);
+        } else {
+            isStaticMapValid = (projMat == _staticProjection) && (viewMat.getMatrix() == _staticView);
+        }
+
+        for (auto& items : _staticShapes) {
+            items.second.clear();
+        }
+        for (auto& items : _dynamicShapes) {
+            items.second.clear();
+        }
+
+        const auto& scene = renderContext->_scene;
+        uint32_t changeStamp = scene->getChangeStamp();
+        size_t numCachedItems = 0;
+        for (const auto& items : inShapes) {
+            // Animated, fading and procedural items can change without going through the scene
+            const auto& key = items.first;
+            bool canBeStatic = !key.isDeformed() && !key.isFaded() && !key.hasOwnPipeline();
+            for (const auto& item : items.second) {
+                uint32_t itemChangeStamp = scene->getItem(item.id).getChangeStamp();
+                bool isStatic = canBeStatic && (changeStamp - itemChangeStamp >= STATIC_CHANGE_STAMPS);
+                if (std::binary_search(_staticItems.begin(), _staticItems.end(), item.id)) {
+                    if (itemChangeStamp > _staticChangeStamp) {
+                        isStaticMapValid = false;
+                    } else {
+                        numCachedItems++;
+                    }
+                } else if (isStatic) {
+                    isStaticMapValid = false;
+                }
+                (isStatic ? _staticShapes : _dynamicShapes)[key].push_back(item);
+            }
+        }
+        if (numCachedItems != _staticItems.size()) {
+            isStaticMapValid = false;
+        }
+
+        if (!isStaticMapValid) {
+            _staticItems.clear();
+            for (const auto& items : _staticShapes) {
+                for (const auto& item : items.second) {
+                    _staticItems.push_back(item.id);
+                }
+            }
+            std::sort(_staticItems.begin(), _staticItems.end());
+            _staticChangeStamp = changeStamp;
+            _staticProjection = projMat;
+            _staticView = viewMat.getMatrix();
+        }
+    }
+
+    glm::ivec4 viewport{0, 0, fbo->getWidth(), fbo->getHeight()};
+    auto setupBatch = [&](gpu::Batch& batch) {
         args->_batch = &batch;
         batch.enableStereo(false);
 
-        glm::ivec4 viewport{0, 0, fbo->getWidth(), fbo->getHeight()};
         batch.setViewportTransform(viewport);
         batch.setStateScissorRect(viewport);
 
-        batch.setFramebuffer(fbo);
-        batch.clearDepthFramebuffer(1.0, false);
-
         if (!inShapeBounds.isNull()) {
-            glm::mat4 projMat;
-            Transform viewMat;
-            args->getViewFrustum().evalProjectionMatrix(projMat);
-            args->getViewFrustum().evalViewTransform(viewMat);
-
             batch.setProjectionTransform(projMat);
             batch.setViewTransform(viewMat, false);
+        }
+    };
 
-            const std::vector<ShapeKey::Builder> keys = {
-                ShapeKey::Builder(), ShapeKey::Builder().withFade(),
-                ShapeKey::Builder().withDeformed(), ShapeKey::Builder().withDeformed().withFade(),
-                ShapeKey::Builder().withDeformed().withDualQuatSkinned(), ShapeKey::Builder().withDeformed().withDualQuatSkinned().withFade(),
-                ShapeKey::Builder().withOwnPipeline(), ShapeKey::Builder().withOwnPipeline().withFade(),
-                ShapeKey::Builder().withDeformed().withOwnPipeline(), ShapeKey::Builder().withDeformed().withOwnPipeline().withFade(),
-                ShapeKey::Builder().withDeformed().withDualQuatSkinned().withOwnPipeline(), ShapeKey::Builder().withDeformed().withDualQuatSkinned().withOwnPipeline().withFade(),
-            };
-            std::vector<std::vector<ShapeKey>> sortedShapeKeys(keys.size());
-
-            const int OWN_PIPELINE_INDEX = 6;
-            for (const auto& items : inShapes) {
-                int index = items.first.hasOwnPipeline() ? OWN_PIPELINE_INDEX : 0;
-                if (items.first.isDeformed()) {
-                    index += 2;
-                    if (items.first.isDualQuatSkinned()) {
-                        index += 2;
-                    }
-                }
-
-                if (items.first.isFaded()) {
-                    index += 1;
-                }
-
-                sortedShapeKeys[index].push_back(items.first);
-            }
+    // The static map has a batch of its own, as the named calls of a batch are drawn at its end
+    if (useStaticMap && !isStaticMapValid) {
+        gpu::doInBatch("RenderShadowMap::run::static", args->_context, [&](gpu::Batch& batch) {
+            setupBatch(batch);
+            batch.setFramebuffer(_staticFramebuffer);
+            batch.clearDepthFramebuffer(1.0, false);
+            drawShapes(renderContext, _staticShapes);
+            args->_batch = nullptr;
+        });
+    }
 
-            // Render non-withOwnPipeline things
-            for (size_t i = 0; i < OWN_PIPELINE_INDEX; i++) {
-                auto& shapeKeys = sortedShapeKeys[i];
-                if (shapeKeys.size() > 0) {
-                    const auto& shapePipeline = _shapePlumber->pickPipeline(args, keys[i]);
-                    args->_shapePipeline = shapePipeline;
-                    for (const auto& key : shapeKeys) {
-                        renderShapes(renderContext, _shapePlumber, inShapes.at(key));
-                    }
-                }
-            }
+    gpu::doInBatch("RenderShadowMap::run", args->_context, [&](gpu::Batch& batch) {
+        setupBatch(batch);
 
-            // Render withOwnPipeline things
-            for (size_t i = OWN_PIPELINE_INDEX; i < keys.size(); i++) {
-                auto& shapeKeys = sortedShapeKeys[i];
-                if (shapeKeys.size() > 0) {
-                    args->_shapePipeline = nullptr;
-                    for (const auto& key : shapeKeys) {
-                        args->_itemShapeKey = key._flags.to_ulong();
-                        renderShapes(renderContext, _shapePlumber, inShapes.at(key));
-                    }
-                }
+        if (useStaticMap) {
+            batch.blit(_staticFramebuffer, viewport, fbo, viewport);
+            batch.setFramebuffer(fbo);
+            drawShapes(renderContext, _dynamicShapes);
+        } else {
+            batch.setFramebuffer(fbo);
+            batch.clearDepthFramebuffer(1.0, false);
+            if (!inShapeBounds.isNull()) {
+                drawShapes(renderContext, inShapes);
             }
-
-            args->_shapePipeline = nullptr;
         }
 
         args->_batch = nullptr;
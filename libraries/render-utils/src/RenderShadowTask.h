@@ -24,17 +24,46 @@
 
 class ViewFrustum;
 
+class RenderShadowMapConfig : public render::Job::Config {
+    Q_OBJECT
+    Q_PROPERTY(bool cacheStatic MEMBER cacheStatic NOTIFY dirty)
+public:
+    bool cacheStatic { true };
+
+signals:
+    void dirty();
+};
+
 class RenderShadowMap {
 public:
     using Inputs = render::VaryingSet3<render::ShapeBounds, AABox, LightStage::ShadowFramePointer>;
-    using JobModel = render::Job::ModelI<RenderShadowMap, Inputs>;
+    using Config = RenderShadowMapConfig;
+    using JobModel = render::Job::ModelI<RenderShadowMap, Inputs, Config>;
+
+    // The number of scene change stamps (frames) a caster has to stay unchanged for to be cached
+    static const uint32_t STATIC_CHANGE_STAMPS { 60 };
 
     RenderShadowMap(render::ShapePlumberPointer shapePlumber, unsigned int cascadeIndex) : _shapePlumber{ shapePlumber }, _cascadeIndex{ cascadeIndex } {}
+    void configure(const Config& config);
     void run(const render::RenderContextPointer& renderContext, const Inputs& inputs);
 
 protected:
     render::ShapePlumberPointer _shapePlumber;
     unsigned int _cascadeIndex;
+
+    // The casters that haven't changed for a while are rendered into a cached map, which is copied into the cascade each
+    // frame before the other casters are rendered on top.  The cache is redone when the cascade frustum changes, when one
+    // of its casters changes or goes away, or when another caster has been unchanged long enough to join it.
+    bool _cacheStatic { true };
+    gpu::FramebufferPointer _staticFramebuffer;
+    glm::mat4 _staticProjection;
+    glm::mat4 _staticView;
+    uint32_t _staticChangeStamp { 0 };
+    std::vector<render::ItemID> _staticItems; // sorted
+    render::ShapeBounds _staticShapes;
+    render::ShapeBounds _dynamicShapes;
+
+    void drawShapes(const render::RenderContextPointer& renderContext, const render::ShapeBounds& inShapes);
 };
 
 //class RenderShadowTaskConfig : public render::Task::Config::Persistent {
@@ -0,0 +1,87 @@
+//
+//  SkinningBuffer.cpp
+//  libraries/render-utils/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SkinningBuffer.h"
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+// uniform buffers can only be bound at multiples of GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, which is at most 256 bytes.
+// Ranges are a power of two blocks long, so that freed ones can be reused by meshes with a similar number of clusters.
+static const SkinningBuffer::Size BLOCK_SIZE = 256;
+static const SkinningBuffer::Size INITIAL_BUFFER_SIZE = 256 * 1024;
+
+namespace {
+
+class Pool {
+public:
+    std::mutex mutex;
+    gpu::BufferPointer buffer { std::make_shared<gpu::Buffer>() };
+    SkinningBuffer::Size end { 0 };
+    std::vector<std::vector<SkinningBuffer::Size>> freeOffsets; // by size class
+};
+
+// never destroyed, render items can still be letting go of their ranges as the application exits
+Pool& getPool() {
+    static Pool* pool = new Pool();
+    return *pool;
+}
+
+}
+
+SkinningBuffer::Range::~Range() {
+    auto& pool = getPool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.freeOffsets[_sizeClass].push_back(_offset);
+}
+
+void SkinningBuffer::Range::setData(const gpu::Byte* data) {
+    getPool().buffer->setSubData(_offset, _size, data);
+}
+
+void SkinningBuffer::Range::bind(gpu::Batch& batch, uint32_t slot) const {
+    batch.setUniformBuffer(slot, getPool().buffer, _offset, _size);
+}
+
+SkinningBuffer::RangePointer SkinningBuffer::allocate(Size size) {
+    int sizeClass = 0;
+    Size capacity = BLOCK_SIZE;
+    while (capacity < size) {
+        capacity *= 2;
+        sizeClass++;
+    }
+
+    auto& pool = getPool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    if ((int)pool.freeOffsets.size() <= sizeClass) {
+        pool.freeOffsets.resize(sizeClass + 1);
+    }
+
+    Size offset;
+    auto& freeOffsets = pool.freeOffsets[sizeClass];
+    if (!freeOffsets.empty()) {
+        offset = freeOffsets.back();
+        freeOffsets.pop_back();
+    } else {
+        offset = pool.end;
+        pool.end += capacity;
+        if (pool.end > pool.buffer->getSize()) {
+            // the ranges already bound keep their offsets, the buffer's contents are kept as it grows
+            Size bufferSize = std::max(pool.buffer->getSize(), INITIAL_BUFFER_SIZE);
+            while (bufferSize < pool.end) {
+                bufferSize *= 2;
+            }
+            pool.buffer->resize(bufferSize);
+        }
+    }
+
+    return RangePointer(new Range(offset, size, sizeClass));
+}
@@ -0,0 +1,51 @@
+//
+//  SkinningBuffer.h
+//  libraries/render-utils/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_SkinningBuffer_h
+#define vircadia_SkinningBuffer_h
+
+#include <memory>
+
+#include <gpu/Batch.h>
+#include <gpu/Buffer.h>
+
+// The cluster matrices or dual quaternions of every skinned mesh, in one uniform buffer rather than in a small buffer per
+// mesh part.  Each mesh has a range of the buffer, which its parts bind where the vertex shaders read the clusters.
+//
+// Ranges are allocated and updated on the main thread where the render items are updated, and freed whenever their last
+// owner lets go of them.
+class SkinningBuffer {
+public:
+    using Size = gpu::Buffer::Size;
+
+    class Range {
+    public:
+        ~Range();
+
+        Size getOffset() const { return _offset; }
+        Size getSize() const { return _size; }
+
+        void setData(const gpu::Byte* data);
+        void bind(gpu::Batch& batch, uint32_t slot) const;
+
+    private:
+        friend class SkinningBuffer;
+        Range(Size offset, Size size, int sizeClass) : _offset(offset), _size(size), _sizeClass(sizeClass) {}
+
+        Size _offset;
+        Size _size;
+        int _sizeClass;
+    };
+    using RangePointer = std::shared_ptr<Range>;
+
+    static RangePointer allocate(Size size);
+};
+
+#endif // vircadia_SkinningBuffer_h
@@ -15,8 +15,14 @@
 #include <gpu/Context.h>
 #include <shaders/Shaders.h>
 
+#include "render-utils/ShaderConstants.h"
+
 using namespace render;
 
+namespace ru {
+    using render_utils::slot::buffer::Buffer;
+}
+
 void PrepareStencil::configure(const Config& config) {
     _maskMode = config.maskMode;
 }
@@ -61,6 +67,24 @@ gpu::PipelinePointer PrepareStencil::getPaintStencilPipeline() {
     return _paintStencilPipeline;
 }
 
+gpu::PipelinePointer PrepareStencil::getFoveationStencilPipeline() {
+    if (!_foveationStencilPipeline) {
+        auto program = gpu::Shader::createProgram(shader::render_utils::program::stencil_drawFoveation);
+        auto state = std::make_shared<gpu::State>();
+        drawMask(*state);
+        state->setColorWriteMask(gpu::State::WRITE_NONE);
+
+        _foveationStencilPipeline = gpu::Pipeline::create(program, state);
+    }
+    return _foveationStencilPipeline;
+}
+
+bool PrepareStencil::isFoveated(const RenderArgs* args) {
+    // the forward renderer has no pass to fill the holes in
+    return args->_foveationRadius > 0.0f && args->isStereo() && args->_renderMode == RenderArgs::DEFAULT_RENDER_MODE &&
+        args->_renderMethod == RenderArgs::DEFERRED;
+}
+
 void PrepareStencil::run(const RenderContextPointer& renderContext, const gpu::FramebufferPointer& srcFramebuffer) {
     RenderArgs* args = renderContext->args;
 
@@ -85,7 +109,12 @@ void PrepareStencil::run(const RenderContextPointer& renderContext, const gpu::F
         maskOperator = args->_stencilMaskOperator;
     }
 
-    if (maskMode == StencilMaskMode::NONE || (maskMode == StencilMaskMode::MESH && !maskOperator)) {
+    if (maskMode == StencilMaskMode::MESH && !maskOperator) {
+        maskMode = StencilMaskMode::NONE;
+    }
+
+    bool isFoveated = PrepareStencil::isFoveated(args);
+    if (maskMode == StencilMaskMode::NONE && !isFoveated) {
         return;
     }
 
@@ -101,6 +130,16 @@ void PrepareStencil::run(const RenderContextPointer& renderContext, const gpu::F
             batch.setPipeline(getMeshStencilPipeline());
             maskOperator(batch);
         }
+
+        if (isFoveated) {
+            auto& parameters = _foveationParametersBuffer.edit();
+            parameters._centers = args->_foveationCenters;
+            parameters._radius = args->_foveationRadius;
+
+            batch.setPipeline(getFoveationStencilPipeline());
+            batch.setUniformBuffer(ru::Buffer::FoveationParams, _foveationParametersBuffer);
+            batch.draw(gpu::TRIANGLE_STRIP, 4);
+        }
     });
 }
 
@@ -152,3 +191,9 @@ void PrepareStencil::testMaskDrawShapeNoAA(gpu::State& state) {
     state.setStencilTest(true, STENCIL_SHAPE | STENCIL_NO_AA, gpu::State::StencilTest(STENCIL_MASK | STENCIL_SHAPE | STENCIL_NO_AA, STENCIL_MASK, gpu::NOT_EQUAL,
         gpu::State::STENCIL_OP_KEEP, gpu::State::STENCIL_OP_KEEP, gpu::State::STENCIL_OP_REPLACE));
 }
+
+// Pass if this area WAS marked as MASK or anything containing MASK
+void PrepareStencil::testMasked(gpu::State& state) {
+    state.setStencilTest(true, 0x00, gpu::State::StencilTest(STENCIL_MASK, STENCIL_MASK, gpu::EQUAL,
+        gpu::State::STENCIL_OP_KEEP, gpu::State::STENCIL_OP_KEEP, gpu::State::STENCIL_OP_KEEP));
+}
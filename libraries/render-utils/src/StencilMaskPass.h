@@ -13,6 +13,7 @@
 #define hifi_StencilMaskPass_h
 
 #include <render/Engine.h>
+#include <gpu/Buffer.h>
 #include <gpu/Pipeline.h>
 #include <graphics/Geometry.h>
 #include <StencilMaskMode.h>
@@ -57,6 +58,10 @@ public:
     static void testShape(gpu::State& state);
     static void testMaskDrawShape(gpu::State& state);
     static void testMaskDrawShapeNoAA(gpu::State& state);
+    static void testMasked(gpu::State& state);
+
+    // the periphery of the main stereo views is masked out in a checkerboard, see FoveationFill
+    static bool isFoveated(const RenderArgs* args);
 
 private:
     gpu::PipelinePointer _meshStencilPipeline;
@@ -65,6 +70,19 @@ private:
     gpu::PipelinePointer _paintStencilPipeline;
     gpu::PipelinePointer getPaintStencilPipeline();
 
+    gpu::PipelinePointer _foveationStencilPipeline;
+    gpu::PipelinePointer getFoveationStencilPipeline();
+
+    class FoveationParameters {
+    public:
+        glm::vec4 _centers { 0.0f };
+        float _radius { 0.0f };
+        float _spareA { 0.0f };
+        float _spareB { 0.0f };
+        float _spareC { 0.0f };
+    };
+    gpu::StructBuffer<FoveationParameters> _foveationParametersBuffer;
+
     graphics::MeshPointer _mesh;
     graphics::MeshPointer getMesh();
 
@@ -17,6 +17,7 @@
 #include "BloomStage.h"
 #include <render/TransitionStage.h>
 #include <render/HighlightStage.h>
+#include <render/OcclusionStage.h>
 #include "DeferredLightingEffect.h"
 
 void UpdateSceneTask::build(JobModel& task, const render::Varying& input, render::Varying& output) {
@@ -26,6 +27,7 @@ void UpdateSceneTask::build(JobModel& task, const render::Varying& input, render
     task.addJob<BloomStageSetup>("BloomStageSetup");
     task.addJob<render::TransitionStageSetup>("TransitionStageSetup");
     task.addJob<render::HighlightStageSetup>("HighlightStageSetup");
+    task.addJob<render::OcclusionStageSetup>("OcclusionStageSetup");
 
     task.addJob<DefaultLightingSetup>("DefaultLightingSetup");
 
@@ -92,9 +92,12 @@
 #define RENDER_UTILS_BUFFER_SSAO_DEBUG_PARAMS 3
 #define RENDER_UTILS_BUFFER_SSAO_BLUR_PARAMS 4
 #define RENDER_UTILS_BUFFER_SSAO_FRAME_PARAMS 5
+#define RENDER_UTILS_BUFFER_SSAO_TEMPORAL_PARAMS 6
 #define RENDER_UTILS_TEXTURE_SSAO_DEPTH 1
 #define RENDER_UTILS_TEXTURE_SSAO_NORMAL 2
 #define RENDER_UTILS_TEXTURE_SSAO_OCCLUSION 0
+#define RENDER_UTILS_TEXTURE_SSAO_HISTORY 3
+#define RENDER_UTILS_TEXTURE_SSAO_VELOCITY 4
 
 // Temporal anti-aliasing
 #define RENDER_UTILS_BUFFER_TAA_PARAMS 2
@@ -122,6 +125,10 @@
 #define RENDER_UTILS_BUFFER_BLOOM_PARAMS 1
 #define RENDER_UTILS_TEXTURE_BLOOM_COLOR 0
 
+// Foveation
+#define RENDER_UTILS_BUFFER_FOVEATION_PARAMS 0
+#define RENDER_UTILS_TEXTURE_FOVEATION_COLOR 0
+
 // SDF Text rendering
 #define RENDER_UTILS_TEXTURE_TEXT_FONT 0
 #define RENDER_UTILS_UNIFORM_TEXT_COLOR 0
@@ -152,6 +159,7 @@ enum Buffer {
     SsaoFrameParams = RENDER_UTILS_BUFFER_SSAO_FRAME_PARAMS,
     SsaoDebugParams = RENDER_UTILS_BUFFER_SSAO_DEBUG_PARAMS,
     SsaoBlurParams = RENDER_UTILS_BUFFER_SSAO_BLUR_PARAMS,
+    SsaoTemporalParams = RENDER_UTILS_BUFFER_SSAO_TEMPORAL_PARAMS,
     LightIndex = RENDER_UTILS_BUFFER_LIGHT_INDEX,
     TaaParams = RENDER_UTILS_BUFFER_TAA_PARAMS,
     HighlightParams = RENDER_UTILS_BUFFER_HIGHLIGHT_PARAMS,
@@ -160,6 +168,7 @@ enum Buffer {
     BlurParams = RENDER_UTILS_BUFFER_BLUR_PARAMS,
     BloomParams = RENDER_UTILS_BUFFER_BLOOM_PARAMS,
     ToneMappingParams = RENDER_UTILS_BUFFER_TM_PARAMS,
+    FoveationParams = RENDER_UTILS_BUFFER_FOVEATION_PARAMS,
     ShadowParams = RENDER_UTILS_BUFFER_SHADOW_PARAMS,
     DebugDeferredParams = RENDER_UTILS_BUFFER_DEBUG_DEFERRED_PARAMS,
 };
@@ -192,6 +201,8 @@ enum Texture {
     SsaoOcclusion = RENDER_UTILS_TEXTURE_SSAO_OCCLUSION,
     SsaoDepth = RENDER_UTILS_TEXTURE_SSAO_DEPTH,
     SsaoNormal = RENDER_UTILS_TEXTURE_SSAO_NORMAL,
+    SsaoHistory = RENDER_UTILS_TEXTURE_SSAO_HISTORY,
+    SsaoVelocity = RENDER_UTILS_TEXTURE_SSAO_VELOCITY,
     HighlightSceneDepth = RENDER_UTILS_TEXTURE_HIGHLIGHT_SCENE_DEPTH,
     HighlightDepth = RENDER_UTILS_TEXTURE_HIGHLIGHT_DEPTH,
     SurfaceGeometryDepth = RENDER_UTILS_TEXTURE_SG_DEPTH,
@@ -200,6 +211,7 @@ enum Texture {
     BlurDepth = RENDER_UTILS_TEXTURE_BLUR_DEPTH,
     BloomColor = RENDER_UTILS_TEXTURE_BLOOM_COLOR,
     ToneMappingColor = RENDER_UTILS_TEXTURE_TM_COLOR,
+    FoveationColor = RENDER_UTILS_TEXTURE_FOVEATION_COLOR,
     TextFont = RENDER_UTILS_TEXTURE_TEXT_FONT,
     AmbientFresnel = RENDER_UTILS_TEXTURE_AMBIENT_FRESNEL,
     DebugTexture0 = RENDER_UTILS_DEBUG_TEXTURE0,
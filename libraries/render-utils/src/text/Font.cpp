@@ -20,7 +20,9 @@
 static std::mutex fontMutex;
 
 std::map<std::tuple<bool, bool, bool>, gpu::PipelinePointer> Font::_pipelines;
+std::map<bool, gpu::PipelinePointer> Font::_instancedPipelines;
 gpu::Stream::FormatPointer Font::_format;
+gpu::Stream::FormatPointer Font::_instancedFormat;
 
 struct TextureVertex {
     glm::vec2 pos;
@@ -34,39 +36,67 @@ static const int NUMBER_OF_INDICES_PER_QUAD = 6;  // 1 quad = 2 triangles
 static const int VERTICES_PER_QUAD = 4;           // 1 quad = 4 vertices (must match value in sdf_text3D.slv)
 const float DOUBLE_MAX_OFFSET_PIXELS = 20.0f;     // must match value in sdf_text3D.slh
 
+static const size_t MAX_CACHED_LAYOUTS = 1024;
+
+// the named buffers of the instanced text draws
+static const uint8_t GLYPHS_BUFFER = 0;
+static const uint8_t PARAMS_BUFFER = 1;
+
+static Font::GlyphQuad makeGlyphQuad(const Glyph& glyph, const glm::vec2& offset, float scale, bool enlargeForShadows) {
+    glm::vec2 min = offset + glm::vec2(glyph.offset.x, glyph.offset.y - glyph.size.y);
+    glm::vec2 size = glyph.size;
+    glm::vec2 texMin = glyph.texOffset;
+    glm::vec2 texSize = glyph.texSize;
+
+    // We need the pre-adjustment bounds for clamping
+    glm::vec4 bounds = glm::vec4(texMin, texSize);
+    if (enlargeForShadows) {
+        glm::vec2 imageSize = glyph.size / glyph.texSize;
+        glm::vec2 sizeDelta = 0.5f * DOUBLE_MAX_OFFSET_PIXELS * scale * imageSize;
+        glm::vec2 oldSize = size;
+        size += sizeDelta;
+        min.y -= sizeDelta.y;
+
+        texSize = texSize * (size / oldSize);
+    }
+
+    return { glm::vec4(min, size), glm::vec4(texMin, texSize), bounds };
+}
+
 struct QuadBuilder {
     TextureVertex vertices[VERTICES_PER_QUAD];
 
-    QuadBuilder(const Glyph& glyph, const glm::vec2& offset, float scale, bool enlargeForShadows) {
-        glm::vec2 min = offset + glm::vec2(glyph.offset.x, glyph.offset.y - glyph.size.y);
-        glm::vec2 size = glyph.size;
-        glm::vec2 texMin = glyph.texOffset;
-        glm::vec2 texSize = glyph.texSize;
-
-        // We need the pre-adjustment bounds for clamping
-        glm::vec4 bounds = glm::vec4(texMin, texSize);
-        if (enlargeForShadows) {
-            glm::vec2 imageSize = glyph.size / glyph.texSize;
-            glm::vec2 sizeDelta = 0.5f * DOUBLE_MAX_OFFSET_PIXELS * scale * imageSize;
-            glm::vec2 oldSize = size;
-            size += sizeDelta;
-            min.y -= sizeDelta.y;
-
-            texSize = texSize * (size / oldSize);
-        }
+    QuadBuilder(const Font::GlyphQuad& quad) {
+        glm::vec2 min = glm::vec2(quad.rect);
+        glm::vec2 size = glm::vec2(quad.rect.z, quad.rect.w);
+        glm::vec2 texMin = glm::vec2(quad.texRect);
+        glm::vec2 texSize = glm::vec2(quad.texRect.z, quad.texRect.w);
 
         // min = bottomLeft
         vertices[0] = TextureVertex(min,
-                                    texMin + glm::vec2(0.0f, texSize.y), bounds);
+                                    texMin + glm::vec2(0.0f, texSize.y), quad.bounds);
         vertices[1] = TextureVertex(min + glm::vec2(size.x, 0.0f),
-                                    texMin + texSize, bounds);
+                                    texMin + texSize, quad.bounds);
         vertices[2] = TextureVertex(min + glm::vec2(0.0f, size.y),
-                                    texMin, bounds);
+                                    texMin, quad.bounds);
         vertices[3] = TextureVertex(min + size,
-                                    texMin + glm::vec2(texSize.x, 0.0f), bounds);
+                                    texMin + glm::vec2(texSize.x, 0.0f), quad.bounds);
     }
 };
 
+size_t Font::LayoutKeyHash::operator()(const LayoutKey& key) const {
+    size_t hash = qHash(key.str);
+    auto combine = [&hash](size_t value) {
+        hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    };
+    combine(std::hash<float>()(key.origin.x));
+    combine(std::hash<float>()(key.origin.y));
+    combine(std::hash<float>()(key.bounds.x));
+    combine(std::hash<float>()(key.bounds.y));
+    combine((size_t)key.alignment);
+    return hash;
+}
+
 Font::Pointer Font::load(QIODevice& fontFile) {
     Pointer font = std::make_shared<Font>();
     font->read(fontFile);
@@ -235,6 +265,7 @@ void Font::read(QIODevice& in) {
     }
 
     _glyphs.clear();
+    _layouts.clear();
     glm::vec2 imageSize = toGlm(image.size());
     foreach(Glyph g, glyphs) {
         // Adjust the pixel texture coordinates into UV coordinates,
@@ -287,42 +318,57 @@ void Font::setupGPU() {
             _pipelines[std::make_tuple(std::get<0>(key), std::get<1>(key), std::get<2>(key))] = gpu::Pipeline::create(gpu::Shader::createProgram(std::get<3>(key)), state);
         }
 
+        static const std::vector<std::tuple<bool, uint32_t>> instancedKeys = {
+            std::make_tuple(false, sdf_text3D_instanced), std::make_tuple(true, sdf_text3D_instanced_unlit)
+        };
+        for (auto& key : instancedKeys) {
+            auto state = std::make_shared<gpu::State>();
+            state->setCullMode(gpu::State::CULL_BACK);
+            state->setDepthTest(true, true, gpu::LESS_EQUAL);
+            state->setBlendFunction(false,
+                gpu::State::SRC_ALPHA, gpu::State::BLEND_OP_ADD, gpu::State::INV_SRC_ALPHA,
+                gpu::State::FACTOR_ALPHA, gpu::State::BLEND_OP_ADD, gpu::State::ONE);
+            PrepareStencil::testMaskDrawShape(*state);
+            _instancedPipelines[std::get<0>(key)] = gpu::Pipeline::create(gpu::Shader::createProgram(std::get<1>(key)), state);
+        }
+
         // Sanity checks
         static const int TEX_COORD_OFFSET = offsetof(TextureVertex, tex);
         static const int TEX_BOUNDS_OFFSET = offsetof(TextureVertex, bounds);
         assert(TEX_COORD_OFFSET == sizeof(glm::vec2));
         assert(sizeof(TextureVertex) == 2 * sizeof(glm::vec2) + sizeof(glm::vec4));
         assert(sizeof(QuadBuilder) == 4 * sizeof(TextureVertex));
+        assert(sizeof(GlyphQuad) == 3 * sizeof(glm::vec4));
 
         // Setup rendering structures
         _format = std::make_shared<gpu::Stream::Format>();
         _format->setAttribute(gpu::Stream::POSITION, 0, gpu::Element(gpu::VEC2, gpu::FLOAT, gpu::XYZ), 0);
         _format->setAttribute(gpu::Stream::TEXCOORD, 0, gpu::Element(gpu::VEC2, gpu::FLOAT, gpu::UV), TEX_COORD_OFFSET);
         _format->setAttribute(gpu::Stream::TEXCOORD1, 0, gpu::Element(gpu::VEC4, gpu::FLOAT, gpu::XYZW), TEX_BOUNDS_OFFSET);
+
+        // One instance per glyph
+        _instancedFormat = std::make_shared<gpu::Stream::Format>();
+        _instancedFormat->setAttribute(gpu::Stream::POSITION, 0, gpu::Element(gpu::VEC4, gpu::FLOAT, gpu::XYZW),
+                                       offsetof(GlyphQuad, rect), gpu::Stream::PER_INSTANCE);
+        _instancedFormat->setAttribute(gpu::Stream::TEXCOORD, 0, gpu::Element(gpu::VEC4, gpu::FLOAT, gpu::XYZW),
+                                       offsetof(GlyphQuad, texRect), gpu::Stream::PER_INSTANCE);
+        _instancedFormat->setAttribute(gpu::Stream::TEXCOORD1, 0, gpu::Element(gpu::VEC4, gpu::FLOAT, gpu::XYZW),
+                                       offsetof(GlyphQuad, bounds), gpu::Stream::PER_INSTANCE);
     }
 }
 
-inline QuadBuilder adjustedQuadBuilderForAlignmentMode(const Glyph& glyph, glm::vec2 advance, float scale, float enlargeForShadows,
-                                                TextAlignment alignment, float rightSpacing) {
+inline Font::GlyphQuad adjustedGlyphQuadForAlignmentMode(const Glyph& glyph, glm::vec2 advance, float scale, float enlargeForShadows,
+                                                          TextAlignment alignment, float rightSpacing) {
     if (alignment == TextAlignment::RIGHT) {
         advance.x += rightSpacing;
     } else if (alignment == TextAlignment::CENTER) {
         advance.x += 0.5f * rightSpacing;
     }
-    return QuadBuilder(glyph, advance, scale, enlargeForShadows);
+    return makeGlyphQuad(glyph, advance, scale, enlargeForShadows);
 }
 
-void Font::buildVertices(Font::DrawInfo& drawInfo, const QString& str, const glm::vec2& origin, const glm::vec2& bounds, float scale, bool enlargeForShadows,
-                         TextAlignment alignment) {
-    drawInfo.verticesBuffer = std::make_shared<gpu::Buffer>();
-    drawInfo.indicesBuffer = std::make_shared<gpu::Buffer>();
-    drawInfo.indexCount = 0;
-    int numVertices = 0;
-
-    drawInfo.string = str;
-    drawInfo.bounds = bounds;
-    drawInfo.origin = origin;
-
+void Font::layoutGlyphs(std::vector<GlyphQuad>& quads, const QString& str, const glm::vec2& origin, const glm::vec2& bounds, float scale,
+                        bool enlargeForShadows, TextAlignment alignment) {
     float enlargedBoundsX = bounds.x - 0.5f * DOUBLE_MAX_OFFSET_PIXELS * float(enlargeForShadows);
     float rightEdge = origin.x + enlargedBoundsX;
 
@@ -371,15 +417,15 @@ void Font::buildVertices(Font::DrawInfo& drawInfo, const QString& str, const glm
         }
     }
 
-    std::vector<QuadBuilder> quadBuilders;
-    quadBuilders.reserve(glyphsAndCorners.size());
+    std::vector<GlyphQuad> glyphQuads;
+    glyphQuads.reserve(glyphsAndCorners.size());
     {
         int i = glyphsAndCorners.size() - 1;
         while (i >= 0) {
             auto nextGlyphAndCorner = glyphsAndCorners[i];
             float rightSpacing = rightEdge - (nextGlyphAndCorner.second.x + nextGlyphAndCorner.first.d);
-            quadBuilders.push_back(adjustedQuadBuilderForAlignmentMode(nextGlyphAndCorner.first, nextGlyphAndCorner.second, scale, enlargeForShadows,
-                                                                       alignment, rightSpacing));
+            glyphQuads.push_back(adjustedGlyphQuadForAlignmentMode(nextGlyphAndCorner.first, nextGlyphAndCorner.second, scale, enlargeForShadows,
+                                                                   alignment, rightSpacing));
             i--;
             while (i >= 0) {
                 auto prevGlyphAndCorner = glyphsAndCorners[i];
@@ -389,8 +435,8 @@ void Font::buildVertices(Font::DrawInfo& drawInfo, const QString& str, const glm
                     break;
                 }
 
-                quadBuilders.push_back(adjustedQuadBuilderForAlignmentMode(prevGlyphAndCorner.first, prevGlyphAndCorner.second, scale, enlargeForShadows,
-                                                                           alignment, rightSpacing));
+                glyphQuads.push_back(adjustedGlyphQuadForAlignmentMode(prevGlyphAndCorner.first, prevGlyphAndCorner.second, scale, enlargeForShadows,
+                                                                       alignment, rightSpacing));
 
                 nextGlyphAndCorner = prevGlyphAndCorner;
                 i--;
@@ -398,10 +444,27 @@ void Font::buildVertices(Font::DrawInfo& drawInfo, const QString& str, const glm
         }
     }
 
-    // The quadBuilders is backwards now because we looped over the glyphs backwards to adjust their alignment
-    for (int i = quadBuilders.size() - 1; i >= 0; i--) {
+    // The glyphQuads is backwards now because we looped over the glyphs backwards to adjust their alignment
+    quads.assign(glyphQuads.rbegin(), glyphQuads.rend());
+}
+
+void Font::buildVertices(Font::DrawInfo& drawInfo, const QString& str, const glm::vec2& origin, const glm::vec2& bounds, float scale, bool enlargeForShadows,
+                         TextAlignment alignment) {
+    drawInfo.verticesBuffer = std::make_shared<gpu::Buffer>();
+    drawInfo.indicesBuffer = std::make_shared<gpu::Buffer>();
+    drawInfo.indexCount = 0;
+    int numVertices = 0;
+
+    drawInfo.string = str;
+    drawInfo.bounds = bounds;
+    drawInfo.origin = origin;
+
+    std::vector<GlyphQuad> quads;
+    layoutGlyphs(quads, str, origin, bounds, scale, enlargeForShadows, alignment);
+
+    for (const auto& quad : quads) {
         quint16 verticesOffset = numVertices;
-        drawInfo.verticesBuffer->append(quadBuilders[i]);
+        drawInfo.verticesBuffer->append(QuadBuilder(quad));
         numVertices += VERTICES_PER_QUAD;
 
         // Sam's recommended triangle slices
@@ -433,6 +496,19 @@ void Font::buildVertices(Font::DrawInfo& drawInfo, const QString& str, const glm
     }
 }
 
+const std::vector<Font::GlyphQuad>& Font::getLayout(const QString& str, const glm::vec2& origin, const glm::vec2& bounds, TextAlignment alignment) {
+    LayoutKey key { str, origin, bounds, alignment };
+    auto it = _layouts.find(key);
+    if (it == _layouts.end()) {
+        if (_layouts.size() >= MAX_CACHED_LAYOUTS) {
+            _layouts.clear();
+        }
+        it = _layouts.emplace(key, std::vector<GlyphQuad>()).first;
+        layoutGlyphs(it->second, str, origin, bounds, 1.0f, false, alignment);
+    }
+    return it->second;
+}
+
 void Font::drawString(gpu::Batch& batch, Font::DrawInfo& drawInfo, const QString& str, const glm::vec4& color,
                       const glm::vec3& effectColor, float effectThickness, TextEffect effect, TextAlignment alignment,
                       const glm::vec2& origin, const glm::vec2& bounds, float scale, bool unlit, bool forward) {
@@ -443,6 +519,45 @@ void Font::drawString(gpu::Batch& batch, Font::DrawInfo& drawInfo, const QString
     int textEffect = (int)effect;
     const int SHADOW_EFFECT = (int)TextEffect::SHADOW_EFFECT;
 
+    // Opaque deferred text is drawn with all the other such text of the font and parameters, in one instanced draw of
+    // its glyphs at the end of the batch.  Shadowed text offsets each of its glyphs, so it's drawn on its own.
+    if (!forward && color.a >= 1.0f && textEffect != SHADOW_EFFECT) {
+        const auto& quads = getLayout(str, origin, bounds, alignment);
+        if (quads.empty()) {
+            return;
+        }
+
+        setupGPU();
+
+        // need the gamma corrected color here
+        DrawParams gpuDrawParams;
+        gpuDrawParams.color = ColorUtils::sRGBToLinearVec4(color);
+        gpuDrawParams.effectColor = ColorUtils::sRGBToLinearVec3(effectColor);
+        gpuDrawParams.effectThickness = effectThickness;
+        gpuDrawParams.effect = textEffect;
+        gpuDrawParams._spare = vec3(0.0f);
+
+        std::string instanceName = "sdf_text_" + std::to_string(reinterpret_cast<uintptr_t>(this)) + (unlit ? "_unlit_" : "_");
+        instanceName.append(reinterpret_cast<const char*>(&gpuDrawParams), sizeof(DrawParams));
+
+        if (!batch.hasNamedCallsFunction(instanceName)) {
+            batch.getNamedBuffer(instanceName, PARAMS_BUFFER)->setData(sizeof(DrawParams), (const gpu::Byte*)&gpuDrawParams);
+        }
+        batch.getNamedBuffer(instanceName, GLYPHS_BUFFER)->append(quads);
+
+        auto pipeline = _instancedPipelines[unlit];
+        auto texture = _texture;
+        batch.setupNamedCalls(instanceName, quads.size(), [pipeline, texture](gpu::Batch& batch, gpu::Batch::NamedBatchData& data) {
+            batch.setPipeline(pipeline);
+            batch.setInputFormat(_instancedFormat);
+            batch.setInputBuffer(0, data.buffers[GLYPHS_BUFFER], 0, sizeof(GlyphQuad));
+            batch.setResourceTexture(render_utils::slot::texture::TextFont, texture);
+            batch.setUniformBuffer(0, data.buffers[PARAMS_BUFFER], 0, sizeof(DrawParams));
+            batch.drawInstanced((gpu::uint32)data.count(), gpu::TRIANGLE_STRIP, VERTICES_PER_QUAD);
+        });
+        return;
+    }
+
     // If we're switching to or from shadow effect mode, we need to rebuild the vertices
     if (str != drawInfo.string || bounds != drawInfo.bounds || origin != drawInfo.origin || alignment != _alignment ||
             (drawInfo.params.effect != textEffect && (textEffect == SHADOW_EFFECT || drawInfo.params.effect == SHADOW_EFFECT)) ||
@@ -10,6 +10,8 @@
 #ifndef hifi_Font_h
 #define hifi_Font_h
 
+#include <unordered_map>
+
 #include <QObject>
 
 #include "Glyph.h"
@@ -54,6 +56,13 @@ public:
         DrawParams params;
     };
 
+    // A laid out glyph, as one quad
+    struct GlyphQuad {
+        glm::vec4 rect; // bottom left corner and size
+        glm::vec4 texRect; // texture offset and size
+        glm::vec4 bounds; // the glyph in the texture, before the quad is enlarged for shadows
+    };
+
     glm::vec2 computeExtent(const QString& str) const;
     float getFontSize() const { return _fontSize; }
 
@@ -77,8 +86,11 @@ private:
     glm::vec2 computeTokenExtent(const QString& str) const;
 
     const Glyph& getGlyph(const QChar& c) const;
+    void layoutGlyphs(std::vector<GlyphQuad>& quads, const QString& str, const glm::vec2& origin, const glm::vec2& bounds, float scale,
+                      bool enlargeForShadows, TextAlignment alignment);
     void buildVertices(DrawInfo& drawInfo, const QString& str, const glm::vec2& origin, const glm::vec2& bounds, float scale, bool enlargeForShadows,
                        TextAlignment alignment);
+    const std::vector<GlyphQuad>& getLayout(const QString& str, const glm::vec2& origin, const glm::vec2& bounds, TextAlignment alignment);
 
     void setupGPU();
 
@@ -105,8 +117,26 @@ private:
     gpu::TexturePointer _texture;
     gpu::BufferStreamPointer _stream;
 
+    // The layouts of the strings drawn lately without a shadow effect, they don't depend on the scale then
+    struct LayoutKey {
+        QString str;
+        glm::vec2 origin;
+        glm::vec2 bounds;
+        TextAlignment alignment;
+
+        bool operator==(const LayoutKey& other) const {
+            return str == other.str && origin == other.origin && bounds == other.bounds && alignment == other.alignment;
+        }
+    };
+    struct LayoutKeyHash {
+        size_t operator()(const LayoutKey& key) const;
+    };
+    std::unordered_map<LayoutKey, std::vector<GlyphQuad>, LayoutKeyHash> _layouts;
+
     static std::map<std::tuple<bool, bool, bool>, gpu::PipelinePointer> _pipelines;
+    static std::map<bool, gpu::PipelinePointer> _instancedPipelines;
     static gpu::Stream::FormatPointer _format;
+    static gpu::Stream::FormatPointer _instancedFormat;
 };
 
 #endif
@@ -143,6 +143,11 @@ namespace render {
         bool _takingSnapshot { false };
         StencilMaskMode _stencilMaskMode { StencilMaskMode::NONE };
         std::function<void(gpu::Batch&)> _stencilMaskOperator;
+
+        // the foveation of the stereo views, see DisplayPlugin::getFoveationRadius, with the left eye center in xy and
+        // the right one in zw
+        float _foveationRadius { 0.0f };
+        glm::vec4 _foveationCenters { 0.0f };
     };
 
 }
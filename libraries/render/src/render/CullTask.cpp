@@ -16,9 +16,13 @@
 
 #include <PerfStat.h>
 #include <OctreeUtils.h>
+#include <TBBHelpers.h>
 
 using namespace render;
 
+// below this many items a list is culled on the calling thread, that's faster than handing it out
+static const size_t CULL_ITEMS_PER_CHUNK = 512;
+
 std::unordered_set<QUuid> CullTest::_containingZones = std::unordered_set<QUuid>();
 std::unordered_set<QUuid> CullTest::_prevContainingZones = std::unordered_set<QUuid>();
 
@@ -167,8 +171,6 @@ void CullSpatialSelection::run(const RenderContextPointer& renderContext,
         args->pushViewFrustum(_frozenFrustum); // replace the true view frustum by the frozen one
     }
 
-    CullTest test(_cullFunctor, args, details);
-
     // Now we have a selection of items to render
     outItems.clear();
     outItems.reserve(inSelection.numItems());
@@ -181,134 +183,75 @@ void CullSpatialSelection::run(const RenderContextPointer& renderContext,
         // filter individually against the _filter
         // visibility cull if partially selected ( octree cell contianing it was partial)
         // distance cull if was a subcell item ( octree cell is way bigger than the item bound itself, so now need to test per item)
-        if (_skipCulling || _overrideSkipCulling) {
-            // inside & fit items: filter only, culling is disabled
-            {
-                PerformanceTimer perfTimer("insideFitItems");
-                for (auto id : inSelection.insideItems) {
+        //
+        // Long lists are split into chunks that are culled in parallel, each into its own list and details, which are
+        // then appended in order so that the output is the same as it would be culled on one thread.
+        auto cullItems = [&](const ItemIDs& ids, bool frustumCull, bool solidAngleCull) {
+            auto cullRange = [&](size_t begin, size_t end, ItemBounds& chunkItems, RenderDetails::Item& chunkDetails) {
+                CullTest test(_cullFunctor, args, chunkDetails);
+                for (size_t i = begin; i < end; ++i) {
+                    auto id = ids[i];
                     auto& item = scene->getItem(id);
                     if (filter.test(item.getKey()) && test.zoneOcclusionTest(item)) {
                         ItemBound itemBound(id, item.getBound(args));
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene), args);
+                        if ((!frustumCull || test.frustumTest(itemBound.bound)) &&
+                            (!solidAngleCull || test.solidAngleTest(itemBound.bound))) {
+                            chunkItems.emplace_back(itemBound);
+                            if (item.getKey().isMetaCullGroup()) {
+                                item.fetchMetaSubItemBounds(chunkItems, (*scene), args);
+                            }
                         }
                     }
                 }
-            }
+            };
 
-            // inside & subcell items: filter only, culling is disabled
-            {
-                PerformanceTimer perfTimer("insideSmallItems");
-                for (auto id : inSelection.insideSubcellItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey()) && test.zoneOcclusionTest(item)) {
-                        ItemBound itemBound(id, item.getBound(args));
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene), args);
-                        }
-                    }
-                }
+            size_t numIDs = ids.size();
+            size_t numChunks = (numIDs + CULL_ITEMS_PER_CHUNK - 1) / CULL_ITEMS_PER_CHUNK;
+            if (numChunks < 2) {
+                cullRange(0, numIDs, outItems, details);
+                return;
             }
 
-            // partial & fit items: filter only, culling is disabled
-            {
-                PerformanceTimer perfTimer("partialFitItems");
-                for (auto id : inSelection.partialItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey()) && test.zoneOcclusionTest(item)) {
-                        ItemBound itemBound(id, item.getBound(args));
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene), args);
-                        }
-                    }
+            std::vector<ItemBounds> chunkItems(numChunks);
+            std::vector<RenderDetails::Item> chunkDetails(numChunks);
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, numChunks), [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t chunk = range.begin(); chunk != range.end(); ++chunk) {
+                    size_t end = std::min((chunk + 1) * CULL_ITEMS_PER_CHUNK, numIDs);
+                    cullRange(chunk * CULL_ITEMS_PER_CHUNK, end, chunkItems[chunk], chunkDetails[chunk]);
                 }
-            }
+            });
 
-            // partial & subcell items: filter only, culling is disabled
-            {
-                PerformanceTimer perfTimer("partialSmallItems");
-                for (auto id : inSelection.partialSubcellItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey()) && test.zoneOcclusionTest(item)) {
-                        ItemBound itemBound(id, item.getBound(args));
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene), args);
-                        }
-                    }
-                }
+            for (size_t chunk = 0; chunk < numChunks; ++chunk) {
+                outItems.insert(outItems.end(), chunkItems[chunk].begin(), chunkItems[chunk].end());
+                details._outOfView += chunkDetails[chunk]._outOfView;
+                details._tooSmall += chunkDetails[chunk]._tooSmall;
             }
+        };
 
-        } else {
+        bool skipCulling = _skipCulling || _overrideSkipCulling;
 
-            // inside & fit items: easy, just filter
-            {
-                PerformanceTimer perfTimer("insideFitItems");
-                for (auto id : inSelection.insideItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey()) && test.zoneOcclusionTest(item)) {
-                        ItemBound itemBound(id, item.getBound(args));
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene), args);
-                        }
-                    }
-                }
-            }
+        // inside & fit items: easy, just filter
+        {
+            PerformanceTimer perfTimer("insideFitItems");
+            cullItems(inSelection.insideItems, false, false);
+        }
 
-            // inside & subcell items: filter & distance cull
-            {
-                PerformanceTimer perfTimer("insideSmallItems");
-                for (auto id : inSelection.insideSubcellItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey()) && test.zoneOcclusionTest(item)) {
-                        ItemBound itemBound(id, item.getBound(args));
-                        if (test.solidAngleTest(itemBound.bound)) {
-                            outItems.emplace_back(itemBound);
-                            if (item.getKey().isMetaCullGroup()) {
-                                item.fetchMetaSubItemBounds(outItems, (*scene), args);
-                            }
-                        }
-                    }
-                }
-            }
+        // inside & subcell items: filter & distance cull
+        {
+            PerformanceTimer perfTimer("insideSmallItems");
+            cullItems(inSelection.insideSubcellItems, false, !skipCulling);
+        }
 
-            // partial & fit items: filter & frustum cull
-            {
-                PerformanceTimer perfTimer("partialFitItems");
-                for (auto id : inSelection.partialItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey()) && test.zoneOcclusionTest(item)) {
-                        ItemBound itemBound(id, item.getBound(args));
-                        if (test.frustumTest(itemBound.bound)) {
-                            outItems.emplace_back(itemBound);
-                            if (item.getKey().isMetaCullGroup()) {
-                                item.fetchMetaSubItemBounds(outItems, (*scene), args);
-                            }
-                        }
-                    }
-                }
-            }
+        // partial & fit items: filter & frustum cull
+        {
+            PerformanceTimer perfTimer("partialFitItems");
+            cullItems(inSelection.partialItems, !skipCulling, false);
+        }
 
-            // partial & subcell items:: filter & frutum cull & solidangle cull
-            {
-                PerformanceTimer perfTimer("partialSmallItems");
-                for (auto id : inSelection.partialSubcellItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey()) && test.zoneOcclusionTest(item)) {
-                        ItemBound itemBound(id, item.getBound(args));
-                        if (test.frustumTest(itemBound.bound) && test.solidAngleTest(itemBound.bound)) {
-                            outItems.emplace_back(itemBound);
-                            if (item.getKey().isMetaCullGroup()) {
-                                item.fetchMetaSubItemBounds(outItems, (*scene), args);
-                            }
-                        }
-                    }
-                }
-            }
+        // partial & subcell items:: filter & frutum cull & solidangle cull
+        {
+            PerformanceTimer perfTimer("partialSmallItems");
+            cullItems(inSelection.partialSubcellItems, !skipCulling, !skipCulling);
         }
     }
 
@@ -415,6 +358,41 @@ void ApplyCullFunctorOnItemBounds::run(const RenderContextPointer& renderContext
     }
 }
 
+void CullOccludedItems::configure(const Config& config) {
+    _maxViewOffset = config.maxViewOffset;
+}
+
+void CullOccludedItems::run(const RenderContextPointer& renderContext, const ItemBounds& inItems, ItemBounds& outItems) {
+    assert(renderContext->args);
+    RenderArgs* args = renderContext->args;
+    auto config = std::static_pointer_cast<Config>(renderContext->jobConfig);
+
+    OcclusionDepthPointer depth;
+    if (args->_renderMode == RenderArgs::DEFAULT_RENDER_MODE && !args->isStereo()) {
+        auto stage = renderContext->_scene->getStage<OcclusionStage>();
+        depth = stage ? stage->getDepth() : nullptr;
+        if (depth && glm::distance(depth->getViewPosition(), args->getViewFrustum().getPosition()) > _maxViewOffset) {
+            depth = nullptr;
+        }
+    }
+
+    if (!depth) {
+        outItems = inItems;
+        config->numOccluded = 0;
+        return;
+    }
+
+    PerformanceTimer perfTimer("cullOccludedItems");
+    outItems.clear();
+    outItems.reserve(inItems.size());
+    for (const auto& itemBound : inItems) {
+        if (!depth->isOccluded(itemBound.bound)) {
+            outItems.emplace_back(itemBound);
+        }
+    }
+    config->numOccluded = (int)(inItems.size() - outItems.size());
+}
+
 void ClearContainingZones::run(const RenderContextPointer& renderContext) {
     // This is a bit of a hack.  We want to do zone culling as early as possible, so we do it
     // during the RenderFetchCullSortTask (in CullSpatialSelection and FetchNonspatialItems),
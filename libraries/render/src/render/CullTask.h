@@ -13,6 +13,7 @@
 #define hifi_render_CullTask_h
 
 #include "Engine.h"
+#include "OcclusionStage.h"
 #include "ViewFrustum.h"
 
 namespace render {
@@ -158,6 +159,36 @@ namespace render {
         render::CullFunctor _cullFunctor;
     };
 
+    class CullOccludedItemsConfig : public Job::Config {
+        Q_OBJECT
+        Q_PROPERTY(int numOccluded READ getNumOccluded)
+        Q_PROPERTY(float maxViewOffset MEMBER maxViewOffset NOTIFY dirty)
+    public:
+        CullOccludedItemsConfig() : Job::Config(true) {}
+
+        int numOccluded { 0 };
+        int getNumOccluded() { return numOccluded; }
+
+        // the occlusion depth isn't used once the view has moved farther than this (in meters) from where it was taken
+        float maxViewOffset { 1.0f };
+    signals:
+        void dirty();
+    };
+
+    // Rejects the items hidden behind the opaque surfaces of the main view, as they were a few frames ago (the occlusion
+    // depth is read back from the gpu without waiting on it). Other views, and stereo ones, are passed through.
+    class CullOccludedItems {
+    public:
+        using Config = CullOccludedItemsConfig;
+        using JobModel = Job::ModelIO<CullOccludedItems, ItemBounds, ItemBounds, Config>;
+
+        void configure(const Config& config);
+        void run(const RenderContextPointer& renderContext, const ItemBounds& inItems, ItemBounds& outItems);
+
+    private:
+        float _maxViewOffset { 1.0f };
+    };
+
     class ClearContainingZones {
     public:
         using JobModel = Job::Model<ClearContainingZones>;
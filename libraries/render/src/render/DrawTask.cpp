@@ -90,8 +90,9 @@ void render::renderStateSortShapes(const RenderContextPointer& renderContext,
         numItemsToDraw = glm::min(numItemsToDraw, maxDrawnItems);
     }
 
+    using MaterialSortedItem = std::pair<uint64_t, const Item*>;
     using SortedPipelines = std::vector<render::ShapeKey>;
-    using SortedShapes = std::unordered_map<render::ShapeKey, std::vector<Item>, render::ShapeKey::Hash, render::ShapeKey::KeyEqual>;
+    using SortedShapes = std::unordered_map<render::ShapeKey, std::vector<MaterialSortedItem>, render::ShapeKey::Hash, render::ShapeKey::KeyEqual>;
     SortedPipelines sortedPipelines;
     SortedShapes sortedShapes;
     std::vector< std::tuple<Item,ShapeKey> > ownPipelineBucket;
@@ -106,7 +107,7 @@ void render::renderStateSortShapes(const RenderContextPointer& renderContext,
                 if (bucket.empty()) {
                     sortedPipelines.push_back(key);
                 }
-                bucket.push_back(item);
+                bucket.emplace_back(item.getMaterialSortKey(), &item);
             } else if (key.hasOwnPipeline()) {
                 ownPipelineBucket.push_back( std::make_tuple(item, key) );
             } else {
@@ -125,7 +126,14 @@ void render::renderStateSortShapes(const RenderContextPointer& renderContext,
             continue;
         }
         args->_itemShapeKey = pipelineKey._flags.to_ulong();
-        for (auto& item : bucket) {
+
+        // Draw the items sharing a material one after the other, so that its textures are bound once, in the order they
+        // were given otherwise (front to back for opaques)
+        std::stable_sort(bucket.begin(), bucket.end(), [](const MaterialSortedItem& a, const MaterialSortedItem& b) {
+            return a.first < b.first;
+        });
+        for (auto& materialSortedItem : bucket) {
+            const Item& item = *materialSortedItem.second;
             args->_shapePipeline->prepareShapeItem(args, pipelineKey, item);
             item.render(args);
         }
@@ -374,3 +382,24 @@ void DrawFrustum::getVertices(const ViewFrustum& frustum, glm::vec3 vertices[8])
     vertices[6] = frustum.getFarBottomRight();
     vertices[7] = frustum.getFarBottomLeft();
 }
+
+void WarmUpShapePipelines::run(const render::RenderContextPointer& renderContext) {
+    if (_nextPipeline >= _pipelines.size()) {
+        return;
+    }
+
+    static const size_t PIPELINES_PER_FRAME = 8;
+    size_t end = std::min(_nextPipeline + PIPELINES_PER_FRAME, _pipelines.size());
+    gpu::doInBatch("WarmUpShapePipelines::run", renderContext->args->_context, [&](gpu::Batch& batch) {
+        for (; _nextPipeline < end; ++_nextPipeline) {
+            batch.setPipeline(_pipelines[_nextPipeline]);
+        }
+        batch.setPipeline(nullptr);
+    });
+
+    if (_nextPipeline >= _pipelines.size()) {
+        _pipelines.clear();
+        _pipelines.shrink_to_fit();
+        _nextPipeline = 0;
+    }
+}
@@ -135,6 +135,21 @@ private:
 
     static void getVertices(const ViewFrustum& frustum, glm::vec3 vertices[8]);
 };
+
+// Sets a few of the pipelines of a plumber in a batch of their own every frame until all of them have been, so that the
+// backend compiles their programs over the first frames rather than on the frame an item first draws with one of them
+class WarmUpShapePipelines {
+public:
+    using JobModel = render::Job::Model<WarmUpShapePipelines>;
+
+    WarmUpShapePipelines(const ShapePlumberPointer& shapePlumber) : _pipelines(shapePlumber->getPipelines()) {}
+
+    void run(const render::RenderContextPointer& renderContext);
+
+private:
+    std::vector<gpu::PipelinePointer> _pipelines;
+    size_t _nextPipeline { 0 };
+};
 }
 
 #endif // hifi_render_DrawTask_h
@@ -435,6 +435,7 @@ public:
         virtual void render(RenderArgs* args) = 0;
 
         virtual const ShapeKey getShapeKey() const = 0;
+        virtual uint64_t getMaterialSortKey() const = 0;
 
         virtual uint32_t fetchMetaSubItems(ItemIDs& subItems) const = 0;
 
@@ -486,6 +487,7 @@ public:
 
     // Shape Type Interface
     const ShapeKey getShapeKey() const;
+    uint64_t getMaterialSortKey() const { return _payload->getMaterialSortKey(); }
 
     // Meta Type Interface
     uint32_t fetchMetaSubItems(ItemIDs& subItems) const { return _payload->fetchMetaSubItems(subItems); }
@@ -499,11 +501,15 @@ public:
     void setTransitionId(Index id) { _transitionId = id; }
     Index getTransitionId() const { return _transitionId; }
 
+    // The Scene change stamp of the last reset or update of the item
+    uint32_t getChangeStamp() const { return _changeStamp; }
+
 protected:
     PayloadPointer _payload;
     ItemKey _key;
     ItemCell _cell { INVALID_CELL };
     Index _transitionId { INVALID_INDEX };
+    uint32_t _changeStamp { 0 };
 
     friend class Scene;
 };
@@ -539,6 +545,10 @@ template <class T> void payloadRender(const std::shared_ptr<T>& payloadData, Ren
 // implying that the shape will setup its own pipeline without the use of the ShapeKey.
 template <class T> const ShapeKey shapeGetShapeKey(const std::shared_ptr<T>& payloadData) { return ShapeKey::Builder::ownPipeline(); }
 
+// Shapes drawn with the same pipeline are grouped by this key, so that the ones sharing their material textures are drawn
+// one after the other and only the first binds them. 0 means no material in particular.
+template <class T> uint64_t shapeGetMaterialSortKey(const std::shared_ptr<T>& payloadData) { return 0; }
+
 // Meta Type Interface
 // Meta items act as the grouping object for several sub items (typically shapes).
 template <class T> uint32_t metaFetchMetaSubItems(const std::shared_ptr<T>& payloadData, ItemIDs& subItems) { return 0; }
@@ -567,6 +577,7 @@ public:
 
     // Shape Type interface
     virtual const ShapeKey getShapeKey() const override { return shapeGetShapeKey<T>(_data); }
+    virtual uint64_t getMaterialSortKey() const override { return shapeGetMaterialSortKey<T>(_data); }
 
     // Meta Type Interface
     virtual uint32_t fetchMetaSubItems(ItemIDs& subItems) const override { return metaFetchMetaSubItems<T>(_data, subItems); }
@@ -0,0 +1,123 @@
+//
+//  OcclusionStage.cpp
+//  render/src/render
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "OcclusionStage.h"
+
+#include <algorithm>
+#include <cfloat>
+
+using namespace render;
+
+std::string OcclusionStage::_name("Occlusion");
+
+// Bounds any closer to the view than this, or behind it, are never occluded
+static const float MIN_OCCLUSION_DEPTH = 0.01f;
+
+OcclusionDepth::OcclusionDepth(const glm::ivec2& size, const std::vector<float>& depths, const glm::mat4& view, const glm::mat4& projection) :
+    _viewProjection(projection * view),
+    _viewPosition(glm::vec3(glm::inverse(view)[3])) {
+    if (size.x <= 0 || size.y <= 0 || depths.size() != (size_t)(size.x * size.y)) {
+        return;
+    }
+
+    _mipSizes.push_back(size);
+    _mips.push_back(depths);
+    while (_mipSizes.back().x > 1 || _mipSizes.back().y > 1) {
+        glm::ivec2 sourceSize = _mipSizes.back();
+        glm::ivec2 mipSize = (sourceSize + 1) / 2;
+        std::vector<float> mip(mipSize.x * mipSize.y);
+        {
+            const auto& source = _mips.back();
+            for (int y = 0; y < mipSize.y; ++y) {
+                int y0 = 2 * y;
+                int y1 = std::min(y0 + 1, sourceSize.y - 1);
+                for (int x = 0; x < mipSize.x; ++x) {
+                    int x0 = 2 * x;
+                    int x1 = std::min(x0 + 1, sourceSize.x - 1);
+                    mip[y * mipSize.x + x] = std::max(std::max(source[y0 * sourceSize.x + x0], source[y0 * sourceSize.x + x1]),
+                                                      std::max(source[y1 * sourceSize.x + x0], source[y1 * sourceSize.x + x1]));
+                }
+            }
+        }
+        _mipSizes.push_back(mipSize);
+        _mips.push_back(std::move(mip));
+    }
+}
+
+bool OcclusionDepth::isOccluded(const AABox& bound) const {
+    if (_mips.empty()) {
+        return false;
+    }
+
+    glm::vec2 rectMin(FLT_MAX);
+    glm::vec2 rectMax(-FLT_MAX);
+    float nearestDepth = FLT_MAX;
+    for (int i = 0; i < 8; ++i) {
+        glm::vec3 corner = bound.getCorner() + bound.getScale() * glm::vec3(i & 1, (i >> 1) & 1, (i >> 2) & 1);
+        glm::vec4 clipPos = _viewProjection * glm::vec4(corner, 1.0f);
+        // with a perspective projection, w is the depth along the view axis
+        if (clipPos.w < MIN_OCCLUSION_DEPTH) {
+            return false;
+        }
+        glm::vec2 ndcPos = glm::vec2(clipPos) / clipPos.w;
+        rectMin = glm::min(rectMin, ndcPos);
+        rectMax = glm::max(rectMax, ndcPos);
+        nearestDepth = std::min(nearestDepth, clipPos.w);
+    }
+
+    // what was out of the view wasn't seen, so it can't be known to be hidden
+    if (rectMin.x < -1.0f || rectMin.y < -1.0f || rectMax.x > 1.0f || rectMax.y > 1.0f) {
+        return false;
+    }
+
+    const glm::ivec2& size = _mipSizes.front();
+    glm::ivec2 texelMin = glm::clamp(glm::ivec2((rectMin * 0.5f + 0.5f) * glm::vec2(size)), glm::ivec2(0), size - 1);
+    glm::ivec2 texelMax = glm::clamp(glm::ivec2((rectMax * 0.5f + 0.5f) * glm::vec2(size)), glm::ivec2(0), size - 1);
+
+    // the finest level where the bound covers no more than 2x2 texels
+    size_t level = 0;
+    while (level + 1 < _mips.size() && (texelMax.x - texelMin.x > 1 || texelMax.y - texelMin.y > 1)) {
+        texelMin /= 2;
+        texelMax /= 2;
+        ++level;
+    }
+
+    const auto& mip = _mips[level];
+    int width = _mipSizes[level].x;
+    for (int y = texelMin.y; y <= texelMax.y; ++y) {
+        for (int x = texelMin.x; x <= texelMax.x; ++x) {
+            if (mip[y * width + x] >= nearestDepth) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void OcclusionStage::setDepth(const OcclusionDepthPointer& depth) {
+    std::lock_guard<std::mutex> lock(_depthMutex);
+    _depth = depth;
+}
+
+OcclusionDepthPointer OcclusionStage::getDepth() const {
+    std::lock_guard<std::mutex> lock(_depthMutex);
+    return _depth;
+}
+
+OcclusionStageSetup::OcclusionStageSetup() {
+}
+
+void OcclusionStageSetup::run(const RenderContextPointer& renderContext) {
+    auto stage = renderContext->_scene->getStage(OcclusionStage::getName());
+    if (!stage) {
+        stage = std::make_shared<OcclusionStage>();
+        renderContext->_scene->resetStage(OcclusionStage::getName(), stage);
+    }
+}
@@ -0,0 +1,72 @@
+//
+//  OcclusionStage.h
+//  render/src/render
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_render_OcclusionStage_h
+#define vircadia_render_OcclusionStage_h
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <AABox.h>
+
+#include "Stage.h"
+#include "Engine.h"
+
+namespace render {
+
+    // The farthest depth (distance along the view axis) of the opaque surfaces drawn in a past frame, per texel of a coarse
+    // grid over its view, reduced in a pyramid of farthest depths so that any bound is tested against a few texels
+    class OcclusionDepth {
+    public:
+        // the depths are given row by row from the bottom one, like the framebuffer they were read from
+        OcclusionDepth(const glm::ivec2& size, const std::vector<float>& depths, const glm::mat4& view, const glm::mat4& projection);
+
+        // a bound is occluded only when it was entirely in front of the view, and behind all the depths it covered
+        bool isOccluded(const AABox& bound) const;
+
+        const glm::vec3& getViewPosition() const { return _viewPosition; }
+
+    private:
+        glm::mat4 _viewProjection;
+        glm::vec3 _viewPosition;
+        std::vector<glm::ivec2> _mipSizes;
+        std::vector<std::vector<float>> _mips;
+    };
+    using OcclusionDepthPointer = std::shared_ptr<const OcclusionDepth>;
+
+    // Holds the latest occlusion depth of the main view, set from the render thread once it's been read back from the gpu,
+    // and used by the cull of the next frames
+    class OcclusionStage : public Stage {
+    public:
+        static const std::string& getName() { return _name; }
+
+        void setDepth(const OcclusionDepthPointer& depth);
+        OcclusionDepthPointer getDepth() const;
+
+    private:
+        static std::string _name;
+
+        mutable std::mutex _depthMutex;
+        OcclusionDepthPointer _depth;
+    };
+    using OcclusionStagePointer = std::shared_ptr<OcclusionStage>;
+
+    class OcclusionStageSetup {
+    public:
+        using JobModel = render::Job::Model<OcclusionStageSetup>;
+
+        OcclusionStageSetup();
+        void run(const RenderContextPointer& renderContext);
+    };
+
+}
+
+#endif // vircadia_render_OcclusionStage_h
@@ -230,22 +230,47 @@ uint32_t Scene::enqueueFrame() {
 }
 
  
-void Scene::processTransactionQueue() {
+void Scene::processTransactionQueue(size_t maxResets) {
     PROFILE_RANGE(render, __FUNCTION__);
+    _changeStamp++;
 
-    static TransactionFrames queuedFrames;
     {
-        // capture the queued frames and clear the queue
+        // capture the queued frames, behind any that were deferred, and clear the queue
         std::unique_lock<std::mutex> lock(_transactionFramesMutex);
-        queuedFrames.swap(_transactionFrames);
+        if (_deferredFrames.empty()) {
+            _deferredFrames.swap(_transactionFrames);
+        } else {
+            std::move(_transactionFrames.begin(), _transactionFrames.end(), std::back_inserter(_deferredFrames));
+            _transactionFrames.clear();
+        }
     }
 
-    // go through the queue of frames and process them
-    for (auto& frame : queuedFrames) {
+    // go through the queue of frames and process them, in order, until the budget runs out
+    size_t numResets = 0;
+    size_t numProcessedFrames = 0;
+    for (auto& frame : _deferredFrames) {
+        size_t frameResets = frame._resetItems.size();
+        if (maxResets > 0 && numResets + frameResets > maxResets) {
+            // the first part of the resets fits.  They're applied before anything else in a frame, so the rest of the
+            // frame can be kept for later without changing the order in which things happen.
+            size_t numFittingResets = maxResets - numResets;
+            if (numFittingResets > 0) {
+                Transaction head;
+                auto splitItr = frame._resetItems.begin() + numFittingResets;
+                head._resetItems.assign(std::make_move_iterator(frame._resetItems.begin()),
+                                        std::make_move_iterator(splitItr));
+                frame._resetItems.erase(frame._resetItems.begin(), splitItr);
+                processTransactionFrame(head);
+            }
+            break;
+        }
+        numResets += frameResets;
         processTransactionFrame(frame);
+        ++numProcessedFrames;
     }
 
-    queuedFrames.clear();
+    _deferredFrames.erase(_deferredFrames.begin(), _deferredFrames.begin() + numProcessedFrames);
+    _numDeferredFrames.store(_deferredFrames.size());
 }
 
 void Scene::processTransactionFrame(const Transaction& transaction) {
@@ -300,6 +325,7 @@ void Scene::resetItems(const Transaction::Resets& transactions) {
 
         // Reset the item with a new payload
         item.resetPayload(std::get<1>(reset));
+        item._changeStamp = _changeStamp;
         auto newKey = item.getKey();
 
         // Update the item's container
@@ -356,6 +382,7 @@ void Scene::updateItems(const Transaction::Updates& transactions) {
 
         // Update the item
         item.update(std::get<1>(update));
+        item._changeStamp = _changeStamp;
         auto newKey = item.getKey();
 
         // Update the item's container
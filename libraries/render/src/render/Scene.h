@@ -155,8 +155,16 @@ public:
     // Enqueue end of frame transactions boundary
     uint32_t enqueueFrame();
 
-    // Process the pending transactions queued
-    void processTransactionQueue();
+    // Process the pending transactions queued.  With a maximum number of item resets, the frames past it are left for
+    // the next call (a frame with too many resets of its own is split), so that a burst of new items is spread out
+    // over several frames.  0 processes everything.
+    void processTransactionQueue(size_t maxResets = 0);
+
+    // the number of frames left queued by processTransactionQueue() for lack of budget
+    size_t getNumDeferredTransactionFrames() const { return _numDeferredFrames.load(); }
+
+    // Incremented by every processTransactionQueue(), the items reset or updated then are stamped with it
+    uint32_t getChangeStamp() const { return _changeStamp; }
 
     // Access a particular selection (empty if doesn't exist)
     // Thread safe
@@ -207,6 +215,9 @@ protected:
     using TransactionFrames = std::vector<Transaction>;
     TransactionFrames _transactionFrames;
     uint32_t _transactionFrameNumber{ 0 };
+    TransactionFrames _deferredFrames; // only touched by processTransactionQueue()
+    std::atomic<size_t> _numDeferredFrames { 0 };
+    uint32_t _changeStamp { 0 };
 
     // Process one transaction frame 
     void processTransactionFrame(const Transaction& transaction);
@@ -10,12 +10,18 @@
 //
 #include "SceneTask.h"
 
+#include <algorithm>
+
 
 using namespace render;
 
 void PerformSceneTransaction::configure(const Config& config) {
+    _maxResetsPerFrame = (size_t)std::max(config.maxResetsPerFrame, 0);
 }
 
 void PerformSceneTransaction::run(const RenderContextPointer& renderContext) {
-    renderContext->_scene->processTransactionQueue();
+    renderContext->_scene->processTransactionQueue(_maxResetsPerFrame);
+
+    auto config = std::static_pointer_cast<Config>(renderContext->jobConfig);
+    config->setNumDeferredFrames((int)renderContext->_scene->getNumDeferredTransactionFrames());
 }
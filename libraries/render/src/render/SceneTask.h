@@ -18,7 +18,16 @@ namespace render {
 
     class PerformSceneTransactionConfig : public Job::Config {
         Q_OBJECT
+        Q_PROPERTY(int maxResetsPerFrame MEMBER maxResetsPerFrame NOTIFY dirty)
+        Q_PROPERTY(int numDeferredFrames READ getNumDeferredFrames NOTIFY dirty)
     public:
+        // new or reset items per frame, the rest wait for the next frames (0 = no limit)
+        int maxResetsPerFrame { 4096 };
+
+        int getNumDeferredFrames() const { return numDeferredFrames; }
+        void setNumDeferredFrames(int num) { if (num != numDeferredFrames) { numDeferredFrames = num; emit dirty(); } }
+        int numDeferredFrames { 0 };
+
     signals:
         void dirty();
 
@@ -33,6 +42,7 @@ namespace render {
         void configure(const Config& config);
         void run(const RenderContextPointer& renderContext);
     protected:
+        size_t _maxResetsPerFrame { 0 };
     };
 
 
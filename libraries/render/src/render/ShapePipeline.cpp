@@ -119,6 +119,18 @@ void ShapePlumber::addPipeline(const Filter& filter, const gpu::ShaderPointer& p
     }
 }
 
+std::vector<gpu::PipelinePointer> ShapePlumber::getPipelines() const {
+    std::vector<gpu::PipelinePointer> pipelines;
+    std::unordered_set<gpu::Pipeline*> added;
+    for (const auto& entry : _pipelineMap) {
+        const auto& pipeline = entry.second->pipeline;
+        if (pipeline && added.insert(pipeline.get()).second) {
+            pipelines.push_back(pipeline);
+        }
+    }
+    return pipelines;
+}
+
 const ShapePipelinePointer ShapePlumber::pickPipeline(RenderArgs* args, const Key& key) const {
     assert(!_pipelineMap.empty());
     assert(args);
@@ -305,6 +305,7 @@ public:
     std::shared_ptr<Locations> locations;
 
     void prepareShapeItem(Args* args, const ShapeKey& key, const Item& shape);
+    bool hasItemSetter() const { return (bool)_itemSetter; }
 
 protected:
     friend class ShapePlumber;
@@ -343,6 +344,9 @@ public:
 
     const PipelinePointer pickPipeline(RenderArgs* args, const Key& key) const;
 
+    // the gpu pipelines of the shape pipelines added so far, each once
+    std::vector<gpu::PipelinePointer> getPipelines() const;
+
 protected:
     void addPipelineHelper(const Filter& filter, Key key, int bit, const PipelinePointer& pipeline) const;
     mutable PipelineMap _pipelineMap;
@@ -12,87 +12,119 @@
 #include "SortTask.h"
 #include "ShapePipeline.h"
 
+#include <algorithm>
 #include <assert.h>
+#include <cstring>
+
 #include <ViewFrustum.h>
 
 using namespace render;
 
-struct ItemBoundSort {
-    float _centerDepth = 0.0f;
-    float _nearDepth = 0.0f;
-    float _farDepth = 0.0f;
-    ItemID _id = 0;
-    AABox _bounds;
+// The depth of an item in the high half, so that sorting the keys sorts by depth, and its id in the low half, so that
+// the same item is always next to itself and its duplicates can be dropped.
+struct ItemDepthKey {
+    uint64_t _key = 0;
+    uint32_t _index = 0; // in the input items
 
-    ItemBoundSort() {}
-    ItemBoundSort(float centerDepth, float nearDepth, float farDepth, ItemID id, const AABox& bounds) : _centerDepth(centerDepth), _nearDepth(nearDepth), _farDepth(farDepth), _id(id), _bounds(bounds) {}
+    bool operator<(const ItemDepthKey& other) const { return _key < other._key; }
 };
 
-struct FrontToBackSort {
-    bool operator() (const ItemBoundSort& left, const ItemBoundSort& right) {
-        return (left._centerDepth < right._centerDepth);
+static uint64_t makeDepthKey(float depth, ItemID id, bool frontToBack) {
+    // the bits of a positive float sort like it does
+    uint32_t depthBits;
+    depth = std::max(depth, 0.0f);
+    memcpy(&depthBits, &depth, sizeof(depthBits));
+    if (!frontToBack) {
+        depthBits = ~depthBits;
     }
-};
+    return ((uint64_t)depthBits << 32) | (uint64_t)id;
+}
+
+// a short list sorts faster by comparison than by going through all of its keys 8 times
+static const size_t MIN_RADIX_SORT_ITEMS = 64;
+
+// least significant digit first radix sort of the keys, one byte per pass.  The passes over bytes that all of the keys
+// share, like the high bytes of the ids, are skipped.
+static void radixSortDepthKeys(std::vector<ItemDepthKey>& keys) {
+    const int DIGIT_BITS = 8;
+    const size_t NUM_DIGITS = 1 << DIGIT_BITS;
+    const uint64_t DIGIT_MASK = NUM_DIGITS - 1;
+
+    std::vector<ItemDepthKey> sorted(keys.size());
+    for (int shift = 0; shift < 64; shift += DIGIT_BITS) {
+        size_t offsets[NUM_DIGITS] = { 0 };
+        for (const auto& key : keys) {
+            ++offsets[(key._key >> shift) & DIGIT_MASK];
+        }
+        if (offsets[(keys.front()._key >> shift) & DIGIT_MASK] == keys.size()) {
+            continue;
+        }
 
-struct BackToFrontSort {
-    bool operator() (const ItemBoundSort& left, const ItemBoundSort& right) {
-        return (left._centerDepth > right._centerDepth);
+        size_t offset = 0;
+        for (auto& digitOffset : offsets) {
+            size_t count = digitOffset;
+            digitOffset = offset;
+            offset += count;
+        }
+        for (const auto& key : keys) {
+            sorted[offsets[(key._key >> shift) & DIGIT_MASK]++] = key;
+        }
+        keys.swap(sorted);
     }
-};
+}
 
 void render::depthSortItems(const RenderContextPointer& renderContext, bool frontToBack, 
                             const ItemBounds& inItems, ItemBounds& outItems, AABox* bounds) {
     assert(renderContext->args);
     assert(renderContext->args->hasViewFrustum());
 
-    auto& scene = renderContext->_scene;
     RenderArgs* args = renderContext->args;
 
-
     // Allocate and simply copy
     outItems.clear();
     outItems.reserve(inItems.size());
+    if (inItems.empty()) {
+        return;
+    }
 
+    // Make a local dataset of the sort keys of the center distance
+    std::vector<ItemDepthKey> depthKeys;
+    depthKeys.reserve(inItems.size());
 
-    // Make a local dataset of the center distance and closest point distance
-    std::vector<ItemBoundSort> itemBoundSorts;
-    itemBoundSorts.reserve(outItems.size());
-
-    for (auto itemDetails : inItems) {
-        auto item = scene->getItem(itemDetails.id);
-        auto bound = itemDetails.bound; // item.getBound(args);
-        float distanceSquared = args->getViewFrustum().distanceToCameraSquared(bound.calcCenter());
-
-        itemBoundSorts.emplace_back(ItemBoundSort(distanceSquared, distanceSquared, distanceSquared, itemDetails.id, bound));
+    const auto& viewFrustum = args->getViewFrustum();
+    for (uint32_t i = 0; i < (uint32_t)inItems.size(); ++i) {
+        const auto& itemDetails = inItems[i];
+        float distanceSquared = viewFrustum.distanceToCameraSquared(itemDetails.bound.calcCenter());
+        depthKeys.push_back({ makeDepthKey(distanceSquared, itemDetails.id, frontToBack), i });
     }
 
     // sort against Z
-    if (frontToBack) {
-        FrontToBackSort frontToBackSort;
-        std::sort(itemBoundSorts.begin(), itemBoundSorts.end(), frontToBackSort);
+    if (depthKeys.size() < MIN_RADIX_SORT_ITEMS) {
+        std::sort(depthKeys.begin(), depthKeys.end());
     } else {
-        BackToFrontSort  backToFrontSort;
-        std::sort(itemBoundSorts.begin(), itemBoundSorts.end(), backToFrontSort);
+        radixSortDepthKeys(depthKeys);
     }
 
     // Finally once sorted result to a list of itemID and keep uniques
     render::ItemID previousID = Item::INVALID_ITEM_ID;
     if (!bounds) {
-        for (auto& item : itemBoundSorts) {
-            if (item._id != previousID) {
-                outItems.emplace_back(ItemBound(item._id, item._bounds));
-                previousID = item._id;
+        for (const auto& depthKey : depthKeys) {
+            const auto& item = inItems[depthKey._index];
+            if (item.id != previousID) {
+                outItems.emplace_back(item);
+                previousID = item.id;
             }
         }
-    } else if (!itemBoundSorts.empty()) {
+    } else {
         if (bounds->isNull()) {
-            *bounds = itemBoundSorts.front()._bounds;
+            *bounds = inItems[depthKeys.front()._index].bound;
         }
-        for (auto& item : itemBoundSorts) {
-            if (item._id != previousID) {
-                outItems.emplace_back(ItemBound(item._id, item._bounds));
-                previousID = item._id;
-                *bounds += item._bounds;
+        for (const auto& depthKey : depthKeys) {
+            const auto& item = inItems[depthKey._index];
+            if (item.id != previousID) {
+                outItems.emplace_back(item);
+                previousID = item.id;
+                *bounds += item.bound;
             }
         }
     }
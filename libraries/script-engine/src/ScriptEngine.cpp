@@ -15,6 +15,7 @@
 #include <thread>
 
 #include <QtCore/QCoreApplication>
+#include <QtCore/QCryptographicHash>
 #include <QtCore/QEventLoop>
 #include <QtCore/QFileInfo>
 #include <QtCore/QTimer>
@@ -74,6 +75,7 @@
 #include "WebSocketClass.h"
 #include "RecordingScriptingInterface.h"
 #include "ScriptEngines.h"
+#include "ScriptProfiler.h"
 #include "StackTestScriptingInterface.h"
 #include "ModelScriptingInterface.h"
 
@@ -223,10 +225,10 @@ ScriptEngine::ScriptEngine(Context context, const QString& scriptContents, const
     BaseScriptEngine(),
     _context(context),
     _scriptContents(scriptContents),
-    _timerFunctionMap(),
     _fileNameString(fileNameString),
     _arrayBufferClass(new ArrayBufferClass(this)),
-    _assetScriptingInterface(new AssetScriptingInterface(this))
+    _assetScriptingInterface(new AssetScriptingInterface(this)),
+    _profiler(new ScriptProfiler(this)) // owned by the engine, which deletes its agents
 {
     switch (_context) {
         case Context::CLIENT_SCRIPT:
@@ -1303,6 +1305,7 @@ void ScriptEngine::run() {
                 auto postUpdate = clock::now();
                 auto elapsed = (postUpdate - preUpdate);
                 totalUpdates += std::chrono::duration_cast<std::chrono::microseconds>(elapsed);
+                _scriptExecutionUsecs += std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
             }
         }
         _lastUpdate = now;
@@ -1349,27 +1352,21 @@ void ScriptEngine::run() {
 // NOTE: This is private because it must be called on the same thread that created the timers, which is why
 // we want to only call it in our own run "shutdown" processing.
 void ScriptEngine::stopAllTimers() {
-    QMutableHashIterator<QTimer*, CallbackData> i(_timerFunctionMap);
     int j {0};
-    while (i.hasNext()) {
-        i.next();
-        QTimer* timer = i.key();
+    for (auto timer : _timers.keys()) {
         qCDebug(scriptengine) << getFilename() << "stopAllTimers[" << j++ << "]";
         stopTimer(timer);
     }
 }
 
 void ScriptEngine::stopAllTimersForEntityScript(const EntityItemID& entityID) {
-     // We could maintain a separate map of entityID => QTimer, but someone will have to prove to me that it's worth the complexity. -HRS
-    QVector<QTimer*> toDelete;
-    QMutableHashIterator<QTimer*, CallbackData> i(_timerFunctionMap);
-    while (i.hasNext()) {
-        i.next();
-        if (i.value().definingEntityIdentifier != entityID) {
+     // We could maintain a separate map of entityID => timer, but someone will have to prove to me that it's worth the complexity. -HRS
+    QVector<QObject*> toDelete;
+    for (auto it = _timers.cbegin(); it != _timers.cend(); ++it) {
+        if (it.value().callback.definingEntityIdentifier != entityID) {
             continue;
         }
-        QTimer* timer = i.key();
-        toDelete << timer; // don't delete while we're iterating. save it.
+        toDelete << it.key(); // don't delete while we're iterating. save it.
     }
     for (auto timer:toDelete) { // now reap 'em
         stopTimer(timer);
@@ -1436,50 +1433,104 @@ void ScriptEngine::timerFired() {
         }
     }
 
-    QTimer* callingTimer = reinterpret_cast<QTimer*>(sender());
-    CallbackData timerData = _timerFunctionMap.value(callingTimer);
+    PROFILE_RANGE(script, __FUNCTION__);
 
-    if (!callingTimer->isActive()) {
-        // this timer is done, we can kill it
-        _timerFunctionMap.remove(callingTimer);
-        delete callingTimer;
+    // only the timers that were due when the pass started are fired, intervals that come due again wait for the next pass
+    auto passStart = p_high_resolution_clock::now();
+    std::vector<QObject*> dueTimers;
+    for (auto it = _timerSchedule.begin(); it != _timerSchedule.end() && it->first.first <= passStart; ++it) {
+        dueTimers.push_back(it->second);
     }
 
-    // call the associated JS function, if it exists
-    if (timerData.function.isValid()) {
-        PROFILE_RANGE(script, __FUNCTION__);
-        auto preTimer = p_high_resolution_clock::now();
-        callWithEnvironment(timerData.definingEntityIdentifier, timerData.definingSandboxURL, timerData.function, timerData.function, QScriptValueList());
-        auto postTimer = p_high_resolution_clock::now();
-        auto elapsed = (postTimer - preTimer);
-        _totalTimerExecution += std::chrono::duration_cast<std::chrono::microseconds>(elapsed);
-    } else {
-        qCWarning(scriptengine) << "timerFired -- invalid function" << timerData.function.toVariant().toString();
+    // a flood of timers is spread over several passes, so that the engine can handle its other events in between
+    static const std::chrono::milliseconds MAX_TIMER_PASS_DURATION(10);
+
+    _isDispatchingTimers = true;
+    for (auto timer : dueTimers) {
+        // an earlier callback may have cleared it
+        auto it = _timers.find(timer);
+        if (it == _timers.end()) {
+            continue;
+        }
+        if (p_high_resolution_clock::now() - passStart > MAX_TIMER_PASS_DURATION) {
+            break;
+        }
+
+        CallbackData timerData = it.value().callback;
+        _timerSchedule.erase(it.value().key);
+        if (it.value().isSingleShot) {
+            // this timer is done, we can kill it
+            _timers.erase(it);
+            delete timer;
+        } else {
+            // keep to the interval, unless the engine has fallen so far behind that it would have to catch up
+            auto due = std::max(it.value().key.first + it.value().interval, passStart);
+            scheduleTimer(timer, due);
+        }
+
+        // call the associated JS function, if it exists
+        if (timerData.function.isValid()) {
+            auto preTimer = p_high_resolution_clock::now();
+            callWithEnvironment(timerData.definingEntityIdentifier, timerData.definingSandboxURL, timerData.function, timerData.function, QScriptValueList());
+            auto postTimer = p_high_resolution_clock::now();
+            auto elapsed = (postTimer - preTimer);
+            _totalTimerExecution += std::chrono::duration_cast<std::chrono::microseconds>(elapsed);
+            _scriptExecutionUsecs += std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+        } else {
+            qCWarning(scriptengine) << "timerFired -- invalid function" << timerData.function.toVariant().toString();
+        }
     }
+    _isDispatchingTimers = false;
+
+    updateTimerDispatch();
 }
 
 QObject* ScriptEngine::setupTimerWithInterval(const QScriptValue& function, int intervalMS, bool isSingleShot) {
-    // create the timer, add it to the map, and start it
-    QTimer* newTimer = new QTimer(this);
-    newTimer->setSingleShot(isSingleShot);
+    // the timer is just a handle for the script to clear it with, add it to the map and schedule it
+    QObject* newTimer = new QObject(this);
 
-    // The default timer type is not very accurate below about 200ms http://doc.qt.io/qt-5/qt.html#TimerType-enum
-    static const int MIN_TIMEOUT_FOR_COARSE_TIMER = 200;
-    if (intervalMS < MIN_TIMEOUT_FOR_COARSE_TIMER) {
-        newTimer->setTimerType(Qt::PreciseTimer);
-    }
+    TimerData timerData;
+    timerData.callback = { function, currentEntityIdentifier, currentSandboxURL };
+    timerData.interval = std::chrono::milliseconds(std::max(intervalMS, 0));
+    timerData.isSingleShot = isSingleShot;
+    _timers.insert(newTimer, timerData);
 
-    connect(newTimer, &QTimer::timeout, this, &ScriptEngine::timerFired);
+    scheduleTimer(newTimer, p_high_resolution_clock::now() + timerData.interval);
+    return newTimer;
+}
 
-    // make sure the timer stops when the script does
-    connect(this, &ScriptEngine::scriptEnding, newTimer, &QTimer::stop);
+void ScriptEngine::scheduleTimer(QObject* timer, p_high_resolution_clock::time_point due) {
+    TimerData& timerData = _timers[timer];
+    timerData.key = { due, _nextTimerSequence++ };
+    _timerSchedule.emplace(timerData.key, timer);
 
+    // the dispatcher only needs to be rescheduled if this timer is now the first one due
+    if (!_isDispatchingTimers && _timerSchedule.begin()->second == timer) {
+        updateTimerDispatch();
+    }
+}
 
-    CallbackData timerData = { function, currentEntityIdentifier, currentSandboxURL };
-    _timerFunctionMap.insert(newTimer, timerData);
+void ScriptEngine::updateTimerDispatch() {
+    if (_timerSchedule.empty()) {
+        if (_timerDispatcher) {
+            _timerDispatcher->stop();
+        }
+        return;
+    }
 
-    newTimer->start(intervalMS);
-    return newTimer;
+    if (!_timerDispatcher) {
+        _timerDispatcher = new QTimer(this);
+        _timerDispatcher->setSingleShot(true);
+        // The default timer type is not very accurate below about 200ms http://doc.qt.io/qt-5/qt.html#TimerType-enum
+        _timerDispatcher->setTimerType(Qt::PreciseTimer);
+        connect(_timerDispatcher, &QTimer::timeout, this, &ScriptEngine::timerFired);
+    }
+
+    // rounded up, so that the first timer is due by the time the dispatcher fires
+    auto wait = std::chrono::duration_cast<std::chrono::microseconds>(_timerSchedule.begin()->first.first -
+        p_high_resolution_clock::now());
+    auto waitMS = std::chrono::duration_cast<std::chrono::milliseconds>(wait + std::chrono::microseconds(999));
+    _timerDispatcher->start(std::max((int)waitMS.count(), 0));
 }
 
 QObject* ScriptEngine::setInterval(const QScriptValue& function, int intervalMS) {
@@ -1502,13 +1553,17 @@ QObject* ScriptEngine::setTimeout(const QScriptValue& function, int timeoutMS) {
     return setupTimerWithInterval(function, timeoutMS, true);
 }
 
-void ScriptEngine::stopTimer(QTimer *timer) {
-    if (_timerFunctionMap.contains(timer)) {
-        timer->stop();
-        _timerFunctionMap.remove(timer);
+void ScriptEngine::stopTimer(QObject* timer) {
+    auto it = _timers.find(timer);
+    if (it != _timers.end()) {
+        _timerSchedule.erase(it.value().key);
+        _timers.erase(it);
         delete timer;
+        if (!_isDispatchingTimers && _timerSchedule.empty()) {
+            updateTimerDispatch();
+        }
     } else {
-        qCDebug(scriptengine) << "stopTimer -- not in _timerFunctionMap" << timer;
+        qCDebug(scriptengine) << "stopTimer -- not in _timers" << timer;
     }
 }
 
@@ -1569,6 +1624,44 @@ void ScriptEngine::endProfileRange(const QString& label) const {
     PROFILE_SYNC_END(script, label.toStdString().c_str(), label.toStdString().c_str());
 }
 
+void ScriptEngine::startProfiling() {
+    if (QThread::currentThread() != thread()) {
+        QMetaObject::invokeMethod(this, "startProfiling");
+        return;
+    }
+    if (agent() != _profiler) {
+        _profiler->start();
+        setAgent(_profiler);
+    }
+}
+
+void ScriptEngine::stopProfiling() {
+    if (QThread::currentThread() != thread()) {
+        QMetaObject::invokeMethod(this, "stopProfiling");
+        return;
+    }
+    if (agent() == _profiler) {
+        setAgent(nullptr);
+    }
+}
+
+QVariantList ScriptEngine::getProfile() const {
+    return _profiler->getProfile();
+}
+
+void ScriptEngine::resetProfile() {
+    _profiler->reset();
+}
+
+QVariantMap ScriptEngine::getEntityScriptLoadStats() const {
+    QVariantMap stats;
+    stats["programs"] = _entityScriptPrograms.size();
+    stats["programHits"] = _entityScriptProgramHits;
+    stats["programMisses"] = _entityScriptProgramMisses;
+    stats["loadTime"] = (double)_entityScriptLoadUsecs / USECS_PER_MSEC;
+    return stats;
+}
+
 // Script.require.resolve -- like resolvePath, but performs more validation and throws exceptions on invalid module identifiers (for consistency with Node.js)
 QString ScriptEngine::_requireResolve(const QString& moduleId, const QString& relativeTo) {
     if (!IS_THREADSAFE_INVOCATION(thread(), __FUNCTION__)) {
@@ -2303,6 +2396,7 @@ void ScriptEngine::entityScriptContentAvailable(const EntityItemID& entityID, co
     qCDebug(scriptengine) << "ScriptEngine::entityScriptContentAvailable() thread [" << QThread::currentThread() << "] expected thread [" << thread() << "]";
 #endif
 
+    auto loadStarted = usecTimestampNow();
     auto scriptCache = DependencyManager::get<ScriptCache>();
     bool isFileUrl = isURL && scriptOrURL.startsWith("file://");
     auto fileName = isURL ? scriptOrURL : "about:EmbeddedEntityScript";
@@ -2330,29 +2424,166 @@ void ScriptEngine::entityScriptContentAvailable(const EntityItemID& entityID, co
         return;
     }
 
-    // SYNTAX ERRORS
-    auto syntaxError = lintScript(contents, fileName);
-    if (syntaxError.isError()) {
-        auto message = syntaxError.property("formatted").toString();
-        if (message.isEmpty()) {
-            message = syntaxError.toString();
+    // the copies of an entity share the program that the first of them was checked and compiled into
+    QString programKey = fileName + ":" + QCryptographicHash::hash(contents.toUtf8(), QCryptographicHash::Md5).toHex();
+    QScriptProgram program = _entityScriptPrograms.value(programKey);
+    bool isCompiled = !program.isNull();
+    if (isCompiled) {
+        ++_entityScriptProgramHits;
+    } else {
+        ++_entityScriptProgramMisses;
+
+        // SYNTAX ERRORS
+        auto syntaxError = lintScript(contents, fileName);
+        if (syntaxError.isError()) {
+            auto message = syntaxError.property("formatted").toString();
+            if (message.isEmpty()) {
+                message = syntaxError.toString();
+            }
+            setError(QString("Bad syntax (%1)").arg(message), EntityScriptStatus::ERROR_RUNNING_SCRIPT);
+            syntaxError.setProperty("detail", entityID.toString());
+            emit unhandledException(syntaxError);
+            return;
+        }
+        program = QScriptProgram { contents, fileName };
+        if (program.isNull()) {
+            setError("Bad program (isNull)", EntityScriptStatus::ERROR_RUNNING_SCRIPT);
+            emit unhandledException(makeError("program.isNull"));
+            return; // done processing script
         }
-        setError(QString("Bad syntax (%1)").arg(message), EntityScriptStatus::ERROR_RUNNING_SCRIPT);
-        syntaxError.setProperty("detail", entityID.toString());
-        emit unhandledException(syntaxError);
-        return;
-    }
-    QScriptProgram program { contents, fileName };
-    if (program.isNull()) {
-        setError("Bad program (isNull)", EntityScriptStatus::ERROR_RUNNING_SCRIPT);
-        emit unhandledException(makeError("program.isNull"));
-        return; // done processing script
     }
 
     if (isURL) {
         setParentURL(scriptOrURL);
     }
 
+    if (isCompiled) {
+        // it passed the sandbox when it was compiled, only the whitelist can have changed since
+        bool unsafeEntityScripts = atoi(getenv("UNSAFE_ENTITY_SCRIPTS") ? getenv("UNSAFE_ENTITY_SCRIPTS") : "0");
+        if (!unsafeEntityScripts && !isEntityScriptWhitelisted(scriptOrURL)) {
+            qCDebug(scriptengine) << "[WHITELIST ENTITY SCRIPTS]" << "(disabled entity script)" << entityID.toString() << scriptOrURL;
+            auto exception = makeError("UNSAFE_ENTITY_SCRIPTS == 0");
+            setError(formatException(exception, _enableExtendedJSExceptions.get()), EntityScriptStatus::ERROR_RUNNING_SCRIPT);
+            emit unhandledException(exception);
+            return;
+        }
+    } else {
+        QString errorInfo;
+        QScriptValue error;
+        if (!preflightEntityScript(entityID, scriptOrURL, program, errorInfo, error)) {
+            setError(errorInfo, EntityScriptStatus::ERROR_RUNNING_SCRIPT);
+            emit unhandledException(error);
+            return;
+        }
+
+        _entityScriptPrograms.insert(programKey, program);
+    }
+
+    // (this feeds into refreshFileScript)
+    int64_t lastModified = 0;
+    if (isFileUrl) {
+        QString file = QUrl(scriptOrURL).toLocalFile();
+        lastModified = (quint64)QFileInfo(file).lastModified().toMSecsSinceEpoch();
+    }
+
+    // THE ACTUAL EVALUATION AND CONSTRUCTION
+    QScriptValue entityScriptConstructor, entityScriptObject;
+    QUrl sandboxURL = currentSandboxURL.isEmpty() ? scriptOrURL : currentSandboxURL;
+    auto initialization = [&]{
+        entityScriptConstructor = BaseScriptEngine::evaluate(program);
+        maybeEmitUncaughtException("evaluate");
+        entityScriptObject = entityScriptConstructor.construct();
+
+        if (hasUncaughtException()) {
+            entityScriptObject = cloneUncaughtException("(construct " + entityID.toString() + ")");
+            clearExceptions();
+        }
+    };
+
+    doWithEnvironment(entityID, sandboxURL, initialization);
+
+    if (entityScriptObject.isError()) {
+        auto exception = entityScriptObject;
+        setError(formatException(exception, _enableExtendedJSExceptions.get()), EntityScriptStatus::ERROR_RUNNING_SCRIPT);
+        emit unhandledException(exception);
+        return;
+    }
+
+    // ... AND WE HAVE LIFTOFF
+    _entityScriptLoadUsecs += usecTimestampNow() - loadStarted;
+    newDetails.status = EntityScriptStatus::RUNNING;
+    newDetails.scriptObject = entityScriptObject;
+    newDetails.lastModified = lastModified;
+    newDetails.definingSandboxURL = sandboxURL;
+    setEntityScriptDetails(entityID, newDetails);
+
+    if (isURL) {
+        setParentURL("");
+    }
+
+    // if we got this far, then call the preload method
+    callEntityScriptMethod(entityID, "preload");
+
+    emit entityScriptPreloadFinished(entityID);
+}
+
+bool ScriptEngine::isEntityScriptWhitelisted(const QString& scriptOrURL) {
+    // ENTITY SCRIPT WHITELIST STARTS HERE
+    auto nodeList = DependencyManager::get<NodeList>();
+    bool passList = false;  // assume unsafe
+    QString whitelistPrefix = "[WHITELIST ENTITY SCRIPTS]";
+    QList<QString> safeURLPrefixes = { "file:///", "atp:", "cache:" };
+    safeURLPrefixes += qEnvironmentVariable("EXTRA_WHITELIST").trimmed().split(QRegExp("\\s*,\\s*"), Qt::SkipEmptyParts);
+
+    // Entity Script Whitelist toggle check.
+    Setting::Handle<bool> whitelistEnabled {"private/whitelistEnabled", false };
+            
+    if (!whitelistEnabled.get()) {
+        passList = true;
+    }
+    
+    // Pull SAFEURLS from the Interface.JSON settings.
+    QVariant raw = Setting::Handle<QVariant>("private/settingsSafeURLS").get();
+    QStringList settingsSafeURLS = raw.toString().trimmed().split(QRegExp("\\s*[,\r\n]+\\s*"), Qt::SkipEmptyParts);
+    safeURLPrefixes += settingsSafeURLS;
+    // END Pull SAFEURLS from the Interface.JSON settings.
+    
+    // Get current domain whitelist bypass, in case an entire domain is whitelisted.
+    QString currentDomain = DependencyManager::get<AddressManager>()->getDomainURL().host();
+    
+    QString domainSafeIP = nodeList->getDomainHandler().getHostname();
+    QString domainSafeURL = URL_SCHEME_VIRCADIA + "://" + currentDomain;
+    for (const auto& str : safeURLPrefixes) {
+        if (domainSafeURL.startsWith(str) || domainSafeIP.startsWith(str)) {
+            qCDebug(scriptengine) << whitelistPrefix << "Whitelist Bypassed, entire domain is whitelisted. Current Domain Host: " 
+                << nodeList->getDomainHandler().getHostname()
+                << "Current Domain: " << currentDomain;
+            passList = true;
+        }
+    }
+    // END bypass whitelist based on current domain.
+
+    // Start processing scripts through the whitelist.
+    if (ScriptEngine::getContext() == "entity_server") { // If running on the server, do not engage whitelist.
+        passList = true;
+    } else if (!passList) { // If waved through, do not engage whitelist.
+        for (const auto& str : safeURLPrefixes) {
+            qCDebug(scriptengine) << whitelistPrefix << "Script URL: " << scriptOrURL << "TESTING AGAINST" << str << "RESULTS IN"
+                << scriptOrURL.startsWith(str);
+            if (!str.isEmpty() && scriptOrURL.startsWith(str)) {
+                passList = true;
+                qCDebug(scriptengine) << whitelistPrefix << "Script approved.";
+                break; // Bail early since we found a match.
+            }
+        }
+    }
+    // END processing of scripts through the whitelist.
+
+    return passList;
+}
+
+bool ScriptEngine::preflightEntityScript(const EntityItemID& entityID, const QString& scriptOrURL,
+                                         const QScriptProgram& program, QString& errorInfo, QScriptValue& error) {
     // SANITY/PERFORMANCE CHECK USING SANDBOX
     const int SANDBOX_TIMEOUT = 0.25 * MSECS_PER_SECOND;
     BaseScriptEngine sandbox;
@@ -2381,59 +2612,8 @@ void ScriptEngine::entityScriptContentAvailable(const EntityItemID& entityID, co
             exception = testConstructor;
         }
     } else {
-        // ENTITY SCRIPT WHITELIST STARTS HERE
-        auto nodeList = DependencyManager::get<NodeList>();
-        bool passList = false;  // assume unsafe
-        QString whitelistPrefix = "[WHITELIST ENTITY SCRIPTS]";
-        QList<QString> safeURLPrefixes = { "file:///", "atp:", "cache:" };
-        safeURLPrefixes += qEnvironmentVariable("EXTRA_WHITELIST").trimmed().split(QRegExp("\\s*,\\s*"), Qt::SkipEmptyParts);
-
-        // Entity Script Whitelist toggle check.
-        Setting::Handle<bool> whitelistEnabled {"private/whitelistEnabled", false };
-                
-        if (!whitelistEnabled.get()) {
-            passList = true;
-        }
-        
-        // Pull SAFEURLS from the Interface.JSON settings.
-        QVariant raw = Setting::Handle<QVariant>("private/settingsSafeURLS").get();
-        QStringList settingsSafeURLS = raw.toString().trimmed().split(QRegExp("\\s*[,\r\n]+\\s*"), Qt::SkipEmptyParts);
-        safeURLPrefixes += settingsSafeURLS;
-        // END Pull SAFEURLS from the Interface.JSON settings.
-        
-        // Get current domain whitelist bypass, in case an entire domain is whitelisted.
-        QString currentDomain = DependencyManager::get<AddressManager>()->getDomainURL().host();
-        
-        QString domainSafeIP = nodeList->getDomainHandler().getHostname();
-        QString domainSafeURL = URL_SCHEME_VIRCADIA + "://" + currentDomain;
-        for (const auto& str : safeURLPrefixes) {
-            if (domainSafeURL.startsWith(str) || domainSafeIP.startsWith(str)) {
-                qCDebug(scriptengine) << whitelistPrefix << "Whitelist Bypassed, entire domain is whitelisted. Current Domain Host: " 
-                    << nodeList->getDomainHandler().getHostname()
-                    << "Current Domain: " << currentDomain;
-                passList = true;
-            }
-        }
-        // END bypass whitelist based on current domain.
-
-        // Start processing scripts through the whitelist.
-        if (ScriptEngine::getContext() == "entity_server") { // If running on the server, do not engage whitelist.
-            passList = true;
-        } else if (!passList) { // If waved through, do not engage whitelist.
-            for (const auto& str : safeURLPrefixes) {
-                qCDebug(scriptengine) << whitelistPrefix << "Script URL: " << scriptOrURL << "TESTING AGAINST" << str << "RESULTS IN"
-                    << scriptOrURL.startsWith(str);
-                if (!str.isEmpty() && scriptOrURL.startsWith(str)) {
-                    passList = true;
-                    qCDebug(scriptengine) << whitelistPrefix << "Script approved.";
-                    break; // Bail early since we found a match.
-                }
-            }
-        }
-        // END processing of scripts through the whitelist.
-
-        if (!passList) { // If the entity failed to pass for any reason, it's blocked and an error is thrown.
-            qCDebug(scriptengine) << whitelistPrefix << "(disabled entity script)" << entityID.toString() << scriptOrURL;
+        if (!isEntityScriptWhitelisted(scriptOrURL)) { // If the entity failed to pass for any reason, it's blocked and an error is thrown.
+            qCDebug(scriptengine) << "[WHITELIST ENTITY SCRIPTS]" << "(disabled entity script)" << entityID.toString() << scriptOrURL;
             exception = makeError("UNSAFE_ENTITY_SCRIPTS == 0");
         } else {
             QTimer timeout;
@@ -2464,10 +2644,9 @@ void ScriptEngine::entityScriptContentAvailable(const EntityItemID& entityID, co
 
     if (exception.isError()) {
       // create a local copy using makeError to decouple from the sandbox engine
-      exception = makeError(exception);
-      setError(formatException(exception, _enableExtendedJSExceptions.get()), EntityScriptStatus::ERROR_RUNNING_SCRIPT);
-      emit unhandledException(exception);
-      return;
+      error = makeError(exception);
+      errorInfo = formatException(error, _enableExtendedJSExceptions.get());
+      return false;
     }
 
     // CONSTRUCTOR VIABILITY
@@ -2483,59 +2662,15 @@ void ScriptEngine::entityScriptContentAvailable(const EntityItemID& entityID, co
         auto message = QString("failed to load entity script -- expected a function, got %1, %2")
             .arg(testConstructorType).arg(testConstructorValue);
 
-        auto err = makeError(message);
-        err.setProperty("fileName", scriptOrURL);
-        err.setProperty("detail", "(constructor " + entityID.toString() + ")");
+        error = makeError(message);
+        error.setProperty("fileName", scriptOrURL);
+        error.setProperty("detail", "(constructor " + entityID.toString() + ")");
 
-        setError("Could not find constructor (" + testConstructorType + ")", EntityScriptStatus::ERROR_RUNNING_SCRIPT);
-        emit unhandledException(err);
-        return; // done processing script
-    }
-
-    // (this feeds into refreshFileScript)
-    int64_t lastModified = 0;
-    if (isFileUrl) {
-        QString file = QUrl(scriptOrURL).toLocalFile();
-        lastModified = (quint64)QFileInfo(file).lastModified().toMSecsSinceEpoch();
-    }
-
-    // THE ACTUAL EVALUATION AND CONSTRUCTION
-    QScriptValue entityScriptConstructor, entityScriptObject;
-    QUrl sandboxURL = currentSandboxURL.isEmpty() ? scriptOrURL : currentSandboxURL;
-    auto initialization = [&]{
-        entityScriptConstructor = evaluate(contents, fileName);
-        entityScriptObject = entityScriptConstructor.construct();
-
-        if (hasUncaughtException()) {
-            entityScriptObject = cloneUncaughtException("(construct " + entityID.toString() + ")");
-            clearExceptions();
-        }
-    };
-
-    doWithEnvironment(entityID, sandboxURL, initialization);
-
-    if (entityScriptObject.isError()) {
-        auto exception = entityScriptObject;
-        setError(formatException(exception, _enableExtendedJSExceptions.get()), EntityScriptStatus::ERROR_RUNNING_SCRIPT);
-        emit unhandledException(exception);
-        return;
-    }
-
-    // ... AND WE HAVE LIFTOFF
-    newDetails.status = EntityScriptStatus::RUNNING;
-    newDetails.scriptObject = entityScriptObject;
-    newDetails.lastModified = lastModified;
-    newDetails.definingSandboxURL = sandboxURL;
-    setEntityScriptDetails(entityID, newDetails);
-
-    if (isURL) {
-        setParentURL("");
+        errorInfo = "Could not find constructor (" + testConstructorType + ")";
+        return false;
     }
 
-    // if we got this far, then call the preload method
-    callEntityScriptMethod(entityID, "preload");
-
-    emit entityScriptPreloadFinished(entityID);
+    return true;
 }
 
 /*@jsdoc
@@ -2627,6 +2762,7 @@ void ScriptEngine::unloadAllEntityScripts(bool blockingCall) {
         QWriteLocker locker{ &_entityScriptsLock };
         _entityScripts.clear();
     }
+    _entityScriptPrograms.clear();
     emit entityScriptDetailsUpdated();
 
 #ifdef DEBUG_ENGINE_STATE
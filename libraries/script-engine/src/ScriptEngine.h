@@ -16,6 +16,7 @@
 #ifndef hifi_ScriptEngine_h
 #define hifi_ScriptEngine_h
 
+#include <map>
 #include <unordered_map>
 #include <vector>
 
@@ -29,12 +30,14 @@
 #include <QMetaEnum>
 
 #include <QtScript/QScriptEngine>
+#include <QtScript/QScriptProgram>
 
 #include <AnimationCache.h>
 #include <AnimVariant.h>
 #include <AvatarData.h>
 #include <AvatarHashMap.h>
 #include <LimitedNodeList.h>
+#include <PortableHighResolutionClock.h>
 #include <EntityItemID.h>
 #include <EntitiesScriptEngineProvider.h>
 #include <EntityScriptUtils.h>
@@ -61,6 +64,7 @@ static const int DEFAULT_MAX_ENTITY_PPS = 9000;
 static const int DEFAULT_ENTITY_PPS_PER_SCRIPT = 900;
 
 class ScriptEngines;
+class ScriptProfiler;
 
 Q_DECLARE_METATYPE(ScriptEnginePointer)
 
@@ -508,7 +512,7 @@ public:
      *     Script.clearInterval(timer);
      * }, 10000);
      */
-    Q_INVOKABLE void clearInterval(QObject* timer) { stopTimer(reinterpret_cast<QTimer*>(timer)); }
+    Q_INVOKABLE void clearInterval(QObject* timer) { stopTimer(timer); }
 
     /*@jsdoc
      * Stops a timeout timer set by {@link Script.setTimeout|setTimeout}.
@@ -523,7 +527,7 @@ public:
      * // Uncomment the following line to stop the timer from firing.
      * //Script.clearTimeout(timer);
      */
-    Q_INVOKABLE void clearTimeout(QObject* timer) { stopTimer(reinterpret_cast<QTimer*>(timer)); }
+    Q_INVOKABLE void clearTimeout(QObject* timer) { stopTimer(timer); }
 
     /*@jsdoc
      * Prints a message to the program log and emits {@link Script.printedMessage}.
@@ -570,6 +574,41 @@ public:
      */
     Q_INVOKABLE void endProfileRange(const QString& label) const;
 
+    /*@jsdoc
+     * Starts timing every function call that the script makes, including calls into the API. Calls are also traced in the
+     * script profiling category while tracing is running. Profiling slows the script down.
+     * @function Script.startProfiling
+     */
+    Q_INVOKABLE void startProfiling();
+
+    /*@jsdoc
+     * Stops timing the script's function calls. The times so far are kept until {@link Script.resetProfile} is called.
+     * @function Script.stopProfiling
+     */
+    Q_INVOKABLE void stopProfiling();
+
+    /*@jsdoc
+     * Gets how long each function took while the script was being profiled.
+     * @function Script.getProfile
+     * @returns {Script.FunctionProfile[]} The functions that were called, those that took the longest themselves first.
+     */
+    /*@jsdoc
+     * @typedef {object} Script.FunctionProfile
+     * @property {string} name - The name of the function.
+     * @property {string} fileName - The script that the function is in, empty if it's an API function.
+     * @property {number} lineNumber - The line that the function starts on, <code>-1</code> if it's an API function.
+     * @property {number} calls - The number of times that the function was called.
+     * @property {number} selfTime - The time spent in the function, not including the functions it called, in ms.
+     * @property {number} totalTime - The time spent in the function, including the functions it called, in ms.
+     */
+    Q_INVOKABLE QVariantList getProfile() const;
+
+    /*@jsdoc
+     * Clears the function times collected so far.
+     * @function Script.resetProfile
+     */
+    Q_INVOKABLE void resetProfile();
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Entity Script Related methods
 
@@ -585,6 +624,21 @@ public:
         return it != _entityScripts.constEnd() && it->status == EntityScriptStatus::RUNNING;
     }
     QVariant cloneEntityScriptDetails(const EntityItemID& entityID);
+
+    /*@jsdoc
+     * Gets how the entity scripts run by this script engine were loaded.
+     * @function Script.getEntityScriptLoadStats
+     * @returns {Script.EntityScriptLoadStats} The entity script loading statistics.
+     */
+    /*@jsdoc
+     * @typedef {object} Script.EntityScriptLoadStats
+     * @property {number} programs - The number of different entity scripts compiled, which are shared by the entities
+     *     running them.
+     * @property {number} programHits - The number of entity scripts that were started from an already compiled program.
+     * @property {number} programMisses - The number of entity scripts that had to be checked and compiled.
+     * @property {number} loadTime - The total time spent loading and constructing entity scripts, in ms.
+     */
+    Q_INVOKABLE QVariantMap getEntityScriptLoadStats() const;
     QFuture<QVariant> getLocalEntityScriptDetails(const EntityItemID& entityID) override;
 
     /*@jsdoc
@@ -690,6 +744,8 @@ public:
     void scriptPrintedMessage(const QString& message);
     void clearDebugLogWindow();
     int getNumRunningEntityScripts() const;
+    // how long the script's updates and timers have taken since it started running, readable from any thread
+    quint64 getScriptExecutionUsecs() const { return _scriptExecutionUsecs; }
     bool getEntityScriptDetails(const EntityItemID& entityID, EntityScriptDetails &details) const;
     bool hasEntityScriptDetails(const EntityItemID& entityID) const;
 
@@ -941,10 +997,16 @@ protected:
     void refreshFileScript(const EntityItemID& entityID);
     void updateEntityScriptStatus(const EntityItemID& entityID, const EntityScriptStatus& status, const QString& errorInfo = QString());
     void setEntityScriptDetails(const EntityItemID& entityID, const EntityScriptDetails& details);
+    bool isEntityScriptWhitelisted(const QString& scriptOrURL);
+    // checks that program can be run and defines a constructor, by evaluating it in a sandbox
+    bool preflightEntityScript(const EntityItemID& entityID, const QString& scriptOrURL, const QScriptProgram& program,
+                               QString& errorInfo, QScriptValue& error);
     void setParentURL(const QString& parentURL) { _parentURL = parentURL; }
 
     QObject* setupTimerWithInterval(const QScriptValue& function, int intervalMS, bool isSingleShot);
-    void stopTimer(QTimer* timer);
+    void scheduleTimer(QObject* timer, p_high_resolution_clock::time_point due);
+    void updateTimerDispatch();
+    void stopTimer(QObject* timer);
 
     QHash<EntityItemID, RegisteredEventHandlers> _registeredHandlers;
     void forwardHandlerCall(const EntityItemID& entityID, const QString& eventName, QScriptValueList eventHanderArgs);
@@ -974,10 +1036,28 @@ protected:
     std::atomic<bool> _isRunning { false };
     std::atomic<bool> _isStopping { false };
     bool _isInitialized { false };
-    QHash<QTimer*, CallbackData> _timerFunctionMap;
+    // The scripts' timers are handles, all of them are fired in order of when they're due by a single Qt timer
+    using TimerKey = std::pair<p_high_resolution_clock::time_point, quint64>; // when it's due, then when it was scheduled
+    class TimerData {
+    public:
+        CallbackData callback;
+        std::chrono::milliseconds interval;
+        bool isSingleShot;
+        TimerKey key;
+    };
+    QHash<QObject*, TimerData> _timers;
+    std::map<TimerKey, QObject*> _timerSchedule;
+    quint64 _nextTimerSequence { 0 };
+    QTimer* _timerDispatcher { nullptr };
+    bool _isDispatchingTimers { false };
     QSet<QUrl> _includedURLs;
     mutable QReadWriteLock _entityScriptsLock { QReadWriteLock::Recursive };
     QHash<EntityItemID, EntityScriptDetails> _entityScripts;
+    // Entity scripts that passed the sandbox, keyed by URL and a hash of their contents
+    QHash<QString, QScriptProgram> _entityScriptPrograms;
+    int _entityScriptProgramHits { 0 };
+    int _entityScriptProgramMisses { 0 };
+    quint64 _entityScriptLoadUsecs { 0 };
     EntityScriptContentAvailableMap _contentAvailableQueue;
 
     bool _isThreaded { false };
@@ -998,11 +1078,14 @@ protected:
 
     AssetScriptingInterface* _assetScriptingInterface;
 
+    ScriptProfiler* _profiler;
+
     std::function<bool()> _emitScriptUpdates{ []() { return true; }  };
 
     std::recursive_mutex _lock;
 
     std::chrono::microseconds _totalTimerExecution { 0 };
+    std::atomic<quint64> _scriptExecutionUsecs { 0 };
 
     static const QString _SETTINGS_ENABLE_EXTENDED_MODULE_COMPAT;
     static const QString _SETTINGS_ENABLE_EXTENDED_EXCEPTIONS;
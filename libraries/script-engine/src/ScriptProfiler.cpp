@@ -0,0 +1,109 @@
+//
+//  ScriptProfiler.cpp
+//  libraries/script-engine/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ScriptProfiler.h"
+
+#include <algorithm>
+
+#include <QtScript/QScriptContextInfo>
+#include <QtScript/QScriptEngine>
+
+#include <NumericalConstants.h>
+#include <Profile.h>
+
+void ScriptProfiler::start() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _calls.clear();
+    for (auto& function : _functions) {
+        function.second.activeCalls = 0;
+    }
+}
+
+void ScriptProfiler::functionEntry(qint64 scriptId) {
+    QScriptContextInfo info(engine()->currentContext());
+    QString name = info.functionName().isEmpty() ? "(anonymous)" : info.functionName();
+    // native functions don't have a file
+    QString traceName = info.fileName().isEmpty() ? name :
+        QString("%1 (%2:%3)").arg(name, info.fileName()).arg(info.functionStartLineNumber());
+
+    PROFILE_SYNC_BEGIN(script, traceName, traceName);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _functions.find(traceName);
+    if (it == _functions.end()) {
+        Function function;
+        function.name = name;
+        function.fileName = info.fileName();
+        function.lineNumber = info.functionStartLineNumber();
+        it = _functions.emplace(traceName, function).first;
+    }
+    it->second.activeCalls++;
+    _calls.push_back(Call { &it->second, traceName, p_high_resolution_clock::now() });
+}
+
+void ScriptProfiler::functionExit(qint64 scriptId, const QScriptValue& returnValue) {
+    auto now = p_high_resolution_clock::now();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    // the calls that were in progress when profiling started end without having been entered
+    if (_calls.empty()) {
+        return;
+    }
+
+    Call call = _calls.back();
+    _calls.pop_back();
+    PROFILE_SYNC_END(script, call.traceName, call.traceName);
+
+    quint64 usecs = std::chrono::duration_cast<std::chrono::microseconds>(now - call.start).count();
+    Function& function = *call.function;
+    function.calls++;
+    function.selfUsecs += usecs - std::min(usecs, call.childUsecs);
+    if (--function.activeCalls == 0) {
+        function.totalUsecs += usecs;
+    }
+    if (!_calls.empty()) {
+        _calls.back().childUsecs += usecs;
+    }
+}
+
+QVariantList ScriptProfiler::getProfile() const {
+    std::vector<const Function*> functions;
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (const auto& function : _functions) {
+        if (function.second.calls > 0) {
+            functions.push_back(&function.second);
+        }
+    }
+    std::sort(functions.begin(), functions.end(), [](const Function* a, const Function* b) {
+        return a->selfUsecs > b->selfUsecs;
+    });
+
+    QVariantList profile;
+    for (const auto function : functions) {
+        QVariantMap entry;
+        entry["name"] = function->name;
+        entry["fileName"] = function->fileName;
+        entry["lineNumber"] = function->lineNumber;
+        entry["calls"] = function->calls;
+        entry["selfTime"] = (double)function->selfUsecs / USECS_PER_MSEC;
+        entry["totalTime"] = (double)function->totalUsecs / USECS_PER_MSEC;
+        profile.push_back(entry);
+    }
+    return profile;
+}
+
+void ScriptProfiler::reset() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto& function : _functions) {
+        function.second.calls = 0;
+        function.second.selfUsecs = 0;
+        function.second.totalUsecs = 0;
+    }
+}
@@ -0,0 +1,66 @@
+//
+//  ScriptProfiler.h
+//  libraries/script-engine/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_ScriptProfiler_h
+#define vircadia_ScriptProfiler_h
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QVariantList>
+#include <QtScript/QScriptEngineAgent>
+
+#include <PortableHighResolutionClock.h>
+
+// Times every function a script engine calls, scripted or native, while it's installed as the engine's agent.
+//
+// Calls are counted and timed per function, both including and excluding the functions they call, and are also traced
+// as durations in the script category so that they show up in the traces the Tracer writes.
+class ScriptProfiler : public QScriptEngineAgent {
+public:
+    ScriptProfiler(QScriptEngine* engine) : QScriptEngineAgent(engine) {}
+
+    // called on the engine's thread before the profiler is installed, calls already in progress aren't timed
+    void start();
+
+    void functionEntry(qint64 scriptId) override;
+    void functionExit(qint64 scriptId, const QScriptValue& returnValue) override;
+
+    // the functions called since the profile was last reset, the ones that took longest themselves first, from any thread
+    QVariantList getProfile() const;
+    void reset();
+
+private:
+    class Function {
+    public:
+        QString name;
+        QString fileName;
+        int lineNumber { -1 };
+        quint64 calls { 0 };
+        quint64 selfUsecs { 0 };
+        quint64 totalUsecs { 0 };
+        int activeCalls { 0 }; // time spent in recursive calls is only added to the total once
+    };
+
+    class Call {
+    public:
+        Function* function;
+        QString traceName;
+        p_high_resolution_clock::time_point start;
+        quint64 childUsecs { 0 };
+    };
+
+    mutable std::mutex _mutex;
+    std::map<QString, Function> _functions; // by trace name, never erased so that calls can point to them
+    std::vector<Call> _calls;
+};
+
+#endif // vircadia_ScriptProfiler_h
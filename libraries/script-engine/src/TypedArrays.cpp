@@ -11,6 +11,10 @@
 
 #include "TypedArrays.h"
 
+#include <cstring>
+
+#include <QtCore/QtEndian>
+
 #include <glm/glm.hpp>
 
 #include "ScriptEngine.h"
@@ -200,19 +204,47 @@ void TypedArray::setBytesPerElement(quint32 bytesPerElement) {
 }
 
 // templated helper functions
-// don't work for floats as they require single precision settings
+// elements are read and written in place, with the same bits as an unsigned integer of their size so that floats
+// can be swapped to and from little endian too
+template<class T> struct ElementBits;
+template<> struct ElementBits<qint8> { using Type = quint8; };
+template<> struct ElementBits<quint8> { using Type = quint8; };
+template<> struct ElementBits<qint16> { using Type = quint16; };
+template<> struct ElementBits<quint16> { using Type = quint16; };
+template<> struct ElementBits<qint32> { using Type = quint32; };
+template<> struct ElementBits<quint32> { using Type = quint32; };
+template<> struct ElementBits<float> { using Type = quint32; };
+template<> struct ElementBits<double> { using Type = quint64; };
+
+template<class T>
+T readElement(const QByteArray& arrayBuffer, uint id) {
+    typename ElementBits<T>::Type bits = 0;
+    if (id + sizeof(T) <= (uint)arrayBuffer.size()) {
+        memcpy(&bits, arrayBuffer.constData() + id, sizeof(T));
+    }
+    bits = qFromLittleEndian(bits);
+    T result;
+    memcpy(&result, &bits, sizeof(T));
+    return result;
+}
+
+template<class T>
+void writeElement(QByteArray& arrayBuffer, uint id, T value) {
+    if (id + sizeof(T) <= (uint)arrayBuffer.size()) {
+        typename ElementBits<T>::Type bits;
+        memcpy(&bits, &value, sizeof(T));
+        bits = qToLittleEndian(bits);
+        memcpy(arrayBuffer.data() + id, &bits, sizeof(T));
+    }
+}
+
 template<class T>
 QScriptValue propertyHelper(const QByteArray* arrayBuffer, const QScriptString& name, uint id) {
     bool ok = false;
     name.toArrayIndex(&ok);
     
     if (ok && arrayBuffer) {
-        QDataStream stream(*arrayBuffer);
-        stream.skipRawData(id);
-        
-        stream.setByteOrder(QDataStream::LittleEndian);
-        T result;
-        stream >> result;
+        T result = readElement<T>(*arrayBuffer, id);
         return result;
     }
     return QScriptValue();
@@ -221,11 +253,7 @@ QScriptValue propertyHelper(const QByteArray* arrayBuffer, const QScriptString&
 template<class T>
 void setPropertyHelper(QByteArray* arrayBuffer, const QScriptString& name, uint id, const QScriptValue& value) {
     if (arrayBuffer && value.isNumber()) {
-        QDataStream stream(arrayBuffer, QIODevice::ReadWrite);
-        stream.skipRawData(id);
-        stream.setByteOrder(QDataStream::LittleEndian);
-        
-        stream << (T)value.toNumber();
+        writeElement<T>(*arrayBuffer, id, (T)value.toNumber());
     }
 }
 
@@ -275,14 +303,12 @@ void Uint8ClampedArrayClass::setProperty(QScriptValue& object, const QScriptStri
                                   uint id, const QScriptValue& value) {
     QByteArray* ba = qscriptvalue_cast<QByteArray*>(object.data().property(_bufferName).data());
     if (ba && value.isNumber()) {
-        QDataStream stream(ba, QIODevice::ReadWrite);
-        stream.skipRawData(id);
         if (value.toNumber() > 255) {
-            stream << (quint8)255;
+            writeElement<quint8>(*ba, id, 255);
         } else if (value.toNumber() < 0) {
-            stream << (quint8)0;
+            writeElement<quint8>(*ba, id, 0);
         } else {
-            stream << (quint8)glm::clamp(qRound(value.toNumber()), 0, 255);
+            writeElement<quint8>(*ba, id, (quint8)glm::clamp(qRound(value.toNumber()), 0, 255));
         }
     }
 }
@@ -361,13 +387,7 @@ QScriptValue Float32ArrayClass::property(const QScriptValue& object, const QScri
     name.toArrayIndex(&ok);
     
     if (ok && arrayBuffer) {
-        QDataStream stream(*arrayBuffer);
-        stream.skipRawData(id);
-        stream.setByteOrder(QDataStream::LittleEndian);
-        stream.setFloatingPointPrecision(QDataStream::SinglePrecision);
-        
-        float result;
-        stream >> result;
+        float result = readElement<float>(*arrayBuffer, id);
         if (isNaN(result)) {
             return QScriptValue();
         }
@@ -380,12 +400,7 @@ void Float32ArrayClass::setProperty(QScriptValue& object, const QScriptString& n
                                   uint id, const QScriptValue& value) {
     QByteArray* ba = qscriptvalue_cast<QByteArray*>(object.data().property(_bufferName).data());
     if (ba && value.isNumber()) {
-        QDataStream stream(ba, QIODevice::ReadWrite);
-        stream.skipRawData(id);
-        stream.setByteOrder(QDataStream::LittleEndian);
-        stream.setFloatingPointPrecision(QDataStream::SinglePrecision);
-        
-        stream << (float)value.toNumber();
+        writeElement<float>(*ba, id, (float)value.toNumber());
     }
 }
 
@@ -398,13 +413,7 @@ QScriptValue Float64ArrayClass::property(const QScriptValue& object, const QScri
     name.toArrayIndex(&ok);
     
     if (ok && arrayBuffer) {
-        QDataStream stream(*arrayBuffer);
-        stream.skipRawData(id);
-        stream.setByteOrder(QDataStream::LittleEndian);
-        stream.setFloatingPointPrecision(QDataStream::DoublePrecision);
-        
-        double result;
-        stream >> result;
+        double result = readElement<double>(*arrayBuffer, id);
         if (isNaN(result)) {
             return QScriptValue();
         }
@@ -417,12 +426,7 @@ void Float64ArrayClass::setProperty(QScriptValue& object, const QScriptString& n
                                   uint id, const QScriptValue& value) {
     QByteArray* ba = qscriptvalue_cast<QByteArray*>(object.data().property(_bufferName).data());
     if (ba && value.isNumber()) {
-        QDataStream stream(ba, QIODevice::ReadWrite);
-        stream.skipRawData(id);
-        stream.setByteOrder(QDataStream::LittleEndian);
-        stream.setFloatingPointPrecision(QDataStream::DoublePrecision);
-        
-        stream << (double)value.toNumber();
+        writeElement<double>(*ba, id, (double)value.toNumber());
     }
 }
 
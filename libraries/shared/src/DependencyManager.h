@@ -19,6 +19,7 @@
 #include <QWeakPointer>
 #include <QMutex>
 
+#include <atomic>
 #include <functional>
 #include <typeinfo>
 
@@ -92,16 +93,24 @@ private:
     mutable QRecursiveMutex _instanceHashMutex;
     mutable QMutex _inheritanceHashMutex;
 
+    // bumped whenever an instance is set or destroyed, so that get() knows when its cached instance may be stale
+    std::atomic<uint64_t> _instanceEpoch { 1 };
+
     bool _exiting { false };
 };
 
 template <typename T>
 QSharedPointer<T> DependencyManager::get() {
     static size_t hashCode = manager().getHashCode<T>();
-    static QWeakPointer<T> instance;
 
-    if (instance.isNull()) {
+    // each thread keeps the instance it last looked up, and only takes the lock again after a set or destroy
+    thread_local QWeakPointer<T> instance;
+    thread_local uint64_t instanceEpoch { 0 };
+
+    uint64_t epoch = manager()._instanceEpoch.load(std::memory_order_acquire);
+    if (instanceEpoch != epoch || instance.isNull()) {
         instance = qSharedPointerCast<T>(manager().safeGet(hashCode));
+        instanceEpoch = epoch;
 
 #ifndef QT_NO_DEBUG
         // debug builds...
@@ -142,6 +151,7 @@ QSharedPointer<T> DependencyManager::set(Args&&... args) {
 
     QSharedPointer<T> newInstance(new T(args...), &T::customDeleter);
     manager()._instanceHash.insert(hashCode, newInstance);
+    manager()._instanceEpoch.fetch_add(1, std::memory_order_release);
 
     return newInstance;
 }
@@ -159,6 +169,7 @@ QSharedPointer<T> DependencyManager::set(Args&&... args) {
 
     QSharedPointer<T> newInstance(new I(args...), &I::customDeleter);
     manager()._instanceHash.insert(hashCode, newInstance);
+    manager()._instanceEpoch.fetch_add(1, std::memory_order_release);
 
     return newInstance;
 }
@@ -169,6 +180,7 @@ void DependencyManager::destroy() {
 
     QMutexLocker lock(&manager()._instanceHashMutex);
     QSharedPointer<Dependency> shared = manager()._instanceHash.take(hashCode);
+    manager()._instanceEpoch.fetch_add(1, std::memory_order_release);
     QWeakPointer<Dependency> weak = shared;
     shared.clear();
 
@@ -0,0 +1,233 @@
+//
+//  FrameTrace.cpp
+//  libraries/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "FrameTrace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QTextStream>
+#include <QtCore/QThread>
+
+#include "Gzip.h"
+#include "PortableHighResolutionClock.h"
+#include "SharedLogging.h"
+#include "shared/FileUtils.h"
+
+using namespace tracing;
+
+namespace {
+
+const uint64_t RING_SIZE = 4096; // a power of two
+const uint64_t SLOT_BEING_WRITTEN = UINT64_MAX;
+
+// Only the thread holding a ring writes to it. Each slot carries the index it was last written at, and is marked as being
+// written while it's overwritten, so that a reader copying it at the same time can tell and skip it.
+class Ring {
+public:
+    class Slot {
+    public:
+        std::atomic<uint64_t> index { SLOT_BEING_WRITTEN };
+        std::atomic<uint64_t> startUsecs { 0 };
+        std::atomic<uint64_t> nameAndDuration { 0 };
+    };
+
+    Slot slots[RING_SIZE];
+    std::atomic<uint64_t> next { 0 };
+    bool isHeld { false };
+    QString threadName;
+};
+
+// rings are never destroyed, the ring of a thread that has finished is handed to the next new thread
+std::mutex ringsMutex;
+std::vector<std::unique_ptr<Ring>> rings;
+
+std::mutex namesMutex;
+std::vector<const char*> names;
+std::map<std::string, uint32_t> nameIds;
+
+class RingHolder {
+public:
+    RingHolder() {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        auto it = std::find_if(rings.begin(), rings.end(), [](const std::unique_ptr<Ring>& ring) {
+            return !ring->isHeld;
+        });
+        if (it == rings.end()) {
+            rings.emplace_back(new Ring());
+            it = rings.end() - 1;
+        }
+        ring = it->get();
+        ring->isHeld = true;
+        QThread* thread = QThread::currentThread();
+        ring->threadName = thread && !thread->objectName().isEmpty() ? thread->objectName() :
+            QString("Thread %1").arg(it - rings.begin());
+    }
+
+    ~RingHolder() {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        ring->isHeld = false;
+    }
+
+    Ring* ring;
+};
+
+}
+
+uint32_t FrameTrace::registerName(const char* name) {
+    std::lock_guard<std::mutex> lock(namesMutex);
+    auto it = nameIds.find(name);
+    if (it != nameIds.end()) {
+        return it->second;
+    }
+    uint32_t nameId = (uint32_t)names.size();
+    names.push_back(name);
+    nameIds.emplace(name, nameId);
+    return nameId;
+}
+
+const char* FrameTrace::getName(uint32_t nameId) {
+    std::lock_guard<std::mutex> lock(namesMutex);
+    return nameId < names.size() ? names[nameId] : "";
+}
+
+uint64_t FrameTrace::now() {
+    // the same clock as the Tracer's, so that both traces line up
+    return std::chrono::duration_cast<std::chrono::microseconds>(p_high_resolution_clock::now().time_since_epoch()).count();
+}
+
+void FrameTrace::record(uint32_t nameId, uint64_t startUsecs, uint64_t endUsecs) {
+    thread_local RingHolder holder;
+    Ring& ring = *holder.ring;
+
+    uint64_t index = ring.next.load(std::memory_order_relaxed);
+    Ring::Slot& slot = ring.slots[index & (RING_SIZE - 1)];
+    uint64_t durationUsecs = std::min<uint64_t>(endUsecs - startUsecs, UINT32_MAX);
+
+    slot.index.store(SLOT_BEING_WRITTEN, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.startUsecs.store(startUsecs, std::memory_order_relaxed);
+    slot.nameAndDuration.store((uint64_t)nameId << 32 | durationUsecs, std::memory_order_relaxed);
+    slot.index.store(index, std::memory_order_release);
+    ring.next.store(index + 1, std::memory_order_release);
+}
+
+std::vector<FrameTrace::Record> FrameTrace::getRecords(uint64_t sinceUsecs) {
+    std::vector<Ring*> currentRings;
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        for (const auto& ring : rings) {
+            currentRings.push_back(ring.get());
+        }
+    }
+
+    std::vector<Record> records;
+    for (int threadIndex = 0; threadIndex < (int)currentRings.size(); ++threadIndex) {
+        const Ring& ring = *currentRings[threadIndex];
+        uint64_t end = ring.next.load(std::memory_order_acquire);
+        uint64_t begin = end > RING_SIZE ? end - RING_SIZE : 0;
+        for (uint64_t index = begin; index < end; ++index) {
+            const Ring::Slot& slot = ring.slots[index & (RING_SIZE - 1)];
+            if (slot.index.load(std::memory_order_acquire) != index) {
+                continue;
+            }
+            uint64_t startUsecs = slot.startUsecs.load(std::memory_order_relaxed);
+            uint64_t nameAndDuration = slot.nameAndDuration.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.index.load(std::memory_order_relaxed) != index) {
+                continue; // overwritten while it was being copied
+            }
+            if (startUsecs >= sinceUsecs) {
+                records.push_back({ startUsecs, (uint32_t)nameAndDuration, (uint32_t)(nameAndDuration >> 32), threadIndex });
+            }
+        }
+    }
+
+    // ranges are recorded when they end, so the ones enclosing others come after them in a ring
+    std::sort(records.begin(), records.end(), [](const Record& a, const Record& b) {
+        return a.startUsecs < b.startUsecs;
+    });
+    return records;
+}
+
+void FrameTrace::serialize(const QString& filename, const std::vector<Record>& records) {
+    QString fullPath = FileUtils::replaceDateTimeTokens(filename);
+    fullPath = FileUtils::computeDocumentPath(fullPath);
+    if (!FileUtils::canCreateFile(fullPath)) {
+        return;
+    }
+
+    std::vector<QString> threadNames;
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        for (const auto& ring : rings) {
+            threadNames.push_back(ring->threadName);
+        }
+    }
+
+    qint64 processID = QCoreApplication::applicationPid();
+    QByteArray data;
+    {
+        QTextStream out(&data);
+        bool first = true;
+        auto writeEvent = [&](const QJsonObject& event) {
+            if (first) {
+                first = false;
+            } else {
+                out << ",\n";
+            }
+            out << QJsonDocument(event).toJson(QJsonDocument::Compact);
+        };
+        out << "[\n";
+        for (int threadIndex = 0; threadIndex < (int)threadNames.size(); ++threadIndex) {
+            writeEvent(QJsonObject {
+                { "name", "thread_name" },
+                { "ph", "M" },
+                { "pid", processID },
+                { "tid", threadIndex },
+                { "args", QJsonObject { { "name", threadNames[threadIndex] } } }
+            });
+        }
+        for (const auto& record : records) {
+            writeEvent(QJsonObject {
+                { "name", getName(record.nameId) },
+                { "cat", "frame" },
+                { "ph", "X" },
+                { "ts", (qint64)record.startUsecs },
+                { "dur", (qint64)record.durationUsecs },
+                { "pid", processID },
+                { "tid", record.threadIndex }
+            });
+        }
+        out << "\n]";
+    }
+
+    if (fullPath.endsWith(".gz")) {
+        QByteArray compressed;
+        gzip(data, compressed);
+        data = compressed;
+    }
+
+    QFile file(fullPath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCDebug(shared) << "failed to open file '" << fullPath << "'";
+        return;
+    }
+    file.write(data);
+}
@@ -0,0 +1,67 @@
+//
+//  FrameTrace.h
+//  libraries/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_FrameTrace_h
+#define vircadia_FrameTrace_h
+
+#include <cstdint>
+#include <vector>
+
+#include <QtCore/QString>
+
+namespace tracing {
+
+// An always-on record of the last few thousand ranges timed on each thread, cheap enough to leave running in servers.
+//
+// Unlike the Tracer, nothing is allocated or locked to record a range: each thread writes fixed-size records of a name id,
+// a start time and a duration into a ring of its own, overwriting the oldest ones. The rings are copied out on demand, from
+// any thread, typically right after a frame has overrun so that what made it slow can be looked at after the fact.
+class FrameTrace {
+public:
+    class Record {
+    public:
+        uint64_t startUsecs;
+        uint32_t durationUsecs;
+        uint32_t nameId;
+        int threadIndex;
+    };
+
+    // the id of a name, the same name always gets the same id, the name must outlive the process (a literal)
+    static uint32_t registerName(const char* name);
+    static const char* getName(uint32_t nameId);
+
+    static uint64_t now();
+    static void record(uint32_t nameId, uint64_t startUsecs, uint64_t endUsecs);
+
+    // the records of every thread's ring that started at or after sinceUsecs, oldest first
+    static std::vector<Record> getRecords(uint64_t sinceUsecs = 0);
+
+    // writes records in the trace event format the Tracer uses, compressed if the file name ends in .gz
+    static void serialize(const QString& filename, const std::vector<Record>& records);
+};
+
+class FrameTraceRange {
+public:
+    FrameTraceRange(uint32_t nameId) : _nameId(nameId), _startUsecs(FrameTrace::now()) {}
+    ~FrameTraceRange() { FrameTrace::record(_nameId, _startUsecs, FrameTrace::now()); }
+
+private:
+    const uint32_t _nameId;
+    const uint64_t _startUsecs;
+};
+
+}
+
+// the name is registered once per site, so it has to be a literal
+#define FRAME_TRACE_RANGE(name) \
+    static const uint32_t frameTraceNameIdThis = tracing::FrameTrace::registerName(name); \
+    tracing::FrameTraceRange frameTraceRangeThis(frameTraceNameIdThis);
+
+#endif // vircadia_FrameTrace_h
@@ -231,6 +231,345 @@ int unpackOrientationQuatFromSixBytes(const unsigned char* buffer, glm::quat& qu
     return 6;
 }
 
+//
+// Batch variants of the joint pack/unpack functions, giving the same bytes and values as the functions above.
+// The float math runs four joints at a time; on x86 assume that SSE2 is present.
+//
+
+// for each dropped component, which of the three stored components (3 for the dropped one) each component comes from
+static const uint8_t SIX_BYTE_QUAT_SOURCES[4][4] = { { 3, 0, 1, 2 }, { 0, 3, 1, 2 }, { 0, 1, 3, 2 }, { 0, 1, 2, 3 } };
+
+static inline uint8_t sixByteQuatLargestComponent(const unsigned char* buffer) {
+    return ((0x80 & buffer[2]) >> 6) | ((0x80 & buffer[0]) >> 7);
+}
+
+static inline uint16_t sixByteQuatComponent(const unsigned char* buffer, int component) {
+    return ((uint16_t)(0x7f & buffer[2 * component]) << 8) | buffer[2 * component + 1];
+}
+
+static inline void writeSixByteQuat(unsigned char* buffer, const int32_t quantized[4], uint8_t largestComponent) {
+    uint16_t components[3];
+    for (int i = 0, j = 0; i < 4; i++) {
+        if (i != largestComponent) {
+            components[j++] = (uint16_t)quantized[i];
+        }
+    }
+    components[0] = (0x7fff & components[0]) | ((0x01 & largestComponent) << 15);
+    components[1] = (0x7fff & components[1]) | ((0x02 & largestComponent) << 14);
+
+    buffer[0] = HI_BYTE(components[0]);
+    buffer[1] = LO_BYTE(components[0]);
+    buffer[2] = HI_BYTE(components[1]);
+    buffer[3] = LO_BYTE(components[1]);
+    buffer[4] = HI_BYTE(components[2]);
+    buffer[5] = LO_BYTE(components[2]);
+}
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+
+#include <emmintrin.h>
+
+static inline __m128 select_ps(__m128 mask, __m128 a, __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+static inline __m128i select_si128(__m128i mask, __m128i a, __m128i b) {
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+int packOrientationQuatsToSixBytes(unsigned char* buffer, const glm::quat* quatsInput, int count) {
+    const __m128 SIGN = _mm_set1_ps(-0.0f);
+    const __m128 MAGNITUDE = _mm_set1_ps(1.0f / sqrtf(2.0f));
+    const __m128 TWO_MAGNITUDE = _mm_set1_ps(2.0f * (1.0f / sqrtf(2.0f)));
+    const __m128 RANGE = _mm_set1_ps((float)((1 << 15) - 1));
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 c0 = _mm_loadu_ps(&quatsInput[i + 0][0]);
+        __m128 c1 = _mm_loadu_ps(&quatsInput[i + 1][0]);
+        __m128 c2 = _mm_loadu_ps(&quatsInput[i + 2][0]);
+        __m128 c3 = _mm_loadu_ps(&quatsInput[i + 3][0]);
+        _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+        // find the largest component, the first of equals like the scalar loop
+        __m128 largest = _mm_andnot_ps(SIGN, c0);
+        __m128 largestValue = c0;
+        __m128i largestComponent = _mm_setzero_si128();
+        __m128 components[3] = { c1, c2, c3 };
+        for (int k = 0; k < 3; k++) {
+            __m128 magnitude = _mm_andnot_ps(SIGN, components[k]);
+            __m128 isLarger = _mm_cmpgt_ps(magnitude, largest);
+            largest = select_ps(isLarger, magnitude, largest);
+            largestValue = select_ps(isLarger, components[k], largestValue);
+            largestComponent = select_si128(_mm_castps_si128(isLarger), _mm_set1_epi32(k + 1), largestComponent);
+        }
+
+        // ensure that the sign of the dropped component is always negative.
+        __m128 flip = _mm_and_ps(_mm_cmpgt_ps(largestValue, _mm_setzero_ps()), SIGN);
+
+        alignas(16) int32_t quantized[4][4];
+        alignas(16) int32_t largestComponents[4];
+        __m128 all[4] = { c0, c1, c2, c3 };
+        for (int k = 0; k < 4; k++) {
+            __m128 value = _mm_div_ps(_mm_add_ps(_mm_xor_ps(all[k], flip), MAGNITUDE), TWO_MAGNITUDE);
+            _mm_store_si128((__m128i*)quantized[k], _mm_cvttps_epi32(_mm_mul_ps(value, RANGE)));
+        }
+        _mm_store_si128((__m128i*)largestComponents, largestComponent);
+
+        for (int lane = 0; lane < 4; lane++) {
+            int32_t laneQuantized[4] = { quantized[0][lane], quantized[1][lane], quantized[2][lane], quantized[3][lane] };
+            writeSixByteQuat(buffer + (i + lane) * 6, laneQuantized, (uint8_t)largestComponents[lane]);
+        }
+    }
+    for (; i < count; i++) {
+        packOrientationQuatToSixBytes(buffer + i * 6, quatsInput[i]);
+    }
+    return count * 6;
+}
+
+int unpackOrientationQuatsFromSixBytes(const unsigned char* buffer, glm::quat* quatsOutput, int count) {
+    const __m128 SIGN = _mm_set1_ps(-0.0f);
+    const __m128 ONE = _mm_set1_ps(1.0f);
+    const __m128 MAGNITUDE = _mm_set1_ps(1.0f / sqrtf(2.0f));
+    const __m128 TWO_MAGNITUDE = _mm_set1_ps(2.0f * (1.0f / sqrtf(2.0f)));
+    const __m128 RANGE = _mm_set1_ps((float)((1 << 15) - 1));
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const unsigned char* quats = buffer + i * 6;
+
+        alignas(16) int32_t stored[3][4];
+        for (int lane = 0; lane < 4; lane++) {
+            for (int k = 0; k < 3; k++) {
+                stored[k][lane] = sixByteQuatComponent(quats + lane * 6, k);
+            }
+        }
+
+        alignas(16) float values[4][4];
+        __m128 remaining = ONE;
+        for (int k = 0; k < 3; k++) {
+            __m128 component = _mm_cvtepi32_ps(_mm_load_si128((const __m128i*)stored[k]));
+            component = _mm_sub_ps(_mm_mul_ps(_mm_div_ps(component, RANGE), TWO_MAGNITUDE), MAGNITUDE);
+            remaining = _mm_sub_ps(remaining, _mm_mul_ps(component, component));
+            _mm_store_ps(values[k], component);
+        }
+        // missingComponent is always negative.
+        _mm_store_ps(values[3], _mm_xor_ps(_mm_sqrt_ps(remaining), SIGN));
+
+        for (int lane = 0; lane < 4; lane++) {
+            const uint8_t* sources = SIX_BYTE_QUAT_SOURCES[sixByteQuatLargestComponent(quats + lane * 6)];
+            glm::quat& quatOutput = quatsOutput[i + lane];
+            for (int k = 0; k < 4; k++) {
+                quatOutput[k] = values[sources[k]][lane];
+            }
+        }
+    }
+    for (; i < count; i++) {
+        unpackOrientationQuatFromSixBytes(buffer + i * 6, quatsOutput[i]);
+    }
+    return count * 6;
+}
+
+int packFloatVec3sToSignedTwoByteFixed(unsigned char* destBuffer, const glm::vec3* srcVectors, int count, int radix) {
+    static_assert(sizeof(glm::vec3) == 3 * sizeof(float), "vec3 arrays are packed as arrays of floats");
+    const float* source = &srcVectors[0][0];
+    int16_t* destination = reinterpret_cast<int16_t*>(destBuffer);
+    const __m128 SCALE = _mm_set1_ps((float)(1 << radix));
+    const __m128 MINIMUM = _mm_set1_ps((float)std::numeric_limits<int16_t>::min());
+    const __m128 MAXIMUM = _mm_set1_ps((float)std::numeric_limits<int16_t>::max());
+
+    int numScalars = 3 * count;
+    int i = 0;
+    for (; i + 4 <= numScalars; i += 4) {
+        __m128 scaled = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(source + i), SCALE), MINIMUM), MAXIMUM);
+        __m128i fixed = _mm_cvttps_epi32(scaled);
+        _mm_storel_epi64((__m128i*)(destination + i), _mm_packs_epi32(fixed, fixed));
+    }
+    for (; i < numScalars; i++) {
+        packFloatScalarToSignedTwoByteFixed((unsigned char*)(destination + i), source[i], radix);
+    }
+    return numScalars * (int)sizeof(int16_t);
+}
+
+int unpackFloatVec3sFromSignedTwoByteFixed(const unsigned char* sourceBuffer, glm::vec3* destinations, int count, int radix) {
+    static_assert(sizeof(glm::vec3) == 3 * sizeof(float), "vec3 arrays are unpacked as arrays of floats");
+    const int16_t* source = reinterpret_cast<const int16_t*>(sourceBuffer);
+    float* destination = &destinations[0][0];
+    const __m128 SCALE = _mm_set1_ps((float)(1 << radix));
+
+    int numScalars = 3 * count;
+    int i = 0;
+    for (; i + 4 <= numScalars; i += 4) {
+        __m128i fixed = _mm_loadl_epi64((const __m128i*)(source + i));
+        fixed = _mm_srai_epi32(_mm_unpacklo_epi16(fixed, fixed), 16);
+        _mm_storeu_ps(destination + i, _mm_div_ps(_mm_cvtepi32_ps(fixed), SCALE));
+    }
+    for (; i < numScalars; i++) {
+        unpackFloatScalarFromSignedTwoByteFixed(source + i, destination + i, radix);
+    }
+    return numScalars * (int)sizeof(int16_t);
+}
+
+#elif defined(__aarch64__)
+
+#include <arm_neon.h>
+
+int packOrientationQuatsToSixBytes(unsigned char* buffer, const glm::quat* quatsInput, int count) {
+    const float32x4_t MAGNITUDE = vdupq_n_f32(1.0f / sqrtf(2.0f));
+    const float32x4_t TWO_MAGNITUDE = vdupq_n_f32(2.0f * (1.0f / sqrtf(2.0f)));
+    const float32x4_t RANGE = vdupq_n_f32((float)((1 << 15) - 1));
+    const uint32x4_t SIGN = vdupq_n_u32(0x80000000);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        float32x4x4_t c = vld4q_f32(&quatsInput[i][0]);  // de-interleaves the four quats into components
+
+        // find the largest component, the first of equals like the scalar loop
+        float32x4_t largest = vabsq_f32(c.val[0]);
+        float32x4_t largestValue = c.val[0];
+        uint32x4_t largestComponent = vdupq_n_u32(0);
+        for (int k = 1; k < 4; k++) {
+            float32x4_t magnitude = vabsq_f32(c.val[k]);
+            uint32x4_t isLarger = vcgtq_f32(magnitude, largest);
+            largest = vbslq_f32(isLarger, magnitude, largest);
+            largestValue = vbslq_f32(isLarger, c.val[k], largestValue);
+            largestComponent = vbslq_u32(isLarger, vdupq_n_u32(k), largestComponent);
+        }
+
+        // ensure that the sign of the dropped component is always negative.
+        uint32x4_t flip = vandq_u32(vcgtq_f32(largestValue, vdupq_n_f32(0.0f)), SIGN);
+
+        int32_t quantized[4][4];
+        uint32_t largestComponents[4];
+        for (int k = 0; k < 4; k++) {
+            float32x4_t flipped = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(c.val[k]), flip));
+            float32x4_t value = vdivq_f32(vaddq_f32(flipped, MAGNITUDE), TWO_MAGNITUDE);
+            vst1q_s32(quantized[k], vcvtq_s32_f32(vmulq_f32(value, RANGE)));
+        }
+        vst1q_u32(largestComponents, largestComponent);
+
+        for (int lane = 0; lane < 4; lane++) {
+            int32_t laneQuantized[4] = { quantized[0][lane], quantized[1][lane], quantized[2][lane], quantized[3][lane] };
+            writeSixByteQuat(buffer + (i + lane) * 6, laneQuantized, (uint8_t)largestComponents[lane]);
+        }
+    }
+    for (; i < count; i++) {
+        packOrientationQuatToSixBytes(buffer + i * 6, quatsInput[i]);
+    }
+    return count * 6;
+}
+
+int unpackOrientationQuatsFromSixBytes(const unsigned char* buffer, glm::quat* quatsOutput, int count) {
+    const float32x4_t MAGNITUDE = vdupq_n_f32(1.0f / sqrtf(2.0f));
+    const float32x4_t TWO_MAGNITUDE = vdupq_n_f32(2.0f * (1.0f / sqrtf(2.0f)));
+    const float32x4_t RANGE = vdupq_n_f32((float)((1 << 15) - 1));
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const unsigned char* quats = buffer + i * 6;
+
+        int32_t stored[3][4];
+        for (int lane = 0; lane < 4; lane++) {
+            for (int k = 0; k < 3; k++) {
+                stored[k][lane] = sixByteQuatComponent(quats + lane * 6, k);
+            }
+        }
+
+        float values[4][4];
+        float32x4_t remaining = vdupq_n_f32(1.0f);
+        for (int k = 0; k < 3; k++) {
+            float32x4_t component = vcvtq_f32_s32(vld1q_s32(stored[k]));
+            component = vsubq_f32(vmulq_f32(vdivq_f32(component, RANGE), TWO_MAGNITUDE), MAGNITUDE);
+            remaining = vsubq_f32(remaining, vmulq_f32(component, component));
+            vst1q_f32(values[k], component);
+        }
+        // missingComponent is always negative.
+        vst1q_f32(values[3], vnegq_f32(vsqrtq_f32(remaining)));
+
+        for (int lane = 0; lane < 4; lane++) {
+            const uint8_t* sources = SIX_BYTE_QUAT_SOURCES[sixByteQuatLargestComponent(quats + lane * 6)];
+            glm::quat& quatOutput = quatsOutput[i + lane];
+            for (int k = 0; k < 4; k++) {
+                quatOutput[k] = values[sources[k]][lane];
+            }
+        }
+    }
+    for (; i < count; i++) {
+        unpackOrientationQuatFromSixBytes(buffer + i * 6, quatsOutput[i]);
+    }
+    return count * 6;
+}
+
+int packFloatVec3sToSignedTwoByteFixed(unsigned char* destBuffer, const glm::vec3* srcVectors, int count, int radix) {
+    static_assert(sizeof(glm::vec3) == 3 * sizeof(float), "vec3 arrays are packed as arrays of floats");
+    const float* source = &srcVectors[0][0];
+    int16_t* destination = reinterpret_cast<int16_t*>(destBuffer);
+    const float32x4_t SCALE = vdupq_n_f32((float)(1 << radix));
+    const float32x4_t MINIMUM = vdupq_n_f32((float)std::numeric_limits<int16_t>::min());
+    const float32x4_t MAXIMUM = vdupq_n_f32((float)std::numeric_limits<int16_t>::max());
+
+    int numScalars = 3 * count;
+    int i = 0;
+    for (; i + 4 <= numScalars; i += 4) {
+        float32x4_t scaled = vminq_f32(vmaxq_f32(vmulq_f32(vld1q_f32(source + i), SCALE), MINIMUM), MAXIMUM);
+        vst1_s16(destination + i, vmovn_s32(vcvtq_s32_f32(scaled)));
+    }
+    for (; i < numScalars; i++) {
+        packFloatScalarToSignedTwoByteFixed((unsigned char*)(destination + i), source[i], radix);
+    }
+    return numScalars * (int)sizeof(int16_t);
+}
+
+int unpackFloatVec3sFromSignedTwoByteFixed(const unsigned char* sourceBuffer, glm::vec3* destinations, int count, int radix) {
+    static_assert(sizeof(glm::vec3) == 3 * sizeof(float), "vec3 arrays are unpacked as arrays of floats");
+    const int16_t* source = reinterpret_cast<const int16_t*>(sourceBuffer);
+    float* destination = &destinations[0][0];
+    const float32x4_t SCALE = vdupq_n_f32((float)(1 << radix));
+
+    int numScalars = 3 * count;
+    int i = 0;
+    for (; i + 4 <= numScalars; i += 4) {
+        float32x4_t value = vcvtq_f32_s32(vmovl_s16(vld1_s16(source + i)));
+        vst1q_f32(destination + i, vdivq_f32(value, SCALE));
+    }
+    for (; i < numScalars; i++) {
+        unpackFloatScalarFromSignedTwoByteFixed(source + i, destination + i, radix);
+    }
+    return numScalars * (int)sizeof(int16_t);
+}
+
+#else   // portable reference code
+
+int packOrientationQuatsToSixBytes(unsigned char* buffer, const glm::quat* quatsInput, int count) {
+    for (int i = 0; i < count; i++) {
+        packOrientationQuatToSixBytes(buffer + i * 6, quatsInput[i]);
+    }
+    return count * 6;
+}
+
+int unpackOrientationQuatsFromSixBytes(const unsigned char* buffer, glm::quat* quatsOutput, int count) {
+    for (int i = 0; i < count; i++) {
+        unpackOrientationQuatFromSixBytes(buffer + i * 6, quatsOutput[i]);
+    }
+    return count * 6;
+}
+
+int packFloatVec3sToSignedTwoByteFixed(unsigned char* destBuffer, const glm::vec3* srcVectors, int count, int radix) {
+    for (int i = 0; i < count; i++) {
+        destBuffer += packFloatVec3ToSignedTwoByteFixed(destBuffer, srcVectors[i], radix);
+    }
+    return count * 3 * (int)sizeof(int16_t);
+}
+
+int unpackFloatVec3sFromSignedTwoByteFixed(const unsigned char* sourceBuffer, glm::vec3* destinations, int count, int radix) {
+    for (int i = 0; i < count; i++) {
+        sourceBuffer += unpackFloatVec3FromSignedTwoByteFixed(sourceBuffer, destinations[i], radix);
+    }
+    return count * 3 * (int)sizeof(int16_t);
+}
+
+#endif
+
 bool closeEnough(float a, float b, float relativeError) {
     assert(relativeError >= 0.0f);
     // NOTE: we add EPSILON to the denominator so we can avoid checking for division by zero.
@@ -117,6 +117,9 @@ int unpackOrientationQuatFromBytes(const unsigned char* buffer, glm::quat& quatO
 // error of +- 4.3e-5 error per compoenent.
 int packOrientationQuatToSixBytes(unsigned char* buffer, const glm::quat& quatInput);
 int unpackOrientationQuatFromSixBytes(const unsigned char* buffer, glm::quat& quatOutput);
+// the same packing for count rotations back to back, four at a time with SIMD where it is available
+int packOrientationQuatsToSixBytes(unsigned char* buffer, const glm::quat* quatsInput, int count);
+int unpackOrientationQuatsFromSixBytes(const unsigned char* buffer, glm::quat* quatsOutput, int count);
 
 // Ratios need the be highly accurate when less than 10, but not very accurate above 10, and they
 // are never greater than 1000 to 1, this allows us to encode each component in 16bits
@@ -139,6 +142,8 @@ int unpackFloatScalarFromSignedTwoByteFixed(const int16_t* byteFixedPointer, flo
 // A convenience for sending vec3's as fixed-point floats
 int packFloatVec3ToSignedTwoByteFixed(unsigned char* destBuffer, const glm::vec3& srcVector, int radix);
 int unpackFloatVec3FromSignedTwoByteFixed(const unsigned char* sourceBuffer, glm::vec3& destination, int radix);
+int packFloatVec3sToSignedTwoByteFixed(unsigned char* destBuffer, const glm::vec3* srcVectors, int count, int radix);
+int unpackFloatVec3sFromSignedTwoByteFixed(const unsigned char* sourceBuffer, glm::vec3* destinations, int count, int radix);
 
 bool closeEnough(float a, float b, float relativeError);
 
@@ -11,6 +11,8 @@
 
 #include "Gzip.h"
 
+#include <QIODevice>
+
 #include <zlib.h>
 
 const int GZIP_WINDOWS_BIT = 31;
@@ -153,3 +155,141 @@ bool gzip(QByteArray source, QByteArray &destination, int compressionLevel) {
     deflateEnd(&strm);
     return status == Z_STREAM_END;
 }
+
+GzipWriter::GzipWriter(QIODevice& device, int compressionLevel) :
+    _device(device),
+    _stream(new z_stream())
+{
+    _stream->zalloc = Z_NULL;
+    _stream->zfree = Z_NULL;
+    _stream->opaque = Z_NULL;
+    _stream->next_in = Z_NULL;
+    _stream->avail_in = 0;
+
+    int status = deflateInit2(_stream.get(),
+                              qMax(Z_DEFAULT_COMPRESSION, qMin(9, compressionLevel)),
+                              Z_DEFLATED,
+                              GZIP_WINDOWS_BIT,
+                              DEFAULT_MEM_LEVEL,
+                              Z_DEFAULT_STRATEGY);
+    _isValid = status == Z_OK;
+}
+
+GzipWriter::~GzipWriter() {
+    if (_isValid) {
+        deflateEnd(_stream.get());
+    }
+}
+
+bool GzipWriter::write(const char* data, int size) {
+    if (!_isValid) {
+        return false;
+    }
+
+    _stream->next_in = reinterpret_cast<unsigned char*>(const_cast<char*>(data));
+    _stream->avail_in = size;
+    return deflateToDevice(Z_NO_FLUSH);
+}
+
+bool GzipWriter::finish() {
+    if (!_isValid) {
+        return false;
+    }
+
+    _stream->next_in = Z_NULL;
+    _stream->avail_in = 0;
+    bool success = deflateToDevice(Z_FINISH);
+
+    deflateEnd(_stream.get());
+    _isValid = false;
+    return success;
+}
+
+bool GzipWriter::deflateToDevice(int flush) {
+    do {
+        char out[GZIP_CHUNK_SIZE];
+        _stream->next_out = (unsigned char*)out;
+        _stream->avail_out = GZIP_CHUNK_SIZE;
+        if (deflate(_stream.get(), flush) == Z_STREAM_ERROR) {
+            return false;
+        }
+
+        int available = (GZIP_CHUNK_SIZE - _stream->avail_out);
+        if (available > 0 && _device.write(out, available) != available) {
+            return false;
+        }
+    } while (_stream->avail_out == 0);
+
+    return true;
+}
+
+bool zlibCompressWithDictionary(const QByteArray& source, QByteArray& destination, const QByteArray& dictionary,
+                                int compressionLevel) {
+    destination.clear();
+
+    z_stream strm {};
+    if (deflateInit(&strm, compressionLevel) != Z_OK) {
+        return false;
+    }
+    if (!dictionary.isEmpty() &&
+        deflateSetDictionary(&strm, (const unsigned char*)dictionary.constData(), dictionary.size()) != Z_OK) {
+        deflateEnd(&strm);
+        return false;
+    }
+
+    // big enough for the whole stream, so that it is done in one call
+    destination.resize((int)deflateBound(&strm, source.size()));
+    strm.next_in = (unsigned char*)source.constData();
+    strm.avail_in = source.size();
+    strm.next_out = (unsigned char*)destination.data();
+    strm.avail_out = destination.size();
+
+    int status = deflate(&strm, Z_FINISH);
+    deflateEnd(&strm);
+
+    if (status != Z_STREAM_END) {
+        destination.clear();
+        return false;
+    }
+    destination.resize((int)strm.total_out);
+    return true;
+}
+
+bool zlibUncompressWithDictionary(const QByteArray& source, QByteArray& destination, const QByteArray& dictionary) {
+    destination.clear();
+
+    z_stream strm {};
+    if (inflateInit(&strm) != Z_OK) {
+        return false;
+    }
+
+    strm.next_in = (unsigned char*)source.constData();
+    strm.avail_in = source.size();
+
+    int status = Z_OK;
+    while (status != Z_STREAM_END) {
+        destination.resize((int)strm.total_out + GZIP_CHUNK_SIZE);
+        strm.next_out = (unsigned char*)destination.data() + strm.total_out;
+        strm.avail_out = GZIP_CHUNK_SIZE;
+
+        status = inflate(&strm, Z_NO_FLUSH);
+        if (status == Z_NEED_DICT) {
+            status = inflateSetDictionary(&strm, (const unsigned char*)dictionary.constData(), dictionary.size());
+        }
+
+        // a buffer error with room left to write means the stream was cut short
+        if (status != Z_OK && status != Z_STREAM_END && !(status == Z_BUF_ERROR && strm.avail_out == 0)) {
+            inflateEnd(&strm);
+            destination.clear();
+            return false;
+        }
+    }
+
+    destination.resize((int)strm.total_out);
+    inflateEnd(&strm);
+    return true;
+}
+
+uint32_t getZlibDictionaryID(const QByteArray& dictionary) {
+    return (uint32_t)adler32(adler32(0L, Z_NULL, 0), (const unsigned char*)dictionary.constData(), dictionary.size());
+}
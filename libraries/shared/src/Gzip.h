@@ -12,8 +12,14 @@
 #ifndef GZIP_H
 #define GZIP_H
 
+#include <cstdint>
+#include <memory>
+
 #include <QByteArray>
 
+class QIODevice;
+struct z_stream_s;
+
 // The compression level must be Z_DEFAULT_COMPRESSION (-1), or between 0 and
 // 9: 1 gives best speed, 9 gives best compression, 0 gives no
 // compression at all (the input data is simply copied a block at a
@@ -24,4 +30,32 @@ bool gzip(QByteArray source, QByteArray &destination, int compressionLevel = -1)
 
 bool gunzip(QByteArray source, QByteArray &destination);
 
+// Compresses to a zlib stream primed with a preset dictionary, which only pays off on small inputs that share a lot
+// with it. The same dictionary is needed to uncompress the stream.
+bool zlibCompressWithDictionary(const QByteArray& source, QByteArray& destination, const QByteArray& dictionary,
+                                int compressionLevel = -1);
+bool zlibUncompressWithDictionary(const QByteArray& source, QByteArray& destination, const QByteArray& dictionary);
+
+// the checksum zlib identifies a dictionary by, for both ends of a connection to check they have the same one
+uint32_t getZlibDictionaryID(const QByteArray& dictionary);
+
+// Compresses into device as the data is written, rather than all at once like gzip() does.
+// Nothing is complete until finish() is called.
+class GzipWriter {
+public:
+    GzipWriter(QIODevice& device, int compressionLevel = -1);
+    ~GzipWriter();
+
+    bool write(const char* data, int size);
+    bool write(const QByteArray& data) { return write(data.constData(), data.size()); }
+    bool finish();
+
+private:
+    bool deflateToDevice(int flush);
+
+    QIODevice& _device;
+    std::unique_ptr<z_stream_s> _stream;
+    bool _isValid { false };
+};
+
 #endif
@@ -0,0 +1,118 @@
+//
+//  MPSCRingBuffer.h
+//  libraries/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_MPSCRingBuffer_h
+#define vircadia_MPSCRingBuffer_h
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// A bounded, lock-free queue that any number of threads can push to and a single thread pops from.
+//
+// Each cell carries a sequence number that tells a pusher whether the cell is free for its position and tells the
+// popper whether the item in it has been written yet, so neither side takes a lock or allocates per item.
+// The capacity is rounded up to a power of two.
+template <typename T>
+class MPSCRingBuffer {
+public:
+    explicit MPSCRingBuffer(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        _mask = size - 1;
+        _cells.reset(new Cell[size]);
+        for (size_t i = 0; i < size; ++i) {
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MPSCRingBuffer(const MPSCRingBuffer&) = delete;
+    MPSCRingBuffer& operator=(const MPSCRingBuffer&) = delete;
+
+    // returns false, leaving item alone, if the buffer is full
+    bool push(T&& item) {
+        size_t position = _pushPosition.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &_cells[position & _mask];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+            if (difference == 0) {
+                if (_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = _pushPosition.load(std::memory_order_relaxed);
+            }
+        }
+        cell->item = std::move(item);
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    // to be called from the consumer thread only
+    bool pop(T& item) {
+        size_t position = _popPosition.load(std::memory_order_relaxed);
+        Cell& cell = _cells[position & _mask];
+        if (cell.sequence.load(std::memory_order_acquire) != position + 1) {
+            return false;
+        }
+        item = std::move(cell.item);
+        cell.item = T();
+        cell.sequence.store(position + _mask + 1, std::memory_order_release);
+        _popPosition.store(position + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // appends up to maxItems to items, returning how many were popped; consumer thread only
+    size_t popBatch(std::vector<T>& items, size_t maxItems) {
+        size_t count = 0;
+        T item;
+        while (count < maxItems && pop(item)) {
+            items.push_back(std::move(item));
+            ++count;
+        }
+        return count;
+    }
+
+    // approximate while other threads are pushing or popping
+    size_t size() const {
+        size_t pushed = _pushPosition.load(std::memory_order_relaxed);
+        size_t popped = _popPosition.load(std::memory_order_relaxed);
+        return pushed > popped ? pushed - popped : 0;
+    }
+    bool empty() const { return size() == 0; }
+    size_t capacity() const { return _mask + 1; }
+
+private:
+    static const size_t CACHE_LINE_SIZE = 64;
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T item;
+    };
+
+    std::unique_ptr<Cell[]> _cells;
+    size_t _mask;
+
+    // the positions are kept on separate cache lines so that pushers and the popper don't share one
+    char _padding0[CACHE_LINE_SIZE];
+    std::atomic<size_t> _pushPosition { 0 };
+    char _padding1[CACHE_LINE_SIZE - sizeof(std::atomic<size_t>)];
+    std::atomic<size_t> _popPosition { 0 };
+};
+
+#endif // vircadia_MPSCRingBuffer_h
@@ -0,0 +1,56 @@
+//
+//  MemoryAccounting.cpp
+//  libraries/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "MemoryAccounting.h"
+
+#include "MetricsRegistry.h"
+
+MemoryAccounting::Total MemoryAccounting::_totals[MemoryAccounting::NUM_TAGS];
+
+const char* MemoryAccounting::getTagName(Tag tag) {
+    switch (tag) {
+        case PacketBuffers:
+            return "packet_buffers";
+        case OctreeElements:
+            return "octree_elements";
+        case Entities:
+            return "entities";
+        case Resources:
+            return "resources";
+        case GPUSysmem:
+            return "gpu_sysmem";
+        default:
+            return "unknown";
+    }
+}
+
+QJsonObject MemoryAccounting::sampleStats() {
+    QJsonObject stats;
+    for (int i = 0; i < NUM_TAGS; ++i) {
+        QJsonObject tagStats;
+        tagStats["bytes"] = (double)_totals[i].bytes.load(std::memory_order_relaxed);
+        tagStats["allocations"] = (double)_totals[i].allocations.exchange(0, std::memory_order_relaxed);
+        tagStats["releases"] = (double)_totals[i].releases.exchange(0, std::memory_order_relaxed);
+        stats[getTagName((Tag)i)] = tagStats;
+    }
+    return stats;
+}
+
+void MemoryAccounting::updateMetrics() {
+    static MetricsRegistry::Gauge* gauges[NUM_TAGS] = { nullptr };
+    auto& metrics = MetricsRegistry::getInstance();
+    for (int i = 0; i < NUM_TAGS; ++i) {
+        if (!gauges[i]) {
+            gauges[i] = &metrics.gauge(QString("memory_%1_bytes").arg(getTagName((Tag)i)),
+                                       QString("Bytes of heap memory held by %1.").arg(getTagName((Tag)i)));
+        }
+        gauges[i]->set((double)getBytes((Tag)i));
+    }
+}
@@ -0,0 +1,69 @@
+//
+//  MemoryAccounting.h
+//  libraries/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_MemoryAccounting_h
+#define vircadia_MemoryAccounting_h
+
+#include <atomic>
+#include <cstdint>
+
+#include <QtCore/QJsonObject>
+
+// Keeps count of the heap memory held by each subsystem, so that the growth of a long running process can be put down
+// to one of them.
+//
+// The subsystems report what they take and give back as they do it, from any thread. Each total is only as complete
+// as the places that report to it, see the tags.
+class MemoryAccounting {
+public:
+    enum Tag {
+        PacketBuffers = 0, // packet buffers held by udt::PacketBufferPool, in use or free
+        OctreeElements,    // the slabs tree elements are allocated from
+        Entities,          // entity objects, at the size of an EntityItem
+        Resources,         // the content of the resources in the ResourceCaches
+        GPUSysmem,         // the system memory copies of gpu buffers and textures
+        NUM_TAGS
+    };
+
+    static void add(Tag tag, int64_t bytes) {
+        _totals[tag].bytes.fetch_add(bytes, std::memory_order_relaxed);
+        _totals[tag].allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    static void remove(Tag tag, int64_t bytes) {
+        _totals[tag].bytes.fetch_sub(bytes, std::memory_order_relaxed);
+        _totals[tag].releases.fetch_add(1, std::memory_order_relaxed);
+    }
+    static void update(Tag tag, int64_t previousBytes, int64_t newBytes) {
+        if (newBytes > previousBytes) {
+            add(tag, newBytes - previousBytes);
+        } else if (newBytes < previousBytes) {
+            remove(tag, previousBytes - newBytes);
+        }
+    }
+
+    static int64_t getBytes(Tag tag) { return _totals[tag].bytes.load(std::memory_order_relaxed); }
+    static const char* getTagName(Tag tag);
+
+    // the bytes held under each tag, with the allocations and releases since the last call
+    static QJsonObject sampleStats();
+
+    // updates the memory_bytes gauges of the MetricsRegistry
+    static void updateMetrics();
+
+private:
+    struct Total {
+        std::atomic<int64_t> bytes { 0 };
+        std::atomic<uint64_t> allocations { 0 };
+        std::atomic<uint64_t> releases { 0 };
+    };
+    static Total _totals[NUM_TAGS];
+};
+
+#endif // vircadia_MemoryAccounting_h
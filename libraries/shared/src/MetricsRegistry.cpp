@@ -0,0 +1,138 @@
+//
+//  MetricsRegistry.cpp
+//  libraries/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "MetricsRegistry.h"
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+#include <QtCore/QTextStream>
+
+void MetricsRegistry::Counter::increment(quint64 amount) {
+    // each thread keeps to the same shard
+    static thread_local size_t shard = std::hash<std::thread::id>()(std::this_thread::get_id()) % NUM_SHARDS;
+    _shards[shard].value.fetch_add(amount, std::memory_order_relaxed);
+}
+
+quint64 MetricsRegistry::Counter::get() const {
+    quint64 value = 0;
+    for (const auto& shard : _shards) {
+        value += shard.value.load(std::memory_order_relaxed);
+    }
+    return value;
+}
+
+static void addToAtomic(std::atomic<double>& atomic, double amount) {
+    double value = atomic.load(std::memory_order_relaxed);
+    while (!atomic.compare_exchange_weak(value, value + amount, std::memory_order_relaxed)) {
+    }
+}
+
+void MetricsRegistry::Gauge::add(double amount) {
+    addToAtomic(_value, amount);
+}
+
+MetricsRegistry::Histogram::Histogram(const std::vector<double>& bucketBounds) :
+    _bucketBounds(bucketBounds),
+    _bucketCounts(new std::atomic<quint64>[bucketBounds.size() + 1])
+{
+    for (size_t i = 0; i <= _bucketBounds.size(); ++i) {
+        _bucketCounts[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+void MetricsRegistry::Histogram::observe(double value) {
+    size_t bucket = std::lower_bound(_bucketBounds.begin(), _bucketBounds.end(), value) - _bucketBounds.begin();
+    _bucketCounts[bucket].fetch_add(1, std::memory_order_relaxed);
+    _count.fetch_add(1, std::memory_order_relaxed);
+    addToAtomic(_sum, value);
+}
+
+MetricsRegistry& MetricsRegistry::getInstance() {
+    static MetricsRegistry instance;
+    return instance;
+}
+
+MetricsRegistry::Metric& MetricsRegistry::getMetric(const QString& name, const QString& help) {
+    Metric& metric = _metrics[name];
+    if (metric.help.isEmpty()) {
+        metric.help = help;
+    }
+    return metric;
+}
+
+MetricsRegistry::Counter& MetricsRegistry::counter(const QString& name, const QString& help) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    Metric& metric = getMetric(name, help);
+    Q_ASSERT(!metric.gauge && !metric.histogram);
+    if (!metric.counter) {
+        metric.counter.reset(new Counter());
+    }
+    return *metric.counter;
+}
+
+MetricsRegistry::Gauge& MetricsRegistry::gauge(const QString& name, const QString& help) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    Metric& metric = getMetric(name, help);
+    Q_ASSERT(!metric.counter && !metric.histogram);
+    if (!metric.gauge) {
+        metric.gauge.reset(new Gauge());
+    }
+    return *metric.gauge;
+}
+
+MetricsRegistry::Histogram& MetricsRegistry::histogram(const QString& name, const QString& help,
+                                                       const std::vector<double>& bucketBounds) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    Metric& metric = getMetric(name, help);
+    Q_ASSERT(!metric.counter && !metric.gauge);
+    if (!metric.histogram) {
+        metric.histogram.reset(new Histogram(bucketBounds));
+    }
+    return *metric.histogram;
+}
+
+QByteArray MetricsRegistry::toPrometheusText() const {
+    QString output;
+    QTextStream stream(&output);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (const auto& entry : _metrics) {
+        const QString& name = entry.first;
+        const Metric& metric = entry.second;
+
+        stream << "# HELP " << name << " " << metric.help << "\n";
+        if (metric.counter) {
+            stream << "# TYPE " << name << " counter\n";
+            stream << name << " " << metric.counter->get() << "\n";
+        } else if (metric.gauge) {
+            stream << "# TYPE " << name << " gauge\n";
+            stream << name << " " << metric.gauge->get() << "\n";
+        } else if (metric.histogram) {
+            const Histogram& histogram = *metric.histogram;
+            stream << "# TYPE " << name << " histogram\n";
+
+            quint64 cumulativeCount = 0;
+            const auto& bounds = histogram.getBucketBounds();
+            for (size_t i = 0; i < bounds.size(); ++i) {
+                cumulativeCount += histogram.getBucketCount(i);
+                stream << name << "_bucket{le=\"" << bounds[i] << "\"} " << cumulativeCount << "\n";
+            }
+            cumulativeCount += histogram.getBucketCount(bounds.size());
+            stream << name << "_bucket{le=\"+Inf\"} " << cumulativeCount << "\n";
+            stream << name << "_sum " << histogram.getSum() << "\n";
+            stream << name << "_count " << cumulativeCount << "\n";
+        }
+    }
+
+    stream.flush();
+    return output.toUtf8();
+}
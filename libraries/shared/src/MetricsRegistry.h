@@ -0,0 +1,100 @@
+//
+//  MetricsRegistry.h
+//  libraries/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_MetricsRegistry_h
+#define vircadia_MetricsRegistry_h
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+
+// The process' counters, gauges and histograms, rendered in the Prometheus text exposition format.
+//
+// Metrics are registered once by name and then updated from any thread without locking. Registering a name again returns
+// the same metric, so the code updating one can keep a reference to it, they're never destroyed.
+class MetricsRegistry {
+public:
+    // A count that only goes up, split over a few shards so that the threads adding to it don't contend for it.
+    class Counter {
+    public:
+        void increment(quint64 amount = 1);
+        quint64 get() const;
+
+    private:
+        static const int NUM_SHARDS = 8;
+        struct Shard {
+            std::atomic<quint64> value { 0 };
+            char padding[64 - sizeof(std::atomic<quint64>)]; // one cache line each
+        };
+        Shard _shards[NUM_SHARDS];
+    };
+
+    // A value that can go up or down.
+    class Gauge {
+    public:
+        void set(double value) { _value.store(value, std::memory_order_relaxed); }
+        void add(double amount);
+        double get() const { return _value.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<double> _value { 0.0 };
+    };
+
+    // Counts of observed values in buckets with fixed upper bounds, and their sum.
+    class Histogram {
+    public:
+        Histogram(const std::vector<double>& bucketBounds);
+
+        void observe(double value);
+
+        const std::vector<double>& getBucketBounds() const { return _bucketBounds; }
+        quint64 getBucketCount(size_t bucket) const { return _bucketCounts[bucket].load(std::memory_order_relaxed); }
+        quint64 getCount() const { return _count.load(std::memory_order_relaxed); }
+        double getSum() const { return _sum.load(std::memory_order_relaxed); }
+
+    private:
+        const std::vector<double> _bucketBounds; // ascending, the last bucket of all values is implied
+        std::unique_ptr<std::atomic<quint64>[]> _bucketCounts; // not cumulative, they're summed when rendered
+        std::atomic<quint64> _count { 0 };
+        std::atomic<double> _sum { 0.0 };
+    };
+
+    static MetricsRegistry& getInstance();
+
+    // names must be valid Prometheus metric names, e.g. "audio_mixer_mix_usecs"
+    Counter& counter(const QString& name, const QString& help);
+    Gauge& gauge(const QString& name, const QString& help);
+    Histogram& histogram(const QString& name, const QString& help, const std::vector<double>& bucketBounds);
+
+    QByteArray toPrometheusText() const;
+
+private:
+    MetricsRegistry() {}
+
+    class Metric {
+    public:
+        QString help;
+        std::unique_ptr<Counter> counter;
+        std::unique_ptr<Gauge> gauge;
+        std::unique_ptr<Histogram> histogram;
+    };
+
+    Metric& getMetric(const QString& name, const QString& help);
+
+    mutable std::mutex _mutex; // only guards the map, not the metrics' values
+    std::map<QString, Metric> _metrics;
+};
+
+#endif // vircadia_MetricsRegistry_h
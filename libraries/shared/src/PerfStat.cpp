@@ -11,9 +11,12 @@
 
 #include "PerfStat.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
 
 #include <QDebug>
 #include <QThread>
@@ -79,32 +82,119 @@ void PerformanceTimerRecord::tallyResult(const quint64& now) {
 // PerformanceTimer
 // ----------------------------------------------------------------------------
 
+// The timers in progress on a thread, and the times of the ones that have finished by the names they were nested in.
+class PerformanceTimer::ThreadTimers {
+public:
+    class Slot {
+    public:
+        QString fullName;
+        std::atomic<quint64> totalUsecs { 0 };
+        std::atomic<quint64> numCalls { 0 };
+
+        // what has been gathered into the records so far, with PerformanceTimer::_mutex locked
+        quint64 gatheredUsecs { 0 };
+        quint64 gatheredCalls { 0 };
+    };
+
+    ThreadTimers() {
+        std::lock_guard<std::mutex> guard(PerformanceTimer::_mutex);
+        PerformanceTimer::_threadTimers.push_back(this);
+    }
+
+    ~ThreadTimers() {
+        std::lock_guard<std::mutex> guard(PerformanceTimer::_mutex);
+        gather();
+        auto& threadTimers = PerformanceTimer::_threadTimers;
+        threadTimers.erase(std::remove(threadTimers.begin(), threadTimers.end(), this), threadTimers.end());
+    }
+
+    QString getContextName() const {
+        QString fullName;
+        for (auto name : names) {
+            fullName.append("/");
+            fullName.append(name);
+        }
+        return fullName;
+    }
+
+    Slot& getSlot() {
+        // only this thread adds slots, so it can look them up without locking
+        auto it = slots.find(contextIDs.back());
+        if (it != slots.end()) {
+            return *it->second;
+        }
+        std::unique_ptr<Slot> slot(new Slot());
+        slot->fullName = getContextName();
+        std::lock_guard<std::mutex> guard(slotsMutex);
+        return *slots.emplace(contextIDs.back(), std::move(slot)).first->second;
+    }
+
+    // with PerformanceTimer::_mutex locked
+    void gather() {
+        std::lock_guard<std::mutex> guard(slotsMutex);
+        for (auto& entry : slots) {
+            Slot& slot = *entry.second;
+            quint64 numCalls = slot.numCalls.load(std::memory_order_relaxed);
+            quint64 totalUsecs = slot.totalUsecs.load(std::memory_order_relaxed);
+            if (numCalls != slot.gatheredCalls) {
+                PerformanceTimer::_records[slot.fullName].accumulateResult(totalUsecs - slot.gatheredUsecs,
+                    numCalls - slot.gatheredCalls);
+                slot.gatheredCalls = numCalls;
+                slot.gatheredUsecs = totalUsecs;
+            }
+        }
+    }
+
+    std::vector<const char*> names;
+    std::vector<quint64> contextIDs { 0 }; // the ids of the nestings of names, the outermost one is no timer at all
+
+    std::unordered_map<quint64, std::unique_ptr<Slot>> slots; // by context id
+    std::mutex slotsMutex; // held to add slots, and by other threads to read them
+};
+
 std::atomic<bool> PerformanceTimer::_isActive(false);
 std::mutex PerformanceTimer::_mutex;
-QHash<QThread*, QString> PerformanceTimer::_fullNames;
+std::vector<PerformanceTimer::ThreadTimers*> PerformanceTimer::_threadTimers;
 QMap<QString, PerformanceTimerRecord> PerformanceTimer::_records;
 
-PerformanceTimer::PerformanceTimer(const QString& name) {
+PerformanceTimer::PerformanceTimer(const char* name) :
+    PerformanceTimer(name, _isActive ? hashPerformanceTimerName(name) : 0) {
+}
+
+PerformanceTimer::PerformanceTimer(const char* name, quint64 nameId) {
     if (_isActive) {
-        _name = name;
-        {
-            std::lock_guard<std::mutex> guard(_mutex);
-            QString& fullName = _fullNames[QThread::currentThread()];
-            fullName.append("/");
-            fullName.append(_name);
-        }
+        ThreadTimers& timers = getThreadTimers();
+        timers.names.push_back(name);
+        const quint64 FNV_PRIME = 1099511628211ull;
+        timers.contextIDs.push_back((timers.contextIDs.back() ^ nameId) * FNV_PRIME);
         _start = usecTimestampNow();
     }
 }
 
 PerformanceTimer::~PerformanceTimer() {
-    if (_isActive && _start != 0) {
+    if (_start != 0) {
         quint64 elapsedUsec = (usecTimestampNow() - _start);
-        std::lock_guard<std::mutex> guard(_mutex);
-        QString& fullName = _fullNames[QThread::currentThread()];
-        PerformanceTimerRecord& namedRecord = _records[fullName];
-        namedRecord.accumulateResult(elapsedUsec);
-        fullName.resize(fullName.size() - (_name.size() + 1));
+        ThreadTimers& timers = getThreadTimers();
+        if (_isActive) {
+            ThreadTimers::Slot& slot = timers.getSlot();
+            slot.totalUsecs.fetch_add(elapsedUsec, std::memory_order_relaxed);
+            slot.numCalls.fetch_add(1, std::memory_order_relaxed);
+        }
+        timers.names.pop_back();
+        timers.contextIDs.pop_back();
+    }
+}
+
+// static
+PerformanceTimer::ThreadTimers& PerformanceTimer::getThreadTimers() {
+    thread_local ThreadTimers timers;
+    return timers;
+}
+
+// static
+void PerformanceTimer::gatherThreadTimers() {
+    for (auto timers : _threadTimers) {
+        timers->gather();
     }
 }
 
@@ -115,8 +205,7 @@ bool PerformanceTimer::isActive() {
 
 // static
 QString PerformanceTimer::getContextName() {
-    std::lock_guard<std::mutex> guard(_mutex);
-    return _fullNames[QThread::currentThread()];
+    return getThreadTimers().getContextName();
 }
 
 // static
@@ -132,7 +221,7 @@ void PerformanceTimer::setActive(bool active) {
         _isActive.store(active);
         if (!active) {
             std::lock_guard<std::mutex> guard(_mutex);
-            _fullNames.clear();
+            gatherThreadTimers();
             _records.clear();
         }
 
@@ -143,12 +232,14 @@ void PerformanceTimer::setActive(bool active) {
 // static
 QMap<QString, PerformanceTimerRecord> PerformanceTimer::getAllTimerRecords() {
     std::lock_guard<std::mutex> guard(_mutex);
+    gatherThreadTimers();
     return _records;
 };
 
 // static
 void PerformanceTimer::tallyAllTimerRecords() {
     std::lock_guard<std::mutex> guard(_mutex);
+    gatherThreadTimers();
     QMap<QString, PerformanceTimerRecord>::iterator recordsItr = _records.begin();
     QMap<QString, PerformanceTimerRecord>::const_iterator recordsEnd = _records.end();
     quint64 now = usecTimestampNow();
@@ -165,6 +256,7 @@ void PerformanceTimer::tallyAllTimerRecords() {
 
 void PerformanceTimer::dumpAllTimerRecords() {
     std::lock_guard<std::mutex> guard(_mutex);
+    gatherThreadTimers();
     QMapIterator<QString, PerformanceTimerRecord> i(_records);
     while (i.hasNext()) {
         i.next();
@@ -23,6 +23,8 @@
 #include <cstring>
 #include <string>
 #include <map>
+#include <mutex>
+#include <vector>
 
 using AtomicUIntStat = std::atomic<uintmax_t>;
 
@@ -57,7 +59,7 @@ class PerformanceTimerRecord {
 public:
     PerformanceTimerRecord() : _runningTotal(0), _lastTotal(0), _numAccumulations(0), _numTallies(0), _expiry(0) {}
 
-    void accumulateResult(const quint64& elapsed) { _runningTotal += elapsed; ++_numAccumulations; }
+    void accumulateResult(const quint64& elapsed, quint64 numCalls = 1) { _runningTotal += elapsed; _numAccumulations += numCalls; }
     void tallyResult(const quint64& now);
     bool isStale(const quint64& now) const { return now > _expiry; }
     quint64 getAverage() const { return (_numTallies == 0) ? 0 : _runningTotal / _numTallies; }
@@ -73,10 +75,20 @@ private:
     SimpleMovingAverage _movingAverage;
 };
 
+// FNV-1a, so that the ids of timers named by literals are worked out at compile time
+constexpr quint64 hashPerformanceTimerName(const char* name, quint64 hash = 14695981039346656037ull) {
+    return *name ? hashPerformanceTimerName(name + 1, (hash ^ (quint64)(unsigned char)*name) * 1099511628211ull) : hash;
+}
+
+// Times the scope it's declared in, into a record named by the names of the timers it's nested in on its thread.
+//
+// Each thread adds the times of its timers to slots of its own, by the id of their nesting, without locking. The slots of
+// every thread are only added up into records when the records are tallied or read.
 class PerformanceTimer {
 public:
 
-    PerformanceTimer(const QString& name);
+    PerformanceTimer(const char* name);
+    PerformanceTimer(const char* name, quint64 nameId); // nameId is the hash of the name
     ~PerformanceTimer();
 
     static bool isActive();
@@ -89,19 +101,27 @@ public:
     static void dumpAllTimerRecords();
 
 private:
+    class ThreadTimers;
+
+    static ThreadTimers& getThreadTimers();
+    static void gatherThreadTimers(); // with _mutex locked
+
     quint64 _start = 0;
-    QString _name;
     static std::atomic<bool> _isActive;
 
-    static std::mutex _mutex;  // used to guard multi-threaded access to _fullNames and _records
-    static QHash<QThread*, QString> _fullNames;
+    static std::mutex _mutex;  // used to guard multi-threaded access to _threadTimers and _records
+    static std::vector<ThreadTimers*> _threadTimers;
     static QMap<QString, PerformanceTimerRecord> _records;
 };
 
+#define PERFORMANCE_TIMER(name) \
+    constexpr quint64 performanceTimerNameId = hashPerformanceTimerName(name); \
+    PerformanceTimer performanceTimer(name, performanceTimerNameId);
+
 // uncomment WANT_DETAILED_PERFORMANCE_TIMERS definition to enable performance timers in high-frequency contexts
 //#define WANT_DETAILED_PERFORMANCE_TIMERS
 #ifdef WANT_DETAILED_PERFORMANCE_TIMERS
-    #define DETAILED_PERFORMANCE_TIMER(name) PerformanceTimer detailedPerformanceTimer(name);
+    #define DETAILED_PERFORMANCE_TIMER(name) PERFORMANCE_TIMER(name)
 #else // WANT_DETAILED_PERFORMANCE_TIMERS
     #define DETAILED_PERFORMANCE_TIMER(name) ; // no-op
 #endif // WANT_DETAILED_PERFORMANCE_TIMERS
@@ -315,11 +315,16 @@ template<typename Enum> inline PropertyFlags<Enum>& PropertyFlags<Enum>::operato
 }
 
 template<typename Enum> inline PropertyFlags<Enum>& PropertyFlags<Enum>::operator+=(const PropertyFlags& other) {
-    for(int flag = (int)other.firstFlag(); flag <= (int)other.lastFlag(); flag++) {
-        if (other.getHasProperty((Enum)flag)) {
-            setHasProperty((Enum)flag, true);
-        }
+    // a word at a time rather than a flag at a time, this is how property sets get merged on every edit
+    if (other._maxFlag < 0) {
+        return *this;
+    }
+    if (_flags.size() < other._flags.size()) {
+        _flags.resize(other._flags.size());
     }
+    _flags |= other._flags;
+    _maxFlag = std::max(_maxFlag, other._maxFlag);
+    _minFlag = std::min(_minFlag, other._minFlag);
     return *this; 
 }
 
@@ -329,11 +334,18 @@ template<typename Enum> inline PropertyFlags<Enum>& PropertyFlags<Enum>::operato
 }
 
 template<typename Enum> inline PropertyFlags<Enum>& PropertyFlags<Enum>::operator-=(const PropertyFlags& other) {
-    for(int flag = (int)other.firstFlag(); flag <= (int)other.lastFlag(); flag++) {
-        if (other.getHasProperty((Enum)flag)) {
-            setHasProperty((Enum)flag, false);
-        }
+    if (other._maxFlag < 0 || _maxFlag < 0) {
+        return *this;
+    }
+    // clear the other's flags a word at a time, keeping the ones past the end of the other's
+    int size = _flags.size();
+    QBitArray mask = ~other._flags;
+    mask.resize(size);
+    if (other._flags.size() < size) {
+        mask.fill(true, other._flags.size(), size);
     }
+    _flags &= mask;
+    shrinkIfNeeded();
     return *this;
 }
 
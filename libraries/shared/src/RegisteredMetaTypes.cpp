@@ -13,6 +13,7 @@
 
 #include <glm/gtc/quaternion.hpp>
 
+#include <QtCore/QPointer>
 #include <QtCore/QUrl>
 #include <QtCore/QUuid>
 #include <QtCore/QRect>
@@ -22,6 +23,7 @@
 #include <QtGui/QVector3D>
 #include <QtGui/QQuaternion>
 #include <QtNetwork/QAbstractSocket>
+#include <QtScript/QScriptString>
 #include <QtScript/QScriptValue>
 #include <QtScript/QScriptValueIterator>
 #include <QJsonDocument>
@@ -170,10 +172,74 @@ glm::vec2 vec2FromVariant(const QVariant &object) {
     return vec2FromVariant(object, valid);
 }
 
+namespace {
+
+// Handles for the property names that vectors and quaternions are converted with, so they aren't looked up from strings
+// for every value. An engine is only used on one thread, so each thread keeps those of the last engine it converted for.
+class ScriptNames {
+public:
+    QPointer<QScriptEngine> engine;
+    QScriptString x, y, z, w;
+    QScriptString r, g, b;
+    QScriptString red, green, blue;
+    QScriptValue vec3Prototype;
+    QScriptValue vec3ColorPrototype;
+    QScriptValue u8vec3Prototype;
+    QScriptValue u8vec3ColorPrototype;
+};
+
+ScriptNames& getScriptNames(QScriptEngine* engine) {
+    thread_local ScriptNames names;
+    // the pointer is cleared when its engine goes away, so a new engine at the same address doesn't get stale handles
+    if (names.engine != engine) {
+        names = ScriptNames();
+        names.engine = engine;
+        names.x = engine->toStringHandle("x");
+        names.y = engine->toStringHandle("y");
+        names.z = engine->toStringHandle("z");
+        names.w = engine->toStringHandle("w");
+        names.r = engine->toStringHandle("r");
+        names.g = engine->toStringHandle("g");
+        names.b = engine->toStringHandle("b");
+        names.red = engine->toStringHandle("red");
+        names.green = engine->toStringHandle("green");
+        names.blue = engine->toStringHandle("blue");
+    }
+    return names;
+}
+
+QScriptValue getPrototype(QScriptEngine* engine, QScriptValue& cachedPrototype, const QString& name, const QString& definition) {
+    if (!cachedPrototype.isValid()) {
+        cachedPrototype = engine->globalObject().property(name);
+        if (!cachedPrototype.property("defined").toBool()) {
+            cachedPrototype = engine->evaluate(definition);
+        }
+    }
+    return cachedPrototype;
+}
+
+QScriptValue getComponent(const QScriptValue& object, const QScriptString& name, const QScriptString& shortColorName,
+                          const QScriptString& colorName) {
+    QScriptValue value = object.property(name);
+    if (!value.isValid()) {
+        value = object.property(shortColorName);
+    }
+    if (!value.isValid()) {
+        value = object.property(colorName);
+    }
+    return value;
+}
+
+// numbers, which components almost always are, are converted without going through a variant
+float toFloat(const QScriptValue& value) {
+    return value.isNumber() ? (float)value.toNumber() : value.toVariant().toFloat();
+}
+
+}
+
 QScriptValue vec3ToScriptValue(QScriptEngine* engine, const glm::vec3& vec3) {
-    auto prototype = engine->globalObject().property("__hifi_vec3__");
-    if (!prototype.property("defined").toBool()) {
-        prototype = engine->evaluate(
+    auto& names = getScriptNames(engine);
+    auto prototype = getPrototype(engine, names.vec3Prototype, "__hifi_vec3__",
             "__hifi_vec3__ = Object.defineProperties({}, { "
             "defined: { value: true },"
             "0: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
@@ -186,20 +252,18 @@ QScriptValue vec3ToScriptValue(QScriptEngine* engine, const glm::vec3& vec3) {
             "green: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } },"
             "blue: { set: function(nv) { return this.z = nv; }, get: function() { return this.z; } }"
             "})"
-        );
-    }
+    );
     QScriptValue value = engine->newObject();
-    value.setProperty("x", vec3.x);
-    value.setProperty("y", vec3.y);
-    value.setProperty("z", vec3.z);
+    value.setProperty(names.x, vec3.x);
+    value.setProperty(names.y, vec3.y);
+    value.setProperty(names.z, vec3.z);
     value.setPrototype(prototype);
     return value;
 }
 
 QScriptValue vec3ColorToScriptValue(QScriptEngine* engine, const glm::vec3& vec3) {
-    auto prototype = engine->globalObject().property("__hifi_vec3_color__");
-    if (!prototype.property("defined").toBool()) {
-        prototype = engine->evaluate(
+    auto& names = getScriptNames(engine);
+    auto prototype = getPrototype(engine, names.vec3ColorPrototype, "__hifi_vec3_color__",
             "__hifi_vec3_color__ = Object.defineProperties({}, { "
             "defined: { value: true },"
             "0: { set: function(nv) { return this.red = nv; }, get: function() { return this.red; } },"
@@ -212,12 +276,11 @@ QScriptValue vec3ColorToScriptValue(QScriptEngine* engine, const glm::vec3& vec3
             "y: { set: function(nv) { return this.green = nv; }, get: function() { return this.green; } },"
             "z: { set: function(nv) { return this.blue = nv; }, get: function() { return this.blue; } }"
             "})"
-        );
-    }
+    );
     QScriptValue value = engine->newObject();
-    value.setProperty("red", vec3.x);
-    value.setProperty("green", vec3.y);
-    value.setProperty("blue", vec3.z);
+    value.setProperty(names.red, vec3.x);
+    value.setProperty(names.green, vec3.y);
+    value.setProperty(names.blue, vec3.z);
     value.setPrototype(prototype);
     return value;
 }
@@ -239,41 +302,23 @@ void vec3FromScriptValue(const QScriptValue& object, glm::vec3& vec3) {
             vec3.y = list[1].toFloat();
             vec3.z = list[2].toFloat();
         }
+    } else if (object.isObject()) {
+        auto& names = getScriptNames(object.engine());
+        QScriptValue x = getComponent(object, names.x, names.r, names.red);
+        QScriptValue y = getComponent(object, names.y, names.g, names.green);
+        QScriptValue z = getComponent(object, names.z, names.b, names.blue);
+
+        vec3.x = toFloat(x);
+        vec3.y = toFloat(y);
+        vec3.z = toFloat(z);
     } else {
-        QScriptValue x = object.property("x");
-        if (!x.isValid()) {
-            x = object.property("r");
-        }
-        if (!x.isValid()) {
-            x = object.property("red");
-        }
-
-        QScriptValue y = object.property("y");
-        if (!y.isValid()) {
-            y = object.property("g");
-        }
-        if (!y.isValid()) {
-            y = object.property("green");
-        }
-
-        QScriptValue z = object.property("z");
-        if (!z.isValid()) {
-            z = object.property("b");
-        }
-        if (!z.isValid()) {
-            z = object.property("blue");
-        }
-
-        vec3.x = x.toVariant().toFloat();
-        vec3.y = y.toVariant().toFloat();
-        vec3.z = z.toVariant().toFloat();
+        vec3 = glm::vec3(0.0f);
     }
 }
 
 QScriptValue u8vec3ToScriptValue(QScriptEngine* engine, const glm::u8vec3& vec3) {
-    auto prototype = engine->globalObject().property("__hifi_u8vec3__");
-    if (!prototype.property("defined").toBool()) {
-        prototype = engine->evaluate(
+    auto& names = getScriptNames(engine);
+    auto prototype = getPrototype(engine, names.u8vec3Prototype, "__hifi_u8vec3__",
             "__hifi_u8vec3__ = Object.defineProperties({}, { "
             "defined: { value: true },"
             "0: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
@@ -286,20 +331,18 @@ QScriptValue u8vec3ToScriptValue(QScriptEngine* engine, const glm::u8vec3& vec3)
             "green: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } },"
             "blue: { set: function(nv) { return this.z = nv; }, get: function() { return this.z; } }"
             "})"
-        );
-    }
+    );
     QScriptValue value = engine->newObject();
-    value.setProperty("x", vec3.x);
-    value.setProperty("y", vec3.y);
-    value.setProperty("z", vec3.z);
+    value.setProperty(names.x, vec3.x);
+    value.setProperty(names.y, vec3.y);
+    value.setProperty(names.z, vec3.z);
     value.setPrototype(prototype);
     return value;
 }
 
 QScriptValue u8vec3ColorToScriptValue(QScriptEngine* engine, const glm::u8vec3& vec3) {
-    auto prototype = engine->globalObject().property("__hifi_u8vec3_color__");
-    if (!prototype.property("defined").toBool()) {
-        prototype = engine->evaluate(
+    auto& names = getScriptNames(engine);
+    auto prototype = getPrototype(engine, names.u8vec3ColorPrototype, "__hifi_u8vec3_color__",
             "__hifi_u8vec3_color__ = Object.defineProperties({}, { "
             "defined: { value: true },"
             "0: { set: function(nv) { return this.red = nv; }, get: function() { return this.red; } },"
@@ -312,12 +355,11 @@ QScriptValue u8vec3ColorToScriptValue(QScriptEngine* engine, const glm::u8vec3&
             "y: { set: function(nv) { return this.green = nv; }, get: function() { return this.green; } },"
             "z: { set: function(nv) { return this.blue = nv; }, get: function() { return this.blue; } }"
             "})"
-        );
-    }
+    );
     QScriptValue value = engine->newObject();
-    value.setProperty("red", vec3.x);
-    value.setProperty("green", vec3.y);
-    value.setProperty("blue", vec3.z);
+    value.setProperty(names.red, vec3.x);
+    value.setProperty(names.green, vec3.y);
+    value.setProperty(names.blue, vec3.z);
     value.setPrototype(prototype);
     return value;
 }
@@ -339,34 +381,17 @@ void u8vec3FromScriptValue(const QScriptValue& object, glm::u8vec3& vec3) {
             vec3.y = list[1].toUInt();
             vec3.z = list[2].toUInt();
         }
-    } else {
-        QScriptValue x = object.property("x");
-        if (!x.isValid()) {
-            x = object.property("r");
-        }
-        if (!x.isValid()) {
-            x = object.property("red");
-        }
-
-        QScriptValue y = object.property("y");
-        if (!y.isValid()) {
-            y = object.property("g");
-        }
-        if (!y.isValid()) {
-            y = object.property("green");
-        }
-
-        QScriptValue z = object.property("z");
-        if (!z.isValid()) {
-            z = object.property("b");
-        }
-        if (!z.isValid()) {
-            z = object.property("blue");
-        }
+    } else if (object.isObject()) {
+        auto& names = getScriptNames(object.engine());
+        QScriptValue x = getComponent(object, names.x, names.r, names.red);
+        QScriptValue y = getComponent(object, names.y, names.g, names.green);
+        QScriptValue z = getComponent(object, names.z, names.b, names.blue);
 
         vec3.x = x.toVariant().toUInt();
         vec3.y = y.toVariant().toUInt();
         vec3.z = z.toVariant().toUInt();
+    } else {
+        vec3 = glm::u8vec3(0);
     }
 }
 
@@ -765,18 +790,24 @@ QScriptValue quatToScriptValue(QScriptEngine* engine, const glm::quat& quat) {
         // if quat contains a NaN don't try to convert it
         return obj;
     }
-    obj.setProperty("x", quat.x);
-    obj.setProperty("y", quat.y);
-    obj.setProperty("z", quat.z);
-    obj.setProperty("w", quat.w);
+    auto& names = getScriptNames(engine);
+    obj.setProperty(names.x, quat.x);
+    obj.setProperty(names.y, quat.y);
+    obj.setProperty(names.z, quat.z);
+    obj.setProperty(names.w, quat.w);
     return obj;
 }
 
 void quatFromScriptValue(const QScriptValue& object, glm::quat &quat) {
-    quat.x = object.property("x").toVariant().toFloat();
-    quat.y = object.property("y").toVariant().toFloat();
-    quat.z = object.property("z").toVariant().toFloat();
-    quat.w = object.property("w").toVariant().toFloat();
+    if (object.isObject()) {
+        auto& names = getScriptNames(object.engine());
+        quat.x = toFloat(object.property(names.x));
+        quat.y = toFloat(object.property(names.y));
+        quat.z = toFloat(object.property(names.z));
+        quat.w = toFloat(object.property(names.w));
+    } else {
+        quat = glm::quat(0.0f, 0.0f, 0.0f, 0.0f);
+    }
 
     // enforce normalized quaternion
     float length = glm::length(quat);
@@ -80,6 +80,9 @@ void SpatiallyNestable::setParentID(const QUuid& parentID) {
             _parentKnowsMe = false;
         }
     });
+    if (parentChanged) {
+        invalidateWorldTransform();
+    }
 
     if (parentChanged && success && parent) {
         parent->recalculateChildCauterization();
@@ -97,20 +100,101 @@ void SpatiallyNestable::setParentID(const QUuid& parentID) {
 }
 
 Transform SpatiallyNestable::getParentTransform(bool& success, int depth) const {
+    bool hasParent;
+    bool isCacheable;
+    return computeParentTransform(success, depth, hasParent, isCacheable);
+}
+
+Transform SpatiallyNestable::computeParentTransform(bool& success, int depth, bool& hasParent, bool& isCacheable) const {
     Transform result;
+    hasParent = false;
+    isCacheable = false;
     SpatiallyNestablePointer parent = getParentPointer(success);
     if (!success) {
         return result;
     }
     if (parent) {
+        hasParent = true;
         result = parent->getJointTransform(_parentJointIndex, success, depth + 1);
         if (getScalesWithParent()) {
             result.setScale(parent->scaleForChildren());
         }
+
+        // Only a transform relative to the parent's own, already cached, transform can be cached: joints and the scale
+        // given to children change without the parent's transform changing, and a parent that doesn't know about this
+        // object wouldn't tell it when it moves.
+        isCacheable = _parentJointIndex == INVALID_JOINT_INDEX && !getScalesWithParent() && _parentKnowsMe &&
+            parent->_worldTransformCache.isValid(parent->_worldTransformGeneration.load(std::memory_order_acquire));
+    } else {
+        isCacheable = true;
     }
     return result;
 }
 
+void SpatiallyNestable::invalidateWorldTransform(int depth) const {
+    _worldTransformGeneration.fetch_add(1, std::memory_order_acq_rel);
+    if (depth > MAX_PARENTING_CHAIN_SIZE) {
+        return; // a parenting loop, it's broken up the next time the transform is asked for
+    }
+    forEachChild([&](const SpatiallyNestablePointer& child) {
+        child->invalidateWorldTransform(depth + 1);
+    });
+}
+
+bool SpatiallyNestable::WorldTransformCache::read(uint64_t generation, Transform& transform, bool& hasParent) const {
+    uint32_t sequence = _sequence.load(std::memory_order_acquire);
+    if ((sequence & 1) || _generation.load(std::memory_order_relaxed) != generation) {
+        return false;
+    }
+    glm::quat rotation(_values[0].load(std::memory_order_relaxed), _values[1].load(std::memory_order_relaxed),
+                       _values[2].load(std::memory_order_relaxed), _values[3].load(std::memory_order_relaxed));
+    glm::vec3 scale(_values[4].load(std::memory_order_relaxed), _values[5].load(std::memory_order_relaxed),
+                    _values[6].load(std::memory_order_relaxed));
+    glm::vec3 translation(_values[7].load(std::memory_order_relaxed), _values[8].load(std::memory_order_relaxed),
+                          _values[9].load(std::memory_order_relaxed));
+    hasParent = _hasParent.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (_sequence.load(std::memory_order_relaxed) != sequence) {
+        return false; // written while it was being copied
+    }
+    // through the setters, so that the flags come out as they would have from the multiplication
+    transform = Transform();
+    transform.setTranslation(translation);
+    transform.setRotation(rotation);
+    transform.setScale(scale);
+    return true;
+}
+
+void SpatiallyNestable::WorldTransformCache::write(uint64_t generation, const Transform& transform, bool hasParent) {
+    uint32_t sequence = _sequence.load(std::memory_order_relaxed);
+    if ((sequence & 1) || !_sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_relaxed)) {
+        return; // another thread is caching the same transform
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    const glm::quat& rotation = transform.getRotation();
+    const glm::vec3& scale = transform.getScale();
+    const glm::vec3& translation = transform.getTranslation();
+    _values[0].store(rotation.w, std::memory_order_relaxed);
+    _values[1].store(rotation.x, std::memory_order_relaxed);
+    _values[2].store(rotation.y, std::memory_order_relaxed);
+    _values[3].store(rotation.z, std::memory_order_relaxed);
+    _values[4].store(scale.x, std::memory_order_relaxed);
+    _values[5].store(scale.y, std::memory_order_relaxed);
+    _values[6].store(scale.z, std::memory_order_relaxed);
+    _values[7].store(translation.x, std::memory_order_relaxed);
+    _values[8].store(translation.y, std::memory_order_relaxed);
+    _values[9].store(translation.z, std::memory_order_relaxed);
+    _hasParent.store(hasParent, std::memory_order_relaxed);
+    _generation.store(generation, std::memory_order_relaxed);
+
+    _sequence.store(sequence + 2, std::memory_order_release);
+}
+
+bool SpatiallyNestable::WorldTransformCache::isValid(uint64_t generation) const {
+    return _generation.load(std::memory_order_acquire) == generation;
+}
+
 SpatiallyNestablePointer SpatiallyNestable::getParentPointer(bool& success) const {
     SpatiallyNestablePointer parent = _parent.lock();
     QUuid parentID = getParentID(); // used for its locking
@@ -140,6 +224,7 @@ SpatiallyNestablePointer SpatiallyNestable::getParentPointer(bool& success) cons
         parent->forgetChild(getThisPointer());
         _parentKnowsMe = false;
         _parent.reset();
+        invalidateWorldTransform();
     }
 
     // we have a _parentID but no parent pointer, or our parent pointer was to the wrong thing
@@ -155,6 +240,7 @@ SpatiallyNestablePointer SpatiallyNestable::getParentPointer(bool& success) cons
 
     parent = _parent.lock();
     if (parent) {
+        invalidateWorldTransform();
 
         // it's possible for an entity with a parent of AVATAR_SELF_ID can be imported into a side-tree
         // such as the clipboard's.  if this is the case, we don't want the parent to consider this a
@@ -186,6 +272,7 @@ void SpatiallyNestable::forgetChild(SpatiallyNestablePointer newChild) const {
 
 void SpatiallyNestable::setParentJointIndex(quint16 parentJointIndex) {
     _parentJointIndex = parentJointIndex;
+    invalidateWorldTransform();
     bool success = false;
     auto parent = getParentPointer(success);
     if (success && parent) {
@@ -516,6 +603,7 @@ void SpatiallyNestable::setWorldTransform(const glm::vec3& position, const glm::
                 _translationChanged = usecTimestampNow();
             }
         });
+        invalidateWorldTransform();
         if (changed) {
             locationChanged(false);
         }
@@ -560,6 +648,7 @@ void SpatiallyNestable::setWorldPosition(const glm::vec3& position, bool& succes
             _translationChanged = usecTimestampNow();
         }
     });
+    invalidateWorldTransform();
     if (success && changed) {
         locationChanged(tellPhysics);
     }
@@ -613,6 +702,7 @@ void SpatiallyNestable::setWorldOrientation(const glm::quat& orientation, bool&
             _rotationChanged = usecTimestampNow();
         }
     });
+    invalidateWorldTransform();
     if (success && changed) {
         locationChanged(tellPhysics);
     }
@@ -748,11 +838,22 @@ glm::vec3 SpatiallyNestable::getParentAngularVelocity(bool& success) const {
 
 const Transform SpatiallyNestable::getTransform(bool& success, int depth) const {
     Transform result;
+    uint64_t generation = _worldTransformGeneration.load(std::memory_order_acquire);
+    bool hasParent = false;
+    if (_worldTransformCache.read(generation, result, hasParent) && !(hasParent && _parent.expired())) {
+        success = true;
+        return result;
+    }
+
     // return a world-space transform for this object's location
-    Transform parentTransform = getParentTransform(success, depth);
+    bool isCacheable = false;
+    Transform parentTransform = computeParentTransform(success, depth, hasParent, isCacheable);
     _transformLock.withReadLock([&] {
         Transform::mult(result, parentTransform, _transform);
     });
+    if (success && isCacheable) {
+        _worldTransformCache.write(generation, result, hasParent);
+    }
     return result;
 }
 
@@ -832,6 +933,7 @@ void SpatiallyNestable::setTransform(const Transform& transform, bool& success)
                 _rotationChanged = usecTimestampNow();
             }
         });
+        invalidateWorldTransform();
         if (changed) {
             locationChanged();
         }
@@ -887,6 +989,7 @@ void SpatiallyNestable::setSNScale(const glm::vec3& scale, bool& success) {
             _scaleChanged = usecTimestampNow();
         }
     });
+    invalidateWorldTransform();
     if (success && changed) {
         dimensionsChanged();
     }
@@ -917,6 +1020,7 @@ void SpatiallyNestable::setLocalTransform(const Transform& transform) {
             _rotationChanged = usecTimestampNow();
         }
     });
+    invalidateWorldTransform();
 
     if (changed) {
         locationChanged();
@@ -945,6 +1049,7 @@ void SpatiallyNestable::setLocalPosition(const glm::vec3& position, bool tellPhy
             _translationChanged = usecTimestampNow();
         }
     });
+    invalidateWorldTransform();
     if (changed) {
         locationChanged(tellPhysics);
     }
@@ -972,6 +1077,7 @@ void SpatiallyNestable::setLocalOrientation(const glm::quat& orientation) {
             _rotationChanged = usecTimestampNow();
         }
     });
+    invalidateWorldTransform();
     if (changed) {
         locationChanged();
     }
@@ -1028,6 +1134,7 @@ void SpatiallyNestable::setLocalSNScale(const glm::vec3& scale) {
             _scaleChanged = usecTimestampNow();
         }
     });
+    invalidateWorldTransform();
     if (changed) {
         dimensionsChanged();
     }
@@ -1383,6 +1490,7 @@ void SpatiallyNestable::setLocalTransformAndVelocities(
             _rotationChanged = usecTimestampNow();
         }
     });
+    invalidateWorldTransform();
     // linear velocity
     _velocityLock.withWriteLock([&] {
         _velocity = localVelocity;
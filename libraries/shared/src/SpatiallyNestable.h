@@ -12,6 +12,8 @@
 #ifndef hifi_SpatiallyNestable_h
 #define hifi_SpatiallyNestable_h
 
+#include <atomic>
+
 #include <QUuid>
 
 #include "Transform.h"
@@ -267,6 +269,28 @@ private:
     bool _isDead { false };
     bool _queryAACubeIsPuffed { false };
 
+    // The world transform as of a generation of this object's transform, copied in and out under a sequence number
+    // rather than a lock, since it's asked for all the time and from every thread.
+    class WorldTransformCache {
+    public:
+        bool read(uint64_t generation, Transform& transform, bool& hasParent) const;
+        void write(uint64_t generation, const Transform& transform, bool hasParent);
+        bool isValid(uint64_t generation) const;
+
+    private:
+        std::atomic<uint32_t> _sequence { 0 }; // odd while being written
+        std::atomic<uint64_t> _generation { UINT64_MAX };
+        std::atomic<bool> _hasParent { false };
+        std::atomic<float> _values[10]; // rotation, scale, translation
+    };
+
+    // bumped whenever this object's transform, or that of one of its ancestors, or its parenting changes
+    mutable std::atomic<uint64_t> _worldTransformGeneration { 0 };
+    mutable WorldTransformCache _worldTransformCache;
+
+    void invalidateWorldTransform(int depth = 0) const;
+    Transform computeParentTransform(bool& success, int depth, bool& hasParent, bool& isCacheable) const;
+
     void breakParentingLoop() const;
 };
 
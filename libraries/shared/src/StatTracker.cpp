@@ -13,23 +13,31 @@ StatTracker::StatTracker() {
 }
 
 QVariant StatTracker::getStat(const QString& name) {
-    std::lock_guard<std::mutex> lock(_statsLock);
-    return QVariant::fromValue<int64_t>(_stats[name]);
+    return QVariant::fromValue<int64_t>(getOrAddStat(name).load());
 }
 
 void StatTracker::setStat(const QString& name, int64_t value) {
-    Lock lock(_statsLock);
-    _stats[name] = value;
+    getOrAddStat(name).store(value);
 }
 
 void StatTracker::updateStat(const QString& name, int64_t value) {
-    Lock lock(_statsLock);
-    auto itr = _stats.find(name);
-    if (_stats.end() == itr) {
-        _stats[name] = value;
-    } else {
-        *itr = *itr + value;
+    getOrAddStat(name).fetch_add(value);
+}
+
+StatTracker::Stat& StatTracker::getOrAddStat(const QString& name) {
+    {
+        QReadLocker locker(&_statsLock);
+        auto it = _stats.constFind(name);
+        if (it != _stats.constEnd()) {
+            return **it;
+        }
+    }
+    QWriteLocker locker(&_statsLock);
+    auto& stat = _stats[name];
+    if (!stat) {
+        stat = std::make_shared<Stat>(0);
     }
+    return *stat;
 }
 
 void StatTracker::incrementStat(const QString& name) {
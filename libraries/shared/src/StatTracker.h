@@ -12,14 +12,18 @@
 #include <QtCore/QVariant>
 #include <QtCore/QSet>
 #include <QtCore/QVariantMap>
+#include <QtCore/QReadWriteLock>
 
-#include <mutex>
+#include <atomic>
+#include <memory>
 
 #include "DependencyManager.h"
 #include "Trace.h"
 
 using EditStatFunction = std::function<QVariant(QVariant currentValue)>;
 
+// Stats by name, updated from any thread. The lock is only held exclusively to add a stat, updating one that exists only
+// reads the table of stats and then changes the stat atomically, so the threads updating stats don't wait for each other.
 class StatTracker : public Dependency {
 public:
     StatTracker();
@@ -29,10 +33,11 @@ public:
     void incrementStat(const QString& name);
     void decrementStat(const QString& name);
 private:
-    using Mutex = std::mutex;
-    using Lock = std::lock_guard<Mutex>;
-    Mutex _statsLock;
-    QHash<QString, int64_t> _stats;
+    using Stat = std::atomic<int64_t>;
+    Stat& getOrAddStat(const QString& name);
+
+    QReadWriteLock _statsLock;
+    QHash<QString, std::shared_ptr<Stat>> _stats;
 };
 
 class CounterStat {
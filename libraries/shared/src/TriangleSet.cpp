@@ -13,8 +13,6 @@
 
 #include "GLMHelpers.h"
 
-#include <list>
-
 void TriangleSet::insert(const Triangle& t) {
     _isBalanced = false;
 
@@ -65,6 +63,12 @@ void TriangleSet::balanceTree() {
         _triangleTree.insert(i);
     }
 
+    // then lay them out in the order of the cells that hold them, so that a cell's triangles are read contiguously
+    std::vector<Triangle> sortedTriangles;
+    sortedTriangles.reserve(_triangles.size());
+    _triangleTree.sortTriangles(sortedTriangles);
+    _triangles.swap(sortedTriangles);
+
     _isBalanced = true;
 
 #if WANT_DEBUGGING
@@ -86,6 +90,8 @@ TriangleSet::TriangleTreeCell::TriangleTreeCell(std::vector<Triangle>& allTriang
 void TriangleSet::TriangleTreeCell::clear() {
     _population = 0;
     _triangleIndices.clear();
+    _trianglesBegin = 0;
+    _trianglesEnd = 0;
     _bounds.clear();
     _children.first.reset();
     _children.second.reset();
@@ -102,7 +108,7 @@ void TriangleSet::TriangleTreeCell::debugDump() {
     qDebug() << "               bounds:" << getBounds();
     qDebug() << "                depth:" << _depth;
     qDebug() << "           population:" << _population << "this level or below"
-             << " ---- triangleIndices:" << _triangleIndices.size() << "in this cell";
+             << " ---- triangles:" << (_trianglesEnd - _trianglesBegin) << "in this cell";
 
     int numChildren = 0;
     if (_children.first) {
@@ -176,6 +182,22 @@ void TriangleSet::TriangleTreeCell::insert(size_t triangleIndex) {
     _triangleIndices.push_back(triangleIndex);
 }
 
+void TriangleSet::TriangleTreeCell::sortTriangles(std::vector<Triangle>& sortedTriangles) {
+    _trianglesBegin = sortedTriangles.size();
+    for (const auto& triangleIndex : _triangleIndices) {
+        sortedTriangles.push_back(_allTriangles[triangleIndex]);
+    }
+    _trianglesEnd = sortedTriangles.size();
+    std::vector<size_t>().swap(_triangleIndices);
+
+    if (_children.first) {
+        _children.first->sortTriangles(sortedTriangles);
+    }
+    if (_children.second) {
+        _children.second->sortTriangles(sortedTriangles);
+    }
+}
+
 bool TriangleSet::findRayIntersection(const glm::vec3& origin, const glm::vec3& direction, const glm::vec3& invDirection, float& distance,
                                       BoxFace& face, Triangle& triangle, bool precision, bool allowBackface) {
     if (!_isBalanced) {
@@ -207,8 +229,8 @@ bool TriangleSet::TriangleTreeCell::findRayIntersectionInternal(const glm::vec3&
     Triangle bestTriangle;
 
     if (precision) {
-        for (const auto& triangleIndex : _triangleIndices) {
-            const auto& thisTriangle = _allTriangles[triangleIndex];
+        for (size_t i = _trianglesBegin; i < _trianglesEnd; i++) {
+            const auto& thisTriangle = _allTriangles[i];
             float thisTriangleDistance;
             trianglesTouched++;
             if (findRayTriangleIntersection(origin, direction, thisTriangle, thisTriangleDistance, allowBackface)) {
@@ -260,8 +282,10 @@ bool TriangleSet::TriangleTreeCell::findRayIntersection(const glm::vec3& origin,
 
     // if we're not yet at the max depth, then check our children
     if (_depth < MAX_DEPTH) {
-        std::list<SortedTriangleCell> sortedTriangleCells;
-        auto sortingOperator = [&](std::shared_ptr<TriangleTreeCell>& child) {
+        // at most two children, sorted in place since this runs for every cell a pick reaches
+        SortedTriangleCell sortedTriangleCells[2];
+        int numSortedTriangleCells = 0;
+        auto sortingOperator = [&](const std::shared_ptr<TriangleTreeCell>& child) {
             if (child) {
                 float priority = FLT_MAX;
                 if (child->getBounds().contains(origin)) {
@@ -279,19 +303,21 @@ bool TriangleSet::TriangleTreeCell::findRayIntersection(const glm::vec3& origin,
                 }
 
                 if (priority < FLT_MAX) {
-                    if (sortedTriangleCells.size() > 0 && priority < sortedTriangleCells.front().first) {
-                        sortedTriangleCells.emplace_front(priority, child);
+                    if (numSortedTriangleCells > 0 && priority < sortedTriangleCells[0].first) {
+                        sortedTriangleCells[1] = sortedTriangleCells[0];
+                        sortedTriangleCells[0] = SortedTriangleCell(priority, child.get());
                     } else {
-                        sortedTriangleCells.emplace_back(priority, child);
+                        sortedTriangleCells[numSortedTriangleCells] = SortedTriangleCell(priority, child.get());
                     }
+                    numSortedTriangleCells++;
                 }
             }
         };
         sortingOperator(_children.first);
         sortingOperator(_children.second);
 
-        for (auto it = sortedTriangleCells.begin(); it != sortedTriangleCells.end(); ++it) {
-            const SortedTriangleCell& sortedTriangleCell = *it;
+        for (int i = 0; i < numSortedTriangleCells; i++) {
+            const SortedTriangleCell& sortedTriangleCell = sortedTriangleCells[i];
             float childDistance = sortedTriangleCell.first;
             // We can exit once childDistance > bestLocalDistance
             if (childDistance > bestLocalDistance) {
@@ -305,7 +331,8 @@ bool TriangleSet::TriangleTreeCell::findRayIntersection(const glm::vec3& origin,
             }
             BoxFace childFace;
             Triangle childTriangle;
-            if (sortedTriangleCell.second->findRayIntersection(origin, direction, invDirection, childDistance, childFace, childTriangle, precision, trianglesTouched)) {
+            if (sortedTriangleCell.second->findRayIntersection(origin, direction, invDirection, childDistance, childFace, childTriangle, precision, trianglesTouched,
+                                                               allowBackface)) {
                 if (childDistance < bestLocalDistance) {
                     bestLocalDistance = childDistance;
                     bestLocalFace = childFace;
@@ -355,8 +382,8 @@ bool TriangleSet::TriangleTreeCell::findParabolaIntersectionInternal(const glm::
     Triangle bestTriangle;
 
     if (precision) {
-        for (const auto& triangleIndex : _triangleIndices) {
-            const auto& thisTriangle = _allTriangles[triangleIndex];
+        for (size_t i = _trianglesBegin; i < _trianglesEnd; i++) {
+            const auto& thisTriangle = _allTriangles[i];
             float thisTriangleDistance;
             trianglesTouched++;
             if (findParabolaTriangleIntersection(origin, velocity, acceleration, thisTriangle, thisTriangleDistance, allowBackface)) {
@@ -409,8 +436,9 @@ bool TriangleSet::TriangleTreeCell::findParabolaIntersection(const glm::vec3& or
 
     // if we're not yet at the max depth, then check our children
     if (_depth < MAX_DEPTH) {
-        std::list<SortedTriangleCell> sortedTriangleCells;
-        auto sortingOperator = [&](std::shared_ptr<TriangleTreeCell>& child) {
+        SortedTriangleCell sortedTriangleCells[2];
+        int numSortedTriangleCells = 0;
+        auto sortingOperator = [&](const std::shared_ptr<TriangleTreeCell>& child) {
             if (child) {
                 float priority = FLT_MAX;
                 if (child->getBounds().contains(origin)) {
@@ -428,19 +456,21 @@ bool TriangleSet::TriangleTreeCell::findParabolaIntersection(const glm::vec3& or
                 }
 
                 if (priority < FLT_MAX) {
-                    if (sortedTriangleCells.size() > 0 && priority < sortedTriangleCells.front().first) {
-                        sortedTriangleCells.emplace_front(priority, child);
+                    if (numSortedTriangleCells > 0 && priority < sortedTriangleCells[0].first) {
+                        sortedTriangleCells[1] = sortedTriangleCells[0];
+                        sortedTriangleCells[0] = SortedTriangleCell(priority, child.get());
                     } else {
-                        sortedTriangleCells.emplace_back(priority, child);
+                        sortedTriangleCells[numSortedTriangleCells] = SortedTriangleCell(priority, child.get());
                     }
+                    numSortedTriangleCells++;
                 }
             }
         };
         sortingOperator(_children.first);
         sortingOperator(_children.second);
 
-        for (auto it = sortedTriangleCells.begin(); it != sortedTriangleCells.end(); ++it) {
-            const SortedTriangleCell& sortedTriangleCell = *it;
+        for (int i = 0; i < numSortedTriangleCells; i++) {
+            const SortedTriangleCell& sortedTriangleCell = sortedTriangleCells[i];
             float childDistance = sortedTriangleCell.first;
             // We can exit once childDistance > bestLocalDistance
             if (childDistance > bestLocalDistance) {
@@ -454,7 +484,8 @@ bool TriangleSet::TriangleTreeCell::findParabolaIntersection(const glm::vec3& or
             }
             BoxFace childFace;
             Triangle childTriangle;
-            if (sortedTriangleCell.second->findParabolaIntersection(origin, velocity, acceleration, childDistance, childFace, childTriangle, precision, trianglesTouched)) {
+            if (sortedTriangleCell.second->findParabolaIntersection(origin, velocity, acceleration, childDistance, childFace, childTriangle, precision,
+                                                                    trianglesTouched, allowBackface)) {
                 if (childDistance < bestLocalDistance) {
                     bestLocalDistance = childDistance;
                     bestLocalFace = childFace;
@@ -25,6 +25,8 @@ class TriangleSet {
         TriangleTreeCell(std::vector<Triangle>& allTriangles, const AABox& bounds, int depth);
 
         void insert(size_t triangleIndex);
+        // appends the triangles of this cell and then of its children, and keeps where its own ended up
+        void sortTriangles(std::vector<Triangle>& sortedTriangles);
         void reset(const AABox& bounds, int depth = 0);
         void clear();
 
@@ -55,12 +57,14 @@ class TriangleSet {
         int _depth { 0 };
         int _population { 0 };
         AABox _bounds;
-        std::vector<size_t> _triangleIndices;
+        std::vector<size_t> _triangleIndices; // only while the tree is being built
+        size_t _trianglesBegin { 0 };
+        size_t _trianglesEnd { 0 };
 
         friend class TriangleSet;
     };
 
-    using SortedTriangleCell = std::pair<float, std::shared_ptr<TriangleTreeCell>>;
+    using SortedTriangleCell = std::pair<float, TriangleTreeCell*>;
 
 public:
     TriangleSet() : _triangleTree(_triangles) {}
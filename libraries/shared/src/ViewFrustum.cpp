@@ -26,6 +26,10 @@
 #include "NumericalConstants.h"
 #include "SharedLogging.h"
 
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#include <emmintrin.h>
+#endif
+
 using namespace std;
 
 void ViewFrustum::setOrientation(const glm::quat& orientationAsQuaternion) {
@@ -184,6 +188,108 @@ ViewFrustum::intersection ViewFrustum::calculateCubeKeyholeIntersection(const AA
     return (frustumResult == OUTSIDE) ? sphereResult : frustumResult;
 }
 
+void ViewFrustum::calculateCubeKeyholeIntersections(const AACube* cubes, int count, ViewFrustum::intersection* results) const {
+    int i = 0;
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+    // the same tests as calculateCubeKeyholeIntersection, made for all four cubes
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 positionX = _mm_set1_ps(_position.x);
+    const __m128 positionY = _mm_set1_ps(_position.y);
+    const __m128 positionZ = _mm_set1_ps(_position.z);
+    const __m128 sphereRadius = _mm_set1_ps(_centerSphereRadius);
+
+    for (; i + 4 <= count; i += 4) {
+        alignas(16) float corners[3][4];
+        alignas(16) float scales[4];
+        for (int j = 0; j < 4; j++) {
+            const glm::vec3& corner = cubes[i + j].getCorner();
+            corners[0][j] = corner.x;
+            corners[1][j] = corner.y;
+            corners[2][j] = corner.z;
+            scales[j] = cubes[i + j].getScale();
+        }
+        __m128 scale = _mm_load_ps(scales);
+        __m128 cornerX = _mm_load_ps(corners[0]);
+        __m128 cornerY = _mm_load_ps(corners[1]);
+        __m128 cornerZ = _mm_load_ps(corners[2]);
+        __m128 farCornerX = _mm_add_ps(cornerX, scale);
+        __m128 farCornerY = _mm_add_ps(cornerY, scale);
+        __m128 farCornerZ = _mm_add_ps(cornerZ, scale);
+
+        // check against central sphere
+        __m128 halfScale = _mm_mul_ps(scale, _mm_set1_ps(0.5f));
+        __m128 offsetX = _mm_sub_ps(_mm_add_ps(cornerX, halfScale), positionX);
+        __m128 offsetY = _mm_sub_ps(_mm_add_ps(cornerY, halfScale), positionY);
+        __m128 offsetZ = _mm_sub_ps(_mm_add_ps(cornerZ, halfScale), positionZ);
+        __m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(offsetX, offsetX), _mm_mul_ps(offsetY, offsetY)),
+                                                 _mm_mul_ps(offsetZ, offsetZ)));
+        __m128 offCenter = _mm_cmpgt_ps(distance, _mm_set1_ps(EPSILON));
+
+        __m128 vertexX = _mm_sub_ps(_mm_add_ps(cornerX, _mm_and_ps(_mm_cmpgt_ps(offsetX, zero), scale)), positionX);
+        __m128 vertexY = _mm_sub_ps(_mm_add_ps(cornerY, _mm_and_ps(_mm_cmpgt_ps(offsetY, zero), scale)), positionY);
+        __m128 vertexZ = _mm_sub_ps(_mm_add_ps(cornerZ, _mm_and_ps(_mm_cmpgt_ps(offsetZ, zero), scale)), positionZ);
+        __m128 outwardDistance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vertexX, offsetX), _mm_mul_ps(vertexY, offsetY)),
+                                            _mm_mul_ps(vertexZ, offsetZ));
+        __m128 insideSphere = _mm_or_ps(
+            _mm_and_ps(offCenter, _mm_cmplt_ps(outwardDistance, _mm_mul_ps(sphereRadius, distance))),
+            _mm_andnot_ps(offCenter, _mm_cmpgt_ps(sphereRadius, _mm_mul_ps(_mm_set1_ps(HALF_SQRT_THREE), scale))));
+
+        __m128 nearestX = _mm_add_ps(_mm_max_ps(_mm_sub_ps(cornerX, positionX), zero),
+                                     _mm_max_ps(_mm_sub_ps(_mm_sub_ps(positionX, cornerX), scale), zero));
+        __m128 nearestY = _mm_add_ps(_mm_max_ps(_mm_sub_ps(cornerY, positionY), zero),
+                                     _mm_max_ps(_mm_sub_ps(_mm_sub_ps(positionY, cornerY), scale), zero));
+        __m128 nearestZ = _mm_add_ps(_mm_max_ps(_mm_sub_ps(cornerZ, positionZ), zero),
+                                     _mm_max_ps(_mm_sub_ps(_mm_sub_ps(positionZ, cornerZ), scale), zero));
+        __m128 nearestDistanceSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nearestX, nearestX), _mm_mul_ps(nearestY, nearestY)),
+                                                   _mm_mul_ps(nearestZ, nearestZ));
+        __m128 outsideSphere = _mm_andnot_ps(_mm_cmple_ps(nearestDistanceSquared, _mm_mul_ps(sphereRadius, sphereRadius)),
+                                             offCenter);
+
+        // check against frustum, where the farthest and nearest cube points only depend on the plane
+        __m128 outsideFrustum = zero;
+        __m128 straddlesFrustum = zero;
+        for (int p = 0; p < NUM_FRUSTUM_PLANES; p++) {
+            const glm::vec3& normal = _planes[p].getNormal();
+            __m128 normalX = _mm_set1_ps(normal.x);
+            __m128 normalY = _mm_set1_ps(normal.y);
+            __m128 normalZ = _mm_set1_ps(normal.z);
+            __m128 dCoefficient = _mm_set1_ps(_planes[p].getDCoefficient());
+
+            __m128 farthest = _mm_add_ps(dCoefficient, _mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(normalX, normal.x > 0.0f ? farCornerX : cornerX),
+                _mm_mul_ps(normalY, normal.y > 0.0f ? farCornerY : cornerY)),
+                _mm_mul_ps(normalZ, normal.z > 0.0f ? farCornerZ : cornerZ)));
+            __m128 nearest = _mm_add_ps(dCoefficient, _mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(normalX, normal.x < 0.0f ? farCornerX : cornerX),
+                _mm_mul_ps(normalY, normal.y < 0.0f ? farCornerY : cornerY)),
+                _mm_mul_ps(normalZ, normal.z < 0.0f ? farCornerZ : cornerZ)));
+            outsideFrustum = _mm_or_ps(outsideFrustum, _mm_cmplt_ps(farthest, zero));
+            straddlesFrustum = _mm_or_ps(straddlesFrustum, _mm_cmplt_ps(nearest, zero));
+        }
+
+        int insideSphereMask = _mm_movemask_ps(insideSphere);
+        int outsideSphereMask = _mm_movemask_ps(outsideSphere);
+        int outsideFrustumMask = _mm_movemask_ps(outsideFrustum);
+        int straddlesFrustumMask = _mm_movemask_ps(straddlesFrustum);
+        for (int j = 0; j < 4; j++) {
+            int bit = 1 << j;
+            if (insideSphereMask & bit) {
+                results[i + j] = INSIDE;
+            } else if (outsideFrustumMask & bit) {
+                results[i + j] = (outsideSphereMask & bit) ? OUTSIDE : INTERSECT;
+            } else {
+                results[i + j] = (straddlesFrustumMask & bit) ? INTERSECT : INSIDE;
+            }
+        }
+    }
+#endif
+
+    for (; i < count; i++) {
+        results[i] = calculateCubeKeyholeIntersection(cubes[i]);
+    }
+}
+
 bool ViewFrustum::pointIntersectsFrustum(const glm::vec3& point) const {
     // only check against frustum
     for(int i = 0; i < NUM_FRUSTUM_PLANES; ++i) {
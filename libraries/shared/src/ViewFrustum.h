@@ -100,6 +100,8 @@ public:
     /// @return INSIDE, INTERSECT, or OUTSIDE depending on how cube intersects the keyhole shape
     ViewFrustum::intersection calculateCubeFrustumIntersection(const AACube& cube) const;
     ViewFrustum::intersection calculateCubeKeyholeIntersection(const AACube& cube) const;
+    // the keyhole intersection of count cubes, tested four at a time where SIMD is available
+    void calculateCubeKeyholeIntersections(const AACube* cubes, int count, ViewFrustum::intersection* results) const;
 
     bool pointIntersectsFrustum(const glm::vec3& point) const;
     bool sphereIntersectsFrustum(const glm::vec3& center, float radius) const;
@@ -16,6 +16,10 @@
 #include "../ViewFrustum.h"
 #include <glm/gtc/type_ptr.hpp>
 
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#include <emmintrin.h>
+#endif
+
 void ConicalViewFrustum::set(const ViewFrustum& viewFrustum) {
     // The ConicalViewFrustum has two parts: a central sphere (same as ViewFrustum) and a circular cone that bounds the frustum part.
     // Why?  Because approximate intersection tests are much faster to compute for a cone than for a frustum.
@@ -114,6 +118,67 @@ float ConicalViewFrustum::getAngularSize(float distance, float radius) const {
     return angularSize;
 }
 
+uint8_t ConicalViewFrustum::getCubesInView(const AACube* cubes, int count, float minAngularSize) const {
+    assert(count <= 8);
+    uint8_t result = 0;
+    int i = 0;
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+    const __m128 positionX = _mm_set1_ps(_position.x);
+    const __m128 positionY = _mm_set1_ps(_position.y);
+    const __m128 positionZ = _mm_set1_ps(_position.z);
+    const __m128 halfSqrtThree = _mm_set1_ps(0.5f * SQRT_THREE);
+    const __m128 avoidDivideByZero = _mm_set1_ps(0.001f);
+
+    for (; i + 4 <= count; i += 4) {
+        alignas(16) float corners[3][4];
+        alignas(16) float scales[4];
+        for (int j = 0; j < 4; j++) {
+            const glm::vec3& corner = cubes[i + j].getCorner();
+            corners[0][j] = corner.x;
+            corners[1][j] = corner.y;
+            corners[2][j] = corner.z;
+            scales[j] = cubes[i + j].getScale();
+        }
+        __m128 scale = _mm_load_ps(scales);
+        __m128 halfScale = _mm_mul_ps(scale, _mm_set1_ps(0.5f));
+
+        // the bounding spheres in view-frame
+        __m128 x = _mm_sub_ps(_mm_add_ps(_mm_load_ps(corners[0]), halfScale), positionX);
+        __m128 y = _mm_sub_ps(_mm_add_ps(_mm_load_ps(corners[1]), halfScale), positionY);
+        __m128 z = _mm_sub_ps(_mm_add_ps(_mm_load_ps(corners[2]), halfScale), positionZ);
+        __m128 radius = _mm_mul_ps(halfSqrtThree, scale);
+        __m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+
+        __m128 largeEnough = _mm_cmpgt_ps(_mm_div_ps(radius, _mm_add_ps(distance, avoidDivideByZero)),
+                                          _mm_set1_ps(minAngularSize));
+
+        __m128 inKeyhole = _mm_cmplt_ps(distance, _mm_add_ps(_mm_set1_ps(_radius), radius));
+        __m128 pastFarClip = _mm_cmpgt_ps(distance, _mm_add_ps(_mm_set1_ps(_farClip), radius));
+
+        // see intersects() for the cone test
+        __m128 alongDirection = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(_direction.x)), _mm_mul_ps(y, _mm_set1_ps(_direction.y))),
+                                           _mm_mul_ps(z, _mm_set1_ps(_direction.z)));
+        __m128 tangent = _mm_sqrt_ps(_mm_sub_ps(_mm_mul_ps(distance, distance), _mm_mul_ps(radius, radius)));
+        __m128 inCone = _mm_cmpgt_ps(alongDirection, _mm_sub_ps(_mm_mul_ps(tangent, _mm_set1_ps(_cosAngle)),
+                                                                _mm_mul_ps(radius, _mm_set1_ps(_sinAngle))));
+
+        __m128 inView = _mm_and_ps(largeEnough, _mm_or_ps(inKeyhole, _mm_andnot_ps(pastFarClip, inCone)));
+        result |= (uint8_t)(_mm_movemask_ps(inView) << i);
+    }
+#endif
+
+    for (; i < count; i++) {
+        float radius = 0.5f * SQRT_THREE * cubes[i].getScale();
+        glm::vec3 position = cubes[i].calcCenter() - _position;
+        float distance = glm::length(position);
+        if (getAngularSize(distance, radius) > minAngularSize && intersects(position, distance, radius)) {
+            result |= 1 << i;
+        }
+    }
+    return result;
+}
+
 int ConicalViewFrustum::serialize(unsigned char* destinationBuffer) const {
     const unsigned char* startPosition = destinationBuffer;
 
@@ -12,6 +12,7 @@
 #ifndef hifi_ConicalViewFrustum_h
 #define hifi_ConicalViewFrustum_h
 
+#include <cstdint>
 #include <vector>
 
 #include <glm/glm.hpp>
@@ -51,6 +52,10 @@ public:
     bool intersects(const glm::vec3& relativePosition, float distance, float radius) const;
     float getAngularSize(float distance, float radius) const;
 
+    // tests up to 8 cubes (an octree element's children) together, four at a time where SIMD is available: bit i of
+    // the result is set when cubes[i] intersects and has an angular size over minAngularSize
+    uint8_t getCubesInView(const AACube* cubes, int count, float minAngularSize) const;
+
     int serialize(unsigned char* destinationBuffer) const;
     int deserialize(const unsigned char* sourceBuffer);
 
@@ -13,6 +13,8 @@
 //
 #include "RegionTracker.h"
 
+#include <chrono>
+
 #include "Region.h"
 
 using namespace workload;
@@ -30,8 +32,11 @@ void RegionTracker::run(const WorkloadContextPointer& context, Outputs& outputs)
 
     auto space = context->_space;
     if (space) {
-        //Changes changes;
+        auto start = std::chrono::high_resolution_clock::now();
         space->categorizeAndGetChanges(outChanges);
+        std::chrono::duration<float, std::milli> categorizeTime = std::chrono::high_resolution_clock::now() - start;
+        auto config = std::static_pointer_cast<Config>(context->jobConfig);
+        config->setStats(space->getNumObjects(), categorizeTime.count());
 
         // use exit/enter lists for each region less than Region::R4
         outRegionChanges.resize(2 * workload::Region::NUM_TRACKED_REGIONS);
@@ -22,8 +22,21 @@ namespace workload {
 
     class RegionTrackerConfig : public Job::Config {
         Q_OBJECT
+        Q_PROPERTY(float numProxies READ getNumProxies NOTIFY dirty)
+        Q_PROPERTY(float categorizeTime READ getCategorizeTime NOTIFY dirty) // msec
     public:
         RegionTrackerConfig() : Job::Config(true) {}
+
+        uint32_t getNumProxies() const { return numProxies; }
+        float getCategorizeTime() const { return categorizeTime; }
+
+        void setStats(uint32_t proxies, float time) { numProxies = proxies; categorizeTime = time; emit dirty(); }
+
+        uint32_t numProxies { 0 };
+        float categorizeTime { 0.0f };
+
+    signals:
+        void dirty();
     };
 
     class RegionTracker {
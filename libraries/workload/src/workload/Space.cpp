@@ -18,11 +18,30 @@
 
 #include <glm/gtx/quaternion.hpp>
 
+#include <TBBHelpers.h>
+
 using namespace workload;
 
 Space::Space() : Collection() {
 }
 
+// cells are big enough to hold many entities but small next to the region radii, so that most of them lie well
+// inside or outside of each region
+static const float CELL_SIZE = 16.0f;
+static const float CELL_HALF_DIAGONAL = 0.5f * sqrtf(3.0f) * CELL_SIZE;
+
+static const uint32_t CELL_KEY_BITS = 21;
+static const uint64_t CELL_KEY_MASK = (1ULL << CELL_KEY_BITS) - 1;
+
+static glm::ivec3 getCellCoords(const glm::vec3& position) {
+    return glm::ivec3(glm::floor(position / CELL_SIZE));
+}
+
+static uint64_t getCellKey(const glm::ivec3& coords) {
+    return (((uint64_t)coords.x & CELL_KEY_MASK) << (2 * CELL_KEY_BITS)) |
+        (((uint64_t)coords.y & CELL_KEY_MASK) << CELL_KEY_BITS) | ((uint64_t)coords.z & CELL_KEY_MASK);
+}
+
 void Space::processTransactionFrame(const Transaction& transaction) {
     std::unique_lock<std::mutex> lock(_proxiesMutex);
     // Here we should be able to check the value of last ProxyID allocated
@@ -31,6 +50,7 @@ void Space::processTransactionFrame(const Transaction& transaction) {
     if (maxID > (Index) _proxies.size()) {
         _proxies.resize(maxID + 100); // allocate the maxId and more
         _owners.resize(maxID + 100);
+        _proxyCells.resize(maxID + 100);
     }
     // Now we know for sure that we have enough items in the array to
     // capture anything coming from the transaction
@@ -52,8 +72,10 @@ void Space::processResets(const Transaction::Resets& transactions) {
         auto& item = _proxies[proxyID];
 
         // Reset the item with a new payload
+        removeFromCell(proxyID);
         item.sphere = (std::get<1>(reset));
         item.prevRegion = item.region = Region::UNKNOWN;
+        addToCell(proxyID);
 
         _owners[proxyID] = (std::get<2>(reset));
     }
@@ -70,6 +92,7 @@ void Space::processRemoves(const Transaction::Removes& transactions) {
         auto& item = _proxies[removedID];
 
         // Kill it
+        removeFromCell(removedID);
         item.prevRegion = item.region = Region::INVALID;
         _owners[removedID] = Owner();
     }
@@ -86,37 +109,161 @@ void Space::processUpdates(const Transaction::Updates& transactions) {
         auto& item = _proxies[updateID];
 
         // Update the item
+        removeFromCell(updateID);
         item.sphere = (std::get<1>(update));
+        addToCell(updateID);
+    }
+}
+
+void Space::addToCell(int32_t proxyID) {
+    const Sphere& sphere = _proxies[proxyID].sphere;
+    glm::ivec3 coords = getCellCoords(glm::vec3(sphere));
+    uint64_t key = getCellKey(coords);
+
+    int32_t cellIndex;
+    auto itr = _cellIndices.find(key);
+    if (itr != _cellIndices.end()) {
+        cellIndex = itr->second;
+    } else {
+        if (_freeCells.empty()) {
+            cellIndex = (int32_t)_cells.size();
+            _cells.emplace_back();
+        } else {
+            cellIndex = _freeCells.back();
+            _freeCells.pop_back();
+        }
+        _cellIndices[key] = cellIndex;
+        Cell& cell = _cells[cellIndex];
+        cell.center = (glm::vec3(coords) + glm::vec3(0.5f)) * CELL_SIZE;
+        cell.minRadius = sphere.w;
+        cell.maxRadius = sphere.w;
+    }
+
+    Cell& cell = _cells[cellIndex];
+    cell.minRadius = std::min(cell.minRadius, sphere.w);
+    cell.maxRadius = std::max(cell.maxRadius, sphere.w);
+    cell.changed = true;
+    CellSlot& slot = _proxyCells[proxyID];
+    slot.cell = cellIndex;
+    slot.index = (int32_t)cell.proxies.size();
+    cell.proxies.push_back(proxyID);
+}
+
+void Space::removeFromCell(int32_t proxyID) {
+    CellSlot& slot = _proxyCells[proxyID];
+    if (slot.cell < 0) {
+        return;
+    }
+
+    Cell& cell = _cells[slot.cell];
+    int32_t lastProxyID = cell.proxies.back();
+    cell.proxies[slot.index] = lastProxyID;
+    _proxyCells[lastProxyID].index = slot.index;
+    cell.proxies.pop_back();
+    cell.changed = true;
+
+    if (cell.proxies.empty()) {
+        _cellIndices.erase(getCellKey(getCellCoords(cell.center)));
+        _freeCells.push_back(slot.cell);
+        cell.region = Region::INVALID;
+    }
+    slot = CellSlot();
+}
+
+// the region of a live proxy is the lowest region of any view that it touches
+static uint8_t classifyProxy(const Proxy& proxy, const Views& views) {
+    glm::vec3 proxyCenter = glm::vec3(proxy.sphere);
+    float proxyRadius = proxy.sphere.w;
+    uint8_t region = Region::R4;
+    for (const auto& view : views) {
+        // for each 'view' we need only increment 'k' below the current value of 'region'
+        for (uint8_t k = 0; k < region; ++k) {
+            float touchDistance = proxyRadius + view.regions[k].w;
+            if (distance2(proxyCenter, glm::vec3(view.regions[k])) < touchDistance * touchDistance) {
+                region = k;
+                break;
+            }
+        }
+    }
+    return region;
+}
+
+// The same as classifyProxy() for every proxy in the cell at once: the region if it's the same for all of them, else
+// INVALID.  A region touches all of the proxies or none of them when the cell is far enough inside or outside of it.
+uint8_t Space::categorizeCell(const Cell& cell) const {
+    uint8_t region = Region::R4;
+    for (const auto& view : _views) {
+        for (uint8_t k = 0; k < region; ++k) {
+            float centerDistance = glm::distance(cell.center, glm::vec3(view.regions[k]));
+            float regionRadius = view.regions[k].w;
+            if (centerDistance + CELL_HALF_DIAGONAL < cell.minRadius + regionRadius) {
+                region = k;
+                break;
+            }
+            if (centerDistance - CELL_HALF_DIAGONAL < cell.maxRadius + regionRadius) {
+                return Region::INVALID;
+            }
+        }
+    }
+    return region;
+}
+
+void Space::categorizeCellProxies(Cell& cell, std::vector<Space::Change>& changes) {
+    if (cell.proxies.empty()) {
+        return;
     }
+    uint8_t cellRegion = categorizeCell(cell);
+    if (cellRegion != Region::INVALID && cellRegion == cell.region && !cell.changed) {
+        // nothing in the cell has changed
+        return;
+    }
+
+    bool regionsChanged = false;
+    for (int32_t proxyID : cell.proxies) {
+        Proxy& proxy = _proxies[proxyID];
+        proxy.prevRegion = proxy.region;
+        proxy.region = (cellRegion != Region::INVALID) ? cellRegion : classifyProxy(proxy, _views);
+        if (proxy.region != proxy.prevRegion) {
+            changes.emplace_back(Space::Change(proxyID, proxy.region, proxy.prevRegion));
+            regionsChanged = true;
+        }
+    }
+    cell.region = cellRegion;
+    // a cell whose proxies changed region is visited once more, to bring their prevRegion up to date
+    cell.changed = regionsChanged;
 }
 
 void Space::categorizeAndGetChanges(std::vector<Space::Change>& changes) {
     std::unique_lock<std::mutex> lock(_proxiesMutex);
-    uint32_t numProxies = (uint32_t)_proxies.size();
-    uint32_t numViews = (uint32_t)_views.size();
-    for (uint32_t i = 0; i < numProxies; ++i) {
-        Proxy& proxy = _proxies[i];
-        if (proxy.region < Region::INVALID) {
-            glm::vec3 proxyCenter = glm::vec3(proxy.sphere);
-            float proxyRadius = proxy.sphere.w;
-            uint8_t region = Region::R4;
-            for (uint32_t j = 0; j < numViews; ++j) {
-                auto& view = _views[j];
-                // for each 'view' we need only increment 'k' below the current value of 'region'
-                for (uint8_t k = 0; k < region; ++k) {
-                    float touchDistance = proxyRadius + view.regions[k].w;
-                    if (distance2(proxyCenter, glm::vec3(view.regions[k])) < touchDistance * touchDistance) {
-                        region = k;
-                        break;
-                    }
-                }
-            }
-            proxy.prevRegion = proxy.region;
-            proxy.region = region;
-            if (proxy.region != proxy.prevRegion) {
-                changes.emplace_back(Space::Change((int32_t)i, proxy.region, proxy.prevRegion));
+    uint32_t numCells = (uint32_t)_cells.size();
+
+    // many cells are split into chunks that are categorized in parallel, each into its own list of changes
+    const uint32_t CELLS_PER_CHUNK = 64;
+    uint32_t numChunks = (numCells + CELLS_PER_CHUNK - 1) / CELLS_PER_CHUNK;
+    if (numChunks < 2) {
+        for (auto& cell : _cells) {
+            categorizeCellProxies(cell, changes);
+        }
+        return;
+    }
+
+    std::vector<std::vector<Space::Change>> chunkChanges(numChunks);
+    tbb::parallel_for(tbb::blocked_range<uint32_t>(0, numChunks), [&](const tbb::blocked_range<uint32_t>& range) {
+        for (uint32_t chunk = range.begin(); chunk != range.end(); ++chunk) {
+            uint32_t end = std::min((chunk + 1) * CELLS_PER_CHUNK, numCells);
+            for (uint32_t i = chunk * CELLS_PER_CHUNK; i < end; ++i) {
+                categorizeCellProxies(_cells[i], chunkChanges[chunk]);
             }
         }
+    });
+
+    size_t numChanges = changes.size();
+    for (const auto& chunk : chunkChanges) {
+        numChanges += chunk.size();
+    }
+    changes.reserve(numChanges);
+    for (const auto& chunk : chunkChanges) {
+        changes.insert(changes.end(), chunk.begin(), chunk.end());
     }
 }
 
@@ -161,6 +308,10 @@ void Space::clear() {
     _IDAllocator.clear();
     _proxies.clear();
     _owners.clear();
+    _proxyCells.clear();
+    _cells.clear();
+    _cellIndices.clear();
+    _freeCells.clear();
     _views.clear();
 }
 
@@ -16,6 +16,7 @@
 #define hifi_workload_Space_h
 
 #include <memory>
+#include <unordered_map>
 #include <vector>
 #include <glm/glm.hpp>
 
@@ -60,10 +61,39 @@ private:
     void processRemoves(const Transaction::Removes& transactions);
     void processUpdates(const Transaction::Updates& transactions);
 
+    // The proxies are binned by center in a loose grid.  When every proxy of a cell is sure to land in the same region
+    // the whole cell is categorized at once, and a cell that keeps its region and proxies is skipped.
+    class Cell {
+    public:
+        glm::vec3 center;
+        std::vector<int32_t> proxies;
+        // bounds of the proxies' radii: not shrunk as proxies leave, which is conservative
+        float minRadius { 0.0f };
+        float maxRadius { 0.0f };
+        // the region all the proxies were given, INVALID when it had to be worked out proxy by proxy
+        uint8_t region { Region::INVALID };
+        // proxies came, went, moved or changed region since the cell was last categorized
+        bool changed { true };
+    };
+    class CellSlot {
+    public:
+        int32_t cell { -1 };
+        int32_t index { -1 }; // in the cell's proxies
+    };
+
+    void addToCell(int32_t proxyID);
+    void removeFromCell(int32_t proxyID);
+    uint8_t categorizeCell(const Cell& cell) const;
+    void categorizeCellProxies(Cell& cell, std::vector<Change>& changes);
+
     // The database of proxies is protected for editing by a mutex
     mutable std::mutex _proxiesMutex;
     Proxy::Vector _proxies;
     std::vector<Owner> _owners;
+    std::vector<CellSlot> _proxyCells;
+    std::vector<Cell> _cells;
+    std::unordered_map<uint64_t, int32_t> _cellIndices;
+    std::vector<int32_t> _freeCells;
 
     Views _views;
 };
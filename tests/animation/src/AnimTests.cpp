@@ -15,6 +15,7 @@
 #include <AnimVariant.h>
 #include <AnimExpression.h>
 #include <AnimUtil.h>
+#include <CompressedAnimation.h>
 #include <ExternalResource.h>
 #include <NodeList.h>
 #include <AddressManager.h>
@@ -468,6 +469,112 @@ void AnimTests::testAnimPose() {
     QCOMPARE_WITH_ABS_ERROR(p.scale(), resultScale, TEST_EPSILON2);
 }
 
+void AnimTests::testAnimPoseMultiply() {
+    const float PI = (float)M_PI;
+    std::vector<AnimPose> poses = {
+        AnimPose::identity,
+        AnimPose(glm::vec3(1.0f), glm::angleAxis(PI / 2.0f, glm::vec3(1.0f, 0.0f, 0.0f)), glm::vec3(10.0f, 0.0f, 0.0f)),
+        AnimPose(glm::vec3(2.0f), glm::angleAxis(PI, glm::vec3(0.0f, 1.0f, 0.0f)), glm::vec3(0.0f, 5.0f, -7.5f)),
+        AnimPose(glm::vec3(0.5f), -glm::angleAxis(PI / 6.0f, glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f))), glm::vec3(1.0f, 2.0f, 3.0f)),
+        AnimPose(glm::vec3(2.0f, 0.5f, 1.5f), glm::angleAxis(PI / 3.0f, glm::vec3(0.0f, 0.0f, 1.0f)), glm::vec3(-1.0f, 0.0f, 4.0f)),
+        AnimPose(glm::vec3(-2.0f, 0.5f, 1.5f), glm::angleAxis(-PI / 4.0f, glm::vec3(0.0f, 1.0f, 0.0f)), glm::vec3(0.0f))
+    };
+
+    // composing the poses directly has to give the same pose as composing their matrices
+    for (auto& lhs : poses) {
+        for (auto& rhs : poses) {
+            AnimPose expected(static_cast<glm::mat4>(lhs) * static_cast<glm::mat4>(rhs));
+            AnimPose result = lhs * rhs;
+            QCOMPARE_WITH_ABS_ERROR(result.scale(), expected.scale(), TEST_EPSILON);
+            QCOMPARE_WITH_ABS_ERROR(result.rot(), expected.rot(), TEST_EPSILON);
+            QCOMPARE_WITH_ABS_ERROR(result.trans(), expected.trans(), TEST_EPSILON);
+        }
+    }
+}
+
+void AnimTests::testBlend() {
+    const float PI = (float)M_PI;
+    const int NUM_POSES = 7;
+    AnimPoseVec a, b, c;
+    for (int i = 0; i < NUM_POSES; i++) {
+        float f = (float)i / NUM_POSES;
+        a.push_back(AnimPose(glm::vec3(1.0f + f), glm::angleAxis(PI * f, glm::vec3(1.0f, 0.0f, 0.0f)), glm::vec3(f, 2.0f, -f)));
+        // some of these are in the other hemisphere from a, so they have to be negated before they're blended
+        b.push_back(AnimPose(glm::vec3(1.0f, f, 2.0f), -glm::angleAxis(PI * (1.0f - f), glm::vec3(0.0f, 1.0f, 0.0f)), glm::vec3(3.0f * f)));
+        c.push_back(AnimPose(glm::vec3(f), glm::angleAxis(0.5f * PI * f, glm::vec3(0.0f, 0.0f, 1.0f)), glm::vec3(-f, 0.0f, 1.0f)));
+    }
+
+    const float ALPHA = 0.3f;
+    AnimPoseVec result(NUM_POSES);
+    ::blend(NUM_POSES, a.data(), b.data(), ALPHA, result.data());
+    for (int i = 0; i < NUM_POSES; i++) {
+        QCOMPARE_WITH_ABS_ERROR(result[i].scale(), lerp(a[i].scale(), b[i].scale(), ALPHA), TEST_EPSILON);
+        QCOMPARE_WITH_ABS_ERROR(result[i].rot(), safeLerp(a[i].rot(), b[i].rot(), ALPHA), TEST_EPSILON);
+        QCOMPARE_WITH_ABS_ERROR(result[i].trans(), lerp(a[i].trans(), b[i].trans(), ALPHA), TEST_EPSILON);
+    }
+
+    // blending in place
+    AnimPoseVec inPlace = b;
+    ::blend(NUM_POSES, a.data(), inPlace.data(), ALPHA, inPlace.data());
+    for (int i = 0; i < NUM_POSES; i++) {
+        QCOMPARE_WITH_ABS_ERROR(inPlace[i].rot(), result[i].rot(), TEST_EPSILON);
+        QCOMPARE_WITH_ABS_ERROR(inPlace[i].trans(), result[i].trans(), TEST_EPSILON);
+    }
+
+    float alphas[3] = { 0.5f, 0.3f, 0.2f };
+    ::blend3(NUM_POSES, a.data(), b.data(), c.data(), alphas, result.data());
+    for (int i = 0; i < NUM_POSES; i++) {
+        glm::vec3 scale = alphas[0] * a[i].scale() + alphas[1] * b[i].scale() + alphas[2] * c[i].scale();
+        glm::vec3 trans = alphas[0] * a[i].trans() + alphas[1] * b[i].trans() + alphas[2] * c[i].trans();
+        QCOMPARE_WITH_ABS_ERROR(result[i].scale(), scale, TEST_EPSILON);
+        QCOMPARE_WITH_ABS_ERROR(result[i].rot(), safeLinearCombine3(a[i].rot(), b[i].rot(), c[i].rot(), alphas), TEST_EPSILON);
+        QCOMPARE_WITH_ABS_ERROR(result[i].trans(), trans, TEST_EPSILON);
+    }
+}
+
+void AnimTests::testCompressedAnimation() {
+    const int NUM_FRAMES = 300;
+    const int NUM_JOINTS = 50;
+    const int NUM_MOVING_JOINTS = 10;
+
+    // most of the joints stay put, like the fingers do in most animations
+    std::vector<AnimPoseVec> anim(NUM_FRAMES, AnimPoseVec(NUM_JOINTS));
+    for (int frame = 0; frame < NUM_FRAMES; frame++) {
+        float t = (float)frame / 30.0f;
+        for (int j = 0; j < NUM_JOINTS; j++) {
+            glm::vec3 offset(0.0f, 10.0f + j, 0.0f);
+            if (j < NUM_MOVING_JOINTS) {
+                glm::quat rot = glm::angleAxis(sinf(t * (1.0f + j)), glm::normalize(glm::vec3(1.0f, (float)j, 2.0f)));
+                glm::vec3 trans = j == 0 ? offset + glm::vec3(5.0f * sinf(t), 0.0f, 2.0f * t) : offset;
+                anim[frame][j] = AnimPose(glm::vec3(1.0f), rot, trans);
+            } else {
+                anim[frame][j] = AnimPose(glm::vec3(1.0f), glm::angleAxis(0.1f * j, glm::vec3(0.0f, 1.0f, 0.0f)), offset);
+            }
+        }
+    }
+
+    CompressedAnimation compressed(anim);
+    QCOMPARE(compressed.getNumFrames(), NUM_FRAMES);
+    QCOMPARE(compressed.getNumJoints(), NUM_JOINTS);
+
+    const size_t UNCOMPRESSED_SIZE = NUM_FRAMES * NUM_JOINTS * sizeof(AnimPose);
+    QVERIFY(compressed.getMemorySize() * 10 < UNCOMPRESSED_SIZE);
+
+    // within the rotation and translation tolerances, plus the quantization
+    const float ROTATION_EPSILON = 0.0001f;
+    const float TRANSLATION_EPSILON = 0.05f;
+    AnimPoseVec poses;
+    for (int frame = 0; frame < NUM_FRAMES; frame++) {
+        compressed.getPoses(frame, poses);
+        QCOMPARE((int)poses.size(), NUM_JOINTS);
+        for (int j = 0; j < NUM_JOINTS; j++) {
+            QCOMPARE_WITH_ABS_ERROR(poses[j].rot(), anim[frame][j].rot(), ROTATION_EPSILON);
+            QCOMPARE_WITH_ABS_ERROR(poses[j].trans(), anim[frame][j].trans(), TRANSLATION_EPSILON);
+            QCOMPARE_WITH_ABS_ERROR(poses[j].scale(), anim[frame][j].scale(), TEST_EPSILON);
+        }
+    }
+}
+
 void AnimTests::testExpressionTokenizer() {
     QString str = "(10 +  x) >= 20.1 && (y != !z)";
     AnimExpression e("x");
@@ -0,0 +1,113 @@
+//
+//  AudioFECTests.cpp
+//  tests/audio/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioFECTests.h"
+
+#include <vector>
+
+#include <AudioFEC.h>
+
+QTEST_MAIN(AudioFECTests)
+
+static const int GROUP_SIZE = 4;
+// starts just before the sequence number wraps
+static const quint16 FIRST_SEQUENCE = 65534;
+
+static std::unique_ptr<NLPacket> createAudioPacket(quint16 sequence, PacketType type, int numAudioBytes) {
+    auto packet = NLPacket::create(type);
+    packet->writePrimitive(sequence);
+    packet->writeString("opus");
+    for (int i = 0; i < numAudioBytes; ++i) {
+        packet->writePrimitive((quint8)(sequence + i));
+    }
+    return packet;
+}
+
+static std::unique_ptr<ReceivedMessage> toMessage(const NLPacket& packet) {
+    return std::unique_ptr<ReceivedMessage>(new ReceivedMessage(
+        QByteArray(packet.getPayload(), (int)packet.getPayloadSize()), packet.getType(), packet.getVersion(), SockAddr()));
+}
+
+// sends a group through the encoder, returning its packets and their parity
+static std::unique_ptr<NLPacket> encodeGroup(std::vector<std::unique_ptr<NLPacket>>& packets) {
+    AudioFECEncoder encoder;
+    encoder.setGroupSize(GROUP_SIZE);
+
+    std::unique_ptr<NLPacket> parityPacket;
+    for (int i = 0; i < GROUP_SIZE; ++i) {
+        // different lengths and types, as with a variable bitrate codec and silent frames
+        auto type = i == 2 ? PacketType::SilentAudioFrame : PacketType::MixedAudio;
+        packets.push_back(createAudioPacket(FIRST_SEQUENCE + i, type, 100 + 37 * i));
+
+        auto parity = encoder.addPacket(*packets.back());
+        if (i < GROUP_SIZE - 1) {
+            Q_ASSERT(!parity);
+        } else {
+            parityPacket = std::move(parity);
+        }
+    }
+    return parityPacket;
+}
+
+void AudioFECTests::recoverTest() {
+    std::vector<std::unique_ptr<NLPacket>> packets;
+    auto parityPacket = encodeGroup(packets);
+    QVERIFY(parityPacket);
+
+    for (int missing = 0; missing < GROUP_SIZE; ++missing) {
+        AudioFECDecoder decoder;
+        for (int i = 0; i < GROUP_SIZE; ++i) {
+            if (i != missing) {
+                const auto& packet = *packets[i];
+                decoder.addPacket(FIRST_SEQUENCE + i, packet.getType(), packet.getPayload() + sizeof(quint16),
+                                  (int)packet.getPayloadSize() - (int)sizeof(quint16));
+            }
+        }
+
+        auto parityMessage = toMessage(*parityPacket);
+        quint16 sequence;
+        PacketType type;
+        QByteArray afterSequence;
+        QVERIFY(decoder.recover(*parityMessage, sequence, type, afterSequence));
+
+        const auto& lost = *packets[missing];
+        QCOMPARE(sequence, (quint16)(FIRST_SEQUENCE + missing));
+        QCOMPARE(type, lost.getType());
+        QCOMPARE(afterSequence, QByteArray(lost.getPayload() + sizeof(quint16),
+                                           (int)lost.getPayloadSize() - (int)sizeof(quint16)));
+    }
+}
+
+void AudioFECTests::unrecoverableTest() {
+    std::vector<std::unique_ptr<NLPacket>> packets;
+    auto parityPacket = encodeGroup(packets);
+    QVERIFY(parityPacket);
+
+    quint16 sequence;
+    PacketType type;
+    QByteArray afterSequence;
+
+    // two missing
+    AudioFECDecoder decoder;
+    for (int i = 2; i < GROUP_SIZE; ++i) {
+        const auto& packet = *packets[i];
+        decoder.addPacket(FIRST_SEQUENCE + i, packet.getType(), packet.getPayload() + sizeof(quint16),
+                          (int)packet.getPayloadSize() - (int)sizeof(quint16));
+    }
+    QVERIFY(!decoder.recover(*toMessage(*parityPacket), sequence, type, afterSequence));
+
+    // none missing
+    for (int i = 0; i < 2; ++i) {
+        const auto& packet = *packets[i];
+        decoder.addPacket(FIRST_SEQUENCE + i, packet.getType(), packet.getPayload() + sizeof(quint16),
+                          (int)packet.getPayloadSize() - (int)sizeof(quint16));
+    }
+    QVERIFY(!decoder.recover(*toMessage(*parityPacket), sequence, type, afterSequence));
+}
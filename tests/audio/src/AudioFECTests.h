@@ -0,0 +1,26 @@
+//
+//  AudioFECTests.h
+//  tests/audio/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_AudioFECTests_h
+#define vircadia_AudioFECTests_h
+
+#include <QtTest/QtTest>
+
+class AudioFECTests : public QObject {
+    Q_OBJECT
+private slots:
+    // Test that any one packet of a group, of any length, is rebuilt from the others and the parity
+    void recoverTest();
+
+    // Test that nothing is rebuilt when none or more than one packet of the group is missing
+    void unrecoverableTest();
+};
+
+#endif // vircadia_AudioFECTests_h
@@ -0,0 +1,104 @@
+//
+//  AudioMixKernelsTests.cpp
+//  tests/audio/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioMixKernelsTests.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <AudioMixKernels.h>
+
+QTEST_MAIN(AudioMixKernelsTests)
+
+// not a multiple of any vector width
+static const int NUM_FRAMES = 243;
+
+// the vector code may use fused multiply-add, which rounds once instead of twice
+static const float GAINFADE_TOLERANCE = 1e-6f;
+
+void AudioMixKernelsTests::gainfadeTest() {
+    std::vector<int16_t> src(2 * NUM_FRAMES);
+    std::vector<float> win(NUM_FRAMES);
+    for (int i = 0; i < 2 * NUM_FRAMES; ++i) {
+        src[i] = (int16_t)((i * 7919) % 65536 - 32768);
+    }
+    for (int i = 0; i < NUM_FRAMES; ++i) {
+        win[i] = 1.0f - i / (float)NUM_FRAMES;
+    }
+
+    const float gain0 = 0.25f / 32768.0f;
+    const float gain1 = 0.75f / 32768.0f;
+
+    for (int numChannels = 1; numChannels <= 2; ++numChannels) {
+        std::vector<float> dst(2 * NUM_FRAMES, 0.5f);
+        std::vector<float> expected(2 * NUM_FRAMES, 0.5f);
+
+        if (numChannels == 1) {
+            gainfade_1x2(src.data(), dst.data(), win.data(), gain0, gain1, NUM_FRAMES);
+        } else {
+            gainfade_2x2(src.data(), dst.data(), win.data(), gain0, gain1, NUM_FRAMES);
+        }
+
+        for (int i = 0; i < NUM_FRAMES; ++i) {
+            float gain = gain1 + win[i] * (gain0 - gain1);
+            expected[2 * i + 0] += src[numChannels == 1 ? i : 2 * i + 0] * gain;
+            expected[2 * i + 1] += src[numChannels == 1 ? i : 2 * i + 1] * gain;
+        }
+
+        for (int i = 0; i < 2 * NUM_FRAMES; ++i) {
+            QVERIFY2(std::fabs(dst[i] - expected[i]) <= GAINFADE_TOLERANCE,
+                     qPrintable(QString("channels %1 sample %2: %3 != %4").arg(numChannels).arg(i).arg(dst[i]).arg(expected[i])));
+        }
+    }
+}
+
+void AudioMixKernelsTests::gainDitherToInt16Test() {
+    for (int numChannels : { 1, 2, 4 }) {
+        std::vector<float> src(numChannels * NUM_FRAMES);
+        std::vector<float> gain(NUM_FRAMES);
+        std::vector<float> dither(NUM_FRAMES);
+        std::vector<int16_t> dst(numChannels * NUM_FRAMES);
+
+        // well past full scale in both directions, and away from exact halves so the rounding mode can't matter
+        for (int i = 0; i < numChannels * NUM_FRAMES; ++i) {
+            src[i] = 80000.0f * std::sin(i * 0.1f) + 0.25f;
+        }
+        for (int i = 0; i < NUM_FRAMES; ++i) {
+            gain[i] = 0.5f + 0.25f * std::cos(i * 0.05f);
+            dither[i] = (i % 5) * 0.01f;
+        }
+
+        gainDitherToInt16(src.data(), gain.data(), dither.data(), dst.data(), NUM_FRAMES, numChannels);
+
+        for (int i = 0; i < NUM_FRAMES; ++i) {
+            for (int c = 0; c < numChannels; ++c) {
+                float x = src[numChannels * i + c] * gain[i] + dither[i];
+                long expected = std::max(-32768L, std::min(32767L, std::lround(x)));
+                QCOMPARE((long)dst[numChannels * i + c], expected);
+            }
+        }
+    }
+}
+
+void AudioMixKernelsTests::isSilentTest() {
+    std::vector<float> samples(NUM_FRAMES, 0.0f);
+    QVERIFY(isSilent(samples.data(), NUM_FRAMES));
+
+    // -0.0 is silence
+    samples[NUM_FRAMES / 2] = -0.0f;
+    QVERIFY(isSilent(samples.data(), NUM_FRAMES));
+
+    for (int i = 0; i < NUM_FRAMES; ++i) {
+        samples.assign(NUM_FRAMES, 0.0f);
+        samples[i] = 1e-30f;
+        QVERIFY(!isSilent(samples.data(), NUM_FRAMES));
+    }
+}
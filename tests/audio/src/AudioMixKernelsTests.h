@@ -0,0 +1,29 @@
+//
+//  AudioMixKernelsTests.h
+//  tests/audio/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_AudioMixKernelsTests_h
+#define vircadia_AudioMixKernelsTests_h
+
+#include <QtTest/QtTest>
+
+class AudioMixKernelsTests : public QObject {
+    Q_OBJECT
+private slots:
+    // Test that gain crossfade accumulation matches scalar code, including frame counts that don't fill a vector
+    void gainfadeTest();
+
+    // Test that the int16 conversion rounds and saturates like scalar code for 1, 2 and 4 channels
+    void gainDitherToInt16Test();
+
+    // Test that a single nonzero sample anywhere is found
+    void isSilentTest();
+};
+
+#endif // vircadia_AudioMixKernelsTests_h
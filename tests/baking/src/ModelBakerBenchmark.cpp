@@ -0,0 +1,84 @@
+//
+//  ModelBakerBenchmark.cpp
+//  tests/baking/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ModelBakerBenchmark.h"
+
+#include <map>
+
+#include <FBXSerializer.h>
+#include <GLTFSerializer.h>
+#include <model-baker/Baker.h>
+
+QTEST_MAIN(ModelBakerBenchmark)
+
+static const QString MODEL_BAKER_TEST_DIR_ENV("HIFI_MODEL_BAKER_TEST_DIR");
+
+void ModelBakerBenchmark::initTestCase() {
+    auto environment = QProcessEnvironment::systemEnvironment();
+    if (!environment.contains(MODEL_BAKER_TEST_DIR_ENV)) {
+        QSKIP("HIFI_MODEL_BAKER_TEST_DIR isn't set");
+    }
+
+    QDirIterator it(environment.value(MODEL_BAKER_TEST_DIR_ENV), { "*.fbx", "*.glb" }, QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        _modelFiles << it.next();
+    }
+    QVERIFY(!_modelFiles.isEmpty());
+}
+
+void ModelBakerBenchmark::benchmarkStages() {
+    std::map<QString, double> totalStageTimes;
+    std::vector<QString> stageOrder;
+    double totalTime = 0.0;
+
+    for (const auto& modelFile : _modelFiles) {
+        QFile file(modelFile);
+        if (!file.open(QIODevice::ReadOnly)) {
+            qWarning() << "Unable to read" << modelFile;
+            continue;
+        }
+        hifi::ByteArray data = file.readAll();
+        hifi::URL url = QUrl::fromLocalFile(modelFile);
+
+        hfm::Model::Pointer model;
+        try {
+            if (modelFile.endsWith(".fbx", Qt::CaseInsensitive)) {
+                model = FBXSerializer().read(data, hifi::VariantHash(), url);
+            } else {
+                model = GLTFSerializer().read(data, hifi::VariantHash(), url);
+            }
+        } catch (const std::exception&) {
+        }
+        if (!model) {
+            qWarning() << "Unable to parse" << modelFile;
+            continue;
+        }
+
+        baker::Baker baker(model, hifi::VariantHash(), hifi::URL());
+        baker.getConfiguration()->getJobConfig("BuildDracoMesh")->setEnabled(true);
+        baker.run();
+
+        double modelTime = 0.0;
+        for (const auto& stageTime : baker.getStageTimes()) {
+            if (totalStageTimes.find(stageTime.first) == totalStageTimes.end()) {
+                stageOrder.push_back(stageTime.first);
+            }
+            totalStageTimes[stageTime.first] += stageTime.second;
+            modelTime += stageTime.second;
+        }
+        totalTime += modelTime;
+        qDebug() << QFileInfo(modelFile).fileName() << "baked in" << modelTime << "ms";
+    }
+
+    for (const auto& stage : stageOrder) {
+        qDebug() << stage << totalStageTimes[stage] << "ms";
+    }
+    qDebug() << "Baked" << _modelFiles.size() << "models in" << totalTime << "ms";
+}
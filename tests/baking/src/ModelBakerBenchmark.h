@@ -0,0 +1,29 @@
+//
+//  ModelBakerBenchmark.h
+//  tests/baking/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_ModelBakerBenchmark_h
+#define vircadia_ModelBakerBenchmark_h
+
+#include <QtTest/QtTest>
+
+// Times each stage of the model baker over the FBX and GLB models of the directory named by HIFI_MODEL_BAKER_TEST_DIR,
+// skipped if it isn't set
+class ModelBakerBenchmark : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void benchmarkStages();
+
+private:
+    QStringList _modelFiles;
+};
+
+#endif // vircadia_ModelBakerBenchmark_h
@@ -0,0 +1,95 @@
+//
+//  VertexCacheTest.cpp
+//  tests/baking/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "VertexCacheTest.h"
+
+#include <algorithm>
+#include <array>
+#include <deque>
+
+#include <model-baker/ModelMath.h>
+
+QTEST_MAIN(VertexCacheTest)
+
+// A grid of quads with its triangles listed column by column, which reuses few vertices while they're cached
+static std::vector<int> makeGridTriangles(int size) {
+    std::vector<int> indices;
+    for (int x = 0; x < size; ++x) {
+        for (int y = 0; y < size; ++y) {
+            int v0 = y * (size + 1) + x;
+            int v1 = v0 + 1;
+            int v2 = v0 + size + 1;
+            int v3 = v2 + 1;
+            indices.insert(indices.end(), { v0, v1, v2, v2, v1, v3 });
+        }
+    }
+    return indices;
+}
+
+// Each triangle rotated so that its smallest index comes first, which keeps the winding
+static std::vector<std::array<int, 3>> getSortedTriangles(const std::vector<int>& indices) {
+    std::vector<std::array<int, 3>> triangles;
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        std::array<int, 3> triangle {{ indices[i], indices[i + 1], indices[i + 2] }};
+        std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+        triangles.push_back(triangle);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+// The number of vertices transformed with a FIFO post-transform cache of the given size
+static int countCacheMisses(const std::vector<int>& indices, size_t cacheSize) {
+    std::deque<int> cache;
+    int misses = 0;
+    for (int index : indices) {
+        if (std::find(cache.begin(), cache.end(), index) == cache.end()) {
+            ++misses;
+            cache.push_back(index);
+            if (cache.size() > cacheSize) {
+                cache.pop_front();
+            }
+        }
+    }
+    return misses;
+}
+
+void VertexCacheTest::testTrianglesPreserved() {
+    const int GRID_SIZE = 24;
+    const int NUM_VERTICES = (GRID_SIZE + 1) * (GRID_SIZE + 1);
+    auto indices = makeGridTriangles(GRID_SIZE);
+    // a degenerate triangle, and a trailing index that isn't part of a triangle
+    indices.insert(indices.end(), { 5, 5, 6, 7 });
+    auto optimized = indices;
+
+    QVERIFY(baker::optimizeTrianglesForVertexCache(optimized.data(), (int)optimized.size(), NUM_VERTICES));
+    QCOMPARE(optimized.size(), indices.size());
+    QCOMPARE(optimized.back(), indices.back());
+    QVERIFY(getSortedTriangles(optimized) == getSortedTriangles(indices));
+}
+
+void VertexCacheTest::testFewerCacheMisses() {
+    const int GRID_SIZE = 64;
+    const int NUM_VERTICES = (GRID_SIZE + 1) * (GRID_SIZE + 1);
+    const size_t CACHE_SIZE = 16;
+    auto indices = makeGridTriangles(GRID_SIZE);
+    auto optimized = indices;
+
+    QVERIFY(baker::optimizeTrianglesForVertexCache(optimized.data(), (int)optimized.size(), NUM_VERTICES));
+    QVERIFY(countCacheMisses(optimized, CACHE_SIZE) < countCacheMisses(indices, CACHE_SIZE));
+}
+
+void VertexCacheTest::testOutOfRangeIndices() {
+    std::vector<int> indices { 0, 1, 2, 2, 1, 3 };
+    auto optimized = indices;
+
+    QVERIFY(!baker::optimizeTrianglesForVertexCache(optimized.data(), (int)optimized.size(), 3));
+    QVERIFY(optimized == indices);
+}
@@ -0,0 +1,25 @@
+//
+//  VertexCacheTest.h
+//  tests/baking/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_VertexCacheTest_h
+#define vircadia_VertexCacheTest_h
+
+#include <QtTest/QtTest>
+
+class VertexCacheTest : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testTrianglesPreserved();
+    void testFewerCacheMisses();
+    void testOutOfRangeIndices();
+};
+
+#endif // vircadia_VertexCacheTest_h
@@ -0,0 +1,83 @@
+//
+//  PacketBufferPoolTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PacketBufferPoolTests.h"
+
+#include <thread>
+#include <vector>
+
+#include <udt/PacketBufferPool.h>
+
+QTEST_MAIN(PacketBufferPoolTests)
+
+using namespace udt;
+
+void PacketBufferPoolTests::reuseTest() {
+    PacketBufferPool::sampleStats();
+
+    char* first;
+    {
+        auto buffer = PacketBufferPool::allocate(100);
+        first = buffer.get();
+    }
+
+    auto buffer = PacketBufferPool::allocate(PacketBufferPool::BUFFER_SIZE);
+    QCOMPARE(buffer.get(), first);
+
+    auto stats = PacketBufferPool::sampleStats();
+    QCOMPARE(stats.hits + stats.misses, (uint64_t)2);
+    QVERIFY(stats.hits >= 1);
+}
+
+void PacketBufferPoolTests::zeroedTest() {
+    {
+        auto buffer = PacketBufferPool::allocate(PacketBufferPool::BUFFER_SIZE);
+        memset(buffer.get(), 0xff, PacketBufferPool::BUFFER_SIZE);
+    }
+
+    const int SIZE = 64;
+    auto buffer = PacketBufferPool::allocate(SIZE, true);
+    for (int i = 0; i < SIZE; ++i) {
+        QCOMPARE(buffer[i], (char)0);
+    }
+}
+
+void PacketBufferPoolTests::crossThreadTest() {
+    const int NUM_BUFFERS = 1000;
+
+    std::vector<PacketBuffer> buffers;
+    for (int i = 0; i < NUM_BUFFERS; ++i) {
+        buffers.push_back(PacketBufferPool::allocate(PacketBufferPool::BUFFER_SIZE));
+    }
+
+    std::thread releasingThread([&] { buffers.clear(); });
+    releasingThread.join();
+
+    PacketBufferPool::sampleStats();
+    for (int i = 0; i < NUM_BUFFERS; ++i) {
+        buffers.push_back(PacketBufferPool::allocate(PacketBufferPool::BUFFER_SIZE));
+    }
+
+    auto stats = PacketBufferPool::sampleStats();
+    QCOMPARE(stats.hits, (uint64_t)NUM_BUFFERS);
+    QCOMPARE(stats.misses, (uint64_t)0);
+}
+
+void PacketBufferPoolTests::oversizedTest() {
+    const int SIZE = PacketBufferPool::BUFFER_SIZE * 2;
+
+    PacketBufferPool::sampleStats();
+    auto buffer = PacketBufferPool::allocate(SIZE, true);
+    buffer[SIZE - 1] = 1;
+
+    auto stats = PacketBufferPool::sampleStats();
+    QCOMPARE(stats.oversized, (uint64_t)1);
+    QCOMPARE(stats.hits + stats.misses, (uint64_t)0);
+}
@@ -0,0 +1,32 @@
+//
+//  PacketBufferPoolTests.h
+//  tests/networking/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_PacketBufferPoolTests_h
+#define vircadia_PacketBufferPoolTests_h
+
+#include <QtTest/QtTest>
+
+class PacketBufferPoolTests : public QObject {
+    Q_OBJECT
+private slots:
+    // Test that released buffers are handed out again
+    void reuseTest();
+
+    // Test that zeroed allocations are zeroed even when reused
+    void zeroedTest();
+
+    // Test that buffers freed on another thread find their way back
+    void crossThreadTest();
+
+    // Test that allocations larger than a pooled buffer still work
+    void oversizedTest();
+};
+
+#endif // vircadia_PacketBufferPoolTests_h
@@ -19,7 +19,7 @@ QTEST_MAIN(PacketTests)
 
 std::unique_ptr<NLPacket> copyToReadPacket(std::unique_ptr<NLPacket>& packet) {
     auto size = packet->getDataSize();
-    auto data = std::unique_ptr<char[]>(new char[size]);
+    auto data = udt::PacketBufferPool::allocate(size);
     memcpy(data.get(), packet->getData(), size);
     return NLPacket::fromReceivedPacket(std::move(data), size, SockAddr());
 }
@@ -0,0 +1,82 @@
+//
+//  PacketVerificationTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PacketVerificationTests.h"
+
+#include <HMACAuth.h>
+#include <NLPacket.h>
+#include <SipHash.h>
+
+QTEST_MAIN(PacketVerificationTests)
+
+// a typical mixed audio packet payload
+static const int BENCHMARK_PAYLOAD_SIZE = 1000;
+
+void PacketVerificationTests::sipHashVectorsTest() {
+    uint8_t key[SipHash::KEY_SIZE];
+    for (int i = 0; i < SipHash::KEY_SIZE; ++i) {
+        key[i] = (uint8_t)i;
+    }
+    char message[64];
+    for (int i = 0; i < 64; ++i) {
+        message[i] = (char)i;
+    }
+
+    SipHash hash;
+    hash.setKey(key);
+
+    const std::vector<std::pair<int, QByteArray>> vectors = {
+        { 0, "a3817f04ba25a8e66df67214c7550293" },
+        { 1, "da87c1d86b99af44347659119b22fc45" },
+        { 63, "5150d1772f50834a503e069a973fbd7c" }
+    };
+    for (const auto& vector : vectors) {
+        SipHash::Hash result;
+        hash.calculateHash(result, message, vector.first);
+        QCOMPARE(QByteArray((const char*)result.data(), (int)result.size()).toHex(), vector.second);
+    }
+}
+
+void PacketVerificationTests::packetVerificationTest() {
+    SipHash hash(QUuid::createUuid());
+    SipHash otherHash(QUuid::createUuid());
+
+    auto packet = NLPacket::create(PacketType::MicrophoneAudioNoEcho);
+    QByteArray payload(100, 'a');
+    packet->write(payload);
+    packet->writeVerificationHash(hash);
+
+    QVERIFY(NLPacket::verificationHashMatches(*packet, hash));
+    QVERIFY(!NLPacket::verificationHashMatches(*packet, otherHash));
+
+    packet->getData()[packet->getDataSize() - 1] ^= 1;
+    QVERIFY(!NLPacket::verificationHashMatches(*packet, hash));
+}
+
+void PacketVerificationTests::hmacBenchmark() {
+    HMACAuth hmacAuth;
+    hmacAuth.setKey(QUuid::createUuid());
+    QByteArray payload(BENCHMARK_PAYLOAD_SIZE, 'a');
+
+    HMACAuth::HMACHash result;
+    QBENCHMARK {
+        hmacAuth.calculateHash(result, payload.constData(), payload.size());
+    }
+}
+
+void PacketVerificationTests::sipHashBenchmark() {
+    SipHash hash(QUuid::createUuid());
+    QByteArray payload(BENCHMARK_PAYLOAD_SIZE, 'a');
+
+    SipHash::Hash result;
+    QBENCHMARK {
+        hash.calculateHash(result, payload.constData(), payload.size());
+    }
+}
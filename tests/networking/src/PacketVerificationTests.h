@@ -0,0 +1,30 @@
+//
+//  PacketVerificationTests.h
+//  tests/networking/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_PacketVerificationTests_h
+#define vircadia_PacketVerificationTests_h
+
+#include <QtTest/QtTest>
+
+class PacketVerificationTests : public QObject {
+    Q_OBJECT
+private slots:
+    // Test SipHash against the reference implementation's test vectors
+    void sipHashVectorsTest();
+
+    // Test that a packet's verification hash matches only with its own key and payload
+    void packetVerificationTest();
+
+    // Compare the throughput of the old HMAC-md5 verification with SipHash
+    void hmacBenchmark();
+    void sipHashBenchmark();
+};
+
+#endif // vircadia_PacketVerificationTests_h
@@ -0,0 +1,74 @@
+//
+//  ReceivedMessageTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ReceivedMessageTests.h"
+
+#include <NLPacket.h>
+#include <ReceivedMessage.h>
+
+QTEST_MAIN(ReceivedMessageTests)
+
+static std::unique_ptr<NLPacket> messagePacket(udt::Packet::PacketPosition position, char fill, qint64 size) {
+    auto packet = NLPacket::create(PacketType::EntityEdit, size, true, true);
+    packet->writeMessageNumber(1, position, 0);
+    QByteArray payload(size, fill);
+    packet->write(payload);
+    packet->seek(0);
+    return packet;
+}
+
+// a message of three packets: 100 'a's, 100 'b's and 50 'c's
+static QSharedPointer<ReceivedMessage> threePacketMessage() {
+    auto message = QSharedPointer<ReceivedMessage>::create(messagePacket(udt::Packet::FIRST, 'a', 100));
+    message->appendPacket(messagePacket(udt::Packet::MIDDLE, 'b', 100));
+    message->appendPacket(messagePacket(udt::Packet::LAST, 'c', 50));
+    return message;
+}
+
+void ReceivedMessageTests::readAcrossPacketsTest() {
+    auto message = threePacketMessage();
+    QVERIFY(message->isComplete());
+    QCOMPARE(message->getSize(), (qint64)250);
+    QCOMPARE(message->getNumPackets(), (qint64)3);
+
+    message->seek(90);
+    char data[120];
+    QCOMPARE(message->read(data, sizeof(data)), (qint64)sizeof(data));
+    QCOMPARE(QByteArray(data, sizeof(data)), QByteArray(10, 'a') + QByteArray(100, 'b') + QByteArray(10, 'c'));
+    QCOMPARE(message->getPosition(), (qint64)210);
+
+    QCOMPARE(message->readAll(), QByteArray(40, 'c'));
+    QCOMPARE(message->getBytesLeftToRead(), (qint64)0);
+}
+
+void ReceivedMessageTests::flattenTest() {
+    auto message = threePacketMessage();
+
+    // within a packet
+    message->seek(110);
+    QCOMPARE(message->readWithoutCopy(20), QByteArray(20, 'b'));
+
+    // across packets
+    message->seek(190);
+    QCOMPARE(message->readWithoutCopy(20), QByteArray(10, 'b') + QByteArray(10, 'c'));
+
+    auto expected = QByteArray(100, 'a') + QByteArray(100, 'b') + QByteArray(50, 'c');
+    QCOMPARE(message->getMessage(), expected);
+    QCOMPARE(QByteArray(message->getRawMessage(), message->getSize()), expected);
+}
+
+void ReceivedMessageTests::readHeadTest() {
+    auto message = QSharedPointer<ReceivedMessage>::create(messagePacket(udt::Packet::FIRST, 'a', 400));
+    message->appendPacket(messagePacket(udt::Packet::LAST, 'b', 400));
+
+    // the head is the first 512 bytes
+    message->seek(500);
+    QCOMPARE(message->readHead(20), QByteArray(12, 'b'));
+}
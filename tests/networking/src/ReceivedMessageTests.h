@@ -0,0 +1,29 @@
+//
+//  ReceivedMessageTests.h
+//  tests/networking/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_ReceivedMessageTests_h
+#define vircadia_ReceivedMessageTests_h
+
+#include <QtTest/QtTest>
+
+class ReceivedMessageTests : public QObject {
+    Q_OBJECT
+private slots:
+    // Test that reads spanning the packets of a message return the payloads in order
+    void readAcrossPacketsTest();
+
+    // Test that readWithoutCopy and getMessage see the whole message
+    void flattenTest();
+
+    // Test that readHead is limited to the head of the message
+    void readHeadTest();
+};
+
+#endif // vircadia_ReceivedMessageTests_h
@@ -0,0 +1,116 @@
+//
+//  SelectiveACKTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SelectiveACKTests.h"
+
+#include <udt/ControlPacket.h>
+#include <udt/LossList.h>
+#include <udt/PacketBufferPool.h>
+#include <udt/SentPacketRing.h>
+
+QTEST_MAIN(SelectiveACKTests)
+
+using namespace udt;
+
+static std::unique_ptr<ControlPacket> copyToReadPacket(const ControlPacket& packet) {
+    auto size = packet.getDataSize();
+    auto data = PacketBufferPool::allocate(size);
+    memcpy(data.get(), packet.getData(), size);
+    return ControlPacket::fromReceivedPacket(std::move(data), size, SockAddr());
+}
+
+void SelectiveACKTests::fillTest() {
+    // 10 is missing (so the ACK is 9), as are 13 and 14, and 20 is the last received
+    LossList lossList;
+    lossList.append(SequenceNumber(10));
+    lossList.append(SequenceNumber(13), SequenceNumber(14));
+
+    SelectiveACK selectiveACK;
+    lossList.fillSelectiveACK(SequenceNumber(9), SequenceNumber(20), selectiveACK);
+
+    QCOMPARE(selectiveACK.numWords, 1);
+    for (int bit = 0; bit < 32; ++bit) {
+        auto sequenceNumber = 11 + bit;
+        bool isReceived = sequenceNumber <= 20 && sequenceNumber != 13 && sequenceNumber != 14;
+        QCOMPARE(selectiveACK.isSet(bit), isReceived);
+    }
+
+    // nothing past the hole, nothing to report
+    LossList tailLoss;
+    tailLoss.append(SequenceNumber(10));
+    tailLoss.fillSelectiveACK(SequenceNumber(9), SequenceNumber(10), selectiveACK);
+    QCOMPARE(selectiveACK.numWords, 0);
+}
+
+void SelectiveACKTests::roundTripTest() {
+    SelectiveACK selectiveACK;
+    selectiveACK.numWords = 2;
+    selectiveACK.words[0] = 0xF0F0F0F0;
+    selectiveACK.words[1] = 0x00000001;
+
+    auto packet = ControlPacket::create(ControlPacket::ACK, ControlPacket::MAX_ACK_PAYLOAD_BYTES);
+    packet->writePrimitive(SequenceNumber(42));
+    packet->writeSelectiveACK(selectiveACK);
+
+    auto received = copyToReadPacket(*packet);
+    SequenceNumber ack;
+    received->readPrimitive(&ack);
+    QCOMPARE(ack, SequenceNumber(42));
+
+    SelectiveACK readBack;
+    received->readSelectiveACK(readBack);
+    QCOMPARE(readBack.numWords, 2);
+    QCOMPARE(readBack.words[0], selectiveACK.words[0]);
+    QCOMPARE(readBack.words[1], selectiveACK.words[1]);
+
+    auto plain = ControlPacket::create(ControlPacket::ACK, ControlPacket::MAX_ACK_PAYLOAD_BYTES);
+    plain->writePrimitive(SequenceNumber(42));
+
+    auto receivedPlain = copyToReadPacket(*plain);
+    receivedPlain->readPrimitive(&ack);
+
+    SelectiveACK empty;
+    receivedPlain->readSelectiveACK(empty);
+    QCOMPARE(empty.numWords, 0);
+}
+
+void SelectiveACKTests::sentPacketRingTest() {
+    SentPacketRing ring;
+
+    // start close to the wrap so that the ring has to grow across it
+    auto first = SequenceNumber(SequenceNumber::MAX - 50);
+    static const int NUM_PACKETS = 200;
+
+    auto sequenceNumber = first;
+    for (int i = 0; i < NUM_PACKETS; ++i, ++sequenceNumber) {
+        ring.append(sequenceNumber, Packet::create());
+        ring.find(sequenceNumber)->resendCount = (uint8_t)i;
+    }
+    QCOMPARE(ring.getCount(), NUM_PACKETS);
+
+    sequenceNumber = first;
+    for (int i = 0; i < NUM_PACKETS; ++i, ++sequenceNumber) {
+        auto entry = ring.find(sequenceNumber);
+        QVERIFY(entry);
+        QVERIFY(entry->packet);
+        QCOMPARE(entry->resendCount, (uint8_t)i);
+    }
+    QVERIFY(!ring.find(first - 1));
+    QVERIFY(!ring.find(first + NUM_PACKETS));
+
+    ring.removeUpTo(first + 99);
+    QCOMPARE(ring.getCount(), NUM_PACKETS - 100);
+    QCOMPARE(ring.getFirstSequenceNumber(), first + 100);
+    QVERIFY(!ring.find(first + 99));
+    QCOMPARE(ring.find(first + 100)->resendCount, (uint8_t)100);
+
+    ring.removeUpTo(first + NUM_PACKETS);
+    QVERIFY(ring.isEmpty());
+}
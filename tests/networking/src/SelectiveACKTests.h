@@ -0,0 +1,29 @@
+//
+//  SelectiveACKTests.h
+//  tests/networking/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_SelectiveACKTests_h
+#define vircadia_SelectiveACKTests_h
+
+#include <QtTest/QtTest>
+
+class SelectiveACKTests : public QObject {
+    Q_OBJECT
+private slots:
+    // Test that the loss list only leaves the missing packets out of the bitmap
+    void fillTest();
+
+    // Test that the bitmap survives a trip through an ACK packet, and that a plain ACK reads as empty
+    void roundTripTest();
+
+    // Test append, find and removeUpTo on the sent packet ring, including growing and wrapping around
+    void sentPacketRingTest();
+};
+
+#endif // vircadia_SelectiveACKTests_h
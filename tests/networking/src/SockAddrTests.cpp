@@ -0,0 +1,48 @@
+//
+//  SockAddrTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SockAddrTests.h"
+
+#include <SockAddr.h>
+
+QTEST_MAIN(SockAddrTests)
+
+void SockAddrTests::keyEqualityTest() {
+    SockAddr first(SocketType::UDP, QHostAddress("192.168.1.20"), 40102);
+    SockAddr same(SocketType::UDP, QHostAddress("192.168.1.20"), 40102);
+    SockAddr otherPort(SocketType::UDP, QHostAddress("192.168.1.20"), 40103);
+    SockAddr otherAddress(SocketType::UDP, QHostAddress("192.168.1.21"), 40102);
+    SockAddr otherType(SocketType::WebRTC, QHostAddress("192.168.1.20"), 40102);
+
+    QVERIFY(SockAddrKey(first) == SockAddrKey(same));
+    QCOMPARE(SockAddrKey(first).hash(), SockAddrKey(same).hash());
+    QCOMPARE(std::hash<SockAddr>()(first), SockAddrKey(first).hash());
+
+    QVERIFY(SockAddrKey(first) != SockAddrKey(otherPort));
+    QVERIFY(SockAddrKey(first) != SockAddrKey(otherAddress));
+    QVERIFY(SockAddrKey(first) != SockAddrKey(otherType));
+
+    // a null SockAddr is the default key
+    QVERIFY(SockAddrKey(SockAddr()) == SockAddrKey());
+    QVERIFY(SockAddrKey(first) != SockAddrKey());
+}
+
+void SockAddrTests::ipv6KeyTest() {
+    SockAddr ipv6(SocketType::UDP, QHostAddress("2001:db8::20"), 40102);
+    SockAddr otherIPv6(SocketType::UDP, QHostAddress("2001:db8::21"), 40102);
+    SockAddr mapped(SocketType::UDP, QHostAddress("::ffff:192.168.1.20"), 40102);
+    SockAddr ipv4(SocketType::UDP, QHostAddress("192.168.1.20"), 40102);
+
+    QVERIFY(SockAddrKey(ipv6) == SockAddrKey(SockAddr(ipv6)));
+    QVERIFY(SockAddrKey(ipv6) != SockAddrKey(otherIPv6));
+
+    // as for QHostAddress, an IPv4 address and its IPv4-mapped IPv6 form are different addresses
+    QVERIFY(SockAddrKey(mapped) != SockAddrKey(ipv4));
+}
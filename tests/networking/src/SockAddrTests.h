@@ -0,0 +1,26 @@
+//
+//  SockAddrTests.h
+//  tests/networking/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_SockAddrTests_h
+#define vircadia_SockAddrTests_h
+
+#include <QtTest/QtTest>
+
+class SockAddrTests : public QObject {
+    Q_OBJECT
+private slots:
+    // Test that keys are equal, and hash the same, exactly when their SockAddrs are equal
+    void keyEqualityTest();
+
+    // Test that IPv6 addresses get distinct keys
+    void ipv6KeyTest();
+};
+
+#endif // vircadia_SockAddrTests_h
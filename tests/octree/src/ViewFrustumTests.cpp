@@ -422,6 +422,52 @@ void ViewFrustumTests::testCubeFrustumIntersection() {
     QCOMPARE(view.calculateCubeFrustumIntersection(cube), ViewFrustum::OUTSIDE);
 }
 
+void ViewFrustumTests::testBatchedCubeKeyholeIntersection() {
+    float aspect = 1.0f;
+    float fovX = PI / 2.0f;
+    float nearClip = 1.0f;
+    float farClip = 100.0f;
+    float holeRadius = 10.0f;
+
+    glm::vec3 center = glm::vec3(12.3f, 4.56f, 89.7f);
+    glm::quat rotation = glm::angleAxis(PI / 7.0f, Vectors::UNIT_Y);
+
+    ViewFrustum view;
+    view.setProjection(glm::perspective(fovX, aspect, nearClip, farClip));
+    view.setPosition(center);
+    view.setOrientation(rotation);
+    view.setCenterRadius(holeRadius);
+    view.calculate();
+
+    // a grid of cubes of several sizes around the view, reaching past the far clip, with one centered on it
+    std::vector<AACube> cubes;
+    for (int x = -6; x <= 6; ++x) {
+        for (int y = -2; y <= 2; ++y) {
+            for (int z = -6; z <= 6; ++z) {
+                float scale = 2.0f + (float)((x + y + z + 18) % 4) * 7.0f;
+                glm::vec3 cubeCenter = center + glm::vec3((float)x, (float)y, (float)z) * 19.0f;
+                cubes.push_back(AACube(cubeCenter - glm::vec3(0.5f * scale), scale));
+            }
+        }
+    }
+    cubes.push_back(AACube(center - glm::vec3(0.5f), 1.0f));
+
+    std::vector<ViewFrustum::intersection> results(cubes.size());
+    view.calculateCubeKeyholeIntersections(cubes.data(), (int)cubes.size(), results.data());
+
+    int numInside = 0;
+    int numIntersecting = 0;
+    for (size_t i = 0; i < cubes.size(); ++i) {
+        QCOMPARE(results[i], view.calculateCubeKeyholeIntersection(cubes[i]));
+        numInside += results[i] == ViewFrustum::INSIDE ? 1 : 0;
+        numIntersecting += results[i] == ViewFrustum::INTERSECT ? 1 : 0;
+    }
+    // make sure the grid covers every case
+    QVERIFY(numInside > 0);
+    QVERIFY(numIntersecting > 0);
+    QVERIFY(numInside + numIntersecting < (int)cubes.size());
+}
+
 void ViewFrustumTests::testPointIntersectsFrustum() {
     float aspect = 1.0f;
     float fovX = PI / 2.0f;
@@ -21,6 +21,7 @@ private slots:
     void testInit();
     void testCubeFrustumIntersection();
     void testCubeKeyholeIntersection();
+    void testBatchedCubeKeyholeIntersection();
     void testPointIntersectsFrustum();
     void testSphereIntersectsFrustum();
     void testBoxIntersectsFrustum();
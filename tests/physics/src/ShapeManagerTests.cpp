@@ -33,6 +33,9 @@ void ShapeManagerTests::testShapeAccounting() {
 
     // verify number of shapes
     QCOMPARE(shapeManager.getNumShapes(), 1);
+    QVERIFY(shapeManager.getShapesSize() > 0);
+    QCOMPARE(shapeManager.hasShape(shape), true);
+    QCOMPARE(shapeManager.getNumReferences(shape), 1);
 
     // reference the shape again and verify that we get the same pointer
     const btCollisionShape* otherShape = shapeManager.getShape(info);
@@ -75,6 +78,7 @@ void ShapeManagerTests::testShapeAccounting() {
     shapeManager.collectGarbage();
     QCOMPARE(shapeManager.getNumShapes(), 0);
     QCOMPARE(shapeManager.hasShape(shape), false);
+    QCOMPARE(shapeManager.getShapesSize(), (size_t)0);
 
     // add the shape again and verify that it gets added again
     otherShape = shapeManager.getShape(info);
@@ -244,3 +248,51 @@ void ShapeManagerTests::addCompoundShape() {
     QCOMPARE(shapeManager.getNumShapes(), 0);
     QCOMPARE(shapeManager.getNumReferences(info), 0);
 }
+
+void ShapeManagerTests::addLargeCompoundShapeOffThread() {
+    // hulls of points on spheres, with enough points in all that the shape is built on a worker
+    const int numHulls = 4;
+    const int numPointsPerHull = 512;
+    ShapeInfo::PointCollection pointCollection;
+    Extents extents;
+    for (int i = 0; i < numHulls; ++i) {
+        glm::vec3 center((float)(2 * i), 0.0f, 0.0f);
+        ShapeInfo::PointList pointList;
+        for (int j = 0; j < numPointsPerHull; ++j) {
+            float theta = (float)j * 0.1f;
+            float z = 2.0f * (float)j / (float)numPointsPerHull - 1.0f;
+            float r = sqrtf(1.0f - z * z);
+            glm::vec3 point = center + glm::vec3(r * cosf(theta), r * sinf(theta), z);
+            pointList.push_back(point);
+            extents.addPoint(point);
+        }
+        pointCollection.push_back(pointList);
+    }
+
+    ShapeInfo info;
+    info.setParams(SHAPE_TYPE_COMPOUND, 0.5f * (extents.maximum - extents.minimum));
+    info.setPointCollection(pointCollection);
+    QVERIFY(ShapeManager::isBuiltOffThread(info));
+
+    // the shape isn't there until the worker delivers it
+    ShapeManager shapeManager;
+    QVERIFY(shapeManager.getShape(info) == nullptr);
+    QCOMPARE(shapeManager.getWorkRequestCount(), (uint32_t)1);
+
+    // asking again while it's being built waits on the same worker, only one shape is delivered
+    QVERIFY(shapeManager.getShape(info) == nullptr);
+    QCOMPARE(shapeManager.getWorkRequestCount(), (uint32_t)2);
+
+    QTRY_COMPARE(shapeManager.getWorkDeliveryCount(), (uint32_t)1);
+    QVERIFY(shapeManager.hasShapeWithKey(info.getHash()));
+    QCOMPARE(shapeManager.getNumReferences(info), 0);
+
+    const btCollisionShape* shape = shapeManager.getShapeByKey(info.getHash());
+    QVERIFY(shape != nullptr);
+    QCOMPARE(shape->getShapeType(), (int)COMPOUND_SHAPE_PROXYTYPE);
+    QCOMPARE(static_cast<const btCompoundShape*>(shape)->getNumChildShapes(), numHulls);
+    QCOMPARE(shapeManager.getNumReferences(info), 1);
+
+    shapeManager.releaseShape(shape);
+    QCOMPARE(shapeManager.getNumReferences(info), 0);
+}
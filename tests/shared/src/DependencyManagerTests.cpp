@@ -216,3 +216,22 @@ void DependencyManagerTests::testDependencyManagerMultiThreaded() {
     getThread2.join();
     assertDeps(false);
 }
+
+void DependencyManagerTests::testReplacedDependency() {
+    auto first = DependencyManager::set<A>();
+    QCOMPARE(DependencyManager::get<A>(), first);
+
+    // get() caches the instance, so a replacement must still be seen, on this thread and others
+    auto second = DependencyManager::set<A>();
+    QCOMPARE(DependencyManager::get<A>(), second);
+    QSharedPointer<A> seenByThread;
+    std::thread getThread([&] { seenByThread = DependencyManager::get<A>(); });
+    getThread.join();
+    QCOMPARE(seenByThread, second);
+
+    first.clear();
+    second.clear();
+    seenByThread.clear();
+    DependencyManager::destroy<A>();
+    QVERIFY(DependencyManager::get<A>().isNull());
+}
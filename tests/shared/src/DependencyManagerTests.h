@@ -16,6 +16,7 @@ class DependencyManagerTests : public QObject {
 private slots:
     void testDependencyManager();
     void testDependencyManagerMultiThreaded();
+    void testReplacedDependency();
 };
 
 #endif // hifi_DependencyManagerTests_h
@@ -0,0 +1,72 @@
+//
+//  FrameTraceTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "FrameTraceTests.h"
+
+#include <thread>
+#include <vector>
+
+#include <FrameTrace.h>
+
+QTEST_MAIN(FrameTraceTests)
+
+using namespace tracing;
+
+void FrameTraceTests::testRecordsFromThreads() {
+    uint32_t nameId = FrameTrace::registerName("testRecordsFromThreads");
+    QCOMPARE(FrameTrace::registerName("testRecordsFromThreads"), nameId);
+    QCOMPARE(QString(FrameTrace::getName(nameId)), QString("testRecordsFromThreads"));
+
+    const int NUM_THREADS = 4;
+    const int NUM_RECORDS = 100;
+    uint64_t start = FrameTrace::now();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back([start, nameId] {
+            for (int j = 0; j < NUM_RECORDS; ++j) {
+                FrameTrace::record(nameId, start + j, start + j + 10);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    int numRecords = 0;
+    uint64_t lastStart = 0;
+    for (const auto& record : FrameTrace::getRecords(start)) {
+        QVERIFY(record.startUsecs >= lastStart);
+        lastStart = record.startUsecs;
+        if (record.nameId == nameId) {
+            QCOMPARE(record.durationUsecs, (uint32_t)10);
+            ++numRecords;
+        }
+    }
+    QCOMPARE(numRecords, NUM_THREADS * NUM_RECORDS);
+}
+
+void FrameTraceTests::testRingKeepsNewest() {
+    uint32_t nameId = FrameTrace::registerName("testRingKeepsNewest");
+
+    // far more than a ring holds
+    const int NUM_RECORDS = 100000;
+    uint64_t start = FrameTrace::now();
+    std::thread thread([start, nameId] {
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            FrameTrace::record(nameId, start + i, start + i + 1);
+        }
+    });
+    thread.join();
+
+    auto records = FrameTrace::getRecords(start);
+    QVERIFY(!records.empty());
+    QVERIFY(records.size() < (size_t)NUM_RECORDS);
+    QCOMPARE(records.back().startUsecs, start + NUM_RECORDS - 1);
+}
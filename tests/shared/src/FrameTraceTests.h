@@ -0,0 +1,24 @@
+//
+//  FrameTraceTests.h
+//  tests/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_FrameTraceTests_h
+#define vircadia_FrameTraceTests_h
+
+#include <QtTest/QtTest>
+
+class FrameTraceTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testRecordsFromThreads();
+    void testRingKeepsNewest();
+};
+
+#endif // vircadia_FrameTraceTests_h
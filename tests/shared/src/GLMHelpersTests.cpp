@@ -105,6 +105,72 @@ void GLMHelpersTests::testSixByteOrientationCompression() {
     testQuatCompression(-(ROT_Z_30 * ROT_X_90 * ROT_Y_180));
 }
 
+void GLMHelpersTests::testBatchedSixByteOrientationUnpacking() {
+    // enough rotations to span more than one batch, with each component being the largest in turn
+    const int NUM_QUATS = 37;
+    std::vector<uint8_t> bytes(NUM_QUATS * 6);
+    for (int i = 0; i < NUM_QUATS; i++) {
+        glm::vec3 axis = glm::normalize(glm::vec3(sinf((float)i), cosf((float)i * 0.7f), 0.3f + (float)(i % 5)));
+        glm::quat rotation = glm::angleAxis((float)i * 0.17f, axis);
+        packOrientationQuatToSixBytes(&bytes[i * 6], rotation);
+    }
+
+    std::vector<glm::quat> batched(NUM_QUATS);
+    QCOMPARE(unpackOrientationQuatsFromSixBytes(bytes.data(), batched.data(), NUM_QUATS), NUM_QUATS * 6);
+
+    for (int i = 0; i < NUM_QUATS; i++) {
+        glm::quat single;
+        unpackOrientationQuatFromSixBytes(&bytes[i * 6], single);
+        QCOMPARE_WITH_ABS_ERROR(batched[i], single, EPSILON);
+    }
+}
+
+void GLMHelpersTests::testBatchedSixByteOrientationPacking() {
+    const int NUM_QUATS = 37;
+    std::vector<glm::quat> rotations;
+    for (int i = 0; i < NUM_QUATS; i++) {
+        glm::vec3 axis = glm::normalize(glm::vec3(sinf((float)i), cosf((float)i * 0.7f), 0.3f + (float)(i % 5)));
+        rotations.push_back(glm::angleAxis((float)i * 0.17f, axis));
+    }
+    // components of equal size, where the first of them is the one dropped
+    rotations[3] = glm::quat(0.5f, 0.5f, -0.5f, 0.5f);
+
+    std::vector<uint8_t> single(NUM_QUATS * 6);
+    for (int i = 0; i < NUM_QUATS; i++) {
+        packOrientationQuatToSixBytes(&single[i * 6], rotations[i]);
+    }
+    std::vector<uint8_t> batched(NUM_QUATS * 6);
+    QCOMPARE(packOrientationQuatsToSixBytes(batched.data(), rotations.data(), NUM_QUATS), NUM_QUATS * 6);
+    QVERIFY(batched == single);
+}
+
+void GLMHelpersTests::testBatchedSignedTwoByteFixedPacking() {
+    const int NUM_VECS = 23;
+    const int RADIX = 14;
+    std::vector<glm::vec3> vecs;
+    for (int i = 0; i < NUM_VECS; i++) {
+        vecs.emplace_back(sinf((float)i) * 1.5f, cosf((float)i) * 0.25f, (float)(i - NUM_VECS / 2) * 0.1f);
+    }
+    // out of range values are clamped
+    vecs[5] = glm::vec3(4.0f, -4.0f, 0.0f);
+
+    std::vector<uint8_t> single(NUM_VECS * 6);
+    for (int i = 0; i < NUM_VECS; i++) {
+        packFloatVec3ToSignedTwoByteFixed(&single[i * 6], vecs[i], RADIX);
+    }
+    std::vector<uint8_t> batched(NUM_VECS * 6);
+    QCOMPARE(packFloatVec3sToSignedTwoByteFixed(batched.data(), vecs.data(), NUM_VECS, RADIX), NUM_VECS * 6);
+    QVERIFY(batched == single);
+
+    std::vector<glm::vec3> unpacked(NUM_VECS);
+    QCOMPARE(unpackFloatVec3sFromSignedTwoByteFixed(single.data(), unpacked.data(), NUM_VECS, RADIX), NUM_VECS * 6);
+    for (int i = 0; i < NUM_VECS; i++) {
+        glm::vec3 vec;
+        unpackFloatVec3FromSignedTwoByteFixed(&single[i * 6], vec, RADIX);
+        QCOMPARE(unpacked[i], vec);
+    }
+}
+
 #define LOOPS 500000
 
 void GLMHelpersTests::testSimd() {
@@ -249,4 +315,44 @@ void GLMHelpersTests::roundPerf() {
     }
 
     qDebug() << "ratio: " << (float)glmTime.count() / (float)manualTime.count() << ", identical: " << identical;
-}
\ No newline at end of file
+}
+
+void GLMHelpersTests::batchedPackingPerf() {
+    // a frame's worth of avatar joints, packed and unpacked as they are for an avatar data packet
+    const int NUM_JOINTS = 200;
+    const int NUM_FRAMES = 10000;
+    const int RADIX = 14;
+    std::vector<glm::quat> rotations;
+    std::vector<glm::vec3> translations;
+    for (int i = 0; i < NUM_JOINTS; i++) {
+        glm::vec3 axis = glm::normalize(glm::vec3(randFloatInRange(-1.0f, 1.0f), randFloatInRange(-1.0f, 1.0f), 1.0f));
+        rotations.push_back(glm::angleAxis(randFloatInRange(-PI, PI), axis));
+        translations.emplace_back(randFloatInRange(-1.0f, 1.0f), randFloatInRange(-1.0f, 1.0f), randFloatInRange(-1.0f, 1.0f));
+    }
+    std::vector<uint8_t> rotationBytes(NUM_JOINTS * 6);
+    std::vector<uint8_t> translationBytes(NUM_JOINTS * 6);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int frame = 0; frame < NUM_FRAMES; frame++) {
+        for (int i = 0; i < NUM_JOINTS; i++) {
+            packOrientationQuatToSixBytes(&rotationBytes[i * 6], rotations[i]);
+            packFloatVec3ToSignedTwoByteFixed(&translationBytes[i * 6], translations[i], RADIX);
+        }
+        for (int i = 0; i < NUM_JOINTS; i++) {
+            unpackOrientationQuatFromSixBytes(&rotationBytes[i * 6], rotations[i]);
+            unpackFloatVec3FromSignedTwoByteFixed(&translationBytes[i * 6], translations[i], RADIX);
+        }
+    }
+    auto singleTime = std::chrono::high_resolution_clock::now() - start;
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int frame = 0; frame < NUM_FRAMES; frame++) {
+        packOrientationQuatsToSixBytes(rotationBytes.data(), rotations.data(), NUM_JOINTS);
+        packFloatVec3sToSignedTwoByteFixed(translationBytes.data(), translations.data(), NUM_JOINTS, RADIX);
+        unpackOrientationQuatsFromSixBytes(rotationBytes.data(), rotations.data(), NUM_JOINTS);
+        unpackFloatVec3sFromSignedTwoByteFixed(translationBytes.data(), translations.data(), NUM_JOINTS, RADIX);
+    }
+    auto batchedTime = std::chrono::high_resolution_clock::now() - start;
+
+    qDebug() << "ratio: " << (float)singleTime.count() / (float)batchedTime.count();
+}
@@ -20,9 +20,13 @@ class GLMHelpersTests : public QObject {
 private slots:
     void testEulerDecomposition();
     void testSixByteOrientationCompression();
+    void testBatchedSixByteOrientationUnpacking();
+    void testBatchedSixByteOrientationPacking();
+    void testBatchedSignedTwoByteFixedPacking();
     void testSimd();
     void testGenerateBasisVectors();
     void roundPerf();
+    void batchedPackingPerf();
 };
 
 float getErrorDifference(const float& a, const float& b);
@@ -0,0 +1,78 @@
+//
+//  GzipTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "GzipTests.h"
+
+#include <QtCore/QBuffer>
+
+#include <Gzip.h>
+
+QTEST_MAIN(GzipTests)
+
+static QByteArray makeTestData() {
+    QByteArray data;
+    for (int i = 0; i < 10000; i++) {
+        data += QByteArray::number(i) + " {\"type\": \"Box\", \"name\": \"entity\"},\n";
+    }
+    return data;
+}
+
+void GzipTests::roundTripTest() {
+    QByteArray data = makeTestData();
+    QByteArray compressed;
+    QVERIFY(gzip(data, compressed));
+    QVERIFY(compressed.size() < data.size());
+
+    QByteArray uncompressed;
+    QVERIFY(gunzip(compressed, uncompressed));
+    QCOMPARE(uncompressed, data);
+}
+
+void GzipTests::streamedWriteTest() {
+    QByteArray data = makeTestData();
+
+    QByteArray compressed;
+    QBuffer buffer(&compressed);
+    buffer.open(QIODevice::WriteOnly);
+    GzipWriter writer(buffer);
+
+    // in pieces that don't line up with the compression chunks
+    const int PIECE_SIZE = 1000;
+    for (int i = 0; i < data.size(); i += PIECE_SIZE) {
+        QVERIFY(writer.write(data.mid(i, PIECE_SIZE)));
+    }
+    QVERIFY(writer.finish());
+    QVERIFY(!writer.write(data));
+
+    QByteArray uncompressed;
+    QVERIFY(gunzip(compressed, uncompressed));
+    QCOMPARE(uncompressed, data);
+}
+
+void GzipTests::dictionaryTest() {
+    QByteArray dictionary = "{\"grabbableKey\":{\"grabbable\":false}}https://cdn.example.com/models/.fbx";
+    QByteArray data = "{\"grabbableKey\":{\"grabbable\":false}} https://cdn.example.com/models/chair.fbx";
+
+    QByteArray compressed;
+    QVERIFY(zlibCompressWithDictionary(data, compressed, dictionary));
+
+    // a payload this small barely compresses on its own
+    QByteArray compressedAlone;
+    QVERIFY(zlibCompressWithDictionary(data, compressedAlone, QByteArray()));
+    QVERIFY(compressed.size() < compressedAlone.size() / 2);
+
+    QByteArray uncompressed;
+    QVERIFY(zlibUncompressWithDictionary(compressed, uncompressed, dictionary));
+    QCOMPARE(uncompressed, data);
+
+    QVERIFY(!zlibUncompressWithDictionary(compressed, uncompressed, "some other dictionary"));
+    QVERIFY(!zlibUncompressWithDictionary(compressed.left(compressed.size() - 2), uncompressed, dictionary));
+    QVERIFY(getZlibDictionaryID(dictionary) != getZlibDictionaryID("some other dictionary"));
+}
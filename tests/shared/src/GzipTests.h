@@ -0,0 +1,24 @@
+//
+//  GzipTests.h
+//  tests/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_GzipTests_h
+#define vircadia_GzipTests_h
+
+#include <QtTest/QtTest>
+
+class GzipTests : public QObject {
+    Q_OBJECT
+private slots:
+    void roundTripTest();
+    void streamedWriteTest();
+    void dictionaryTest();
+};
+
+#endif // vircadia_GzipTests_h
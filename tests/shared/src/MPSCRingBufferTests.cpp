@@ -0,0 +1,93 @@
+//
+//  MPSCRingBufferTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "MPSCRingBufferTests.h"
+
+#include <thread>
+#include <vector>
+
+#include <MPSCRingBuffer.h>
+
+QTEST_MAIN(MPSCRingBufferTests)
+
+void MPSCRingBufferTests::pushPopTest() {
+    MPSCRingBuffer<int> buffer(5);
+    QCOMPARE(buffer.capacity(), (size_t)8);
+    QVERIFY(buffer.empty());
+
+    for (int i = 0; i < 20; ++i) {
+        int value = i;
+        QVERIFY(buffer.push(std::move(value)));
+        int popped = -1;
+        QVERIFY(buffer.pop(popped));
+        QCOMPARE(popped, i);
+    }
+    int popped;
+    QVERIFY(!buffer.pop(popped));
+}
+
+void MPSCRingBufferTests::fullTest() {
+    MPSCRingBuffer<std::shared_ptr<int>> buffer(4);
+    for (int i = 0; i < 4; ++i) {
+        QVERIFY(buffer.push(std::make_shared<int>(i)));
+    }
+    auto extra = std::make_shared<int>(4);
+    QVERIFY(!buffer.push(std::move(extra)));
+    QVERIFY(extra); // left alone when the buffer is full
+    QCOMPARE(buffer.size(), (size_t)4);
+
+    std::vector<std::shared_ptr<int>> batch;
+    QCOMPARE(buffer.popBatch(batch, 3), (size_t)3);
+    QCOMPARE(*batch[0], 0);
+    QCOMPARE(*batch[2], 2);
+    QVERIFY(buffer.push(std::move(extra)));
+    QCOMPARE(buffer.popBatch(batch, 10), (size_t)2);
+    QCOMPARE(*batch[4], 4);
+    QVERIFY(buffer.empty());
+}
+
+void MPSCRingBufferTests::multipleProducersTest() {
+    const int NUM_PRODUCERS = 4;
+    const int ITEMS_PER_PRODUCER = 20000;
+    MPSCRingBuffer<int> buffer(256);
+
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < NUM_PRODUCERS; ++producer) {
+        producers.emplace_back([&buffer, producer] {
+            for (int i = 0; i < ITEMS_PER_PRODUCER; ++i) {
+                int value = producer * ITEMS_PER_PRODUCER + i;
+                while (!buffer.push(std::move(value))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // each producer's items must come out in the order it pushed them
+    std::vector<int> lastSeen(NUM_PRODUCERS, -1);
+    int received = 0;
+    std::vector<int> batch;
+    while (received < NUM_PRODUCERS * ITEMS_PER_PRODUCER) {
+        batch.clear();
+        buffer.popBatch(batch, 64);
+        for (int value : batch) {
+            int producer = value / ITEMS_PER_PRODUCER;
+            int index = value % ITEMS_PER_PRODUCER;
+            QVERIFY(index > lastSeen[producer]);
+            lastSeen[producer] = index;
+        }
+        received += (int)batch.size();
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    QVERIFY(buffer.empty());
+}
@@ -0,0 +1,24 @@
+//
+//  MPSCRingBufferTests.h
+//  tests/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_MPSCRingBufferTests_h
+#define vircadia_MPSCRingBufferTests_h
+
+#include <QtTest/QtTest>
+
+class MPSCRingBufferTests : public QObject {
+    Q_OBJECT
+private slots:
+    void pushPopTest();
+    void fullTest();
+    void multipleProducersTest();
+};
+
+#endif // vircadia_MPSCRingBufferTests_h
@@ -0,0 +1,51 @@
+//
+//  MemoryAccountingTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "MemoryAccountingTests.h"
+
+#include <MemoryAccounting.h>
+
+QTEST_MAIN(MemoryAccountingTests)
+
+void MemoryAccountingTests::addRemoveTest() {
+    int64_t before = MemoryAccounting::getBytes(MemoryAccounting::Resources);
+
+    MemoryAccounting::add(MemoryAccounting::Resources, 1000);
+    MemoryAccounting::add(MemoryAccounting::Resources, 24);
+    QCOMPARE(MemoryAccounting::getBytes(MemoryAccounting::Resources), before + 1024);
+
+    MemoryAccounting::update(MemoryAccounting::Resources, 1024, 512);
+    QCOMPARE(MemoryAccounting::getBytes(MemoryAccounting::Resources), before + 512);
+
+    MemoryAccounting::remove(MemoryAccounting::Resources, 512);
+    QCOMPARE(MemoryAccounting::getBytes(MemoryAccounting::Resources), before);
+}
+
+void MemoryAccountingTests::sampleStatsTest() {
+    MemoryAccounting::sampleStats();
+
+    MemoryAccounting::add(MemoryAccounting::Entities, 64);
+    MemoryAccounting::add(MemoryAccounting::Entities, 64);
+    MemoryAccounting::remove(MemoryAccounting::Entities, 64);
+
+    QJsonObject stats = MemoryAccounting::sampleStats();
+    QVERIFY(stats.contains("packet_buffers"));
+    QVERIFY(stats.contains("gpu_sysmem"));
+    QJsonObject entities = stats["entities"].toObject();
+    QCOMPARE(entities["allocations"].toInt(), 2);
+    QCOMPARE(entities["releases"].toInt(), 1);
+
+    // the counts start again from each sample, the bytes don't
+    entities = MemoryAccounting::sampleStats()["entities"].toObject();
+    QCOMPARE(entities["allocations"].toInt(), 0);
+    QCOMPARE((int64_t)entities["bytes"].toDouble(), MemoryAccounting::getBytes(MemoryAccounting::Entities));
+
+    MemoryAccounting::remove(MemoryAccounting::Entities, 64);
+}
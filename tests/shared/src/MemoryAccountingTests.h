@@ -0,0 +1,23 @@
+//
+//  MemoryAccountingTests.h
+//  tests/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_MemoryAccountingTests_h
+#define vircadia_MemoryAccountingTests_h
+
+#include <QtTest/QtTest>
+
+class MemoryAccountingTests : public QObject {
+    Q_OBJECT
+private slots:
+    void addRemoveTest();
+    void sampleStatsTest();
+};
+
+#endif // vircadia_MemoryAccountingTests_h
@@ -0,0 +1,66 @@
+//
+//  MetricsRegistryTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "MetricsRegistryTests.h"
+
+#include <thread>
+#include <vector>
+
+#include <MetricsRegistry.h>
+
+QTEST_MAIN(MetricsRegistryTests)
+
+void MetricsRegistryTests::testCounterFromThreads() {
+    auto& counter = MetricsRegistry::getInstance().counter("test_counter_from_threads", "Test counter.");
+
+    const int NUM_THREADS = 8;
+    const int NUM_INCREMENTS = 10000;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back([&counter] {
+            for (int j = 0; j < NUM_INCREMENTS; ++j) {
+                counter.increment();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    QCOMPARE(counter.get(), (quint64)(NUM_THREADS * NUM_INCREMENTS));
+}
+
+void MetricsRegistryTests::testHistogramBuckets() {
+    auto& histogram = MetricsRegistry::getInstance().histogram("test_histogram_buckets", "Test histogram.", { 1.0, 10.0 });
+    histogram.observe(0.5);
+    histogram.observe(1.0);
+    histogram.observe(5.0);
+    histogram.observe(50.0);
+
+    QCOMPARE(histogram.getBucketCount(0), (quint64)2);
+    QCOMPARE(histogram.getBucketCount(1), (quint64)1);
+    QCOMPARE(histogram.getBucketCount(2), (quint64)1);
+    QCOMPARE(histogram.getSum(), 56.5);
+
+    QByteArray text = MetricsRegistry::getInstance().toPrometheusText();
+    QVERIFY(text.contains("# TYPE test_histogram_buckets histogram\n"));
+    QVERIFY(text.contains("test_histogram_buckets_bucket{le=\"10\"} 3\n"));
+    QVERIFY(text.contains("test_histogram_buckets_bucket{le=\"+Inf\"} 4\n"));
+    QVERIFY(text.contains("test_histogram_buckets_count 4\n"));
+}
+
+void MetricsRegistryTests::testSameMetricByName() {
+    auto& gauge = MetricsRegistry::getInstance().gauge("test_same_gauge", "Test gauge.");
+    gauge.set(2.0);
+    MetricsRegistry::getInstance().gauge("test_same_gauge", "Test gauge.").add(1.5);
+
+    QCOMPARE(gauge.get(), 3.5);
+    QVERIFY(MetricsRegistry::getInstance().toPrometheusText().contains("test_same_gauge 3.5\n"));
+}
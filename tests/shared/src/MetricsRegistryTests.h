@@ -0,0 +1,25 @@
+//
+//  MetricsRegistryTests.h
+//  tests/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_MetricsRegistryTests_h
+#define vircadia_MetricsRegistryTests_h
+
+#include <QtTest/QtTest>
+
+class MetricsRegistryTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testCounterFromThreads();
+    void testHistogramBuckets();
+    void testSameMetricByName();
+};
+
+#endif // vircadia_MetricsRegistryTests_h
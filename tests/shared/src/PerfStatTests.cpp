@@ -0,0 +1,51 @@
+//
+//  PerfStatTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PerfStatTests.h"
+
+#include <thread>
+#include <vector>
+
+#include <PerfStat.h>
+
+QTEST_MAIN(PerfStatTests)
+
+void PerfStatTests::testNestedTimersFromThreads() {
+    PerformanceTimer::setActive(true);
+
+    const int NUM_THREADS = 4;
+    const int NUM_CALLS = 1000;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back([] {
+            for (int j = 0; j < NUM_CALLS; ++j) {
+                PERFORMANCE_TIMER("outer");
+                PerformanceTimer inner("inner");
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // the threads have finished, their timers are gathered as they go
+    auto records = PerformanceTimer::getAllTimerRecords();
+    QVERIFY(records.contains("/outer"));
+    QVERIFY(records.contains("/outer/inner"));
+    QCOMPARE(PerformanceTimer::getContextName(), QString());
+
+    {
+        PerformanceTimer outer("outer");
+        QCOMPARE(PerformanceTimer::getContextName(), QString("/outer"));
+    }
+
+    PerformanceTimer::setActive(false);
+    QVERIFY(PerformanceTimer::getAllTimerRecords().isEmpty());
+}
@@ -0,0 +1,23 @@
+//
+//  PerfStatTests.h
+//  tests/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_PerfStatTests_h
+#define vircadia_PerfStatTests_h
+
+#include <QtTest/QtTest>
+
+class PerfStatTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testNestedTimersFromThreads();
+};
+
+#endif // vircadia_PerfStatTests_h
@@ -0,0 +1,104 @@
+//
+//  SpatiallyNestableTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SpatiallyNestableTests.h"
+
+#include <DependencyManager.h>
+#include <GLMHelpers.h>
+#include <NumericalConstants.h>
+#include <SpatiallyNestable.h>
+
+#include <test-utils/GLMTestUtils.h>
+#include <test-utils/QTestExtensions.h>
+
+QTEST_MAIN(SpatiallyNestableTests)
+
+namespace {
+
+const float EPSILON = 0.0001f;
+
+class TestNestable : public SpatiallyNestable {
+public:
+    TestNestable() : SpatiallyNestable(NestableType::Entity, QUuid::createUuid()) {}
+};
+
+class TestParentFinder : public SpatialParentFinder {
+public:
+    SpatiallyNestableWeakPointer find(QUuid parentID, bool& success, SpatialParentTree* entityTree = nullptr) const override {
+        auto it = nestables.find(parentID);
+        success = it != nestables.end() && !it.value().expired();
+        return success ? it.value() : SpatiallyNestableWeakPointer();
+    }
+
+    QHash<QUuid, SpatiallyNestableWeakPointer> nestables;
+};
+
+std::shared_ptr<TestNestable> makeNestable(const glm::vec3& localPosition) {
+    auto nestable = std::make_shared<TestNestable>();
+    nestable->setLocalPosition(localPosition);
+    auto finder = DependencyManager::get<SpatialParentFinder>().staticCast<TestParentFinder>();
+    finder->nestables[nestable->getID()] = nestable;
+    return nestable;
+}
+
+}
+
+void SpatiallyNestableTests::initTestCase() {
+    DependencyManager::set<SpatialParentFinder, TestParentFinder>();
+}
+
+void SpatiallyNestableTests::cleanupTestCase() {
+    DependencyManager::destroy<SpatialParentFinder>();
+}
+
+void SpatiallyNestableTests::testCachedWorldTransformFollowsAncestors() {
+    auto grandparent = makeNestable(glm::vec3(1.0f, 0.0f, 0.0f));
+    auto parent = makeNestable(glm::vec3(0.0f, 1.0f, 0.0f));
+    auto child = makeNestable(glm::vec3(0.0f, 0.0f, 1.0f));
+    parent->setParentID(grandparent->getID());
+    child->setParentID(parent->getID());
+
+    bool success = false;
+    QCOMPARE_WITH_ABS_ERROR(child->getWorldPosition(success), glm::vec3(1.0f, 1.0f, 1.0f), EPSILON);
+    QVERIFY(success);
+    QCOMPARE_WITH_ABS_ERROR(child->getWorldPosition(success), glm::vec3(1.0f, 1.0f, 1.0f), EPSILON);
+
+    // moving an ancestor moves the descendants it has cached transforms for
+    grandparent->setLocalPosition(glm::vec3(2.0f, 0.0f, 0.0f));
+    QCOMPARE_WITH_ABS_ERROR(child->getWorldPosition(success), glm::vec3(2.0f, 1.0f, 1.0f), EPSILON);
+
+    grandparent->setLocalOrientation(glm::angleAxis(PI / 2.0f, Vectors::UNIT_Z));
+    QCOMPARE_WITH_ABS_ERROR(child->getWorldPosition(success), glm::vec3(1.0f, 0.0f, 1.0f), EPSILON);
+    QCOMPARE_WITH_ABS_ERROR(parent->getWorldPosition(success), glm::vec3(1.0f, 0.0f, 0.0f), EPSILON);
+
+    child->setLocalPosition(glm::vec3(0.0f, 0.0f, 2.0f));
+    QCOMPARE_WITH_ABS_ERROR(child->getWorldPosition(success), glm::vec3(1.0f, 0.0f, 2.0f), EPSILON);
+}
+
+void SpatiallyNestableTests::testCachedWorldTransformFollowsParenting() {
+    auto parent = makeNestable(glm::vec3(1.0f, 0.0f, 0.0f));
+    auto child = makeNestable(glm::vec3(0.0f, 1.0f, 0.0f));
+    child->setParentID(parent->getID());
+
+    bool success = false;
+    QCOMPARE_WITH_ABS_ERROR(child->getWorldPosition(success), glm::vec3(1.0f, 1.0f, 0.0f), EPSILON);
+
+    child->setParentID(QUuid());
+    QCOMPARE_WITH_ABS_ERROR(child->getWorldPosition(success), glm::vec3(0.0f, 1.0f, 0.0f), EPSILON);
+    QVERIFY(success);
+
+    child->setParentID(parent->getID());
+    QCOMPARE_WITH_ABS_ERROR(child->getWorldPosition(success), glm::vec3(1.0f, 1.0f, 0.0f), EPSILON);
+
+    // a transform cached relative to a parent that's gone isn't used
+    parent.reset();
+    child->getWorldPosition(success);
+    QVERIFY(!success);
+}
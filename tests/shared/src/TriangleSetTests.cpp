@@ -0,0 +1,90 @@
+//
+//  TriangleSetTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "TriangleSetTests.h"
+
+#include <cfloat>
+
+#include <TriangleSet.h>
+
+QTEST_MAIN(TriangleSetTests)
+
+namespace {
+
+const int GRID_SIZE = 64;
+const float EPSILON = 0.0001f;
+
+// a bumpy grid of triangles facing up, enough of them for the tree to be several levels deep
+std::vector<Triangle> makeGrid() {
+    auto height = [](int x, int z) {
+        return 0.1f * sinf(0.5f * x) * cosf(0.3f * z);
+    };
+    std::vector<Triangle> triangles;
+    for (int x = 0; x < GRID_SIZE; x++) {
+        for (int z = 0; z < GRID_SIZE; z++) {
+            glm::vec3 p00((float)x, height(x, z), (float)z);
+            glm::vec3 p10((float)x + 1.0f, height(x + 1, z), (float)z);
+            glm::vec3 p01((float)x, height(x, z + 1), (float)z + 1.0f);
+            glm::vec3 p11((float)x + 1.0f, height(x + 1, z + 1), (float)z + 1.0f);
+            triangles.push_back({ p00, p01, p10 });
+            triangles.push_back({ p10, p01, p11 });
+        }
+    }
+    return triangles;
+}
+
+bool findBruteForce(const std::vector<Triangle>& triangles, const glm::vec3& origin, const glm::vec3& direction,
+                    bool allowBackface, float& distance) {
+    distance = FLT_MAX;
+    for (const auto& triangle : triangles) {
+        float triangleDistance;
+        if (findRayTriangleIntersection(origin, direction, triangle, triangleDistance, allowBackface) &&
+            triangleDistance < distance) {
+            distance = triangleDistance;
+        }
+    }
+    return distance < FLT_MAX;
+}
+
+void compareWithBruteForce(float startHeight, const glm::vec3& direction, bool allowBackface) {
+    auto triangles = makeGrid();
+    TriangleSet triangleSet;
+    for (const auto& triangle : triangles) {
+        triangleSet.insert(triangle);
+    }
+
+    for (int i = 0; i < 200; i++) {
+        glm::vec3 origin(0.37f + 0.31f * i, startHeight, 0.53f + 0.29f * (i * 7 % 200));
+        origin.x = fmodf(origin.x, (float)GRID_SIZE);
+        origin.z = fmodf(origin.z, (float)GRID_SIZE);
+        glm::vec3 tiltedDirection = glm::normalize(direction + glm::vec3(0.01f * (i % 5), 0.0f, -0.01f * (i % 3)));
+
+        float expectedDistance;
+        QVERIFY(findBruteForce(triangles, origin, tiltedDirection, allowBackface, expectedDistance));
+
+        float distance = 0.0f;
+        BoxFace face;
+        Triangle triangle;
+        QVERIFY(triangleSet.findRayIntersection(origin, tiltedDirection, 1.0f / tiltedDirection, distance, face, triangle,
+                                                true, allowBackface));
+        QVERIFY(fabsf(distance - expectedDistance) < EPSILON);
+    }
+}
+
+}
+
+void TriangleSetTests::testRayIntersectionMatchesBruteForce() {
+    compareWithBruteForce(10.0f, glm::vec3(0.0f, -1.0f, 0.0f), false);
+}
+
+void TriangleSetTests::testRayIntersectionWithBackfaces() {
+    // from below, only the backs of the triangles are hit, including the ones deep in the tree
+    compareWithBruteForce(-10.0f, glm::vec3(0.0f, 1.0f, 0.0f), true);
+}
@@ -0,0 +1,24 @@
+//
+//  TriangleSetTests.h
+//  tests/shared/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_TriangleSetTests_h
+#define vircadia_TriangleSetTests_h
+
+#include <QtTest/QtTest>
+
+class TriangleSetTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testRayIntersectionMatchesBruteForce();
+    void testRayIntersectionWithBackfaces();
+};
+
+#endif // vircadia_TriangleSetTests_h
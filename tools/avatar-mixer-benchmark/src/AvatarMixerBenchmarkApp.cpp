@@ -0,0 +1,309 @@
+//
+//  AvatarMixerBenchmarkApp.cpp
+//  tools/avatar-mixer-benchmark/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AvatarMixerBenchmarkApp.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QDebug>
+#include <QtCore/QSharedPointer>
+
+#include <glm/gtc/quaternion.hpp>
+
+#include <AccountManager.h>
+#include <AddressManager.h>
+#include <AvatarData.h>
+#include <DependencyManager.h>
+#include <EntityTree.h>
+#include <GLMHelpers.h>
+#include <NodeList.h>
+#include <NumericalConstants.h>
+#include <ReceivedMessage.h>
+#include <SharedUtil.h>
+#include <ViewFrustum.h>
+#include <recording/Clip.h>
+#include <recording/Frame.h>
+#include <shared/ConicalViewFrustum.h>
+
+#include <avatars/AvatarMixerClientData.h>
+#include <avatars/AvatarMixerSlavePool.h>
+
+static const int BROADCAST_FRAMES_PER_SECOND = 45;
+static const auto BROADCAST_FRAME_DURATION = std::chrono::microseconds(USECS_PER_SECOND / BROADCAST_FRAMES_PER_SECOND);
+
+static const int NUM_SYNTHETIC_JOINTS = 60;
+static const float WALK_RADIUS = 1.0f; // meters
+static const float WALK_PERIOD = 8.0f; // seconds per circle
+static const float JOINT_SWING = 0.3f; // radians
+
+// nothing listens here, the mixer's sends are measured but go nowhere
+static const quint16 DISCARD_PORT = 9;
+
+AvatarMixerBenchmarkApp::AvatarMixerBenchmarkApp(int argc, char* argv[]) : QCoreApplication(argc, argv) {
+
+    // parse command-line
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Vircadia Avatar Mixer Benchmark");
+    const QCommandLineOption helpOption = parser.addHelpOption();
+
+    const QCommandLineOption agentsOption("n", "comma separated numbers of agents to run", "counts", "10,30,100,300,1000");
+    parser.addOption(agentsOption);
+
+    const QCommandLineOption framesOption("f", "broadcast frames per run", "frames", "450");
+    parser.addOption(framesOption);
+
+    const QCommandLineOption threadsOption("t", "mixer threads, 0 picks the ideal thread count", "threads", "0");
+    parser.addOption(threadsOption);
+
+    const QCommandLineOption clipOption("c", "recording to replay instead of the synthetic motion", "filename.hfr");
+    parser.addOption(clipOption);
+
+    const QCommandLineOption spacingOption("s", "average distance between agents, in meters", "meters", "2");
+    parser.addOption(spacingOption);
+
+    const QCommandLineOption gridOption("g", "candidate grid cell size, in meters, 0 is off", "meters", "0");
+    parser.addOption(gridOption);
+
+    const QCommandLineOption bandwidthOption("b", "max kbps sent to each agent", "kbps", "5000");
+    parser.addOption(bandwidthOption);
+
+    const QCommandLineOption unpacedOption("u", "run frames back to back instead of at the mixer's frame rate");
+    parser.addOption(unpacedOption);
+
+    if (!parser.parse(QCoreApplication::arguments())) {
+        qCritical() << parser.errorText() << Qt::endl;
+        parser.showHelp();
+        _returnCode = 1;
+        return;
+    }
+
+    if (parser.isSet(helpOption)) {
+        parser.showHelp();
+        return;
+    }
+
+    std::vector<int> agentCounts;
+    for (const auto& count : parser.value(agentsOption).split(',', Qt::SkipEmptyParts)) {
+        bool ok = false;
+        int numAgents = count.toInt(&ok);
+        if (!ok || numAgents <= 0) {
+            qCritical() << "Invalid number of agents" << count;
+            _returnCode = 1;
+            return;
+        }
+        agentCounts.push_back(numAgents);
+    }
+
+    _numFrames = std::max(parser.value(framesOption).toInt(), 1);
+    _numThreads = parser.value(threadsOption).toInt();
+    _spacing = std::max(parser.value(spacingOption).toFloat(), 0.1f);
+    _maxKbpsPerNode = parser.value(bandwidthOption).toFloat();
+    _paced = !parser.isSet(unpacedOption);
+    _sharedData.grid.setCellSize(parser.value(gridOption).toFloat());
+
+    if (parser.isSet(clipOption)) {
+        QString clipFilename = parser.value(clipOption);
+        auto clip = recording::Clip::fromFile(clipFilename);
+        if (!clip) {
+            qCritical() << "Failed to open recording" << clipFilename;
+            _returnCode = 2;
+            return;
+        }
+
+        auto avatarFrameType = recording::Frame::registerFrameType(AvatarData::FRAME_NAME);
+        clip->seek(0);
+        for (auto frame = clip->nextFrame(); frame; frame = clip->nextFrame()) {
+            if (frame->type == avatarFrameType) {
+                _clipFrames.push_back(frame->data);
+            }
+        }
+
+        if (_clipFrames.empty()) {
+            qCritical() << "No avatar frames in" << clipFilename;
+            _returnCode = 2;
+            return;
+        }
+    }
+
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+
+    DependencyManager::set<AccountManager>(false, [&]{ return QString("Mozilla/5.0 (VircadiaAvatarMixerBenchmark)"); });
+    DependencyManager::set<AddressManager>();
+    DependencyManager::set<NodeList>(NodeType::AvatarMixer);
+
+    auto nodeList = DependencyManager::get<NodeList>();
+    nodeList->setSessionUUID(QUuid::createUuid());
+    nodeList->setSessionLocalID(1);
+
+    // no zones, but parsing the avatar data looks for them
+    auto entityTree = std::make_shared<EntityTree>();
+    entityTree->createRootElement();
+    _sharedData.entityTree = entityTree;
+
+    qInfo().noquote() << "agents     frame ms (avg / max)   prioritize ms   toByteArray ms   identity+traits+data KB   avatars sent";
+    for (int numAgents : agentCounts) {
+        runBenchmark(numAgents);
+    }
+
+    DependencyManager::destroy<NodeList>();
+}
+
+AvatarMixerBenchmarkApp::~AvatarMixerBenchmarkApp() {
+}
+
+void AvatarMixerBenchmarkApp::moveAgent(Agent& agent, int frame) {
+    AvatarData& avatar = *agent.avatar;
+
+    if (!_clipFrames.empty()) {
+        const QByteArray& clipFrame = _clipFrames[(agent.frameOffset + frame) % _clipFrames.size()];
+        AvatarData::fromFrame(clipFrame, avatar, false);
+        avatar.setWorldPosition(avatar.getWorldPosition() + agent.home);
+        return;
+    }
+
+    float time = (float)frame / (float)BROADCAST_FRAMES_PER_SECOND;
+    float angle = agent.phase + TWO_PI * time / WALK_PERIOD;
+
+    glm::vec3 offset(WALK_RADIUS * std::cos(angle), 0.0f, WALK_RADIUS * std::sin(angle));
+    avatar.setWorldPosition(agent.home + offset);
+    avatar.setWorldOrientation(glm::angleAxis(-angle, Vectors::UNIT_Y));
+
+    // every joint swings a little out of phase with the others, like a walk cycle
+    for (int i = 0; i < NUM_SYNTHETIC_JOINTS; i++) {
+        float swing = JOINT_SWING * std::sin(TWO_PI * time + agent.phase + (float)i);
+        avatar.setJointData(i, glm::angleAxis(swing, Vectors::UNIT_X), glm::vec3(0.0f, 0.1f, 0.0f));
+    }
+}
+
+void AvatarMixerBenchmarkApp::runBenchmark(int numAgents) {
+    auto nodeList = DependencyManager::get<NodeList>();
+
+    AvatarMixerSlavePool slavePool(&_sharedData);
+    if (_numThreads > 0) {
+        slavePool.setNumThreads(_numThreads);
+    }
+
+    SockAddr discardAddress(SocketType::UDP, QHostAddress::LocalHost, DISCARD_PORT);
+    int side = (int)std::ceil(std::sqrt((float)numAgents));
+
+    std::vector<Agent> agents(numAgents);
+    std::vector<SharedNodePointer> nodes(numAgents);
+    for (int i = 0; i < numAgents; i++) {
+        QUuid nodeID = QUuid::createUuid();
+        Node::LocalID localID = (Node::LocalID)(i + 2);
+
+        auto node = nodeList->addOrUpdateNode(nodeID, NodeType::Agent, discardAddress, discardAddress, localID);
+        node->activatePublicSocket();
+        node->setLinkedData(std::unique_ptr<NodeData> { new AvatarMixerClientData(nodeID, localID) });
+        nodes[i] = node;
+
+        Agent& agent = agents[i];
+        agent.avatar.reset(new AvatarData());
+        agent.avatar->setSessionUUID(nodeID);
+        agent.home = glm::vec3(_spacing * (float)(i % side), 0.0f, _spacing * (float)(i / side));
+        agent.phase = TWO_PI * (float)i / (float)numAgents;
+        agent.frameOffset = _clipFrames.empty() ? 0 : (int)((i * 7919) % _clipFrames.size());
+    }
+
+    auto frameTimestamp = p_high_resolution_clock::now();
+
+    std::vector<quint64> frameTimes;
+    frameTimes.reserve(_numFrames);
+    AvatarMixerSlaveStats totalStats;
+
+    for (int frame = 0; frame < _numFrames; frame++) {
+        // what each agent would have sent since the last frame
+        for (int i = 0; i < numAgents; i++) {
+            Agent& agent = agents[i];
+            moveAgent(agent, frame);
+
+            bool sendAll = randFloat() < AVATAR_SEND_FULL_UPDATE_RATIO;
+            QByteArray avatarByteArray = agent.avatar->toByteArrayStateful(sendAll ? AvatarData::SendAllData
+                                                                                  : AvatarData::CullSmallData);
+            agent.avatar->doneEncoding(!sendAll);
+
+            QByteArray payload;
+            payload.append(reinterpret_cast<const char*>(&agent.sequenceNumber), sizeof(agent.sequenceNumber));
+            payload.append(avatarByteArray);
+            ++agent.sequenceNumber;
+
+            auto message = QSharedPointer<ReceivedMessage>::create(payload, PacketType::AvatarData,
+                                                                   versionForPacketType(PacketType::AvatarData),
+                                                                   discardAddress, nodes[i]->getLocalID());
+
+            auto clientData = static_cast<AvatarMixerClientData*>(nodes[i]->getLinkedData());
+            clientData->queuePacket(message, nodes[i]);
+
+            // the agent looks where it is heading
+            ViewFrustum viewFrustum;
+            viewFrustum.setProjection(DEFAULT_FIELD_OF_VIEW_DEGREES, DEFAULT_ASPECT_RATIO, DEFAULT_NEAR_CLIP, DEFAULT_FAR_CLIP);
+            viewFrustum.setPosition(agent.avatar->getWorldPosition());
+            viewFrustum.setOrientation(agent.avatar->getWorldOrientation());
+            viewFrustum.calculate();
+
+            unsigned char frustumBuffer[sizeof(uint8_t) + sizeof(ConicalViewFrustum)];
+            uint8_t numFrustums = 1;
+            memcpy(frustumBuffer, &numFrustums, sizeof(numFrustums));
+            int frustumSize = sizeof(numFrustums) + ConicalViewFrustum(viewFrustum).serialize(frustumBuffer + sizeof(numFrustums));
+            clientData->readViewFrustumPacket(QByteArray::fromRawData(reinterpret_cast<const char*>(frustumBuffer), frustumSize));
+        }
+
+        if (_paced) {
+            std::this_thread::sleep_until(frameTimestamp + BROADCAST_FRAME_DURATION);
+        }
+        auto lastFrameTimestamp = frameTimestamp;
+        frameTimestamp = p_high_resolution_clock::now();
+
+        // the same jobs, in the same order, as a frame of AvatarMixer::start
+        nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
+            slavePool.processIncomingPackets(cbegin, cend);
+        });
+
+        nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
+            auto start = usecTimestampNow();
+            _sharedData.grid.rebuild(cbegin, cend);
+            ++_sharedData.broadcastFrame;
+            slavePool.broadcastAvatarData(cbegin, cend, lastFrameTimestamp, _maxKbpsPerNode, 0.0f);
+            frameTimes.push_back(usecTimestampNow() - start);
+        });
+
+        slavePool.each([&](AvatarMixerSlave& slave) {
+            AvatarMixerSlaveStats stats;
+            slave.harvestStats(stats);
+            totalStats += stats;
+        });
+    }
+
+    quint64 totalFrameTime = 0;
+    quint64 maxFrameTime = 0;
+    for (auto frameTime : frameTimes) {
+        totalFrameTime += frameTime;
+        maxFrameTime = std::max(maxFrameTime, frameTime);
+    }
+
+    float numFrames = (float)_numFrames;
+    float bytesSent = (float)(totalStats.numIdentityBytesSent + totalStats.numTraitsBytesSent + totalStats.numDataBytesSent);
+    qInfo().noquote() << QString("%1   %2 / %3   %4   %5   %6   %7")
+        .arg(numAgents, 6)
+        .arg((float)totalFrameTime / numFrames / USECS_PER_MSEC, 9, 'f', 3)
+        .arg((float)maxFrameTime / USECS_PER_MSEC, 8, 'f', 3)
+        .arg((float)totalStats.prioritizationElapsedTime / numFrames / USECS_PER_MSEC, 13, 'f', 3)
+        .arg((float)totalStats.toByteArrayElapsedTime / numFrames / USECS_PER_MSEC, 14, 'f', 3)
+        .arg(bytesSent / numFrames / BYTES_PER_KILOBYTE, 23, 'f', 1)
+        .arg((float)totalStats.numOthersIncluded / numFrames, 14, 'f', 0);
+
+    for (auto& node : nodes) {
+        nodeList->killNodeWithUUID(node->getUUID());
+    }
+}
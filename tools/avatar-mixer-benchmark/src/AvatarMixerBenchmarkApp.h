@@ -0,0 +1,63 @@
+//
+//  AvatarMixerBenchmarkApp.h
+//  tools/avatar-mixer-benchmark/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_AvatarMixerBenchmarkApp_h
+#define vircadia_AvatarMixerBenchmarkApp_h
+
+#include <memory>
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QCoreApplication>
+
+#include <glm/glm.hpp>
+
+#include <avatars/AvatarMixerSlave.h>
+
+class AvatarData;
+
+// Runs the avatar mixer's receive and broadcast jobs against synthetic agents, in-process and without a domain.
+//
+// Every agent sends an avatar data packet and a view frustum each frame, moving along a small circle or replaying a
+// recording, and the broadcast is timed as the number of agents grows. The packets the mixer sends go to a port
+// nobody listens on.
+class AvatarMixerBenchmarkApp : public QCoreApplication {
+    Q_OBJECT
+public:
+    AvatarMixerBenchmarkApp(int argc, char* argv[]);
+    ~AvatarMixerBenchmarkApp();
+
+    int getReturnCode() const { return _returnCode; }
+
+private:
+    struct Agent {
+        std::unique_ptr<AvatarData> avatar;
+        glm::vec3 home;
+        float phase { 0.0f };
+        int frameOffset { 0 };
+        uint16_t sequenceNumber { 0 };
+    };
+
+    void runBenchmark(int numAgents);
+    void moveAgent(Agent& agent, int frame);
+
+    SlaveSharedData _sharedData;
+    std::vector<QByteArray> _clipFrames;
+
+    int _numFrames { 0 };
+    int _numThreads { 0 };
+    float _spacing { 0.0f };
+    float _maxKbpsPerNode { 0.0f };
+    bool _paced { true };
+
+    int _returnCode { 0 };
+};
+
+#endif // vircadia_AvatarMixerBenchmarkApp_h
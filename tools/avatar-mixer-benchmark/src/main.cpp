@@ -0,0 +1,20 @@
+//
+//  main.cpp
+//  tools/avatar-mixer-benchmark/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include <SharedUtil.h>
+
+#include "AvatarMixerBenchmarkApp.h"
+
+int main(int argc, char* argv[]) {
+    setupHifiApplication("Avatar Mixer Benchmark");
+
+    AvatarMixerBenchmarkApp app(argc, argv);
+    return app.getReturnCode();
+}
@@ -0,0 +1,226 @@
+//
+//  FrameBenchmark.cpp
+//  tools/gpu-frame-player/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "FrameBenchmark.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+
+#include <gpu/FrameIO.h>
+#include <gpu/Query.h>
+#include <NumericalConstants.h>
+
+static const QSize BENCHMARK_WINDOW_SIZE { 800, 600 };
+
+template <typename T>
+static T percentile(const std::vector<T>& sorted, float fraction) {
+    if (sorted.empty()) {
+        return T();
+    }
+    size_t index = std::min(sorted.size() - 1, (size_t)(fraction * (float)sorted.size()));
+    return sorted[index];
+}
+
+template <typename T>
+static double average(const std::vector<T>& values) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    return (double)std::accumulate(values.begin(), values.end(), T()) / (double)values.size();
+}
+
+FrameBenchmark::FrameBenchmark() {
+#ifdef USE_GL
+    setSurfaceType(QSurface::OpenGLSurface);
+#else
+    setSurfaceType(QSurface::VulkanSurface);
+#endif
+    setGeometry(QRect(QPoint(), BENCHMARK_WINDOW_SIZE));
+    create();
+    // rendered from this thread, so that replays can't overlap and each one can be timed alone
+    _renderThread.initialize(this, false);
+}
+
+FrameBenchmark::~FrameBenchmark() {
+#ifdef USE_GL
+    _renderThread._context.makeCurrent();
+#endif
+    _renderThread.shutdown();
+}
+
+int FrameBenchmark::run(const QString& directory, int iterations, int warmup, const QString& outputPath) {
+    QDir dir(directory);
+    auto files = dir.entryInfoList({ "*.hfb" }, QDir::Files, QDir::Name);
+    if (files.empty()) {
+        qWarning() << "No .hfb frames found in" << directory;
+        return 1;
+    }
+
+    qInfo().noquote() << QString("Replaying %1 frames %2 times each, after %3 warm up replays")
+        .arg(files.size()).arg(iterations).arg(warmup);
+    qInfo().noquote() << "frame                             CPU ms (avg / p50 / p95 / max)   draws  API draws  triangles  "
+                         "pipelines  textures  buffers  formats";
+
+    QJsonArray frames;
+    int replayed = 0;
+    for (const auto& file : files) {
+        Result result;
+        result.name = file.fileName();
+        if (!replay(file.absoluteFilePath(), iterations, warmup, result)) {
+            qWarning() << "Unable to replay" << file.absoluteFilePath();
+            continue;
+        }
+        ++replayed;
+        print(result);
+        frames.append(toJson(result));
+    }
+
+    if (!outputPath.isEmpty()) {
+        QJsonObject results;
+        results["directory"] = dir.absolutePath();
+        results["iterations"] = iterations;
+        results["warmup"] = warmup;
+        results["frames"] = frames;
+
+        QFile file(outputPath);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            qWarning() << "Unable to write results to" << outputPath;
+            return 1;
+        }
+        file.write(QJsonDocument(results).toJson());
+    }
+
+    return replayed > 0 ? 0 : 1;
+}
+
+bool FrameBenchmark::replay(const QString& path, int iterations, int warmup, Result& result) {
+    auto frame = gpu::readFrame(path.toStdString(), _renderThread._externalTexture);
+    if (!frame || !frame->framebuffer || frame->batches.empty()) {
+        return false;
+    }
+
+    // The captured queries are only read back by the getQuery commands of the frames that followed them, so read
+    // every query the frame begins again after each replay
+    std::vector<gpu::QueryPointer> queries;
+    for (const auto& batch : frame->batches) {
+        batch->forEachCommand([&](gpu::Batch::Command command, const gpu::Batch::Param* params) {
+            if (command == gpu::Batch::COMMAND_beginQuery) {
+                const auto& query = batch->_queries.get(params[0]._uint);
+                if (std::find(queries.begin(), queries.end(), query) == queries.end()) {
+                    queries.push_back(query);
+                }
+            }
+        });
+    }
+    gpu::Batch readback("FrameBenchmark::readback");
+    for (const auto& query : queries) {
+        readback.getQuery(query);
+    }
+
+    _renderThread.submitFrame(frame);
+    result.cpuUsecs.reserve(iterations);
+    for (int i = 0; i < warmup + iterations; ++i) {
+        _renderThread.process();
+
+#ifdef USE_GL
+        _renderThread._context.makeCurrent();
+        // wait for the GPU, so that the results of this replay's queries are available
+        glFinish();
+        _renderThread._gpuContext->executeBatch(readback);
+        _renderThread._context.doneCurrent();
+#endif
+
+        if (i < warmup) {
+            continue;
+        }
+        result.cpuUsecs.push_back(_renderThread._lastExecuteUsecs);
+        for (const auto& query : queries) {
+            result.jobGPUMsecs[query->getName()].push_back(query->getGPUElapsedTime());
+        }
+    }
+    // the counts are the same on every replay of one frame
+    _renderThread._gpuContext->getFrameStats(result.stats);
+
+    // release this frame's resources before loading the next one
+    _renderThread._activeFrame.reset();
+#ifdef USE_GL
+    _renderThread._context.makeCurrent();
+    _renderThread._gpuContext->recycle();
+    _renderThread._context.doneCurrent();
+#endif
+
+    std::sort(result.cpuUsecs.begin(), result.cpuUsecs.end());
+    return true;
+}
+
+void FrameBenchmark::print(const Result& result) const {
+    const auto& cpuUsecs = result.cpuUsecs;
+    const auto& stats = result.stats;
+    qInfo().noquote() << QString("%1   %2 / %3 / %4 / %5   %6  %7  %8  %9  %10  %11  %12")
+        .arg(result.name, -32)
+        .arg(average(cpuUsecs) / USECS_PER_MSEC, 6, 'f', 2)
+        .arg((float)percentile(cpuUsecs, 0.5f) / USECS_PER_MSEC, 6, 'f', 2)
+        .arg((float)percentile(cpuUsecs, 0.95f) / USECS_PER_MSEC, 6, 'f', 2)
+        .arg((float)percentile(cpuUsecs, 1.0f) / USECS_PER_MSEC, 6, 'f', 2)
+        .arg(stats._DSNumDrawcalls, 6)
+        .arg(stats._DSNumAPIDrawcalls, 9)
+        .arg(stats._DSNumTriangles, 9)
+        .arg(stats._PSNumSetPipelines, 9)
+        .arg(stats._RSNumTextureBounded, 8)
+        .arg(stats._ISNumInputBufferChanges + stats._ISNumIndexBufferChanges + stats._RSNumResourceBufferBounded, 7)
+        .arg(stats._ISNumFormatChanges, 7);
+
+    for (const auto& job : result.jobGPUMsecs) {
+        qInfo().noquote() << QString("    %1 GPU ms %2").arg(QString::fromStdString(job.first), -36)
+            .arg(average(job.second), 6, 'f', 3);
+    }
+}
+
+QJsonObject FrameBenchmark::toJson(const Result& result) const {
+    const auto& cpuUsecs = result.cpuUsecs;
+    const auto& stats = result.stats;
+
+    QJsonObject cpu;
+    cpu["average"] = average(cpuUsecs) / USECS_PER_MSEC;
+    cpu["p50"] = (double)percentile(cpuUsecs, 0.5f) / USECS_PER_MSEC;
+    cpu["p95"] = (double)percentile(cpuUsecs, 0.95f) / USECS_PER_MSEC;
+    cpu["min"] = (double)percentile(cpuUsecs, 0.0f) / USECS_PER_MSEC;
+    cpu["max"] = (double)percentile(cpuUsecs, 1.0f) / USECS_PER_MSEC;
+
+    QJsonObject jobs;
+    for (const auto& job : result.jobGPUMsecs) {
+        jobs[QString::fromStdString(job.first)] = average(job.second);
+    }
+
+    QJsonObject driver;
+    driver["drawcalls"] = (qint64)stats._DSNumDrawcalls;
+    driver["apiDrawcalls"] = (qint64)stats._DSNumAPIDrawcalls;
+    driver["triangles"] = (qint64)stats._DSNumTriangles;
+    driver["pipelines"] = (qint64)stats._PSNumSetPipelines;
+    driver["textures"] = (qint64)stats._RSNumTextureBounded;
+    driver["textureMemory"] = (qint64)stats._RSAmountTextureMemoryBounded;
+    driver["resourceBuffers"] = (qint64)stats._RSNumResourceBufferBounded;
+    driver["inputBuffers"] = (qint64)stats._ISNumInputBufferChanges;
+    driver["indexBuffers"] = (qint64)stats._ISNumIndexBufferChanges;
+    driver["formats"] = (qint64)stats._ISNumFormatChanges;
+
+    QJsonObject frame;
+    frame["name"] = result.name;
+    frame["cpuRenderMsecs"] = cpu;
+    frame["gpuJobMsecs"] = jobs;
+    frame["driver"] = driver;
+    return frame;
+}
@@ -0,0 +1,48 @@
+//
+//  FrameBenchmark.h
+//  tools/gpu-frame-player/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <QtCore/QJsonObject>
+#include <QtGui/QWindow>
+
+#include "RenderThread.h"
+
+// Replays a directory of captured frames (.hfb) without user interaction and reports how long they take to render.
+//
+// Each frame is rendered a number of times on this thread, in a window that is never shown. For every frame it
+// measures the CPU time spent in the backend rendering its batches, the GPU time of each render job from the
+// queries captured with it, and the draw calls and state changes the backend issued to the driver.
+class FrameBenchmark : public QWindow {
+public:
+    FrameBenchmark();
+    ~FrameBenchmark();
+
+    // returns the process exit code: non zero if no frame could be replayed or the results could not be written
+    int run(const QString& directory, int iterations, int warmup, const QString& outputPath);
+
+private:
+    struct Result {
+        QString name;
+        std::vector<uint64_t> cpuUsecs;
+        std::map<std::string, std::vector<double>> jobGPUMsecs;
+        gpu::ContextStats stats;
+    };
+
+    bool replay(const QString& path, int iterations, int warmup, Result& result);
+    void print(const Result& result) const;
+    QJsonObject toJson(const Result& result) const;
+
+    RenderThread _renderThread;
+};
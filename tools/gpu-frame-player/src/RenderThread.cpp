@@ -9,6 +9,7 @@
 #include "RenderThread.h"
 #include <QtGui/QWindow>
 #include <gl/QOpenGLContextWrapper.h>
+#include <SharedUtil.h>
 
 void RenderThread::submitFrame(const gpu::FramePointer& frame) {
     std::unique_lock<std::mutex> lock(_frameLock);
@@ -25,10 +26,12 @@ void RenderThread::move(const glm::vec3& v) {
     _correction = glm::inverse(glm::translate(mat4(), v)) * _correction;
 }
 
-void RenderThread::initialize(QWindow* window) {
+void RenderThread::initialize(QWindow* window, bool isThreaded) {
     std::unique_lock<std::mutex> lock(_frameLock);
     setObjectName("RenderThread");
-    Parent::initialize();
+    if (isThreaded) {
+        Parent::initialize();
+    }
 
     _window = window;
 #ifdef USE_GL
@@ -50,7 +53,9 @@ void RenderThread::initialize(QWindow* window) {
     _gpuContext = std::make_shared<gpu::Context>();
     _backend = _gpuContext->getBackend();
     _context.doneCurrent();
-    _context.moveToThread(_thread);
+    if (isThreaded) {
+        _context.moveToThread(_thread);
+    }
     
     if (!_presentPipeline) {
         gpu::ShaderPointer program = gpu::Shader::createProgram(shader::gpu::program::DrawTexture);
@@ -84,6 +89,12 @@ void RenderThread::initialize(QWindow* window) {
     _gpuContext = std::make_shared<gpu::Context>();
     _backend = _gpuContext->getBackend();
 #endif
+
+    if (!isThreaded) {
+        // setup() takes the frame lock, and runs right away without a thread
+        lock.unlock();
+        Parent::initialize(false);
+    }
 }
 
 void RenderThread::setup() {
@@ -171,7 +182,9 @@ void RenderThread::renderFrame(gpu::FramePointer& frame) {
 
     //_gpuContext->enableStereo(true);
     if (frame && !frame->batches.empty()) {
+        auto executeStart = usecTimestampNow();
         _gpuContext->executeFrame(frame);
+        _lastExecuteUsecs = usecTimestampNow() - executeStart;
     }
 
 #ifdef USE_GL
@@ -48,6 +48,7 @@ public:
     gpu::ContextPointer _gpuContext;  // initialized during window creation
     std::shared_ptr<gpu::Backend> _backend;
     std::atomic<size_t> _presentCount{ 0 };
+    uint64_t _lastExecuteUsecs{ 0 }; // CPU time the backend took to render the last frame's batches
     QElapsedTimer _elapsed;
     size_t _frameIndex{ 0 };
     std::mutex _frameLock;
@@ -65,6 +66,7 @@ public:
     void shutdown() override;
 
     void submitFrame(const gpu::FramePointer& frame);
-    void initialize(QWindow* window);
+    // without a thread, the caller renders by calling process() itself
+    void initialize(QWindow* window, bool isThreaded = true);
     void renderFrame(gpu::FramePointer& frame);
 };
@@ -7,9 +7,11 @@
 //
 
 #include <QtWidgets/QApplication>
+#include <QtCore/QCommandLineParser>
 #include <QtCore/QSharedPointer>
 
 #include <shared/FileLogger.h>
+#include "FrameBenchmark.h"
 #include "PlayerWindow.h"
 
 Q_DECLARE_LOGGING_CATEGORY(gpu_player_logging)
@@ -29,6 +31,27 @@ int main(int argc, char** argv) {
     QApplication app(argc, argv);
     logger.reset(new FileLogger());
     setup();
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Plays back captured GPU frames");
+    parser.addHelpOption();
+    const QCommandLineOption benchmarkOption("benchmark", "Replay every frame in <dir> without showing them and report their render times", "dir");
+    const QCommandLineOption iterationsOption("iterations", "Number of timed replays of each frame", "count", "100");
+    const QCommandLineOption warmupOption("warmup", "Number of replays of each frame before timing it", "count", "5");
+    const QCommandLineOption outputOption({ "o", "output" }, "Write the benchmark results as JSON to <file>", "file");
+    parser.addOption(benchmarkOption);
+    parser.addOption(iterationsOption);
+    parser.addOption(warmupOption);
+    parser.addOption(outputOption);
+    parser.process(app);
+
+    if (parser.isSet(benchmarkOption)) {
+        int iterations = std::max(1, parser.value(iterationsOption).toInt());
+        int warmup = std::max(0, parser.value(warmupOption).toInt());
+        FrameBenchmark benchmark;
+        return benchmark.run(parser.value(benchmarkOption), iterations, warmup, parser.value(outputOption));
+    }
+
     PlayerWindow window;
     app.exec();
     return 0;
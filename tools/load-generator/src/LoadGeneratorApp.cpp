@@ -0,0 +1,425 @@
+//
+//  LoadGeneratorApp.cpp
+//  tools/load-generator/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "LoadGeneratorApp.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QDebug>
+#include <QtCore/QLoggingCategory>
+#include <QtCore/QProcess>
+
+#include <glm/gtc/quaternion.hpp>
+
+#include <AbstractAudioInterface.h>
+#include <AccountManager.h>
+#include <AddressManager.h>
+#include <AudioConstants.h>
+#include <AvatarData.h>
+#include <DependencyManager.h>
+#include <GLMHelpers.h>
+#include <NetworkLogging.h>
+#include <NumericalConstants.h>
+#include <SharedLogging.h>
+#include <SharedUtil.h>
+#include <ViewFrustum.h>
+#include <plugins/PluginManager.h>
+#include <shared/ConicalViewFrustum.h>
+
+static const int AVATAR_SENDS_PER_SECOND = 45;
+static const int ENTITY_QUERY_INTERVAL_MSECS = 1000;
+
+static const int NUM_SYNTHETIC_JOINTS = 60;
+static const float WALK_RADIUS = 1.0f; // meters
+static const float WALK_PERIOD = 8.0f; // seconds per circle
+static const float JOINT_SWING = 0.3f; // radians
+static const float TONE_AMPLITUDE = 0.1f * (float)INT16_MAX;
+
+// clients started at once, and how long to wait before starting the next ones, so the domain server sees them arrive
+static const int CLIENTS_PER_LAUNCH = 10;
+static const int LAUNCH_INTERVAL_MSECS = 200;
+
+LoadGeneratorApp::LoadGeneratorApp(int argc, char* argv[]) : QCoreApplication(argc, argv) {
+
+    // parse command-line
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Vircadia Load Generator");
+    const QCommandLineOption helpOption = parser.addHelpOption();
+
+    const QCommandLineOption domainAddressOption("d", "domain-server address", "address", "127.0.0.1:40103");
+    parser.addOption(domainAddressOption);
+
+    const QCommandLineOption clientsOption("n", "number of clients, each one a process", "count", "1");
+    parser.addOption(clientsOption);
+
+    const QCommandLineOption durationOption("t", "seconds to run, 0 runs until killed", "seconds", "60");
+    parser.addOption(durationOption);
+
+    const QCommandLineOption reportOption("r", "seconds between reports", "seconds", "5");
+    parser.addOption(reportOption);
+
+    const QCommandLineOption spreadOption("s", "size of the square the clients stand in, in meters", "meters", "20");
+    parser.addOption(spreadOption);
+
+    const QCommandLineOption noAudioOption("no-audio", "don't send microphone audio");
+    parser.addOption(noAudioOption);
+
+    const QCommandLineOption noAvatarOption("no-avatar", "don't send avatar data");
+    parser.addOption(noAvatarOption);
+
+    const QCommandLineOption noEntitiesOption("no-entities", "don't send entity queries");
+    parser.addOption(noEntitiesOption);
+
+    const QCommandLineOption verboseOption("v", "verbose output");
+    parser.addOption(verboseOption);
+
+    // set on the processes this one launches
+    QCommandLineOption clientIndexOption("client", "index of this client", "index");
+    clientIndexOption.setFlags(QCommandLineOption::HiddenFromHelp);
+    parser.addOption(clientIndexOption);
+
+    if (!parser.parse(QCoreApplication::arguments())) {
+        qCritical() << parser.errorText() << Qt::endl;
+        parser.showHelp();
+        _isDone = true;
+        _returnCode = 1;
+        return;
+    }
+
+    if (parser.isSet(helpOption)) {
+        parser.showHelp();
+        _isDone = true;
+        return;
+    }
+
+    int numClients = std::max(parser.value(clientsOption).toInt(), 1);
+    if (numClients > 1 && !parser.isSet(clientIndexOption)) {
+        QStringList arguments { "-d", parser.value(domainAddressOption), "-t", parser.value(durationOption),
+                                "-r", parser.value(reportOption), "-s", parser.value(spreadOption) };
+        for (const auto& option : { noAudioOption, noAvatarOption, noEntitiesOption, verboseOption }) {
+            if (parser.isSet(option)) {
+                arguments << "--" + option.names().first();
+            }
+        }
+        launchClients(numClients, arguments);
+        return;
+    }
+
+    if (!parser.isSet(verboseOption)) {
+        QLoggingCategory::setFilterRules("qt.network.ssl.warning=false");
+        const_cast<QLoggingCategory*>(&networking())->setEnabled(QtDebugMsg, false);
+        const_cast<QLoggingCategory*>(&networking())->setEnabled(QtInfoMsg, false);
+        const_cast<QLoggingCategory*>(&shared())->setEnabled(QtDebugMsg, false);
+        const_cast<QLoggingCategory*>(&shared())->setEnabled(QtInfoMsg, false);
+    }
+
+    _clientIndex = parser.value(clientIndexOption).toInt();
+    _spread = std::max(parser.value(spreadOption).toFloat(), 0.0f);
+    _sendsAudio = !parser.isSet(noAudioOption);
+    _sendsAvatar = !parser.isSet(noAvatarOption);
+    _sendsEntityQueries = !parser.isSet(noEntitiesOption);
+
+    int reportIntervalSecs = std::max(parser.value(reportOption).toInt(), 1);
+    connect(&_reportTimer, &QTimer::timeout, this, &LoadGeneratorApp::report);
+    _reportTimer.start((int)(reportIntervalSecs * MSECS_PER_SECOND));
+
+    int durationSecs = parser.value(durationOption).toInt();
+    if (durationSecs > 0) {
+        QTimer::singleShot((int)(durationSecs * MSECS_PER_SECOND), this, [this] { finish(0); });
+    }
+
+    startClient(parser.value(domainAddressOption));
+}
+
+LoadGeneratorApp::~LoadGeneratorApp() {
+}
+
+void LoadGeneratorApp::launchClients(int numClients, const QStringList& arguments) {
+    qInfo() << "Launching" << numClients << "clients";
+
+    auto nextClient = std::make_shared<int>(0);
+    QTimer* launchTimer = new QTimer(this);
+    connect(launchTimer, &QTimer::timeout, this, [this, numClients, arguments, nextClient, launchTimer] {
+        for (int i = 0; i < CLIENTS_PER_LAUNCH && *nextClient < numClients; i++) {
+            QProcess* client = new QProcess(this);
+            client->setProcessChannelMode(QProcess::ForwardedChannels);
+            connect(client, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished), this,
+                    [this, client](int exitCode, QProcess::ExitStatus exitStatus) {
+                if (exitStatus != QProcess::NormalExit || exitCode != 0) {
+                    _returnCode = 1;
+                }
+                client->deleteLater();
+                if (--_numChildrenRunning == 0) {
+                    QCoreApplication::exit(_returnCode);
+                }
+            });
+            client->start(QCoreApplication::applicationFilePath(),
+                          QStringList(arguments) << "--client" << QString::number((*nextClient)++));
+            ++_numChildrenRunning;
+        }
+        if (*nextClient == numClients) {
+            launchTimer->stop();
+        }
+    });
+    launchTimer->start(LAUNCH_INTERVAL_MSECS);
+}
+
+void LoadGeneratorApp::startClient(const QString& domainAddress) {
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+
+    DependencyManager::set<AccountManager>(false, [&]{ return QString("Mozilla/5.0 (VircadiaLoadGenerator)"); });
+    DependencyManager::set<AddressManager>();
+    DependencyManager::set<NodeList>(NodeType::Agent);
+    DependencyManager::set<PluginManager>()->instantiate();
+
+    auto nodeList = DependencyManager::get<NodeList>();
+
+    // setup a timer for domain-server check ins
+    QTimer* domainCheckInTimer = new QTimer(nodeList.data());
+    connect(domainCheckInTimer, &QTimer::timeout, nodeList.data(), &NodeList::sendDomainServerCheckIn);
+    domainCheckInTimer->start(DOMAIN_SERVER_CHECK_IN_MSECS);
+
+    // start the nodeThread so its event loop is running
+    // (must happen after the checkin timer is created with the nodelist as it's parent)
+    nodeList->startThread();
+
+    // somewhere in the square, on a phase and a tone of its own
+    _home = glm::vec3(randFloat() * _spread, 0.0f, randFloat() * _spread);
+    _phase = randFloat() * TWO_PI;
+    _toneFrequency = 200.0f + 10.0f * (float)(_clientIndex % 60);
+
+    _avatar.reset(new AvatarData());
+    _avatar->setDisplayName(QString("load-generator-%1").arg(_clientIndex));
+    connect(nodeList.data(), &NodeList::uuidChanged, this, [this](const QUuid& sessionUUID) {
+        _avatar->setSessionUUID(sessionUUID);
+    });
+
+    connect(nodeList.data(), &NodeList::nodeActivated, this, &LoadGeneratorApp::nodeActivated);
+    nodeList->addSetOfNodeTypesToNodeInterestSet(NodeSet() << NodeType::AudioMixer << NodeType::AvatarMixer
+                                                 << NodeType::EntityServer);
+
+    auto& packetReceiver = nodeList->getPacketReceiver();
+    packetReceiver.registerListenerForTypes({ PacketType::MixedAudio, PacketType::SilentAudioFrame },
+        PacketReceiver::makeUnsourcedListenerReference<LoadGeneratorApp>(this, &LoadGeneratorApp::countAudio));
+    packetReceiver.registerListenerForTypes({ PacketType::BulkAvatarData, PacketType::AvatarIdentity },
+        PacketReceiver::makeUnsourcedListenerReference<LoadGeneratorApp>(this, &LoadGeneratorApp::countAvatars));
+    packetReceiver.registerListenerForTypes({ PacketType::OctreeStats, PacketType::EntityData, PacketType::EntityErase },
+        PacketReceiver::makeUnsourcedListenerReference<LoadGeneratorApp>(this, &LoadGeneratorApp::countEntities));
+    packetReceiver.registerListener(PacketType::SelectedAudioFormat,
+        PacketReceiver::makeUnsourcedListenerReference<LoadGeneratorApp>(this, &LoadGeneratorApp::handleSelectedAudioFormat));
+
+    if (_sendsAvatar) {
+        connect(&_avatarTimer, &QTimer::timeout, this, &LoadGeneratorApp::sendAvatarData);
+        _avatarTimer.start((int)(MSECS_PER_SECOND / AVATAR_SENDS_PER_SECOND));
+    }
+    if (_sendsAudio) {
+        connect(&_audioTimer, &QTimer::timeout, this, &LoadGeneratorApp::sendAudio);
+        _audioTimer.setTimerType(Qt::PreciseTimer);
+        _audioTimer.start((int)AudioConstants::NETWORK_FRAME_MSECS);
+    }
+    if (_sendsEntityQueries) {
+        connect(&_entityQueryTimer, &QTimer::timeout, this, &LoadGeneratorApp::sendEntityQuery);
+        _entityQueryTimer.start(ENTITY_QUERY_INTERVAL_MSECS);
+    }
+
+    _runTimer.start();
+    DependencyManager::get<AddressManager>()->handleLookupString(domainAddress, false);
+}
+
+void LoadGeneratorApp::nodeActivated(SharedNodePointer node) {
+    if (node->getType() == NodeType::AvatarMixer) {
+        _avatar->sendIdentityPacket();
+    } else if (node->getType() == NodeType::AudioMixer) {
+        negotiateAudioFormat();
+    }
+}
+
+void LoadGeneratorApp::sendAvatarData() {
+    // walk a small circle, every joint swinging a little out of phase with the others
+    float time = (float)_runTimer.elapsed() / (float)MSECS_PER_SECOND;
+    float angle = _phase + TWO_PI * time / WALK_PERIOD;
+    glm::vec3 offset(WALK_RADIUS * std::cos(angle), 0.0f, WALK_RADIUS * std::sin(angle));
+    _avatar->setWorldPosition(_home + offset);
+    _avatar->setWorldOrientation(glm::angleAxis(-angle, Vectors::UNIT_Y));
+    for (int i = 0; i < NUM_SYNTHETIC_JOINTS; i++) {
+        float swing = JOINT_SWING * std::sin(TWO_PI * time + _phase + (float)i);
+        _avatar->setJointData(i, glm::angleAxis(swing, Vectors::UNIT_X), glm::vec3(0.0f, 0.1f, 0.0f));
+    }
+
+    if (DependencyManager::get<NodeList>()->soloNodeOfType(NodeType::AvatarMixer)) {
+        _avatar->sendAvatarDataPacket();
+        ++_numAvatarPacketsSent;
+    }
+}
+
+void LoadGeneratorApp::sendAudio() {
+    if (!DependencyManager::get<NodeList>()->soloNodeOfType(NodeType::AudioMixer)) {
+        return;
+    }
+
+    const int numSamples = AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL;
+    QByteArray audio(numSamples * (int)sizeof(int16_t), 0);
+    int16_t* samples = reinterpret_cast<int16_t*>(audio.data());
+    for (int i = 0; i < numSamples; i++) {
+        float t = (float)(_audioFrame * numSamples + i) / (float)AudioConstants::SAMPLE_RATE;
+        samples[i] = (int16_t)(TONE_AMPLITUDE * std::sin(TWO_PI * _toneFrequency * t));
+    }
+    ++_audioFrame;
+
+    QByteArray encodedBuffer;
+    if (_encoder) {
+        _encoder->encode(audio, encodedBuffer);
+    } else {
+        encodedBuffer = audio;
+    }
+
+    Transform audioTransform;
+    audioTransform.setTranslation(_avatar->getWorldPosition());
+    audioTransform.setRotation(_avatar->getWorldOrientation());
+    AbstractAudioInterface::emitAudioPacket(encodedBuffer.data(), encodedBuffer.size(), _audioSequenceNumber, false,
+                                            audioTransform, _avatar->getWorldPosition(), glm::vec3(0),
+                                            PacketType::MicrophoneAudioNoEcho, _selectedCodecName);
+    ++_numAudioPacketsSent;
+}
+
+void LoadGeneratorApp::sendEntityQuery() {
+    auto nodeList = DependencyManager::get<NodeList>();
+    auto entityServer = nodeList->soloNodeOfType(NodeType::EntityServer);
+    if (!entityServer || !entityServer->getActiveSocket()) {
+        return;
+    }
+
+    // the client looks where it is heading
+    ViewFrustum viewFrustum;
+    viewFrustum.setProjection(DEFAULT_FIELD_OF_VIEW_DEGREES, DEFAULT_ASPECT_RATIO, DEFAULT_NEAR_CLIP, DEFAULT_FAR_CLIP);
+    viewFrustum.setPosition(_avatar->getWorldPosition());
+    viewFrustum.setOrientation(_avatar->getWorldOrientation());
+    viewFrustum.calculate();
+    _octreeQuery.setConicalViews({ ConicalViewFrustum(viewFrustum) });
+
+    auto queryPacket = NLPacket::create(PacketType::EntityQuery);
+    auto packetData = reinterpret_cast<unsigned char*>(queryPacket->getPayload());
+    queryPacket->setPayloadSize(_octreeQuery.getBroadcastData(packetData));
+    nodeList->sendUnreliablePacket(*queryPacket, *entityServer);
+}
+
+void LoadGeneratorApp::negotiateAudioFormat() {
+    auto nodeList = DependencyManager::get<NodeList>();
+    auto negotiateFormatPacket = NLPacket::create(PacketType::NegotiateAudioFormat);
+    const auto& codecPlugins = PluginManager::getInstance()->getCodecPlugins();
+    quint8 numberOfCodecs = (quint8)codecPlugins.size();
+    negotiateFormatPacket->writePrimitive(numberOfCodecs);
+    for (const auto& plugin : codecPlugins) {
+        negotiateFormatPacket->writeString(plugin->getName());
+    }
+
+    SharedNodePointer audioMixer = nodeList->soloNodeOfType(NodeType::AudioMixer);
+    if (audioMixer) {
+        nodeList->sendPacket(std::move(negotiateFormatPacket), *audioMixer);
+    }
+}
+
+void LoadGeneratorApp::handleSelectedAudioFormat(QSharedPointer<ReceivedMessage> message) {
+    QString selectedCodecName = message->readString();
+    if (_selectedCodecName == selectedCodecName) {
+        return;
+    }
+    _selectedCodecName = selectedCodecName;
+
+    if (_codec && _encoder) {
+        _codec->releaseEncoder(_encoder);
+        _encoder = nullptr;
+        _codec = nullptr;
+    }
+
+    const auto& codecPlugins = PluginManager::getInstance()->getCodecPlugins();
+    for (const auto& plugin : codecPlugins) {
+        if (_selectedCodecName == plugin->getName()) {
+            _codec = plugin;
+            _encoder = plugin->createEncoder(AudioConstants::SAMPLE_RATE, AudioConstants::MONO);
+            break;
+        }
+    }
+}
+
+void LoadGeneratorApp::countAudio(QSharedPointer<ReceivedMessage> message) {
+    ++_numAudioPacketsReceived;
+    _numAudioBytesReceived += message->getSize();
+}
+
+void LoadGeneratorApp::countAvatars(QSharedPointer<ReceivedMessage> message) {
+    _numAvatarBytesReceived += message->getSize();
+}
+
+void LoadGeneratorApp::countEntities(QSharedPointer<ReceivedMessage> message) {
+    _numEntityBytesReceived += message->getSize();
+}
+
+void LoadGeneratorApp::report() {
+    auto nodeList = DependencyManager::get<NodeList>();
+    auto pingMs = [&](NodeType_t nodeType) {
+        auto node = nodeList->soloNodeOfType(nodeType);
+        return node ? node->getPingMs() : -1;
+    };
+
+    float seconds = (float)_reportTimer.interval() / (float)MSECS_PER_SECOND;
+    auto kbps = [&](qint64 bytes) {
+        return (float)(bytes * BITS_IN_BYTE) / seconds / BYTES_PER_KILOBYTE;
+    };
+
+    qInfo().noquote() << QString("client %1  %2 s  ping ms audio/avatar/entity %3/%4/%5  received kbps audio/avatar/entity "
+                                 "%6/%7/%8  audio packets sent/received %9/%10  avatar packets sent %11")
+        .arg(_clientIndex)
+        .arg(_runTimer.elapsed() / MSECS_PER_SECOND)
+        .arg(pingMs(NodeType::AudioMixer))
+        .arg(pingMs(NodeType::AvatarMixer))
+        .arg(pingMs(NodeType::EntityServer))
+        .arg(kbps(_numAudioBytesReceived), 0, 'f', 1)
+        .arg(kbps(_numAvatarBytesReceived), 0, 'f', 1)
+        .arg(kbps(_numEntityBytesReceived), 0, 'f', 1)
+        .arg(_numAudioPacketsSent)
+        .arg(_numAudioPacketsReceived)
+        .arg(_numAvatarPacketsSent);
+
+    _numAudioPacketsReceived = 0;
+    _numAudioBytesReceived = 0;
+    _numAvatarBytesReceived = 0;
+    _numEntityBytesReceived = 0;
+    _numAvatarPacketsSent = 0;
+    _numAudioPacketsSent = 0;
+}
+
+void LoadGeneratorApp::finish(int returnCode) {
+    _avatarTimer.stop();
+    _audioTimer.stop();
+    _entityQueryTimer.stop();
+    _reportTimer.stop();
+
+    if (_codec && _encoder) {
+        _codec->releaseEncoder(_encoder);
+        _encoder = nullptr;
+    }
+
+    auto nodeList = DependencyManager::get<NodeList>();
+
+    // send the domain a disconnect packet, force stoppage of domain-server check-ins
+    nodeList->getDomainHandler().disconnect("Finishing");
+    nodeList->setIsShuttingDown(true);
+
+    // tell the packet receiver we're shutting down, so it can drop packets
+    nodeList->getPacketReceiver().setShouldDropPackets(true);
+
+    // remove the NodeList from the DependencyManager
+    DependencyManager::destroy<NodeList>();
+
+    QCoreApplication::exit(returnCode);
+}
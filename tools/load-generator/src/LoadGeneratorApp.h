@@ -0,0 +1,99 @@
+//
+//  LoadGeneratorApp.h
+//  tools/load-generator/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_LoadGeneratorApp_h
+#define vircadia_LoadGeneratorApp_h
+
+#include <memory>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QTimer>
+
+#include <glm/glm.hpp>
+
+#include <NodeList.h>
+#include <OctreeQuery.h>
+#include <ReceivedMessage.h>
+#include <plugins/CodecPlugin.h>
+
+class AvatarData;
+
+// Connects to a real domain as one or more clients that each send what an interface sends: avatar data at the avatar
+// mixer's rate, a tone as microphone audio every network frame, and entity queries, and reports what comes back.
+//
+// The NodeList is one per process, so each client runs in a process of its own; with more than one client, this process
+// only launches the others and waits for them.
+class LoadGeneratorApp : public QCoreApplication {
+    Q_OBJECT
+public:
+    LoadGeneratorApp(int argc, char* argv[]);
+    ~LoadGeneratorApp();
+
+    bool isDone() const { return _isDone; }
+    int getReturnCode() const { return _returnCode; }
+
+private slots:
+    void nodeActivated(SharedNodePointer node);
+    void sendAvatarData();
+    void sendAudio();
+    void sendEntityQuery();
+    void report();
+
+private:
+    void launchClients(int numClients, const QStringList& arguments);
+    void startClient(const QString& domainAddress);
+    void finish(int returnCode);
+
+    void negotiateAudioFormat();
+    void handleSelectedAudioFormat(QSharedPointer<ReceivedMessage> message);
+    void countAudio(QSharedPointer<ReceivedMessage> message);
+    void countAvatars(QSharedPointer<ReceivedMessage> message);
+    void countEntities(QSharedPointer<ReceivedMessage> message);
+
+    int _clientIndex { 0 };
+    float _spread { 0.0f };
+    bool _sendsAudio { true };
+    bool _sendsAvatar { true };
+    bool _sendsEntityQueries { true };
+
+    std::unique_ptr<AvatarData> _avatar;
+    glm::vec3 _home;
+    float _phase { 0.0f };
+    QElapsedTimer _runTimer;
+
+    QTimer _avatarTimer;
+    QTimer _audioTimer;
+    QTimer _entityQueryTimer;
+    QTimer _reportTimer;
+
+    OctreeQuery _octreeQuery;
+
+    CodecPluginPointer _codec;
+    Encoder* _encoder { nullptr };
+    QString _selectedCodecName;
+    quint16 _audioSequenceNumber { 0 };
+    int _audioFrame { 0 };
+    float _toneFrequency { 0.0f };
+
+    // since the last report
+    int _numAudioPacketsReceived { 0 };
+    qint64 _numAudioBytesReceived { 0 };
+    qint64 _numAvatarBytesReceived { 0 };
+    qint64 _numEntityBytesReceived { 0 };
+    int _numAvatarPacketsSent { 0 };
+    int _numAudioPacketsSent { 0 };
+
+    int _numChildrenRunning { 0 };
+    bool _isDone { false };
+    int _returnCode { 0 };
+};
+
+#endif // vircadia_LoadGeneratorApp_h
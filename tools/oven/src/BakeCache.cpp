@@ -0,0 +1,86 @@
+//
+//  BakeCache.cpp
+//  tools/oven/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BakeCache.h"
+
+#include <algorithm>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDebug>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QSaveFile>
+
+static const QString MANIFEST_SUFFIX = ".json";
+static const QString MANIFEST_KEY_KEY = "key";
+static const QString MANIFEST_RESULT_KEY = "result";
+
+BakeCache::BakeCache(const QString& path, int shardIndex, int shardCount) :
+    _path(QDir(path).absolutePath()),
+    _shardIndex(shardIndex),
+    _shardCount(std::max(shardCount, 1))
+{
+}
+
+QByteArray BakeCache::hashKey(const QString& key) {
+    // this has to be the same in every oven that shares the cache, so not qHash, which is seeded per process
+    return QCryptographicHash::hash(key.toUtf8(), QCryptographicHash::Sha1).toHex();
+}
+
+bool BakeCache::isOwned(const QByteArray& hash) const {
+    if (_shardCount <= 1) {
+        return true;
+    }
+    bool ok;
+    auto value = hash.left(8).toUInt(&ok, 16);
+    return ok && (int)(value % (uint)_shardCount) == _shardIndex;
+}
+
+QString BakeCache::getManifestPath(const QByteArray& hash) const {
+    return _path + "/" + QString::fromLatin1(hash) + MANIFEST_SUFFIX;
+}
+
+bool BakeCache::lookup(const QByteArray& hash, QString& result) {
+    auto it = _results.constFind(hash);
+    if (it != _results.constEnd()) {
+        result = it.value();
+        return true;
+    }
+
+    QFile manifest { getManifestPath(hash) };
+    if (!manifest.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    auto json = QJsonDocument::fromJson(manifest.readAll()).object();
+    if (!json.contains(MANIFEST_RESULT_KEY)) {
+        qWarning() << "Ignoring invalid bake cache manifest" << manifest.fileName();
+        return false;
+    }
+    result = json[MANIFEST_RESULT_KEY].toString();
+    _results.insert(hash, result);
+    return true;
+}
+
+bool BakeCache::store(const QByteArray& hash, const QString& key, const QString& result) {
+    QJsonObject json;
+    json[MANIFEST_KEY_KEY] = key;
+    json[MANIFEST_RESULT_KEY] = result;
+
+    // written in one go, so that an oven reading it at the same time never sees half of it
+    QSaveFile manifest { getManifestPath(hash) };
+    if (!manifest.open(QIODevice::WriteOnly) || manifest.write(QJsonDocument(json).toJson()) == -1 || !manifest.commit()) {
+        qWarning() << "Could not write bake cache manifest" << manifest.fileName();
+        return false;
+    }
+    _results.insert(hash, result);
+    return true;
+}
@@ -0,0 +1,52 @@
+//
+//  BakeCache.h
+//  tools/oven/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_BakeCache_h
+#define vircadia_BakeCache_h
+
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QString>
+
+// A content folder shared by the ovens baking a domain, that remembers which bake jobs are done.
+//
+// Each job is addressed by a hash of what it bakes (the source URL and texture usage, or the material data), and
+// writes its output to a folder of its own named by that hash, so that ovens on different machines never collide.
+// Once a job succeeds, a manifest next to that folder records where its result is, and any later oven that comes
+// across the same job uses it rather than baking it again.
+//
+// The hash also splits the jobs between shards: an oven given a shard only bakes the jobs that fall in it.
+class BakeCache {
+public:
+    BakeCache(const QString& path, int shardIndex = 0, int shardCount = 1);
+
+    static QByteArray hashKey(const QString& key);
+
+    const QString& getPath() const { return _path; }
+    bool isSharded() const { return _shardCount > 1; }
+    bool isOwned(const QByteArray& hash) const;
+
+    // the folder a job bakes into, relative to the cache
+    QString getJobFolder(const QByteArray& hash) const { return QString::fromLatin1(hash); }
+
+    // result is the path of the baked file relative to the cache, or the baked data itself
+    bool lookup(const QByteArray& hash, QString& result);
+    bool store(const QByteArray& hash, const QString& key, const QString& result);
+
+private:
+    QString getManifestPath(const QByteArray& hash) const;
+
+    QString _path;
+    int _shardIndex { 0 };
+    int _shardCount { 1 };
+    QHash<QByteArray, QString> _results;
+};
+
+#endif // vircadia_BakeCache_h
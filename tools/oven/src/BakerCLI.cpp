@@ -19,6 +19,7 @@
 #include <unordered_map>
 
 #include "OvenCLIApplication.h"
+#include "DomainBaker.h"
 #include "ModelBakingLoggingCategory.h"
 #include "baking/BakerLibrary.h"
 #include "JSBaker.h"
@@ -111,6 +112,78 @@ void BakerCLI::bakeFile(QUrl inputUrl, const QString& outputPath, const QString&
     connect(_baker.get(), &Baker::finished, this, &BakerCLI::handleFinishedBaker);
 }
 
+void BakerCLI::bakeDomain(QUrl inputUrl, const QString& outputPath, const QUrl& destinationPath, QString cachePath,
+                          int shardIndex, int shardCount, int workers, const QStringList& workerArguments) {
+    // the entities file has to be local
+    if (inputUrl.scheme() != "file") {
+        inputUrl = QUrl::fromLocalFile(inputUrl.toString());
+    }
+
+    _outputPath = outputPath;
+    _domainInputUrl = inputUrl;
+    _domainDestinationPath = destinationPath;
+
+    if (workers > 1 && shardCount <= 1) {
+        // the workers can only share what they bake through a cache
+        static const QString DEFAULT_CACHE_FOLDER_NAME = "cache";
+        if (cachePath.isEmpty()) {
+            cachePath = _outputPath.absoluteFilePath(DEFAULT_CACHE_FOLDER_NAME);
+        }
+        _domainCachePath = cachePath;
+
+        qDebug() << "Splitting domain bake between" << workers << "workers, sharing" << cachePath;
+        for (int i = 0; i < workers; ++i) {
+            QStringList arguments = workerArguments;
+            if (!arguments.contains("--cache")) {
+                arguments << "--cache" << cachePath;
+            }
+            arguments << "--shard" << QString("%1/%2").arg(i).arg(workers);
+
+            auto worker = new QProcess(this);
+            worker->setProcessChannelMode(QProcess::ForwardedChannels);
+            connect(worker, static_cast<void(QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished),
+                    this, &BakerCLI::handleFinishedWorker);
+            worker->start(QCoreApplication::applicationFilePath(), arguments);
+            ++_runningWorkers;
+        }
+        return;
+    }
+
+    _domainCachePath = cachePath;
+    startDomainBaker(shardIndex, shardCount);
+}
+
+void BakerCLI::handleFinishedWorker(int exitCode, QProcess::ExitStatus exitStatus) {
+    auto worker = qobject_cast<QProcess*>(sender());
+    if (exitStatus != QProcess::NormalExit || exitCode != OVEN_STATUS_CODE_SUCCESS) {
+        // whatever it didn't bake is baked by the final bake instead
+        qCDebug(model_baking) << "Domain bake worker failed with exit code" << exitCode;
+    }
+    if (worker) {
+        worker->deleteLater();
+    }
+
+    if (--_runningWorkers == 0) {
+        // every asset is in the cache now, so this picks them all up and writes the entities file
+        startDomainBaker(0, 1);
+    }
+}
+
+void BakerCLI::startDomainBaker(int shardIndex, int shardCount) {
+    auto domainBaker = new DomainBaker(_domainInputUrl, QString(), _outputPath.absolutePath(), _domainDestinationPath, false);
+    if (!_domainCachePath.isEmpty()) {
+        domainBaker->setCache(_domainCachePath, shardIndex, shardCount);
+    }
+    _baker = std::unique_ptr<Baker> { domainBaker };
+    _baker->moveToThread(Oven::instance().getNextWorkerThread());
+
+    // invoke the bake method on the baker thread
+    QMetaObject::invokeMethod(_baker.get(), "bake");
+
+    // make sure we hear about the results of this baker when it is done
+    connect(_baker.get(), &Baker::finished, this, &BakerCLI::handleFinishedBaker);
+}
+
 void BakerCLI::handleFinishedBaker() {
     qCDebug(model_baking) << "Finished baking file.";
     int exitCode = OVEN_STATUS_CODE_SUCCESS;
@@ -13,6 +13,7 @@
 #define hifi_BakerCLI_h
 
 #include <QtCore/QObject>
+#include <QtCore/QProcess>
 #include <QDir>
 #include <QUrl>
 
@@ -36,12 +37,25 @@ public:
 public slots:
     void bakeFile(QUrl inputUrl, const QString& outputPath, const QString& type = QString());
 
+    // with more than one worker, the bake is split between that many oven processes sharing the cache,
+    // and the entities file is written from the cache once they are all done
+    void bakeDomain(QUrl inputUrl, const QString& outputPath, const QUrl& destinationPath, QString cachePath,
+                    int shardIndex, int shardCount, int workers, const QStringList& workerArguments);
+
 private slots:
     void handleFinishedBaker();  
+    void handleFinishedWorker(int exitCode, QProcess::ExitStatus exitStatus);
 
 private:
+    void startDomainBaker(int shardIndex, int shardCount);
+
     QDir _outputPath;
     std::unique_ptr<Baker> _baker;
+
+    QUrl _domainInputUrl;
+    QUrl _domainDestinationPath;
+    QString _domainCachePath;
+    int _runningWorkers { 0 };
 };
 
 #endif // hifi_BakerCLI_h
@@ -37,6 +37,10 @@ DomainBaker::DomainBaker(const QUrl& localModelFileURL, const QString& domainNam
     }
 }
 
+void DomainBaker::setCache(const QString& cachePath, int shardIndex, int shardCount) {
+    _cache.reset(new BakeCache(cachePath, shardIndex, shardCount));
+}
+
 void DomainBaker::bake() {
     setupOutputFolder();
 
@@ -93,6 +97,14 @@ void DomainBaker::setupOutputFolder() {
     }
 
     _contentOutputPath = outputDir.absoluteFilePath(CONTENT_OUTPUT_FOLDER_NAME);
+
+    if (_cache) {
+        if (!QDir().mkpath(_cache->getPath())) {
+            handleError("Could not create cache folder");
+            return;
+        }
+        _contentOutputPath = _cache->getPath();
+    }
 }
 
 const QString ENTITIES_OBJECT_KEY = "Entities";
@@ -150,8 +162,12 @@ void DomainBaker::addModelBaker(const QString& property, const QString& url, con
     if (!bakeableModelURL.isEmpty() && (_shouldRebakeOriginals || !isModelBaked(bakeableModelURL))) {
         // setup a ModelBaker for this URL, as long as we don't already have one
         bool haveBaker = _modelBakers.contains(bakeableModelURL);
+        QString outputPath = _contentOutputPath;
+        if (!haveBaker && resolveFromCache(bakeableModelURL.toString(), bakeableModelURL, property, jsonRef, true, false, outputPath)) {
+            return;
+        }
         if (!haveBaker) {
-            QSharedPointer<ModelBaker> baker = QSharedPointer<ModelBaker>(getModelBaker(bakeableModelURL, _contentOutputPath).release(), &Baker::deleteLater);
+            QSharedPointer<ModelBaker> baker = QSharedPointer<ModelBaker>(getModelBaker(bakeableModelURL, outputPath).release(), &Baker::deleteLater);
             if (baker) {
                 // Hold on to the old url userinfo/query/fragment data so ModelBaker::getFullOutputMappingURL retains that data from the original model URL
                 // Note: The ModelBaker currently doesn't store this in the FST because the equal signs mess up FST parsing.
@@ -194,14 +210,20 @@ void DomainBaker::addTextureBaker(const QString& property, const QString& url, i
         // grab a clean version of the URL without a query or fragment
         QUrl textureURL = QUrl(url).adjusted(QUrl::RemoveQuery | QUrl::RemoveFragment);
         TextureKey key = { textureURL, type };
+        // it doesn't really matter what this key is as long as it's consistent
+        QString rewriteKey = textureURL.toDisplayString() + "^" + QString::number(type);
 
         // setup a texture baker for this URL, as long as we aren't baking a texture already
+        QString outputPath = _contentOutputPath;
+        if (!_textureBakers.contains(key) && resolveFromCache(rewriteKey, rewriteKey, property, jsonRef, true, true, outputPath)) {
+            return;
+        }
         if (!_textureBakers.contains(key)) {
             auto baseTextureFileName = _textureFileNamer.createBaseTextureFileName(textureURL.fileName(), type);
 
             // setup a baker for this texture
             QSharedPointer<TextureBaker> textureBaker {
-                new TextureBaker(textureURL, type, _contentOutputPath, baseTextureFileName),
+                new TextureBaker(textureURL, type, outputPath, baseTextureFileName),
                 &TextureBaker::deleteLater
             };
 
@@ -221,8 +243,7 @@ void DomainBaker::addTextureBaker(const QString& property, const QString& url, i
 
         // add this QJsonValueRef to our multi hash so that it can re-write the texture URL
         // to the baked version once the baker is complete
-        // it doesn't really matter what this key is as long as it's consistent
-        _entitiesNeedingRewrite.insert(textureURL.toDisplayString() + "^" + QString::number(type), { property, jsonRef });
+        _entitiesNeedingRewrite.insert(rewriteKey, { property, jsonRef });
     } else {
         qDebug() << "Texture extension not supported: " << extension;
     }
@@ -233,11 +254,15 @@ void DomainBaker::addScriptBaker(const QString& property, const QString& url, co
     QUrl scriptURL = QUrl(url).adjusted(QUrl::RemoveQuery | QUrl::RemoveFragment);
 
     // setup a script baker for this URL, as long as we aren't baking a script already
+    QString outputPath = _contentOutputPath;
+    if (!_scriptBakers.contains(scriptURL) && resolveFromCache(scriptURL.toString(), scriptURL, property, jsonRef, true, true, outputPath)) {
+        return;
+    }
     if (!_scriptBakers.contains(scriptURL)) {
 
         // setup a baker for this script
         QSharedPointer<JSBaker> scriptBaker {
-            new JSBaker(scriptURL, _contentOutputPath),
+            new JSBaker(scriptURL, outputPath),
             &JSBaker::deleteLater
         };
 
@@ -270,11 +295,22 @@ void DomainBaker::addMaterialBaker(const QString& property, const QString& data,
     }
 
     // setup a material baker for this URL, as long as we aren't baking a material already
+    QString outputPath = _contentOutputPath;
+    if (!_materialBakers.contains(materialData)) {
+        // inline material data is baked with URLs to its textures resolved against the destination
+        QString jobKey = isURL ? materialData : materialData + "^" + destinationPath.toString();
+        if (resolveFromCache(jobKey, materialData, property, jsonRef, isURL, true, outputPath)) {
+            return;
+        }
+        if (_cache && !destinationPath.isEmpty()) {
+            destinationPath = destinationPath.resolved(QDir(_contentOutputPath).relativeFilePath(outputPath) + "/");
+        }
+    }
     if (!_materialBakers.contains(materialData)) {
 
         // setup a baker for this material
         QSharedPointer<MaterialBaker> materialBaker {
-            new MaterialBaker(materialData, isURL, _contentOutputPath, destinationPath),
+            new MaterialBaker(materialData, isURL, outputPath, destinationPath),
             &MaterialBaker::deleteLater
         };
 
@@ -427,6 +463,63 @@ void DomainBaker::enumerateEntities() {
     emit bakeProgress(0, _totalNumberOfSubBakes);
 }
 
+void DomainBaker::rewriteReferences(const EntityReferences& references, const QString& newDataOrURL, bool isURL,
+                                    bool keepURLSuffix) {
+    for (auto propertyEntityPair : references) {
+        QString property = propertyEntityPair.first;
+        // convert the entity QJsonValueRef to a QJsonObject so we can modify its URL
+        auto entity = propertyEntityPair.second.toObject();
+
+        if (!property.contains(".")) {
+            if (isURL && keepURLSuffix) {
+                // copy the fragment and query, and user info from the old URL
+                QUrl oldURL = entity[property].toString();
+                QUrl newURL = newDataOrURL;
+                newURL.setQuery(oldURL.query());
+                newURL.setFragment(oldURL.fragment());
+                newURL.setUserInfo(oldURL.userInfo());
+
+                // set the new URL as the value in our temp QJsonObject
+                entity[property] = newURL.toString();
+            } else {
+                entity[property] = newDataOrURL;
+            }
+        } else {
+            // Group property
+            QStringList propertySplit = property.split(".");
+            assert(propertySplit.length() == 2);
+            auto oldObject = entity[propertySplit[0]].toObject();
+
+            if (isURL) {
+                // copy the fragment and query, and user info from the old URL
+                QUrl oldURL = oldObject[propertySplit[1]].toString();
+                QUrl newURL = newDataOrURL;
+                newURL.setQuery(oldURL.query());
+                newURL.setFragment(oldURL.fragment());
+                newURL.setUserInfo(oldURL.userInfo());
+
+                // set the new URL as the value in our temp QJsonObject
+                oldObject[propertySplit[1]] = newURL.toString();
+            } else {
+                oldObject[propertySplit[1]] = newDataOrURL;
+            }
+            entity[propertySplit[0]] = oldObject;
+        }
+
+        // replace our temp object with the value referenced by our QJsonValueRef
+        propertyEntityPair.second = entity;
+    }
+}
+
+// the path of a baked file relative to the content folder, which entity references are re-written relative to
+static QString getRelativeContentPath(const QString& contentOutputPath, const QString& filePath) {
+    auto relativeFilePath = QDir(contentOutputPath).relativeFilePath(filePath);
+    if (relativeFilePath.startsWith("/")) {
+        relativeFilePath = relativeFilePath.right(relativeFilePath.length() - 1);
+    }
+    return relativeFilePath;
+}
+
 void DomainBaker::handleFinishedModelBaker() {
     auto baker = qobject_cast<ModelBaker*>(sender());
 
@@ -436,48 +529,12 @@ void DomainBaker::handleFinishedModelBaker() {
             qDebug() << "Re-writing entity references to" << baker->getModelURL();
 
             // setup a new URL using the prefix we were passed
-            auto relativeMappingFilePath = QDir(_contentOutputPath).relativeFilePath(baker->getFullOutputMappingURL().toString());
-            if (relativeMappingFilePath.startsWith("/")) {
-                relativeMappingFilePath = relativeMappingFilePath.right(relativeMappingFilePath.length() - 1);
-            }
+            auto relativeMappingFilePath = getRelativeContentPath(_contentOutputPath, baker->getFullOutputMappingURL().toString());
+            storeInCache(baker->getOriginalInputModelURL(), relativeMappingFilePath);
 
+            // the fragment, query, and user info from the original model URL should now be present on the filename in the FST file
             QUrl newURL = _destinationPath.resolved(relativeMappingFilePath);
-
-            // enumerate the QJsonRef values for the URL of this model from our multi hash of
-            // entity objects needing a URL re-write
-            for (auto propertyEntityPair : _entitiesNeedingRewrite.values(baker->getOriginalInputModelURL())) {
-                QString property = propertyEntityPair.first;
-                // convert the entity QJsonValueRef to a QJsonObject so we can modify its URL
-                auto entity = propertyEntityPair.second.toObject();
-
-                if (!property.contains(".")) {
-                    // grab the old URL
-                    QUrl oldURL = entity[property].toString();
-
-                    // set the new URL as the value in our temp QJsonObject
-                    // The fragment, query, and user info from the original model URL should now be present on the filename in the FST file
-                    entity[property] = newURL.toString();
-                } else {
-                    // Group property
-                    QStringList propertySplit = property.split(".");
-                    assert(propertySplit.length() == 2);
-                    // grab the old URL
-                    auto oldObject = entity[propertySplit[0]].toObject();
-                    QUrl oldURL = oldObject[propertySplit[1]].toString();
-
-                    // copy the fragment and query, and user info from the old model URL
-                    newURL.setQuery(oldURL.query());
-                    newURL.setFragment(oldURL.fragment());
-                    newURL.setUserInfo(oldURL.userInfo());
-
-                    // set the new URL as the value in our temp QJsonObject
-                    oldObject[propertySplit[1]] = newURL.toString();
-                    entity[propertySplit[0]] = oldObject;
-                }
-
-                // replace our temp object with the value referenced by our QJsonValueRef
-                propertyEntityPair.second = entity;
-            }
+            rewriteReferences(_entitiesNeedingRewrite.values(baker->getOriginalInputModelURL()), newURL.toString(), true, false);
         } else {
             // this model failed to bake - this doesn't fail the entire bake but we need to add
             // the errors from the model to our warnings
@@ -509,51 +566,11 @@ void DomainBaker::handleFinishedTextureBaker() {
             qDebug() << "Re-writing entity references to" << baker->getTextureURL() << "with usage" << baker->getTextureType();
 
             // setup a new URL using the prefix we were passed
-            auto relativeTextureFilePath = QDir(_contentOutputPath).relativeFilePath(baker->getMetaTextureFileName());
-            if (relativeTextureFilePath.startsWith("/")) {
-                relativeTextureFilePath = relativeTextureFilePath.right(relativeTextureFilePath.length() - 1);
-            }
-            auto newURL = _destinationPath.resolved(relativeTextureFilePath);
+            auto relativeTextureFilePath = getRelativeContentPath(_contentOutputPath, baker->getMetaTextureFileName());
+            storeInCache(rewriteKey, relativeTextureFilePath);
 
-            // enumerate the QJsonRef values for the URL of this texture from our multi hash of
-            // entity objects needing a URL re-write
-            for (auto propertyEntityPair : _entitiesNeedingRewrite.values(rewriteKey)) {
-                QString property = propertyEntityPair.first;
-                // convert the entity QJsonValueRef to a QJsonObject so we can modify its URL
-                auto entity = propertyEntityPair.second.toObject();
-
-                if (!property.contains(".")) {
-                    // grab the old URL
-                    QUrl oldURL = entity[property].toString();
-
-                    // copy the fragment and query, and user info from the old texture URL
-                    newURL.setQuery(oldURL.query());
-                    newURL.setFragment(oldURL.fragment());
-                    newURL.setUserInfo(oldURL.userInfo());
-
-                    // set the new URL as the value in our temp QJsonObject
-                    entity[property] = newURL.toString();
-                } else {
-                    // Group property
-                    QStringList propertySplit = property.split(".");
-                    assert(propertySplit.length() == 2);
-                    // grab the old URL
-                    auto oldObject = entity[propertySplit[0]].toObject();
-                    QUrl oldURL = oldObject[propertySplit[1]].toString();
-
-                    // copy the fragment and query, and user info from the old texture URL
-                    newURL.setQuery(oldURL.query());
-                    newURL.setFragment(oldURL.fragment());
-                    newURL.setUserInfo(oldURL.userInfo());
-
-                    // set the new URL as the value in our temp QJsonObject
-                    oldObject[propertySplit[1]] = newURL.toString();
-                    entity[propertySplit[0]] = oldObject;
-                }
-
-                // replace our temp object with the value referenced by our QJsonValueRef
-                propertyEntityPair.second = entity;
-            }
+            auto newURL = _destinationPath.resolved(relativeTextureFilePath);
+            rewriteReferences(_entitiesNeedingRewrite.values(rewriteKey), newURL.toString(), true, true);
         } else {
             // this texture failed to bake - this doesn't fail the entire bake but we need to add the errors from
             // the texture to our warnings
@@ -583,51 +600,11 @@ void DomainBaker::handleFinishedScriptBaker() {
             qDebug() << "Re-writing entity references to" << baker->getJSPath();
 
             // setup a new URL using the prefix we were passed
-            auto relativeScriptFilePath = QDir(_contentOutputPath).relativeFilePath(baker->getBakedJSFilePath());
-            if (relativeScriptFilePath.startsWith("/")) {
-                relativeScriptFilePath = relativeScriptFilePath.right(relativeScriptFilePath.length() - 1);
-            }
-            auto newURL = _destinationPath.resolved(relativeScriptFilePath);
-
-            // enumerate the QJsonRef values for the URL of this script from our multi hash of
-            // entity objects needing a URL re-write
-            for (auto propertyEntityPair : _entitiesNeedingRewrite.values(baker->getJSPath())) {
-                QString property = propertyEntityPair.first;
-                // convert the entity QJsonValueRef to a QJsonObject so we can modify its URL
-                auto entity = propertyEntityPair.second.toObject();
-
-                if (!property.contains(".")) {
-                    // grab the old URL
-                    QUrl oldURL = entity[property].toString();
-
-                    // copy the fragment and query, and user info from the old script URL
-                    newURL.setQuery(oldURL.query());
-                    newURL.setFragment(oldURL.fragment());
-                    newURL.setUserInfo(oldURL.userInfo());
-
-                    // set the new URL as the value in our temp QJsonObject
-                    entity[property] = newURL.toString();
-                } else {
-                    // Group property
-                    QStringList propertySplit = property.split(".");
-                    assert(propertySplit.length() == 2);
-                    // grab the old URL
-                    auto oldObject = entity[propertySplit[0]].toObject();
-                    QUrl oldURL = oldObject[propertySplit[1]].toString();
-
-                    // copy the fragment and query, and user info from the old script URL
-                    newURL.setQuery(oldURL.query());
-                    newURL.setFragment(oldURL.fragment());
-                    newURL.setUserInfo(oldURL.userInfo());
-
-                    // set the new URL as the value in our temp QJsonObject
-                    oldObject[propertySplit[1]] = newURL.toString();
-                    entity[propertySplit[0]] = oldObject;
-                }
+            auto relativeScriptFilePath = getRelativeContentPath(_contentOutputPath, baker->getBakedJSFilePath());
+            storeInCache(baker->getJSPath(), relativeScriptFilePath);
 
-                // replace our temp object with the value referenced by our QJsonValueRef
-                propertyEntityPair.second = entity;
-            }
+            auto newURL = _destinationPath.resolved(relativeScriptFilePath);
+            rewriteReferences(_entitiesNeedingRewrite.values(baker->getJSPath()), newURL.toString(), true, true);
         } else {
             // this script failed to bake - this doesn't fail the entire bake but we need to add
             // the errors from the script to our warnings
@@ -659,65 +636,15 @@ void DomainBaker::handleFinishedMaterialBaker() {
             QString newDataOrURL;
             if (baker->isURL()) {
                 // setup a new URL using the prefix we were passed
-                auto relativeMaterialFilePath = QDir(_contentOutputPath).relativeFilePath(baker->getBakedMaterialData());
-                if (relativeMaterialFilePath.startsWith("/")) {
-                    relativeMaterialFilePath = relativeMaterialFilePath.right(relativeMaterialFilePath.length() - 1);
-                }
+                auto relativeMaterialFilePath = getRelativeContentPath(_contentOutputPath, baker->getBakedMaterialData());
+                storeInCache(baker->getMaterialData(), relativeMaterialFilePath);
                 newDataOrURL = _destinationPath.resolved(relativeMaterialFilePath).toDisplayString();
             } else {
                 newDataOrURL = baker->getBakedMaterialData();
+                storeInCache(baker->getMaterialData(), newDataOrURL);
             }
 
-            // enumerate the QJsonRef values for the URL of this material from our multi hash of
-            // entity objects needing a URL re-write
-            for (auto propertyEntityPair : _entitiesNeedingRewrite.values(baker->getMaterialData())) {
-                QString property = propertyEntityPair.first;
-                // convert the entity QJsonValueRef to a QJsonObject so we can modify its URL
-                auto entity = propertyEntityPair.second.toObject();
-
-                if (!property.contains(".")) {
-                    // grab the old URL
-                    QUrl oldURL = entity[property].toString();
-
-                    // copy the fragment and query, and user info from the old material data
-                    if (baker->isURL()) {
-                        QUrl newURL = newDataOrURL;
-                        newURL.setQuery(oldURL.query());
-                        newURL.setFragment(oldURL.fragment());
-                        newURL.setUserInfo(oldURL.userInfo());
-
-                        // set the new URL as the value in our temp QJsonObject
-                        entity[property] = newURL.toString();
-                    } else {
-                        entity[property] = newDataOrURL;
-                    }
-                } else {
-                    // Group property
-                    QStringList propertySplit = property.split(".");
-                    assert(propertySplit.length() == 2);
-                    // grab the old URL
-                    auto oldObject = entity[propertySplit[0]].toObject();
-                    QUrl oldURL = oldObject[propertySplit[1]].toString();
-
-                    // copy the fragment and query, and user info from the old material data
-                    if (baker->isURL()) {
-                        QUrl newURL = newDataOrURL;
-                        newURL.setQuery(oldURL.query());
-                        newURL.setFragment(oldURL.fragment());
-                        newURL.setUserInfo(oldURL.userInfo());
-
-                        // set the new URL as the value in our temp QJsonObject
-                        oldObject[propertySplit[1]] = newURL.toString();
-                        entity[propertySplit[0]] = oldObject;
-                    } else {
-                        oldObject[propertySplit[1]] = newDataOrURL;
-                        entity[propertySplit[0]] = oldObject;
-                    }
-                }
-
-                // replace our temp object with the value referenced by our QJsonValueRef
-                propertyEntityPair.second = entity;
-            }
+            rewriteReferences(_entitiesNeedingRewrite.values(baker->getMaterialData()), newDataOrURL, baker->isURL(), true);
         } else {
             // this material failed to bake - this doesn't fail the entire bake but we need to add
             // the errors from the material to our warnings
@@ -738,8 +665,53 @@ void DomainBaker::handleFinishedMaterialBaker() {
     }
 }
 
+bool DomainBaker::resolveFromCache(const QString& jobKey, const QUrl& rewriteKey, const QString& property,
+                                   const QJsonValueRef& jsonRef, bool isURL, bool keepURLSuffix, QString& outputPath) {
+    if (!_cache) {
+        return false;
+    }
+
+    auto hash = BakeCache::hashKey(jobKey);
+    QString result;
+    if (!_shouldRebakeOriginals && _cache->lookup(hash, result)) {
+        QString newDataOrURL = isURL ? _destinationPath.resolved(result).toDisplayString() : result;
+        rewriteReferences({ { property, jsonRef } }, newDataOrURL, isURL, keepURLSuffix);
+        return true;
+    }
+
+    if (!_cache->isOwned(hash)) {
+        return true;
+    }
+
+    outputPath = _contentOutputPath + "/" + _cache->getJobFolder(hash);
+    if (!QDir().mkpath(outputPath)) {
+        handleWarning("Could not create cache folder for " + jobKey);
+        return true;
+    }
+    _cacheJobs.insert(rewriteKey, { jobKey, hash });
+    return false;
+}
+
+void DomainBaker::storeInCache(const QUrl& rewriteKey, const QString& result) {
+    if (!_cache) {
+        return;
+    }
+
+    auto it = _cacheJobs.find(rewriteKey);
+    if (it != _cacheJobs.end()) {
+        _cache->store(it->second, it->first, result);
+        _cacheJobs.erase(it);
+    }
+}
+
 void DomainBaker::checkIfRewritingComplete() {
     if (_entitiesNeedingRewrite.isEmpty()) {
+        if (_cache && _cache->isSharded()) {
+            // the bake without shards writes the entities file, once every shard has filled the cache
+            emit finished();
+            return;
+        }
+
         writeNewEntitiesFile();
 
         if (hasErrors()) {
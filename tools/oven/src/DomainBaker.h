@@ -19,6 +19,9 @@
 #include <QtCore/QUrl>
 #include <QtCore/QThread>
 
+#include <memory>
+
+#include "BakeCache.h"
 #include "ModelBaker.h"
 #include "TextureBaker.h"
 #include "JSBaker.h"
@@ -34,6 +37,11 @@ public:
                 const QString& baseOutputPath, const QUrl& destinationPath,
                 bool shouldRebakeOriginals);
 
+    // Bakes into the content folder at cachePath, shared with other ovens, rather than a new one, skipping the jobs
+    // it already has the results of. With more than one shard, only the jobs in shardIndex are baked and no entities
+    // file is written: a last bake without shards picks all of the results up from the cache and writes it.
+    void setCache(const QString& cachePath, int shardIndex = 0, int shardCount = 1);
+
 signals:
     void allModelsFinished();
     void bakeProgress(int baked, int total);
@@ -52,6 +60,16 @@ private:
     void checkIfRewritingComplete();
     void writeNewEntitiesFile();
 
+    using EntityReferences = QList<std::pair<QString, QJsonValueRef>>;
+    void rewriteReferences(const EntityReferences& references, const QString& newDataOrURL, bool isURL,
+                           bool keepURLSuffix);
+
+    // returns true if there is nothing for this oven to bake, because the job is in another shard or the reference
+    // was re-written from the cache, and otherwise sets outputPath to the folder the job should bake into
+    bool resolveFromCache(const QString& jobKey, const QUrl& rewriteKey, const QString& property,
+                          const QJsonValueRef& jsonRef, bool isURL, bool keepURLSuffix, QString& outputPath);
+    void storeInCache(const QUrl& rewriteKey, const QString& result);
+
     QUrl _localEntitiesFileURL;
     QString _domainName;
     QString _baseOutputPath;
@@ -77,6 +95,9 @@ private:
 
     bool _shouldRebakeOriginals { false };
 
+    std::unique_ptr<BakeCache> _cache;
+    QHash<QUrl, std::pair<QString, QByteArray>> _cacheJobs; // rewrite key to the job's key and hash
+
     void addModelBaker(const QString& property, const QString& url, const QJsonValueRef& jsonRef);
     void addTextureBaker(const QString& property, const QString& url, image::TextureUsage::Type type, const QJsonValueRef& jsonRef);
     void addScriptBaker(const QString& property, const QString& url, const QJsonValueRef& jsonRef);
@@ -14,6 +14,7 @@
 #include <QtCore/QCommandLineParser>
 #include <QtCore/QUrl>
 
+#include <algorithm>
 #include <iostream>
 
 #include <image/TextureProcessing.h>
@@ -25,17 +26,38 @@ static const QString CLI_INPUT_PARAMETER = "i";
 static const QString CLI_OUTPUT_PARAMETER = "o";
 static const QString CLI_TYPE_PARAMETER = "t";
 static const QString CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER = "disable-texture-compression";
+static const QString CLI_TEXTURE_THREADS_PARAMETER = "texture-threads";
+static const QString CLI_DESTINATION_PARAMETER = "destination";
+static const QString CLI_CACHE_PARAMETER = "cache";
+static const QString CLI_SHARD_PARAMETER = "shard";
+static const QString CLI_WORKERS_PARAMETER = "workers";
+
+static const QString DOMAIN_TYPE = "domain";
 
 QUrl OvenCLIApplication::_inputUrlParameter;
 QUrl OvenCLIApplication::_outputUrlParameter;
 QString OvenCLIApplication::_typeParameter;
+QUrl OvenCLIApplication::_destinationParameter;
+QString OvenCLIApplication::_cacheParameter;
+int OvenCLIApplication::_shardIndexParameter { 0 };
+int OvenCLIApplication::_shardCountParameter { 1 };
+int OvenCLIApplication::_workersParameter { 1 };
+QStringList OvenCLIApplication::_workerArguments;
 
 OvenCLIApplication::OvenCLIApplication(int argc, char* argv[]) :
     QCoreApplication(argc, argv)
 {
     BakerCLI* cli = new BakerCLI(this);
-    QMetaObject::invokeMethod(cli, "bakeFile", Qt::QueuedConnection, Q_ARG(QUrl, _inputUrlParameter),
-                              Q_ARG(QString, _outputUrlParameter.toString()), Q_ARG(QString, _typeParameter));
+    if (_typeParameter == DOMAIN_TYPE) {
+        QMetaObject::invokeMethod(cli, "bakeDomain", Qt::QueuedConnection, Q_ARG(QUrl, _inputUrlParameter),
+                                  Q_ARG(QString, _outputUrlParameter.toString()), Q_ARG(QUrl, _destinationParameter),
+                                  Q_ARG(QString, _cacheParameter), Q_ARG(int, _shardIndexParameter),
+                                  Q_ARG(int, _shardCountParameter), Q_ARG(int, _workersParameter),
+                                  Q_ARG(QStringList, _workerArguments));
+    } else {
+        QMetaObject::invokeMethod(cli, "bakeFile", Qt::QueuedConnection, Q_ARG(QUrl, _inputUrlParameter),
+                                  Q_ARG(QString, _outputUrlParameter.toString()), Q_ARG(QString, _typeParameter));
+    }
 }
 
 void OvenCLIApplication::parseCommandLine(int argc, char* argv[]) {
@@ -46,8 +68,13 @@ void OvenCLIApplication::parseCommandLine(int argc, char* argv[]) {
     parser.addOptions({
         { CLI_INPUT_PARAMETER, "Path to file that you would like to bake.", "input" },
         { CLI_OUTPUT_PARAMETER, "Path to folder that will be used as output.", "output" },
-        { CLI_TYPE_PARAMETER, "Type of asset. [model|material]"/*|js]"*/, "type" },
-        { CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER, "Disable texture compression." }
+        { CLI_TYPE_PARAMETER, "Type of asset. [model|material|domain]"/*|js]"*/, "type" },
+        { CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER, "Disable texture compression." },
+        { CLI_TEXTURE_THREADS_PARAMETER, "Number of threads to compress textures on, all of the cores by default.", "threads" },
+        { CLI_DESTINATION_PARAMETER, "Domain bakes: URL the baked content will be served from.", "url" },
+        { CLI_CACHE_PARAMETER, "Domain bakes: content folder shared between bakes, whose already baked assets are skipped.", "path" },
+        { CLI_SHARD_PARAMETER, "Domain bakes: only bake the assets in shard <index>/<count> into the cache.", "index/count" },
+        { CLI_WORKERS_PARAMETER, "Domain bakes: number of oven processes to split the bake between.", "count" }
     });
 
     auto versionOption = parser.addVersionOption();
@@ -87,8 +114,56 @@ void OvenCLIApplication::parseCommandLine(int argc, char* argv[]) {
 
     _typeParameter = parser.isSet(CLI_TYPE_PARAMETER) ? parser.value(CLI_TYPE_PARAMETER) : QString();
 
+    if (_typeParameter == DOMAIN_TYPE) {
+        if (!parser.isSet(CLI_DESTINATION_PARAMETER)) {
+            std::cout << "Error: Destination not set for domain bake" << std::endl; // Avoid Qt log spam
+            QCoreApplication mockApp(argc, argv); // required for call to showHelp()
+            parser.showHelp();
+            Q_UNREACHABLE();
+        }
+        _destinationParameter = parser.value(CLI_DESTINATION_PARAMETER);
+        _cacheParameter = parser.isSet(CLI_CACHE_PARAMETER) ? QDir::fromNativeSeparators(parser.value(CLI_CACHE_PARAMETER)) : QString();
+
+        if (parser.isSet(CLI_SHARD_PARAMETER)) {
+            auto shard = parser.value(CLI_SHARD_PARAMETER).split('/');
+            bool indexOK = false;
+            bool countOK = false;
+            if (shard.size() == 2) {
+                _shardIndexParameter = shard[0].toInt(&indexOK);
+                _shardCountParameter = shard[1].toInt(&countOK);
+            }
+            if (!indexOK || !countOK || _shardCountParameter < 1 ||
+                _shardIndexParameter < 0 || _shardIndexParameter >= _shardCountParameter) {
+                std::cout << "Error: Shard must be <index>/<count>, with index less than count" << std::endl;
+                QCoreApplication mockApp(argc, argv); // required for call to showHelp()
+                parser.showHelp();
+                Q_UNREACHABLE();
+            }
+        }
+
+        if (parser.isSet(CLI_WORKERS_PARAMETER)) {
+            _workersParameter = std::max(1, parser.value(CLI_WORKERS_PARAMETER).toInt());
+
+            // the workers are run with the same arguments, and told their shard instead of how many workers to start
+            for (int i = 1; i < argc; ++i) {
+                QString argument = argv[i];
+                if (argument == "--" + CLI_WORKERS_PARAMETER) {
+                    ++i;
+                } else if (!argument.startsWith("--" + CLI_WORKERS_PARAMETER + "=")) {
+                    _workerArguments << argument;
+                }
+            }
+        }
+    }
+
     if (parser.isSet(CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER)) {
         qDebug() << "Disabling texture compression";
         TextureBaker::setCompressionEnabled(false);
     }
+
+    if (parser.isSet(CLI_TEXTURE_THREADS_PARAMETER)) {
+        int textureThreads = parser.value(CLI_TEXTURE_THREADS_PARAMETER).toInt();
+        qDebug() << "Compressing textures on" << textureThreads << "threads";
+        image::setCompressionThreadCount(textureThreads);
+    }
 }
@@ -13,6 +13,8 @@
 #define hifi_OvenCLIApplication_h
 
 #include <QtCore/QCoreApplication>
+#include <QtCore/QStringList>
+#include <QtCore/QUrl>
 
 #include "Oven.h"
 
@@ -29,6 +31,12 @@ private:
     static QUrl _inputUrlParameter;
     static QUrl _outputUrlParameter;
     static QString _typeParameter;
+    static QUrl _destinationParameter;
+    static QString _cacheParameter;
+    static int _shardIndexParameter;
+    static int _shardCountParameter;
+    static int _workersParameter;
+    static QStringList _workerArguments;
 };
 
 #endif // hifi_OvenCLIApplication_h
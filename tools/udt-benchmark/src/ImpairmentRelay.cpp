@@ -0,0 +1,101 @@
+//
+//  ImpairmentRelay.cpp
+//  tools/udt-benchmark/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ImpairmentRelay.h"
+
+#include <algorithm>
+
+#include <QtCore/QDebug>
+
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+
+// big enough that the relay, not the kernel, decides what is dropped
+static const int RELAY_BUFFER_SIZE = 8 * 1024 * 1024;
+
+ImpairmentRelay::ImpairmentRelay(const Impairment& impairment, const SockAddr& senderAddress,
+                                 const SockAddr& receiverAddress, QObject* parent) :
+    QObject(parent),
+    _impairment(impairment),
+    _senderAddress(senderAddress),
+    _receiverAddress(receiverAddress),
+    _jitterDistribution(-impairment.jitterUsec, impairment.jitterUsec)
+{
+    _socket.bind(QHostAddress::LocalHost, 0);
+    _socket.setSocketOption(QAbstractSocket::SendBufferSizeSocketOption, RELAY_BUFFER_SIZE);
+    _socket.setSocketOption(QAbstractSocket::ReceiveBufferSizeSocketOption, RELAY_BUFFER_SIZE);
+    connect(&_socket, &QUdpSocket::readyRead, this, &ImpairmentRelay::readPendingDatagrams);
+
+    _deliveryTimer.setTimerType(Qt::PreciseTimer);
+    _deliveryTimer.setSingleShot(true);
+    connect(&_deliveryTimer, &QTimer::timeout, this, &ImpairmentRelay::deliverDueDatagrams);
+}
+
+SockAddr ImpairmentRelay::getAddress() const {
+    return SockAddr(SocketType::UDP, QHostAddress::LocalHost, _socket.localPort());
+}
+
+void ImpairmentRelay::readPendingDatagrams() {
+    quint64 now = usecTimestampNow();
+
+    while (_socket.hasPendingDatagrams()) {
+        Datagram datagram;
+        datagram.data.resize((int)_socket.pendingDatagramSize());
+
+        QHostAddress fromAddress;
+        quint16 fromPort;
+        _socket.readDatagram(datagram.data.data(), datagram.data.size(), &fromAddress, &fromPort);
+
+        if (_impairment.loss > 0.0f && _lossDistribution(_generator) < _impairment.loss) {
+            ++_numDropped;
+            continue;
+        }
+
+        datagram.destination = fromPort == _receiverAddress.getPort() ? _senderAddress : _receiverAddress;
+
+        int delay = _impairment.delayUsec + (_impairment.jitterUsec > 0 ? _jitterDistribution(_generator) : 0);
+        if (delay <= 0) {
+            _socket.writeDatagram(datagram.data, datagram.destination.getAddress(), datagram.destination.getPort());
+            ++_numForwarded;
+            continue;
+        }
+
+        _pending.emplace(now + (quint64)delay, std::move(datagram));
+    }
+
+    scheduleDelivery();
+}
+
+void ImpairmentRelay::deliverDueDatagrams() {
+    quint64 now = usecTimestampNow();
+
+    auto it = _pending.begin();
+    while (it != _pending.end() && it->first <= now) {
+        const Datagram& datagram = it->second;
+        _socket.writeDatagram(datagram.data, datagram.destination.getAddress(), datagram.destination.getPort());
+        ++_numForwarded;
+        it = _pending.erase(it);
+    }
+
+    scheduleDelivery();
+}
+
+void ImpairmentRelay::scheduleDelivery() {
+    if (_pending.empty()) {
+        return;
+    }
+
+    quint64 now = usecTimestampNow();
+    quint64 due = _pending.begin()->first;
+    int waitMsecs = due > now ? (int)((due - now) / USECS_PER_MSEC) : 0;
+    if (!_deliveryTimer.isActive() || _deliveryTimer.remainingTime() > waitMsecs) {
+        _deliveryTimer.start(waitMsecs);
+    }
+}
@@ -0,0 +1,74 @@
+//
+//  ImpairmentRelay.h
+//  tools/udt-benchmark/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_ImpairmentRelay_h
+#define vircadia_ImpairmentRelay_h
+
+#include <map>
+#include <random>
+
+#include <QtCore/QObject>
+#include <QtCore/QTimer>
+#include <QtNetwork/QUdpSocket>
+
+#include <SockAddr.h>
+
+struct Impairment {
+    float loss { 0.0f };      // probability of dropping each datagram
+    int delayUsec { 0 };      // added one way delay
+    int jitterUsec { 0 };     // the delay varies uniformly by up to this much either way, which can reorder datagrams
+
+    bool isActive() const { return loss > 0.0f || delayUsec > 0 || jitterUsec > 0; }
+};
+
+// Forwards datagrams between a sender and a receiver on localhost, dropping and delaying them in both directions
+// the way tc netem would, so that a benchmark can be impaired without root or touching the network configuration.
+//
+// The sender sends to getAddress() and the receiver answers the relay, so both sides only ever see the relay.
+class ImpairmentRelay : public QObject {
+    Q_OBJECT
+public:
+    ImpairmentRelay(const Impairment& impairment, const SockAddr& senderAddress, const SockAddr& receiverAddress,
+                    QObject* parent = nullptr);
+
+    SockAddr getAddress() const;
+
+    quint64 getNumForwarded() const { return _numForwarded; }
+    quint64 getNumDropped() const { return _numDropped; }
+
+private slots:
+    void readPendingDatagrams();
+    void deliverDueDatagrams();
+
+private:
+    struct Datagram {
+        QByteArray data;
+        SockAddr destination;
+    };
+
+    void scheduleDelivery();
+
+    Impairment _impairment;
+    SockAddr _senderAddress;
+    SockAddr _receiverAddress;
+
+    QUdpSocket _socket;
+    QTimer _deliveryTimer;
+    std::multimap<quint64, Datagram> _pending; // by delivery time
+
+    std::mt19937 _generator { std::random_device()() };
+    std::uniform_real_distribution<float> _lossDistribution { 0.0f, 1.0f };
+    std::uniform_int_distribution<int> _jitterDistribution;
+
+    quint64 _numForwarded { 0 };
+    quint64 _numDropped { 0 };
+};
+
+#endif // vircadia_ImpairmentRelay_h
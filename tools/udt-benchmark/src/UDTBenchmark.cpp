@@ -0,0 +1,414 @@
+//
+//  UDTBenchmark.cpp
+//  tools/udt-benchmark/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "UDTBenchmark.h"
+
+#include <algorithm>
+#include <atomic>
+#include <ctime>
+#include <memory>
+#include <mutex>
+
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QDateTime>
+#include <QtCore/QDebug>
+#include <QtCore/QEventLoop>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QTimer>
+
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+#include <udt/Constants.h>
+#include <udt/Packet.h>
+#include <udt/PacketList.h>
+#include <udt/Socket.h>
+
+// leads the payload of every packet
+struct PacketStamp {
+    quint64 sendUsec;
+};
+
+struct ImpairmentProfile {
+    const char* name;
+    Impairment impairment;
+};
+
+// rough stand-ins for the links people connect over
+static const ImpairmentProfile IMPAIRMENT_PROFILES[] = {
+    { "none", { 0.0f, 0, 0 } },
+    { "lan", { 0.0f, 500, 100 } },
+    { "wifi", { 0.005f, 5000, 3000 } },
+    { "mobile", { 0.02f, 40000, 15000 } },
+    { "lossy", { 0.1f, 20000, 5000 } }
+};
+
+static const int SEND_INTERVAL_MSECS = 1;
+static const int MAX_SENDS_PER_INTERVAL = 2000; // so that sending doesn't starve the receiver of the event loop
+static const quint64 UNRELIABLE_DRAIN_USECS = 500 * USECS_PER_MSEC; // after the last send, for what is still in flight
+
+static quint64 percentile(const std::vector<quint64>& sorted, float fraction) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    size_t index = std::min(sorted.size() - 1, (size_t)(fraction * (float)sorted.size()));
+    return sorted[index];
+}
+
+UDTBenchmark::UDTBenchmark(int argc, char* argv[]) : QCoreApplication(argc, argv) {
+
+    // parse command-line
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Vircadia UDT Benchmark\n\n"
+        "To impair real sockets instead of using the in-process relay, run with --profile none and add a netem "
+        "qdisc to the loopback interface, e.g. tc qdisc add dev lo root netem delay 20ms 5ms loss 1%");
+    const QCommandLineOption helpOption = parser.addHelpOption();
+
+    const QCommandLineOption modesOption("m", "comma separated traffic to run: unreliable, reliable, ordered, message",
+                                         "modes", "unreliable,reliable,ordered,message");
+    parser.addOption(modesOption);
+
+    const QCommandLineOption packetsOption("n", "packets to send per run", "packets", "100000");
+    parser.addOption(packetsOption);
+
+    const QCommandLineOption packetSizeOption("s", "datagram size in bytes", "bytes", QString::number(udt::MAX_PACKET_SIZE));
+    parser.addOption(packetSizeOption);
+
+    const QCommandLineOption messageSizeOption("message-size", "bytes per message in message runs", "bytes", "100000");
+    parser.addOption(messageSizeOption);
+
+    const QCommandLineOption rateOption("rate", "packets per second for unreliable runs", "pps", "20000");
+    parser.addOption(rateOption);
+
+    const QCommandLineOption windowOption("window", "packets in flight for reliable runs", "packets", "1000");
+    parser.addOption(windowOption);
+
+    const QCommandLineOption profileOption("profile", "impairment: none, lan, wifi, mobile or lossy", "profile", "none");
+    parser.addOption(profileOption);
+
+    const QCommandLineOption lossOption("loss", "percentage of datagrams to drop, overrides the profile", "percent");
+    parser.addOption(lossOption);
+
+    const QCommandLineOption delayOption("delay", "one way delay, overrides the profile", "milliseconds");
+    parser.addOption(delayOption);
+
+    const QCommandLineOption jitterOption("jitter", "delay variation either way, overrides the profile", "milliseconds");
+    parser.addOption(jitterOption);
+
+    const QCommandLineOption timeoutOption("timeout", "give up on a run after this long", "seconds", "60");
+    parser.addOption(timeoutOption);
+
+    const QCommandLineOption outputOption("o", "write the results as JSON to this file", "filename.json");
+    parser.addOption(outputOption);
+
+    if (!parser.parse(QCoreApplication::arguments())) {
+        qCritical() << parser.errorText() << Qt::endl;
+        parser.showHelp();
+        _returnCode = 1;
+        return;
+    }
+
+    if (parser.isSet(helpOption)) {
+        parser.showHelp();
+        return;
+    }
+
+    for (const auto& name : parser.value(modesOption).split(',', Qt::SkipEmptyParts)) {
+        bool found = false;
+        for (Mode mode : { Mode::Unreliable, Mode::Reliable, Mode::Ordered, Mode::Message }) {
+            if (name.trimmed().compare(modeName(mode), Qt::CaseInsensitive) == 0) {
+                _modes.push_back(mode);
+                found = true;
+            }
+        }
+        if (!found) {
+            qCritical() << "Unknown traffic" << name;
+            _returnCode = 1;
+            return;
+        }
+    }
+
+    QString profileName = parser.value(profileOption);
+    bool foundProfile = false;
+    for (const auto& profile : IMPAIRMENT_PROFILES) {
+        if (profileName.compare(profile.name, Qt::CaseInsensitive) == 0) {
+            _impairment = profile.impairment;
+            foundProfile = true;
+        }
+    }
+    if (!foundProfile) {
+        qCritical() << "Unknown impairment profile" << profileName;
+        _returnCode = 1;
+        return;
+    }
+    if (parser.isSet(lossOption)) {
+        _impairment.loss = qBound(0.0f, parser.value(lossOption).toFloat() / 100.0f, 1.0f);
+    }
+    if (parser.isSet(delayOption)) {
+        _impairment.delayUsec = std::max((int)(parser.value(delayOption).toFloat() * USECS_PER_MSEC), 0);
+    }
+    if (parser.isSet(jitterOption)) {
+        _impairment.jitterUsec = std::max((int)(parser.value(jitterOption).toFloat() * USECS_PER_MSEC), 0);
+    }
+
+    _numPackets = std::max(parser.value(packetsOption).toInt(), 1);
+    _packetSize = qBound(udt::Packet::localHeaderSize(true) + (int)sizeof(PacketStamp),
+                         parser.value(packetSizeOption).toInt(), udt::MAX_PACKET_SIZE);
+    _messageSize = std::max(parser.value(messageSizeOption).toInt(), 1);
+    _unreliableRate = std::max(parser.value(rateOption).toInt(), 1);
+    _window = std::max(parser.value(windowOption).toInt(), 1);
+    _timeoutMsecs = std::max(parser.value(timeoutOption).toInt(), 1) * (int)MSECS_PER_SECOND;
+
+    qInfo().noquote() << QString("%1 packets of %2 bytes, %3% loss, %4 ms delay, %5 ms jitter")
+        .arg(_numPackets).arg(_packetSize).arg(_impairment.loss * 100.0f)
+        .arg((float)_impairment.delayUsec / USECS_PER_MSEC).arg((float)_impairment.jitterUsec / USECS_PER_MSEC);
+    qInfo().noquote() << "traffic      delivered      Mb/s        pps   latency ms (p50 / p99 / p99.9 / max)   CPU us/packet   resent";
+
+    QJsonArray runs;
+    for (Mode mode : _modes) {
+        Result result = runMode(mode);
+        std::sort(result.latenciesUsec.begin(), result.latenciesUsec.end());
+        printResult(result);
+        runs.append(toJson(result));
+        if (!result.completed) {
+            _returnCode = 3;
+        }
+    }
+
+    if (parser.isSet(outputOption)) {
+        QJsonObject profile;
+        profile["lossPercent"] = _impairment.loss * 100.0f;
+        profile["delayMsecs"] = (double)_impairment.delayUsec / USECS_PER_MSEC;
+        profile["jitterMsecs"] = (double)_impairment.jitterUsec / USECS_PER_MSEC;
+
+        QJsonObject results;
+        results["timestamp"] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+        results["packetSize"] = _packetSize;
+        results["packets"] = _numPackets;
+        results["messageSize"] = _messageSize;
+        results["unreliableRate"] = _unreliableRate;
+        results["window"] = _window;
+        results["impairment"] = profile;
+        results["runs"] = runs;
+
+        QFile file(parser.value(outputOption));
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            qCritical() << "Could not write results to" << file.fileName();
+            _returnCode = 2;
+            return;
+        }
+        file.write(QJsonDocument(results).toJson());
+    }
+}
+
+QString UDTBenchmark::modeName(Mode mode) {
+    switch (mode) {
+        case Mode::Unreliable:
+            return "unreliable";
+        case Mode::Reliable:
+            return "reliable";
+        case Mode::Ordered:
+            return "ordered";
+        case Mode::Message:
+            return "message";
+    }
+    return QString();
+}
+
+UDTBenchmark::Result UDTBenchmark::runMode(Mode mode) {
+    Result result;
+    result.mode = mode;
+
+    bool isUnreliable = mode == Mode::Unreliable;
+    bool isPartOfMessage = mode == Mode::Ordered || mode == Mode::Message;
+    int payloadSize = std::min(_packetSize - udt::Packet::localHeaderSize(isPartOfMessage),
+                               (int)udt::Packet::maxPayloadSize(isPartOfMessage));
+
+    // messages are packets that each start with the message's stamp, so that every packet can be checked
+    int packetsPerMessage = mode == Mode::Message ? std::max((_messageSize + payloadSize - 1) / payloadSize, 1) : 1;
+    quint64 numToSend = std::max(_numPackets / packetsPerMessage, 1);
+    quint64 window = std::max(_window / packetsPerMessage, 1);
+
+    // written from the socket's thread and its receive shards
+    std::mutex latenciesMutex;
+    std::vector<quint64> latencies;
+    latencies.reserve(numToSend);
+    std::atomic<quint64> numReceived { 0 };
+    std::atomic<quint64> bytesReceived { 0 };
+    std::atomic<quint64> lastReceiveUsec { 0 };
+
+    auto received = [&](const udt::Packet& packet, bool completes) {
+        bytesReceived += packet.getDataSize();
+        if (!completes || packet.getPayloadSize() < (qint64)sizeof(PacketStamp)) {
+            return;
+        }
+
+        PacketStamp stamp;
+        memcpy(&stamp, packet.getPayload(), sizeof(stamp));
+        quint64 now = usecTimestampNow();
+        {
+            std::lock_guard<std::mutex> lock(latenciesMutex);
+            latencies.push_back(now > stamp.sendUsec ? now - stamp.sendUsec : 0);
+        }
+        lastReceiveUsec = now;
+        ++numReceived;
+    };
+
+    udt::Socket receiver;
+    udt::Socket sender;
+    receiver.bind(SocketType::UDP, QHostAddress::LocalHost);
+    sender.bind(SocketType::UDP, QHostAddress::LocalHost);
+    SockAddr receiverAddress(SocketType::UDP, QHostAddress::LocalHost, receiver.localPort(SocketType::UDP));
+    SockAddr senderAddress(SocketType::UDP, QHostAddress::LocalHost, sender.localPort(SocketType::UDP));
+
+    receiver.setPacketHandler([&](std::unique_ptr<udt::Packet> packet) {
+        received(*packet, true);
+    });
+    receiver.setMessageHandler([&](std::unique_ptr<udt::Packet> packet) {
+        auto position = packet->getPacketPosition();
+        received(*packet, position == udt::Packet::ONLY || position == udt::Packet::LAST);
+    });
+
+    std::unique_ptr<ImpairmentRelay> relay;
+    SockAddr target = receiverAddress;
+    if (_impairment.isActive()) {
+        relay.reset(new ImpairmentRelay(_impairment, senderAddress, receiverAddress));
+        target = relay->getAddress();
+    }
+
+    QByteArray chunk(payloadSize, 0);
+    auto send = [&] {
+        PacketStamp stamp { usecTimestampNow() };
+        memcpy(chunk.data(), &stamp, sizeof(stamp));
+
+        if (isPartOfMessage) {
+            auto packetList = udt::PacketList::create(PacketType::Unknown, QByteArray(), true, true);
+            for (int i = 0; i < packetsPerMessage; ++i) {
+                packetList->write(chunk);
+                packetList->closeCurrentPacket();
+            }
+            sender.writePacketList(std::move(packetList), target);
+        } else {
+            auto packet = udt::Packet::create(payloadSize, !isUnreliable);
+            packet->setPayloadSize(payloadSize);
+            memcpy(packet->getPayload(), chunk.constData(), payloadSize);
+            if (isUnreliable) {
+                sender.writePacket(*packet, target);
+            } else {
+                sender.writePacket(std::move(packet), target);
+            }
+        }
+        ++result.numSent;
+    };
+
+    quint64 drainUsecs = UNRELIABLE_DRAIN_USECS + 2 * (quint64)(_impairment.delayUsec + _impairment.jitterUsec);
+    quint64 timeoutUsecs = (quint64)_timeoutMsecs * USECS_PER_MSEC;
+    quint64 startUsec = usecTimestampNow();
+    quint64 lastSendUsec = startUsec;
+    std::clock_t startCPU = std::clock();
+
+    QEventLoop loop;
+    QTimer sendTimer;
+    sendTimer.setTimerType(Qt::PreciseTimer);
+    QObject::connect(&sendTimer, &QTimer::timeout, [&] {
+        quint64 now = usecTimestampNow();
+
+        // unreliable traffic is paced by the clock, reliable traffic by what has arrived
+        quint64 allowed = isUnreliable ? (now - startUsec) * _unreliableRate / USECS_PER_SECOND + 1
+                                       : numReceived + window;
+        allowed = std::min(std::min(allowed, numToSend), result.numSent + MAX_SENDS_PER_INTERVAL);
+        while (result.numSent < allowed) {
+            send();
+            lastSendUsec = now;
+        }
+
+        if (result.numSent == numToSend &&
+            (numReceived == numToSend || (isUnreliable && now - lastSendUsec > drainUsecs))) {
+            result.completed = true;
+            loop.quit();
+        } else if (now - startUsec > timeoutUsecs) {
+            qWarning() << "Timed out running" << modeName(mode) << "traffic";
+            loop.quit();
+        }
+    });
+    sendTimer.start(SEND_INTERVAL_MSECS);
+    loop.exec();
+    sendTimer.stop();
+
+    // std::clock is process CPU time on POSIX, so this covers both sockets, the relay and their threads
+    result.cpuUsec = (quint64)((double)(std::clock() - startCPU) * USECS_PER_SECOND / CLOCKS_PER_SEC);
+    result.durationUsec = lastReceiveUsec > startUsec ? lastReceiveUsec - startUsec : 0;
+    result.numReceived = numReceived;
+    result.bytesReceived = bytesReceived;
+    result.relayDropped = relay ? relay->getNumDropped() : 0;
+
+    for (const auto& connection : sender.sampleStatsForAllConnections()) {
+        result.retransmittedPackets += connection.second.retransmittedPackets;
+        result.rttMsecs = (float)connection.second.rtt / USECS_PER_MSEC;
+    }
+
+    receiver.setPacketHandler(nullptr);
+    receiver.setMessageHandler(nullptr);
+    {
+        std::lock_guard<std::mutex> lock(latenciesMutex);
+        result.latenciesUsec.swap(latencies);
+    }
+    return result;
+}
+
+void UDTBenchmark::printResult(const Result& result) const {
+    float seconds = (float)result.durationUsec / USECS_PER_SECOND;
+    float packets = (float)result.bytesReceived / (float)_packetSize;
+    const auto& latencies = result.latenciesUsec;
+
+    qInfo().noquote() << QString("%1 %2/%3 %4 %5   %6 / %7 / %8 / %9   %10   %11%12")
+        .arg(modeName(result.mode), -10)
+        .arg(result.numReceived, 9)
+        .arg(result.numSent, -7)
+        .arg(seconds > 0.0f ? (float)result.bytesReceived * BITS_IN_BYTE / seconds / 1.0e6f : 0.0f, 8, 'f', 1)
+        .arg(seconds > 0.0f ? packets / seconds : 0.0f, 10, 'f', 0)
+        .arg((float)percentile(latencies, 0.5f) / USECS_PER_MSEC, 7, 'f', 2)
+        .arg((float)percentile(latencies, 0.99f) / USECS_PER_MSEC, 7, 'f', 2)
+        .arg((float)percentile(latencies, 0.999f) / USECS_PER_MSEC, 7, 'f', 2)
+        .arg(latencies.empty() ? 0.0f : (float)latencies.back() / USECS_PER_MSEC, 7, 'f', 2)
+        .arg(packets > 0.0f ? (float)result.cpuUsec / packets : 0.0f, 13, 'f', 2)
+        .arg(result.retransmittedPackets, 8)
+        .arg(result.completed ? "" : "   (incomplete)");
+}
+
+QJsonObject UDTBenchmark::toJson(const Result& result) const {
+    double seconds = (double)result.durationUsec / USECS_PER_SECOND;
+    double packets = (double)result.bytesReceived / (double)_packetSize;
+    const auto& latencies = result.latenciesUsec;
+
+    QJsonObject latency;
+    latency["p50"] = (double)percentile(latencies, 0.5f) / USECS_PER_MSEC;
+    latency["p90"] = (double)percentile(latencies, 0.9f) / USECS_PER_MSEC;
+    latency["p99"] = (double)percentile(latencies, 0.99f) / USECS_PER_MSEC;
+    latency["p999"] = (double)percentile(latencies, 0.999f) / USECS_PER_MSEC;
+    latency["max"] = latencies.empty() ? 0.0 : (double)latencies.back() / USECS_PER_MSEC;
+
+    QJsonObject run;
+    run["traffic"] = modeName(result.mode);
+    run["completed"] = result.completed;
+    run["sent"] = (double)result.numSent;
+    run["received"] = (double)result.numReceived;
+    run["bytesReceived"] = (double)result.bytesReceived;
+    run["durationMsecs"] = (double)result.durationUsec / USECS_PER_MSEC;
+    run["megabitsPerSecond"] = seconds > 0.0 ? (double)result.bytesReceived * BITS_IN_BYTE / seconds / 1.0e6 : 0.0;
+    run["packetsPerSecond"] = seconds > 0.0 ? packets / seconds : 0.0;
+    run["latencyMsecs"] = latency;
+    run["cpuUsecsPerPacket"] = packets > 0.0 ? (double)result.cpuUsec / packets : 0.0;
+    run["retransmittedPackets"] = (double)result.retransmittedPackets;
+    run["relayDropped"] = (double)result.relayDropped;
+    run["rttMsecs"] = result.rttMsecs;
+    return run;
+}
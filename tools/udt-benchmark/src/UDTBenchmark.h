@@ -0,0 +1,75 @@
+//
+//  UDTBenchmark.h
+//  tools/udt-benchmark/src
+//
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef vircadia_UDTBenchmark_h
+#define vircadia_UDTBenchmark_h
+
+#include <vector>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QJsonObject>
+#include <QtCore/QString>
+
+#include "ImpairmentRelay.h"
+
+// Measures udt::Socket throughput, packet rate, latency and CPU cost for each kind of traffic, with repeatable settings.
+//
+// A sender and a receiver socket run in this process on localhost, optionally through an ImpairmentRelay that drops
+// and delays datagrams. Every packet carries its send time, so latency is measured one way on the same clock: per
+// packet for unreliable, reliable and ordered traffic, and from send to completion for multi-packet messages.
+// Results are printed as a table and can be written as JSON to compare runs.
+class UDTBenchmark : public QCoreApplication {
+    Q_OBJECT
+public:
+    UDTBenchmark(int argc, char* argv[]);
+
+    int getReturnCode() const { return _returnCode; }
+
+private:
+    enum class Mode {
+        Unreliable,
+        Reliable,
+        Ordered,
+        Message
+    };
+
+    struct Result {
+        Mode mode;
+        bool completed { false };
+        quint64 numSent { 0 };           // packets, or messages in Message mode
+        quint64 numReceived { 0 };
+        quint64 bytesReceived { 0 };
+        quint64 durationUsec { 0 };
+        quint64 cpuUsec { 0 };
+        quint64 retransmittedPackets { 0 };
+        quint64 relayDropped { 0 };
+        float rttMsecs { 0.0f };
+        std::vector<quint64> latenciesUsec;
+    };
+
+    static QString modeName(Mode mode);
+
+    Result runMode(Mode mode);
+    QJsonObject toJson(const Result& result) const;
+    void printResult(const Result& result) const;
+
+    std::vector<Mode> _modes;
+    Impairment _impairment;
+    int _packetSize { 0 };
+    int _numPackets { 0 };
+    int _messageSize { 0 };
+    int _unreliableRate { 0 };   // packets per second, unreliable traffic can't be paced by what arrives
+    int _window { 0 };           // packets in flight before reliable senders wait on the receiver
+    int _timeoutMsecs { 0 };
+
+    int _returnCode { 0 };
+};
+
+#endif // vircadia_UDTBenchmark_h